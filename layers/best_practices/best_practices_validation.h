@@ -54,6 +54,7 @@ std::string GetSpecialUse(vvl::Extension extension);
 
 namespace bp_state {
 class CommandBufferSubState;
+struct ImageSubmitAccess;
 
 template <typename StateObject, typename Handle>
 void LogResult(const StateObject& state, Handle handle, const RecordObject& record_obj) {
@@ -438,17 +439,15 @@ class BestPractices : public vvl::DeviceProxy {
     bool PreCallValidateCmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveImageInfo2* pResolveImageInfo,
                                          const ErrorObject& error_obj) const override;
 
-    using QueueCallback = std::function<bool(const class vvl::Queue& queue_state, const vvl::CommandBuffer& cb_state)>;
-    using QueueCallbacks = std::vector<QueueCallback>;
+    using ImageSubmitAccesses = std::vector<bp_state::ImageSubmitAccess>;
 
-    void QueueValidateImageView(QueueCallbacks& func, const Location& loc, const vvl::ImageView& image_view,
+    void QueueValidateImageView(ImageSubmitAccesses& accesses, const Location& loc, const vvl::ImageView& image_view,
                                 IMAGE_SUBRESOURCE_USAGE_BP usage);
-    void QueueValidateImage(QueueCallbacks& func, const Location& loc, vvl::Image& image_state, IMAGE_SUBRESOURCE_USAGE_BP usage,
-                            const VkImageSubresourceRange& subresource_range);
-    void QueueValidateImage(QueueCallbacks& func, const Location& loc, vvl::Image& image_state, IMAGE_SUBRESOURCE_USAGE_BP usage,
-                            const VkImageSubresourceLayers& range);
-    void QueueValidateImage(QueueCallbacks& func, const Location& loc, vvl::Image& image_state, IMAGE_SUBRESOURCE_USAGE_BP usage,
-                            uint32_t array_layer, uint32_t mip_level);
+    void QueueValidateImage(ImageSubmitAccesses& accesses, const Location& loc, vvl::Image& image_state,
+                            IMAGE_SUBRESOURCE_USAGE_BP usage, const VkImageSubresourceRange& subresource_range);
+    void QueueValidateImage(ImageSubmitAccesses& accesses, const Location& loc, vvl::Image& image_state,
+                            IMAGE_SUBRESOURCE_USAGE_BP usage, const VkImageSubresourceLayers& range);
+    void ValidateImageInQueue(const vvl::Queue& qs, const vvl::CommandBuffer& cbs, const bp_state::ImageSubmitAccess& access);
     void ValidateImageInQueue(const vvl::Queue& qs, const vvl::CommandBuffer& cbs, const Location& loc, vvl::Image& image_state,
                               IMAGE_SUBRESOURCE_USAGE_BP usage, uint32_t array_layer, uint32_t mip_level);
     void ValidateImageInQueueArmImg(const Location& loc, vvl::Image& image_state, IMAGE_SUBRESOURCE_USAGE_BP last_usage,
@@ -53,22 +53,6 @@ static bool IsClearColorZeroOrOne(VkFormat format, const std::array<uint32_t, 4>
     return is_one || is_zero;
 }
 
-template <typename Func>
-static void ForEachSubresource(const vvl::Image& image, const VkImageSubresourceRange& range, Func&& func) {
-    const uint32_t layer_count =
-        (range.layerCount == VK_REMAINING_ARRAY_LAYERS) ? (image.full_range.layerCount - range.baseArrayLayer) : range.layerCount;
-    const uint32_t level_count =
-        (range.levelCount == VK_REMAINING_MIP_LEVELS) ? (image.full_range.levelCount - range.baseMipLevel) : range.levelCount;
-
-    for (uint32_t i = 0; i < layer_count; ++i) {
-        const uint32_t layer = range.baseArrayLayer + i;
-        for (uint32_t j = 0; j < level_count; ++j) {
-            const uint32_t level = range.baseMipLevel + j;
-            func(layer, level);
-        }
-    }
-}
-
 bool BestPractices::ValidateZcullScope(const bp_state::CommandBufferSubState& cb_state, const Location& loc) const {
     assert(VendorCheckEnabled(kBPVendorNVIDIA));
 
@@ -99,28 +83,28 @@ bool BestPractices::ValidateZcull(const bp_state::CommandBufferSubState& cb_stat
     auto image_state = Get<vvl::Image>(image);
     ASSERT_AND_RETURN_SKIP(image_state);
 
-    ForEachSubresource(*image_state, subresource_range, [&](uint32_t layer, uint32_t level) {
-        if (is_balanced) {
-            return;
-        }
-        const auto& resource = tree.GetState(layer, level);
-        const uint64_t num_draws = resource.num_less_draws + resource.num_greater_draws;
-
-        if (num_draws == 0) {
-            return;
-        }
-        const uint64_t less_ratio = (resource.num_less_draws * 100) / num_draws;
-        const uint64_t greater_ratio = (resource.num_greater_draws * 100) / num_draws;
-
-        if ((less_ratio > kZcullDirectionBalanceRatioNVIDIA) && (greater_ratio > kZcullDirectionBalanceRatioNVIDIA)) {
-            is_balanced = true;
+    tree.ForEachIndexRange(*image_state, subresource_range, [&](const vvl::range<uint32_t>& index_range) {
+        for (auto it = tree.states.lower_bound(index_range);
+             !is_balanced && it != tree.states.end() && it->first.begin < index_range.end; ++it) {
+            const auto& resource = it->second;
+            const uint64_t num_draws = resource.num_less_draws + resource.num_greater_draws;
 
-            if (greater_ratio > less_ratio) {
-                good_mode = "GREATER";
-                bad_mode = "LESS";
-            } else {
-                good_mode = "LESS";
-                bad_mode = "GREATER";
+            if (num_draws == 0) {
+                continue;
+            }
+            const uint64_t less_ratio = (resource.num_less_draws * 100) / num_draws;
+            const uint64_t greater_ratio = (resource.num_greater_draws * 100) / num_draws;
+
+            if ((less_ratio > kZcullDirectionBalanceRatioNVIDIA) && (greater_ratio > kZcullDirectionBalanceRatioNVIDIA)) {
+                is_balanced = true;
+
+                if (greater_ratio > less_ratio) {
+                    good_mode = "GREATER";
+                    bad_mode = "LESS";
+                } else {
+                    good_mode = "LESS";
+                    bad_mode = "GREATER";
+                }
             }
         }
     });
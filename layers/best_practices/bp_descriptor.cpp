@@ -47,20 +47,20 @@ bool BestPractices::PreCallValidateAllocateDescriptorSets(VkDevice device, const
                            ". This pool only has %" PRIu32 " descriptorSets remaining.",
                            pAllocateInfo->descriptorSetCount, FormatHandle(*pool_state).c_str(), pool_state->GetAvailableSets());
         }
-        auto ads_pool_state = Get<vvl::DescriptorPool>(pAllocateInfo->descriptorPool);
-        for (auto it = ads_state_data.required_descriptors_by_type.begin(); it != ads_state_data.required_descriptors_by_type.end();
-             ++it) {
-            auto available_count = ads_pool_state->GetAvailableCount(it->first);
+        const auto available_counts = pool_state->GetAvailableCounts(ads_state_data.required_descriptors_by_type);
+        uint32_t type_index = 0;
+        for (const auto& [type, required_count] : ads_state_data.required_descriptors_by_type) {
+            const uint32_t available_count = available_counts[type_index++];
 
-            if (ads_state_data.required_descriptors_by_type.at(it->first) > available_count) {
+            if (required_count > available_count) {
                 skip |= LogWarning(
-                    "BestPractices-vkAllocateDescriptorSets-EmptyDescriptorPoolType", ads_pool_state->Handle(), error_obj.location,
+                    "BestPractices-vkAllocateDescriptorSets-EmptyDescriptorPoolType", pool_state->Handle(), error_obj.location,
                     "Unable to allocate %" PRIu32
                     " descriptors of type %s from %s"
                     ". This pool only has %" PRIu32 " descriptors of this type remaining.\n%s",
-                    ads_state_data.required_descriptors_by_type.at(it->first), string_VkDescriptorType(VkDescriptorType(it->first)),
-                    FormatHandle(*ads_pool_state).c_str(), available_count,
-                    device_state->PrintDescriptorAllocation(*pAllocateInfo, *pool_state, VkDescriptorType(it->first)).c_str());
+                    required_count, string_VkDescriptorType(VkDescriptorType(type)), FormatHandle(*pool_state).c_str(),
+                    available_count,
+                    device_state->PrintDescriptorAllocation(*pAllocateInfo, *pool_state, VkDescriptorType(type)).c_str());
             }
         }
     }
@@ -609,7 +609,7 @@ void BestPractices::UpdateBoundDescriptorSets(bp_state::CommandBufferSubState& c
                 }
 
                 if (auto image_view_state = Get<vvl::ImageView>(image_view)) {
-                    QueueValidateImageView(cb_state.queue_submit_functions, loc, *image_view_state,
+                    QueueValidateImageView(cb_state.submit_image_accesses, loc, *image_view_state,
                                            IMAGE_SUBRESOURCE_USAGE_BP::DESCRIPTOR_ACCESS);
                 }
             }
@@ -135,15 +135,14 @@ bool BestPractices::PreCallValidateCreateImage(VkDevice device, const VkImageCre
     return skip;
 }
 
-void BestPractices::QueueValidateImageView(QueueCallbacks& funcs, const Location& loc, const vvl::ImageView& image_view,
+void BestPractices::QueueValidateImageView(ImageSubmitAccesses& accesses, const Location& loc, const vvl::ImageView& image_view,
                                            IMAGE_SUBRESOURCE_USAGE_BP usage) {
-    auto image_state = std::static_pointer_cast<vvl::Image>(image_view.image_state);
     if (image_view.image_state) {
-        QueueValidateImage(funcs, loc, *image_view.image_state, usage, image_view.normalized_subresource_range);
+        QueueValidateImage(accesses, loc, *image_view.image_state, usage, image_view.normalized_subresource_range);
     }
 }
 
-void BestPractices::QueueValidateImage(QueueCallbacks& funcs, const Location& loc, vvl::Image& image_state,
+void BestPractices::QueueValidateImage(ImageSubmitAccesses& accesses, const Location& loc, vvl::Image& image_state,
                                        IMAGE_SUBRESOURCE_USAGE_BP usage, const VkImageSubresourceRange& subresource_range) {
     // If we're viewing a 3D slice, ignore base array layer.
     // The entire 3D subresource is accessed as one atomic unit.
@@ -154,30 +153,38 @@ void BestPractices::QueueValidateImage(QueueCallbacks& funcs, const Location& lo
     const uint32_t max_levels = image_state.create_info.mipLevels - subresource_range.baseMipLevel;
     const uint32_t mip_levels = std::min(image_state.create_info.mipLevels, max_levels);
 
-    for (uint32_t layer = 0; layer < array_layers; layer++) {
-        for (uint32_t level = 0; level < mip_levels; level++) {
-            QueueValidateImage(funcs, loc, image_state, usage, layer + base_array_layer, level + subresource_range.baseMipLevel);
-        }
+    if (array_layers != 0 && mip_levels != 0) {
+        accesses.push_back({image_state.shared_from_this(), loc, usage, bp_state::ImageSubmitAccess::Type::Usage, base_array_layer,
+                            array_layers, subresource_range.baseMipLevel, mip_levels});
     }
 }
 
-void BestPractices::QueueValidateImage(QueueCallbacks& funcs, const Location& loc, vvl::Image& image_state,
+void BestPractices::QueueValidateImage(ImageSubmitAccesses& accesses, const Location& loc, vvl::Image& image_state,
                                        IMAGE_SUBRESOURCE_USAGE_BP usage, const VkImageSubresourceLayers& subresource_layers) {
     const uint32_t max_layers = image_state.create_info.arrayLayers - subresource_layers.baseArrayLayer;
     const uint32_t array_layers = std::min(subresource_layers.layerCount, max_layers);
 
-    for (uint32_t layer = 0; layer < array_layers; layer++) {
-        QueueValidateImage(funcs, loc, image_state, usage, layer + subresource_layers.baseArrayLayer, subresource_layers.mipLevel);
+    if (array_layers != 0) {
+        accesses.push_back({image_state.shared_from_this(), loc, usage, bp_state::ImageSubmitAccess::Type::Usage,
+                            subresource_layers.baseArrayLayer, array_layers, subresource_layers.mipLevel, 1});
     }
 }
 
-void BestPractices::QueueValidateImage(QueueCallbacks& funcs, const Location& loc, vvl::Image& image_state,
-                                       IMAGE_SUBRESOURCE_USAGE_BP usage, uint32_t array_layer, uint32_t mip_level) {
-    funcs.emplace_back(
-        [this, loc, &image_state, usage, array_layer, mip_level](const vvl::Queue& qs, const vvl::CommandBuffer& cbs) -> bool {
-            ValidateImageInQueue(qs, cbs, loc, image_state, usage, array_layer, mip_level);
-            return false;
-        });
+void BestPractices::ValidateImageInQueue(const vvl::Queue& qs, const vvl::CommandBuffer& cbs,
+                                         const bp_state::ImageSubmitAccess& access) {
+    auto& sub_state = bp_state::SubState(*access.image);
+    const uint32_t end_array_layer = access.base_array_layer + access.layer_count;
+    const uint32_t end_mip_level = access.base_mip_level + access.level_count;
+    for (uint32_t layer = access.base_array_layer; layer < end_array_layer; layer++) {
+        for (uint32_t level = access.base_mip_level; level < end_mip_level; level++) {
+            if (access.type == bp_state::ImageSubmitAccess::Type::QueueFamilyAcquire) {
+                // Update queue family index without changing usage, signifying a correct queue family transfer
+                sub_state.UpdateUsage(layer, level, sub_state.GetUsageType(layer, level), qs.queue_family_index);
+            } else {
+                ValidateImageInQueue(qs, cbs, access.loc, *access.image, access.usage, layer, level);
+            }
+        }
+    }
 }
 
 void BestPractices::ValidateImageInQueueArmImg(const Location& loc, vvl::Image& image_state, IMAGE_SUBRESOURCE_USAGE_BP last_usage,
@@ -81,9 +81,8 @@ void CommandBufferSubState::RecordExecuteCommand(vvl::CommandBuffer& secondary_c
         render_pass_state.has_draw_cmd |= secondary_sub_state.render_pass_state.has_draw_cmd;
     }
 
-    for (auto& function : secondary_sub_state.queue_submit_functions) {
-        queue_submit_functions.push_back(function);
-    }
+    submit_image_accesses.insert(submit_image_accesses.end(), secondary_sub_state.submit_image_accesses.begin(),
+                                 secondary_sub_state.submit_image_accesses.end());
 
     for (auto& early_clear : secondary_sub_state.render_pass_state.earlyClearAttachments) {
         if (validator.ClearAttachmentsIsFullClear(*this, uint32_t(early_clear.rects.size()), early_clear.rects.data())) {
@@ -245,7 +244,7 @@ void CommandBufferSubState::RecordBeginRenderPass(const VkRenderPassBeginInfo& r
         }
 
         if (auto image_view_state = base.dev_data.Get<vvl::ImageView>(image_view)) {
-            validator.QueueValidateImageView(queue_submit_functions, vvl::Func::vkCmdBeginRenderPass, *image_view_state, usage);
+            validator.QueueValidateImageView(submit_image_accesses, vvl::Func::vkCmdBeginRenderPass, *image_view_state, usage);
         }
     }
 
@@ -284,7 +283,7 @@ void CommandBufferSubState::RecordBeginRenderPass(const VkRenderPassBeginInfo& r
         }
 
         if (auto image_view_state = base.dev_data.Get<vvl::ImageView>(image_view)) {
-            validator.QueueValidateImageView(queue_submit_functions_after_render_pass, vvl::Func::vkCmdEndRenderPass,
+            validator.QueueValidateImageView(submit_image_accesses_after_render_pass, vvl::Func::vkCmdEndRenderPass,
                                              *image_view_state, usage);
         }
     }
@@ -394,17 +393,17 @@ void CommandBufferSubState::RecordEndRenderPass(const VkSubpassEndInfo*, const L
     RecordEndRenderingCommon(*base.active_render_pass);
 
     // Add Deferred Queue
-    queue_submit_functions.insert(queue_submit_functions.end(), queue_submit_functions_after_render_pass.begin(),
-                                  queue_submit_functions_after_render_pass.end());
-    queue_submit_functions_after_render_pass.clear();
+    submit_image_accesses.insert(submit_image_accesses.end(), submit_image_accesses_after_render_pass.begin(),
+                                 submit_image_accesses_after_render_pass.end());
+    submit_image_accesses_after_render_pass.clear();
 }
 
 void CommandBufferSubState::RecordCopyImage(vvl::Image& src_image_state, vvl::Image& dst_image_state, VkImageLayout, VkImageLayout,
                                             uint32_t region_count, const VkImageCopy* regions, const Location& loc) {
     for (uint32_t i = 0; i < region_count; i++) {
-        validator.QueueValidateImage(queue_submit_functions, loc, src_image_state, IMAGE_SUBRESOURCE_USAGE_BP::COPY_READ,
+        validator.QueueValidateImage(submit_image_accesses, loc, src_image_state, IMAGE_SUBRESOURCE_USAGE_BP::COPY_READ,
                                      regions[i].srcSubresource);
-        validator.QueueValidateImage(queue_submit_functions, loc, dst_image_state, IMAGE_SUBRESOURCE_USAGE_BP::COPY_WRITE,
+        validator.QueueValidateImage(submit_image_accesses, loc, dst_image_state, IMAGE_SUBRESOURCE_USAGE_BP::COPY_WRITE,
                                      regions[i].dstSubresource);
     }
 }
@@ -412,9 +411,9 @@ void CommandBufferSubState::RecordCopyImage(vvl::Image& src_image_state, vvl::Im
 void CommandBufferSubState::RecordCopyImage2(vvl::Image& src_image_state, vvl::Image& dst_image_state, VkImageLayout, VkImageLayout,
                                              uint32_t region_count, const VkImageCopy2* regions, const Location& loc) {
     for (uint32_t i = 0; i < region_count; i++) {
-        validator.QueueValidateImage(queue_submit_functions, loc, src_image_state, IMAGE_SUBRESOURCE_USAGE_BP::COPY_READ,
+        validator.QueueValidateImage(submit_image_accesses, loc, src_image_state, IMAGE_SUBRESOURCE_USAGE_BP::COPY_READ,
                                      regions[i].srcSubresource);
-        validator.QueueValidateImage(queue_submit_functions, loc, dst_image_state, IMAGE_SUBRESOURCE_USAGE_BP::COPY_WRITE,
+        validator.QueueValidateImage(submit_image_accesses, loc, dst_image_state, IMAGE_SUBRESOURCE_USAGE_BP::COPY_WRITE,
                                      regions[i].dstSubresource);
     }
 }
@@ -422,7 +421,7 @@ void CommandBufferSubState::RecordCopyImage2(vvl::Image& src_image_state, vvl::I
 void CommandBufferSubState::RecordCopyBufferToImage(vvl::Buffer&, vvl::Image& dst_image_state, VkImageLayout, uint32_t region_count,
                                                     const VkBufferImageCopy* regions, const Location& loc) {
     for (uint32_t i = 0; i < region_count; i++) {
-        validator.QueueValidateImage(queue_submit_functions, loc, dst_image_state, IMAGE_SUBRESOURCE_USAGE_BP::COPY_WRITE,
+        validator.QueueValidateImage(submit_image_accesses, loc, dst_image_state, IMAGE_SUBRESOURCE_USAGE_BP::COPY_WRITE,
                                      regions[i].imageSubresource);
     }
 }
@@ -431,7 +430,7 @@ void CommandBufferSubState::RecordCopyBufferToImage2(vvl::Buffer&, vvl::Image& d
                                                      uint32_t region_count, const VkBufferImageCopy2* regions,
                                                      const Location& loc) {
     for (uint32_t i = 0; i < region_count; i++) {
-        validator.QueueValidateImage(queue_submit_functions, loc, dst_image_state, IMAGE_SUBRESOURCE_USAGE_BP::COPY_WRITE,
+        validator.QueueValidateImage(submit_image_accesses, loc, dst_image_state, IMAGE_SUBRESOURCE_USAGE_BP::COPY_WRITE,
                                      regions[i].imageSubresource);
     }
 }
@@ -439,7 +438,7 @@ void CommandBufferSubState::RecordCopyBufferToImage2(vvl::Buffer&, vvl::Image& d
 void CommandBufferSubState::RecordCopyImageToBuffer(vvl::Image& src_image_state, vvl::Buffer&, VkImageLayout, uint32_t region_count,
                                                     const VkBufferImageCopy* regions, const Location& loc) {
     for (uint32_t i = 0; i < region_count; i++) {
-        validator.QueueValidateImage(queue_submit_functions, loc, src_image_state, IMAGE_SUBRESOURCE_USAGE_BP::COPY_READ,
+        validator.QueueValidateImage(submit_image_accesses, loc, src_image_state, IMAGE_SUBRESOURCE_USAGE_BP::COPY_READ,
                                      regions[i].imageSubresource);
     }
 }
@@ -448,7 +447,7 @@ void CommandBufferSubState::RecordCopyImageToBuffer2(vvl::Image& src_image_state
                                                      uint32_t region_count, const VkBufferImageCopy2* regions,
                                                      const Location& loc) {
     for (uint32_t i = 0; i < region_count; i++) {
-        validator.QueueValidateImage(queue_submit_functions, loc, src_image_state, IMAGE_SUBRESOURCE_USAGE_BP::COPY_READ,
+        validator.QueueValidateImage(submit_image_accesses, loc, src_image_state, IMAGE_SUBRESOURCE_USAGE_BP::COPY_READ,
                                      regions[i].imageSubresource);
     }
 }
@@ -456,9 +455,9 @@ void CommandBufferSubState::RecordCopyImageToBuffer2(vvl::Image& src_image_state
 void CommandBufferSubState::RecordBlitImage(vvl::Image& src_image_state, vvl::Image& dst_image_state, VkImageLayout, VkImageLayout,
                                             uint32_t region_count, const VkImageBlit* regions, const Location& loc) {
     for (uint32_t i = 0; i < region_count; i++) {
-        validator.QueueValidateImage(queue_submit_functions, loc, src_image_state, IMAGE_SUBRESOURCE_USAGE_BP::BLIT_READ,
+        validator.QueueValidateImage(submit_image_accesses, loc, src_image_state, IMAGE_SUBRESOURCE_USAGE_BP::BLIT_READ,
                                      regions[i].srcSubresource);
-        validator.QueueValidateImage(queue_submit_functions, loc, dst_image_state, IMAGE_SUBRESOURCE_USAGE_BP::BLIT_WRITE,
+        validator.QueueValidateImage(submit_image_accesses, loc, dst_image_state, IMAGE_SUBRESOURCE_USAGE_BP::BLIT_WRITE,
                                      regions[i].dstSubresource);
     }
 }
@@ -466,9 +465,9 @@ void CommandBufferSubState::RecordBlitImage(vvl::Image& src_image_state, vvl::Im
 void CommandBufferSubState::RecordBlitImage2(vvl::Image& src_image_state, vvl::Image& dst_image_state, VkImageLayout, VkImageLayout,
                                              uint32_t region_count, const VkImageBlit2* regions, const Location& loc) {
     for (uint32_t i = 0; i < region_count; i++) {
-        validator.QueueValidateImage(queue_submit_functions, loc, src_image_state, IMAGE_SUBRESOURCE_USAGE_BP::BLIT_READ,
+        validator.QueueValidateImage(submit_image_accesses, loc, src_image_state, IMAGE_SUBRESOURCE_USAGE_BP::BLIT_READ,
                                      regions[i].srcSubresource);
-        validator.QueueValidateImage(queue_submit_functions, loc, dst_image_state, IMAGE_SUBRESOURCE_USAGE_BP::BLIT_WRITE,
+        validator.QueueValidateImage(submit_image_accesses, loc, dst_image_state, IMAGE_SUBRESOURCE_USAGE_BP::BLIT_WRITE,
                                      regions[i].dstSubresource);
     }
 }
@@ -476,9 +475,9 @@ void CommandBufferSubState::RecordBlitImage2(vvl::Image& src_image_state, vvl::I
 void CommandBufferSubState::RecordResolveImage(vvl::Image& src_image_state, vvl::Image& dst_image_state, uint32_t region_count,
                                                const VkImageResolve* regions, const Location& loc) {
     for (uint32_t i = 0; i < region_count; i++) {
-        validator.QueueValidateImage(queue_submit_functions, loc, src_image_state, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_READ,
+        validator.QueueValidateImage(submit_image_accesses, loc, src_image_state, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_READ,
                                      regions[i].srcSubresource);
-        validator.QueueValidateImage(queue_submit_functions, loc, dst_image_state, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_WRITE,
+        validator.QueueValidateImage(submit_image_accesses, loc, dst_image_state, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_WRITE,
                                      regions[i].dstSubresource);
     }
 }
@@ -486,9 +485,9 @@ void CommandBufferSubState::RecordResolveImage(vvl::Image& src_image_state, vvl:
 void CommandBufferSubState::RecordResolveImage2(vvl::Image& src_image_state, vvl::Image& dst_image_state, uint32_t region_count,
                                                 const VkImageResolve2* regions, const Location& loc) {
     for (uint32_t i = 0; i < region_count; i++) {
-        validator.QueueValidateImage(queue_submit_functions, loc, src_image_state, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_READ,
+        validator.QueueValidateImage(submit_image_accesses, loc, src_image_state, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_READ,
                                      regions[i].srcSubresource);
-        validator.QueueValidateImage(queue_submit_functions, loc, dst_image_state, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_WRITE,
+        validator.QueueValidateImage(submit_image_accesses, loc, dst_image_state, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_WRITE,
                                      regions[i].dstSubresource);
     }
 }
@@ -497,7 +496,7 @@ void CommandBufferSubState::RecordClearColorImage(vvl::Image& image_state, VkIma
                                                   const VkClearColorValue* color_values, uint32_t range_count,
                                                   const VkImageSubresourceRange* ranges, const Location& loc) {
     for (uint32_t i = 0; i < range_count; i++) {
-        validator.QueueValidateImage(queue_submit_functions, loc, image_state, IMAGE_SUBRESOURCE_USAGE_BP::CLEARED, ranges[i]);
+        validator.QueueValidateImage(submit_image_accesses, loc, image_state, IMAGE_SUBRESOURCE_USAGE_BP::CLEARED, ranges[i]);
     }
 
     if (validator.VendorCheckEnabled(kBPVendorNVIDIA)) {
@@ -509,7 +508,7 @@ void CommandBufferSubState::RecordClearDepthStencilImage(vvl::Image& image_state
                                                          const VkClearDepthStencilValue* depth_stencil_values, uint32_t range_count,
                                                          const VkImageSubresourceRange* ranges, const Location& loc) {
     for (uint32_t i = 0; i < range_count; i++) {
-        validator.QueueValidateImage(queue_submit_functions, loc, image_state, IMAGE_SUBRESOURCE_USAGE_BP::CLEARED, ranges[i]);
+        validator.QueueValidateImage(submit_image_accesses, loc, image_state, IMAGE_SUBRESOURCE_USAGE_BP::CLEARED, ranges[i]);
     }
     if (validator.VendorCheckEnabled(kBPVendorNVIDIA)) {
         for (uint32_t i = 0; i < range_count; i++) {
@@ -598,8 +597,8 @@ void CommandBufferSubState::Reset(const Location&) { ResetCBState(); }
 void CommandBufferSubState::ResetCBState() {
     num_submits = 0;
     small_indexed_draw_call_count = 0;
-    queue_submit_functions.clear();
-    queue_submit_functions_after_render_pass.clear();
+    submit_image_accesses.clear();
+    submit_image_accesses_after_render_pass.clear();
     ClearPushConstants();
 }
 
@@ -642,20 +641,16 @@ void CommandBufferSubState::RecordResetEvent(VkEvent event, VkPipelineStageFlags
     }
 }
 
-template <typename Func>
-static void ForEachSubresource(const vvl::Image& image, const VkImageSubresourceRange& range, Func&& func) {
+// Queue family ownership acquisition only updates the queue family of the subresources when submitted
+static ImageSubmitAccess QueueFamilyAcquireAccess(const std::shared_ptr<vvl::Image>& image_state,
+                                                  const VkImageSubresourceRange& range, const Location& loc) {
+    const VkImageSubresourceRange& full_range = image_state->full_range;
     const uint32_t layer_count =
-        (range.layerCount == VK_REMAINING_ARRAY_LAYERS) ? (image.full_range.layerCount - range.baseArrayLayer) : range.layerCount;
+        (range.layerCount == VK_REMAINING_ARRAY_LAYERS) ? (full_range.layerCount - range.baseArrayLayer) : range.layerCount;
     const uint32_t level_count =
-        (range.levelCount == VK_REMAINING_MIP_LEVELS) ? (image.full_range.levelCount - range.baseMipLevel) : range.levelCount;
-
-    for (uint32_t i = 0; i < layer_count; ++i) {
-        const uint32_t layer = range.baseArrayLayer + i;
-        for (uint32_t j = 0; j < level_count; ++j) {
-            const uint32_t level = range.baseMipLevel + j;
-            func(layer, level);
-        }
-    }
+        (range.levelCount == VK_REMAINING_MIP_LEVELS) ? (full_range.levelCount - range.baseMipLevel) : range.levelCount;
+    return {image_state,          loc,         IMAGE_SUBRESOURCE_USAGE_BP::UNDEFINED, ImageSubmitAccess::Type::QueueFamilyAcquire,
+            range.baseArrayLayer, layer_count, range.baseMipLevel,                   level_count};
 }
 
 void CommandBufferSubState::RecordBarriers(uint32_t, const VkBufferMemoryBarrier*, uint32_t image_barrier_count,
@@ -673,16 +668,7 @@ void CommandBufferSubState::RecordBarriers(uint32_t, const VkBufferMemoryBarrier
         // Is a queue ownership acquisition barrier
         if (barrier.srcQueueFamilyIndex != barrier.dstQueueFamilyIndex &&
             barrier.dstQueueFamilyIndex == base.command_pool->queueFamilyIndex) {
-            auto subresource_range = barrier.subresourceRange;
-            queue_submit_functions.emplace_back(
-                [image_state, subresource_range](const vvl::Queue& qs, const vvl::CommandBuffer& cbs) -> bool {
-                    ForEachSubresource(*image_state, subresource_range, [&](uint32_t layer, uint32_t level) {
-                        // Update queue family index without changing usage, signifying a correct queue family transfer
-                        auto& sub_state = bp_state::SubState(*image_state);
-                        sub_state.UpdateUsage(layer, level, sub_state.GetUsageType(layer, level), qs.queue_family_index);
-                    });
-                    return false;
-                });
+            submit_image_accesses.push_back(QueueFamilyAcquireAccess(image_state, barrier.subresourceRange, loc));
         }
 
         if (validator.VendorCheckEnabled(kBPVendorNVIDIA)) {
@@ -704,16 +690,7 @@ void CommandBufferSubState::RecordBarriers2(const VkDependencyInfo& dep_info, co
         // Is a queue ownership acquisition barrier
         if (barrier.srcQueueFamilyIndex != barrier.dstQueueFamilyIndex &&
             barrier.dstQueueFamilyIndex == base.command_pool->queueFamilyIndex) {
-            auto subresource_range = barrier.subresourceRange;
-            queue_submit_functions.emplace_back(
-                [image_state, subresource_range](const vvl::Queue& qs, const vvl::CommandBuffer& cbs) -> bool {
-                    ForEachSubresource(*image_state, subresource_range, [&](uint32_t layer, uint32_t level) {
-                        // Update queue family index without changing usage, signifying a correct queue family transfer
-                        auto& sub_state = bp_state::SubState(*image_state);
-                        sub_state.UpdateUsage(layer, level, sub_state.GetUsageType(layer, level), qs.queue_family_index);
-                    });
-                    return false;
-                });
+            submit_image_accesses.push_back(QueueFamilyAcquireAccess(image_state, barrier.subresourceRange, loc));
         }
 
         if (validator.VendorCheckEnabled(kBPVendorNVIDIA)) {
@@ -876,8 +853,8 @@ void CommandBufferSubState::RecordBindPipeline(VkPipelineBindPoint bind_point, v
 }
 
 void CommandBufferSubState::Submit(vvl::Queue& queue_state, uint32_t perf_submit_pass, const Location& loc) {
-    for (auto& func : queue_submit_functions) {
-        func(queue_state, base);
+    for (const ImageSubmitAccess& access : submit_image_accesses) {
+        validator.ValidateImageInQueue(queue_state, base, access);
     }
 }
 
@@ -923,6 +900,29 @@ void CommandBufferSubState::RecordAttachmentClearAttachments(uint32_t fb_attachm
     }
 }
 
+template <typename Func>
+struct ZcullUpdateOps {
+    using Map = sparse_container::range_map<uint32_t, CommandBufferStateNV::ZcullResourceState>;
+    using Iterator = typename Map::iterator;
+    using Range = typename Map::key_type;
+    // Every subresource has a state from the time the tree is made
+    void infill(Map&, const Iterator&, const Range&) const {}
+    void update(const Iterator& pos) const { func(pos->second); }
+    Func& func;
+};
+
+// Calls func(state) for every subresource of subresource_range, the runs of states are split at the range bounds and the runs
+// that end up equal are merged back
+template <typename Func>
+static void UpdateZcullStates(CommandBufferStateNV::ZcullTree& tree, const vvl::Image& image,
+                              const VkImageSubresourceRange& subresource_range, Func&& func) {
+    const ZcullUpdateOps<Func> ops{func};
+    tree.ForEachIndexRange(image, subresource_range, [&tree, &ops](const vvl::range<uint32_t>& index_range) {
+        sparse_container::infill_update_range(tree.states, index_range, ops);
+    });
+    sparse_container::consolidate(tree.states);
+}
+
 void CommandBufferSubState::RecordBindZcullScopeNV(VkImage depth_attachment, const VkImageSubresourceRange& subresource_range) {
     assert(validator.VendorCheckEnabled(kBPVendorNVIDIA));
 
@@ -943,7 +943,7 @@ void CommandBufferSubState::RecordBindZcullScopeNV(VkImage depth_attachment, con
     if (tree.states.empty()) {
         tree.mip_levels = mip_levels;
         tree.array_layers = array_layers;
-        tree.states.resize(array_layers * mip_levels);
+        tree.states.insert({vvl::range<uint32_t>(0, array_layers * mip_levels), CommandBufferStateNV::ZcullResourceState{}});
     }
 
     nv.zcull_scope.image = depth_attachment;
@@ -975,10 +975,9 @@ void CommandBufferSubState::RecordResetZcullDirectionNV(vvl::Image& depth_image,
     }
     auto& tree = image_it->second;
 
-    ForEachSubresource(depth_image, subresource_range, [&tree](uint32_t layer, uint32_t level) {
-        auto& subresource = tree.GetState(layer, level);
-        subresource.num_less_draws = 0;
-        subresource.num_greater_draws = 0;
+    UpdateZcullStates(tree, depth_image, subresource_range, [](CommandBufferStateNV::ZcullResourceState& state) {
+        state.num_less_draws = 0;
+        state.num_greater_draws = 0;
     });
 }
 
@@ -992,9 +991,8 @@ void CommandBufferSubState::RecordSetZcullDirectionNV(vvl::Image& depth_image, c
     }
     auto& tree = image_it->second;
 
-    ForEachSubresource(depth_image, subresource_range, [&tree, this](uint32_t layer, uint32_t level) {
-        tree.GetState(layer, level).direction = nv.zcull_direction;
-    });
+    UpdateZcullStates(tree, depth_image, subresource_range,
+                      [this](CommandBufferStateNV::ZcullResourceState& state) { state.direction = nv.zcull_direction; });
 }
 
 void CommandBufferSubState::RecordSetScopeZcullDirectionNV(ZcullDirection mode) {
@@ -1014,19 +1012,17 @@ void CommandBufferSubState::RecordZcullDrawNV() {
     auto image = base.dev_data.Get<vvl::Image>(scope.image);
     if (!image) return;
 
-    ForEachSubresource(*image, scope.range, [&scope](uint32_t layer, uint32_t level) {
-        auto& subresource = scope.tree->GetState(layer, level);
-
-        switch (subresource.direction) {
+    UpdateZcullStates(*scope.tree, *image, scope.range, [](CommandBufferStateNV::ZcullResourceState& state) {
+        switch (state.direction) {
             case ZcullDirection::Unknown:
                 // Unreachable
                 assert(false);
                 break;
             case ZcullDirection::Less:
-                ++subresource.num_less_draws;
+                ++state.num_less_draws;
                 break;
             case ZcullDirection::Greater:
-                ++subresource.num_greater_draws;
+                ++state.num_greater_draws;
                 break;
         }
     });
@@ -27,6 +27,7 @@
 #include "state_tracker/image_state.h"
 #include "state_tracker/descriptor_sets.h"
 #include "state_tracker/push_constant_data.h"
+#include "containers/range_map.h"
 
 class BestPractices;
 
@@ -120,15 +121,39 @@ struct CommandBufferStateNV {
         ZcullDirection direction = ZcullDirection::Unknown;
         uint64_t num_less_draws = 0;
         uint64_t num_greater_draws = 0;
+
+        bool operator==(const ZcullResourceState& rhs) const {
+            return direction == rhs.direction && num_less_draws == rhs.num_less_draws &&
+                   num_greater_draws == rhs.num_greater_draws;
+        }
     };
     struct ZcullTree {
-        std::vector<ZcullResourceState> states;
+        // Runs of subresources in the same state, keyed by subresource index (array layer * mip_levels + mip level). Depth
+        // attachments are mostly used whole, so this stays a few entries however many array layers the image has.
+        sparse_container::range_map<uint32_t, ZcullResourceState> states;
         uint32_t mip_levels = 0;
         uint32_t array_layers = 0;
 
-        const ZcullResourceState& GetState(uint32_t layer, uint32_t level) const { return states[layer * mip_levels + level]; }
-
-        ZcullResourceState& GetState(uint32_t layer, uint32_t level) { return states[layer * mip_levels + level]; }
+        // Calls func(index_range) for the subresource index ranges covered by subresource_range, in increasing order
+        template <typename Func>
+        void ForEachIndexRange(const vvl::Image& image, const VkImageSubresourceRange& subresource_range, Func&& func) const {
+            const uint32_t layer_count = (subresource_range.layerCount == VK_REMAINING_ARRAY_LAYERS)
+                                             ? (image.full_range.layerCount - subresource_range.baseArrayLayer)
+                                             : subresource_range.layerCount;
+            const uint32_t level_count = (subresource_range.levelCount == VK_REMAINING_MIP_LEVELS)
+                                             ? (image.full_range.levelCount - subresource_range.baseMipLevel)
+                                             : subresource_range.levelCount;
+            const uint32_t end_layer = subresource_range.baseArrayLayer + layer_count;
+            if (subresource_range.baseMipLevel == 0 && level_count == mip_levels) {
+                // All the levels of consecutive layers are consecutive indices
+                func(vvl::range<uint32_t>(subresource_range.baseArrayLayer * mip_levels, end_layer * mip_levels));
+                return;
+            }
+            for (uint32_t layer = subresource_range.baseArrayLayer; layer < end_layer; ++layer) {
+                const uint32_t begin = layer * mip_levels + subresource_range.baseMipLevel;
+                func(vvl::range<uint32_t>(begin, begin + level_count));
+            }
+        }
     };
     struct ZcullScope {
         VkImage image = VK_NULL_HANDLE;
@@ -146,6 +171,24 @@ struct CommandBufferStateNV {
     bool depth_test_enable = false;
 };
 
+// An image access recorded in a command buffer. It is only checked against how earlier submissions used the image once the
+// command buffer is submitted, so recording just appends one of these per command and range.
+struct ImageSubmitAccess {
+    enum class Type : uint8_t {
+        Usage,               // The subresources are used as |usage|
+        QueueFamilyAcquire,  // Queue family ownership acquire barrier, the subresources move to the submitting queue family
+    };
+
+    std::shared_ptr<vvl::Image> image;
+    Location loc;
+    IMAGE_SUBRESOURCE_USAGE_BP usage;
+    Type type;
+    uint32_t base_array_layer;
+    uint32_t layer_count;
+    uint32_t base_mip_level;
+    uint32_t level_count;
+};
+
 class CommandBufferSubState : public vvl::CommandBufferSubState {
   public:
     explicit CommandBufferSubState(vvl::CommandBuffer& cb, BestPractices& validator);
@@ -246,11 +289,10 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
     };
     vvl::unordered_map<VkEvent, SignalingInfo> event_signaling_state;
 
-    using QueueCallback = std::function<bool(const class vvl::Queue& queue_state, const vvl::CommandBuffer& cb_state)>;
-    std::vector<QueueCallback> queue_submit_functions;
-    // Used by some layers to defer actions until vkCmdEndRenderPass time.
-    // Layers using this are responsible for inserting the callbacks into queue_submit_functions.
-    std::vector<QueueCallback> queue_submit_functions_after_render_pass;
+    // Replayed in order at submit time
+    std::vector<ImageSubmitAccess> submit_image_accesses;
+    // The render pass store ops, appended to submit_image_accesses at vkCmdEndRenderPass time
+    std::vector<ImageSubmitAccess> submit_image_accesses_after_render_pass;
 
     void RecordBindZcullScopeNV(VkImage depth_attachment, const VkImageSubresourceRange& subresource_range);
     void RecordUnbindZcullScopeNV();
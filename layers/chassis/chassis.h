@@ -20,6 +20,9 @@
  ****************************************************************************/
 #include <vulkan/vulkan.h>
 
+#include "generated/dispatch_vector.h"
+#include "generated/error_location_helper.h"
+
 namespace vulkan_layer_chassis {
 typedef enum ApiFunctionType { kFuncTypeInst = 0, kFuncTypePdev = 1, kFuncTypeDev = 2 } ApiFunctionType;
 typedef struct {
@@ -27,6 +30,16 @@ typedef struct {
     void* funcptr;
 } function_data;
 
+// Device command the chassis only calls the intercepts and the dispatch function for, so it can be skipped when none of
+// the intercepts are used (see GetDeviceProcAddr)
+typedef struct {
+    vvl::Func command;
+    InterceptId pre_call_validate_id;
+    InterceptId pre_call_record_id;
+    InterceptId post_call_record_id;
+    void* trampoline;  // only calls the dispatch function
+} passthrough_data;
+
 // Manually written functions referenced from generated code in chassis.cpp
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char* funcName);
@@ -20,6 +20,7 @@
  ****************************************************************************/
 #include "chassis.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "chassis/dispatch_object.h"
@@ -30,8 +31,12 @@
 #include "chassis/chassis_modification_state.h"
 #include "core_checks/core_validation.h"
 #include "profiling/profiling.h"
+#include "profiling/call_stats.h"
+#include "containers/internal_allocator.h"
+#include "containers/object_pool.h"
 #include "containers/small_vector.h"
 #include "utils/dispatch_utils.h"
+#include "utils/text_utils.h"
 
 #define STRINGIFY(s) STRINGIFY_HELPER(s)
 #define STRINGIFY_HELPER(s) #s
@@ -124,8 +129,136 @@ void OutputLayerStatusInfo(vvl::dispatch::Instance* context) {
     }
 }
 const vvl::unordered_map<std::string, function_data>& GetNameToFuncPtrMap();
+const vvl::unordered_map<std::string, passthrough_data>& GetNameToPassthroughMap();
+
+// The intercept vectors never grow after vkCreateDevice, a command none of the validation objects intercept at that point
+// never needs the chassis
+static void InitPassthroughCommands(vvl::dispatch::Device& device_dispatch) {
+    if (device_dispatch.call_stats) {
+        return;
+    }
+    device_dispatch.passthrough_commands.resize(vvl::kFuncCount);
+    const auto& intercept_vectors = device_dispatch.intercept_vectors;
+    for (const auto& [name, data] : GetNameToPassthroughMap()) {
+        device_dispatch.passthrough_commands[size_t(data.command)] = intercept_vectors[data.pre_call_validate_id].empty() &&
+                                                                     intercept_vectors[data.pre_call_record_id].empty() &&
+                                                                     intercept_vectors[data.post_call_record_id].empty();
+    }
+}
+
+// The validation budget and validation_frame_stride only shed the validate phase of the commands recorded in command buffers.
+// Queue and object commands are not frequent enough to matter, and some validation objects hand state from their validate
+// phase to their record phase there (through a TlsGuard).
+static void InitSheddableIntercepts(vvl::dispatch::Device& device_dispatch) {
+    if (!device_dispatch.validation_budget && device_dispatch.settings.global_settings.validation_frame_stride <= 1) {
+        return;
+    }
+    auto& sheddable = device_dispatch.sheddable_intercepts;
+    sheddable.resize(InterceptIdCount);
+    for (const auto& [name, data] : GetNameToPassthroughMap()) {
+        sheddable[data.pre_call_validate_id] = name.rfind("vkCmd", 0) == 0;
+    }
+    // SyncValidator passes the rendering info from the validate to the record phase
+    sheddable[InterceptIdPreCallValidateCmdBeginRendering] = false;
+    sheddable[InterceptIdPreCallValidateCmdBeginRenderingKHR] = false;
+}
+
+// Ends the frame of the validation budget, and tells the application when checks are turned off or back on so that it does
+// not take the missing messages for a clean run
+static void EndValidationBudgetFrame(vvl::dispatch::Device& device_dispatch, VkQueue queue) {
+    const auto change = device_dispatch.validation_budget->EndFrame();
+    if (!change) {
+        return;
+    }
+    const char* checks =
+        change->object_type == LayerObjectTypeBestPractices ? "Best practices" : "Synchronization validation command buffer";
+    const double frame_ms = double(change->frame_ns) / 1e6;
+    const double budget_ms = double(device_dispatch.settings.global_settings.validation_frame_budget_us) / 1e3;
+    const Location loc(vvl::Func::vkQueuePresentKHR);
+    if (change->shed) {
+        device_dispatch.LogPerformanceWarning(
+            "WARNING-QueuePresentKHR-budget-checks-disabled", queue, loc,
+            "%s checks are turned off, validation took %.3f ms of CPU time in the last frame which is over the "
+            "validation_frame_budget_us budget of %.3f ms. They are turned back on once frames are well under the budget.",
+            checks, frame_ms, budget_ms);
+    } else {
+        device_dispatch.LogInfo("WARNING-QueuePresentKHR-budget-checks-enabled", queue, loc,
+                                "%s checks are turned back on, validation took %.3f ms of CPU time in the last frame (budget "
+                                "of %.3f ms).",
+                                checks, frame_ms, budget_ms);
+    }
+}
+
+#if defined(TRACY_ENABLE) || defined(VVL_PERFETTO)
+static void PlotMemoryAccounting(const vvl::dispatch::Device& device_dispatch) {
+    device_dispatch.UpdateMemoryAccounting();
+    for (uint32_t i = 0; i < vvl::profiling::MemoryAccounting::kSubsystemCount; ++i) {
+        const auto subsystem = vvl::profiling::MemorySubsystem(i);
+        VVL_TracyPlot(vvl::profiling::MemorySubsystemName(subsystem), device_dispatch.memory_accounting.Get(subsystem));
+    }
+}
+#endif
+
+// With low_memory_preset, reports the highest layer memory seen at a vkQueuePresentKHR or at vkDestroyDevice
+static void LogPeakMemory(const vvl::dispatch::Device& device_dispatch, DebugReport& debug_report, const Location& loc) {
+    const auto& accounting = device_dispatch.memory_accounting;
+    std::string message = text::Format("Peak layer memory of the device was %.1f MB.", double(accounting.PeakTotal()) / 1e6);
+    for (uint32_t i = 0; i < vvl::profiling::MemoryAccounting::kSubsystemCount; ++i) {
+        const auto subsystem = vvl::profiling::MemorySubsystem(i);
+        message += text::Format(" %s: %.1f MB.", vvl::profiling::MemorySubsystemName(subsystem),
+                                double(accounting.Peak(subsystem)) / 1e6);
+    }
+    debug_report.LogMessage(kInformationBit, "INFO-DestroyDevice-peak-layer-memory", {}, loc, message);
+}
+
+// Returns the function to call instead of the chassis one if no validation object intercepts the command, null otherwise
+static PFN_vkVoidFunction GetPassthroughProcAddr(vvl::dispatch::Device& device_dispatch, const char* funcName) {
+    if (device_dispatch.passthrough_commands.empty()) {
+        return nullptr;
+    }
+    const auto& item = GetNameToPassthroughMap().find(funcName);
+    if (item == GetNameToPassthroughMap().end() || !device_dispatch.passthrough_commands[size_t(item->second.command)]) {
+        return nullptr;
+    }
+    const vvl::dispatch::PassthroughMode mode = vvl::dispatch::GetPassthroughMode(item->second.command);
+    if (mode == vvl::dispatch::PassthroughMode::Direct ||
+        (mode == vvl::dispatch::PassthroughMode::Unwrap && !device_dispatch.wrap_handles)) {
+        auto& table = device_dispatch.device_dispatch_table;
+        if (PFN_vkVoidFunction driver_function = table.GetDeviceProcAddr(device_dispatch.device, funcName)) {
+            return driver_function;
+        }
+    }
+    return reinterpret_cast<PFN_vkVoidFunction>(item->second.trampoline);
+}
+
+// Layer entry point returned by vkGetDeviceProcAddr, see "Memory accounting" in profiling.md
+static VKAPI_ATTR VkResult VKAPI_CALL GetValidationMemoryUsageVVL(VkDevice device, uint32_t* pSubsystemCount,
+                                                                  const char** pNames, uint64_t* pBytes) {
+    constexpr uint32_t subsystem_count = vvl::profiling::MemoryAccounting::kSubsystemCount;
+    if (!pNames && !pBytes) {
+        *pSubsystemCount = subsystem_count;
+        return VK_SUCCESS;
+    }
+    auto device_dispatch = vvl::dispatch::GetData(device);
+    device_dispatch->UpdateMemoryAccounting();
+    const uint32_t count = std::min(*pSubsystemCount, subsystem_count);
+    for (uint32_t i = 0; i < count; ++i) {
+        const auto subsystem = vvl::profiling::MemorySubsystem(i);
+        if (pNames) {
+            pNames[i] = vvl::profiling::MemorySubsystemName(subsystem);
+        }
+        if (pBytes) {
+            pBytes[i] = device_dispatch->memory_accounting.Get(subsystem);
+        }
+    }
+    *pSubsystemCount = count;
+    return count < subsystem_count ? VK_INCOMPLETE : VK_SUCCESS;
+}
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char* funcName) {
+    if (strcmp(funcName, "vkGetValidationMemoryUsageVVL") == 0) {
+        return reinterpret_cast<PFN_vkVoidFunction>(GetValidationMemoryUsageVVL);
+    }
     auto layer_data = vvl::dispatch::GetData(device);
     if (!ApiParentExtensionEnabled(funcName, &layer_data->extensions)) {
         return nullptr;
@@ -139,6 +272,8 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, cons
             layer_data->LogWarning("WARNING-vkGetDeviceProcAddr-device", device, loc.dot(vvl::Field::pName),
                                    "is trying to grab %s which is an instance level function", funcName);
             return nullptr;
+        } else if (PFN_vkVoidFunction passthrough = GetPassthroughProcAddr(*layer_data, funcName)) {
+            return passthrough;
         } else {
             return reinterpret_cast<PFN_vkVoidFunction>(item->second.funcptr);
         }
@@ -164,6 +299,8 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance in
     if (item != GetNameToFuncPtrMap().end()) {
         if (item->second.function_type != kFuncTypePdev) {
             return nullptr;
+        } else if (PFN_vkVoidFunction passthrough = GetPassthroughProcAddr(*layer_data, funcName)) {
+            return passthrough;
         } else {
             return reinterpret_cast<PFN_vkVoidFunction>(item->second.funcptr);
         }
@@ -190,6 +327,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreat
                                               VkInstance* pInstance) {
     atexit(ApplicationAtExit);
 
+#if defined(VVL_PERFETTO)
+    vvl::profiling::InitPerfetto();
+#endif
     VVL_ZoneScoped;
     VkLayerInstanceCreateInfo* chain_info = GetChainInfo(pCreateInfo, VK_LAYER_LINK_INFO);
 
@@ -228,6 +368,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreat
     }
     record_obj.result = result;
     instance_dispatch->instance = *pInstance;
+    if (instance_dispatch->settings.global_settings.internal_allocation_callbacks && pAllocator) {
+        // Containers created from now on use the callbacks, the ones of the instance so far keep the default resource
+        vvl::SetInternalAllocationCallbacks(pAllocator);
+    }
     for (auto& vo : instance_dispatch->object_dispatch) {
         if (!vo) {
             continue;
@@ -304,7 +448,11 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     }
 
     DeactivateInstanceDebugCallbacks(instance_dispatch->debug_report);
+    const bool internal_allocation_callbacks = instance_dispatch->settings.global_settings.internal_allocation_callbacks;
     vvl::dispatch::FreeData(key, instance);
+    if (internal_allocation_callbacks) {
+        vvl::SetInternalAllocationCallbacks(nullptr);
+    }
 
     VVL_TracyCZoneEnd(tracy_zone_postcall);
 
@@ -371,6 +519,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     device_dispatch->device = *pDevice;
 
     layer_init_device_dispatch_table(*pDevice, &device_dispatch->device_dispatch_table, fpGetDeviceProcAddr);
+    InitPassthroughCommands(*device_dispatch);
+    InitSheddableIntercepts(*device_dispatch);
 
     instance_dispatch->debug_report->device_created++;
 
@@ -422,6 +572,13 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     }
     RecordObject record_obj(vvl::Func::vkDestroyDevice);
 
+    const bool report_peak_memory = device_dispatch->settings.global_settings.low_memory_preset;
+    if (report_peak_memory) {
+        // Last chance, the validation objects free their state below
+        device_dispatch->UpdateMemoryAccounting();
+        device_dispatch->memory_accounting.UpdatePeaks();
+    }
+
     // Even though layer object types reference the base device state tracker,
     // it needs to be destroyed first: it stores the various object maps,
     // those need to be destroyed by the time layer objects destroy their
@@ -476,6 +633,28 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     auto instance_dispatch = vvl::dispatch::GetData(device_dispatch->physical_device);
     instance_dispatch->debug_report->device_created--;
 
+    if (device_dispatch->call_stats) {
+        const std::string& path = device_dispatch->settings.global_settings.debug_call_stats_file;
+        if (!device_dispatch->call_stats->WriteCsv(path)) {
+            instance_dispatch->debug_report->LogMessage(kWarningBit, "VALIDATION-SETTINGS", {}, error_obj.location,
+                                                        "Could not write the call stats to " + path);
+        }
+        // State object pools are shared by all devices, this is the occupancy when this device is destroyed
+        const std::string pools_path = path + ".pools.csv";
+        if (!vvl::WriteBlockPoolStatsCsv(pools_path)) {
+            instance_dispatch->debug_report->LogMessage(kWarningBit, "VALIDATION-SETTINGS", {}, error_obj.location,
+                                                        "Could not write the object pool stats to " + pools_path);
+        }
+        const std::string checks_path = path + ".checks.csv";
+        if (!device_dispatch->call_stats->WriteChecksCsv(checks_path)) {
+            instance_dispatch->debug_report->LogMessage(kWarningBit, "VALIDATION-SETTINGS", {}, error_obj.location,
+                                                        "Could not write the check stats to " + checks_path);
+        }
+    }
+    if (report_peak_memory) {
+        LogPeakMemory(*device_dispatch, *instance_dispatch->debug_report, error_obj.location);
+    }
+
     vvl::dispatch::FreeData(key, device);
 }
 
@@ -495,6 +674,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
 
     {
         VVL_ZoneScopedN("PreCallValidate_CreateGraphicsPipelines");
+        VVL_CallStatsScope(device_dispatch, vkCreateGraphicsPipelines, PreCallValidate);
         for (const auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -509,6 +689,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
     RecordObject record_obj(vvl::Func::vkCreateGraphicsPipelines);
     {
         VVL_ZoneScopedN("PreCallRecord_CreateGraphicsPipelines");
+        VVL_CallStatsScope(device_dispatch, vkCreateGraphicsPipelines, PreCallRecord);
         for (auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -522,6 +703,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_CreateGraphicsPipelines");
+        VVL_CallStatsScope(device_dispatch, vkCreateGraphicsPipelines, Dispatch);
         result = device_dispatch->CreateGraphicsPipelines(device, pipelineCache, createInfoCount, chassis_state.pCreateInfos,
                                                           pAllocator, pPipelines);
 
@@ -536,6 +718,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
 
     {
         VVL_ZoneScopedN("PostCallRecord_CreateGraphicsPipelines");
+        VVL_CallStatsScope(device_dispatch, vkCreateGraphicsPipelines, PostCallRecord);
         for (auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -563,6 +746,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, VkPipelin
 
     {
         VVL_ZoneScopedN("PreCallValidate_CreateComputePipelines");
+        VVL_CallStatsScope(device_dispatch, vkCreateComputePipelines, PreCallValidate);
         for (const auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -577,6 +761,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, VkPipelin
     RecordObject record_obj(vvl::Func::vkCreateComputePipelines);
     {
         VVL_ZoneScopedN("PreCallRecord_CreateComputePipelines");
+        VVL_CallStatsScope(device_dispatch, vkCreateComputePipelines, PreCallRecord);
         for (auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -590,6 +775,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, VkPipelin
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_CreateComputePipelines");
+        VVL_CallStatsScope(device_dispatch, vkCreateComputePipelines, Dispatch);
         result = device_dispatch->CreateComputePipelines(device, pipelineCache, createInfoCount, chassis_state.pCreateInfos,
                                                          pAllocator, pPipelines);
         // If we have modified the pCreateInfos caused things to fail, revert to allow the app to continue
@@ -603,6 +789,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, VkPipelin
 
     {
         VVL_ZoneScopedN("PostCallRecord_CreateComputePipelines");
+        VVL_CallStatsScope(device_dispatch, vkCreateComputePipelines, PostCallRecord);
         for (auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -675,6 +862,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(VkDevice device, VkD
 
     {
         VVL_ZoneScopedN("PreCallValidate_CreateRayTracingPipelinesKHR");
+        VVL_CallStatsScope(device_dispatch, vkCreateRayTracingPipelinesKHR, PreCallValidate);
         for (const auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -690,6 +878,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(VkDevice device, VkD
     RecordObject record_obj(vvl::Func::vkCreateRayTracingPipelinesKHR);
     {
         VVL_ZoneScopedN("PreCallRecord_CreateRayTracingPipelinesKHR");
+        VVL_CallStatsScope(device_dispatch, vkCreateRayTracingPipelinesKHR, PreCallRecord);
         for (auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -703,6 +892,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(VkDevice device, VkD
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_CreateRayTracingPipelinesKHR");
+        VVL_CallStatsScope(device_dispatch, vkCreateRayTracingPipelinesKHR, Dispatch);
         result = device_dispatch->CreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                chassis_state->pCreateInfos, pAllocator, pPipelines);
 
@@ -718,6 +908,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(VkDevice device, VkD
 
     {
         VVL_ZoneScopedN("PostCallRecord_CreateRayTracingPipelinesKHR");
+        VVL_CallStatsScope(device_dispatch, vkCreateRayTracingPipelinesKHR, PostCallRecord);
         for (auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -741,6 +932,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPip
 
     {
         VVL_ZoneScopedN("PreCallValidate_CreatePipelineLayout");
+        VVL_CallStatsScope(device_dispatch, vkCreatePipelineLayout, PreCallValidate);
         for (const auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallValidateCreatePipelineLayout]) {
             if (!vo) {
                 continue;
@@ -757,6 +949,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPip
     RecordObject record_obj(vvl::Func::vkCreatePipelineLayout);
     {
         VVL_ZoneScopedN("PreCallRecord_CreatePipelineLayout");
+        VVL_CallStatsScope(device_dispatch, vkCreatePipelineLayout, PreCallRecord);
         for (auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -769,12 +962,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPip
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_CreatePipelineLayout");
+        VVL_CallStatsScope(device_dispatch, vkCreatePipelineLayout, Dispatch);
         result = device_dispatch->CreatePipelineLayout(device, &chassis_state.modified_create_info, pAllocator, pPipelineLayout);
     }
     record_obj.result = result;
 
     {
         VVL_ZoneScopedN("PostCallRecord_CreatePipelineLayout");
+        VVL_CallStatsScope(device_dispatch, vkCreatePipelineLayout, PostCallRecord);
         for (auto& vo : device_dispatch->intercept_vectors[InterceptIdPostCallRecordCreatePipelineLayout]) {
             if (!vo) {
                 continue;
@@ -794,6 +989,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderBinaryDataEXT(VkDevice device, VkShaderE
     ErrorObject error_obj(vvl::Func::vkGetShaderBinaryDataEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     {
         VVL_ZoneScopedN("PreCallValidate_vkGetShaderBinaryDataEXT");
+        VVL_CallStatsScope(device_dispatch, vkGetShaderBinaryDataEXT, PreCallValidate);
         for (const auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallValidateGetShaderBinaryDataEXT]) {
             if (!vo) {
                 continue;
@@ -809,6 +1005,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderBinaryDataEXT(VkDevice device, VkShaderE
     RecordObject record_obj(vvl::Func::vkGetShaderBinaryDataEXT);
     {
         VVL_ZoneScopedN("PreCallRecord_vkGetShaderBinaryDataEXT");
+        VVL_CallStatsScope(device_dispatch, vkGetShaderBinaryDataEXT, PreCallRecord);
         for (auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -820,11 +1017,13 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderBinaryDataEXT(VkDevice device, VkShaderE
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_vkGetShaderBinaryDataEXT");
+        VVL_CallStatsScope(device_dispatch, vkGetShaderBinaryDataEXT, Dispatch);
         result = device_dispatch->GetShaderBinaryDataEXT(device, chassis_state.modified_shader_handle, pDataSize, pData);
     }
     record_obj.result = result;
     {
         VVL_ZoneScopedN("PostCallRecord_vkGetShaderBinaryDataEXT");
+        VVL_CallStatsScope(device_dispatch, vkGetShaderBinaryDataEXT, PostCallRecord);
         for (auto& vo : device_dispatch->intercept_vectors[InterceptIdPostCallRecordGetShaderBinaryDataEXT]) {
             if (!vo) {
                 continue;
@@ -847,6 +1046,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShade
 
     {
         VVL_ZoneScopedN("PreCallValidate_CreateShaderModule");
+        VVL_CallStatsScope(device_dispatch, vkCreateShaderModule, PreCallValidate);
         for (const auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -862,6 +1062,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShade
     RecordObject record_obj(vvl::Func::vkCreateShaderModule);
     {
         VVL_ZoneScopedN("PreCallRecord_CreateShaderModule");
+        VVL_CallStatsScope(device_dispatch, vkCreateShaderModule, PreCallRecord);
         for (auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -876,11 +1077,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShade
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_CreateShaderModule");
+        VVL_CallStatsScope(device_dispatch, vkCreateShaderModule, Dispatch);
         result = device_dispatch->CreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
     }
     record_obj.result = result;
     {
         VVL_ZoneScopedN("PostCallRecord_CreateShaderModule");
+        VVL_CallStatsScope(device_dispatch, vkCreateShaderModule, PostCallRecord);
         for (auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -905,6 +1108,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShadersEXT(VkDevice device, uint32_t create
 
     {
         VVL_ZoneScopedN("PreCallValidate_CreateShadersEXT");
+        VVL_CallStatsScope(device_dispatch, vkCreateShadersEXT, PreCallValidate);
         for (const auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -918,6 +1122,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShadersEXT(VkDevice device, uint32_t create
     RecordObject record_obj(vvl::Func::vkCreateShadersEXT);
     {
         VVL_ZoneScopedN("PreCallRecord_CreateShadersEXT");
+        VVL_CallStatsScope(device_dispatch, vkCreateShadersEXT, PreCallRecord);
         for (auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -934,6 +1139,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShadersEXT(VkDevice device, uint32_t create
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_CreateShadersEXT");
+        VVL_CallStatsScope(device_dispatch, vkCreateShadersEXT, Dispatch);
         result = device_dispatch->CreateShadersEXT(device, createInfoCount, chassis_state.pCreateInfos, pAllocator, pShaders);
 
         // If we have modified the pCreateInfos caused things to fail, revert to allow the app to continue
@@ -946,6 +1152,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShadersEXT(VkDevice device, uint32_t create
 
     {
         VVL_ZoneScopedN("PostCallRecord_CreateShadersEXT");
+        VVL_CallStatsScope(device_dispatch, vkCreateShadersEXT, PostCallRecord);
         for (auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -973,6 +1180,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, const VkD
 
     {
         VVL_ZoneScopedN("PreCallValidate_AllocateDescriptorSets");
+        VVL_CallStatsScope(device_dispatch, vkAllocateDescriptorSets, PreCallValidate);
         for (const auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -986,6 +1194,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, const VkD
     RecordObject record_obj(vvl::Func::vkAllocateDescriptorSets);
     {
         VVL_ZoneScopedN("PreCallRecord_AllocateDescriptorSets");
+        VVL_CallStatsScope(device_dispatch, vkAllocateDescriptorSets, PreCallRecord);
         for (auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallRecordAllocateDescriptorSets]) {
             if (!vo) {
                 continue;
@@ -998,12 +1207,14 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, const VkD
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_AllocateDescriptorSets");
+        VVL_CallStatsScope(device_dispatch, vkAllocateDescriptorSets, Dispatch);
         result = device_dispatch->AllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     }
     record_obj.result = result;
 
     {
         VVL_ZoneScopedN("PostCallRecord_AllocateDescriptorSets");
+        VVL_CallStatsScope(device_dispatch, vkAllocateDescriptorSets, PostCallRecord);
         for (auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -1026,6 +1237,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreat
 
     {
         VVL_ZoneScopedN("PreCallValidate_CreateBuffer");
+        VVL_CallStatsScope(device_dispatch, vkCreateBuffer, PreCallValidate);
         for (const auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallValidateCreateBuffer]) {
             if (!vo) {
                 continue;
@@ -1042,6 +1254,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreat
     RecordObject record_obj(vvl::Func::vkCreateBuffer);
     {
         VVL_ZoneScopedN("PreCallRecord_CreateBuffer");
+        VVL_CallStatsScope(device_dispatch, vkCreateBuffer, PreCallRecord);
         for (auto& vo : device_dispatch->object_dispatch) {
             if (!vo) {
                 continue;
@@ -1054,12 +1267,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreat
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_CreateBuffer");
+        VVL_CallStatsScope(device_dispatch, vkCreateBuffer, Dispatch);
         result = device_dispatch->CreateBuffer(device, &chassis_state.modified_create_info, pAllocator, pBuffer);
     }
     record_obj.result = result;
 
     {
         VVL_ZoneScopedN("PostCallRecord_CreateBuffer");
+        VVL_CallStatsScope(device_dispatch, vkCreateBuffer, PostCallRecord);
         for (auto& vo : device_dispatch->intercept_vectors[InterceptIdPostCallRecordCreateBuffer]) {
             if (!vo) {
                 continue;
@@ -1080,6 +1295,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
     ErrorObject error_obj(vvl::Func::vkQueuePresentKHR, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     {
         VVL_ZoneScopedN("PreCallValidate_QueuePresentKHR");
+        VVL_CallStatsScope(device_dispatch, vkQueuePresentKHR, PreCallValidate);
         for (const auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallValidateQueuePresentKHR]) {
             if (!vo) {
                 continue;
@@ -1092,6 +1308,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
     RecordObject record_obj(vvl::Func::vkQueuePresentKHR);
     {
         VVL_ZoneScopedN("PreCallRecord_QueuePresentKHR");
+        VVL_CallStatsScope(device_dispatch, vkQueuePresentKHR, PreCallRecord);
         for (auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallRecordQueuePresentKHR]) {
             if (!vo) {
                 continue;
@@ -1114,6 +1331,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_QueuePresentKHR");
+        VVL_CallStatsScope(device_dispatch, vkQueuePresentKHR, Dispatch);
         result = device_dispatch->QueuePresentKHR(queue, pPresentInfo);
     }
     VVL_TracyCFrameMark;
@@ -1123,6 +1341,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
     record_obj.result = result;
     {
         VVL_ZoneScopedN("PostCallRecord_QueuePresentKHR");
+        VVL_CallStatsScope(device_dispatch, vkQueuePresentKHR, PostCallRecord);
         for (auto& vo : device_dispatch->intercept_vectors[InterceptIdPostCallRecordQueuePresentKHR]) {
             if (!vo) {
                 continue;
@@ -1135,6 +1354,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
             vo->PostCallRecordQueuePresentKHR(queue, pPresentInfo, record_obj);
         }
     }
+    if (device_dispatch->validation_budget) {
+        EndValidationBudgetFrame(*device_dispatch, queue);
+    }
+    device_dispatch->EndStridedFrame();
+    if (device_dispatch->settings.global_settings.low_memory_preset) {
+        device_dispatch->UpdateMemoryAccounting();
+        device_dispatch->memory_accounting.UpdatePeaks();
+    }
+#if defined(TRACY_ENABLE) || defined(VVL_PERFETTO)
+    PlotMemoryAccounting(*device_dispatch);
+#endif
     return result;
 }
 
@@ -1150,6 +1380,7 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer,
     handle_data.command_buffer.is_secondary = device_dispatch->IsSecondary(commandBuffer);
     {
         VVL_ZoneScopedN("PreCallValidate_BeginCommandBuffer");
+        VVL_CallStatsScope(device_dispatch, vkBeginCommandBuffer, PreCallValidate);
         for (const auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallValidateBeginCommandBuffer]) {
             if (!vo) {
                 continue;
@@ -1163,6 +1394,7 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer,
     RecordObject record_obj(vvl::Func::vkBeginCommandBuffer, &handle_data);
     {
         VVL_ZoneScopedN("PreCallRecord_BeginCommandBuffer");
+        VVL_CallStatsScope(device_dispatch, vkBeginCommandBuffer, PreCallRecord);
         for (auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallRecordBeginCommandBuffer]) {
             if (!vo) {
                 continue;
@@ -1175,12 +1407,14 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer,
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_BeginCommandBuffer");
-        result = device_dispatch->BeginCommandBuffer(commandBuffer, pBeginInfo);
+        VVL_CallStatsScope(device_dispatch, vkBeginCommandBuffer, Dispatch);
+        result = device_dispatch->BeginCommandBuffer(commandBuffer, pBeginInfo, handle_data.command_buffer.is_secondary);
     }
     record_obj.result = result;
 
     {
         VVL_ZoneScopedN("PostCallRecord_BeginCommandBuffer");
+        VVL_CallStatsScope(device_dispatch, vkBeginCommandBuffer, PostCallRecord);
         for (auto& vo : device_dispatch->intercept_vectors[InterceptIdPostCallRecordBeginCommandBuffer]) {
             if (!vo) {
                 continue;
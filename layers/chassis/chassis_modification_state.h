@@ -97,6 +97,8 @@ struct CreateGraphicsPipelines {
     spirv::StatelessData stateless_data[kCommonMaxGraphicsShaderStages];
     // 2D array for [pipelineCount][stageCount]
     std::vector<std::vector<ShaderInstrumentationMetadata>> shader_instrumentations_metadata;
+    // [pipelineCount], the pipelines GPU-AV only instruments once they are bound
+    std::vector<bool> lazy_instrumentations;
 
     CreateGraphicsPipelines(const VkGraphicsPipelineCreateInfo* create_info) { pCreateInfos = create_info; }
 };
@@ -110,6 +112,8 @@ struct CreateComputePipelines {
     // 2D array for [pipelineCount][stageCount]
     // While only 1 compute can be used, need interface to match with graphics/rtx structs
     std::vector<std::vector<ShaderInstrumentationMetadata>> shader_instrumentations_metadata;
+    // [pipelineCount], the pipelines GPU-AV only instruments once they are bound
+    std::vector<bool> lazy_instrumentations;
     CreateComputePipelines(const VkComputePipelineCreateInfo* create_info) { pCreateInfos = create_info; }
 };
 
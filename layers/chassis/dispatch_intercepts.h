@@ -0,0 +1,132 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "chassis/dispatch_object.h"
+#include "generated/dispatch_vector.h"
+#include "state_tracker/state_tracker.h"
+#include "core_checks/core_validation.h"
+#include "sync/sync_validation.h"
+
+// Helpers used by the generated chassis to call every validation object in an intercept vector.
+//
+// The common configurations only have CoreChecks or SyncValidator enabled (on top of the state tracker). For those the
+// validation objects are cast to their concrete (final) type, so the compiler can call and inline the intercepts directly
+// instead of going through the vtable. Every other configuration takes the generic virtual path.
+//
+// Each devirtualized path is a copy of the loop inlined for one more type, so only the hot entry points (see
+// hot_functions in layer_chassis_generator.py) use them, the others are generated with devirtualize = false.
+#if defined(__GNUC__)
+// Hot entry points are grouped in .text.hot, cold ones are optimized for size and moved to .text.unlikely
+#define VVL_HOT_ENTRY_POINT __attribute__((hot))
+#define VVL_COLD_ENTRY_POINT __attribute__((cold))
+#else
+#define VVL_HOT_ENTRY_POINT
+#define VVL_COLD_ENTRY_POINT
+#endif
+
+namespace vvl {
+namespace dispatch {
+
+template <typename Validator, typename Func>
+bool ValidateInterceptsAs(const std::vector<base::Device*>& intercepts, uint32_t shed_mask, Func&& func) {
+    for (base::Device* vo : intercepts) {
+        if (!vo || (shed_mask & (1u << vo->container_type))) {
+            continue;
+        }
+        bool skip = false;
+        if (vo->container_type == LayerObjectTypeStateTracker) {
+            skip = func(static_cast<vvl::DeviceState*>(vo));
+        } else {
+            skip = func(static_cast<Validator*>(vo));
+        }
+        if (skip) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Returns true as soon as one of the validation objects wants the call skipped.
+// The validation objects shed by the validation budget or by validation_frame_stride are not called, only their record
+// intercepts are.
+template <bool devirtualize = true, typename Func>
+bool ValidateIntercepts(const Device& device_dispatch, InterceptId id, Func&& func) {
+    const auto& intercepts = device_dispatch.intercept_vectors[id];
+    const auto& sheddable = device_dispatch.sheddable_intercepts;
+    const uint32_t shed_mask = (!sheddable.empty() && sheddable[id]) ? device_dispatch.ShedMask() : 0;
+    if constexpr (devirtualize) {
+        switch (device_dispatch.devirtualized_object_type) {
+            case LayerObjectTypeCoreValidation:
+                return ValidateInterceptsAs<CoreChecks>(intercepts, shed_mask, func);
+            case LayerObjectTypeSyncValidation:
+                return ValidateInterceptsAs<SyncValidator>(intercepts, shed_mask, func);
+            default:
+                break;
+        }
+    }
+    for (base::Device* vo : intercepts) {
+        if (!vo || (shed_mask & (1u << vo->container_type))) {
+            continue;
+        }
+        if (func(vo)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename Validator, typename Func>
+void RecordInterceptsAs(const std::vector<base::Device*>& intercepts, Func&& func) {
+    for (base::Device* vo : intercepts) {
+        if (!vo) {
+            continue;
+        }
+        if (vo->container_type == LayerObjectTypeStateTracker) {
+            func(static_cast<vvl::DeviceState*>(vo));
+        } else {
+            func(static_cast<Validator*>(vo));
+        }
+    }
+}
+
+template <bool devirtualize = true, typename Func>
+void RecordIntercepts(const Device& device_dispatch, InterceptId id, Func&& func) {
+    const auto& intercepts = device_dispatch.intercept_vectors[id];
+    if constexpr (devirtualize) {
+        switch (device_dispatch.devirtualized_object_type) {
+            case LayerObjectTypeCoreValidation:
+                RecordInterceptsAs<CoreChecks>(intercepts, func);
+                return;
+            case LayerObjectTypeSyncValidation:
+                RecordInterceptsAs<SyncValidator>(intercepts, func);
+                return;
+            default:
+                break;
+        }
+    }
+    for (base::Device* vo : intercepts) {
+        if (!vo) {
+            continue;
+        }
+        func(vo);
+    }
+}
+
+}  // namespace dispatch
+}  // namespace vvl
@@ -28,7 +28,11 @@
 
 #include "error_message/logging.h"
 #include "containers/custom_containers.h"
+#include "containers/handle_slab.h"
+#include "containers/sharded_map.h"
 #include "layer_options.h"
+#include "profiling/call_stats.h"
+#include "profiling/memory_accounting.h"
 #include "gpuav/core/gpuav_settings.h"
 #include "sync/sync_settings.h"
 #include "generated/device_features.h"
@@ -38,19 +42,6 @@
 #include "layer_object_id.h"
 #include "state_tracker/special_supported.h"
 
-// To avoid re-hashing unique ids on each use, we precompute the hash and store the
-// hash's LSBs in the high 24 bits.
-struct HashedUint64 {
-    static const int HASHED_UINT64_SHIFT = 40;
-    size_t operator()(const uint64_t& t) const { return t >> HASHED_UINT64_SHIFT; }
-
-    static uint64_t hash(uint64_t id) {
-        uint64_t h = (uint64_t)vvl::hash<uint64_t>()(id);
-        id |= h << HASHED_UINT64_SHIFT;
-        return id;
-    }
-};
-
 namespace vvl {
 namespace base {
 class Instance;
@@ -154,6 +145,15 @@ void FreeData(void* key, VkDevice device);
 
 void FreeAllData();
 
+// What the dispatch function of a device command does on top of calling down the chain. When no validation object intercepts
+// a command, vkGetDeviceProcAddr uses this to hand out the driver function, or a trampoline that only calls the dispatch function.
+enum class PassthroughMode {
+    Direct,      // nothing, the driver function can always be called directly
+    Unwrap,      // only unwraps (and wraps new) handles, the driver function can be called directly when wrap_handles is false
+    Trampoline,  // keeps state of its own, the dispatch function must always be called
+};
+PassthroughMode GetPassthroughMode(vvl::Func command);
+
 struct TemplateState {
     VkDescriptorUpdateTemplate desc_update_template;
     vku::safe_VkDescriptorUpdateTemplateCreateInfo create_info;
@@ -172,58 +172,56 @@ struct Settings {
     ValidationEnabled enabled = {};
 };
 
+// Every instance and device wraps the handles it creates in its own table, which goes away with it. A device also unwraps the
+// handles of its instance (surfaces, displays).
 class HandleWrapper : public Logger {
   public:
-    HandleWrapper(DebugReport* dr);
+    HandleWrapper(DebugReport* dr, const HandleWrapper* instance = nullptr);
     ~HandleWrapper();
 
     // Unwrap a handle.
     template <typename HandleType>
     HandleType Unwrap(HandleType wrapped_handle) {
         if (wrapped_handle == (HandleType)VK_NULL_HANDLE) return wrapped_handle;
-        auto iter = unique_id_mapping.find(CastToUint64(wrapped_handle));
-        if (iter == unique_id_mapping.end()) return (HandleType)0;
-        return (HandleType)iter->second;
+        return CastFromUint64<HandleType>(FindId(CastToUint64(wrapped_handle)));
     }
 
     // Wrap a newly created handle with a new unique ID, and return the new ID.
     template <typename HandleType>
     HandleType WrapNew(HandleType new_created_handle) {
         if (new_created_handle == (HandleType)VK_NULL_HANDLE) return new_created_handle;
-        auto unique_id = global_unique_id++;
-        unique_id = HashedUint64::hash(unique_id);
+        const uint64_t unique_id = unique_id_mapping.Insert(CastToUint64(new_created_handle));
         assert(unique_id != 0);  // can't be 0, otherwise unwrap will apply special rule for VK_NULL_HANDLE
-        unique_id_mapping.insert_or_assign(unique_id, CastToUint64(new_created_handle));
         return (HandleType)unique_id;
     }
 
     template <typename HandleType>
     HandleType Find(HandleType wrapped_handle) const {
-        uint64_t id = CastToUint64(wrapped_handle);
-        auto iter = unique_id_mapping.find(id);
-        if (iter != unique_id_mapping.end()) {
-            return CastFromUint64<HandleType>(iter->second);
-        } else {
-            return CastFromUint<HandleType>(0ULL);
-        }
+        return CastFromUint64<HandleType>(FindId(CastToUint64(wrapped_handle)));
     }
 
     template <typename HandleType>
     HandleType Erase(HandleType wrapped_handle) {
-        uint64_t id = CastToUint64(wrapped_handle);
-        auto iter = unique_id_mapping.pop(id);
-        if (iter != unique_id_mapping.end()) {
-            return CastFromUint64<HandleType>(iter->second);
-        } else {
-            return CastFromUint<HandleType>(0ULL);
-        }
+        return CastFromUint64<HandleType>(unique_id_mapping.Erase(CastToUint64(wrapped_handle)));
     }
 
     void UnwrapPnextChainHandles(const void* pNext);
 
-    static std::atomic<uint64_t> global_unique_id;
-    static vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+    // The wrapped handle is the id of the driver handle in this table, see HandleSlab for the encoding. Each table has its own
+    // tag (while there are free ones), so the handles of different devices do not have the same value.
+    vvl::HandleSlab unique_id_mapping;
     static bool wrap_handles;
+
+  private:
+    uint64_t FindId(uint64_t id) const {
+        const uint64_t handle = unique_id_mapping.Find(id);
+        if (handle == 0 && instance_id_mapping_) {
+            return instance_id_mapping_->Find(id);
+        }
+        return handle;
+    }
+
+    const vvl::HandleSlab* const instance_id_mapping_;
 };
 
 class Instance : public HandleWrapper {
@@ -255,6 +253,10 @@ class Instance : public HandleWrapper {
 
     mutable std::vector<std::unique_ptr<base::Instance>> object_dispatch;
 
+    // How long the steps of vkCreateInstance took, reported in the call stats of its devices
+    uint64_t settings_ns = 0;
+    uint64_t validation_objects_ns = 0;
+
     VkInstance instance = VK_NULL_HANDLE;
     VkLayerInstanceDispatchTable instance_dispatch_table;
     // Reverse map display handles
@@ -287,10 +289,13 @@ class Device : public HandleWrapper {
 
     void InitObjectDispatchVectors();
     void InitValidationObjects();
+    void InitDevirtualizedObjectType();
     void ReleaseValidationObject(LayerObjectTypeId type_id) const;
     base::Device* GetValidationObject(LayerObjectTypeId object_type) const;
 
     bool IsSecondary(VkCommandBuffer cb) const;
+    // For the chassis, which already looked up whether the command buffer is secondary
+    VkResult BeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo, bool is_secondary);
 
     Settings& settings;
     Instance* dispatch_instance;
@@ -320,6 +325,35 @@ class Device : public HandleWrapper {
     mutable std::vector<std::unique_ptr<base::Device>> object_dispatch;
     mutable std::vector<std::unique_ptr<base::Device>> aborted_object_dispatch;
     mutable std::vector<std::vector<base::Device*>> intercept_vectors;
+    // When the only validation object (besides the state tracker) is CoreChecks or SyncValidator, the chassis calls the
+    // intercepts through the concrete type so they are not virtual calls. LayerObjectTypeMaxEnum means no fast path.
+    LayerObjectTypeId devirtualized_object_type = LayerObjectTypeMaxEnum;
+    // Only allocated when the debug_call_stats_file setting is set
+    std::unique_ptr<profiling::CallStats> call_stats;
+    // Only allocated when the validation_frame_budget_us setting is set
+    std::unique_ptr<profiling::ValidationBudget> validation_budget;
+    // Read through vkGetValidationMemoryUsageVVL, see profiling.md
+    profiling::MemoryAccounting memory_accounting;
+    void UpdateMemoryAccounting() const;
+    // Indexed by InterceptId, the PreCallValidate intercepts the validation budget and validation_frame_stride can skip. Set at
+    // vkCreateDevice, empty when neither setting is set.
+    std::vector<bool> sheddable_intercepts;
+
+    // Bit N is set when the sheddable intercepts of the validation object of LayerObjectTypeId N are skipped
+    uint32_t ShedMask() const {
+        return (validation_budget ? validation_budget->ShedMask() : 0) | frame_stride_shed_mask.load(std::memory_order_relaxed);
+    }
+    // With validation_frame_stride, ends the frame at a vkQueuePresentKHR or at a submission with a VkFrameBoundaryEXT
+    void EndStridedFrame();
+    void RecordFrameBoundaries(uint32_t submit_count, const VkSubmitInfo* submits);
+    void RecordFrameBoundaries(uint32_t submit_count, const VkSubmitInfo2* submits);
+    void RecordFrameBoundaries(uint32_t bind_info_count, const VkBindSparseInfo* bind_infos);
+    // Frames ended since vkCreateDevice, only counted with validation_frame_stride
+    std::atomic<uint64_t> strided_frame_count{0};
+    std::atomic<uint32_t> frame_stride_shed_mask{0};
+    // Indexed by vvl::Func, set at vkCreateDevice for the commands no validation object intercepts. Empty if the chassis
+    // can never be skipped (ex: call stats are recorded)
+    std::vector<bool> passthrough_commands;
     // Handle Wrapping Data
     // Wrapping Descriptor Template Update structures requires access to the template createinfo structs
     vvl::unordered_map<uint64_t, std::unique_ptr<TemplateState>> desc_template_createinfo_map;
@@ -341,8 +375,8 @@ class Device : public HandleWrapper {
     vvl::concurrent_unordered_map<VkDeferredOperationKHR, std::vector<VkPipeline>, 0> deferred_operation_pipelines;
 
     // State we track in order to populate HandleData for things such as ignored pointers
-    vvl::unordered_map<VkCommandBuffer, VkCommandPool> secondary_cb_map{};
-    mutable std::shared_mutex secondary_cb_map_mutex;
+    // Secondary command buffers, with the (wrapped) pool they were allocated from
+    vvl::ShardedMap<VkCommandBuffer, VkCommandPool> secondary_cb_map;
 
 #include "generated/dispatch_object_device_methods.h"
 };
@@ -20,16 +20,17 @@
 #include "chassis/dispatch_object.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
 #include "state_tracker/pipeline_state.h"
-#include "containers/small_vector.h"
+#include "containers/scratch_arena.h"
 #include "generated/dispatch_functions.h"
 #include "utils/dispatch_utils.h"
+#include "utils/thread_utils.h"
+#include "profiling/profiling.h"
 
 #include <atomic>
+#include <bitset>
 
 #define OBJECT_LAYER_DESCRIPTION "khronos_validation"
 
-#define DISPATCH_MAX_STACK_ALLOCATIONS 32
-
 namespace vvl {
 
 StatelessDeviceData::StatelessDeviceData(vvl::dispatch::Instance *instance, VkPhysicalDevice physical_device,
@@ -524,10 +525,28 @@ namespace dispatch {
 
 static std::shared_mutex dispatch_lock;
 
-std::atomic<uint64_t> HandleWrapper::global_unique_id{1};
-vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> HandleWrapper::unique_id_mapping;
 bool HandleWrapper::wrap_handles{true};
 
+static std::mutex handle_tag_lock;
+static std::bitset<vvl::HandleSlab::kMaxTag + 1> handle_tags_in_use;
+
+// Lowest free tag, tag 0 is shared by the tables that come after the first kMaxTag live ones
+static uint32_t AcquireHandleTag() {
+    std::lock_guard<std::mutex> guard(handle_tag_lock);
+    for (uint32_t tag = 1; tag <= vvl::HandleSlab::kMaxTag; ++tag) {
+        if (!handle_tags_in_use[tag]) {
+            handle_tags_in_use[tag] = true;
+            return tag;
+        }
+    }
+    return 0;
+}
+
+static void ReleaseHandleTag(uint32_t tag) {
+    std::lock_guard<std::mutex> guard(handle_tag_lock);
+    handle_tags_in_use[tag] = false;
+}
+
 // Generally we expect to get the same device and instance, so we keep them handy
 static std::shared_mutex instance_mutex;
 static vvl::unordered_map<void *, std::unique_ptr<Instance>> instance_data;
@@ -615,8 +634,11 @@ void FreeAllData() {
     }
 }
 
-HandleWrapper::HandleWrapper(DebugReport *dr) : Logger(dr) {}
-HandleWrapper::~HandleWrapper() {}
+HandleWrapper::HandleWrapper(DebugReport *dr, const HandleWrapper *instance)
+    : Logger(dr),
+      unique_id_mapping(AcquireHandleTag()),
+      instance_id_mapping_(instance ? &instance->unique_id_mapping : nullptr) {}
+HandleWrapper::~HandleWrapper() { ReleaseHandleTag(unique_id_mapping.Tag()); }
 
 Instance::Instance(const VkInstanceCreateInfo *pCreateInfo) : HandleWrapper(new DebugReport) {
     uint32_t specified_version = (pCreateInfo->pApplicationInfo ? pCreateInfo->pApplicationInfo->apiVersion : VK_API_VERSION_1_0);
@@ -637,14 +659,26 @@ Instance::Instance(const VkInstanceCreateInfo *pCreateInfo) : HandleWrapper(new
                                                       &settings.global_settings,
                                                       &settings.gpuav_settings,
                                                       &settings.syncval_settings};
-    ProcessConfigAndEnvSettings(&config_and_env_settings_data);
+    const auto settings_start = std::chrono::steady_clock::now();
+    {
+        VVL_ZoneScopedN("ProcessConfigAndEnvSettings");
+        ProcessConfigAndEnvSettings(&config_and_env_settings_data);
+    }
+    settings_ns = profiling::ElapsedNs(settings_start);
+    // Before any layer thread is started, the first one can be the debug report delivery thread
+    vvl::SetThreadSettings(settings.global_settings.threads);
 
     if (settings.disabled[handle_wrapping]) {
         wrap_handles = false;
     }
 
     // create all enabled validation, which is API specific
-    InitValidationObjects();
+    const auto validation_objects_start = std::chrono::steady_clock::now();
+    {
+        VVL_ZoneScopedN("InitValidationObjects");
+        InitValidationObjects();
+    }
+    validation_objects_ns = profiling::ElapsedNs(validation_objects_start);
 
     for (auto &vo : object_dispatch) {
         vo->dispatch_instance_ = this;
@@ -793,7 +827,7 @@ base::Instance *Instance::GetValidationObject(LayerObjectTypeId object_type) con
 }
 
 Device::Device(Instance *instance, VkPhysicalDevice gpu, const VkDeviceCreateInfo *pCreateInfo)
-    : HandleWrapper(instance->debug_report),
+    : HandleWrapper(instance->debug_report, instance),
       settings(instance->settings),
       dispatch_instance(instance),
       stateless_device_data(instance, gpu, pCreateInfo),
@@ -810,8 +844,27 @@ Device::Device(Instance *instance, VkPhysicalDevice gpu, const VkDeviceCreateInf
       host_imape_copy_props_copy_dst_layouts(stateless_device_data.host_imape_copy_props_copy_dst_layouts),
       phys_dev_ext_props(stateless_device_data.phys_dev_ext_props),
       physical_device(gpu) {
-    InitValidationObjects();
-    InitObjectDispatchVectors();
+    const auto validation_objects_start = std::chrono::steady_clock::now();
+    {
+        VVL_ZoneScopedN("InitValidationObjects");
+        InitValidationObjects();
+        InitObjectDispatchVectors();
+        InitDevirtualizedObjectType();
+    }
+    if (!settings.global_settings.debug_call_stats_file.empty()) {
+        call_stats = std::make_unique<profiling::CallStats>();
+        call_stats->AddStartup("vkCreateInstance_Settings", instance->settings_ns);
+        call_stats->AddStartup("vkCreateInstance_ValidationObjects", instance->validation_objects_ns);
+        call_stats->AddStartup("vkCreateDevice_ValidationObjects", profiling::ElapsedNs(validation_objects_start));
+    }
+    if (settings.global_settings.validation_frame_budget_us != 0) {
+        uint32_t enabled_mask = 0;
+        for (auto &vo : object_dispatch) {
+            enabled_mask |= 1u << vo->container_type;
+        }
+        validation_budget = std::make_unique<profiling::ValidationBudget>(
+            uint64_t(settings.global_settings.validation_frame_budget_us) * 1000, enabled_mask);
+    }
     for (auto &vo : object_dispatch) {
         vo->dispatch_device_ = this;
         vo->CopyDispatchState();
@@ -829,6 +882,71 @@ Device::~Device() {
     }
 }
 
+void Device::InitDevirtualizedObjectType() {
+    devirtualized_object_type = LayerObjectTypeMaxEnum;
+    for (auto &vo : object_dispatch) {
+        if (vo->container_type == LayerObjectTypeStateTracker) {
+            continue;
+        }
+        const bool has_fast_path =
+            vo->container_type == LayerObjectTypeCoreValidation || vo->container_type == LayerObjectTypeSyncValidation;
+        if (!has_fast_path || devirtualized_object_type != LayerObjectTypeMaxEnum) {
+            devirtualized_object_type = LayerObjectTypeMaxEnum;
+            return;
+        }
+        devirtualized_object_type = vo->container_type;
+    }
+}
+
+void Device::UpdateMemoryAccounting() const {
+    for (const auto &vo : object_dispatch) {
+        vo->UpdateMemoryAccounting();
+    }
+}
+
+void Device::EndStridedFrame() {
+    const uint32_t stride = settings.global_settings.validation_frame_stride;
+    if (stride <= 1) {
+        return;
+    }
+    // Stateless and object lifetime checks keep running, they stop invalid handles and pointers before the state tracking
+    // dereferences them
+    constexpr uint32_t kStridedObjectsMask = (1u << LayerObjectTypeDeprecation) | (1u << LayerObjectTypeCoreValidation) |
+                                             (1u << LayerObjectTypeBestPractices) | (1u << LayerObjectTypeGpuAssisted) |
+                                             (1u << LayerObjectTypeSyncValidation);
+    const uint64_t frame = strided_frame_count.fetch_add(1, std::memory_order_relaxed) + 1;
+    frame_stride_shed_mask.store((frame % stride) == 0 ? 0 : kStridedObjectsMask, std::memory_order_relaxed);
+}
+
+template <typename SubmitInfo>
+static bool HasFrameEnd(uint32_t count, const SubmitInfo *infos) {
+    for (uint32_t i = 0; i < count; ++i) {
+        const auto *frame_boundary = vku::FindStructInPNextChain<VkFrameBoundaryEXT>(infos[i].pNext);
+        if (frame_boundary && (frame_boundary->flags & VK_FRAME_BOUNDARY_FRAME_END_BIT_EXT)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Device::RecordFrameBoundaries(uint32_t submit_count, const VkSubmitInfo *submits) {
+    if (settings.global_settings.validation_frame_stride > 1 && HasFrameEnd(submit_count, submits)) {
+        EndStridedFrame();
+    }
+}
+
+void Device::RecordFrameBoundaries(uint32_t submit_count, const VkSubmitInfo2 *submits) {
+    if (settings.global_settings.validation_frame_stride > 1 && HasFrameEnd(submit_count, submits)) {
+        EndStridedFrame();
+    }
+}
+
+void Device::RecordFrameBoundaries(uint32_t bind_info_count, const VkBindSparseInfo *bind_infos) {
+    if (settings.global_settings.validation_frame_stride > 1 && HasFrameEnd(bind_info_count, bind_infos)) {
+        EndStridedFrame();
+    }
+}
+
 base::Device *Device::GetValidationObject(LayerObjectTypeId object_type) const {
     for (auto &validation_object : object_dispatch) {
         if (validation_object->container_type == object_type) {
@@ -974,9 +1092,11 @@ VkResult Device::CreateGraphicsPipelines(VkDevice device, VkPipelineCache pipeli
     if (!wrap_handles)
         return device_dispatch_table.CreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines);
+    vvl::ScratchArray<vku::safe_VkGraphicsPipelineCreateInfo> var_local_pCreateInfos;
     vku::safe_VkGraphicsPipelineCreateInfo *local_pCreateInfos = nullptr;
     if (pCreateInfos) {
-        local_pCreateInfos = new vku::safe_VkGraphicsPipelineCreateInfo[createInfoCount];
+        var_local_pCreateInfos.resize(createInfoCount);
+        local_pCreateInfos = var_local_pCreateInfos.data();
         ReadLockGuard lock(dispatch_lock);
         for (uint32_t idx0 = 0; idx0 < createInfoCount; ++idx0) {
             bool uses_color_attachment = false;
@@ -1087,7 +1207,6 @@ VkResult Device::CreateGraphicsPipelines(VkDevice device, VkPipelineCache pipeli
         }
     }
 
-    delete[] local_pCreateInfos;
     {
         for (uint32_t i = 0; i < createInfoCount; ++i) {
             if (pPipelines[i] != VK_NULL_HANDLE) {
@@ -1236,10 +1355,12 @@ void Device::DestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, cons
 
 VkResult Device::QueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo) {
     if (!wrap_handles) return device_dispatch_table.QueuePresentKHR(queue, pPresentInfo);
+    vku::safe_VkPresentInfoKHR var_local_pPresentInfo;
     vku::safe_VkPresentInfoKHR *local_pPresentInfo = nullptr;
     {
         if (pPresentInfo) {
-            local_pPresentInfo = new vku::safe_VkPresentInfoKHR(pPresentInfo);
+            local_pPresentInfo = &var_local_pPresentInfo;
+            local_pPresentInfo->initialize(pPresentInfo);
             if (local_pPresentInfo->pWaitSemaphores) {
                 for (uint32_t index1 = 0; index1 < local_pPresentInfo->waitSemaphoreCount; ++index1) {
                     local_pPresentInfo->pWaitSemaphores[index1] = Unwrap(pPresentInfo->pWaitSemaphores[index1]);
@@ -1262,7 +1383,6 @@ VkResult Device::QueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresent
             pPresentInfo->pResults[i] = local_pPresentInfo->pResults[i];
         }
     }
-    delete local_pPresentInfo;
     return result;
 }
 
@@ -1302,10 +1422,12 @@ VkResult Device::ResetDescriptorPool(VkDevice device, VkDescriptorPool descripto
 VkResult Device::AllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo,
                                         VkDescriptorSet *pDescriptorSets) {
     if (!wrap_handles) return device_dispatch_table.AllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
+    vku::safe_VkDescriptorSetAllocateInfo var_local_pAllocateInfo;
     vku::safe_VkDescriptorSetAllocateInfo *local_pAllocateInfo = nullptr;
     {
         if (pAllocateInfo) {
-            local_pAllocateInfo = new vku::safe_VkDescriptorSetAllocateInfo(pAllocateInfo);
+            local_pAllocateInfo = &var_local_pAllocateInfo;
+            local_pAllocateInfo->initialize(pAllocateInfo);
             if (pAllocateInfo->descriptorPool) {
                 local_pAllocateInfo->descriptorPool = Unwrap(pAllocateInfo->descriptorPool);
             }
@@ -1318,9 +1440,6 @@ VkResult Device::AllocateDescriptorSets(VkDevice device, const VkDescriptorSetAl
     }
     VkResult result = device_dispatch_table.AllocateDescriptorSets(device, (const VkDescriptorSetAllocateInfo *)local_pAllocateInfo,
                                                                    pDescriptorSets);
-    if (local_pAllocateInfo) {
-        delete local_pAllocateInfo;
-    }
     if (result == VK_SUCCESS) {
         WriteLockGuard lock(dispatch_lock);
         auto &pool_descriptor_sets = pool_descriptor_sets_map[pAllocateInfo->descriptorPool];
@@ -1335,12 +1454,14 @@ VkResult Device::AllocateDescriptorSets(VkDevice device, const VkDescriptorSetAl
 VkResult Device::FreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount,
                                     const VkDescriptorSet *pDescriptorSets) {
     if (!wrap_handles) return device_dispatch_table.FreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+    vvl::ScratchArray<VkDescriptorSet> var_local_pDescriptorSets;
     VkDescriptorSet *local_pDescriptorSets = nullptr;
     VkDescriptorPool local_descriptor_pool = VK_NULL_HANDLE;
     {
         local_descriptor_pool = Unwrap(descriptorPool);
         if (pDescriptorSets) {
-            local_pDescriptorSets = new VkDescriptorSet[descriptorSetCount];
+            var_local_pDescriptorSets.resize(descriptorSetCount);
+            local_pDescriptorSets = var_local_pDescriptorSets.data();
             for (uint32_t index0 = 0; index0 < descriptorSetCount; ++index0) {
                 local_pDescriptorSets[index0] = Unwrap(pDescriptorSets[index0]);
             }
@@ -1348,7 +1469,6 @@ VkResult Device::FreeDescriptorSets(VkDevice device, VkDescriptorPool descriptor
     }
     VkResult result = device_dispatch_table.FreeDescriptorSets(device, local_descriptor_pool, descriptorSetCount,
                                                                (const VkDescriptorSet *)local_pDescriptorSets);
-    if (local_pDescriptorSets) delete[] local_pDescriptorSets;
     if ((result == VK_SUCCESS) && (pDescriptorSets)) {
         WriteLockGuard lock(dispatch_lock);
         auto &pool_descriptor_sets = pool_descriptor_sets_map[descriptorPool];
@@ -1746,9 +1866,8 @@ VkResult Device::AllocateCommandBuffers(VkDevice device, const VkCommandBufferAl
     VkResult result = device_dispatch_table.AllocateCommandBuffers(
         device, (const VkCommandBufferAllocateInfo *)&local_pAllocateInfo, pCommandBuffers);
     if ((result == VK_SUCCESS) && pAllocateInfo && (pAllocateInfo->level == VK_COMMAND_BUFFER_LEVEL_SECONDARY)) {
-        auto lock = WriteLockGuard(secondary_cb_map_mutex);
         for (uint32_t cb_index = 0; cb_index < pAllocateInfo->commandBufferCount; cb_index++) {
-            secondary_cb_map.emplace(pCommandBuffers[cb_index], pAllocateInfo->commandPool);
+            secondary_cb_map.insert_or_assign(pCommandBuffers[cb_index], pAllocateInfo->commandPool);
         }
     }
     return result;
@@ -1760,7 +1879,6 @@ void Device::FreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint
     commandPool = Unwrap(commandPool);
     device_dispatch_table.FreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
 
-    auto lock = WriteLockGuard(secondary_cb_map_mutex);
     for (uint32_t cb_index = 0; cb_index < commandBufferCount; cb_index++) {
         secondary_cb_map.erase(pCommandBuffers[cb_index]);
     }
@@ -1769,26 +1887,30 @@ void Device::FreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint
 void Device::DestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks *pAllocator) {
     if (!wrap_handles) return device_dispatch_table.DestroyCommandPool(device, commandPool, pAllocator);
 
+    // The map holds the wrapped handle
+    const VkCommandPool wrapped_pool = commandPool;
     commandPool = Erase(commandPool);
     device_dispatch_table.DestroyCommandPool(device, commandPool, pAllocator);
 
-    auto lock = WriteLockGuard(secondary_cb_map_mutex);
-    for (auto item = secondary_cb_map.begin(); item != secondary_cb_map.end();) {
-        if (item->second == commandPool) {
-            item = secondary_cb_map.erase(item);
-        } else {
-            ++item;
+    if (!secondary_cb_map.empty()) {
+        for (const auto &[command_buffer, pool] : secondary_cb_map.snapshot()) {
+            if (pool == wrapped_pool) {
+                secondary_cb_map.erase(command_buffer);
+            }
         }
     }
 }
 
-bool Device::IsSecondary(VkCommandBuffer commandBuffer) const {
-    auto lock = ReadLockGuard(secondary_cb_map_mutex);
-    return secondary_cb_map.find(commandBuffer) != secondary_cb_map.end();
-}
+bool Device::IsSecondary(VkCommandBuffer commandBuffer) const { return secondary_cb_map.contains(commandBuffer); }
 
 VkResult Device::BeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo) {
-    if (!wrap_handles || !IsSecondary(commandBuffer)) return device_dispatch_table.BeginCommandBuffer(commandBuffer, pBeginInfo);
+    // Only the inheritance info has handles to unwrap, and it is ignored for primary command buffers
+    const bool is_secondary = wrap_handles && pBeginInfo && pBeginInfo->pInheritanceInfo && IsSecondary(commandBuffer);
+    return BeginCommandBuffer(commandBuffer, pBeginInfo, is_secondary);
+}
+
+VkResult Device::BeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo, bool is_secondary) {
+    if (!wrap_handles || !is_secondary) return device_dispatch_table.BeginCommandBuffer(commandBuffer, pBeginInfo);
     vku::safe_VkCommandBufferBeginInfo local_pBeginInfo;
     if (pBeginInfo) {
         local_pBeginInfo.initialize(pBeginInfo);
@@ -1988,10 +2110,12 @@ void Device::CmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, ui
                                                const VkAccelerationStructureBuildRangeInfoKHR *const *ppBuildRangeInfos) {
     if (!wrap_handles)
         return device_dispatch_table.CmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
+    vvl::ScratchArray<vku::safe_VkAccelerationStructureBuildGeometryInfoKHR> var_local_pInfos;
     vku::safe_VkAccelerationStructureBuildGeometryInfoKHR *local_pInfos = nullptr;
     {
         if (pInfos) {
-            local_pInfos = new vku::safe_VkAccelerationStructureBuildGeometryInfoKHR[infoCount];
+            var_local_pInfos.resize(infoCount);
+            local_pInfos = var_local_pInfos.data();
             for (uint32_t index0 = 0; index0 < infoCount; ++index0) {
                 local_pInfos[index0].initialize(&pInfos[index0], false, nullptr);
 
@@ -2015,9 +2139,6 @@ void Device::CmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, ui
     }
     device_dispatch_table.CmdBuildAccelerationStructuresKHR(
         commandBuffer, infoCount, (const VkAccelerationStructureBuildGeometryInfoKHR *)local_pInfos, ppBuildRangeInfos);
-    if (local_pInfos) {
-        delete[] local_pInfos;
-    }
 }
 
 VkResult Device::BuildAccelerationStructuresKHR(VkDevice device, VkDeferredOperationKHR deferredOperation, uint32_t infoCount,
@@ -2225,11 +2346,13 @@ VkResult Device::CreateComputePipelines(VkDevice device, VkPipelineCache pipelin
     if (!wrap_handles)
         return device_dispatch_table.CreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines);
+    vvl::ScratchArray<vku::safe_VkComputePipelineCreateInfo> var_local_pCreateInfos;
     vku::safe_VkComputePipelineCreateInfo *local_pCreateInfos = nullptr;
     {
         pipelineCache = Unwrap(pipelineCache);
         if (pCreateInfos) {
-            local_pCreateInfos = new vku::safe_VkComputePipelineCreateInfo[createInfoCount];
+            var_local_pCreateInfos.resize(createInfoCount);
+            local_pCreateInfos = var_local_pCreateInfos.data();
             for (uint32_t index0 = 0; index0 < createInfoCount; ++index0) {
                 local_pCreateInfos[index0].initialize(&pCreateInfos[index0]);
                 UnwrapPnextChainHandles(local_pCreateInfos[index0].pNext);
@@ -2254,9 +2377,6 @@ VkResult Device::CreateComputePipelines(VkDevice device, VkPipelineCache pipelin
         }
     }
 
-    if (local_pCreateInfos) {
-        delete[] local_pCreateInfos;
-    }
     {
         for (uint32_t index0 = 0; index0 < createInfoCount; index0++) {
             if (pPipelines[index0] != VK_NULL_HANDLE) {
@@ -2273,11 +2393,13 @@ VkResult Device::CreateRayTracingPipelinesNV(VkDevice device, VkPipelineCache pi
     if (!wrap_handles)
         return device_dispatch_table.CreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                  pPipelines);
+    vvl::ScratchArray<vku::safe_VkRayTracingPipelineCreateInfoNV> var_local_pCreateInfos;
     vku::safe_VkRayTracingPipelineCreateInfoNV *local_pCreateInfos = nullptr;
     {
         pipelineCache = Unwrap(pipelineCache);
         if (pCreateInfos) {
-            local_pCreateInfos = new vku::safe_VkRayTracingPipelineCreateInfoNV[createInfoCount];
+            var_local_pCreateInfos.resize(createInfoCount);
+            local_pCreateInfos = var_local_pCreateInfos.data();
             for (uint32_t index0 = 0; index0 < createInfoCount; ++index0) {
                 local_pCreateInfos[index0].initialize(&pCreateInfos[index0]);
                 if (local_pCreateInfos[index0].pStages) {
@@ -2313,9 +2435,6 @@ VkResult Device::CreateRayTracingPipelinesNV(VkDevice device, VkPipelineCache pi
         }
     }
 
-    if (local_pCreateInfos) {
-        delete[] local_pCreateInfos;
-    }
     {
         for (uint32_t index0 = 0; index0 < createInfoCount; index0++) {
             if (pPipelines[index0] != VK_NULL_HANDLE) {
@@ -2441,7 +2560,7 @@ VkResult Device::CreateIndirectExecutionSetEXT(VkDevice device, const VkIndirect
 
 VkResult Device::BindBufferMemory2(VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfo *pBindInfos) {
     if (!wrap_handles) return device_dispatch_table.BindBufferMemory2(device, bindInfoCount, pBindInfos);
-    small_vector<vku::safe_VkBindBufferMemoryInfo, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pBindInfos;
+    vvl::ScratchArray<vku::safe_VkBindBufferMemoryInfo> var_local_pBindInfos;
     vku::safe_VkBindBufferMemoryInfo *local_pBindInfos = nullptr;
     {
         if (pBindInfos) {
@@ -2477,7 +2596,7 @@ VkResult Device::BindBufferMemory2(VkDevice device, uint32_t bindInfoCount, cons
 
 VkResult Device::BindImageMemory2(VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfo *pBindInfos) {
     if (!wrap_handles) return device_dispatch_table.BindImageMemory2(device, bindInfoCount, pBindInfos);
-    small_vector<vku::safe_VkBindImageMemoryInfo, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pBindInfos;
+    vvl::ScratchArray<vku::safe_VkBindImageMemoryInfo> var_local_pBindInfos;
     vku::safe_VkBindImageMemoryInfo *local_pBindInfos = nullptr;
     {
         if (pBindInfos) {
@@ -2514,7 +2633,7 @@ VkResult Device::BindImageMemory2(VkDevice device, uint32_t bindInfoCount, const
 
 VkResult Device::BindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfo *pBindInfos) {
     if (!wrap_handles) return device_dispatch_table.BindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
-    small_vector<vku::safe_VkBindBufferMemoryInfo, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pBindInfos;
+    vvl::ScratchArray<vku::safe_VkBindBufferMemoryInfo> var_local_pBindInfos;
     vku::safe_VkBindBufferMemoryInfo *local_pBindInfos = nullptr;
     {
         if (pBindInfos) {
@@ -2550,7 +2669,7 @@ VkResult Device::BindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount, c
 
 VkResult Device::BindImageMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfo *pBindInfos) {
     if (!wrap_handles) return device_dispatch_table.BindImageMemory2KHR(device, bindInfoCount, pBindInfos);
-    small_vector<vku::safe_VkBindImageMemoryInfo, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pBindInfos;
+    vvl::ScratchArray<vku::safe_VkBindImageMemoryInfo> var_local_pBindInfos;
     vku::safe_VkBindImageMemoryInfo *local_pBindInfos = nullptr;
     {
         if (pBindInfos) {
@@ -2588,7 +2707,7 @@ VkResult Device::BindImageMemory2KHR(VkDevice device, uint32_t bindInfoCount, co
 VkResult Device::CreateShadersEXT(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT *pCreateInfos,
                                   const VkAllocationCallbacks *pAllocator, VkShaderEXT *pShaders) {
     if (!wrap_handles) return device_dispatch_table.CreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders);
-    small_vector<vku::safe_VkShaderCreateInfoEXT, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pCreateInfos;
+    vvl::ScratchArray<vku::safe_VkShaderCreateInfoEXT> var_local_pCreateInfos;
     vku::safe_VkShaderCreateInfoEXT *local_pCreateInfos = nullptr;
     if (pCreateInfos) {
         var_local_pCreateInfos.resize(createInfoCount);
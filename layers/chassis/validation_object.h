@@ -150,6 +150,7 @@ class Device : public Logger {
 
     const ValidationDisabled& disabled;
     const ValidationEnabled& enabled;
+    profiling::MemoryAccounting& memory_accounting;
 
     const VkInstance instance;
     const VkPhysicalDevice physical_device;
@@ -183,6 +184,7 @@ class Device : public Logger {
           syncval_settings(dispatch_dev->settings.syncval_settings),
           disabled(dispatch_dev->settings.disabled),
           enabled(dispatch_dev->settings.enabled),
+          memory_accounting(dispatch_dev->memory_accounting),
           instance(instance->instance),
           physical_device(dispatch_dev->physical_device),
           device(dispatch_dev->device),
@@ -198,6 +200,10 @@ class Device : public Logger {
     virtual ReadLockGuard ReadLock() const { return ReadLockGuard(validation_object_mutex); }
     virtual WriteLockGuard WriteLock() { return WriteLockGuard(validation_object_mutex); }
 
+    // Sets the memory_accounting bytes of the subsystems that are cheaper to measure when asked than to keep up to date.
+    // Called from any thread without the validation object lock.
+    virtual void UpdateMemoryAccounting() const {}
+
     // Should be used instead of WriteLock() if the Record phase wants to release
     // its lock during the blocking operation.
     struct BlockingOperationGuard {
@@ -36,6 +36,8 @@
 
 #include <vulkan/utility/vk_concurrent_unordered_map.hpp>
 
+#include "containers/internal_allocator.h"
+
 // namespace aliases to allow map and set implementations to easily be swapped out
 namespace vvl {
 
@@ -44,10 +46,10 @@ template <typename T>
 using hash = phmap::Hash<T>;
 
 template <typename Key, typename Hash = phmap::Hash<Key>, typename KeyEqual = std::equal_to<Key>>
-using unordered_set = phmap::flat_hash_set<Key, Hash, KeyEqual>;
+using unordered_set = phmap::flat_hash_set<Key, Hash, KeyEqual, InternalAllocator<Key>>;
 
 template <typename Key, typename T, typename Hash = phmap::Hash<Key>, typename KeyEqual = std::equal_to<Key>>
-using unordered_map = phmap::flat_hash_map<Key, T, Hash, KeyEqual>;
+using unordered_map = phmap::flat_hash_map<Key, T, Hash, KeyEqual, InternalAllocator<std::pair<const Key, T>>>;
 
 template <typename Key, typename T>
 using map_entry = phmap::Pair<Key, T>;
@@ -57,10 +59,10 @@ template <typename T>
 using hash = std::hash<T>;
 
 template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
-using unordered_set = std::unordered_set<Key, Hash, KeyEqual>;
+using unordered_set = std::unordered_set<Key, Hash, KeyEqual, InternalAllocator<Key>>;
 
 template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
-using unordered_map = std::unordered_map<Key, T, Hash, KeyEqual>;
+using unordered_map = std::unordered_map<Key, T, Hash, KeyEqual, InternalAllocator<std::pair<const Key, T>>>;
 
 template <typename Key, typename T>
 using map_entry = std::pair<Key, T>;
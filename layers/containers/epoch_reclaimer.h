@@ -0,0 +1,157 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace vvl {
+
+// Epoch based reclamation of the state objects handed out as borrowed (raw) pointers, see DeviceState::GetBorrowed().
+//
+// Borrowed pointers are only used inside a Scope. An object removed from its map is given to Retire() instead of being
+// released, and the reference kept by the reclaimer is dropped once every Scope that was open when it was retired has closed.
+// Opening and closing a Scope only stores to a word of the calling thread, while every shared_ptr copy is an atomic increment
+// and decrement on the object, which bounces between cores when several threads record with the same buffers and pipelines.
+class EpochReclaimer {
+  public:
+    // Scopes nest, only the outermost one of a thread is tracked
+    class Scope {
+      public:
+        Scope() {
+            ThreadRecord& record = Record();
+            if (record.depth++ == 0) {
+                record.epoch.store(GlobalEpoch().load(std::memory_order_relaxed), std::memory_order_relaxed);
+                // The epoch must be visible to Retire() before any pointer is loaded from a map
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+        ~Scope() {
+            ThreadRecord& record = Record();
+            if (--record.depth == 0) {
+                record.epoch.store(kInactive, std::memory_order_release);
+            }
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    EpochReclaimer() = default;
+    EpochReclaimer(const EpochReclaimer&) = delete;
+    EpochReclaimer& operator=(const EpochReclaimer&) = delete;
+    ~EpochReclaimer() { Flush(); }
+
+    static bool InScope() { return Record().depth != 0; }
+
+    // |object| must already be unreachable from the maps
+    void Retire(std::shared_ptr<void>&& object) {
+        // Pairs with the fence of Scope: a scope that did not see the removal has published its epoch
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const uint64_t epoch = GlobalEpoch().fetch_add(1, std::memory_order_seq_cst);
+        std::vector<std::shared_ptr<void>> released;
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+            retired_.emplace_back(epoch, std::move(object));
+            // A scope opened at epoch E can only borrow the objects retired at E or later
+            const uint64_t oldest = OldestActiveEpoch();
+            auto kept = std::partition(retired_.begin(), retired_.end(),
+                                       [oldest](const Retired& retired) { return retired.first >= oldest; });
+            for (auto it = kept; it != retired_.end(); ++it) {
+                released.emplace_back(std::move(it->second));
+            }
+            retired_.erase(kept, retired_.end());
+        }
+        // Destructors can retire more objects, released without the lock held
+    }
+
+    // Drops every retired object without waiting for the scopes, only when no thread can still use borrowed pointers to them
+    // (device destruction)
+    void Flush() {
+        std::vector<Retired> released;
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+            released.swap(retired_);
+        }
+    }
+
+    size_t RetiredCount() const {
+        std::lock_guard<std::mutex> guard(lock_);
+        return retired_.size();
+    }
+
+  private:
+    using Retired = std::pair<uint64_t, std::shared_ptr<void>>;
+    static constexpr uint64_t kInactive = 0;
+
+    struct ThreadRecord {
+        std::atomic<uint64_t> epoch{kInactive};
+        uint32_t depth = 0;
+
+        ThreadRecord() {
+            std::lock_guard<std::mutex> guard(RegistryLock());
+            Registry().emplace_back(this);
+        }
+        ~ThreadRecord() {
+            std::lock_guard<std::mutex> guard(RegistryLock());
+            auto& registry = Registry();
+            registry.erase(std::find(registry.begin(), registry.end(), this));
+        }
+    };
+
+    // Starts past kInactive
+    static std::atomic<uint64_t>& GlobalEpoch() {
+        static std::atomic<uint64_t> epoch{1};
+        return epoch;
+    }
+    static ThreadRecord& Record() {
+        thread_local ThreadRecord record;
+        return record;
+    }
+    // Leaked so that threads exiting after the static objects are destroyed can still unregister
+    static std::vector<ThreadRecord*>& Registry() {
+        static auto* registry = new std::vector<ThreadRecord*>();
+        return *registry;
+    }
+    static std::mutex& RegistryLock() {
+        static auto* lock = new std::mutex();
+        return *lock;
+    }
+
+    static uint64_t OldestActiveEpoch() {
+        uint64_t oldest = std::numeric_limits<uint64_t>::max();
+        std::lock_guard<std::mutex> guard(RegistryLock());
+        for (const ThreadRecord* record : Registry()) {
+            const uint64_t epoch = record->epoch.load(std::memory_order_acquire);
+            if (epoch != kInactive) {
+                oldest = std::min(oldest, epoch);
+            }
+        }
+        return oldest;
+    }
+
+    mutable std::mutex lock_;
+    std::vector<Retired> retired_;
+};
+
+}  // namespace vvl
@@ -0,0 +1,307 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "utils/math_utils.h"
+
+namespace vvl {
+
+// Maps 64-bit ids to 64-bit payloads without hashing or locking on lookup.
+//
+// The id returned by Insert() encodes the slot index in the low bits and the slot generation in the high bits. The top
+// kTagBits of the generation are the tag given to the table, so tables with different tags never hand out the same id.
+// Slots live in segments whose sizes double (kFirstSegmentSize, 2x, 4x, ...), segments are never moved or freed until the
+// table is destroyed, so Find() is a bounds check plus loads from a single slot.
+//
+// Erase() bumps the slot generation before the index goes back on the free list, so an id that was erased (and possibly had
+// its slot reused) no longer matches and is reported as not found.
+//
+// Slot indices are handed to each thread in blocks of kThreadBlockSize, taken from the free list or carved off the end of the
+// table, so Insert() and Erase() only touch shared memory once per block. A thread caches blocks for up to kThreadBlocks
+// tables, the indices cached for a table are given back to it when the thread needs the cache for another table or exits.
+//
+// A zero id and a zero payload are reserved to mean "not found".
+class HandleSlab {
+  public:
+    static constexpr uint32_t kIndexBits = 32;
+    static constexpr uint64_t kIndexMask = (uint64_t(1) << kIndexBits) - 1;
+    static constexpr uint32_t kFirstSegmentLog2 = 10;
+    static constexpr uint32_t kFirstSegmentSize = 1u << kFirstSegmentLog2;
+    // The last segment holds 2^31 slots, which covers every index that fits in kIndexBits
+    static constexpr uint32_t kMaxSegments = 31 - kFirstSegmentLog2 + 1;
+    static constexpr uint64_t kMaxSlots = (uint64_t(kFirstSegmentSize) << kMaxSegments) - kFirstSegmentSize;
+    static constexpr uint32_t kThreadBlockSize = 64;
+    static constexpr uint32_t kThreadBlocks = 4;
+    static constexpr uint32_t kTagBits = 8;
+    static constexpr uint32_t kMaxTag = (1u << kTagBits) - 1;
+    static constexpr uint32_t kGenerationBits = 32 - kTagBits;
+    static constexpr uint32_t kGenerationMask = (1u << kGenerationBits) - 1;
+
+    explicit HandleSlab(uint32_t tag = 0)
+        : serial_(next_serial_.fetch_add(1, std::memory_order_relaxed)), tag_bits_(tag << kGenerationBits) {
+        assert(tag <= kMaxTag);
+        std::lock_guard<std::mutex> guard(RegistryLock());
+        Registry().emplace_back(this);
+    }
+    HandleSlab(const HandleSlab &) = delete;
+    HandleSlab &operator=(const HandleSlab &) = delete;
+    ~HandleSlab() {
+        {
+            // After this no thread gives indices back to the table
+            std::lock_guard<std::mutex> guard(RegistryLock());
+            auto &registry = Registry();
+            registry.erase(std::find(registry.begin(), registry.end(), this));
+        }
+        for (auto &segment : segments_) {
+            delete[] segment.load(std::memory_order_relaxed);
+        }
+    }
+
+    uint32_t Tag() const { return tag_bits_ >> kGenerationBits; }
+
+    // Returns the id under which the payload can be found
+    uint64_t Insert(uint64_t value) {
+        assert(value != 0);
+        const uint32_t index = AllocateIndex();
+        Slot &slot = GetOrCreateSlot(index);
+        uint32_t generation = slot.generation.load(std::memory_order_relaxed) & kGenerationMask;
+        if (generation == 0) {
+            // Fresh slot (or generation wrapped around), 0 is kept unused so a valid id is never 0
+            generation = 1;
+        }
+        generation |= tag_bits_;
+        slot.value.store(value, std::memory_order_relaxed);
+        slot.aux.store(0, std::memory_order_relaxed);
+        slot.generation.store(generation, std::memory_order_release);
+        return (uint64_t(generation) << kIndexBits) | index;
+    }
+
+    // Returns the payload of a live id, 0 otherwise
+    uint64_t Find(uint64_t id) const {
+        const Slot *slot = FindSlot(id);
+        return slot ? slot->value.load(std::memory_order_acquire) : 0;
+    }
+
+    // Returns the payload of a live id and retires the id, 0 if the id was not live
+    uint64_t Erase(uint64_t id) {
+        Slot *slot = const_cast<Slot *>(FindSlot(id));
+        if (!slot) {
+            return 0;
+        }
+        const uint32_t generation = uint32_t(id >> kIndexBits);
+        // Only one caller can retire a given id
+        uint32_t expected = generation;
+        const uint32_t retired = tag_bits_ | ((generation + 1) & kGenerationMask);
+        if (!slot->generation.compare_exchange_strong(expected, retired, std::memory_order_acq_rel)) {
+            return 0;
+        }
+        const uint64_t value = slot->value.exchange(0, std::memory_order_relaxed);
+        FreeIndex(uint32_t(id & kIndexMask));
+        return value;
+    }
+
+    // Every live id also has 32 bits of extra data, 0 after Insert(). It lets other tables keyed by the same ids (see
+    // StateObjectMap) find their own entry with an index instead of a hash. Returns false if the id is not live.
+    bool SetAux(uint64_t id, uint32_t aux) {
+        Slot *slot = const_cast<Slot *>(FindSlot(id));
+        if (!slot) {
+            return false;
+        }
+        slot->aux.store(aux, std::memory_order_release);
+        return true;
+    }
+
+    uint32_t FindAux(uint64_t id) const {
+        const Slot *slot = FindSlot(id);
+        return slot ? slot->aux.load(std::memory_order_acquire) : 0;
+    }
+
+  private:
+    struct Slot {
+        std::atomic<uint32_t> generation{0};
+        // Fits in what would otherwise be padding
+        std::atomic<uint32_t> aux{0};
+        std::atomic<uint64_t> value{0};
+    };
+
+    static uint32_t SegmentOf(uint32_t index, uint32_t &offset) {
+        // Biasing the index by the first segment size makes the segment number the position of the MSB
+        const uint32_t biased = index + kFirstSegmentSize;
+        const uint32_t msb = static_cast<uint32_t>(MostSignificantBit(biased));
+        offset = biased - (1u << msb);
+        return msb - kFirstSegmentLog2;
+    }
+
+    const Slot *FindSlot(uint64_t id) const {
+        const uint64_t index = id & kIndexMask;
+        const uint32_t generation = uint32_t(id >> kIndexBits);
+        if ((generation & kGenerationMask) == 0 || index >= next_index_.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        uint32_t offset = 0;
+        const uint32_t segment_index = SegmentOf(uint32_t(index), offset);
+        const Slot *segment = segments_[segment_index].load(std::memory_order_acquire);
+        if (!segment) {
+            return nullptr;
+        }
+        const Slot &slot = segment[offset];
+        if (slot.generation.load(std::memory_order_acquire) != generation) {
+            return nullptr;
+        }
+        return &slot;
+    }
+
+    Slot &GetOrCreateSlot(uint32_t index) {
+        uint32_t offset = 0;
+        const uint32_t segment_index = SegmentOf(index, offset);
+        std::atomic<Slot *> &segment_ptr = segments_[segment_index];
+        Slot *segment = segment_ptr.load(std::memory_order_acquire);
+        if (!segment) {
+            Slot *new_segment = new Slot[size_t(kFirstSegmentSize) << segment_index];
+            if (segment_ptr.compare_exchange_strong(segment, new_segment, std::memory_order_acq_rel)) {
+                segment = new_segment;
+            } else {
+                // Another thread published the segment first
+                delete[] new_segment;
+            }
+        }
+        return segment[offset];
+    }
+
+    // Indices owned by the calling thread, for the table identified by serial
+    struct ThreadBlock {
+        uint64_t serial = 0;
+        uint32_t count = 0;
+        uint32_t indices[2 * kThreadBlockSize];
+    };
+
+    struct ThreadBlocks {
+        ThreadBlock blocks[kThreadBlocks];
+        uint32_t next_evicted = 0;
+        ~ThreadBlocks() {
+            for (ThreadBlock &block : blocks) {
+                GiveBack(block);
+            }
+        }
+    };
+
+    ThreadBlock &GetThreadBlock() {
+        thread_local ThreadBlocks cache;
+        for (ThreadBlock &block : cache.blocks) {
+            if (block.serial == serial_) {
+                return block;
+            }
+        }
+        for (ThreadBlock &block : cache.blocks) {
+            if (block.serial == 0) {
+                block.serial = serial_;
+                return block;
+            }
+        }
+        // The thread uses more tables than it has blocks for, ex: the devices of a multi GPU application
+        ThreadBlock &block = cache.blocks[cache.next_evicted++ % kThreadBlocks];
+        GiveBack(block);
+        block.serial = serial_;
+        return block;
+    }
+
+    // Returns the cached indices to their table, if it still exists
+    static void GiveBack(ThreadBlock &block) {
+        if (block.count != 0) {
+            std::lock_guard<std::mutex> guard(RegistryLock());
+            for (HandleSlab *slab : Registry()) {
+                if (slab->serial_ == block.serial) {
+                    std::lock_guard<std::mutex> free_guard(slab->free_lock_);
+                    slab->free_indices_.insert(slab->free_indices_.end(), block.indices, block.indices + block.count);
+                    break;
+                }
+            }
+        }
+        block.serial = 0;
+        block.count = 0;
+    }
+
+    // Live tables, so that threads can give indices back to them. Leaked, threads can exit after the static objects are gone
+    static std::mutex &RegistryLock() {
+        static auto *lock = new std::mutex();
+        return *lock;
+    }
+    static std::vector<HandleSlab *> &Registry() {
+        static auto *registry = new std::vector<HandleSlab *>();
+        return *registry;
+    }
+
+    uint32_t AllocateIndex() {
+        ThreadBlock &block = GetThreadBlock();
+        if (block.count == 0) {
+            RefillBlock(block);
+        }
+        return block.indices[--block.count];
+    }
+
+    void FreeIndex(uint32_t index) {
+        ThreadBlock &block = GetThreadBlock();
+        if (block.count == 2 * kThreadBlockSize) {
+            // Hand half of the cache back so other threads can reuse it
+            std::lock_guard<std::mutex> guard(free_lock_);
+            block.count -= kThreadBlockSize;
+            free_indices_.insert(free_indices_.end(), block.indices + block.count, block.indices + block.count + kThreadBlockSize);
+        }
+        block.indices[block.count++] = index;
+    }
+
+    void RefillBlock(ThreadBlock &block) {
+        {
+            std::lock_guard<std::mutex> guard(free_lock_);
+            const uint32_t reused = static_cast<uint32_t>(std::min<size_t>(kThreadBlockSize, free_indices_.size()));
+            if (reused != 0) {
+                std::copy(free_indices_.end() - reused, free_indices_.end(), block.indices);
+                free_indices_.resize(free_indices_.size() - reused);
+                block.count = reused;
+                return;
+            }
+        }
+        const uint32_t first = next_index_.fetch_add(kThreadBlockSize, std::memory_order_acq_rel);
+        assert(uint64_t(first) + kThreadBlockSize <= kMaxSlots);
+        // Hand out in increasing order so that the slots touched first are also the first ones in memory
+        for (uint32_t i = 0; i < kThreadBlockSize; ++i) {
+            block.indices[i] = first + kThreadBlockSize - 1 - i;
+        }
+        block.count = kThreadBlockSize;
+    }
+
+    std::array<std::atomic<Slot *>, kMaxSegments> segments_{};
+    std::atomic<uint32_t> next_index_{0};
+    const uint64_t serial_;
+    const uint32_t tag_bits_;
+    // Starts at 1 so a zero initialized ThreadBlock never matches a table
+    static inline std::atomic<uint64_t> next_serial_{1};
+
+    std::mutex free_lock_;
+    std::vector<uint32_t> free_indices_;
+};
+
+}  // namespace vvl
@@ -0,0 +1,169 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "containers/internal_allocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include <vulkan/vulkan_core.h>
+
+#include "containers/object_pool.h"
+
+namespace vvl {
+
+namespace {
+
+// Blocks up to kMaxPooledSize come from one pool per multiple of kGranularity, which also is their alignment
+class PooledMemoryResource final : public InternalMemoryResource {
+  public:
+    static constexpr size_t kGranularity = 16;
+    static constexpr size_t kMaxPooledSize = 256;
+    static constexpr size_t kPoolCount = kMaxPooledSize / kGranularity;
+
+    PooledMemoryResource() {
+        // Names must be string literals, see BlockPool
+        static constexpr const char* kNames[kPoolCount] = {
+            "Internal 16",  "Internal 32",  "Internal 48",  "Internal 64",  "Internal 80",  "Internal 96",
+            "Internal 112", "Internal 128", "Internal 144", "Internal 160", "Internal 176", "Internal 192",
+            "Internal 208", "Internal 224", "Internal 240", "Internal 256"};
+        for (size_t i = 0; i < kPoolCount; ++i) {
+            pools_[i] = new BlockPool(kNames[i], (i + 1) * kGranularity, kGranularity);
+            internal::RegisterBlockPool(pools_[i]);
+        }
+    }
+
+    void* Allocate(size_t size, size_t alignment) override {
+#if !defined(VVL_OBJECT_POOLS_USE_HEAP)
+        if (IsPooled(size, alignment)) {
+            return pools_[(size - 1) / kGranularity]->Allocate();
+        }
+#endif
+        return ::operator new(size, std::align_val_t(HeapAlignment(alignment)));
+    }
+
+    void Free(void* ptr, [[maybe_unused]] size_t size, size_t alignment) override {
+#if !defined(VVL_OBJECT_POOLS_USE_HEAP)
+        if (IsPooled(size, alignment)) {
+            pools_[(size - 1) / kGranularity]->Free(ptr);
+            return;
+        }
+#endif
+        ::operator delete(ptr, std::align_val_t(HeapAlignment(alignment)));
+    }
+
+  private:
+    static bool IsPooled(size_t size, size_t alignment) {
+        return size != 0 && size <= kMaxPooledSize && alignment <= kGranularity;
+    }
+    static size_t HeapAlignment(size_t alignment) { return std::max(alignment, alignof(std::max_align_t)); }
+
+    // Never destroyed, like the pools of PoolAllocator
+    BlockPool* pools_[kPoolCount];
+};
+
+class CallbacksMemoryResource final : public InternalMemoryResource {
+  public:
+    explicit CallbacksMemoryResource(const VkAllocationCallbacks& callbacks) : callbacks_(callbacks) {}
+
+    void* Allocate(size_t size, size_t alignment) override {
+        void* ptr = callbacks_.pfnAllocation(callbacks_.pUserData, size, alignment, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (!ptr) {
+            // Like operator new, the containers cannot handle a null allocation
+            throw std::bad_alloc();
+        }
+        return ptr;
+    }
+
+    void Free(void* ptr, size_t, size_t) override { callbacks_.pfnFree(callbacks_.pUserData, ptr); }
+
+    bool Matches(const VkAllocationCallbacks& callbacks) const {
+        return callbacks.pUserData == callbacks_.pUserData && callbacks.pfnAllocation == callbacks_.pfnAllocation &&
+               callbacks.pfnFree == callbacks_.pfnFree;
+    }
+
+  private:
+    const VkAllocationCallbacks callbacks_;
+};
+
+// Leaked so that containers destroyed with the static objects can still free their memory
+InternalMemoryResource& DefaultResource() {
+    static auto* resource = new PooledMemoryResource();
+    return *resource;
+}
+
+std::atomic<InternalMemoryResource*> current_resource{nullptr};
+
+// Front of the blocks of AllocateInternal, right before the returned pointer
+struct BlockHeader {
+    InternalMemoryResource* resource;
+    size_t size;
+    uint32_t offset;  // from the start of the allocation to the returned pointer
+    uint32_t alignment;
+};
+
+}  // namespace
+
+InternalMemoryResource& GetInternalMemoryResource() {
+    if (InternalMemoryResource* resource = current_resource.load(std::memory_order_acquire)) {
+        return *resource;
+    }
+    return DefaultResource();
+}
+
+void SetInternalAllocationCallbacks(const VkAllocationCallbacks* callbacks) {
+    if (!callbacks) {
+        current_resource.store(nullptr, std::memory_order_release);
+        return;
+    }
+    // The same callbacks get the same resource, an application that creates many instances does not add up resources
+    static std::mutex lock;
+    static auto* resources = new std::vector<CallbacksMemoryResource*>();
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = std::find_if(resources->begin(), resources->end(),
+                           [callbacks](const CallbacksMemoryResource* resource) { return resource->Matches(*callbacks); });
+    if (it == resources->end()) {
+        it = resources->insert(resources->end(), new CallbacksMemoryResource(*callbacks));
+    }
+    current_resource.store(*it, std::memory_order_release);
+}
+
+void* AllocateInternal(size_t size, size_t alignment) {
+    InternalMemoryResource& resource = GetInternalMemoryResource();
+    alignment = std::max(alignment, alignof(BlockHeader));
+    const size_t offset = (sizeof(BlockHeader) + alignment - 1) / alignment * alignment;
+    auto* block = static_cast<std::byte*>(resource.Allocate(offset + size, alignment));
+    const BlockHeader header{&resource, offset + size, uint32_t(offset), uint32_t(alignment)};
+    std::memcpy(block + offset - sizeof(BlockHeader), &header, sizeof(BlockHeader));
+    return block + offset;
+}
+
+void FreeInternal(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+    BlockHeader header;
+    std::memcpy(&header, static_cast<std::byte*>(ptr) - sizeof(BlockHeader), sizeof(BlockHeader));
+    header.resource->Free(static_cast<std::byte*>(ptr) - header.offset, header.size, header.alignment);
+}
+
+}  // namespace vvl
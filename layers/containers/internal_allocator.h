@@ -0,0 +1,83 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+struct VkAllocationCallbacks;
+
+namespace vvl {
+
+// Where the memory of the layer internal containers (vvl::unordered_map, vvl::unordered_set, small_vector, range_map) comes
+// from. The default resource serves small blocks from thread caching pools (see BlockPool) and the others from the heap. With
+// the internal_allocation_callbacks setting, containers created after vkCreateInstance allocate through the
+// VkAllocationCallbacks given to it instead.
+//
+// Every container keeps the resource it was created with, so memory is always given back to the resource it came from.
+class InternalMemoryResource {
+  public:
+    virtual ~InternalMemoryResource() = default;
+    virtual void* Allocate(size_t size, size_t alignment) = 0;
+    virtual void Free(void* ptr, size_t size, size_t alignment) = 0;
+};
+
+// The resource of the containers created from now on, never null
+InternalMemoryResource& GetInternalMemoryResource();
+
+// Null goes back to the default resource. The resource of |callbacks| is kept until the layer is unloaded since containers can
+// still hold memory from it, so the callbacks must stay valid until every object of the instance is destroyed.
+void SetInternalAllocationCallbacks(const VkAllocationCallbacks* callbacks);
+
+// For containers that do not hold an allocator: the resource and size are kept in front of the returned block
+void* AllocateInternal(size_t size, size_t alignment);
+void FreeInternal(void* ptr);
+
+// Allocator of the standard and parallel_hashmap containers
+template <typename T>
+class InternalAllocator {
+  public:
+    using value_type = T;
+    // Moving a container moves its memory along with the resource it came from
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    InternalAllocator() noexcept : resource_(&GetInternalMemoryResource()) {}
+    template <typename U>
+    InternalAllocator(const InternalAllocator<U>& other) noexcept : resource_(other.Resource()) {}
+
+    T* allocate(size_t count) { return static_cast<T*>(resource_->Allocate(count * sizeof(T), alignof(T))); }
+    void deallocate(T* ptr, size_t count) { resource_->Free(ptr, count * sizeof(T), alignof(T)); }
+
+    InternalMemoryResource* Resource() const { return resource_; }
+
+    template <typename U>
+    bool operator==(const InternalAllocator<U>& other) const {
+        return resource_ == other.Resource();
+    }
+    template <typename U>
+    bool operator!=(const InternalAllocator<U>& other) const {
+        return resource_ != other.Resource();
+    }
+
+  private:
+    InternalMemoryResource* resource_;
+};
+
+}  // namespace vvl
@@ -0,0 +1,193 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "containers/object_pool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+
+namespace vvl {
+
+namespace {
+
+std::atomic<uint32_t> pool_count{0};
+
+std::mutex& RegistryLock() {
+    static std::mutex lock;
+    return lock;
+}
+
+std::vector<BlockPool*>& Registry() {
+    static std::vector<BlockPool*> pools;
+    return pools;
+}
+
+size_t BlockSize(size_t size, size_t alignment) {
+    const size_t min_size = std::max(size, sizeof(void*));
+    return (min_size + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+BlockPool::BlockPool(const char* name, size_t size, size_t alignment)
+    : name_(name),
+      block_size_(BlockSize(size, std::max(alignment, alignof(FreeBlock)))),
+      alignment_(std::max(alignment, alignof(FreeBlock))),
+      index_(pool_count.fetch_add(1, std::memory_order_relaxed)) {}
+
+BlockPool::~BlockPool() {
+    assert(caches_.empty());
+    for (void* slab : slabs_) {
+        ::operator delete(slab, std::align_val_t(alignment_));
+    }
+}
+
+BlockPool::ThreadCache::ThreadCache(BlockPool& pool_) : pool(pool_) {
+    std::lock_guard<std::mutex> guard(pool.lock_);
+    pool.caches_.emplace_back(this);
+}
+
+BlockPool::ThreadCache::~ThreadCache() {
+    pool.Drain(*this, 0);
+    std::lock_guard<std::mutex> guard(pool.lock_);
+    pool.caches_.erase(std::find(pool.caches_.begin(), pool.caches_.end(), this));
+}
+
+BlockPool::ThreadCache& BlockPool::GetThreadCache() {
+    // Given back to the pools when the thread exits
+    thread_local std::vector<std::unique_ptr<ThreadCache>> caches;
+    if (index_ >= caches.size()) {
+        caches.resize(index_ + 1);
+    }
+    if (!caches[index_]) {
+        caches[index_] = std::make_unique<ThreadCache>(*this);
+    }
+    return *caches[index_];
+}
+
+void* BlockPool::Allocate() {
+    ThreadCache& cache = GetThreadCache();
+    if (!cache.head) {
+        Refill(cache);
+    }
+    FreeBlock* block = cache.head;
+    cache.head = block->next;
+    cache.count.store(cache.count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+    return block;
+}
+
+void BlockPool::Free(void* ptr) {
+    ThreadCache& cache = GetThreadCache();
+    auto* block = static_cast<FreeBlock*>(ptr);
+    block->next = cache.head;
+    cache.head = block;
+    const uint32_t count = cache.count.load(std::memory_order_relaxed) + 1;
+    cache.count.store(count, std::memory_order_relaxed);
+    // Threads that free more than they allocate (ex: a destruction thread) hand the blocks back
+    if (count >= 2 * kBatchSize) {
+        Drain(cache, kBatchSize);
+    }
+}
+
+void BlockPool::Refill(ThreadCache& cache) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (free_count_ < kBatchSize) {
+        AddSlab();
+    }
+    uint32_t moved = 0;
+    for (; moved < kBatchSize && free_head_; ++moved) {
+        FreeBlock* block = free_head_;
+        free_head_ = block->next;
+        block->next = cache.head;
+        cache.head = block;
+    }
+    free_count_ -= moved;
+    cache.count.store(cache.count.load(std::memory_order_relaxed) + moved, std::memory_order_relaxed);
+}
+
+void BlockPool::Drain(ThreadCache& cache, uint32_t keep) {
+    std::lock_guard<std::mutex> guard(lock_);
+    uint32_t count = cache.count.load(std::memory_order_relaxed);
+    while (count > keep) {
+        FreeBlock* block = cache.head;
+        cache.head = block->next;
+        block->next = free_head_;
+        free_head_ = block;
+        ++free_count_;
+        --count;
+    }
+    cache.count.store(count, std::memory_order_relaxed);
+}
+
+void BlockPool::AddSlab() {
+    const size_t block_count = std::max<size_t>(kSlabSize / block_size_, 2 * kBatchSize);
+    auto* slab = static_cast<std::byte*>(::operator new(block_count * block_size_, std::align_val_t(alignment_)));
+    slabs_.emplace_back(slab);
+    for (size_t i = block_count; i-- > 0;) {
+        auto* block = reinterpret_cast<FreeBlock*>(slab + i * block_size_);
+        block->next = free_head_;
+        free_head_ = block;
+    }
+    free_count_ += block_count;
+    capacity_ += block_count;
+}
+
+BlockPool::Stats BlockPool::GetStats() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    size_t cached = 0;
+    for (const ThreadCache* cache : caches_) {
+        cached += cache->count.load(std::memory_order_relaxed);
+    }
+    assert(capacity_ >= free_count_ + cached);
+    return Stats{name_, block_size_, capacity_, capacity_ - free_count_ - cached};
+}
+
+namespace internal {
+void RegisterBlockPool(BlockPool* pool) {
+    std::lock_guard<std::mutex> guard(RegistryLock());
+    Registry().emplace_back(pool);
+}
+}  // namespace internal
+
+std::vector<BlockPool::Stats> GetBlockPoolStats() {
+    std::lock_guard<std::mutex> guard(RegistryLock());
+    std::vector<BlockPool::Stats> stats;
+    stats.reserve(Registry().size());
+    for (const BlockPool* pool : Registry()) {
+        stats.emplace_back(pool->GetStats());
+    }
+    return stats;
+}
+
+void WriteBlockPoolStatsCsv(std::ostream& out) {
+    out << "Pool Name,Block Size,Capacity,In Use\n";
+    for (const auto& stats : GetBlockPoolStats()) {
+        out << stats.name << ',' << stats.block_size << ',' << stats.capacity << ',' << stats.in_use << '\n';
+    }
+}
+
+bool WriteBlockPoolStatsCsv(const std::string& path) {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    WriteBlockPoolStatsCsv(file);
+    return bool(file);
+}
+
+}  // namespace vvl
@@ -0,0 +1,182 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Sanitizers can only catch use after free of state objects if every object is its own heap allocation
+#if defined(__SANITIZE_ADDRESS__)
+#define VVL_OBJECT_POOLS_USE_HEAP 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define VVL_OBJECT_POOLS_USE_HEAP 1
+#endif
+#endif
+
+namespace vvl {
+
+// Fixed size blocks carved out of large slabs, for state objects that are created and destroyed at a high rate.
+//
+// Each thread has a cache of free blocks for every pool it uses, allocating and freeing only touch that cache. The shared
+// free list (behind a mutex) is only used to move blocks in and out of a cache kBatchSize at a time. Slabs are never given
+// back to the heap, the pool keeps the high water mark of the application.
+class BlockPool {
+  public:
+    static constexpr uint32_t kBatchSize = 32;
+    static constexpr size_t kSlabSize = 64 * 1024;
+
+    struct Stats {
+        const char* name;
+        size_t block_size;
+        size_t capacity;  // blocks in all the slabs
+        size_t in_use;    // neither in the shared free list nor in a thread cache
+    };
+
+    BlockPool(const char* name, size_t size, size_t alignment);
+    // Every thread that used the pool must have exited (or the pool is static and destroyed after the thread_local caches)
+    ~BlockPool();
+    BlockPool(const BlockPool&) = delete;
+    BlockPool& operator=(const BlockPool&) = delete;
+
+    void* Allocate();
+    void Free(void* block);
+
+    Stats GetStats() const;
+
+  private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    // Free blocks of one thread
+    class ThreadCache {
+      public:
+        explicit ThreadCache(BlockPool& pool);
+        ~ThreadCache();
+        ThreadCache(const ThreadCache&) = delete;
+        ThreadCache& operator=(const ThreadCache&) = delete;
+
+        BlockPool& pool;
+        FreeBlock* head = nullptr;
+        // Only written by the owning thread, read by GetStats()
+        std::atomic<uint32_t> count{0};
+    };
+
+    ThreadCache& GetThreadCache();
+    void Refill(ThreadCache& cache);
+    void Drain(ThreadCache& cache, uint32_t keep);
+    void AddSlab();
+
+    const char* const name_;
+    const size_t block_size_;
+    const size_t alignment_;
+    // Position of the cache of this pool in the per thread cache arrays
+    const uint32_t index_;
+
+    mutable std::mutex lock_;
+    FreeBlock* free_head_ = nullptr;
+    size_t free_count_ = 0;
+    size_t capacity_ = 0;
+    std::vector<void*> slabs_;
+    std::vector<ThreadCache*> caches_;
+};
+
+// Pools of all the types that went through a PoolAllocator so far
+std::vector<BlockPool::Stats> GetBlockPoolStats();
+// One "name,block size,capacity,in use" row per pool, under a header
+void WriteBlockPoolStatsCsv(std::ostream& out);
+bool WriteBlockPoolStatsCsv(const std::string& path);
+
+namespace internal {
+void RegisterBlockPool(BlockPool* pool);
+
+// One pool per allocated type. Never destroyed, objects can still be freed while other static objects are destroyed
+template <typename T>
+BlockPool& GetBlockPool(const char* name) {
+    static BlockPool* pool = [name]() {
+        auto* new_pool = new BlockPool(name, sizeof(T), alignof(T));
+        RegisterBlockPool(new_pool);
+        return new_pool;
+    }();
+    return *pool;
+}
+}  // namespace internal
+
+// Allocator for std::allocate_shared, the object and the shared_ptr control block are allocated together from the pool of
+// the control block type. |name| is what the pool is reported as (see WriteBlockPoolStatsCsv), it is only used by the first
+// allocation of each type and must be a string literal.
+template <typename T>
+class PoolAllocator {
+  public:
+    using value_type = T;
+
+    explicit PoolAllocator(const char* name) : name_(name) {}
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) : name_(other.Name()) {}
+
+    T* allocate(size_t count) {
+#if !defined(VVL_OBJECT_POOLS_USE_HEAP)
+        if (count == 1) {
+            return static_cast<T*>(internal::GetBlockPool<T>(name_).Allocate());
+        }
+#endif
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(alignof(T))));
+    }
+
+    void deallocate(T* ptr, size_t count) {
+#if !defined(VVL_OBJECT_POOLS_USE_HEAP)
+        if (count == 1) {
+            internal::GetBlockPool<T>(name_).Free(ptr);
+            return;
+        }
+#endif
+        ::operator delete(ptr, std::align_val_t(alignof(T)));
+    }
+
+    const char* Name() const { return name_; }
+
+    // All allocators share the same pools
+    template <typename U>
+    bool operator==(const PoolAllocator<U>&) const {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>&) const {
+        return false;
+    }
+
+  private:
+    const char* name_;
+};
+
+// Drop-in for std::make_shared, for state objects created often enough to be pooled
+template <typename T, typename... Args>
+std::shared_ptr<T> MakePooled(const char* name, Args&&... args) {
+    return std::allocate_shared<T>(PoolAllocator<T>(name), std::forward<Args>(args)...);
+}
+
+}  // namespace vvl
@@ -0,0 +1,114 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+
+#include "containers/small_vector.h"
+
+namespace vvl {
+
+// Fixed size array of default constructed elements.
+//
+// When |paged|, the elements are created a page at a time, the first time an element of the page is accessed through the
+// non-const operator[]. Reading an element of a page that was never created returns a default constructed element, so memory
+// only grows with the elements that are written. Otherwise all the elements are created up front, like in a small_vector.
+//
+// Creating a page is safe with concurrent readers, and with other threads creating the same page.
+template <typename T, uint32_t kPageSize = 64>
+class PagedArray {
+  public:
+    PagedArray(uint32_t size, bool paged) : size_(size) {
+        if (paged) {
+            page_count_ = (size + kPageSize - 1) / kPageSize;
+            pages_ = std::make_unique<std::atomic<T *>[]>(page_count_);
+            for (uint32_t i = 0; i < page_count_; ++i) {
+                pages_[i].store(nullptr, std::memory_order_relaxed);
+            }
+        } else {
+            dense_.resize(size);
+        }
+    }
+    ~PagedArray() {
+        for (uint32_t i = 0; i < page_count_; ++i) {
+            delete[] pages_[i].load(std::memory_order_relaxed);
+        }
+    }
+    PagedArray(const PagedArray &) = delete;
+    PagedArray &operator=(const PagedArray &) = delete;
+
+    uint32_t size() const { return size_; }
+    bool IsPaged() const { return pages_ != nullptr; }
+
+    const T &operator[](uint32_t index) const {
+        assert(index < size_);
+        if (!pages_) {
+            return dense_[index];
+        }
+        const T *page = pages_[index / kPageSize].load(std::memory_order_acquire);
+        return page ? page[index % kPageSize] : Empty();
+    }
+
+    T &operator[](uint32_t index) {
+        assert(index < size_);
+        if (!pages_) {
+            return dense_[index];
+        }
+        auto &slot = pages_[index / kPageSize];
+        T *page = slot.load(std::memory_order_acquire);
+        if (!page) {
+            T *new_page = new T[kPageSize];
+            if (slot.compare_exchange_strong(page, new_page, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                page = new_page;
+            } else {
+                delete[] new_page;
+            }
+        }
+        return page[index % kPageSize];
+    }
+
+    // Number of elements that were created
+    uint32_t CreatedCount() const {
+        if (!pages_) {
+            return size_;
+        }
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < page_count_; ++i) {
+            if (pages_[i].load(std::memory_order_relaxed)) {
+                count += kPageSize;
+            }
+        }
+        return count;
+    }
+
+  private:
+    static const T &Empty() {
+        static const T empty{};
+        return empty;
+    }
+
+    uint32_t size_ = 0;
+    uint32_t page_count_ = 0;
+    std::unique_ptr<std::atomic<T *>[]> pages_;
+    small_vector<T, 1, uint32_t> dense_;
+};
+
+}  // namespace vvl
@@ -29,6 +29,7 @@
 #include <cstdint>
 #include "containers/range.h"
 #include "containers/container_utils.h"
+#include "containers/internal_allocator.h"
 
 #define RANGE_ASSERT(b) assert(b)
 
@@ -67,7 +68,8 @@ Iterator split(Iterator in, Map &map, const Range &range);
 //
 // The range based sparse map implemented on the ImplMap.
 // Implements an ordered map of non-overlapping, non-empty ranges
-template <typename Key, typename T, typename RangeKey = vvl::range<Key>, typename ImplMap = std::map<RangeKey, T>>
+template <typename Key, typename T, typename RangeKey = vvl::range<Key>,
+          typename ImplMap = std::map<RangeKey, T, std::less<RangeKey>, vvl::InternalAllocator<std::pair<const RangeKey, T>>>>
 class range_map {
   public:
   protected:
@@ -625,6 +627,40 @@ class range_map {
         return overwrite_range(lower, value);
     }
 
+    // Same as overwrite_range for each value of [first, last), which must be sorted and must not overlap each other.
+    // Each value starts looking for its lower bound after the previous one, a batch of neighboring ranges (ex: the pages of
+    // a sparse bind) is a single pass over the map instead of a lookup per value.
+    // overwritten_op is called with each entry that is about to be overwritten, and the part of it that is:
+    //     (const value_type &entry, const key_type &overwritten) -> void
+    template <typename Iterator, typename OverwrittenOp>
+    void overwrite_ranges(Iterator first, Iterator last, const OverwrittenOp &overwritten_op) {
+        if (first == last) {
+            return;
+        }
+        auto lower = lower_bound(first->first);
+        for (auto it = first; it != last; ++it) {
+            const key_type &key = it->first;
+            // Skip the entries between the previous value and this one, unless they are too many to be worth walking
+            for (uint32_t step = 0; lower != end() && lower->first.end <= key.begin; ++step) {
+                if (step == 8) {
+                    lower = lower_bound(key);
+                    break;
+                }
+                ++lower;
+            }
+            for (auto overwritten = lower; overwritten != end() && overwritten->first.begin < key.end; ++overwritten) {
+                overwritten_op(*overwritten, overwritten->first & key);
+            }
+            lower = overwrite_range(lower, *it);
+            ++lower;
+        }
+    }
+
+    template <typename Iterator>
+    void overwrite_ranges(Iterator first, Iterator last) {
+        overwrite_ranges(first, last, [](const value_type &, const key_type &) {});
+    }
+
     bool empty() const { return impl_map_.empty(); }
     size_type size() const { return impl_map_.size(); }
 
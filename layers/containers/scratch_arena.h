@@ -0,0 +1,202 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace vvl {
+
+// Thread local bump allocator for data that only lives for the duration of an API call.
+//
+// Memory is handed out from chunks that are kept for the lifetime of the thread, so once the chunks have grown to the size
+// needed by the application no more heap allocations are made. Allocations are released in bulk by rewinding to a Marker,
+// which must happen in LIFO order (this is what ScratchArray does on destruction).
+class ScratchArena {
+  public:
+    static constexpr size_t kMinChunkSize = 64 * 1024;
+
+    struct Marker {
+        size_t chunk = 0;
+        size_t offset = 0;
+    };
+
+    static ScratchArena &Get() {
+        thread_local ScratchArena arena;
+        return arena;
+    }
+
+    void *Allocate(size_t size, size_t alignment) {
+        if (chunks_.empty()) {
+            AddChunk(size + alignment);
+        }
+        while (true) {
+            Chunk &chunk = chunks_[chunk_];
+            const uintptr_t base = reinterpret_cast<uintptr_t>(chunk.data.get());
+            const uintptr_t aligned = (base + offset_ + alignment - 1) & ~(uintptr_t(alignment) - 1);
+            const size_t begin = size_t(aligned - base);
+            if (begin + size <= chunk.size) {
+                offset_ = begin + size;
+                return chunk.data.get() + begin;
+            }
+            // Move on to the next chunk, chunks too small for this request are skipped until the arena is rewound
+            if (chunk_ + 1 == chunks_.size()) {
+                AddChunk(std::max(size + alignment, chunk.size * 2));
+            }
+            ++chunk_;
+            offset_ = 0;
+        }
+    }
+
+    Marker GetMarker() const { return {chunk_, offset_}; }
+
+    // Releases everything allocated after the marker. Rewinding to a marker above the current position is a no-op, which keeps
+    // scopes safe even when they are destroyed in a different order than they allocated.
+    void Rewind(const Marker &marker) {
+        if (marker.chunk < chunk_ || (marker.chunk == chunk_ && marker.offset < offset_)) {
+            chunk_ = marker.chunk;
+            offset_ = marker.offset;
+        }
+    }
+
+  private:
+    struct Chunk {
+        std::unique_ptr<std::byte[]> data;
+        size_t size;
+    };
+
+    void AddChunk(size_t min_size) {
+        const size_t size = std::max(min_size, kMinChunkSize);
+        chunks_.emplace_back(Chunk{std::make_unique<std::byte[]>(size), size});
+    }
+
+    std::vector<Chunk> chunks_;
+    size_t chunk_ = 0;
+    size_t offset_ = 0;
+};
+
+// Array of T allocated from the calling thread's ScratchArena, a drop-in for the temporary small_vector copies made while
+// unwrapping handles. Elements are destroyed and the memory given back to the arena when the array goes out of scope.
+template <typename T>
+class ScratchArray {
+  public:
+    ScratchArray() = default;
+    ScratchArray(const ScratchArray &) = delete;
+    ScratchArray &operator=(const ScratchArray &) = delete;
+    ~ScratchArray() { clear(); }
+
+    void resize(size_t count) {
+        clear();
+        ScratchArena &arena = ScratchArena::Get();
+        marker_ = arena.GetMarker();
+        data_ = static_cast<T *>(arena.Allocate(sizeof(T) * count, alignof(T)));
+        for (size_t i = 0; i < count; ++i) {
+            new (data_ + i) T();
+        }
+        size_ = count;
+    }
+
+    void clear() {
+        if (!data_) {
+            return;
+        }
+        for (size_t i = 0; i < size_; ++i) {
+            data_[i].~T();
+        }
+        ScratchArena::Get().Rewind(marker_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    T *data() { return data_; }
+    const T *data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    T &operator[](size_t i) {
+        assert(i < size_);
+        return data_[i];
+    }
+    const T &operator[](size_t i) const {
+        assert(i < size_);
+        return data_[i];
+    }
+    T *begin() { return data_; }
+    T *end() { return data_ + size_; }
+
+  private:
+    T *data_ = nullptr;
+    size_t size_ = 0;
+    ScratchArena::Marker marker_;
+};
+
+// Gives back to the calling thread's ScratchArena everything allocated from it during the lifetime of the scope.
+// Scopes must be locals, so they end in the reverse order they started.
+class ScratchScope {
+  public:
+    ScratchScope() : marker_(ScratchArena::Get().GetMarker()) {}
+    ScratchScope(const ScratchScope &) = delete;
+    ScratchScope &operator=(const ScratchScope &) = delete;
+    ~ScratchScope() { ScratchArena::Get().Rewind(marker_); }
+
+  private:
+    ScratchArena::Marker marker_;
+};
+
+// STL allocator on the calling thread's ScratchArena. Deallocation does nothing, the memory is reclaimed when the enclosing
+// ScratchScope ends, so containers using it must not outlive that scope (or grow without bound inside it).
+template <typename T>
+class ScratchAllocator {
+  public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    ScratchAllocator() = default;
+    template <typename U>
+    ScratchAllocator(const ScratchAllocator<U> &) {}
+
+    T *allocate(size_t count) { return static_cast<T *>(ScratchArena::Get().Allocate(sizeof(T) * count, alignof(T))); }
+    void deallocate(T *, size_t) {}
+
+    template <typename U>
+    bool operator==(const ScratchAllocator<U> &) const {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const ScratchAllocator<U> &) const {
+        return false;
+    }
+};
+
+// std::vector for the temporaries of a single call, allocated from the calling thread's ScratchArena. It carries its own
+// ScratchScope, so the memory (including the buffers left behind while growing) goes back to the arena with the vector.
+// Like ScratchArray it must be a local, or a member of a local.
+template <typename T>
+class ScratchVector : private ScratchScope, public std::vector<T, ScratchAllocator<T>> {
+  public:
+    ScratchVector() = default;
+    ScratchVector(const ScratchVector &) = delete;
+    ScratchVector &operator=(const ScratchVector &) = delete;
+};
+
+}  // namespace vvl
@@ -0,0 +1,392 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "containers/object_pool.h"
+
+namespace sparse_container {
+
+// Ordered map with the part of the std::map interface that range_map uses, to be its ImplMap.
+//
+// The keys are stored sorted in segments of up to kSegmentSize contiguous keys. A lookup is a binary search over the first key
+// of every segment, then over the keys of one segment, instead of a walk down a tree of nodes. Every value is its own pooled
+// allocation: as with std::map, inserting or erasing an element does not move the others, and leaves their iterators valid. An
+// iterator finds its place again from its key when the map changed since it was created.
+template <typename Key, typename T, uint32_t kSegmentSize = 32>
+class segmented_map {
+    static_assert(kSegmentSize >= 4, "segments must be able to split in half");
+
+  public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using size_type = size_t;
+
+  private:
+    struct Segment {
+        uint32_t count = 0;
+        Key keys[kSegmentSize];
+        value_type *values[kSegmentSize];
+    };
+
+    struct Position {
+        uint32_t segment = 0;
+        uint32_t slot = 0;
+    };
+
+  public:
+    template <bool kConst>
+    class iterator_impl {
+        using Map = std::conditional_t<kConst, const segmented_map, segmented_map>;
+        using Value = std::conditional_t<kConst, const value_type, value_type>;
+
+      public:
+        iterator_impl() = default;
+        // iterator to const_iterator
+        template <bool kOtherConst, typename = std::enable_if_t<kConst && !kOtherConst>>
+        iterator_impl(const iterator_impl<kOtherConst> &other)
+            : map_(other.map_), value_(other.value_), pos_(other.pos_), version_(other.version_) {}
+
+        Value &operator*() const { return *value_; }
+        Value *operator->() const { return value_; }
+
+        // All the iterators on a value are equal, and all the end iterators are equal
+        bool operator==(const iterator_impl &rhs) const { return value_ == rhs.value_; }
+        bool operator!=(const iterator_impl &rhs) const { return value_ != rhs.value_; }
+
+        iterator_impl &operator++() {
+            Set(map_->NextPosition(map_->Locate(value_, pos_, version_)));
+            return *this;
+        }
+        iterator_impl &operator--() {
+            Set(map_->PrevPosition(map_->Locate(value_, pos_, version_)));
+            return *this;
+        }
+
+      private:
+        friend class segmented_map;
+        template <bool>
+        friend class iterator_impl;
+
+        iterator_impl(Map *map, Position pos) : map_(map) { Set(pos); }
+
+        void Set(Position pos) {
+            pos_ = pos;
+            version_ = map_->version_;
+            value_ = map_->ValueAt(pos);
+        }
+
+        Map *map_ = nullptr;
+        // nullptr at end
+        Value *value_ = nullptr;
+        // Only valid while the map is at version_
+        Position pos_;
+        uint64_t version_ = 0;
+    };
+    using iterator = iterator_impl<false>;
+    using const_iterator = iterator_impl<true>;
+
+    segmented_map() = default;
+    segmented_map(const segmented_map &other) { CopyFrom(other); }
+    segmented_map(segmented_map &&other) noexcept { Swap(other); }
+    segmented_map &operator=(const segmented_map &other) {
+        if (this != &other) {
+            clear();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+    segmented_map &operator=(segmented_map &&other) noexcept {
+        if (this != &other) {
+            clear();
+            Swap(other);
+        }
+        return *this;
+    }
+    ~segmented_map() { clear(); }
+
+    iterator begin() { return iterator(this, BeginPosition()); }
+    const_iterator begin() const { return cbegin(); }
+    const_iterator cbegin() const { return const_iterator(this, BeginPosition()); }
+    iterator end() { return iterator(this, EndPosition()); }
+    const_iterator end() const { return cend(); }
+    const_iterator cend() const { return const_iterator(this, EndPosition()); }
+
+    bool empty() const { return size_ == 0; }
+    size_type size() const { return size_; }
+
+    void clear() {
+        for (auto &segment : segments_) {
+            for (uint32_t slot = 0; slot < segment->count; ++slot) {
+                DestroyValue(segment->values[slot]);
+            }
+        }
+        segments_.clear();
+        first_keys_.clear();
+        size_ = 0;
+        ++version_;
+    }
+
+    iterator lower_bound(const Key &key) { return iterator(this, LowerBoundPosition(key)); }
+    const_iterator lower_bound(const Key &key) const { return const_iterator(this, LowerBoundPosition(key)); }
+    iterator upper_bound(const Key &key) { return iterator(this, UpperBoundPosition(key)); }
+    const_iterator upper_bound(const Key &key) const { return const_iterator(this, UpperBoundPosition(key)); }
+    iterator find(const Key &key) { return iterator(this, FindPosition(key)); }
+    const_iterator find(const Key &key) const { return const_iterator(this, FindPosition(key)); }
+
+    // Returns the element after the erased one
+    iterator erase(const_iterator pos) {
+        assert(pos.value_);
+        return iterator(this, EraseAt(Locate(pos.value_, pos.pos_, pos.version_)));
+    }
+
+    // As std::map, inserts just before |hint| when the key belongs there, else where it belongs. Returns the element with the
+    // key, which is not replaced if it was already there.
+    template <typename Value>
+    iterator emplace_hint(const_iterator hint, Value &&value) {
+        value_type *new_value = NewValue(std::forward<Value>(value));
+        Position pos = Locate(hint.value_, hint.pos_, hint.version_);
+        if (!Fits(pos, new_value->first)) {
+            pos = LowerBoundPosition(new_value->first);
+            if (!IsEnd(pos) && !(new_value->first < KeyAt(pos))) {
+                DestroyValue(new_value);
+                return iterator(this, pos);
+            }
+        }
+        return iterator(this, InsertAt(pos, new_value));
+    }
+    iterator insert(const_iterator hint, const value_type &value) { return emplace_hint(hint, value); }
+
+  private:
+    // Values all come from the same slab pool, which is thread safe
+    using Allocator = vvl::PoolAllocator<value_type>;
+    static Allocator GetAllocator() { return Allocator("segmented_map value"); }
+
+    template <typename Value>
+    static value_type *NewValue(Value &&value) {
+        value_type *new_value = GetAllocator().allocate(1);
+        return new (new_value) value_type(std::forward<Value>(value));
+    }
+    static void DestroyValue(value_type *value) {
+        value->~value_type();
+        GetAllocator().deallocate(value, 1);
+    }
+
+    uint32_t SegmentCount() const { return static_cast<uint32_t>(segments_.size()); }
+    Position BeginPosition() const { return Position{}; }
+    Position EndPosition() const { return Position{SegmentCount(), 0}; }
+    bool IsEnd(Position pos) const { return pos.segment == SegmentCount(); }
+    bool IsBegin(Position pos) const { return pos.segment == 0 && pos.slot == 0; }
+    const Key &KeyAt(Position pos) const { return segments_[pos.segment]->keys[pos.slot]; }
+    value_type *ValueAt(Position pos) const { return IsEnd(pos) ? nullptr : segments_[pos.segment]->values[pos.slot]; }
+
+    Position NextPosition(Position pos) const {
+        assert(!IsEnd(pos));
+        if (++pos.slot == segments_[pos.segment]->count) {
+            return Position{pos.segment + 1, 0};
+        }
+        return pos;
+    }
+    Position PrevPosition(Position pos) const {
+        assert(!IsBegin(pos));
+        if (pos.slot == 0) {
+            --pos.segment;
+            return Position{pos.segment, segments_[pos.segment]->count - 1};
+        }
+        --pos.slot;
+        return pos;
+    }
+
+    // Where |value| is now, |pos| is only up to date if the map did not change since |version|
+    Position Locate(const value_type *value, Position pos, uint64_t version) const {
+        if (version == version_) {
+            return pos;
+        }
+        if (!value) {
+            return EndPosition();
+        }
+        pos = LowerBoundPosition(value->first);
+        assert(ValueAt(pos) == value);
+        return pos;
+    }
+
+    // First element for which |before(element key)| is false, when the keys are partitioned by |before|
+    template <typename Before>
+    Position PartitionPosition(const Before &before) const {
+        // The first segment that does not start before, the element is either in the one that precedes it or its first one
+        const auto segment_it = std::partition_point(first_keys_.begin(), first_keys_.end(), before);
+        const uint32_t segment = static_cast<uint32_t>(segment_it - first_keys_.begin());
+        if (segment == 0) {
+            return BeginPosition();
+        }
+        const Segment &prev = *segments_[segment - 1];
+        const uint32_t slot = static_cast<uint32_t>(std::partition_point(prev.keys, prev.keys + prev.count, before) - prev.keys);
+        if (slot < prev.count) {
+            return Position{segment - 1, slot};
+        }
+        return Position{segment, 0};
+    }
+    Position LowerBoundPosition(const Key &key) const {
+        return PartitionPosition([&key](const Key &element) { return element < key; });
+    }
+    Position UpperBoundPosition(const Key &key) const {
+        return PartitionPosition([&key](const Key &element) { return !(key < element); });
+    }
+    Position FindPosition(const Key &key) const {
+        const Position pos = LowerBoundPosition(key);
+        if (!IsEnd(pos) && !(key < KeyAt(pos))) {
+            return pos;
+        }
+        return EndPosition();
+    }
+
+    // Whether |key| can be inserted just before |pos| without breaking the order
+    bool Fits(Position pos, const Key &key) const {
+        if (!IsEnd(pos) && !(key < KeyAt(pos))) {
+            return false;
+        }
+        return IsBegin(pos) || KeyAt(PrevPosition(pos)) < key;
+    }
+
+    Position InsertAt(Position pos, value_type *value) {
+        if (segments_.empty()) {
+            segments_.emplace_back(std::make_unique<Segment>());
+            first_keys_.emplace_back();
+            pos = Position{};
+        } else if (pos.slot == 0 && pos.segment > 0 && segments_[pos.segment - 1]->count < kSegmentSize) {
+            // Appending to the previous segment keeps the segments of a map filled in increasing order full
+            pos = Position{pos.segment - 1, segments_[pos.segment - 1]->count};
+        } else if (IsEnd(pos)) {
+            pos = Position{SegmentCount() - 1, segments_.back()->count};
+        }
+
+        if (segments_[pos.segment]->count == kSegmentSize) {
+            SplitSegment(pos.segment);
+            constexpr uint32_t kLowerCount = kSegmentSize / 2;
+            if (pos.slot > kLowerCount) {
+                pos = Position{pos.segment + 1, pos.slot - kLowerCount};
+            }
+        }
+
+        Segment &segment = *segments_[pos.segment];
+        std::move_backward(segment.keys + pos.slot, segment.keys + segment.count, segment.keys + segment.count + 1);
+        std::move_backward(segment.values + pos.slot, segment.values + segment.count, segment.values + segment.count + 1);
+        segment.keys[pos.slot] = value->first;
+        segment.values[pos.slot] = value;
+        ++segment.count;
+        if (pos.slot == 0) {
+            first_keys_[pos.segment] = value->first;
+        }
+        ++size_;
+        ++version_;
+        return pos;
+    }
+
+    void SplitSegment(uint32_t index) {
+        Segment &lower = *segments_[index];
+        auto upper = std::make_unique<Segment>();
+        constexpr uint32_t kLowerCount = kSegmentSize / 2;
+        upper->count = lower.count - kLowerCount;
+        std::copy(lower.keys + kLowerCount, lower.keys + lower.count, upper->keys);
+        std::copy(lower.values + kLowerCount, lower.values + lower.count, upper->values);
+        lower.count = kLowerCount;
+        first_keys_.insert(first_keys_.begin() + index + 1, upper->keys[0]);
+        segments_.insert(segments_.begin() + index + 1, std::move(upper));
+    }
+
+    Position EraseAt(Position pos) {
+        Segment &segment = *segments_[pos.segment];
+        DestroyValue(segment.values[pos.slot]);
+        std::move(segment.keys + pos.slot + 1, segment.keys + segment.count, segment.keys + pos.slot);
+        std::move(segment.values + pos.slot + 1, segment.values + segment.count, segment.values + pos.slot);
+        --segment.count;
+        --size_;
+        ++version_;
+
+        if (segment.count == 0) {
+            segments_.erase(segments_.begin() + pos.segment);
+            first_keys_.erase(first_keys_.begin() + pos.segment);
+            return Position{pos.segment, 0};
+        }
+        if (pos.slot == 0) {
+            first_keys_[pos.segment] = segment.keys[0];
+        }
+        // Merge with the next segment when both are mostly empty, so that erasing does not leave many small segments
+        const uint32_t next = pos.segment + 1;
+        if (next < SegmentCount() && segment.count + segments_[next]->count <= kSegmentSize / 2) {
+            const Segment &next_segment = *segments_[next];
+            std::copy(next_segment.keys, next_segment.keys + next_segment.count, segment.keys + segment.count);
+            std::copy(next_segment.values, next_segment.values + next_segment.count, segment.values + segment.count);
+            segment.count += next_segment.count;
+            segments_.erase(segments_.begin() + next);
+            first_keys_.erase(first_keys_.begin() + next);
+        }
+        if (pos.slot == segment.count) {
+            return Position{next, 0};
+        }
+        return pos;
+    }
+
+    void CopyFrom(const segmented_map &other) {
+        // Leave room in every segment, so that the first inserts in the copy do not all split segments
+        constexpr uint32_t kCopyCount = kSegmentSize - kSegmentSize / 4;
+        segments_.reserve((other.size_ + kCopyCount - 1) / kCopyCount);
+        first_keys_.reserve(segments_.capacity());
+        for (const auto &other_segment : other.segments_) {
+            for (uint32_t slot = 0; slot < other_segment->count; ++slot) {
+                if (segments_.empty() || segments_.back()->count == kCopyCount) {
+                    segments_.emplace_back(std::make_unique<Segment>());
+                    first_keys_.emplace_back(other_segment->keys[slot]);
+                }
+                Segment &segment = *segments_.back();
+                segment.keys[segment.count] = other_segment->keys[slot];
+                segment.values[segment.count] = NewValue(*other_segment->values[slot]);
+                ++segment.count;
+            }
+        }
+        size_ = other.size_;
+        ++version_;
+    }
+
+    void Swap(segmented_map &other) {
+        segments_.swap(other.segments_);
+        first_keys_.swap(other.first_keys_);
+        std::swap(size_, other.size_);
+        // Iterators created before do not know which map they belong to now
+        ++version_;
+        ++other.version_;
+    }
+
+    std::vector<std::unique_ptr<Segment>> segments_;
+    // Copy of the first key of every segment, searched without touching the segments
+    std::vector<Key> first_keys_;
+    size_t size_ = 0;
+    // Changed by every insert and erase, to know when the positions held by iterators are out of date
+    uint64_t version_ = 0;
+};
+
+}  // namespace sparse_container
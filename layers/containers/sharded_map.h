@@ -0,0 +1,216 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "utils/lock_utils.h"
+
+namespace vvl {
+
+// Enough shards that threads working on different objects rarely share one, 4 per hardware thread in [4, 256]
+inline uint32_t DefaultShardCount() {
+    static const uint32_t shard_count = []() {
+        const uint32_t wanted = std::clamp(4 * std::thread::hardware_concurrency(), 4u, 256u);
+        uint32_t count = 4;
+        while (count < wanted) {
+            count *= 2;
+        }
+        return count;
+    }();
+    return shard_count;
+}
+
+// Same interface as concurrent_unordered_map, but the number of shards is chosen when the map is created instead of with
+// the BucketsLog2 template parameter. Every shard is a hash map behind a reader/writer lock, on its own cache line: lookups
+// only wait for a writer of the same shard.
+template <typename Key, typename T, typename Hash = vvl::hash<Key>>
+class ShardedMap {
+  public:
+    // Same protocol as the concurrent_unordered_map find() result, only compares with end()
+    class FindResult {
+      public:
+        FindResult(bool found, T value) : result_(found, std::move(value)) {}
+        bool operator==(const FindResult &other) const { return !result_.first && !other.result_.first; }
+        bool operator!=(const FindResult &other) const { return !(*this == other); }
+        std::pair<bool, T> *operator->() { return &result_; }
+        const std::pair<bool, T> *operator->() const { return &result_; }
+
+      private:
+        std::pair<bool, T> result_;
+    };
+
+    // |shard_count| is rounded up to a power of two, 0 picks DefaultShardCount()
+    explicit ShardedMap(uint32_t shard_count = 0) {
+        uint32_t count = 1;
+        const uint32_t wanted = shard_count ? shard_count : DefaultShardCount();
+        while (count < wanted) {
+            count *= 2;
+            ++shift_bits_;
+        }
+        shift_bits_ = 64 - shift_bits_;
+        shard_count_ = count;
+        shards_ = std::make_unique<Shard[]>(count);
+    }
+    ShardedMap(const ShardedMap &) = delete;
+    ShardedMap &operator=(const ShardedMap &) = delete;
+
+    uint32_t ShardCount() const { return shard_count_; }
+
+    // Returns false when an existing value was replaced
+    template <typename V>
+    bool insert_or_assign(const Key &key, V &&value) {
+        Shard &shard = GetShard(key);
+        WriteLockGuard lock(shard.lock);
+        auto result = shard.map.insert_or_assign(key, std::forward<V>(value));
+        if (result.second) {
+            size_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return result.second;
+    }
+
+    template <typename V>
+    bool insert(const Key &key, V &&value) {
+        Shard &shard = GetShard(key);
+        WriteLockGuard lock(shard.lock);
+        const bool inserted = shard.map.emplace(key, std::forward<V>(value)).second;
+        if (inserted) {
+            size_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return inserted;
+    }
+
+    bool contains(const Key &key) const {
+        const Shard &shard = GetShard(key);
+        ReadLockGuard lock(shard.lock);
+        return shard.map.find(key) != shard.map.end();
+    }
+
+    FindResult find(const Key &key) const {
+        const Shard &shard = GetShard(key);
+        ReadLockGuard lock(shard.lock);
+        auto it = shard.map.find(key);
+        if (it == shard.map.end()) {
+            return end();
+        }
+        return FindResult(true, it->second);
+    }
+
+    // Removes the entry, returning its value
+    FindResult pop(const Key &key) {
+        Shard &shard = GetShard(key);
+        WriteLockGuard lock(shard.lock);
+        auto it = shard.map.find(key);
+        if (it == shard.map.end()) {
+            return end();
+        }
+        FindResult result(true, std::move(it->second));
+        shard.map.erase(it);
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        return result;
+    }
+
+    void erase(const Key &key) {
+        Shard &shard = GetShard(key);
+        WriteLockGuard lock(shard.lock);
+        if (shard.map.erase(key)) {
+            size_.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Removes every entry for which pred(key, value) is true, one shard locked at a time
+    template <typename Pred>
+    size_t erase_if(Pred &&pred) {
+        size_t erased = 0;
+        for (uint32_t i = 0; i < shard_count_; ++i) {
+            WriteLockGuard lock(shards_[i].lock);
+            Map &map = shards_[i].map;
+            for (auto it = map.begin(); it != map.end();) {
+                if (pred(it->first, it->second)) {
+                    it = map.erase(it);
+                    ++erased;
+                } else {
+                    ++it;
+                }
+            }
+        }
+        size_.fetch_sub(erased, std::memory_order_relaxed);
+        return erased;
+    }
+
+    FindResult end() const { return FindResult(false, T()); }
+
+    // Without locking any shard, exact when no other thread is modifying the map
+    size_t size() const { return size_.load(std::memory_order_relaxed); }
+    bool empty() const { return size() == 0; }
+
+    void clear() {
+        for (uint32_t i = 0; i < shard_count_; ++i) {
+            // The values are destroyed after the lock is released, they can own objects stored in other maps
+            Map released;
+            {
+                WriteLockGuard lock(shards_[i].lock);
+                released.swap(shards_[i].map);
+                size_.fetch_sub(released.size(), std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::vector<std::pair<Key, T>> snapshot() const {
+        std::vector<std::pair<Key, T>> entries;
+        for (uint32_t i = 0; i < shard_count_; ++i) {
+            ReadLockGuard lock(shards_[i].lock);
+            for (const auto &entry : shards_[i].map) {
+                entries.emplace_back(entry.first, entry.second);
+            }
+        }
+        return entries;
+    }
+
+  private:
+    using Map = vvl::unordered_map<Key, T, Hash>;
+
+    struct alignas(64) Shard {
+        mutable std::shared_mutex lock;
+        Map map;
+    };
+
+    // Handles are often sequential or aligned, the top bits of a multiplicative hash spread them over the shards
+    uint32_t ShardIndex(const Key &key) const {
+        const uint64_t hash = static_cast<uint64_t>(Hash()(key)) * 0x9E3779B97F4A7C15ull;
+        return shift_bits_ == 64 ? 0 : static_cast<uint32_t>(hash >> shift_bits_);
+    }
+    Shard &GetShard(const Key &key) { return shards_[ShardIndex(key)]; }
+    const Shard &GetShard(const Key &key) const { return shards_[ShardIndex(key)]; }
+
+    uint32_t shift_bits_ = 0;
+    uint32_t shard_count_ = 0;
+    std::unique_ptr<Shard[]> shards_;
+    // Only written by writers, kept away from the members that every lookup reads
+    alignas(64) std::atomic<size_t> size_{0};
+};
+
+}  // namespace vvl
@@ -21,10 +21,14 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <iterator>
 #include <limits>
 #include <type_traits>
 #include <utility>
 
+#include "containers/internal_allocator.h"
+
 // A vector class with "small string optimization" -- meaning that the class contains a fixed working store for N elements.
 // Useful in in situations where the needed size is unknown, but the typical size is known  If size increases beyond the
 // fixed capacity, a dynamically allocated working store is created.
@@ -33,6 +37,8 @@
 //       MoveAssignable and MoveConstructable
 // NOTE: Unlike std::vector, iterators are invalidated by move assignment between small_vector objects effectively the
 //       "small string" allocation functions as an incompatible allocator.
+// NOTE: Like std::vector, reserve allocates exactly what is asked for, while emplace_back and append grow geometrically.
+//       Trivially copyable elements are copied and relocated with memcpy.
 template <typename T, size_t N, typename SizeType = uint32_t>
 class small_vector {
   public:
@@ -47,6 +53,7 @@ class small_vector {
     static const size_type kSmallCapacity = N;
     static const size_type kMaxCapacity = std::numeric_limits<size_type>::max();
     static_assert(N <= kMaxCapacity, "size must be less than size_type::max");
+    static constexpr bool kTriviallyCopyable = std::is_trivially_copyable_v<T>;
 
     small_vector() : size_(0), capacity_(N), working_store_(GetSmallStore()) {}
 
@@ -77,7 +84,7 @@ class small_vector {
 
     ~small_vector() {
         clear();
-        delete[] large_store_;
+        vvl::FreeInternal(large_store_);
     }
 
     bool operator==(const small_vector &rhs) const {
@@ -105,6 +112,11 @@ class small_vector {
                 // The copy will fit into the current allocation
                 auto dest = GetWorkingStore();
                 auto source = other.GetWorkingStore();
+                if constexpr (kTriviallyCopyable) {
+                    CopyElements(dest, source, other.size_);
+                    size_ = other.size_;
+                    return *this;
+                }
 
                 const auto overlap = std::min(size_, other.size_);
                 // Copy assign anywhere we have objects in this
@@ -201,52 +213,91 @@ class small_vector {
     template <class... Args>
     void emplace_back(Args &&...args) {
         assert(size_ < kMaxCapacity);
-        reserve(size_ + 1);
-        new (GetWorkingStore() + size_) value_type(args...);
+        if (size_ == capacity_) {
+            Grow(size_ + 1);
+        }
+        new (GetWorkingStore() + size_) value_type(std::forward<Args>(args)...);
         size_++;
     }
 
     // Note: probably should update this to reflect C++23 ranges
     template <typename Container>
     void PushBackFrom(const Container &from) {
-        assert(from.size() <= kMaxCapacity);
-        assert(size_ <= kMaxCapacity - from.size());
-        const size_type new_size = size_ + static_cast<size_type>(from.size());
-        reserve(new_size);
-
-        auto dest = GetWorkingStore() + size_;
-        for (const auto &element : from) {
-            new (dest) value_type(element);
-            ++dest;
+        if constexpr (IsContiguousOf<const Container>()) {
+            append(std::data(from), std::data(from) + std::size(from));
+        } else {
+            append(std::begin(from), std::end(from));
         }
-        size_ = new_size;
     }
 
-    template <typename Container>
+    template <typename Container, typename = std::enable_if_t<!std::is_lvalue_reference_v<Container>>>
     void PushBackFrom(Container &&from) {
-        assert(from.size() < kMaxCapacity);
-        const size_type new_size = size_ + static_cast<size_type>(from.size());
-        reserve(new_size);
+        append(std::make_move_iterator(std::begin(from)), std::make_move_iterator(std::end(from)));
+    }
 
+    // Appends [first, last), which must not be part of this vector. Forward iterators only, the count is taken before copying
+    template <typename ForwardIt>
+    void append(ForwardIt first, ForwardIt last) {
+        const auto count = std::distance(first, last);
+        assert(count >= 0 && size_t(count) <= size_t(kMaxCapacity - size_));
+        const size_type new_size = size_ + static_cast<size_type>(count);
+        if (new_size > capacity_) {
+            // An empty vector, as when constructed or assigned, gets what it needs and no more
+            if (size_ == 0) {
+                reserve(new_size);
+            } else {
+                Grow(new_size);
+            }
+        }
         auto dest = GetWorkingStore() + size_;
-        for (auto &element : from) {
-            new (dest) value_type(std::move(element));
-            ++dest;
+        if constexpr (kTriviallyCopyable && std::is_pointer_v<ForwardIt> &&
+                      std::is_same_v<std::remove_cv_t<std::remove_pointer_t<ForwardIt>>, T>) {
+            CopyElements(dest, first, size_type(count));
+        } else {
+            for (; first != last; ++first, ++dest) {
+                new (dest) value_type(*first);
+            }
         }
         size_ = new_size;
     }
 
+    // Inserts [first, last) before pos, the range must not be part of this vector. Returns the first inserted element
+    template <typename ForwardIt>
+    iterator insert(const_iterator pos, ForwardIt first, ForwardIt last) {
+        assert(pos >= cbegin() && pos <= cend());
+        const size_type index = static_cast<size_type>(pos - cbegin());
+        const size_type old_size = size_;
+        if constexpr (kTriviallyCopyable) {
+            const auto count = static_cast<size_type>(std::distance(first, last));
+            resize_uninitialized(size_ + count);
+            auto store = GetWorkingStore();
+            std::memmove(static_cast<void *>(store + index + count), store + index, (old_size - index) * sizeof(value_type));
+            std::copy(first, last, store + index);
+        } else {
+            // Append, then rotate the new elements in place
+            append(first, last);
+            std::rotate(begin() + index, begin() + old_size, end());
+        }
+        return begin() + index;
+    }
+
+    // Grows or shrinks without initializing the new elements, for trivially copyable elements about to be overwritten (ex: by
+    // a memcpy or a read)
+    void resize_uninitialized(size_type count) {
+        static_assert(kTriviallyCopyable, "new elements would be used without being constructed");
+        if (count > capacity_) {
+            Grow(count);
+        }
+        size_ = count;
+    }
+
     void reserve(size_type new_cap) {
         // Since this can't shrink, if we're growing we're newing
         if (new_cap > capacity_) {
             assert(capacity_ >= kSmallCapacity);
-            auto new_store = new BackingStore[new_cap];
-            auto working_store = GetWorkingStore();
-            for (size_type i = 0; i < size_; i++) {
-                new (new_store[i].data) value_type(std::move(working_store[i]));
-                working_store[i].~value_type();
-            }
-            delete[] large_store_;
+            auto new_store = NewLargeStore(new_cap);
+            RelocateElements(&new_store->object, GetWorkingStore(), size_);
+            vvl::FreeInternal(large_store_);
             large_store_ = new_store;
             assert(new_cap > kSmallCapacity);
             capacity_ = new_cap;
@@ -280,7 +331,7 @@ class small_vector {
         if (size_ == 0) {
             // shrink resets to small when empty
             capacity_ = kSmallCapacity;
-            delete[] large_store_;
+            vvl::FreeInternal(large_store_);
             large_store_ = nullptr;
             UpdateWorkingStore();
         } else if ((capacity_ > kSmallCapacity) && (capacity_ > size_)) {
@@ -292,16 +343,12 @@ class small_vector {
             if (size_ < kSmallCapacity) {
                 capacity_ = kSmallCapacity;
             } else {
-                large_store_ = new BackingStore[size_];
+                large_store_ = NewLargeStore(size_);
                 capacity_ = size_;
             }
             UpdateWorkingStore();
-            auto dest = GetWorkingStore();
-            for (size_type i = 0; i < size_; i++) {
-                dest[i] = std::move(source[i]);
-                source[i].~value_type();
-            }
-            delete[] old_store;
+            RelocateElements(GetWorkingStore(), source, size_);
+            vvl::FreeInternal(old_store);
         }
     }
 
@@ -352,6 +399,10 @@ class small_vector {
         uint8_t data[sizeof(value_type)];
         value_type object;
     };
+    // The elements are constructed in place in the data of each BackingStore
+    static BackingStore *NewLargeStore(size_type count) {
+        return static_cast<BackingStore *>(vvl::AllocateInternal(count * sizeof(BackingStore), alignof(BackingStore)));
+    }
     size_type size_ = 0;
     size_type capacity_ = 0;
     BackingStore small_store_[N]{};
@@ -367,11 +418,46 @@ class small_vector {
 #endif
 
   private:
+    // True when Container has data() pointing to value_type, so the elements can be copied in bulk
+    template <typename Container, typename = void>
+    struct HasData : std::false_type {};
+    template <typename Container>
+    struct HasData<Container, std::void_t<decltype(std::data(std::declval<Container &>()))>>
+        : std::is_same<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(std::declval<Container &>()))>>, T> {};
+    template <typename Container>
+    static constexpr bool IsContiguousOf() {
+        return kTriviallyCopyable && HasData<Container>::value;
+    }
+
+    static void CopyElements(pointer dest, const_pointer source, size_type count) {
+        if (count > 0) {
+            std::memcpy(static_cast<void *>(dest), source, count * sizeof(value_type));
+        }
+    }
+
+    // Moves count elements to uninitialized dest, the source elements are destroyed
+    static void RelocateElements(pointer dest, pointer source, size_type count) {
+        if constexpr (kTriviallyCopyable) {
+            CopyElements(dest, source, count);
+        } else {
+            for (size_type i = 0; i < count; i++) {
+                new (dest + i) value_type(std::move(source[i]));
+                source[i].~value_type();
+            }
+        }
+    }
+
+    // Doubles the capacity, or more if min_capacity needs it
+    void Grow(size_type min_capacity) {
+        const size_type doubled = capacity_ > kMaxCapacity / 2 ? kMaxCapacity : size_type(capacity_ * 2);
+        reserve(std::max(min_capacity, doubled));
+    }
+
     void MoveLargeStore(small_vector &other) {
         assert(other.large_store_);
         assert(other.capacity_ > kSmallCapacity);
         // In move operations, from a small vector with a large store, we can move from it
-        delete[] large_store_;
+        vvl::FreeInternal(large_store_);
         large_store_ = other.large_store_;
         other.large_store_ = nullptr;
         capacity_ = other.capacity_;
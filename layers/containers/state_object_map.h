@@ -0,0 +1,466 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "containers/handle_slab.h"
+#include "containers/sharded_map.h"
+#include "utils/cast_utils.h"
+
+namespace vvl {
+
+// Handle to state object map of the state tracker, with the same interface as the concurrent_unordered_map it replaces.
+//
+// Without a HandleSlab this is only a ShardedMap, with enough shards for the number of hardware threads. When handle wrapping is on, every non-dispatchable handle
+// is an id of the HandleSlab used to unwrap it, and the map is given that slab: each entry then gets an index into a chunked
+// array owned by the map, and the index is stored in the aux field of the slab slot of the handle. A lookup is a slab slot
+// load plus an entry load, no hashing and no shard lock. The per entry spin lock is only contended when the same handle is
+// destroyed and used at the same time.
+//
+// Handles that are not live ids of the slab (not expected, but the state tracker should not break on them) are kept in the
+// ShardedMap.
+//
+// In front of both, every thread keeps a small direct mapped cache of its last lookups, shared by the maps with the same value
+// type. The same few handles (pipeline, descriptor sets, render pass) are looked up over and over while recording, a cache hit
+// only touches memory of the calling thread. A cached value is only used while the destroy epoch of its map is the one it was
+// cached with, any pop or replacement of a value makes every thread look the map up again. Clearing or destroying the map
+// drops its values from the caches of all threads, so the values are not kept alive past it.
+template <typename Key, typename T>
+class StateObjectMap {
+  public:
+    // Same protocol as the concurrent_unordered_map find() result, only compares with end()
+    class FindResult {
+      public:
+        FindResult(bool found, T value) : result_(found, std::move(value)) {}
+        bool operator==(const FindResult& other) const { return !result_.first && !other.result_.first; }
+        bool operator!=(const FindResult& other) const { return !(*this == other); }
+        std::pair<bool, T>* operator->() { return &result_; }
+        const std::pair<bool, T>* operator->() const { return &result_; }
+
+      private:
+        std::pair<bool, T> result_;
+    };
+
+    static constexpr uint32_t kFirstSegmentLog2 = 8;
+    static constexpr uint32_t kFirstSegmentSize = 1u << kFirstSegmentLog2;
+    static constexpr uint32_t kMaxSegments = 31 - kFirstSegmentLog2 + 1;
+
+    explicit StateObjectMap(HandleSlab* slab = nullptr) : slab_(slab) {}
+    StateObjectMap(const StateObjectMap&) = delete;
+    StateObjectMap& operator=(const StateObjectMap&) = delete;
+    ~StateObjectMap() {
+        clear();
+        for (auto& segment : segments_) {
+            delete[] segment.load(std::memory_order_relaxed);
+        }
+    }
+
+    void insert_or_assign(const Key& key, T value) {
+        const uint64_t id = CastToUint64(key);
+        if (!slab_ || slab_->Find(id) == 0) {
+            if (!map_.insert_or_assign(key, std::move(value))) {
+                destroy_epoch_.fetch_add(1, std::memory_order_acq_rel);
+            }
+            return;
+        }
+        const uint32_t aux = slab_->FindAux(id);
+        if (aux != 0) {
+            Entry& entry = GetEntry(aux - 1);
+            bool replaced = false;
+            T old_value;
+            {
+                EntryLock lock(entry);
+                if (entry.key == id) {
+                    old_value = std::exchange(entry.value, std::move(value));
+                    replaced = true;
+                }
+            }
+            if (replaced) {
+                destroy_epoch_.fetch_add(1, std::memory_order_acq_rel);
+                return;
+            }
+        }
+        const uint32_t index = AllocateIndex();
+        Entry& entry = GetOrCreateEntry(index);
+        {
+            EntryLock lock(entry);
+            entry.key = id;
+            entry.value = std::move(value);
+        }
+        dense_count_.fetch_add(1, std::memory_order_relaxed);
+        if (!slab_->SetAux(id, index + 1)) {
+            // The handle was erased from the slab in the meantime, nothing will ever look it up
+            ReleaseEntry(index);
+        }
+    }
+
+    FindResult find(const Key& key) const {
+        const uint64_t id = CastToUint64(key);
+        // Read before the lookup, a value popped after it is cached with an epoch that is already stale
+        const uint64_t epoch = destroy_epoch_.load(std::memory_order_acquire);
+        ThreadCache& cache = ThreadCache::Get();
+        CacheSlot& slot = cache.slots[CacheSlotIndex(id)];
+        {
+            CacheLock lock(cache);
+            if (slot.map == this && slot.key == id && slot.epoch == epoch) {
+                return FindResult(true, slot.value);
+            }
+        }
+        FindResult found = FindUncached(key, id);
+        if (found != end()) {
+            T evicted;
+            {
+                CacheLock lock(cache);
+                evicted = std::exchange(slot.value, found->second);
+                slot.map = this;
+                slot.key = id;
+                slot.epoch = epoch;
+            }
+            // Can be the last reference of a destroyed object, released without the cache locked
+        }
+        return found;
+    }
+
+    // Like find(), without taking a reference on a cache hit. The value is only kept alive by the map (or by the EpochReclaimer
+    // its owner retires popped values to), see DeviceState::GetBorrowed()
+    typename T::element_type* find_borrowed(const Key& key) const {
+        const uint64_t id = CastToUint64(key);
+        const uint64_t epoch = destroy_epoch_.load(std::memory_order_acquire);
+        ThreadCache& cache = ThreadCache::Get();
+        const CacheSlot& slot = cache.slots[CacheSlotIndex(id)];
+        {
+            CacheLock lock(cache);
+            if (slot.map == this && slot.key == id && slot.epoch == epoch) {
+                return slot.value.get();
+            }
+        }
+        // Fills the cache, the next lookups of the same handle are hits
+        FindResult found = find(key);
+        return found != end() ? found->second.get() : nullptr;
+    }
+
+  private:
+    FindResult FindUncached(const Key& key, uint64_t id) const {
+        if (slab_) {
+            const uint32_t aux = slab_->FindAux(id);
+            if (aux != 0) {
+                const Entry& entry = GetEntry(aux - 1);
+                EntryLock lock(entry);
+                if (entry.key == id) {
+                    return FindResult(true, entry.value);
+                }
+            }
+            if (map_.empty()) {
+                return end();
+            }
+        }
+        auto found = map_.find(key);
+        if (found == map_.end()) {
+            return end();
+        }
+        return FindResult(true, std::move(found->second));
+    }
+
+  public:
+    // Removes the entry, returning its value
+    FindResult pop(const Key& key) {
+        const uint64_t id = CastToUint64(key);
+        if (slab_) {
+            const uint32_t aux = slab_->FindAux(id);
+            if (aux != 0) {
+                Entry& entry = GetEntry(aux - 1);
+                bool found = false;
+                T value;
+                {
+                    EntryLock lock(entry);
+                    if (entry.key == id) {
+                        found = true;
+                        value = std::move(entry.value);
+                        entry.key = 0;
+                    }
+                }
+                if (found) {
+                    slab_->SetAux(id, 0);
+                    FreeIndex(aux - 1);
+                    destroy_epoch_.fetch_add(1, std::memory_order_acq_rel);
+                    return FindResult(true, std::move(value));
+                }
+            }
+        }
+        auto found = map_.pop(key);
+        if (found == map_.end()) {
+            return end();
+        }
+        destroy_epoch_.fetch_add(1, std::memory_order_acq_rel);
+        return FindResult(true, std::move(found->second));
+    }
+
+    FindResult end() const { return FindResult(false, T()); }
+
+    size_t size() const { return dense_count_.load(std::memory_order_relaxed) + map_.size(); }
+    bool empty() const { return size() == 0; }
+
+    std::vector<std::pair<Key, T>> snapshot() const {
+        std::vector<std::pair<Key, T>> entries;
+        const uint32_t high_water = next_index_.load(std::memory_order_acquire);
+        for (uint32_t index = 0; index < high_water; ++index) {
+            const Entry* entry = FindEntry(index);
+            if (!entry) {
+                continue;
+            }
+            EntryLock lock(*entry);
+            if (entry->key != 0) {
+                entries.emplace_back(CastFromUint64<Key>(entry->key), entry->value);
+            }
+        }
+        for (auto& entry : map_.snapshot()) {
+            entries.emplace_back(entry.first, std::move(entry.second));
+        }
+        return entries;
+    }
+
+    void clear() {
+        // Before anything else, so that the values released below are the last references (ex: a command pool destroys its
+        // command buffers when it goes away)
+        destroy_epoch_.fetch_add(1, std::memory_order_acq_rel);
+        PurgeThreadCaches();
+
+        // The state objects are released after the entries are unlocked, since destroying one can destroy objects stored in
+        // other maps (ex: a descriptor pool and its sets)
+        std::vector<T> released;
+        const uint32_t high_water = next_index_.load(std::memory_order_acquire);
+        for (uint32_t index = 0; index < high_water; ++index) {
+            Entry* entry = const_cast<Entry*>(FindEntry(index));
+            if (!entry) {
+                continue;
+            }
+            uint64_t id = 0;
+            {
+                EntryLock lock(*entry);
+                if (entry->key == 0) {
+                    continue;
+                }
+                id = entry->key;
+                entry->key = 0;
+                released.emplace_back(std::move(entry->value));
+            }
+            slab_->SetAux(id, 0);
+            FreeIndex(index);
+        }
+        map_.clear();
+        released.clear();
+    }
+
+  private:
+    static constexpr uint32_t kThreadCacheSizeLog2 = 5;
+
+    struct CacheSlot {
+        const StateObjectMap* map = nullptr;
+        uint64_t key = 0;
+        uint64_t epoch = 0;
+        T value{};
+    };
+
+    // Only the owning thread uses the slots, except when a map purges its values, so the lock is not contended
+    struct ThreadCache {
+        std::atomic<bool> locked{false};
+        std::array<CacheSlot, 1u << kThreadCacheSizeLog2> slots;
+
+        ThreadCache() {
+            std::lock_guard<std::mutex> guard(RegistryLock());
+            Registry().emplace_back(this);
+        }
+        ~ThreadCache() {
+            // Released here rather than with the slots, destroying a state object can look up others
+            std::vector<T> released;
+            {
+                std::lock_guard<std::mutex> guard(RegistryLock());
+                auto& registry = Registry();
+                registry.erase(std::find(registry.begin(), registry.end(), this));
+                for (CacheSlot& slot : slots) {
+                    released.emplace_back(std::move(slot.value));
+                    slot = CacheSlot();
+                }
+            }
+        }
+
+        static ThreadCache& Get() {
+            thread_local ThreadCache cache;
+            return cache;
+        }
+        // Leaked, the caches of the threads that exit after the static objects are destroyed still unregister
+        static std::mutex& RegistryLock() {
+            static auto* lock = new std::mutex();
+            return *lock;
+        }
+        static std::vector<ThreadCache*>& Registry() {
+            static auto* registry = new std::vector<ThreadCache*>();
+            return *registry;
+        }
+    };
+
+    class CacheLock {
+      public:
+        explicit CacheLock(ThreadCache& cache) : cache_(cache) {
+            while (cache_.locked.exchange(true, std::memory_order_acquire)) {
+                while (cache_.locked.load(std::memory_order_relaxed)) {
+                }
+            }
+        }
+        ~CacheLock() { cache_.locked.store(false, std::memory_order_release); }
+        CacheLock(const CacheLock&) = delete;
+        CacheLock& operator=(const CacheLock&) = delete;
+
+      private:
+        ThreadCache& cache_;
+    };
+
+    uint32_t CacheSlotIndex(uint64_t id) const {
+        const uint64_t hash = (id ^ reinterpret_cast<uintptr_t>(this)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<uint32_t>(hash >> (64 - kThreadCacheSizeLog2));
+    }
+
+    void PurgeThreadCaches() {
+        std::vector<T> released;
+        {
+            std::lock_guard<std::mutex> guard(ThreadCache::RegistryLock());
+            for (ThreadCache* cache : ThreadCache::Registry()) {
+                CacheLock lock(*cache);
+                for (CacheSlot& slot : cache->slots) {
+                    if (slot.map == this) {
+                        released.emplace_back(std::move(slot.value));
+                        slot = CacheSlot();
+                    }
+                }
+            }
+        }
+    }
+
+    struct Entry {
+        mutable std::atomic<bool> locked{false};
+        // 0 when the entry is free, both guarded by the lock
+        uint64_t key = 0;
+        T value;
+    };
+
+    class EntryLock {
+      public:
+        explicit EntryLock(const Entry& entry) : entry_(entry) {
+            while (entry_.locked.exchange(true, std::memory_order_acquire)) {
+                while (entry_.locked.load(std::memory_order_relaxed)) {
+                }
+            }
+        }
+        ~EntryLock() { entry_.locked.store(false, std::memory_order_release); }
+        EntryLock(const EntryLock&) = delete;
+        EntryLock& operator=(const EntryLock&) = delete;
+
+      private:
+        const Entry& entry_;
+    };
+
+    static uint32_t SegmentOf(uint32_t index, uint32_t& offset) {
+        const uint32_t biased = index + kFirstSegmentSize;
+        const uint32_t msb = static_cast<uint32_t>(MostSignificantBit(biased));
+        offset = biased - (1u << msb);
+        return msb - kFirstSegmentLog2;
+    }
+
+    // Only for indices that were handed out, their segment exists and was published before the index was
+    const Entry& GetEntry(uint32_t index) const {
+        uint32_t offset = 0;
+        const uint32_t segment_index = SegmentOf(index, offset);
+        const Entry* segment = segments_[segment_index].load(std::memory_order_acquire);
+        assert(segment);
+        return segment[offset];
+    }
+    Entry& GetEntry(uint32_t index) { return const_cast<Entry&>(static_cast<const StateObjectMap*>(this)->GetEntry(index)); }
+
+    const Entry* FindEntry(uint32_t index) const {
+        uint32_t offset = 0;
+        const uint32_t segment_index = SegmentOf(index, offset);
+        const Entry* segment = segments_[segment_index].load(std::memory_order_acquire);
+        return segment ? &segment[offset] : nullptr;
+    }
+
+    Entry& GetOrCreateEntry(uint32_t index) {
+        uint32_t offset = 0;
+        const uint32_t segment_index = SegmentOf(index, offset);
+        std::atomic<Entry*>& segment_ptr = segments_[segment_index];
+        Entry* segment = segment_ptr.load(std::memory_order_acquire);
+        if (!segment) {
+            Entry* new_segment = new Entry[size_t(kFirstSegmentSize) << segment_index];
+            if (segment_ptr.compare_exchange_strong(segment, new_segment, std::memory_order_acq_rel)) {
+                segment = new_segment;
+            } else {
+                delete[] new_segment;
+            }
+        }
+        return segment[offset];
+    }
+
+    // Creating and destroying objects is rare compared to looking them up, a plain lock is enough here
+    uint32_t AllocateIndex() {
+        std::lock_guard<std::mutex> guard(free_lock_);
+        if (!free_indices_.empty()) {
+            const uint32_t index = free_indices_.back();
+            free_indices_.pop_back();
+            return index;
+        }
+        return next_index_.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    void FreeIndex(uint32_t index) {
+        dense_count_.fetch_sub(1, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> guard(free_lock_);
+        free_indices_.emplace_back(index);
+    }
+
+    void ReleaseEntry(uint32_t index) {
+        Entry& entry = GetEntry(index);
+        T value;
+        {
+            EntryLock lock(entry);
+            entry.key = 0;
+            value = std::move(entry.value);
+        }
+        FreeIndex(index);
+    }
+
+    HandleSlab* const slab_;
+    ShardedMap<Key, T> map_;
+    // Bumped whenever a value is popped or replaced, see ThreadCache
+    alignas(64) std::atomic<uint64_t> destroy_epoch_{0};
+
+    std::array<std::atomic<Entry*>, kMaxSegments> segments_{};
+    std::atomic<uint32_t> next_index_{0};
+    std::atomic<size_t> dense_count_{0};
+    std::mutex free_lock_;
+    std::vector<uint32_t> free_indices_;
+};
+
+}  // namespace vvl
@@ -692,6 +692,14 @@ class BothRangeMap {
         }
     }
 
+    void clear() {
+        if (UsesSmallMap()) {
+            GetSmallMap().clear();
+        } else {
+            GetBigMap().clear();
+        }
+    }
+
     bool UsesSmallMap() const { return std::holds_alternative<SmallMap>(map_); }
 
   private:
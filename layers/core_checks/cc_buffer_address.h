@@ -80,12 +80,22 @@ class BufferAddressValidation {
 
     [[nodiscard]] bool ValidateDeviceAddress(const CoreChecks& validator, const Location& device_address_loc,
                                              const LogObjectList& objlist, VkDeviceAddress device_address) noexcept {
-        bool skip = false;
         // Assumes the caller checks if the device_address can be null or not
+        if (device_address == 0) {
+            return false;
+        }
+        auto buffer_list = validator.GetBuffersByAddress(device_address);
+        return ValidateDeviceAddress(validator, device_address_loc, objlist, device_address, buffer_list);
+    }
+
+    // Same as above, for a caller that already looked up the buffers at device_address
+    [[nodiscard]] bool ValidateDeviceAddress(const CoreChecks& validator, const Location& device_address_loc,
+                                             const LogObjectList& objlist, VkDeviceAddress device_address,
+                                             vvl::span<vvl::Buffer* const> buffer_list) noexcept {
+        bool skip = false;
         if (device_address == 0) {
             return skip;
         }
-        vvl::span<vvl::Buffer* const> buffer_list = validator.GetBuffersByAddress(device_address);
         if (buffer_list.empty()) {
             skip |= validator.LogError(
                 "VUID-VkDeviceAddress-size-11364", objlist, device_address_loc,
@@ -260,6 +260,90 @@ bool CoreChecks::ValidateDynamicStateIsSet(const LastBound& last_bound_state, co
     return false;
 }
 
+// Needs to stay a superset of what ValidateGraphicsDynamicStateSetStatus checks for shader objects, only the conditions known when
+// the device is created are applied here
+CBDynamicFlags CoreChecks::GetShaderObjectDynamicStatesChecked() const {
+    CBDynamicFlags states;
+    for (CBDynamicState state : {CB_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE,
+                                 CB_DYNAMIC_STATE_CULL_MODE,
+                                 CB_DYNAMIC_STATE_DEPTH_TEST_ENABLE,
+                                 CB_DYNAMIC_STATE_STENCIL_TEST_ENABLE,
+                                 CB_DYNAMIC_STATE_DEPTH_BIAS_ENABLE,
+                                 CB_DYNAMIC_STATE_POLYGON_MODE_EXT,
+                                 CB_DYNAMIC_STATE_RASTERIZATION_SAMPLES_EXT,
+                                 CB_DYNAMIC_STATE_SAMPLE_MASK_EXT,
+                                 CB_DYNAMIC_STATE_DEPTH_COMPARE_OP,
+                                 CB_DYNAMIC_STATE_DEPTH_WRITE_ENABLE,
+                                 CB_DYNAMIC_STATE_DEPTH_BIAS,
+                                 CB_DYNAMIC_STATE_DEPTH_BOUNDS,
+                                 CB_DYNAMIC_STATE_STENCIL_COMPARE_MASK,
+                                 CB_DYNAMIC_STATE_STENCIL_WRITE_MASK,
+                                 CB_DYNAMIC_STATE_STENCIL_REFERENCE,
+                                 CB_DYNAMIC_STATE_STENCIL_OP,
+                                 CB_DYNAMIC_STATE_FRONT_FACE,
+                                 CB_DYNAMIC_STATE_ALPHA_TO_COVERAGE_ENABLE_EXT,
+                                 CB_DYNAMIC_STATE_LINE_WIDTH,
+                                 CB_DYNAMIC_STATE_LOGIC_OP_EXT,
+                                 CB_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT,
+                                 CB_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT,
+                                 CB_DYNAMIC_STATE_VIEWPORT_WITH_COUNT,
+                                 CB_DYNAMIC_STATE_SCISSOR_WITH_COUNT,
+                                 CB_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY,
+                                 CB_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE,
+                                 CB_DYNAMIC_STATE_VERTEX_INPUT_EXT,
+                                 CB_DYNAMIC_STATE_TESSELLATION_DOMAIN_ORIGIN_EXT,
+                                 CB_DYNAMIC_STATE_PATCH_CONTROL_POINTS_EXT}) {
+        states.set(state);
+    }
+
+    const auto set_if = [&states](bool condition, std::initializer_list<CBDynamicState> list) {
+        if (condition) {
+            for (CBDynamicState state : list) {
+                states.set(state);
+            }
+        }
+    };
+    const bool stippled_lines = enabled_features.stippledRectangularLines || enabled_features.stippledBresenhamLines ||
+                                enabled_features.stippledSmoothLines;
+
+    set_if(enabled_features.depthBounds, {CB_DYNAMIC_STATE_DEPTH_BOUNDS_TEST_ENABLE});
+    set_if(IsExtEnabled(extensions.vk_ext_sample_locations),
+           {CB_DYNAMIC_STATE_SAMPLE_LOCATIONS_ENABLE_EXT, CB_DYNAMIC_STATE_SAMPLE_LOCATIONS_EXT});
+    set_if(enabled_features.depthClipEnable, {CB_DYNAMIC_STATE_DEPTH_CLIP_ENABLE_EXT});
+    set_if(enabled_features.depthClipControl, {CB_DYNAMIC_STATE_DEPTH_CLIP_NEGATIVE_ONE_TO_ONE_EXT});
+    set_if(enabled_features.depthClampControl, {CB_DYNAMIC_STATE_DEPTH_CLAMP_RANGE_EXT});
+    set_if(enabled_features.depthClamp, {CB_DYNAMIC_STATE_DEPTH_CLAMP_ENABLE_EXT});
+    set_if(enabled_features.alphaToOne, {CB_DYNAMIC_STATE_ALPHA_TO_ONE_ENABLE_EXT});
+    set_if(IsExtEnabled(extensions.vk_ext_conservative_rasterization),
+           {CB_DYNAMIC_STATE_CONSERVATIVE_RASTERIZATION_MODE_EXT, CB_DYNAMIC_STATE_EXTRA_PRIMITIVE_OVERESTIMATION_SIZE_EXT});
+    set_if(IsExtEnabled(extensions.vk_nv_fragment_coverage_to_color),
+           {CB_DYNAMIC_STATE_COVERAGE_TO_COLOR_ENABLE_NV, CB_DYNAMIC_STATE_COVERAGE_TO_COLOR_LOCATION_NV});
+    set_if(enabled_features.shadingRateImage,
+           {CB_DYNAMIC_STATE_SHADING_RATE_IMAGE_ENABLE_NV, CB_DYNAMIC_STATE_VIEWPORT_COARSE_SAMPLE_ORDER_NV,
+            CB_DYNAMIC_STATE_VIEWPORT_SHADING_RATE_PALETTE_NV});
+    set_if(enabled_features.representativeFragmentTest, {CB_DYNAMIC_STATE_REPRESENTATIVE_FRAGMENT_TEST_ENABLE_NV});
+    set_if(enabled_features.coverageReductionMode, {CB_DYNAMIC_STATE_COVERAGE_REDUCTION_MODE_NV});
+    set_if(IsExtEnabled(extensions.vk_nv_framebuffer_mixed_samples),
+           {CB_DYNAMIC_STATE_COVERAGE_MODULATION_MODE_NV, CB_DYNAMIC_STATE_COVERAGE_MODULATION_TABLE_ENABLE_NV,
+            CB_DYNAMIC_STATE_COVERAGE_MODULATION_TABLE_NV});
+    set_if(IsExtEnabled(extensions.vk_ext_discard_rectangles),
+           {CB_DYNAMIC_STATE_DISCARD_RECTANGLE_ENABLE_EXT, CB_DYNAMIC_STATE_DISCARD_RECTANGLE_MODE_EXT});
+    set_if(stippled_lines,
+           {CB_DYNAMIC_STATE_LINE_STIPPLE, CB_DYNAMIC_STATE_LINE_RASTERIZATION_MODE_EXT, CB_DYNAMIC_STATE_LINE_STIPPLE_ENABLE_EXT});
+    set_if(IsExtEnabled(extensions.vk_ext_provoking_vertex), {CB_DYNAMIC_STATE_PROVOKING_VERTEX_MODE_EXT});
+    set_if(enabled_features.logicOp, {CB_DYNAMIC_STATE_LOGIC_OP_ENABLE_EXT});
+    set_if(enabled_features.pipelineFragmentShadingRate, {CB_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR});
+    set_if(enabled_features.attachmentFeedbackLoopDynamicState, {CB_DYNAMIC_STATE_ATTACHMENT_FEEDBACK_LOOP_ENABLE_EXT});
+    set_if(enabled_features.colorWriteEnable, {CB_DYNAMIC_STATE_COLOR_WRITE_ENABLE_EXT});
+    set_if(enabled_features.geometryStreams, {CB_DYNAMIC_STATE_RASTERIZATION_STREAM_EXT});
+    set_if(enabled_features.exclusiveScissor,
+           {CB_DYNAMIC_STATE_EXCLUSIVE_SCISSOR_ENABLE_NV, CB_DYNAMIC_STATE_EXCLUSIVE_SCISSOR_NV});
+    set_if(IsExtEnabled(extensions.vk_nv_clip_space_w_scaling),
+           {CB_DYNAMIC_STATE_VIEWPORT_W_SCALING_ENABLE_NV, CB_DYNAMIC_STATE_VIEWPORT_W_SCALING_NV});
+    set_if(IsExtEnabled(extensions.vk_nv_viewport_swizzle), {CB_DYNAMIC_STATE_VIEWPORT_SWIZZLE_NV});
+    return states;
+}
+
 bool CoreChecks::ValidateGraphicsDynamicStateSetStatus(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const {
     bool skip = false;
     const vvl::CommandBuffer& cb_state = last_bound_state.cb_state;
@@ -281,6 +365,13 @@ bool CoreChecks::ValidateGraphicsDynamicStateSetStatus(const LastBound& last_bou
                           last_bound_state.pipeline_state->dynamic_state))
                      : cb_state.dynamic_state_status.cb;
 
+    // Only the states that can be required, but are not set, need to go through the checks below
+    const CBDynamicFlags& can_be_required =
+        has_pipeline ? last_bound_state.pipeline_state->dynamic_state : shader_object_dynamic_states_checked;
+    if ((can_be_required & ~cb_state.dynamic_state_status.cb).none()) {
+        return skip;
+    }
+
     skip |= ValidateDynamicStateIsSet(last_bound_state, state_status_cb, CB_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE, vuid);
     if (!last_bound_state.IsRasterizationDisabled()) {
         skip |= ValidateDynamicStateIsSet(last_bound_state, state_status_cb, CB_DYNAMIC_STATE_CULL_MODE, vuid);
@@ -1596,7 +1687,7 @@ bool CoreChecks::PreCallValidateCmdSetDepthBias2EXT(VkCommandBuffer commandBuffe
     }
 
     if (const auto *depth_bias_representation = vku::FindStructInPNextChain<VkDepthBiasRepresentationInfoEXT>(pDepthBiasInfo->pNext)) {
-        skip |= ValidateDepthBiasRepresentationInfo(error_obj.location, error_obj.objlist, *depth_bias_representation);
+        skip |= ValidateDepthBiasRepresentationInfo(error_obj.location, error_obj.handle, *depth_bias_representation);
     }
 
     return skip;
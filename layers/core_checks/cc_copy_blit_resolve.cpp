@@ -17,8 +17,10 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
+#include <type_traits>
 #include <sstream>
 #include <vector>
 
@@ -120,38 +122,107 @@ static bool RegionIntersects(const RegionType *region0, const RegionType *region
     return GetRegionIntersection(region0, region1, type, is_multiplane).has_instersection;
 }
 
+// Part of an image read or written by a copy or blit region
+struct RegionBox {
+    uint32_t region;
+    uint32_t mip_level;
+    VkImageAspectFlags aspect_mask;
+    vvl::range<int64_t> layers;
+    vvl::range<int64_t> x;
+    vvl::range<int64_t> y;
+    vvl::range<int64_t> z;
+};
+
+static RegionBox MakeRegionBox(uint32_t region, const VkImageSubresourceLayers &subresource, const VkOffset3D &offset,
+                               int64_t width, int64_t height, int64_t depth) {
+    const int64_t base_layer = subresource.baseArrayLayer;
+    return {region,
+            subresource.mipLevel,
+            subresource.aspectMask,
+            {base_layer, base_layer + static_cast<int64_t>(subresource.layerCount)},
+            {offset.x, offset.x + width},
+            {offset.y, offset.y + height},
+            {offset.z, offset.z + depth}};
+}
+
 template <typename RegionType>
-static bool RegionIntersectsBlit(const RegionType *region0, const RegionType *region1, VkImageType type, bool is_multiplane) {
-    bool result = false;
+static RegionBox MakeCopySrcBox(uint32_t region_index, const RegionType &region) {
+    return MakeRegionBox(region_index, region.srcSubresource, region.srcOffset, region.extent.width, region.extent.height,
+                         region.extent.depth);
+}
+
+template <typename RegionType>
+static RegionBox MakeCopyDstBox(uint32_t region_index, const RegionType &region) {
+    return MakeRegionBox(region_index, region.dstSubresource, region.dstOffset, region.extent.width, region.extent.height,
+                         region.extent.depth);
+}
 
+// Blit offsets can be reversed, the ranges of the box are then empty
+static RegionBox MakeBlitBox(uint32_t region_index, const VkImageSubresourceLayers &subresource, const VkOffset3D offsets[2]) {
+    return MakeRegionBox(region_index, subresource, offsets[0], int64_t(offsets[1].x) - offsets[0].x,
+                         int64_t(offsets[1].y) - offsets[0].y, int64_t(offsets[1].z) - offsets[0].z);
+}
+
+// Unlike vvl::range::intersects(), reversed ranges are empty
+static bool BoxRangesIntersect(const vvl::range<int64_t> &a, const vvl::range<int64_t> &b) {
+    return std::max(a.begin, b.begin) < std::min(a.end, b.end);
+}
+
+// Same test as GetRegionIntersection(), on precomputed boxes
+static bool RegionBoxesIntersect(const RegionBox &src, const RegionBox &dst, VkImageType type, bool is_multiplane) {
     // Separate planes within a multiplane image cannot intersect
-    if (is_multiplane && (region0->srcSubresource.aspectMask != region1->dstSubresource.aspectMask)) {
-        return result;
+    if (is_multiplane && src.aspect_mask != dst.aspect_mask) return false;
+    if (src.mip_level != dst.mip_level || !BoxRangesIntersect(src.layers, dst.layers)) return false;
+    switch (type) {
+        case VK_IMAGE_TYPE_3D:
+            return BoxRangesIntersect(src.x, dst.x) && BoxRangesIntersect(src.y, dst.y) && BoxRangesIntersect(src.z, dst.z);
+        case VK_IMAGE_TYPE_2D:
+            return BoxRangesIntersect(src.x, dst.x) && BoxRangesIntersect(src.y, dst.y);
+        case VK_IMAGE_TYPE_1D:
+            return BoxRangesIntersect(src.x, dst.x);
+        default:
+            // Unrecognized or new IMAGE_TYPE enums will be caught in parameter_validation
+            assert(false);
+            return false;
     }
+}
 
-    if ((region0->srcSubresource.mipLevel == region1->dstSubresource.mipLevel) &&
-        (RangesIntersect(region0->srcSubresource.baseArrayLayer, region0->srcSubresource.layerCount,
-                         region1->dstSubresource.baseArrayLayer, region1->dstSubresource.layerCount))) {
-        result = true;
-        switch (type) {
-            case VK_IMAGE_TYPE_3D:
-                result &= RangesIntersect(region0->srcOffsets[0].z, region0->srcOffsets[1].z - region0->srcOffsets[0].z,
-                                          region1->dstOffsets[0].z, region1->dstOffsets[1].z - region1->dstOffsets[0].z);
-                [[fallthrough]];
-            case VK_IMAGE_TYPE_2D:
-                result &= RangesIntersect(region0->srcOffsets[0].y, region0->srcOffsets[1].y - region0->srcOffsets[0].y,
-                                          region1->dstOffsets[0].y, region1->dstOffsets[1].y - region1->dstOffsets[0].y);
-                [[fallthrough]];
-            case VK_IMAGE_TYPE_1D:
-                result &= RangesIntersect(region0->srcOffsets[0].x, region0->srcOffsets[1].x - region0->srcOffsets[0].x,
-                                          region1->dstOffsets[0].x, region1->dstOffsets[1].x - region1->dstOffsets[0].x);
-                break;
-            default:
-                // Unrecognized or new IMAGE_TYPE enums will be caught in parameter_validation
-                assert(false);
-        }
-    }
-    return result;
+// Returns the (src region, dst region) pairs whose source box intersects the destination box, sorted.
+// Copies with many regions are common (ex: texture streaming), so instead of testing every pair the boxes are swept along x
+// and only the boxes that overlap in x are tested against each other.
+static std::vector<std::pair<uint32_t, uint32_t>> FindRegionOverlaps(std::vector<RegionBox> &src_boxes,
+                                                                     std::vector<RegionBox> &dst_boxes, VkImageType type,
+                                                                     bool is_multiplane) {
+    std::vector<std::pair<uint32_t, uint32_t>> overlaps;
+    auto x_begin_less = [](const RegionBox &a, const RegionBox &b) { return a.x.begin < b.x.begin; };
+    std::sort(src_boxes.begin(), src_boxes.end(), x_begin_less);
+    std::sort(dst_boxes.begin(), dst_boxes.end(), x_begin_less);
+
+    std::vector<const RegionBox *> active_src;
+    std::vector<const RegionBox *> active_dst;
+    auto retire = [](std::vector<const RegionBox *> &active, int64_t x) {
+        active.erase(std::remove_if(active.begin(), active.end(), [x](const RegionBox *box) { return box->x.end <= x; }),
+                     active.end());
+    };
+    auto src_it = src_boxes.cbegin();
+    auto dst_it = dst_boxes.cbegin();
+    while (src_it != src_boxes.cend() || dst_it != dst_boxes.cend()) {
+        const bool next_is_src = dst_it == dst_boxes.cend() || (src_it != src_boxes.cend() && src_it->x.begin <= dst_it->x.begin);
+        const RegionBox &box = next_is_src ? *src_it++ : *dst_it++;
+        if (!box.x.non_empty()) continue;  // Empty boxes intersect nothing
+        auto &other_active = next_is_src ? active_dst : active_src;
+        retire(other_active, box.x.begin);
+        for (const RegionBox *other : other_active) {
+            const RegionBox &src = next_is_src ? box : *other;
+            const RegionBox &dst = next_is_src ? *other : box;
+            if (RegionBoxesIntersect(src, dst, type, is_multiplane)) {
+                overlaps.emplace_back(src.region, dst.region);
+            }
+        }
+        (next_is_src ? active_src : active_dst).emplace_back(&box);
+    }
+    std::sort(overlaps.begin(), overlaps.end());
+    return overlaps;
 }
 
 static inline bool IsExtentEqual(const VkExtent3D &extent, const VkExtent3D &other_extent) {
@@ -815,24 +886,18 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buff
 
         // The union of the source regions, and the union of the destination regions, must not overlap in memory
         if (validate_no_memory_overlaps) {
-            // Sort copy ranges
-            {
-                MemoryRange src_buffer_memory_range(src_binding->memory_offset + region.srcOffset,
-                                                    src_binding->memory_offset + region.srcOffset + region.size);
-                auto insert_pos = std::lower_bound(src_memory_ranges.begin(), src_memory_ranges.end(), src_buffer_memory_range);
-                src_memory_ranges.insert(insert_pos, src_buffer_memory_range);
-            }
-
-            {
-                MemoryRange dst_buffer_memory_range(dst_binding->memory_offset + region.dstOffset,
-                                                    dst_binding->memory_offset + region.dstOffset + region.size);
-                auto insert_pos = std::lower_bound(dst_memory_ranges.begin(), dst_memory_ranges.end(), dst_buffer_memory_range);
-                dst_memory_ranges.insert(insert_pos, dst_buffer_memory_range);
-            }
+            src_memory_ranges.emplace_back(src_binding->memory_offset + region.srcOffset,
+                                           src_binding->memory_offset + region.srcOffset + region.size);
+            dst_memory_ranges.emplace_back(dst_binding->memory_offset + region.dstOffset,
+                                           dst_binding->memory_offset + region.dstOffset + region.size);
         }
     }
 
     if (validate_no_memory_overlaps) {
+        // Sorted once, inserting each range in place is quadratic for copies with many regions
+        std::sort(src_memory_ranges.begin(), src_memory_ranges.end());
+        std::sort(dst_memory_ranges.begin(), dst_memory_ranges.end());
+
         // Memory ranges are sorted, so looking for overlaps can be done in linear time
         auto src_ranges_it = src_memory_ranges.cbegin();
         auto dst_ranges_it = dst_memory_ranges.cbegin();
@@ -881,7 +946,10 @@ bool CoreChecks::ValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer s
     const char *vuid;
 
     skip |= ValidateCmd(cb_state, loc);
-    skip |= ValidateCmdCopyBufferBounds(commandBuffer, *src_buffer_state, *dst_buffer_state, regionCount, pRegions, loc);
+    // Otherwise run at vkEndCommandBuffer, see EnqueueValidateCmdCopyBufferBounds()
+    if (!global_settings.deferred_command_validation) {
+        skip |= ValidateCmdCopyBufferBounds(commandBuffer, *src_buffer_state, *dst_buffer_state, regionCount, pRegions, loc);
+    }
 
     // src buffer
     {
@@ -916,6 +984,41 @@ bool CoreChecks::ValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer s
     return skip;
 }
 
+template <typename RegionType>
+static void EnqueueValidateCmdCopyBufferBoundsImpl(const CoreChecks &validator, core::CommandBufferSubState &cb_sub_state,
+                                                   const vvl::Buffer &src_buffer_state, const vvl::Buffer &dst_buffer_state,
+                                                   uint32_t region_count, const RegionType *regions, const Location &loc) {
+    // The create info and memory binding of the buffers cannot change while they are used by the command buffer
+    auto src_buffer = std::static_pointer_cast<const vvl::Buffer>(src_buffer_state.shared_from_this());
+    auto dst_buffer = std::static_pointer_cast<const vvl::Buffer>(dst_buffer_state.shared_from_this());
+    std::vector<RegionType> region_copies(regions, regions + region_count);
+    for (RegionType &region : region_copies) {
+        if constexpr (std::is_same_v<RegionType, VkBufferCopy2>) {
+            region.pNext = nullptr;
+        }
+    }
+    const VkCommandBuffer command_buffer = cb_sub_state.base.VkHandle();
+    vvl::LocationCapture loc_capture(loc);
+    cb_sub_state.deferred_checks.emplace_back([&validator, command_buffer, src_buffer, dst_buffer,
+                                               region_copies = std::move(region_copies), loc_capture = std::move(loc_capture)]() {
+        validator.ValidateCmdCopyBufferBounds(command_buffer, *src_buffer, *dst_buffer, static_cast<uint32_t>(region_copies.size()),
+                                              region_copies.data(), loc_capture.Get());
+    });
+}
+
+void CoreChecks::EnqueueValidateCmdCopyBufferBounds(core::CommandBufferSubState &cb_sub_state, const vvl::Buffer &src_buffer_state,
+                                                    const vvl::Buffer &dst_buffer_state, uint32_t region_count,
+                                                    const VkBufferCopy *regions, const Location &loc) {
+    EnqueueValidateCmdCopyBufferBoundsImpl(*this, cb_sub_state, src_buffer_state, dst_buffer_state, region_count, regions, loc);
+}
+
+void CoreChecks::EnqueueValidateCmdCopyBufferBounds(core::CommandBufferSubState &cb_sub_state, const vvl::Buffer &src_buffer_state,
+                                                    const vvl::Buffer &dst_buffer_state, uint32_t region_count,
+                                                    const VkBufferCopy2 *regions, const Location &loc) {
+    EnqueueValidateCmdCopyBufferBoundsImpl(*this, cb_sub_state, src_buffer_state, dst_buffer_state, region_count, regions,
+                                           loc.dot(Field::pCopyBufferInfo));
+}
+
 bool CoreChecks::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
                                               uint32_t regionCount, const VkBufferCopy *pRegions,
                                               const ErrorObject &error_obj) const {
@@ -1715,24 +1818,6 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
             }
         }
 
-        // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
-        // must not overlap in memory
-        // Validation is only performed when source image is the same as destination image.
-        // In the general case, the mapping between an image and its underlying memory is undefined,
-        // so checking for memory overlaps is not possible.
-        if (srcImage == dstImage) {
-            for (uint32_t j = 0; j < regionCount; j++) {
-                if (auto intersection = GetRegionIntersection(pRegions[i], pRegions[j], src_image_type, is_src_multiplane);
-                    intersection.has_instersection) {
-                    vuid = is_2 ? "VUID-VkCopyImageInfo2-pRegions-00124" : "VUID-vkCmdCopyImage-pRegions-00124";
-                    skip |= LogError(vuid, all_objlist, loc,
-                                     "pRegion[%" PRIu32 "] copy source overlaps with pRegions[%" PRIu32
-                                     "] copy destination. Overlap info, with respect to image (%s):%s",
-                                     i, j, FormatHandle(srcImage).c_str(), intersection.String().c_str());
-                }
-            }
-        }
-
         // track aspect mask in loop through regions
         if ((src_aspect & VK_IMAGE_ASPECT_STENCIL_BIT) != 0) {
             has_stencil_aspect = true;
@@ -1789,6 +1874,31 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
         skip |= ValidateCopyImageRegionCommon(commandBuffer, region, region_loc);
     }
 
+    // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
+    // must not overlap in memory
+    // Validation is only performed when source image is the same as destination image.
+    // In the general case, the mapping between an image and its underlying memory is undefined,
+    // so checking for memory overlaps is not possible.
+    if (srcImage == dstImage) {
+        const bool is_src_multiplane = vkuFormatIsMultiplane(src_format);
+        std::vector<RegionBox> src_boxes;
+        std::vector<RegionBox> dst_boxes;
+        src_boxes.reserve(regionCount);
+        dst_boxes.reserve(regionCount);
+        for (uint32_t i = 0; i < regionCount; i++) {
+            src_boxes.emplace_back(MakeCopySrcBox(i, pRegions[i]));
+            dst_boxes.emplace_back(MakeCopyDstBox(i, pRegions[i]));
+        }
+        for (const auto &[i, j] : FindRegionOverlaps(src_boxes, dst_boxes, src_image_type, is_src_multiplane)) {
+            const auto intersection = GetRegionIntersection(pRegions[i], pRegions[j], src_image_type, is_src_multiplane);
+            vuid = is_2 ? "VUID-VkCopyImageInfo2-pRegions-00124" : "VUID-vkCmdCopyImage-pRegions-00124";
+            skip |= LogError(vuid, all_objlist, loc,
+                             "pRegion[%" PRIu32 "] copy source overlaps with pRegions[%" PRIu32
+                             "] copy destination. Overlap info, with respect to image (%s):%s",
+                             i, j, FormatHandle(srcImage).c_str(), intersection.String().c_str());
+        }
+    }
+
     if (vkuFormatIsCompressed(src_format) && vkuFormatIsCompressed(dst_format)) {
         const VkExtent3D src_block_extent = vkuFormatTexelBlockExtent(src_format);
         const VkExtent3D dst_block_extent = vkuFormatTexelBlockExtent(dst_format);
@@ -3100,17 +3210,23 @@ bool CoreChecks::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage src
             }
         }
 
-        // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
-        // must not overlap in memory
-        if (srcImage == dstImage) {
-            for (uint32_t j = 0; j < regionCount; j++) {
-                if (RegionIntersectsBlit(&region, &pRegions[j], src_image_state->create_info.imageType,
-                                         vkuFormatIsMultiplane(src_format))) {
-                    vuid = is_2 ? "VUID-VkBlitImageInfo2-pRegions-00217" : "VUID-vkCmdBlitImage-pRegions-00217";
-                    skip |=
-                        LogError(vuid, all_objlist, loc, "pRegion[%" PRIu32 "] src overlaps with pRegions[%" PRIu32 "] dst.", i, j);
-                }
-            }
+    }
+
+    // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
+    // must not overlap in memory
+    if (srcImage == dstImage) {
+        std::vector<RegionBox> src_boxes;
+        std::vector<RegionBox> dst_boxes;
+        src_boxes.reserve(regionCount);
+        dst_boxes.reserve(regionCount);
+        for (uint32_t i = 0; i < regionCount; i++) {
+            src_boxes.emplace_back(MakeBlitBox(i, pRegions[i].srcSubresource, pRegions[i].srcOffsets));
+            dst_boxes.emplace_back(MakeBlitBox(i, pRegions[i].dstSubresource, pRegions[i].dstOffsets));
+        }
+        for (const auto &[i, j] : FindRegionOverlaps(src_boxes, dst_boxes, src_image_state->create_info.imageType,
+                                                     vkuFormatIsMultiplane(src_format))) {
+            vuid = is_2 ? "VUID-VkBlitImageInfo2-pRegions-00217" : "VUID-vkCmdBlitImage-pRegions-00217";
+            skip |= LogError(vuid, all_objlist, loc, "pRegion[%" PRIu32 "] src overlaps with pRegions[%" PRIu32 "] dst.", i, j);
         }
     }
     return skip;
@@ -843,6 +843,7 @@ bool CoreChecks::PreCallValidateGetDescriptorSetLayoutSupportKHR(VkDevice device
 bool CoreChecks::ValidateDrawState(const vvl::DescriptorSet &descriptor_set, uint32_t set_index,
                                    const BindingVariableMap &binding_req_map, const vvl::CommandBuffer &cb_state,
                                    const vvl::DrawDispatchVuid &vuids, const VulkanTypedHandle &shader_handle) const {
+    VVL_CheckStatsScope(dispatch_device_, "CoreChecks::ValidateDrawState");
     bool result = false;
     const Location &loc = vuids.loc();
     const VkFramebuffer framebuffer = cb_state.active_framebuffer ? cb_state.active_framebuffer->VkHandle() : VK_NULL_HANDLE;
@@ -851,7 +852,7 @@ bool CoreChecks::ValidateDrawState(const vvl::DescriptorSet &descriptor_set, uin
     // non-const versions of its state objects here.
     const vvl::DescriptorValidator desc_val(const_cast<CoreChecks &>(*this), const_cast<vvl::CommandBuffer &>(cb_state),
                                             const_cast<vvl::DescriptorSet &>(descriptor_set), set_index, framebuffer,
-                                            &shader_handle, loc);
+                                            &shader_handle, loc, &descriptor_validation_pool);
 
     for (const auto &[binding_index, desc_set_reqs] : binding_req_map) {
         ASSERT_AND_CONTINUE(desc_set_reqs.variable);
@@ -1435,6 +1436,7 @@ bool CoreChecks::ValidateImageUpdate(const vvl::ImageView &view_state, VkImageLa
 bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t descriptorWriteCount, const VkWriteDescriptorSet *pDescriptorWrites,
                                               uint32_t descriptorCopyCount, const VkCopyDescriptorSet *pDescriptorCopies,
                                               const Location &loc) const {
+    VVL_CheckStatsScope(dispatch_device_, "CoreChecks::ValidateUpdateDescriptorSets");
     bool skip = false;
     // Validate Write updates
     for (uint32_t i = 0; i < descriptorWriteCount; i++) {
@@ -1454,115 +1456,92 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t descriptorWriteCount, con
     return skip;
 }
 
-vvl::DecodedTemplateUpdate::DecodedTemplateUpdate(const vvl::DeviceState &device_data, VkDescriptorSet descriptorSet,
-                                                  const vvl::DescriptorUpdateTemplate &template_state, const void *pData,
-                                                  VkDescriptorSetLayout push_layout) {
-    auto const &create_info = template_state.create_info;
-    inline_infos.resize(create_info.descriptorUpdateEntryCount);  // Make sure we have one if we need it
-    inline_infos_khr.resize(create_info.descriptorUpdateEntryCount);
-    inline_infos_nv.resize(create_info.descriptorUpdateEntryCount);
-    desc_writes.reserve(create_info.descriptorUpdateEntryCount);  // emplaced, so reserved without initialization
-    VkDescriptorSetLayout effective_dsl = create_info.templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET
-                                              ? create_info.descriptorSetLayout
-                                              : push_layout;
-    auto ds_layout_state = device_data.Get<vvl::DescriptorSetLayout>(effective_dsl);
-    if (!ds_layout_state) return;
-
-    // Create a WriteDescriptorSet struct for each template update entry
-    for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
-        const auto &descriptor_update_entry = create_info.pDescriptorUpdateEntries[i];
-        uint32_t binding_count = ds_layout_state->GetDescriptorCountFromBinding(descriptor_update_entry.dstBinding);
-        uint32_t binding_being_updated = descriptor_update_entry.dstBinding;
-        uint32_t dst_array_element = descriptor_update_entry.dstArrayElement;
-
-        desc_writes.reserve(desc_writes.size() + descriptor_update_entry.descriptorCount);
-        for (uint32_t j = 0; j < descriptor_update_entry.descriptorCount; j++) {
-            desc_writes.emplace_back();
-            auto &write_entry = desc_writes.back();
-
-            size_t offset = descriptor_update_entry.offset + j * descriptor_update_entry.stride;
-            char *update_entry = (char *)(pData) + offset;
-
-            if (dst_array_element >= binding_count) {
-                dst_array_element = 0;
-                binding_being_updated = ds_layout_state->GetNextValidBinding(binding_being_updated);
-            }
-
-            write_entry.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-            write_entry.pNext = NULL;
-            write_entry.dstSet = descriptorSet;
-            write_entry.dstBinding = binding_being_updated;
-            write_entry.dstArrayElement = dst_array_element;
-            write_entry.descriptorCount = 1;
-            write_entry.descriptorType = descriptor_update_entry.descriptorType;
+vvl::DecodedTemplateUpdate::DecodedTemplateUpdate(VkDescriptorSet descriptorSet, const vvl::DescriptorUpdateTemplate &template_state,
+                                                  const void *pData, const vvl::DescriptorSetLayout *push_layout) {
+    const auto &plan = template_state.write_plan;
+    if (!push_layout || push_layout->GetLayoutDef() == plan.layout_def.get()) {
+        if (plan.layout_def) {
+            Decode(plan, descriptorSet, pData);
+        }
+    } else {
+        // Push descriptors can use a different, compatible, layout than the one the template was created with
+        Decode(BuildTemplateWritePlan(*push_layout, template_state.create_info), descriptorSet, pData);
+    }
+}
 
-            switch (descriptor_update_entry.descriptorType) {
-                case VK_DESCRIPTOR_TYPE_SAMPLER:
-                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
-                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
-                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
-                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
-                    write_entry.pImageInfo = reinterpret_cast<VkDescriptorImageInfo *>(update_entry);
-                    break;
+void vvl::DecodedTemplateUpdate::Decode(const TemplateWritePlan &plan, VkDescriptorSet descriptorSet, const void *pData) {
+    // Sized before taking pointers to the elements
+    inline_infos.resize(plan.inline_uniform_block_count);
+    inline_infos_khr.resize(plan.acceleration_structure_khr_count);
+    inline_infos_nv.resize(plan.acceleration_structure_nv_count);
+    desc_writes.reserve(static_cast<uint32_t>(plan.writes.size()));
+    uint32_t inline_index = 0;
+    uint32_t inline_khr_index = 0;
+    uint32_t inline_nv_index = 0;
+
+    for (const auto &planned_write : plan.writes) {
+        desc_writes.emplace_back();
+        auto &write_entry = desc_writes.back();
+        const char *update_entry = static_cast<const char *>(pData) + planned_write.offset;
+
+        write_entry.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write_entry.pNext = nullptr;
+        write_entry.dstSet = descriptorSet;
+        write_entry.dstBinding = planned_write.dst_binding;
+        write_entry.dstArrayElement = planned_write.dst_array_element;
+        write_entry.descriptorCount = planned_write.descriptor_count;
+        write_entry.descriptorType = planned_write.descriptor_type;
+
+        switch (planned_write.descriptor_type) {
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                write_entry.pImageInfo = reinterpret_cast<const VkDescriptorImageInfo *>(update_entry);
+                break;
 
-                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
-                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
-                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
-                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
-                    write_entry.pBufferInfo = reinterpret_cast<VkDescriptorBufferInfo *>(update_entry);
-                    break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                write_entry.pBufferInfo = reinterpret_cast<const VkDescriptorBufferInfo *>(update_entry);
+                break;
 
-                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
-                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-                    write_entry.pTexelBufferView = reinterpret_cast<VkBufferView *>(update_entry);
-                    break;
-                case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK: {
-                    VkWriteDescriptorSetInlineUniformBlock *inline_info = &inline_infos[i];
-                    inline_info->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT;
-                    inline_info->pNext = nullptr;
-                    inline_info->dataSize = descriptor_update_entry.descriptorCount;
-                    inline_info->pData = update_entry;
-                    write_entry.pNext = inline_info;
-                    // descriptorCount must match the dataSize member of the VkWriteDescriptorSetInlineUniformBlock structure
-                    write_entry.descriptorCount = inline_info->dataSize;
-                    // skip the rest of the array, they just represent bytes in the update
-                    j = descriptor_update_entry.descriptorCount;
-                    break;
-                }
-                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: {
-                    VkWriteDescriptorSetAccelerationStructureKHR *inline_info_khr = &inline_infos_khr[i];
-                    inline_info_khr->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
-                    inline_info_khr->pNext = nullptr;
-                    inline_info_khr->accelerationStructureCount = descriptor_update_entry.descriptorCount;
-                    inline_info_khr->pAccelerationStructures = reinterpret_cast<VkAccelerationStructureKHR *>(update_entry);
-                    write_entry.pNext = inline_info_khr;
-                    // descriptorCount must match the accelerationStructureCount
-                    write_entry.descriptorCount = inline_info_khr->accelerationStructureCount;
-                    break;
-                }
-                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV: {
-                    VkWriteDescriptorSetAccelerationStructureNV *inline_info_nv = &inline_infos_nv[i];
-                    inline_info_nv->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV;
-                    inline_info_nv->pNext = nullptr;
-                    inline_info_nv->accelerationStructureCount = descriptor_update_entry.descriptorCount;
-                    inline_info_nv->pAccelerationStructures = reinterpret_cast<VkAccelerationStructureNV *>(update_entry);
-                    write_entry.pNext = inline_info_nv;
-                    // descriptorCount must match the accelerationStructureCount
-                    write_entry.descriptorCount = inline_info_nv->accelerationStructureCount;
-                    break;
-                }
-                default:
-                    assert(false);
-                    break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                write_entry.pTexelBufferView = reinterpret_cast<const VkBufferView *>(update_entry);
+                break;
+            case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK: {
+                VkWriteDescriptorSetInlineUniformBlock *inline_info = &inline_infos[inline_index++];
+                inline_info->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT;
+                inline_info->pNext = nullptr;
+                inline_info->dataSize = planned_write.descriptor_count;
+                inline_info->pData = update_entry;
+                write_entry.pNext = inline_info;
+                break;
             }
-            dst_array_element++;
-
-            // If acceleration structure, we only create a single VkWriteDescriptorSet and map the actually AS into
-            // VkWriteDescriptorSetAccelerationStructureKHR
-            if (descriptor_update_entry.descriptorType == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR ||
-                descriptor_update_entry.descriptorType == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV) {
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: {
+                VkWriteDescriptorSetAccelerationStructureKHR *inline_info_khr = &inline_infos_khr[inline_khr_index++];
+                inline_info_khr->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
+                inline_info_khr->pNext = nullptr;
+                inline_info_khr->accelerationStructureCount = planned_write.descriptor_count;
+                inline_info_khr->pAccelerationStructures = reinterpret_cast<const VkAccelerationStructureKHR *>(update_entry);
+                write_entry.pNext = inline_info_khr;
+                break;
+            }
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV: {
+                VkWriteDescriptorSetAccelerationStructureNV *inline_info_nv = &inline_infos_nv[inline_nv_index++];
+                inline_info_nv->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV;
+                inline_info_nv->pNext = nullptr;
+                inline_info_nv->accelerationStructureCount = planned_write.descriptor_count;
+                inline_info_nv->pAccelerationStructures = reinterpret_cast<const VkAccelerationStructureNV *>(update_entry);
+                write_entry.pNext = inline_info_nv;
                 break;
             }
+            default:
+                assert(false);
+                break;
         }
     }
 }
@@ -2359,6 +2338,8 @@ bool CoreChecks::ValidateCmdSetDescriptorBufferOffsets(const vvl::CommandBuffer
         return skip;
     }
 
+    const auto &core_cb_state = core::SubState(cb_state);
+    const uint64_t address_ranges_version = device_state->GetBufferAddressRangesVersion();
     for (uint32_t i = 0; i < setCount; i++) {
         const auto set_layout = pipeline_layout->set_layouts[firstSet + i];
         if ((set_layout->GetCreateFlags() & VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT) == 0) {
@@ -2385,9 +2366,9 @@ bool CoreChecks::ValidateCmdSetDescriptorBufferOffsets(const vvl::CommandBuffer
 
         const VkDescriptorBufferBindingInfoEXT &binding_info = cb_state.descriptor_buffer_binding_info[buffer_index];
         const VkDeviceAddress start = binding_info.address;
-        const auto buffer_states = GetBuffersByAddress(start);
+        const vvl::range<VkDeviceAddress> *window = core_cb_state.GetDescriptorBufferWindow(buffer_index, address_ranges_version);
 
-        if (buffer_states.empty()) {
+        if (window ? window->empty() : GetBuffersByAddress(start).empty()) {
             const char *vuid = is_2 ? "VUID-VkSetDescriptorBufferOffsetsInfoEXT-pBufferIndices-08065"
                                     : "VUID-vkCmdSetDescriptorBufferOffsetsEXT-pBufferIndices-08065";
             const LogObjectList objlist(cb_state.Handle(), set_layout->Handle(), pipeline_layout->Handle());
@@ -2404,35 +2385,33 @@ bool CoreChecks::ValidateCmdSetDescriptorBufferOffsets(const vvl::CommandBuffer
             continue;  // is by definition small enough as it is at the start
         }
 
-        bool valid_binding = false;
         VkDeviceSize set_layout_size = set_layout->GetLayoutSizeInBytes();
-        const auto buffer_state_starts = GetBuffersByAddress(start + offset);
-        if (!buffer_state_starts.empty()) {
-            const auto bindings = set_layout->GetBindings();
-
-            if (set_layout_size > 0) {
-                // Variable Descriptor Count can only be in the highest binding (the last binding)
-                const uint32_t last_index = set_layout->GetLastIndex();
-                const VkDescriptorBindingFlags flags = set_layout->GetDescriptorBindingFlagsFromIndex(last_index);
-                if (flags & VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT) {
-                    // If the descriptor set only consists of VARIABLE_DESCRIPTOR_COUNT bindings, the offset may be 0. In
-                    // this case, treat the descriptor set layout as size 1, so we validate that the offset is sensible.
-                    if (set_layout->GetBindingCount() == 1) {
-                        set_layout_size = 1;
-                    } else {
-                        // If a binding is VARIABLE_DESCRIPTOR_COUNT, the effective setLayoutSize we must validate is just
-                        // the offset of the last binding.
-                        const uint32_t binding = set_layout->GetDescriptorSetLayoutBindingPtrFromIndex(last_index)->binding;
-                        DispatchGetDescriptorSetLayoutBindingOffsetEXT(device, set_layout->VkHandle(), binding, &set_layout_size);
-                    }
+        if (set_layout_size > 0) {
+            // Variable Descriptor Count can only be in the highest binding (the last binding)
+            const uint32_t last_index = set_layout->GetLastIndex();
+            const VkDescriptorBindingFlags flags = set_layout->GetDescriptorBindingFlagsFromIndex(last_index);
+            if (flags & VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT) {
+                // If the descriptor set only consists of VARIABLE_DESCRIPTOR_COUNT bindings, the offset may be 0. In
+                // this case, treat the descriptor set layout as size 1, so we validate that the offset is sensible.
+                if (set_layout->GetBindingCount() == 1) {
+                    set_layout_size = 1;
+                } else {
+                    // If a binding is VARIABLE_DESCRIPTOR_COUNT, the effective setLayoutSize we must validate is just
+                    // the offset of the last binding.
+                    const uint32_t binding = set_layout->GetDescriptorSetLayoutBindingPtrFromIndex(last_index)->binding;
+                    DispatchGetDescriptorSetLayoutBindingOffsetEXT(device, set_layout->VkHandle(), binding, &set_layout_size);
                 }
             }
+        }
 
-            if (set_layout_size > 0) {
-                const auto buffer_state_ends = GetBuffersByAddress(start + offset + set_layout_size - 1);
-                if (!buffer_state_ends.empty()) {
-                    valid_binding = true;
-                }
+        bool valid_binding = false;
+        if (set_layout_size > 0) {
+            if (window && start + offset + set_layout_size <= window->end) {
+                // Within the VkBuffer found at the binding address when the descriptor buffers were bound
+                valid_binding = true;
+            } else {
+                valid_binding = !GetBuffersByAddress(start + offset).empty() &&
+                                !GetBuffersByAddress(start + offset + set_layout_size - 1).empty();
             }
         }
 
@@ -2448,7 +2427,7 @@ bool CoreChecks::ValidateCmdSetDescriptorBufferOffsets(const vvl::CommandBuffer
                          " is not within any VkBuffer range.\nThe invalid access is at %s\nThe following are the possible buffer "
                          "ranges it could be at:\n%s",
                          buffer_index, start, i, offset, set_layout_size, vvl::string_range_hex(access_range).c_str(),
-                         PrintBufferRanges(*this, buffer_states).c_str());
+                         PrintBufferRanges(*this, GetBuffersByAddress(start)).c_str());
         }
     }
 
@@ -2752,6 +2731,24 @@ bool CoreChecks::PreCallValidateCmdBindDescriptorBuffersEXT(VkCommandBuffer comm
     return skip;
 }
 
+void CoreChecks::PostCallRecordCmdBindDescriptorBuffersEXT(VkCommandBuffer commandBuffer, uint32_t bufferCount,
+                                                           const VkDescriptorBufferBindingInfoEXT *pBindingInfos,
+                                                           const RecordObject &record_obj) {
+    auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    auto &core_cb_state = core::SubState(*cb_state);
+    // Read first, so a buffer created concurrently can only make the windows look stale, never valid
+    core_cb_state.descriptor_buffer_windows_version = device_state->GetBufferAddressRangesVersion();
+    core_cb_state.descriptor_buffer_windows.clear();
+    for (uint32_t i = 0; i < bufferCount; ++i) {
+        const VkDeviceAddress address = pBindingInfos[i].address;
+        VkDeviceAddress end = address;
+        for (const vvl::Buffer *buffer_state : GetBuffersByAddress(address)) {
+            end = std::max(end, buffer_state->DeviceAddressRange().end);
+        }
+        core_cb_state.descriptor_buffer_windows.emplace_back(address, end);
+    }
+}
+
 bool CoreChecks::PreCallValidateGetDescriptorSetLayoutSizeEXT(VkDevice device, VkDescriptorSetLayout layout,
                                                               VkDeviceSize *pLayoutSizeInBytes,
                                                               const ErrorObject &error_obj) const {
@@ -3227,6 +3224,13 @@ bool CoreChecks::PreCallValidateGetDescriptorEXT(VkDevice device, const VkDescri
 
         case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
             data_field = Field::accelerationStructure;
+            if (pDescriptorInfo->data.accelerationStructure && device_state->AreAllAccelerationStructureAddressesKnown() &&
+                !device_state->GetAccelerationStructureByAddress(pDescriptorInfo->data.accelerationStructure)) {
+                skip |= LogError("VUID-VkDescriptorGetInfoEXT-type-08028", device, descriptor_info_loc.dot(Field::type),
+                                 "is VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR and accelerationStructure (0x%" PRIx64
+                                 ") is not the address of a VkAccelerationStructureKHR created on device.",
+                                 pDescriptorInfo->data.accelerationStructure);
+            }
             break;
         case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
             data_field = Field::accelerationStructure;
@@ -3513,17 +3517,18 @@ bool CoreChecks::PreCallValidateAllocateDescriptorSets(VkDevice device, const Vk
                              ds_pool_state->GetAvailableSets());
         }
         // Determine whether descriptor counts are satisfiable
-        for (auto it = ds_data.required_descriptors_by_type.begin(); it != ds_data.required_descriptors_by_type.end(); ++it) {
-            const uint32_t available_count = ds_pool_state->GetAvailableCount(it->first);
+        const auto available_counts = ds_pool_state->GetAvailableCounts(ds_data.required_descriptors_by_type);
+        uint32_t type_index = 0;
+        for (const auto &[type, required_count] : ds_data.required_descriptors_by_type) {
+            const uint32_t available_count = available_counts[type_index++];
 
-            if (ds_data.required_descriptors_by_type.at(it->first) > available_count) {
+            if (required_count > available_count) {
                 skip |= LogError("VUID-VkDescriptorSetAllocateInfo-apiVersion-07896", ds_pool_state->Handle(), error_obj.location,
                                  "Unable to allocate %" PRIu32
                                  " descriptors of type %s from %s"
                                  ". This pool only has %" PRIu32 " descriptors of this type remaining.",
-                                 ds_data.required_descriptors_by_type.at(it->first),
-                                 string_VkDescriptorType(VkDescriptorType(it->first)), FormatHandle(*ds_pool_state).c_str(),
-                                 available_count);
+                                 required_count, string_VkDescriptorType(VkDescriptorType(type)),
+                                 FormatHandle(*ds_pool_state).c_str(), available_count);
             }
         }
     } else {
@@ -3802,9 +3807,16 @@ bool CoreChecks::PreCallValidateUpdateDescriptorSetWithTemplate(VkDevice device,
     if (template_state->create_info.templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET) {
         // decode the templatized data and leverage the non-template UpdateDescriptor helper functions.
         // Translate the templated update into a normal update for validation...
-        vvl::DecodedTemplateUpdate decoded_template(*device_state, descriptorSet, *template_state, pData);
-        skip |= ValidateUpdateDescriptorSets(static_cast<uint32_t>(decoded_template.desc_writes.size()),
-                                             decoded_template.desc_writes.data(), 0, nullptr, error_obj.location);
+        // All the writes are to the same set, it is only looked up once
+        if (const auto set_node = Get<vvl::DescriptorSet>(descriptorSet)) {
+            vvl::DecodedTemplateUpdate decoded_template(descriptorSet, *template_state, pData);
+            for (uint32_t i = 0; i < decoded_template.desc_writes.size(); i++) {
+                const Location write_loc = error_obj.location.dot(Field::pDescriptorWrites, i);
+                const Location dst_set_loc = write_loc.dot(Field::dstSet);
+                vvl::DslErrorSource dsl_error_source(dst_set_loc, descriptorSet);
+                skip |= ValidateWriteUpdate(*set_node, decoded_template.desc_writes[i], write_loc, dsl_error_source);
+            }
+        }
     }
     return skip;
 }
@@ -3898,7 +3910,7 @@ bool CoreChecks::ValidateCmdPushDescriptorSetWithTemplate(VkCommandBuffer comman
         // Create an empty proxy in order to use the existing descriptor set update validation
         vvl::DescriptorSet proxy_ds(VK_NULL_HANDLE, nullptr, dsl, 0, const_cast<vvl::DeviceState *>(device_state));
         // Decode the template into a set of write updates
-        vvl::DecodedTemplateUpdate decoded_template(*device_state, VK_NULL_HANDLE, *template_state, pData, dsl->VkHandle());
+        vvl::DecodedTemplateUpdate decoded_template(VK_NULL_HANDLE, *template_state, pData, dsl.get());
         // Validate the decoded update against the proxy_ds
         vvl::DslErrorSource dsl_error_source(loc, layout, set);
         skip |= ValidatePushDescriptorsUpdate(proxy_ds, static_cast<uint32_t>(decoded_template.desc_writes.size()),
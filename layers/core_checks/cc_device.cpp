@@ -347,6 +347,11 @@ void CoreChecks::FinishDeviceSetup(const VkDeviceCreateInfo *pCreateInfo, const
     BaseClass::FinishDeviceSetup(pCreateInfo, loc);
 
     AdjustValidatorOptions(extensions, enabled_features, spirv_val_options, &spirv_val_option_hash);
+    spirv_module_check_hash = stateless_spirv_validator.GetDeviceHash();
+    shader_object_dynamic_states_checked = GetShaderObjectDynamicStatesChecked();
+    if (global_settings.async_spirv_validation) {
+        spirv_validation_queue = std::make_unique<vvl::JobQueue>();
+    }
 
     // Allocate shader validation cache
     if (!disabled[shader_validation_caching] && !disabled[shader_validation] && !core_validation_cache) {
@@ -373,48 +378,61 @@ void CoreChecks::FinishDeviceSetup(const VkDeviceCreateInfo *pCreateInfo, const
         cacheCreateInfo.pInitialData = validation_cache_data.data();
         cacheCreateInfo.flags = 0;
         CoreLayerCreateValidationCacheEXT(device, &cacheCreateInfo, nullptr, &core_validation_cache);
+        // Only data that was not in the file yet makes it worth writing it again
+        CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &saved_validation_cache_size, nullptr);
     }
 }
 
-void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
-                                            const RecordObject &record_obj) {
-    if (!device) return;
+void CoreChecks::SaveValidationCache(const Location &loc) {
+    size_t validation_cache_size = 0;
+    CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, nullptr);
+    // Entries are never removed, so the same size means nothing was added since the last save
+    if (validation_cache_size == saved_validation_cache_size || validation_cache_path.empty()) {
+        return;
+    }
 
-    BaseClass::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
+    std::vector<char> validation_cache_data(validation_cache_size);
+    VkResult result =
+        CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, validation_cache_data.data());
+    if (result != VK_SUCCESS) {
+        LogInfo("WARNING-cache-retrieval-error", device, loc, "Validation Cache Retrieval Error");
+        return;
+    }
 
-    if (core_validation_cache) {
-        Location loc(Func::vkDestroyDevice);
-        size_t validation_cache_size = 0;
-        void *validation_cache_data = nullptr;
+    std::ofstream write_file(validation_cache_path.c_str(), std::ios::out | std::ios::binary);
+    if (write_file) {
+        write_file.write(validation_cache_data.data(), validation_cache_size);
+        write_file.close();
+        saved_validation_cache_size = validation_cache_size;
+    } else {
+        LogInfo("WARNING-cache-write-error", device, loc, "Cannot open shader validation cache at %s for writing",
+                validation_cache_path.c_str());
+    }
+}
 
-        CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, nullptr);
+void CoreChecks::PostCallRecordGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t *pDataSize,
+                                                    void *pData, const RecordObject &record_obj) {
+    // Applications persist their pipeline cache when they read its data, save the shader validation cache with it so the
+    // shaders of the pipelines are not validated again when the pipeline cache is reloaded, even if the device is never
+    // destroyed (the cache is otherwise only saved in vkDestroyDevice).
+    // The layer data is kept out of the pipeline cache data itself, as the driver owns its format.
+    if (!core_validation_cache || !pData || record_obj.result != VK_SUCCESS) {
+        return;
+    }
+    SaveValidationCache(record_obj.location);
+}
 
-        validation_cache_data = (char *)malloc(sizeof(char) * validation_cache_size);
-        if (!validation_cache_data) {
-            LogInfo("WARNING-cache-memory-error", device, loc, "Validation Cache Memory Error");
-            return;
-        }
+void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
+                                            const RecordObject &record_obj) {
+    if (!device) return;
 
-        VkResult result =
-            CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, validation_cache_data);
+    BaseClass::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 
-        if (result != VK_SUCCESS) {
-            LogInfo("WARNING-cache-retrieval-error", device, loc, "Validation Cache Retrieval Error");
-            free(validation_cache_data);
-            return;
-        }
+    // Runs the validations still queued, so their results are reported and saved in the cache
+    spirv_validation_queue.reset();
 
-        if (validation_cache_path.size() > 0) {
-            std::ofstream write_file(validation_cache_path.c_str(), std::ios::out | std::ios::binary);
-            if (write_file) {
-                write_file.write(static_cast<char *>(validation_cache_data), validation_cache_size);
-                write_file.close();
-            } else {
-                LogInfo("WARNING-cache-write-error", device, loc, "Cannot open shader validation cache at %s for writing",
-                        validation_cache_path.c_str());
-            }
-        }
-        free(validation_cache_data);
+    if (core_validation_cache) {
+        SaveValidationCache(Location(Func::vkDestroyDevice));
         CoreLayerDestroyValidationCacheEXT(device, core_validation_cache, NULL);
     }
 }
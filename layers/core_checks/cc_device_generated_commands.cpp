@@ -405,6 +405,7 @@ bool CoreChecks::ValidateGeneratedCommandsInfo(const vvl::CommandBuffer& cb_stat
     }
 
     bool valid_dispatch = true;
+    std::shared_ptr<const vvl::IndirectExecutionSet> indirect_execution_set;
     auto* pipeline_info = vku::FindStructInPNextChain<VkGeneratedCommandsPipelineInfoEXT>(generated_commands_info.pNext);
     auto* shader_info = vku::FindStructInPNextChain<VkGeneratedCommandsShaderInfoEXT>(generated_commands_info.pNext);
     if (generated_commands_info.indirectExecutionSet == VK_NULL_HANDLE) {
@@ -431,7 +432,7 @@ bool CoreChecks::ValidateGeneratedCommandsInfo(const vvl::CommandBuffer& cb_stat
                              "VK_INDIRECT_COMMANDS_TOKEN_TYPE_EXECUTION_SET_EXT token.");
             valid_dispatch = false;
         } else {
-            auto indirect_execution_set = Get<vvl::IndirectExecutionSet>(generated_commands_info.indirectExecutionSet);
+            indirect_execution_set = Get<vvl::IndirectExecutionSet>(generated_commands_info.indirectExecutionSet);
             ASSERT_AND_RETURN_SKIP(indirect_execution_set);
             if (indirect_execution_set->shader_stage_flags != indirect_commands_layout.execution_set_token_shader_stage_flags) {
                 skip |=
@@ -447,27 +448,41 @@ bool CoreChecks::ValidateGeneratedCommandsInfo(const vvl::CommandBuffer& cb_stat
 
     // Only dispatch if we know this is valid
     if (valid_dispatch) {
-        VkGeneratedCommandsMemoryRequirementsInfoEXT req_info = vku::InitStructHelper();
-        req_info.maxSequenceCount = generated_commands_info.maxSequenceCount;
-        req_info.indirectCommandsLayout = generated_commands_info.indirectCommandsLayout;
-        req_info.indirectExecutionSet = generated_commands_info.indirectExecutionSet;
-        if (generated_commands_info.indirectExecutionSet == VK_NULL_HANDLE) {
-            req_info.pNext = pipeline_info ? (void*)pipeline_info : (void*)shader_info;
+        // With an execution set the size only depends on handles and maxSequenceCount, so it is queried once per combination.
+        // Without one it depends on the pipeline or shaders in the pNext chain and is queried every time.
+        std::optional<VkDeviceSize> preprocess_size;
+        if (indirect_execution_set) {
+            preprocess_size =
+                indirect_commands_layout.GetPreprocessSize(*indirect_execution_set, generated_commands_info.maxSequenceCount);
+        }
+        if (!preprocess_size) {
+            VkGeneratedCommandsMemoryRequirementsInfoEXT req_info = vku::InitStructHelper();
+            req_info.maxSequenceCount = generated_commands_info.maxSequenceCount;
+            req_info.indirectCommandsLayout = generated_commands_info.indirectCommandsLayout;
+            req_info.indirectExecutionSet = generated_commands_info.indirectExecutionSet;
+            if (generated_commands_info.indirectExecutionSet == VK_NULL_HANDLE) {
+                req_info.pNext = pipeline_info ? (void*)pipeline_info : (void*)shader_info;
+            }
+            VkMemoryRequirements2 mem_reqs = vku::InitStructHelper();
+            DispatchGetGeneratedCommandsMemoryRequirementsEXT(device, &req_info, &mem_reqs);
+            preprocess_size = mem_reqs.memoryRequirements.size;
+            if (indirect_execution_set) {
+                indirect_commands_layout.SetPreprocessSize(*indirect_execution_set, generated_commands_info.maxSequenceCount,
+                                                           *preprocess_size);
+            }
         }
-        VkMemoryRequirements2 mem_reqs = vku::InitStructHelper();
-        DispatchGetGeneratedCommandsMemoryRequirementsEXT(device, &req_info, &mem_reqs);
 
-        if (generated_commands_info.preprocessAddress == 0 && mem_reqs.memoryRequirements.size != 0) {
+        if (generated_commands_info.preprocessAddress == 0 && *preprocess_size != 0) {
             skip |= LogError("VUID-VkGeneratedCommandsInfoEXT-preprocessAddress-11063", cb_state.Handle(),
                              info_loc.dot(Field::preprocessAddress),
                              "is NULL but vkGetGeneratedCommandsMemoryRequirementsEXT returned a non-zero size of %" PRIu64 ".",
-                             mem_reqs.memoryRequirements.size);
+                             *preprocess_size);
         }
-        if (generated_commands_info.preprocessSize < mem_reqs.memoryRequirements.size) {
+        if (generated_commands_info.preprocessSize < *preprocess_size) {
             skip |= LogError(
                 "VUID-VkGeneratedCommandsInfoEXT-preprocessSize-11071", cb_state.Handle(), info_loc.dot(Field::preprocessSize),
                 "(%" PRIu64 ") is less then the size returned from vkGetGeneratedCommandsMemoryRequirementsEXT (%" PRIu64 ").",
-                generated_commands_info.preprocessSize, mem_reqs.memoryRequirements.size);
+                generated_commands_info.preprocessSize, *preprocess_size);
         }
     }
 
@@ -549,8 +564,7 @@ bool CoreChecks::PreCallValidateCmdExecuteGeneratedCommandsEXT(VkCommandBuffer c
     const auto indirect_commands_layout = Get<vvl::IndirectCommandsLayout>(pGeneratedCommandsInfo->indirectCommandsLayout);
     ASSERT_AND_RETURN_SKIP(indirect_commands_layout);
 
-    const bool preprocess_usage_flag =
-        (indirect_commands_layout->create_info.flags & VK_INDIRECT_COMMANDS_LAYOUT_USAGE_EXPLICIT_PREPROCESS_BIT_EXT) != 0;
+    const bool preprocess_usage_flag = indirect_commands_layout->explicit_preprocess;
     if (isPreprocessed && !preprocess_usage_flag) {
         const LogObjectList objlist(commandBuffer, indirect_commands_layout->Handle());
         skip |= LogError(
@@ -691,7 +705,7 @@ bool CoreChecks::PreCallValidateCmdPreprocessGeneratedCommandsEXT(VkCommandBuffe
     const auto indirect_commands_layout = Get<vvl::IndirectCommandsLayout>(pGeneratedCommandsInfo->indirectCommandsLayout);
     ASSERT_AND_RETURN_SKIP(indirect_commands_layout);
 
-    if ((indirect_commands_layout->create_info.flags & VK_INDIRECT_COMMANDS_LAYOUT_USAGE_EXPLICIT_PREPROCESS_BIT_EXT) == 0) {
+    if (!indirect_commands_layout->explicit_preprocess) {
         const LogObjectList objlist(commandBuffer, indirect_commands_layout->Handle());
         skip |= LogError("VUID-vkCmdPreprocessGeneratedCommandsEXT-pGeneratedCommandsInfo-11082", objlist,
                          info_loc.dot(Field::indirectCommandsLayout),
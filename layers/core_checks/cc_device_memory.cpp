@@ -1482,6 +1482,7 @@ bool CoreChecks::PreCallValidateGetDeviceMemoryCommitment(VkDevice device, VkDev
 
 bool CoreChecks::ValidateBindImageMemory(uint32_t bindInfoCount, const VkBindImageMemoryInfo *pBindInfos,
                                          const ErrorObject &error_obj) const {
+    VVL_CheckStatsScope(dispatch_device_, "CoreChecks::ValidateBindImageMemory");
     bool skip = false;
     const auto &device_group_create_info = device_state->device_group_create_info;
     const bool bind_image_mem_2 = error_obj.location.function != Func::vkBindImageMemory;
@@ -20,6 +20,7 @@
 #include <vulkan/vk_enum_string_helper.h>
 #include "drawdispatch/drawdispatch_vuids.h"
 #include "core_validation.h"
+#include "core_checks/cc_state_tracker.h"
 #include "generated/vk_extension_helper.h"
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/image_state.h"
@@ -248,6 +249,7 @@ bool CoreChecks::PreCallValidateCmdDrawIndexed(VkCommandBuffer commandBuffer, ui
                                                uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance,
                                                const ErrorObject &error_obj) const {
     bool skip = false;
+    vvl::EpochReclaimer::Scope borrow_scope;
     const auto &cb_state = *GetRead<vvl::CommandBuffer>(commandBuffer);
     const auto &last_bound_state = cb_state.GetLastBoundGraphics();
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(error_obj.location.function);
@@ -257,8 +259,8 @@ bool CoreChecks::PreCallValidateCmdDrawIndexed(VkCommandBuffer commandBuffer, ui
     skip |= ValidateVTGShaderStages(last_bound_state, vuid);
 
     {
-        const auto index_buffer_state = Get<vvl::Buffer>(cb_state.index_buffer_binding.buffer);
-        skip |= ValidateGraphicsIndexedCmd(cb_state, index_buffer_state.get(), vuid);
+        const auto index_buffer_state = GetBorrowed<vvl::Buffer>(cb_state.index_buffer_binding.buffer);
+        skip |= ValidateGraphicsIndexedCmd(cb_state, index_buffer_state, vuid);
         if (index_buffer_state) {
             skip |= ValidateCmdDrawIndexedBufferSize(cb_state, *index_buffer_state, indexCount, firstIndex, error_obj.location,
                                                      "VUID-vkCmdDrawIndexed-robustBufferAccess2-08798");
@@ -273,6 +275,7 @@ bool CoreChecks::PreCallValidateCmdDrawMultiIndexedEXT(VkCommandBuffer commandBu
                                                        uint32_t firstInstance, uint32_t stride, const int32_t *pVertexOffset,
                                                        const ErrorObject &error_obj) const {
     bool skip = false;
+    vvl::EpochReclaimer::Scope borrow_scope;
     const auto &cb_state = *GetRead<vvl::CommandBuffer>(commandBuffer);
     const auto &last_bound_state = cb_state.GetLastBoundGraphics();
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(error_obj.location.function);
@@ -300,8 +303,8 @@ bool CoreChecks::PreCallValidateCmdDrawMultiIndexedEXT(VkCommandBuffer commandBu
     }
     skip |= invalid_stride;
 
-    const auto index_buffer_state = Get<vvl::Buffer>(cb_state.index_buffer_binding.buffer);
-    skip |= ValidateGraphicsIndexedCmd(cb_state, index_buffer_state.get(), vuid);
+    const auto index_buffer_state = GetBorrowed<vvl::Buffer>(cb_state.index_buffer_binding.buffer);
+    skip |= ValidateGraphicsIndexedCmd(cb_state, index_buffer_state, vuid);
 
     // only index into pIndexInfo if we know parameters are sane
     if (drawCount != 0 && !pIndexInfo) {
@@ -327,6 +330,7 @@ bool CoreChecks::PreCallValidateCmdDrawMultiIndexedEXT(VkCommandBuffer commandBu
 bool CoreChecks::PreCallValidateCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                 uint32_t drawCount, uint32_t stride, const ErrorObject &error_obj) const {
     bool skip = false;
+    vvl::EpochReclaimer::Scope borrow_scope;
     const auto &cb_state = *GetRead<vvl::CommandBuffer>(commandBuffer);
     const auto &last_bound_state = cb_state.GetLastBoundGraphics();
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(error_obj.location.function);
@@ -335,7 +339,7 @@ bool CoreChecks::PreCallValidateCmdDrawIndirect(VkCommandBuffer commandBuffer, V
     skip |= ValidateVTGShaderStages(last_bound_state, vuid);
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
         skip |= ValidateIndirectCmd(cb_state, *indirect_buffer_state, vuid);
 
@@ -380,6 +384,7 @@ bool CoreChecks::PreCallValidateCmdDrawIndirect(VkCommandBuffer commandBuffer, V
 bool CoreChecks::PreCallValidateCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                        uint32_t drawCount, uint32_t stride, const ErrorObject &error_obj) const {
     bool skip = false;
+    vvl::EpochReclaimer::Scope borrow_scope;
     const auto &cb_state = *GetRead<vvl::CommandBuffer>(commandBuffer);
     const auto &last_bound_state = cb_state.GetLastBoundGraphics();
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(error_obj.location.function);
@@ -388,12 +393,12 @@ bool CoreChecks::PreCallValidateCmdDrawIndexedIndirect(VkCommandBuffer commandBu
     skip |= ValidateVTGShaderStages(last_bound_state, vuid);
 
     {
-        const auto index_buffer_state = Get<vvl::Buffer>(cb_state.index_buffer_binding.buffer);
-        skip |= ValidateGraphicsIndexedCmd(cb_state, index_buffer_state.get(), vuid);
+        const auto index_buffer_state = GetBorrowed<vvl::Buffer>(cb_state.index_buffer_binding.buffer);
+        skip |= ValidateGraphicsIndexedCmd(cb_state, index_buffer_state, vuid);
     }
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
         skip |= ValidateIndirectCmd(cb_state, *indirect_buffer_state, vuid);
 
@@ -557,6 +562,7 @@ bool CoreChecks::PreCallValidateCmdDispatchBaseKHR(VkCommandBuffer commandBuffer
 bool CoreChecks::PreCallValidateCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                     const ErrorObject &error_obj) const {
     bool skip = false;
+    vvl::EpochReclaimer::Scope borrow_scope;
     const auto &cb_state = *GetRead<vvl::CommandBuffer>(commandBuffer);
     const auto &last_bound_state = cb_state.GetLastBoundCompute();
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(error_obj.location.function);
@@ -564,7 +570,7 @@ bool CoreChecks::PreCallValidateCmdDispatchIndirect(VkCommandBuffer commandBuffe
     skip |= ValidateActionState(last_bound_state, vuid);
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
         skip |= ValidateIndirectCmd(cb_state, *indirect_buffer_state, vuid);
         if (offset & 3) {
@@ -587,6 +593,7 @@ bool CoreChecks::PreCallValidateCmdDrawIndirectCount(VkCommandBuffer commandBuff
                                                      VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                      uint32_t stride, const ErrorObject &error_obj) const {
     bool skip = false;
+    vvl::EpochReclaimer::Scope borrow_scope;
     const auto &cb_state = *GetRead<vvl::CommandBuffer>(commandBuffer);
     const auto &last_bound_state = cb_state.GetLastBoundGraphics();
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(error_obj.location.function);
@@ -614,13 +621,13 @@ bool CoreChecks::PreCallValidateCmdDrawIndirectCount(VkCommandBuffer commandBuff
     }
 
     {
-        auto count_buffer_state = Get<vvl::Buffer>(countBuffer);
+        auto count_buffer_state = GetBorrowed<vvl::Buffer>(countBuffer);
         ASSERT_AND_RETURN_SKIP(count_buffer_state);
         skip |= ValidateIndirectCountCmd(cb_state, *count_buffer_state, countBufferOffset, vuid);
     }
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
         skip |= ValidateIndirectCmd(cb_state, *indirect_buffer_state, vuid);
         skip |= ValidateCmdDrawStrideWithStruct(cb_state, "VUID-vkCmdDrawIndirectCount-stride-03110", stride,
@@ -647,6 +654,7 @@ bool CoreChecks::PreCallValidateCmdDrawIndexedIndirectCount(VkCommandBuffer comm
                                                             uint32_t maxDrawCount, uint32_t stride,
                                                             const ErrorObject &error_obj) const {
     bool skip = false;
+    vvl::EpochReclaimer::Scope borrow_scope;
     const auto &cb_state = *GetRead<vvl::CommandBuffer>(commandBuffer);
     const auto &last_bound_state = cb_state.GetLastBoundGraphics();
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(error_obj.location.function);
@@ -672,18 +680,18 @@ bool CoreChecks::PreCallValidateCmdDrawIndexedIndirectCount(VkCommandBuffer comm
     }
 
     {
-        auto count_buffer_state = Get<vvl::Buffer>(countBuffer);
+        auto count_buffer_state = GetBorrowed<vvl::Buffer>(countBuffer);
         ASSERT_AND_RETURN_SKIP(count_buffer_state);
         skip |= ValidateIndirectCountCmd(cb_state, *count_buffer_state, countBufferOffset, vuid);
     }
 
     {
-        const auto index_buffer_state = Get<vvl::Buffer>(cb_state.index_buffer_binding.buffer);
-        skip |= ValidateGraphicsIndexedCmd(cb_state, index_buffer_state.get(), vuid);
+        const auto index_buffer_state = GetBorrowed<vvl::Buffer>(cb_state.index_buffer_binding.buffer);
+        skip |= ValidateGraphicsIndexedCmd(cb_state, index_buffer_state, vuid);
     }
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
         if (maxDrawCount > 1) {
             skip |= ValidateCmdDrawStrideWithBuffer(cb_state, "VUID-vkCmdDrawIndexedIndirectCount-maxDrawCount-03143", stride,
@@ -913,6 +921,8 @@ bool CoreChecks::ValidateCmdTraceRaysKHR(const Location &loc, const LastBound &l
     if (!pipeline_state) return skip;  // possible wasn't bound correctly, check caught elsewhere
     const bool is_indirect = loc.function == Func::vkCmdTraceRaysIndirectKHR;
     const vvl::CommandBuffer &cb_state = last_bound_state.cb_state;
+    const auto &cb_sub_state = core::SubState(cb_state);
+    const uint64_t address_ranges_version = device_state->GetBufferAddressRangesVersion();
 
     if (pHitShaderBindingTable) {
         const Location table_loc = loc.dot(Field::pHitShaderBindingTable);
@@ -960,28 +970,39 @@ bool CoreChecks::ValidateCmdTraceRaysKHR(const Location &loc, const LastBound &l
 
         const char *vuid_binding_table_flag = is_indirect ? "VUID-vkCmdTraceRaysIndirectKHR-pHitShaderBindingTable-03688"
                                                           : "VUID-vkCmdTraceRaysKHR-pHitShaderBindingTable-03688";
-        skip |= ValidateRaytracingShaderBindingTable(cb_state, table_loc, vuid_binding_table_flag, *pHitShaderBindingTable);
+        if (!cb_sub_state.IsShaderBindingTableValidated(Field::pHitShaderBindingTable, *pHitShaderBindingTable,
+                                                        address_ranges_version)) {
+            skip |= ValidateRaytracingShaderBindingTable(cb_state, table_loc, vuid_binding_table_flag, *pHitShaderBindingTable);
+        }
     }
 
     if (pRaygenShaderBindingTable) {
         const Location table_loc = loc.dot(Field::pRaygenShaderBindingTable);
         const char *vuid_binding_table_flag = is_indirect ? "VUID-vkCmdTraceRaysIndirectKHR-pRayGenShaderBindingTable-03681"
                                                           : "VUID-vkCmdTraceRaysKHR-pRayGenShaderBindingTable-03681";
-        // https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/9368
-        // TODO - waiting for https://gitlab.khronos.org/vulkan/vulkan/-/issues/4173
-        if (const auto buffers = GetBuffersByAddress(pRaygenShaderBindingTable->deviceAddress); buffers.empty()) {
-            skip |= LogError("UNASSIGNED-TraceRays-InvalidRayGenSBTAddress",
-                             cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR), table_loc.dot(Field::deviceAddress),
-                             "(0x%" PRIx64 ") does not belong to a valid VkBuffer.", pRaygenShaderBindingTable->deviceAddress);
+        if (!cb_sub_state.IsShaderBindingTableValidated(Field::pRaygenShaderBindingTable, *pRaygenShaderBindingTable,
+                                                        address_ranges_version)) {
+            // https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/9368
+            // TODO - waiting for https://gitlab.khronos.org/vulkan/vulkan/-/issues/4173
+            if (const auto buffers = GetBuffersByAddress(pRaygenShaderBindingTable->deviceAddress); buffers.empty()) {
+                skip |= LogError("UNASSIGNED-TraceRays-InvalidRayGenSBTAddress",
+                                 cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR),
+                                 table_loc.dot(Field::deviceAddress), "(0x%" PRIx64 ") does not belong to a valid VkBuffer.",
+                                 pRaygenShaderBindingTable->deviceAddress);
+            }
+            skip |=
+                ValidateRaytracingShaderBindingTable(cb_state, table_loc, vuid_binding_table_flag, *pRaygenShaderBindingTable);
         }
-        skip |= ValidateRaytracingShaderBindingTable(cb_state, table_loc, vuid_binding_table_flag, *pRaygenShaderBindingTable);
     }
 
     if (pMissShaderBindingTable) {
         const Location table_loc = loc.dot(Field::pMissShaderBindingTable);
         const char *vuid_binding_table_flag = is_indirect ? "VUID-vkCmdTraceRaysIndirectKHR-pMissShaderBindingTable-03684"
                                                           : "VUID-vkCmdTraceRaysKHR-pMissShaderBindingTable-03684";
-        skip |= ValidateRaytracingShaderBindingTable(cb_state, table_loc, vuid_binding_table_flag, *pMissShaderBindingTable);
+        if (!cb_sub_state.IsShaderBindingTableValidated(Field::pMissShaderBindingTable, *pMissShaderBindingTable,
+                                                        address_ranges_version)) {
+            skip |= ValidateRaytracingShaderBindingTable(cb_state, table_loc, vuid_binding_table_flag, *pMissShaderBindingTable);
+        }
         if (pMissShaderBindingTable->deviceAddress == 0) {
             if (pipeline_state->create_flags & VK_PIPELINE_CREATE_RAY_TRACING_NO_NULL_MISS_SHADERS_BIT_KHR) {
                 const char *vuid =
@@ -999,7 +1020,11 @@ bool CoreChecks::ValidateCmdTraceRaysKHR(const Location &loc, const LastBound &l
         const Location table_loc = loc.dot(Field::pCallableShaderBindingTable);
         const char *vuid_binding_table_flag = is_indirect ? "VUID-vkCmdTraceRaysIndirectKHR-pCallableShaderBindingTable-03692"
                                                           : "VUID-vkCmdTraceRaysKHR-pCallableShaderBindingTable-03692";
-        skip |= ValidateRaytracingShaderBindingTable(cb_state, table_loc, vuid_binding_table_flag, *pCallableShaderBindingTable);
+        if (!cb_sub_state.IsShaderBindingTableValidated(Field::pCallableShaderBindingTable, *pCallableShaderBindingTable,
+                                                        address_ranges_version)) {
+            skip |= ValidateRaytracingShaderBindingTable(cb_state, table_loc, vuid_binding_table_flag,
+                                                         *pCallableShaderBindingTable);
+        }
     }
     return skip;
 }
@@ -1038,6 +1063,48 @@ bool CoreChecks::PreCallValidateCmdTraceRaysIndirectKHR(VkCommandBuffer commandB
     return skip;
 }
 
+void CoreChecks::RecordTraceRaysShaderBindingTables(VkCommandBuffer commandBuffer,
+                                                    const VkStridedDeviceAddressRegionKHR *pRaygenShaderBindingTable,
+                                                    const VkStridedDeviceAddressRegionKHR *pMissShaderBindingTable,
+                                                    const VkStridedDeviceAddressRegionKHR *pHitShaderBindingTable,
+                                                    const VkStridedDeviceAddressRegionKHR *pCallableShaderBindingTable) {
+    auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    auto &cb_sub_state = core::SubState(*cb_state);
+    // Only reached if the tables passed validation
+    const uint64_t address_ranges_version = device_state->GetBufferAddressRangesVersion();
+    const std::pair<Field, const VkStridedDeviceAddressRegionKHR *> tables[] = {
+        {Field::pRaygenShaderBindingTable, pRaygenShaderBindingTable},
+        {Field::pMissShaderBindingTable, pMissShaderBindingTable},
+        {Field::pHitShaderBindingTable, pHitShaderBindingTable},
+        {Field::pCallableShaderBindingTable, pCallableShaderBindingTable},
+    };
+    for (const auto &[table, region] : tables) {
+        if (region && region->deviceAddress != 0 && region->size != 0) {
+            cb_sub_state.AddValidatedShaderBindingTable(table, *region, address_ranges_version);
+        }
+    }
+}
+
+void CoreChecks::PostCallRecordCmdTraceRaysKHR(VkCommandBuffer commandBuffer,
+                                               const VkStridedDeviceAddressRegionKHR *pRaygenShaderBindingTable,
+                                               const VkStridedDeviceAddressRegionKHR *pMissShaderBindingTable,
+                                               const VkStridedDeviceAddressRegionKHR *pHitShaderBindingTable,
+                                               const VkStridedDeviceAddressRegionKHR *pCallableShaderBindingTable, uint32_t width,
+                                               uint32_t height, uint32_t depth, const RecordObject &record_obj) {
+    RecordTraceRaysShaderBindingTables(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable,
+                                       pCallableShaderBindingTable);
+}
+
+void CoreChecks::PostCallRecordCmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer,
+                                                       const VkStridedDeviceAddressRegionKHR *pRaygenShaderBindingTable,
+                                                       const VkStridedDeviceAddressRegionKHR *pMissShaderBindingTable,
+                                                       const VkStridedDeviceAddressRegionKHR *pHitShaderBindingTable,
+                                                       const VkStridedDeviceAddressRegionKHR *pCallableShaderBindingTable,
+                                                       VkDeviceAddress indirectDeviceAddress, const RecordObject &record_obj) {
+    RecordTraceRaysShaderBindingTables(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable,
+                                       pCallableShaderBindingTable);
+}
+
 bool CoreChecks::PreCallValidateCmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffer, VkDeviceAddress indirectDeviceAddress,
                                                          const ErrorObject &error_obj) const {
     bool skip = false;
@@ -1074,6 +1141,7 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectNV(VkCommandBuffer comma
                                                            uint32_t drawCount, uint32_t stride,
                                                            const ErrorObject &error_obj) const {
     bool skip = false;
+    vvl::EpochReclaimer::Scope borrow_scope;
     const auto &cb_state = *GetRead<vvl::CommandBuffer>(commandBuffer);
     const auto &last_bound_state = cb_state.GetLastBoundGraphics();
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(error_obj.location.function);
@@ -1082,7 +1150,7 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectNV(VkCommandBuffer comma
     skip |= ValidateMeshShaderStage(last_bound_state, vuid, true);
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
         skip |= ValidateIndirectCmd(cb_state, *indirect_buffer_state, vuid);
 
@@ -1103,7 +1171,7 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectNV(VkCommandBuffer comma
                                  stride);
             }
         } else if (drawCount == 1 &&
-                   ((offset + sizeof(VkDrawMeshTasksIndirectCommandNV)) > indirect_buffer_state.get()->create_info.size)) {
+                   ((offset + sizeof(VkDrawMeshTasksIndirectCommandNV)) > indirect_buffer_state->create_info.size)) {
             LogObjectList objlist = cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_GRAPHICS);
             objlist.add(buffer);
             skip |= LogError("VUID-vkCmdDrawMeshTasksIndirectNV-drawCount-02156", objlist, error_obj.location,
@@ -1131,6 +1199,7 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectCountNV(VkCommandBuffer
                                                                 uint32_t maxDrawCount, uint32_t stride,
                                                                 const ErrorObject &error_obj) const {
     bool skip = false;
+    vvl::EpochReclaimer::Scope borrow_scope;
     const auto &cb_state = *GetRead<vvl::CommandBuffer>(commandBuffer);
     const auto &last_bound_state = cb_state.GetLastBoundGraphics();
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(error_obj.location.function);
@@ -1150,13 +1219,13 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectCountNV(VkCommandBuffer
     }
 
     {
-        auto count_buffer_state = Get<vvl::Buffer>(countBuffer);
+        auto count_buffer_state = GetBorrowed<vvl::Buffer>(countBuffer);
         ASSERT_AND_RETURN_SKIP(count_buffer_state);
         skip |= ValidateIndirectCountCmd(cb_state, *count_buffer_state, countBufferOffset, vuid);
     }
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
         skip |= ValidateIndirectCmd(cb_state, *indirect_buffer_state, vuid);
         skip |= ValidateCmdDrawStrideWithStruct(cb_state, "VUID-vkCmdDrawMeshTasksIndirectCountNV-stride-02182", stride,
@@ -1241,6 +1310,7 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectEXT(VkCommandBuffer comm
                                                             uint32_t drawCount, uint32_t stride,
                                                             const ErrorObject &error_obj) const {
     bool skip = false;
+    vvl::EpochReclaimer::Scope borrow_scope;
     const auto &cb_state = *GetRead<vvl::CommandBuffer>(commandBuffer);
     const auto &last_bound_state = cb_state.GetLastBoundGraphics();
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(error_obj.location.function);
@@ -1249,7 +1319,7 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectEXT(VkCommandBuffer comm
     skip |= ValidateMeshShaderStage(last_bound_state, vuid, false);
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
         skip |= ValidateIndirectCmd(cb_state, *indirect_buffer_state, vuid);
 
@@ -1294,6 +1364,7 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer
                                                                  VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                                  uint32_t stride, const ErrorObject &error_obj) const {
     bool skip = false;
+    vvl::EpochReclaimer::Scope borrow_scope;
     const auto &cb_state = *GetRead<vvl::CommandBuffer>(commandBuffer);
     const auto &last_bound_state = cb_state.GetLastBoundGraphics();
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(error_obj.location.function);
@@ -1301,7 +1372,7 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer
     skip |= ValidateActionState(last_bound_state, vuid);
     skip |= ValidateMeshShaderStage(last_bound_state, vuid, false);
 
-    auto count_buffer_state = Get<vvl::Buffer>(countBuffer);
+    auto count_buffer_state = GetBorrowed<vvl::Buffer>(countBuffer);
     ASSERT_AND_RETURN_SKIP(count_buffer_state);
     skip |= ValidateMemoryIsBoundToBuffer(commandBuffer, *count_buffer_state, error_obj.location.dot(Field::countBuffer),
                                           vuid.indirect_count_contiguous_memory_02714);
@@ -1310,7 +1381,7 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer
                                      error_obj.location.dot(Field::countBuffer));
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
 
         skip |= ValidateIndirectCmd(cb_state, *indirect_buffer_state, vuid);
@@ -1331,6 +1402,7 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer
 // Action command == vkCmdDraw*, vkCmdDispatch*, vkCmdTraceRays*
 // This is the main logic shared by all action commands
 bool CoreChecks::ValidateActionState(const LastBound &last_bound_state, const DrawDispatchVuid &vuid) const {
+    VVL_CheckStatsScope(dispatch_device_, "CoreChecks::ValidateActionState");
     const Location &loc = vuid.loc();
     const vvl::CommandBuffer &cb_state = last_bound_state.cb_state;
     const vvl::Pipeline *pipeline = last_bound_state.pipeline_state;
@@ -1347,23 +1419,26 @@ bool CoreChecks::ValidateActionState(const LastBound &last_bound_state, const Dr
     }
 
     if (bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
-        skip |= ValidateDrawDynamicState(last_bound_state, vuid);
-        skip |= ValidateDrawPrimitivesGeneratedQuery(last_bound_state, vuid);
-        skip |= ValidateDrawProtectedMemory(last_bound_state, vuid);
-        skip |= ValidateDrawFragmentShadingRate(last_bound_state, vuid);
-        skip |= ValidateDrawAttachmentColorBlend(last_bound_state, vuid);
-
-        if (cb_state.active_render_pass && cb_state.active_render_pass->UsesDynamicRendering()) {
-            skip |= ValidateDrawDynamicRenderingFsOutputs(last_bound_state, *cb_state.active_render_pass, loc);
-            skip |= ValidateDrawDynamicRenderpassExternalFormatResolve(last_bound_state, *cb_state.active_render_pass, vuid);
-        }
+        // Nothing these read has changed since the last draw of the same command was validated and recorded, descriptors and
+        // push constants are checked below regardless
+        if (!core::SubState(cb_state).IsGraphicsStateValidated(vuid.function)) {
+            skip |= ValidateDrawDynamicState(last_bound_state, vuid);
+            skip |= ValidateDrawPrimitivesGeneratedQuery(last_bound_state, vuid);
+            skip |= ValidateDrawProtectedMemory(last_bound_state, vuid);
+            skip |= ValidateDrawFragmentShadingRate(last_bound_state, vuid);
+            skip |= ValidateDrawAttachmentColorBlend(last_bound_state, vuid);
+
+            if (cb_state.active_render_pass && cb_state.active_render_pass->UsesDynamicRendering()) {
+                skip |= ValidateDrawDynamicRenderingFsOutputs(last_bound_state, *cb_state.active_render_pass, loc);
+                skip |= ValidateDrawDynamicRenderpassExternalFormatResolve(last_bound_state, *cb_state.active_render_pass, vuid);
+            }
 
-        if (pipeline) {
-            skip |= ValidateDrawPipeline(last_bound_state, *pipeline, vuid);
-        } else {
-            skip |= ValidateDrawShaderObject(last_bound_state, vuid);
+            if (pipeline) {
+                skip |= ValidateDrawPipeline(last_bound_state, *pipeline, vuid);
+            } else {
+                skip |= ValidateDrawShaderObject(last_bound_state, vuid);
+            }
         }
-
     } else if (bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
         skip |= InsideRenderPass(cb_state, loc, vuid.compute_inside_rp_10672);
 
@@ -1404,18 +1479,18 @@ bool CoreChecks::ValidateActionState(const LastBound &last_bound_state, const Dr
 }
 
 // Validate the draw-time state for this descriptor set
-// We can skip validating the descriptor set if "nothing" has changed since the last validation.
-// Same set, no image layout changes, and same "pipeline state" (binding_req_map). If there are
-// any dynamic descriptors, always revalidate rather than caching the values. We currently only
-// apply this optimization if IsManyDescriptors is true, to avoid the overhead of copying the
-// binding_req_map which could potentially be expensive.
-static bool NeedDrawStateValidated(const vvl::CommandBuffer &cb_state, const vvl::DescriptorSet *descriptor_set,
-                                   const LastBound::DescriptorSetSlot &ds_slot, bool disabled_image_layout_validation) {
-    return ds_slot.dynamic_offsets.size() > 0 ||
-           // Revalidate if descriptor set (or contents) has changed
-           ds_slot.validated_set != descriptor_set || ds_slot.validated_set_change_count != descriptor_set->GetChangeCount() ||
-           (!disabled_image_layout_validation &&
-            ds_slot.validated_set_image_layout_change_count != cb_state.image_layout_change_count);
+// We can skip validating the descriptor set if "nothing" has changed since it was last validated in this command buffer.
+// Same set and contents, same "pipeline state" (binding_req_map), no image layout or attachment changes (see
+// DescriptorSetValidationKey). If there are any dynamic descriptors, always revalidate rather than caching the values.
+static bool NeedDrawStateValidated(const LastBound &last_bound_state, const vvl::DescriptorSet &descriptor_set,
+                                   const BindingVariableMap &binding_req_map, const LastBound::DescriptorSetSlot &ds_slot,
+                                   bool disabled_image_layout_validation) {
+    if (ds_slot.dynamic_offsets.size() > 0) {
+        return true;
+    }
+    const DescriptorSetValidationKey key =
+        last_bound_state.GetValidationKey(descriptor_set, binding_req_map, disabled_image_layout_validation);
+    return ds_slot.validated != key && !core::SubState(last_bound_state.cb_state).IsDescriptorSetValidated(key);
 }
 
 bool CoreChecks::ValidateActionStateDescriptorsPipeline(const LastBound &last_bound_state, const VkPipelineBindPoint bind_point,
@@ -1520,8 +1595,8 @@ bool CoreChecks::ValidateActionStateDescriptorsPipeline(const LastBound &last_bo
                 const auto *descriptor_set = ds_slot.ds_state.get();
                 ASSERT_AND_CONTINUE(descriptor_set);
 
-                const bool need_validate =
-                    NeedDrawStateValidated(cb_state, descriptor_set, ds_slot, disabled[image_layout_validation]);
+                const bool need_validate = NeedDrawStateValidated(last_bound_state, *descriptor_set, binding_req_map, ds_slot,
+                                                                  disabled[image_layout_validation]);
                 if (need_validate) {
                     skip |= ValidateDrawState(*descriptor_set, set_index, binding_req_map, cb_state, vuid, pipeline.Handle());
                 }
@@ -1594,8 +1669,8 @@ bool CoreChecks::ValidateActionStateDescriptorsShaderObject(const LastBound &las
                     const auto *descriptor_set = ds_slot.ds_state.get();
                     ASSERT_AND_CONTINUE(descriptor_set);
 
-                    const bool need_validate =
-                        NeedDrawStateValidated(cb_state, descriptor_set, ds_slot, disabled[image_layout_validation]);
+                    const bool need_validate = NeedDrawStateValidated(last_bound_state, *descriptor_set, binding_req_map, ds_slot,
+                                                                      disabled[image_layout_validation]);
                     if (need_validate) {
                         skip |=
                             ValidateDrawState(*descriptor_set, set_index, binding_req_map, cb_state, vuid, shader_state->Handle());
@@ -1769,6 +1844,7 @@ bool CoreChecks::ValidateDrawPrimitivesGeneratedQuery(const LastBound &last_boun
 
 bool CoreChecks::ValidateDrawProtectedMemory(const LastBound &last_bound_state, const vvl::DrawDispatchVuid &vuid) const {
     bool skip = false;
+    vvl::EpochReclaimer::Scope borrow_scope;
     const vvl::CommandBuffer &cb_state = last_bound_state.cb_state;
 
     if (!enabled_features.protectedMemory) {
@@ -1778,7 +1854,7 @@ bool CoreChecks::ValidateDrawProtectedMemory(const LastBound &last_bound_state,
     // Verify vertex & index buffer for unprotected command buffer.
     // Because vertex & index buffer is read only, it doesn't need to care protected command buffer case.
     for (const auto &vertex_buffer_binding : cb_state.current_vertex_buffer_binding_info) {
-        if (const auto buffer_state = Get<vvl::Buffer>(vertex_buffer_binding.second.buffer)) {
+        if (const auto buffer_state = GetBorrowed<vvl::Buffer>(vertex_buffer_binding.second.buffer)) {
             skip |= ValidateProtectedBuffer(cb_state, *buffer_state, vuid.loc(), vuid.unprotected_command_buffer_02707,
                                             " (Buffer is the vertex buffer)");
         }
@@ -41,7 +41,7 @@
 #include "utils/image_utils.h"
 
 bool CoreChecks::IsMixSamplingSupported() const {
-    return IsExtEnabled(extensions.vk_amd_mixed_attachment_samples) || IsExtEnabled(extensions.vk_nv_framebuffer_mixed_samples) ||
+    return IsAnyExtEnabled(extensions.vk_amd_mixed_attachment_samples, extensions.vk_nv_framebuffer_mixed_samples) ||
            enabled_features.multisampledRenderToSingleSampled;
 }
 
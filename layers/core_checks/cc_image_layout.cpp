@@ -237,6 +237,7 @@ struct GlobalLayoutUpdater {
 bool CoreChecks::ValidateCmdBufImageLayouts(
     const Location &loc, const vvl::CommandBuffer &cb_state,
     vvl::unordered_map<const vvl::Image *, ImageLayoutMap> &local_image_layout_state) const {
+    VVL_CheckStatsScope(dispatch_device_, "CoreChecks::ValidateCmdBufImageLayouts");
     if (disabled[image_layout_validation]) {
         return false;
     }
@@ -260,64 +261,73 @@ bool CoreChecks::ValidateCmdBufImageLayouts(
         // Validate the initial_uses for each subresource referenced
         const auto subresource_count = image_state->subresource_encoder.SubresourceCount();
         auto it = local_image_layout_state.try_emplace(image_state.get(), subresource_count).first;
-        ImageLayoutMap &local_layout_map = it->second;
-
-        const auto *global_layout_map = image_state->layout_map.get();
-        ASSERT_AND_CONTINUE(global_layout_map);
-        auto global_layout_map_guard = image_state->LayoutMapReadLock();
-
-        auto pos = cb_layout_map->begin();
-        const auto end = cb_layout_map->end();
-        sparse_container::parallel_iterator<const ImageLayoutMap> current_layout(local_layout_map, *global_layout_map,
-                                                                                 pos->first.begin);
-        while (pos != end) {
-            VkImageLayout first_layout = pos->second.first_layout;
-            if (first_layout == kInvalidLayout) {
-                continue;
-            }
+        skip |= ValidateCmdBufImageLayout(loc, cb_state, *image_state, *cb_layout_map, it->second);
+    }
 
-            VkImageLayout image_layout = kInvalidLayout;
+    return skip;
+}
 
-            if (current_layout->range.empty()) break;  // When we are past the end of data in overlay and global... stop looking
-            if (current_layout->pos_A->valid) {        // pos_A denotes the overlay map in the parallel iterator
-                image_layout = current_layout->pos_A->lower_bound->second;
-            } else if (current_layout->pos_B->valid) {  // pos_B denotes the global map in the parallel iterator
-                image_layout = current_layout->pos_B->lower_bound->second;
-            }
-            const auto intersected_range = pos->first & current_layout->range;
-            if (first_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
-                // TODO: Set memory invalid which is in mem_tracker currently
-            } else if (image_layout != first_layout) {
-                const auto aspect_mask = image_state->subresource_encoder.Decode(intersected_range.begin).aspectMask;
-                const bool matches = ImageLayoutMatches(aspect_mask, image_layout, first_layout);
-                if (!matches) {
-                    // We can report all the errors for the intersected range directly
-                    for (auto index : vvl::range_view<decltype(intersected_range)>(intersected_range)) {
-                        const auto subresource = image_state->subresource_encoder.Decode(index);
-                        const LogObjectList objlist(cb_state.Handle(), image_state->Handle());
-                        // TODO - We need a way to map the action command to which caused this error
-                        const vvl::DrawDispatchVuid &vuid = GetDrawDispatchVuid(vvl::Func::vkCmdDraw);
-                        skip |= LogError(
-                            vuid.image_layout_09600, objlist, loc,
-                            "command buffer %s expects %s (subresource: %s) to be in layout %s--instead, current layout is %s.",
-                            FormatHandle(cb_state).c_str(), FormatHandle(*image_state).c_str(),
-                            string_VkImageSubresource(subresource).c_str(), string_VkImageLayout(first_layout),
-                            string_VkImageLayout(image_layout));
-                    }
+// Validates the layouts the command buffer expects for one image. local_layout_map holds the layouts set by the command
+// buffers submitted before in the same batch, and is updated with the layouts set by this command buffer.
+bool CoreChecks::ValidateCmdBufImageLayout(const Location &loc, const vvl::CommandBuffer &cb_state, const vvl::Image &image_state,
+                                           const CommandBufferImageLayoutMap &cb_layout_map,
+                                           ImageLayoutMap &local_layout_map) const {
+    bool skip = false;
+    const auto *global_layout_map = image_state.layout_map.get();
+    ASSERT_AND_RETURN_SKIP(global_layout_map);
+    auto global_layout_map_guard = image_state.LayoutMapReadLock();
+
+    auto pos = cb_layout_map.begin();
+    const auto end = cb_layout_map.end();
+    sparse_container::parallel_iterator<const ImageLayoutMap> current_layout(local_layout_map, *global_layout_map,
+                                                                             pos->first.begin);
+    while (pos != end) {
+        VkImageLayout first_layout = pos->second.first_layout;
+        if (first_layout == kInvalidLayout) {
+            continue;
+        }
+
+        VkImageLayout image_layout = kInvalidLayout;
+
+        if (current_layout->range.empty()) break;  // When we are past the end of data in overlay and global... stop looking
+        if (current_layout->pos_A->valid) {        // pos_A denotes the overlay map in the parallel iterator
+            image_layout = current_layout->pos_A->lower_bound->second;
+        } else if (current_layout->pos_B->valid) {  // pos_B denotes the global map in the parallel iterator
+            image_layout = current_layout->pos_B->lower_bound->second;
+        }
+        const auto intersected_range = pos->first & current_layout->range;
+        if (first_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
+            // TODO: Set memory invalid which is in mem_tracker currently
+        } else if (image_layout != first_layout) {
+            const auto aspect_mask = image_state.subresource_encoder.Decode(intersected_range.begin).aspectMask;
+            const bool matches = ImageLayoutMatches(aspect_mask, image_layout, first_layout);
+            if (!matches) {
+                // We can report all the errors for the intersected range directly
+                for (auto index : vvl::range_view<decltype(intersected_range)>(intersected_range)) {
+                    const auto subresource = image_state.subresource_encoder.Decode(index);
+                    const LogObjectList objlist(cb_state.Handle(), image_state.Handle());
+                    // TODO - We need a way to map the action command to which caused this error
+                    const vvl::DrawDispatchVuid &vuid = GetDrawDispatchVuid(vvl::Func::vkCmdDraw);
+                    skip |= LogError(
+                        vuid.image_layout_09600, objlist, loc,
+                        "command buffer %s expects %s (subresource: %s) to be in layout %s--instead, current layout is %s.",
+                        FormatHandle(cb_state).c_str(), FormatHandle(image_state).c_str(),
+                        string_VkImageSubresource(subresource).c_str(), string_VkImageLayout(first_layout),
+                        string_VkImageLayout(image_layout));
                 }
             }
-            if (pos->first.includes(intersected_range.end)) {
-                current_layout.seek(intersected_range.end);
-            } else {
-                ++pos;
-                if (pos != end) {
-                    current_layout.seek(pos->first.begin);
-                }
+        }
+        if (pos->first.includes(intersected_range.end)) {
+            current_layout.seek(intersected_range.end);
+        } else {
+            ++pos;
+            if (pos != end) {
+                current_layout.seek(pos->first.begin);
             }
         }
-        // Update all layout set operations (which will be a subset of the initial_layouts)
-        sparse_container::splice(local_layout_map, *cb_layout_map, GlobalLayoutUpdater());
     }
+    // Update all layout set operations (which will be a subset of the initial_layouts)
+    sparse_container::splice(local_layout_map, cb_layout_map, GlobalLayoutUpdater());
 
     return skip;
 }
@@ -62,7 +62,7 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
             uint32_t stage_count = std::min(pCreateInfos[0].stageCount, kCommonMaxGraphicsShaderStages);
             for (uint32_t stage = 0; stage < stage_count; stage++) {
                 if (chassis_state.stateless_data[stage].pipeline_pnext_module) {
-                    skip |= stateless_spirv_validator.Validate(
+                    skip |= ValidateSpirvStateless(
                         *chassis_state.stateless_data[stage].pipeline_pnext_module, chassis_state.stateless_data[stage],
                         create_info_loc.dot(Field::pStages, stage).pNext(Struct::VkShaderModuleCreateInfo, Field::pCode));
                 }
@@ -74,6 +74,7 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
 
 bool CoreChecks::ValidateGraphicsPipeline(const vvl::Pipeline &pipeline, const void *pipeline_ci_pnext,
                                           const Location &create_info_loc) const {
+    VVL_CheckStatsScope(dispatch_device_, "CoreChecks::ValidateGraphicsPipeline");
     bool skip = false;
     // It would be ideal to split all pipeline checks into Dynamic and Non-Dynamic renderpasses, but with GPL it gets a bit tricky.
     // Also you might be deep in a function and it is easier to do a if/else check if it is dynamic rendering or not there.
@@ -1265,7 +1266,8 @@ bool CoreChecks::ValidateGraphicsPipelineMeshTask(const vvl::Pipeline &pipeline,
     bool skip = false;
     const bool has_mesh = (pipeline.active_shaders & VK_SHADER_STAGE_MESH_BIT_EXT) != 0;
     const bool has_task = (pipeline.active_shaders & VK_SHADER_STAGE_TASK_BIT_EXT) != 0;
-    if (has_mesh && has_task) {
+    // Both are pre-rasterization shaders, a linked library was checked when it was created
+    if (has_mesh && has_task && pipeline.OwnsSubState(pipeline.pre_raster_state)) {
         for (const auto &stage : pipeline.stage_states) {
             if (stage.GetStage() == VK_SHADER_STAGE_MESH_BIT_EXT && stage.spirv_state &&
                 stage.spirv_state->static_data_.has_builtin_draw_index) {
@@ -30,16 +30,6 @@
 #include "state_tracker/cmd_buffer_state.h"
 #include "utils/math_utils.h"
 
-static QueryState GetLocalQueryState(const QueryMap *local_query_to_state_map, VkQueryPool queryPool, uint32_t queryIndex,
-                                     uint32_t perf_query_pass) {
-    QueryObject query = QueryObject(queryPool, queryIndex, perf_query_pass);
-
-    auto iter = local_query_to_state_map->find(query);
-    if (iter != local_query_to_state_map->end()) return iter->second;
-
-    return QUERYSTATE_UNKNOWN;
-}
-
 bool CoreChecks::PreCallValidateDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks *pAllocator,
                                                  const ErrorObject &error_obj) const {
     bool skip = false;
@@ -114,7 +104,7 @@ bool CoreChecks::ValidateQueryPoolWasReset(const vvl::QueryPool &query_pool_stat
 
     for (uint32_t i = firstQuery; i < firstQuery + queryCount; ++i) {
         if (local_query_to_state_map &&
-            GetLocalQueryState(local_query_to_state_map, query_pool_state.VkHandle(), i, perf_query_pass) != QUERYSTATE_UNKNOWN) {
+            local_query_to_state_map->Get(query_pool_state.VkHandle(), i, perf_query_pass) != QUERYSTATE_UNKNOWN) {
             continue;
         }
         if (query_pool_state.GetQueryState(i, 0u) == QUERYSTATE_UNKNOWN) {
@@ -768,7 +758,7 @@ bool CoreChecks::VerifyQueryIsReset(const vvl::CommandBuffer &cb_state, const Qu
     ASSERT_AND_RETURN_SKIP(query_pool_state);
     const auto &query_pool_ci = query_pool_state->create_info;
 
-    QueryState state = GetLocalQueryState(local_query_to_state_map, query_obj.pool, query_obj.slot, perf_query_pass);
+    QueryState state = local_query_to_state_map->Get(query_obj.pool, query_obj.slot, perf_query_pass);
     // If reset was in another command buffer, check the global map
     if (state == QUERYSTATE_UNKNOWN) {
         state = query_pool_state->GetQueryState(query_obj.slot, perf_query_pass);
@@ -839,7 +829,7 @@ bool CoreChecks::ValidatePerformanceQuery(const vvl::CommandBuffer &cb_state, co
                                     state_data.FormatHandle(cb_state).c_str());
     }
 
-    QueryState command_buffer_state = GetLocalQueryState(local_query_to_state_map, query_obj.pool, query_obj.slot, perf_query_pass);
+    QueryState command_buffer_state = local_query_to_state_map->Get(query_obj.pool, query_obj.slot, perf_query_pass);
     if (command_buffer_state == QUERYSTATE_RESET) {
         const LogObjectList objlist(cb_state.Handle(), query_obj.pool);
         skip |= state_data.LogError(
@@ -1352,9 +1342,7 @@ void CoreChecks::PostCallRecordGetQueryPoolResults(VkDevice device, VkQueryPool
     ASSERT_AND_RETURN(query_pool_state);
 
     if ((flags & VK_QUERY_RESULT_PARTIAL_BIT) == 0) {
-        for (uint32_t i = firstQuery; i < queryCount; ++i) {
-            query_pool_state->SetQueryState(i, 0, QUERYSTATE_AVAILABLE);
-        }
+        query_pool_state->SetQueryStates(firstQuery, queryCount, 0, QUERYSTATE_AVAILABLE);
     }
 }
 
@@ -39,7 +39,7 @@ struct CommandBufferSubmitState {
     QFOTransferCBScoreboards<QFOImageTransferBarrier> qfo_image_scoreboards;
     QFOTransferCBScoreboards<QFOBufferTransferBarrier> qfo_buffer_scoreboards;
     std::vector<VkCommandBuffer> current_cmds;
-    std::vector<std::string> cmdbuf_label_stack;
+    vvl::LabelStack cmdbuf_label_stack;
     std::string last_closed_cmdbuf_label;
     bool found_unbalanced_cmdbuf_label;
 
@@ -107,7 +107,7 @@ private:
         }
         for (const auto &command : cb_state.GetLabelCommands()) {
             if (command.begin) {
-                cmdbuf_label_stack.emplace_back(command.label_name);
+                cmdbuf_label_stack.push_back(command.label_name);
             } else {
                 if (cmdbuf_label_stack.empty()) {
                     found_unbalanced_cmdbuf_label = true;
@@ -573,6 +573,7 @@ bool CoreChecks::ValidatePrimaryCommandBufferState(
     const Location &loc, const vvl::CommandBuffer &cb_state, uint32_t current_submit_count,
     QFOTransferCBScoreboards<QFOImageTransferBarrier> *qfo_image_scoreboards,
     QFOTransferCBScoreboards<QFOBufferTransferBarrier> *qfo_buffer_scoreboards) const {
+    VVL_CheckStatsScope(dispatch_device_, "CoreChecks::ValidatePrimaryCommandBufferState");
 
     // Track in-use for resources off of primary and any secondary CBs
     bool skip = false;
@@ -486,6 +486,77 @@ bool CoreChecks::PreCallValidateGetAccelerationStructureDeviceAddressKHR(VkDevic
     return skip;
 }
 
+namespace {
+// The buffers at the device addresses a build reads its geometries from. Geometries often share their input buffers, so each
+// distinct address is looked up once, on a task pool when there are many of them.
+class BuildInputBuffers {
+  public:
+    BuildInputBuffers(const CoreChecks &validator, vvl::TaskPool &task_pool,
+                      const VkAccelerationStructureBuildGeometryInfoKHR &info) {
+        addresses_.reserve(info.geometryCount);
+        for (uint32_t geom_i = 0; geom_i < info.geometryCount; ++geom_i) {
+            const VkAccelerationStructureGeometryKHR &geom_data = rt::GetGeometry(info, geom_i);
+            switch (geom_data.geometryType) {
+                case VK_GEOMETRY_TYPE_TRIANGLES_KHR:
+                    AddAddress(geom_data.geometry.triangles.vertexData.deviceAddress);
+                    AddAddress(geom_data.geometry.triangles.indexData.deviceAddress);
+                    AddAddress(geom_data.geometry.triangles.transformData.deviceAddress);
+                    break;
+                case VK_GEOMETRY_TYPE_INSTANCES_KHR:
+                    AddAddress(geom_data.geometry.instances.data.deviceAddress);
+                    break;
+                case VK_GEOMETRY_TYPE_AABBS_KHR:
+                    AddAddress(geom_data.geometry.aabbs.data.deviceAddress);
+                    break;
+                default:
+                    break;
+            }
+        }
+        std::sort(addresses_.begin(), addresses_.end());
+        addresses_.erase(std::unique(addresses_.begin(), addresses_.end()), addresses_.end());
+
+        const uint32_t address_count = static_cast<uint32_t>(addresses_.size());
+        buffers_.resize(address_count);
+        constexpr uint32_t kMinParallelAddresses = 1024;
+        constexpr uint32_t kAddressesPerTask = 256;
+        if (address_count < kMinParallelAddresses) {
+            for (uint32_t i = 0; i < address_count; ++i) {
+                buffers_[i] = validator.GetBuffersByAddress(addresses_[i]);
+            }
+        } else {
+            // Each task writes its own elements of buffers_
+            const uint32_t task_count = (address_count + kAddressesPerTask - 1) / kAddressesPerTask;
+            task_pool.ParallelFor(task_count, [this, &validator, address_count](uint32_t task_i) {
+                const uint32_t end = std::min(address_count, (task_i + 1) * kAddressesPerTask);
+                for (uint32_t i = task_i * kAddressesPerTask; i < end; ++i) {
+                    buffers_[i] = validator.GetBuffersByAddress(addresses_[i]);
+                }
+            });
+        }
+    }
+
+    // Empty for a null address
+    vvl::span<vvl::Buffer *const> Find(VkDeviceAddress address) const {
+        const auto it = std::lower_bound(addresses_.begin(), addresses_.end(), address);
+        if (it == addresses_.end() || *it != address) {
+            return {};
+        }
+        const auto &buffers = buffers_[std::distance(addresses_.begin(), it)];
+        return {buffers.data(), buffers.size()};
+    }
+
+  private:
+    void AddAddress(VkDeviceAddress address) {
+        if (address != 0) {
+            addresses_.emplace_back(address);
+        }
+    }
+
+    std::vector<VkDeviceAddress> addresses_;  // Sorted, unique
+    std::vector<vvl::DeviceState::BufferAddressMapStore> buffers_;
+};
+}  // namespace
+
 bool CoreChecks::ValidateAccelerationBuffers(VkCommandBuffer cmd_buffer, uint32_t info_i,
                                              const VkAccelerationStructureBuildGeometryInfoKHR &info,
                                              const VkAccelerationStructureBuildRangeInfoKHR *geometry_build_ranges,
@@ -496,9 +567,12 @@ bool CoreChecks::ValidateAccelerationBuffers(VkCommandBuffer cmd_buffer, uint32_
         return info_loc.function == Func::vkCmdBuildAccelerationStructuresKHR ? direct_build_vu : indirect_build_vu;
     };
 
-    auto buffer_check = [this, &pick_vuid](uint32_t gi, const VkDeviceOrHostAddressConstKHR address,
-                                           const Location &geom_loc) -> bool {
-        const auto buffer_states = GetBuffersByAddress(address.deviceAddress);
+    // The lookups are done up front, the errors are still logged below in geometry order
+    const BuildInputBuffers input_buffers(*this, build_input_pool, info);
+
+    auto buffer_check = [this, &pick_vuid, &input_buffers](uint32_t gi, const VkDeviceOrHostAddressConstKHR address,
+                                                           const Location &geom_loc) -> bool {
+        const auto buffer_states = input_buffers.Find(address.deviceAddress);
         const bool no_valid_buffer_found =
             !buffer_states.empty() && std::none_of(buffer_states.begin(), buffer_states.end(), [](const vvl::Buffer *buffer_state) {
                 return buffer_state->usage & VK_BUFFER_USAGE_2_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR;
@@ -518,6 +592,12 @@ bool CoreChecks::ValidateAccelerationBuffers(VkCommandBuffer cmd_buffer, uint32_
         return false;
     };
 
+    auto address_check = [this, cmd_buffer, &input_buffers](const Location &address_loc, VkDeviceAddress address) -> bool {
+        BufferAddressValidation<0> buffer_address_validator = {};
+        return buffer_address_validator.ValidateDeviceAddress(*this, address_loc, LogObjectList(cmd_buffer), address,
+                                                              input_buffers.Find(address));
+    };
+
     const Location pp_build_range_info_loc(info_loc.function, Field::ppBuildRangeInfos, info_i);
     for (uint32_t geom_i = 0; geom_i < info.geometryCount; ++geom_i) {
         const Location p_geom_loc = info_loc.dot(info.pGeometries ? Field::pGeometries : Field::ppGeometries, geom_i);
@@ -544,8 +624,8 @@ bool CoreChecks::ValidateAccelerationBuffers(VkCommandBuffer cmd_buffer, uint32_
                                          cmd_buffer, p_geom_geom_triangles_loc.dot(Field::vertexData).dot(Field::deviceAddress),
                                          "is zero");
                     }
-                    skip |= ValidateDeviceAddress(p_geom_geom_triangles_loc.dot(Field::vertexData).dot(Field::deviceAddress),
-                                                  LogObjectList(cmd_buffer), geom_data.geometry.triangles.vertexData.deviceAddress);
+                    skip |= address_check(p_geom_geom_triangles_loc.dot(Field::vertexData).dot(Field::deviceAddress),
+                                          geom_data.geometry.triangles.vertexData.deviceAddress);
                 }
 
                 if (geom_data.geometry.triangles.indexType != VK_INDEX_TYPE_NONE_KHR) {
@@ -557,9 +637,8 @@ bool CoreChecks::ValidateAccelerationBuffers(VkCommandBuffer cmd_buffer, uint32_
                                              "is zero");
                         }
 
-                        skip |=
-                            ValidateDeviceAddress(p_geom_geom_triangles_loc.dot(Field::indexData).dot(Field::deviceAddress),
-                                                  LogObjectList(cmd_buffer), geom_data.geometry.triangles.indexData.deviceAddress);
+                        skip |= address_check(p_geom_geom_triangles_loc.dot(Field::indexData).dot(Field::deviceAddress),
+                                              geom_data.geometry.triangles.indexData.deviceAddress);
                     }
 
                     if (info_loc.function == Func::vkCmdBuildAccelerationStructuresKHR &&
@@ -622,9 +701,8 @@ bool CoreChecks::ValidateAccelerationBuffers(VkCommandBuffer cmd_buffer, uint32_
                     }
                 }
                 if (geom_data.geometry.triangles.transformData.deviceAddress != 0 && geometry_build_range_primitive_count > 0) {
-                    skip |=
-                        ValidateDeviceAddress(p_geom_geom_triangles_loc.dot(Field::transformData).dot(Field::deviceAddress),
-                                              LogObjectList(cmd_buffer), geom_data.geometry.triangles.transformData.deviceAddress);
+                    skip |= address_check(p_geom_geom_triangles_loc.dot(Field::transformData).dot(Field::deviceAddress),
+                                          geom_data.geometry.triangles.transformData.deviceAddress);
                 }
                 break;
             }
@@ -641,8 +719,8 @@ bool CoreChecks::ValidateAccelerationBuffers(VkCommandBuffer cmd_buffer, uint32_
                                          cmd_buffer, instances_data_loc.dot(Field::deviceAddress), "is zero");
                     }
 
-                    skip |= ValidateDeviceAddress(instances_data_loc.dot(Field::deviceAddress), LogObjectList(cmd_buffer),
-                                                  geom_data.geometry.instances.data.deviceAddress);
+                    skip |= address_check(instances_data_loc.dot(Field::deviceAddress),
+                                          geom_data.geometry.instances.data.deviceAddress);
                 }
                 break;
             }
@@ -660,8 +738,7 @@ bool CoreChecks::ValidateAccelerationBuffers(VkCommandBuffer cmd_buffer, uint32_
                                          cmd_buffer, aabbs_data_loc.dot(Field::deviceAddress), "is zero");
                     }
 
-                    skip |= ValidateDeviceAddress(aabbs_data_loc.dot(Field::deviceAddress), LogObjectList(cmd_buffer),
-                                                  geom_data.geometry.aabbs.data.deviceAddress);
+                    skip |= address_check(aabbs_data_loc.dot(Field::deviceAddress), geom_data.geometry.aabbs.data.deviceAddress);
                 }
                 break;
             }
@@ -378,6 +378,11 @@ bool CoreChecks::ValidateRenderPassCompatibility(const VulkanTypedHandle &rp1_ob
                                                  const Location &loc, const char *vuid) const {
     bool skip = false;
 
+    // Both canonicalized to the same definition, the field by field checks below are only needed to describe a mismatch
+    if (rp1_state.compat_id && rp1_state.compat_id == rp2_state.compat_id) {
+        return skip;
+    }
+
     // createInfo flags must be identical for the renderpasses to be compatible.
     if (rp1_state.create_info.flags != rp2_state.create_info.flags) {
         const LogObjectList objlist(rp1_object, rp1_state.Handle(), rp2_object, rp2_state.Handle());
@@ -2101,6 +2106,7 @@ bool CoreChecks::ValidateRenderpassAttachmentUsage(const VkRenderPassCreateInfo2
 }
 
 bool CoreChecks::ValidateRenderPassDAG(const VkRenderPassCreateInfo2 &create_info, const Location &create_info_loc) const {
+    VVL_CheckStatsScope(dispatch_device_, "CoreChecks::ValidateRenderPassDAG");
     bool skip = false;
     const char *vuid;
     const bool use_rp2 = create_info_loc.function != Func::vkCreateRenderPass;
@@ -35,6 +35,7 @@
 #include "state_tracker/cmd_buffer_state.h"
 #include "state_tracker/pipeline_state.h"
 #include "containers/limits.h"
+#include "utils/hash_util.h"
 #include "utils/vk_api_utils.h"
 
 bool CoreChecks::ValidateInterfaceVertexInput(const vvl::Pipeline &pipeline, const spirv::Module &module_state,
@@ -262,6 +263,34 @@ bool CoreChecks::ValidatePrimitiveTopology(const spirv::Module &module_state, co
 bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, const spirv::EntryPoint &producer_entrypoint,
                                                 const spirv::Module &consumer, const spirv::EntryPoint &consumer_entrypoint,
                                                 const Location &create_info_loc) const {
+    const uint64_t parts[] = {producer.GetCodeHash(),
+                              hash_util::Hash64(producer_entrypoint.name.data(), producer_entrypoint.name.size()),
+                              static_cast<uint64_t>(producer_entrypoint.execution_model),
+                              consumer.GetCodeHash(),
+                              hash_util::Hash64(consumer_entrypoint.name.data(), consumer_entrypoint.name.size()),
+                              static_cast<uint64_t>(consumer_entrypoint.execution_model)};
+    const uint64_t key = hash_util::Hash64(parts, sizeof(parts));
+    {
+        std::shared_lock<std::shared_mutex> guard(valid_stage_interfaces_lock);
+        if (valid_stage_interfaces.find(key) != valid_stage_interfaces.end()) {
+            return false;
+        }
+    }
+
+    const uint64_t message_count = DebugReport::GetThreadMessageCount();
+    const bool skip = ValidateInterfaceSlotsBetweenStages(producer, producer_entrypoint, consumer, consumer_entrypoint,
+                                                          create_info_loc);
+    // Messages are not cached, so a pair that logged anything (even if it was filtered out) is checked again the next time
+    if (DebugReport::GetThreadMessageCount() == message_count) {
+        std::unique_lock<std::shared_mutex> guard(valid_stage_interfaces_lock);
+        valid_stage_interfaces.insert(key);
+    }
+    return skip;
+}
+
+bool CoreChecks::ValidateInterfaceSlotsBetweenStages(const spirv::Module &producer, const spirv::EntryPoint &producer_entrypoint,
+                                                     const spirv::Module &consumer, const spirv::EntryPoint &consumer_entrypoint,
+                                                     const Location &create_info_loc) const {
     bool skip = false;
 
     if (producer_entrypoint.has_passthrough) {
@@ -724,13 +753,20 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const vvl::Pipeline &pipeli
     // if the shader stages are no good individually, cross-stage validation is pointless.
     if (skip) return true;
 
+    // When linking libraries, only the checks between states coming from different libraries are run
+    auto linked_from_same_library = [&pipeline](const PipelineSubState *a, const ShaderStageState *stage) {
+        return pipeline.LinkedFromSameLibrary(a, pipeline.ShaderStageSubState(stage->GetStage()));
+    };
+
     if (pipeline.vertex_input_state && vertex_stage && vertex_stage->entrypoint && vertex_stage->spirv_state &&
-        !pipeline.IsDynamic(CB_DYNAMIC_STATE_VERTEX_INPUT_EXT)) {
+        !pipeline.IsDynamic(CB_DYNAMIC_STATE_VERTEX_INPUT_EXT) &&
+        !linked_from_same_library(pipeline.vertex_input_state.get(), vertex_stage)) {
         skip |=
             ValidateInterfaceVertexInput(pipeline, *vertex_stage->spirv_state.get(), *vertex_stage->entrypoint, create_info_loc);
     }
 
-    if (pipeline.fragment_shader_state && fragment_stage && fragment_stage->entrypoint && fragment_stage->spirv_state) {
+    if (pipeline.fragment_shader_state && fragment_stage && fragment_stage->entrypoint && fragment_stage->spirv_state &&
+        !linked_from_same_library(pipeline.fragment_output_state.get(), fragment_stage)) {
         skip |= ValidateInterfaceFragmentOutput(pipeline, *fragment_stage->spirv_state.get(), *fragment_stage->entrypoint,
                                                 create_info_loc);
     }
@@ -786,7 +822,8 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const vvl::Pipeline &pipeli
             const std::shared_ptr<const spirv::Module> &consumer_spirv =
                 consumer.spirv_state ? consumer.spirv_state : consumer.module_state->spirv;
 
-            if (consumer_spirv && producer_spirv && consumer.entrypoint && producer.entrypoint) {
+            if (consumer_spirv && producer_spirv && consumer.entrypoint && producer.entrypoint &&
+                !linked_from_same_library(pipeline.ShaderStageSubState(producer.GetStage()), &consumer)) {
                 skip |= ValidateInterfaceBetweenStages(*producer_spirv.get(), *producer.entrypoint, *consumer_spirv.get(),
                                                        *consumer.entrypoint, create_info_loc);
             }
@@ -796,7 +833,8 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const vvl::Pipeline &pipeli
     }
 
     // Don't check any color attachments if rasterization is disabled
-    if (fragment_stage && fragment_stage->entrypoint && fragment_stage->spirv_state && !pipeline.RasterizationDisabled()) {
+    if (fragment_stage && fragment_stage->entrypoint && fragment_stage->spirv_state && !pipeline.RasterizationDisabled() &&
+        !linked_from_same_library(pipeline.fragment_output_state.get(), fragment_stage)) {
         const auto &rp_state = pipeline.RenderPassState();
         // Dynamic Rendering is done at draw time incase the user has VK_EXT_dynamic_rendering_unused_attachments we can't do all
         // the checks at this time
@@ -806,8 +844,9 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const vvl::Pipeline &pipeli
         }
     }
 
+    // Both are pre-rasterization shaders
     if (tesc_stage && tesc_stage->spirv_state && tesc_stage->entrypoint && tese_stage && tese_stage->spirv_state &&
-        tese_stage->entrypoint) {
+        tese_stage->entrypoint && !linked_from_same_library(pipeline.pre_raster_state.get(), tesc_stage)) {
         skip |= ValidatePipelineTessellationStages(*tesc_stage->spirv_state, *tesc_stage->entrypoint, *tese_stage->spirv_state,
                                                    *tese_stage->entrypoint, create_info_loc);
     }
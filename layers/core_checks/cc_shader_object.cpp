@@ -436,6 +436,15 @@ bool CoreChecks::PreCallValidateDestroyShaderEXT(VkDevice device, VkShaderEXT sh
     return skip;
 }
 
+void CoreChecks::PreCallRecordDestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks* pAllocator,
+                                               const RecordObject& record_obj) {
+    if (shader == VK_NULL_HANDLE) {
+        return;
+    }
+    std::unique_lock<std::shared_mutex> guard(valid_shader_object_combinations_lock);
+    valid_shader_object_combinations.clear();
+}
+
 bool CoreChecks::PreCallValidateCmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCount,
                                                   const VkShaderStageFlagBits* pStages, const VkShaderEXT* pShaders,
                                                   const ErrorObject& error_obj) const {
@@ -673,11 +682,42 @@ bool CoreChecks::ValidateDrawShaderObject(const LastBound& last_bound_state, con
         }
     }
 
-    skip |= ValidateDrawShaderObjectNextStage(last_bound_state, vuid);
+    skip |= ValidateDrawShaderObjectCombination(last_bound_state, vuid);
     skip |= ValidateDrawShaderObjectBoundShader(last_bound_state, vuid);
+    skip |= ValidateDrawShaderObjectMesh(last_bound_state, vuid);
+    return skip;
+}
+
+// These checks only depend on which shader objects are bound, not on the draw command or the rest of the command buffer state
+bool CoreChecks::ValidateDrawShaderObjectCombination(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const {
+    ShaderObjectCombination combination{};
+    uint64_t bound_mask = 0;
+    for (uint32_t i = 0; i < kShaderObjectStageCount; ++i) {
+        if (const vvl::ShaderObject* shader_state = last_bound_state.shader_object_states[i]) {
+            combination[i] = HandleToUint64(shader_state->VkHandle());
+        }
+        if (last_bound_state.shader_object_bound[i]) {
+            bound_mask |= 1ull << i;
+        }
+    }
+    combination[kShaderObjectStageCount] = bound_mask;
+    {
+        std::shared_lock<std::shared_mutex> guard(valid_shader_object_combinations_lock);
+        if (valid_shader_object_combinations.find(combination) != valid_shader_object_combinations.end()) {
+            return false;
+        }
+    }
+
+    bool skip = false;
+    const uint64_t message_count = DebugReport::GetThreadMessageCount();
+    skip |= ValidateDrawShaderObjectNextStage(last_bound_state, vuid);
     skip |= ValidateDrawShaderObjectLinking(last_bound_state, vuid);
     skip |= ValidateDrawShaderObjectPushConstantAndLayout(last_bound_state, vuid);
-    skip |= ValidateDrawShaderObjectMesh(last_bound_state, vuid);
+    // Messages are not cached, so a combination that logged anything (even if it was filtered out) is checked at every draw
+    if (DebugReport::GetThreadMessageCount() == message_count) {
+        std::unique_lock<std::shared_mutex> guard(valid_shader_object_combinations_lock);
+        valid_shader_object_combinations.insert(combination);
+    }
     return skip;
 }
 
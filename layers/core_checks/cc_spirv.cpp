@@ -17,9 +17,11 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
 #include <cstdint>
+#include <optional>
 #include <spirv/unified1/spirv.hpp>
 #include <sstream>
 #include <string>
@@ -1747,9 +1749,37 @@ bool CoreChecks::ValidateShaderTileImage(const spirv::Module &module_state, cons
     return skip;
 }
 
+uint64_t CoreChecks::GetSpecializationKey(const spirv::Module &module_state, const spirv::EntryPoint &entrypoint,
+                                          const std::unordered_map<uint32_t, std::vector<uint32_t>> &id_value_map) {
+    std::vector<uint32_t> key_data;
+    auto add_hash = [&key_data](uint64_t hash) {
+        key_data.emplace_back(static_cast<uint32_t>(hash));
+        key_data.emplace_back(static_cast<uint32_t>(hash >> 32));
+    };
+    add_hash(module_state.GetCodeHash());
+    add_hash(hash_util::Hash64(entrypoint.name.data(), entrypoint.name.size()));
+    key_data.emplace_back(entrypoint.stage);
+
+    // Sorted so that the key does not depend on the order of the map entries
+    std::vector<uint32_t> constant_ids;
+    constant_ids.reserve(id_value_map.size());
+    for (const auto &entry : id_value_map) {
+        constant_ids.emplace_back(entry.first);
+    }
+    std::sort(constant_ids.begin(), constant_ids.end());
+    for (uint32_t constant_id : constant_ids) {
+        const std::vector<uint32_t> &value = id_value_map.at(constant_id);
+        key_data.emplace_back(constant_id);
+        key_data.emplace_back(static_cast<uint32_t>(value.size()));
+        key_data.insert(key_data.end(), value.begin(), value.end());
+    }
+    return hash_util::Hash64(key_data.data(), key_data.size() * sizeof(uint32_t));
+}
+
 // Validate the VkPipelineShaderStageCreateInfo from the various pipeline types or a Shader Object
 bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const vvl::Pipeline *pipeline,
                                      const Location &loc) const {
+    VVL_CheckStatsScope(dispatch_device_, "CoreChecks::ValidateShaderStage");
     bool skip = false;
     const VkShaderStageFlagBits stage = stage_state.GetStage();
 
@@ -1771,14 +1801,16 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
 
     const spirv::Module &module_state = *stage_state.spirv_state.get();
     if (!module_state.valid_spirv) return skip;  // checked elsewhere
+    // spirv-val reported an error, which would have skipped vkCreateShaderModule if it had been run in it
+    if (!WaitForDeferredSpirvValidation(module_state)) return true;
 
     if (!stage_state.entrypoint) {
         const char *vuid = pipeline ? "VUID-VkPipelineShaderStageCreateInfo-pName-00707" : "VUID-VkShaderCreateInfoEXT-pName-08440";
         std::stringstream err;
         err << "\"" << stage_state.GetPName() << "\" entry point not found for stage " << string_VkShaderStageFlagBits(stage)
             << ".";
-        if (stage_state.spirv_state->static_data_.entry_points.size() == 1) {
-            auto entry_point = stage_state.spirv_state->static_data_.entry_points[0];
+        if (stage_state.spirv_state->GetEntryPointCount() == 1) {
+            auto entry_point = stage_state.spirv_state->GetEntryPoint(0);
             if (entry_point) {
                 err << " (The only entry point found was \"" << entry_point->name << "\" for "
                     << string_VkShaderStageFlagBits(entry_point->stage) << ")";
@@ -1790,7 +1822,7 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
             }
         } else {
             err << " The following entry points were found in the SPIR-V module:\n";
-            for (const auto &entry_point : stage_state.spirv_state->static_data_.entry_points) {
+            for (const auto &entry_point : stage_state.spirv_state->GetEntryPoints()) {
                 if (!entry_point) continue;
                 err << "\"" << entry_point->name << "\"\t(" << string_VkShaderStageFlagBits(entry_point->stage) << ")\n";
             }
@@ -1806,26 +1838,17 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
 
     // If specialization-constant instructions are present in the shader, the specializations should be applied.
     if (module_state.static_data_.has_specialization_constants) {
-        // setup the call back if the optimizer fails
-        spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(extensions.vk_khr_spirv_1_4));
-        spvtools::Optimizer optimizer(spirv_environment);
-        spvtools::MessageConsumer consumer = [&skip, &module_state, &stage, loc, this](
-                                                 spv_message_level_t level, const char *source, const spv_position_t &position,
-                                                 const char *message) {
-            skip |= LogError("VUID-VkPipelineShaderStageCreateInfo-module-parameter", device, loc,
-                             "%s failed in spirv-opt because it does not contain valid spirv for stage %s. %s",
-                             FormatHandle(module_state.handle()).c_str(), string_VkShaderStageFlagBits(stage), message);
-        };
-        optimizer.SetMessageConsumer(consumer);
+        const uint64_t message_count = DebugReport::GetThreadMessageCount();
 
         // The app might be using the default spec constant values, but if they pass values at runtime to the pipeline then need to
         // use those values to apply to the spec constants
         auto const &specialization_info = stage_state.GetSpecializationInfo();
-        if (specialization_info != nullptr && specialization_info->mapEntryCount > 0 &&
-            specialization_info->pMapEntries != nullptr) {
+        const bool has_specialization_values =
+            specialization_info != nullptr && specialization_info->mapEntryCount > 0 && specialization_info->pMapEntries != nullptr;
+        std::unordered_map<uint32_t, std::vector<uint32_t>> id_value_map;  // note: this must be std:: to work with spvtools
+        if (has_specialization_values) {
             // Gather the specialization-constant values.
             auto const &specialization_data = reinterpret_cast<uint8_t const *>(specialization_info->pData);
-            std::unordered_map<uint32_t, std::vector<uint32_t>> id_value_map;  // note: this must be std:: to work with spvtools
             id_value_map.reserve(specialization_info->mapEntryCount);
 
             // spirv-val makes sure every OpSpecConstant has a OpDecoration.
@@ -1890,74 +1913,111 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
                     id_value_map.emplace(map_entry.constantID, std::move(entry_data));
                 }
             }
+        }
 
-            // This pass takes the runtime spec const values and applies it into the SPIR-V
-            // will turn a spec constant like
-            //     OpSpecConstant %uint 1
-            // to a use the value passed in instead (for example if the value is 32) so now it looks like
-            //     OpSpecConstant %uint 32
-            optimizer.RegisterPass(spvtools::CreateSetSpecConstantDefaultValuePass(id_value_map));
-        }
-
-        // This pass will turn OpSpecConstant into a OpConstant (also OpSpecConstantTrue/OpSpecConstantFalse)
-        optimizer.RegisterPass(spvtools::CreateFreezeSpecConstantValuePass());
-        // Using the new frozen OpConstant all OpSpecConstantComposite can be resolved turning them into OpConstantComposite
-        // This is need incase a shdaer looks like:
-        //
-        //     layout(constant_id = 0) const uint x = 64;
-        //     shared uint arr[x > 64 ? 64 : x];
-        //
-        // this will generate branch/switch statements that we want to leverage spirv-opt to apply to make parsing easier
-        optimizer.RegisterPass(spvtools::CreateFoldSpecConstantOpAndCompositePass());
-
-        // Apply the specialization-constant values and revalidate the shader module is valid.
-        std::vector<uint32_t> specialized_spirv;
-        auto const optimized =
-            optimizer.Run(module_state.words_.data(), module_state.words_.size(), &specialized_spirv, spirv_val_options, true);
-        if (optimized) {
-            spv_context ctx = spvContextCreate(spirv_environment);
-            spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
-            spv_diagnostic diag = nullptr;
-            auto const spv_valid = spvValidateWithOptions(ctx, spirv_val_options, &binary, &diag);
-            if (spv_valid != SPV_SUCCESS) {
-                const char *vuid = pipeline ? "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06849"
-                                            : "VUID-VkShaderCreateInfoEXT-pCode-08460";
-                std::string name = pipeline ? FormatHandle(module_state.handle()) : "shader object";
-                skip |= LogError(vuid, device, loc,
-                                 "After specialization was applied, %s produces a spirv-val error (stage %s):\n%s", name.c_str(),
-                                 string_VkShaderStageFlagBits(stage), diag && diag->error ? diag->error : "(no error text)");
+        const uint64_t specialization_key = GetSpecializationKey(module_state, entrypoint, id_value_map);
+        std::optional<SpecializedStageInfo> specialized_info;
+        {
+            std::shared_lock<std::shared_mutex> guard(specialized_stage_cache_lock);
+            auto it = specialized_stage_cache.find(specialization_key);
+            if (it != specialized_stage_cache.end()) {
+                specialized_info = it->second;
+            }
+        }
+        if (specialized_info) {
+            local_size = specialized_info->local_size;
+            total_workgroup_shared_memory = specialized_info->total_workgroup_shared_memory;
+            total_task_payload_memory = specialized_info->total_task_payload_memory;
+        } else {
+            // setup the call back if the optimizer fails
+            spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(extensions.vk_khr_spirv_1_4));
+            spvtools::Optimizer optimizer(spirv_environment);
+            spvtools::MessageConsumer consumer = [&skip, &module_state, &stage, loc, this](
+                                                     spv_message_level_t level, const char *source, const spv_position_t &position,
+                                                     const char *message) {
+                skip |= LogError("VUID-VkPipelineShaderStageCreateInfo-module-parameter", device, loc,
+                                 "%s failed in spirv-opt because it does not contain valid spirv for stage %s. %s",
+                                 FormatHandle(module_state.handle()).c_str(), string_VkShaderStageFlagBits(stage), message);
+            };
+            optimizer.SetMessageConsumer(consumer);
+
+            if (has_specialization_values) {
+                // This pass takes the runtime spec const values and applies it into the SPIR-V
+                // will turn a spec constant like
+                //     OpSpecConstant %uint 1
+                // to a use the value passed in instead (for example if the value is 32) so now it looks like
+                //     OpSpecConstant %uint 32
+                optimizer.RegisterPass(spvtools::CreateSetSpecConstantDefaultValuePass(id_value_map));
             }
 
-            // The new optimized SPIR-V will NOT match the original spirv::Module object parsing, so a new spirv::Module
-            // object is needed. This an issue due to each pipeline being able to reuse the same shader module but with different
-            // spec constant values.
-            spirv::Module spec_mod(vvl::make_span<const uint32_t>(specialized_spirv.data(), specialized_spirv.size()));
+            // This pass will turn OpSpecConstant into a OpConstant (also OpSpecConstantTrue/OpSpecConstantFalse)
+            optimizer.RegisterPass(spvtools::CreateFreezeSpecConstantValuePass());
+            // Using the new frozen OpConstant all OpSpecConstantComposite can be resolved turning them into OpConstantComposite
+            // This is need incase a shdaer looks like:
+            //
+            //     layout(constant_id = 0) const uint x = 64;
+            //     shared uint arr[x > 64 ? 64 : x];
+            //
+            // this will generate branch/switch statements that we want to leverage spirv-opt to apply to make parsing easier
+            optimizer.RegisterPass(spvtools::CreateFoldSpecConstantOpAndCompositePass());
+
+            // Apply the specialization-constant values and revalidate the shader module is valid.
+            std::vector<uint32_t> specialized_spirv;
+            auto const optimized =
+                optimizer.Run(module_state.words_.data(), module_state.words_.size(), &specialized_spirv, spirv_val_options, true);
+            if (optimized) {
+                spv_context ctx = spvContextCreate(spirv_environment);
+                spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
+                spv_diagnostic diag = nullptr;
+                auto const spv_valid = spvValidateWithOptions(ctx, spirv_val_options, &binary, &diag);
+                if (spv_valid != SPV_SUCCESS) {
+                    const char *vuid = pipeline ? "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06849"
+                                                : "VUID-VkShaderCreateInfoEXT-pCode-08460";
+                    std::string name = pipeline ? FormatHandle(module_state.handle()) : "shader object";
+                    skip |= LogError(vuid, device, loc,
+                                     "After specialization was applied, %s produces a spirv-val error (stage %s):\n%s",
+                                     name.c_str(), string_VkShaderStageFlagBits(stage),
+                                     diag && diag->error ? diag->error : "(no error text)");
+                }
+
+                // The new optimized SPIR-V will NOT match the original spirv::Module object parsing, so a new spirv::Module
+                // object is needed. This an issue due to each pipeline being able to reuse the same shader module but with
+                // different spec constant values.
+                spirv::Module spec_mod(vvl::make_span<const uint32_t>(specialized_spirv.data(), specialized_spirv.size()));
 
-            // According to https://github.com/KhronosGroup/Vulkan-Docs/issues/1671 anything labeled as "static use" (such as if an
-            // input is used or not) don't have to be checked post spec constants freezing since the device compiler is not
-            // guaranteed to run things such as dead-code elimination. The following checks are things that don't follow under
-            // "static use" rules and need to be validated still.
+                // According to https://github.com/KhronosGroup/Vulkan-Docs/issues/1671 anything labeled as "static use" (such as
+                // if an input is used or not) don't have to be checked post spec constants freezing since the device compiler is
+                // not guaranteed to run things such as dead-code elimination. The following checks are things that don't follow
+                // under "static use" rules and need to be validated still.
 
-            const auto spec_entrypoint = spec_mod.FindEntrypoint(entrypoint.name.c_str(), entrypoint.stage);
-            assert(spec_entrypoint);  // spirv-opt won't change Entrypoint Name/stage
+                const auto spec_entrypoint = spec_mod.FindEntrypoint(entrypoint.name.c_str(), entrypoint.stage);
+                assert(spec_entrypoint);  // spirv-opt won't change Entrypoint Name/stage
 
-            local_size = spec_mod.FindLocalSize(*spec_entrypoint);
+                local_size = spec_mod.FindLocalSize(*spec_entrypoint);
 
-            total_workgroup_shared_memory = spec_mod.CalculateWorkgroupSharedMemory();
+                total_workgroup_shared_memory = spec_mod.CalculateWorkgroupSharedMemory();
 
-            if ((stage == VK_SHADER_STAGE_TASK_BIT_EXT || stage == VK_SHADER_STAGE_MESH_BIT_EXT)) {
-                total_task_payload_memory = spec_mod.CalculateTaskPayloadMemory();
+                if ((stage == VK_SHADER_STAGE_TASK_BIT_EXT || stage == VK_SHADER_STAGE_MESH_BIT_EXT)) {
+                    total_task_payload_memory = spec_mod.CalculateTaskPayloadMemory();
+                }
+
+                spvDiagnosticDestroy(diag);
+                spvContextDestroy(ctx);
+            } else {
+                // Should never get here, but better then asserting
+                const char *vuid = pipeline ? "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06849"
+                                            : "VUID-VkShaderCreateInfoEXT-pCode-08460";
+                skip |= LogError(vuid, device, loc,
+                                 "%s shader (stage %s) attempted to apply specialization constants with spirv-opt but failed.",
+                                 FormatHandle(module_state.handle()).c_str(), string_VkShaderStageFlagBits(stage));
             }
 
-            spvDiagnosticDestroy(diag);
-            spvContextDestroy(ctx);
-        } else {
-            // Should never get here, but better then asserting
-            const char *vuid = pipeline ? "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06849"
-                                        : "VUID-VkShaderCreateInfoEXT-pCode-08460";
-            skip |= LogError(vuid, device, loc,
-                             "%s shader (stage %s) attempted to apply specialization constants with spirv-opt but failed.",
-                             FormatHandle(module_state.handle()).c_str(), string_VkShaderStageFlagBits(stage));
+            // Messages are not cached, so a specialization that logged anything (even if it was filtered out) is redone next time
+            if (DebugReport::GetThreadMessageCount() == message_count) {
+                std::unique_lock<std::shared_mutex> guard(specialized_stage_cache_lock);
+                specialized_stage_cache.emplace(
+                    specialization_key, SpecializedStageInfo{local_size, total_workgroup_shared_memory, total_task_payload_memory});
+            }
         }
 
         if (skip) {
@@ -2123,8 +2183,63 @@ void CoreChecks::PreCallRecordCreateShaderModule(VkDevice device, const VkShader
                                                  const RecordObject &record_obj, chassis::CreateShaderModule &chassis_state) {
     // Normally would validate in PreCallValidate, but need a non-const function to update chassis_state
     // This is on the stack, we don't have to worry about threading hazards and this could be moved and used const_cast
-    chassis_state.skip |=
-        stateless_spirv_validator.Validate(*chassis_state.module_state, chassis_state.stateless_data, record_obj.location);
+    chassis_state.skip |= ValidateSpirvStateless(*chassis_state.module_state, chassis_state.stateless_data, record_obj.location);
+
+    // ValidateShaderModuleCreateInfo() left spirv-val for later
+    if (chassis_state.module_state && chassis_state.module_state->valid_spirv && CanDeferSpirvValidation(*pCreateInfo)) {
+        auto deferred = std::make_shared<DeferredSpirvValidation>();
+        deferred->module_state = chassis_state.module_state;
+        // The module words can be a flattened version of the code
+        deferred->code.assign(pCreateInfo->pCode, pCreateInfo->pCode + pCreateInfo->codeSize / sizeof(uint32_t));
+        {
+            std::unique_lock<std::mutex> guard(deferred_spirv_validation_lock);
+            deferred_spirv_validation_map[chassis_state.module_state.get()] = deferred;
+        }
+        spirv_validation_queue->Post([this, deferred]() { RunDeferredSpirvValidation(*deferred); });
+    }
+}
+
+bool CoreChecks::CanDeferSpirvValidation(const VkShaderModuleCreateInfo &create_info) const {
+    // The worker can not use a validation cache of the application, which could be destroyed before it runs
+    return spirv_validation_queue && !disabled[shader_validation] && !global_settings.debug_disable_spirv_val &&
+           !vku::FindStructInPNextChain<VkShaderModuleValidationCacheCreateInfoEXT>(create_info.pNext);
+}
+
+void CoreChecks::RunDeferredSpirvValidation(DeferredSpirvValidation &deferred) const {
+    std::call_once(deferred.once, [this, &deferred]() {
+        const Location loc(Func::vkCreateShaderModule);
+        spv_const_binary_t binary{deferred.code.data(), deferred.code.size()};
+        ValidationCache *cache = CastFromHandle<ValidationCache *>(core_validation_cache);
+        // As with the synchronous check, a module which error was filtered out is still validated further
+        deferred.valid = !RunSpirvValidation(binary, loc.dot(Field::pCreateInfo), cache);
+        deferred.code = {};
+    });
+
+    if (deferred.valid) {
+        std::unique_lock<std::mutex> guard(deferred_spirv_validation_lock);
+        auto it = deferred_spirv_validation_map.find(deferred.module_state.get());
+        if (it != deferred_spirv_validation_map.end() && it->second.get() == &deferred) {
+            deferred_spirv_validation_map.erase(it);
+        }
+    }
+}
+
+bool CoreChecks::WaitForDeferredSpirvValidation(const spirv::Module &module_state) const {
+    if (!spirv_validation_queue) {
+        return true;
+    }
+    std::shared_ptr<DeferredSpirvValidation> deferred;
+    {
+        std::unique_lock<std::mutex> guard(deferred_spirv_validation_lock);
+        auto it = deferred_spirv_validation_map.find(&module_state);
+        if (it == deferred_spirv_validation_map.end()) {
+            return true;
+        }
+        deferred = it->second;
+    }
+    // Runs it here if no worker started it yet, otherwise waits for the worker
+    RunDeferredSpirvValidation(*deferred);
+    return deferred->valid;
 }
 
 void CoreChecks::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT *pCreateInfos,
@@ -2133,12 +2248,35 @@ void CoreChecks::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createI
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         // Will be empty if not VK_SHADER_CODE_TYPE_SPIRV_EXT
         if (chassis_state.module_states[i]) {
-            chassis_state.skip |= stateless_spirv_validator.Validate(
-                *chassis_state.module_states[i], chassis_state.stateless_data[i], record_obj.location.dot(Field::pCreateInfos, i));
+            chassis_state.skip |= ValidateSpirvStateless(*chassis_state.module_states[i], chassis_state.stateless_data[i],
+                                                         record_obj.location.dot(Field::pCreateInfos, i));
         }
     }
 }
 
+bool CoreChecks::ValidateSpirvStateless(const spirv::Module &module_state, const spirv::StatelessData &stateless_data,
+                                        const Location &loc) const {
+    VVL_CheckStatsScope(dispatch_device_, "CoreChecks::ValidateSpirvStateless");
+    // Only the layer managed cache, it is saved with the device and the results are only valid for this device
+    ValidationCache *cache = CastFromHandle<ValidationCache *>(core_validation_cache);
+    if (!cache || !module_state.valid_spirv) {
+        return stateless_spirv_validator.Validate(module_state, stateless_data, loc);
+    }
+
+    const uint64_t key =
+        ValidationCache::GetModuleCheckKey(module_state.words_.data(), module_state.words_.size(), spirv_module_check_hash);
+    if (cache->ContainsCheckedModule(key)) {
+        return false;
+    }
+    const uint64_t message_count = DebugReport::GetThreadMessageCount();
+    const bool skip = stateless_spirv_validator.Validate(module_state, stateless_data, loc);
+    // Messages are not cached, so a module that logged anything (even if it was filtered out) is checked again the next time
+    if (DebugReport::GetThreadMessageCount() == message_count) {
+        cache->InsertCheckedModule(key);
+    }
+    return skip;
+}
+
 bool CoreChecks::RunSpirvValidation(spv_const_binary_t &binary, const Location &loc, ValidationCache *cache) const {
     bool skip = false;
 
@@ -2245,6 +2383,9 @@ bool CoreChecks::ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo &
             cache = CastFromHandle<ValidationCache *>(core_validation_cache);
         }
 
+        if (create_info_loc.function == Func::vkCreateShaderModule && CanDeferSpirvValidation(create_info)) {
+            return skip;  // PreCallRecordCreateShaderModule() queues it
+        }
         spv_const_binary_t binary{create_info.pCode, create_info.codeSize / sizeof(uint32_t)};
         skip |= RunSpirvValidation(binary, create_info_loc, cache);
     }
@@ -66,6 +66,17 @@ void CommandBufferSubState::Begin(const VkCommandBufferBeginInfo& begin_info) {
     }
 }
 
+void CommandBufferSubState::End() {
+    if (!deferred_checks.empty()) {
+        validator.deferred_check_pool.ParallelFor(static_cast<uint32_t>(deferred_checks.size()),
+                                                  [this](uint32_t i) { deferred_checks[i](); });
+        deferred_checks.clear();
+    }
+    if (base.IsSecondary()) {
+        execute_summary = std::make_shared<const ExecuteSummary>(ExecuteSummary{queue_submit_functions, event_updates});
+    }
+}
+
 void CommandBufferSubState::UpdateActionPipelineState(LastBound& last_bound, const vvl::Pipeline& pipeline_state) {
     // Update the consumed viewport/scissor count.
     {
@@ -109,12 +120,10 @@ void CommandBufferSubState::UpdateActionPipelineState(LastBound& last_bound, con
 
             // We can skip updating the state if "nothing" has changed since the last validation.
             // See CoreChecks::ValidateActionState for more details.
-            const bool need_update =  // Update if descriptor set (or contents) has changed
-                ds_slot.validated_set != descriptor_set.get() ||
-                ds_slot.validated_set_change_count != descriptor_set->GetChangeCount() ||
-                (!base.dev_data.disabled[image_layout_validation] &&
-                 ds_slot.validated_set_image_layout_change_count != base.image_layout_change_count);
-            if (need_update) {
+            const bool disabled_image_layout_validation = base.dev_data.disabled[image_layout_validation];
+            const DescriptorSetValidationKey key =
+                last_bound.GetValidationKey(*descriptor_set, binding_req_map, disabled_image_layout_validation);
+            if (ds_slot.validated != key && !IsDescriptorSetValidated(key)) {
                 if (!base.dev_data.disabled[command_buffer_state] && !descriptor_set->IsPushDescriptor()) {
                     base.AddChild(descriptor_set);
                 }
@@ -122,19 +131,27 @@ void CommandBufferSubState::UpdateActionPipelineState(LastBound& last_bound, con
                 // Bind this set and its active descriptor resources to the command buffer
                 descriptor_set->UpdateImageLayoutDrawStates(&base.dev_data, base, binding_req_map);
 
-                ds_slot.validated_set = descriptor_set.get();
-                ds_slot.validated_set_change_count = descriptor_set->GetChangeCount();
-                ds_slot.validated_set_image_layout_change_count = base.image_layout_change_count;
+                // Taken again as the image layouts can have changed
+                ds_slot.validated = last_bound.GetValidationKey(*descriptor_set, binding_req_map, disabled_image_layout_validation);
+                AddValidatedDescriptorSet(key);
+                if (ds_slot.validated != key) {
+                    AddValidatedDescriptorSet(ds_slot.validated);
+                }
             }
         }
     }
 }
 
 // Common logic after any draw/dispatch/traceRays
-void CommandBufferSubState::RecordActionCommand(LastBound& last_bound, const Location&) {
+void CommandBufferSubState::RecordActionCommand(LastBound& last_bound, const Location& loc) {
     if (last_bound.pipeline_state) {
         UpdateActionPipelineState(last_bound, *last_bound.pipeline_state);
     }
+    // Only reached if the command passed validation
+    if (last_bound.bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+        validated_graphics_command = loc.function;
+        validated_graphics_state = base.graphics_state_change_count;
+    }
 }
 
 void CommandBufferSubState::RecordBindPipeline(VkPipelineBindPoint bind_point, vvl::Pipeline& pipeline) {
@@ -224,6 +241,9 @@ void CommandBufferSubState::RecordEndRenderPass(const VkSubpassEndInfo*, const L
 template <typename RegionType>
 void CommandBufferSubState::RecordCopyBufferCommon(vvl::Buffer& src_buffer_state, vvl::Buffer& dst_buffer_state,
                                                    uint32_t region_count, const RegionType* regions, const Location& loc) {
+    if (validator.global_settings.deferred_command_validation) {
+        validator.EnqueueValidateCmdCopyBufferBounds(*this, src_buffer_state, dst_buffer_state, region_count, regions, loc);
+    }
     if (region_count == 0 || (!src_buffer_state.sparse && !dst_buffer_state.sparse)) {
         return;
     }
@@ -501,27 +521,40 @@ void CommandBufferSubState::RecordSetEvent(VkEvent event, VkPipelineStageFlags2
         // Set sType to invalid, so following code can check sType to see if the struct is valid
         safe_dependency_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
     }
-    event_updates.emplace_back([event, stage_mask, safe_dependency_info](vvl::CommandBuffer&, bool do_validate,
-                                                                         EventMap& local_event_signal_info, VkQueue,
-                                                                         const Location& loc) {
-        local_event_signal_info[event] = EventInfo{stage_mask, true, safe_dependency_info};
+    auto event_state = base.dev_data.Get<vvl::Event>(event);
+    if (!event_state) {
+        return;
+    }
+    event_updates.emplace_back([event_state, stage_mask, safe_dependency_info](vvl::CommandBuffer&, bool do_validate,
+                                                                               EventMap& local_event_signal_info, VkQueue,
+                                                                               const Location& loc) {
+        local_event_signal_info.Set(*event_state, EventInfo{stage_mask, true, safe_dependency_info});
         return false;  // skip
     });
 }
 
 void CommandBufferSubState::RecordResetEvent(VkEvent event, VkPipelineStageFlags2) {
+    auto event_state = base.dev_data.Get<vvl::Event>(event);
+    if (!event_state) {
+        return;
+    }
     event_updates.emplace_back(
-        [event](vvl::CommandBuffer&, bool do_validate, EventMap& local_event_signal_info, VkQueue, const Location& loc) {
-            local_event_signal_info[event] = EventInfo{VK_PIPELINE_STAGE_2_NONE, false};
+        [event_state](vvl::CommandBuffer&, bool do_validate, EventMap& local_event_signal_info, VkQueue, const Location& loc) {
+            local_event_signal_info.Set(*event_state, EventInfo{VK_PIPELINE_STAGE_2_NONE, false});
             return false;  // skip
         });
 }
 
 void CommandBufferSubState::RecordWaitEvents(uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags2 src_stage_mask,
                                              const VkDependencyInfo* dependency_info, const Location& loc) {
-    // vvl::CommandBuffer will add to the events vector. TODO this is now incorrect
-    auto first_event_index = base.events.size();
-    auto event_added_count = eventCount;
+    // Resolved once here rather than on every submission of the command buffer
+    std::vector<std::shared_ptr<vvl::Event>> wait_events;
+    wait_events.reserve(eventCount);
+    for (uint32_t i = 0; i < eventCount; ++i) {
+        if (auto event_state = base.dev_data.Get<vvl::Event>(pEvents[i])) {
+            wait_events.emplace_back(std::move(event_state));
+        }
+    }
 
     vku::safe_VkDependencyInfo safe_dependency_info = {};
     if (dependency_info) {
@@ -532,11 +565,11 @@ void CommandBufferSubState::RecordWaitEvents(uint32_t eventCount, const VkEvent*
     }
 
     event_updates.emplace_back(
-        [event_added_count, first_event_index, src_stage_mask, safe_dependency_info](
+        [wait_events = std::move(wait_events), src_stage_mask, safe_dependency_info](
             vvl::CommandBuffer& cb_state, bool do_validate, EventMap& local_event_signal_info, VkQueue queue, const Location& loc) {
             if (!do_validate) return false;
-            return CoreChecks::ValidateWaitEventsAtSubmit(cb_state, event_added_count, first_event_index, src_stage_mask,
-                                                          safe_dependency_info, local_event_signal_info, queue, loc);
+            return CoreChecks::ValidateWaitEventsAtSubmit(cb_state, wait_events, src_stage_mask, safe_dependency_info,
+                                                          local_event_signal_info, queue, loc);
         });
 }
 
@@ -570,8 +603,12 @@ void CommandBufferSubState::RecordBarriers2(const VkDependencyInfo& dep_info, co
         const BufferBarrier barrier(dep_info.pBufferMemoryBarriers[i]);
         validator.RecordBarrierValidationInfo(barrier_loc, base, barrier, qfo_transfer_buffer_barriers);
     }
+    // Barriers of the same image are usually next to each other, it is only looked up once
+    std::shared_ptr<vvl::Image> image_state;
     for (uint32_t i = 0; i < dep_info.imageMemoryBarrierCount; i++) {
-        auto image_state = base.dev_data.Get<vvl::Image>(dep_info.pImageMemoryBarriers[i].image);
+        if (!image_state || image_state->VkHandle() != dep_info.pImageMemoryBarriers[i].image) {
+            image_state = base.dev_data.Get<vvl::Image>(dep_info.pImageMemoryBarriers[i].image);
+        }
         ASSERT_AND_CONTINUE(image_state);
 
         Location barrier_loc(loc.function, vvl::Struct::VkImageMemoryBarrier2, vvl::Field::pImageMemoryBarriers, i);
@@ -585,18 +622,6 @@ void CommandBufferSubState::RecordBarriers2(const VkDependencyInfo& dep_info, co
     }
 }
 
-static void SetQueryState(const QueryObject& object, QueryState value, QueryMap* local_query_to_state_map) {
-    (*local_query_to_state_map)[object] = value;
-}
-
-static void SetQueryStateMulti(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, uint32_t perf_query_pass,
-                               QueryState value, QueryMap* local_query_to_state_map) {
-    for (uint32_t i = 0; i < queryCount; i++) {
-        QueryObject query_obj = {queryPool, firstQuery + i, perf_query_pass};
-        (*local_query_to_state_map)[query_obj] = value;
-    }
-}
-
 void CommandBufferSubState::RecordBeginQuery(const QueryObject& query_obj, const Location& loc) {
     query_updates.emplace_back([this, query_obj, loc](vvl::CommandBuffer& cb_state_arg, bool do_validate,
                                                       VkQueryPool& first_perf_query_pool, uint32_t perf_query_pass,
@@ -609,7 +634,7 @@ void CommandBufferSubState::RecordBeginQuery(const QueryObject& query_obj, const
             skip |= validator.VerifyQueryIsReset(cb_state_arg, query_obj, loc, perf_query_pass, local_query_to_state_map);
         }
 
-        SetQueryState(QueryObject(query_obj, perf_query_pass), QUERYSTATE_RUNNING, local_query_to_state_map);
+        local_query_to_state_map->Set(QueryObject(query_obj, perf_query_pass), QUERYSTATE_RUNNING);
         return skip;
     });
 }
@@ -632,7 +657,7 @@ void CommandBufferSubState::RecordEndQuery(const QueryObject& query_obj, const L
             }
         }
 
-        SetQueryState(QueryObject(query_obj, perf_query_pass), QUERYSTATE_ENDED, local_query_to_state_map);
+        local_query_to_state_map->Set(QueryObject(query_obj, perf_query_pass), QUERYSTATE_ENDED);
         return skip;
     });
 }
@@ -644,7 +669,7 @@ void CommandBufferSubState::RecordWriteTimestamp(const QueryObject& query_obj, c
         if (do_validate) {
             skip |= validator.VerifyQueryIsReset(cb_state_arg, query_obj, loc, perf_query_pass, local_query_to_state_map);
         }
-        SetQueryState(QueryObject(query_obj, perf_query_pass), QUERYSTATE_ENDED, local_query_to_state_map);
+        local_query_to_state_map->Set(QueryObject(query_obj, perf_query_pass), QUERYSTATE_ENDED);
         return skip;
     });
 }
@@ -652,21 +677,11 @@ void CommandBufferSubState::RecordWriteTimestamp(const QueryObject& query_obj, c
 void CommandBufferSubState::RecordEndQueries(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
     query_updates.emplace_back([queryPool, firstQuery, queryCount](vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool&,
                                                                    uint32_t perf_query_pass, QueryMap* local_query_to_state_map) {
-        SetQueryStateMulti(queryPool, firstQuery, queryCount, perf_query_pass, QUERYSTATE_ENDED, local_query_to_state_map);
+        local_query_to_state_map->SetRange(queryPool, firstQuery, queryCount, perf_query_pass, QUERYSTATE_ENDED);
         return false;
     });
 }
 
-static QueryState GetLocalQueryState(const QueryMap* local_query_to_state_map, VkQueryPool queryPool, uint32_t queryIndex,
-                                     uint32_t perf_query_pass) {
-    QueryObject query = QueryObject(queryPool, queryIndex, perf_query_pass);
-
-    auto iter = local_query_to_state_map->find(query);
-    if (iter != local_query_to_state_map->end()) return iter->second;
-
-    return QUERYSTATE_UNKNOWN;
-}
-
 void CommandBufferSubState::RecordResetQueryPool(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount,
                                                  bool is_perf_query, const Location& loc) {
     query_updates.emplace_back(
@@ -676,7 +691,7 @@ void CommandBufferSubState::RecordResetQueryPool(VkQueryPool queryPool, uint32_t
             if (is_perf_query && do_validate) {
                 const auto& state_data = cb_state_arg.dev_data;
                 for (uint32_t i = 0; i < queryCount; i++) {
-                    QueryState state = GetLocalQueryState(local_query_to_state_map, queryPool, firstQuery + i, perf_query_pass);
+                    QueryState state = local_query_to_state_map->Get(queryPool, firstQuery + i, perf_query_pass);
                     if (state == QUERYSTATE_ENDED) {
                         const LogObjectList objlist(cb_state_arg.Handle(), queryPool);
                         skip |= state_data.LogError("VUID-vkCmdResetQueryPool-firstQuery-02862", objlist, loc,
@@ -686,7 +701,7 @@ void CommandBufferSubState::RecordResetQueryPool(VkQueryPool queryPool, uint32_t
                     }
                 }
             }
-            SetQueryStateMulti(queryPool, firstQuery, queryCount, perf_query_pass, QUERYSTATE_RESET, local_query_to_state_map);
+            local_query_to_state_map->SetRange(queryPool, firstQuery, queryCount, perf_query_pass, QUERYSTATE_RESET);
             return skip;
         });
 }
@@ -702,8 +717,7 @@ void CommandBufferSubState::RecordCopyQueryPoolResults(vvl::QueryPool& pool_stat
             }
             bool skip = false;
             for (uint32_t i = 0; i < query_count; i++) {
-                QueryState state =
-                    GetLocalQueryState(local_query_to_state_map, pool_state.VkHandle(), first_query + i, perf_query_pass);
+                QueryState state = local_query_to_state_map->Get(pool_state.VkHandle(), first_query + i, perf_query_pass);
                 QueryResultType result_type = pool_state.GetQueryResultType(state, flags);
                 if (result_type != QUERYRESULT_SOME_DATA && result_type != QUERYRESULT_UNKNOWN) {
                     const LogObjectList objlist(cb_state_arg.Handle(), pool_state.Handle());
@@ -733,8 +747,7 @@ void CommandBufferSubState::RecordWriteAccelerationStructuresProperties(VkQueryP
                 skip |= validator.VerifyQueryIsReset(cb_state_arg, query_obj, loc, perf_query_pass, local_query_to_state_map);
             }
         }
-        SetQueryStateMulti(queryPool, firstQuery, accelerationStructureCount, perf_query_pass, QUERYSTATE_ENDED,
-                           local_query_to_state_map);
+        local_query_to_state_map->SetRange(queryPool, firstQuery, accelerationStructureCount, perf_query_pass, QUERYSTATE_ENDED);
         return skip;
     });
 }
@@ -742,9 +755,8 @@ void CommandBufferSubState::RecordWriteAccelerationStructuresProperties(VkQueryP
 void CommandBufferSubState::RecordVideoInlineQueries(const VkVideoInlineQueryInfoKHR& query_info) {
     query_updates.emplace_back([query_info](vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool&,
                                             uint32_t perf_query_pass, QueryMap* local_query_to_state_map) {
-        for (uint32_t i = 0; i < query_info.queryCount; i++) {
-            SetQueryState(QueryObject(query_info.queryPool, query_info.firstQuery + i), QUERYSTATE_ENDED, local_query_to_state_map);
-        }
+        local_query_to_state_map->SetRange(query_info.queryPool, query_info.firstQuery, query_info.queryCount, 0,
+                                           QUERYSTATE_ENDED);
         return false;
     });
 }
@@ -933,13 +945,50 @@ void CommandBufferSubState::Retire(uint32_t perf_submit_pass,
         function(base, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
     }
 
-    for (const auto& [query_object, query_state] : local_query_to_state_map) {
-        if (query_state == QUERYSTATE_ENDED && !is_query_updated_after(query_object)) {
-            auto query_pool_state = base.dev_data.Get<vvl::QueryPool>(query_object.pool);
-            if (!query_pool_state) continue;
-            query_pool_state->SetQueryState(query_object.slot, query_object.perf_pass, QUERYSTATE_AVAILABLE);
+    local_query_to_state_map.ForEachPool([&](VkQueryPool pool, uint32_t perf_pass, const std::vector<QueryState>& states) {
+        auto query_pool_state = base.dev_data.Get<vvl::QueryPool>(pool);
+        if (!query_pool_state) return;
+        for (uint32_t slot = 0; slot < states.size(); ++slot) {
+            if (states[slot] == QUERYSTATE_ENDED && !is_query_updated_after(QueryObject(pool, slot, 0, perf_pass))) {
+                query_pool_state->SetQueryState(slot, perf_pass, QUERYSTATE_AVAILABLE);
+            }
         }
+    });
+}
+
+void CommandBufferSubState::AddValidatedDescriptorSet(const DescriptorSetValidationKey& key) {
+    if (validated_descriptor_sets.size() >= kMaxValidatedDescriptorSets) {
+        validated_descriptor_sets.clear();
     }
+    validated_descriptor_sets.insert(key);
+}
+
+bool CommandBufferSubState::IsShaderBindingTableValidated(vvl::Field table, const VkStridedDeviceAddressRegionKHR& region,
+                                                          uint64_t address_ranges_version) const {
+    if (address_ranges_version != validated_shader_binding_tables_version) {
+        return false;
+    }
+    for (const ValidatedShaderBindingTable& validated : validated_shader_binding_tables) {
+        if (validated.table == table && validated.device_address == region.deviceAddress && validated.size == region.size &&
+            validated.stride == region.stride) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CommandBufferSubState::AddValidatedShaderBindingTable(vvl::Field table, const VkStridedDeviceAddressRegionKHR& region,
+                                                           uint64_t address_ranges_version) {
+    if (IsShaderBindingTableValidated(table, region, address_ranges_version)) {
+        return;
+    }
+    if (address_ranges_version != validated_shader_binding_tables_version ||
+        validated_shader_binding_tables.size() >= kMaxValidatedShaderBindingTables) {
+        validated_shader_binding_tables.clear();
+        validated_shader_binding_tables_version = address_ranges_version;
+    }
+    validated_shader_binding_tables.emplace_back(
+        ValidatedShaderBindingTable{table, region.deviceAddress, region.size, region.stride});
 }
 
 void CommandBufferSubState::Reset(const Location& loc) { ResetCBState(); }
@@ -954,10 +1003,19 @@ void CommandBufferSubState::ResetCBState() {
     // VK_EXT_nested_command_buffer
     nesting_level = 0;
 
+    validated_descriptor_sets.clear();
+    validated_graphics_command = vvl::Func::Empty;
+    validated_graphics_state = 0;
+    descriptor_buffer_windows.clear();
+    validated_shader_binding_tables.clear();
+
+    deferred_checks.clear();
+
     // Submit time validation
     queue_submit_functions.clear();
     submit_validate_dynamic_rendering_barrier_subresources.clear();
     event_updates.clear();
+    execute_summary.reset();
     cmd_execute_commands_functions.clear();
     query_updates.clear();
 
@@ -982,12 +1040,35 @@ void CommandBufferSubState::RecordExecuteCommand(vvl::CommandBuffer& secondary_c
         nesting_level = std::max(nesting_level, secondary_sub_state.nesting_level + 1);
     }
 
-    for (auto& function : secondary_sub_state.event_updates) {
-        event_updates.push_back(function);
-    }
+    if (const auto summary = secondary_sub_state.execute_summary) {
+        if (!summary->event_updates.empty()) {
+            event_updates.emplace_back([summary](vvl::CommandBuffer& cb_state_arg, bool do_validate,
+                                                 EventMap& local_event_signal_info, VkQueue waiting_queue, const Location& loc) {
+                bool skip = false;
+                for (const auto& function : summary->event_updates) {
+                    skip |= function(cb_state_arg, do_validate, local_event_signal_info, waiting_queue, loc);
+                }
+                return skip;
+            });
+        }
+        if (!summary->queue_submit_functions.empty()) {
+            queue_submit_functions.emplace_back([summary](const vvl::Queue& queue_state, const vvl::CommandBuffer& cb_state_arg) {
+                bool skip = false;
+                for (const auto& function : summary->queue_submit_functions) {
+                    skip |= function(queue_state, cb_state_arg);
+                }
+                return skip;
+            });
+        }
+    } else {
+        // Executed while still recording, which is an error
+        for (auto& function : secondary_sub_state.event_updates) {
+            event_updates.push_back(function);
+        }
 
-    for (auto& function : secondary_sub_state.queue_submit_functions) {
-        queue_submit_functions.push_back(function);
+        for (auto& function : secondary_sub_state.queue_submit_functions) {
+            queue_submit_functions.push_back(function);
+        }
     }
 
     // State is trashed after executing secondary command buffers.
@@ -1028,8 +1109,7 @@ void CommandBufferSubState::Submit(vvl::Queue& queue_state, uint32_t perf_submit
             function(base, /*do_validate*/ false, local_event_signal_info,
                      VK_NULL_HANDLE /* when do_validate is false then wait handler is inactive */, loc);
         }
-        for (const auto& [event, info] : local_event_signal_info) {
-            auto event_state = base.dev_data.Get<vvl::Event>(event);
+        for (const auto& [event_state, info] : local_event_signal_info.Entries()) {
             event_state->signaled = info.signal;
             event_state->dependency_info = info.dependency_info;
             event_state->signal_src_stage_mask = info.src_stage_mask;
@@ -1045,11 +1125,11 @@ void CommandBufferSubState::Submit(vvl::Queue& queue_state, uint32_t perf_submit
         for (auto& function : query_updates) {
             function(base, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
         }
-        for (const auto& [query_object, query_state] : local_query_to_state_map) {
-            auto query_pool_state = base.dev_data.Get<vvl::QueryPool>(query_object.pool);
-            if (!query_pool_state) continue;
-            query_pool_state->SetQueryState(query_object.slot, query_object.perf_pass, query_state);
-        }
+        local_query_to_state_map.ForEachPool([&](VkQueryPool pool, uint32_t perf_pass, const std::vector<QueryState>& states) {
+            if (auto query_pool_state = base.dev_data.Get<vvl::QueryPool>(pool)) {
+                query_pool_state->SetQueryStates(perf_pass, states);
+            }
+        });
     }
 }
 
@@ -1090,7 +1170,7 @@ void CommandBufferSubState::SubmitTimeValidate() {
 QueueSubState::QueueSubState(CoreChecks& core_checks, vvl::Queue& q)
     : vvl::QueueSubState(q), queue_submission_validator_(core_checks) {}
 
-void QueueSubState::PreSubmit(std::vector<vvl::QueueSubmission>& submissions) {
+void QueueSubState::PreSubmit(vvl::span<vvl::QueueSubmission> submissions) {
     for (const auto& submission : submissions) {
         for (auto& cb : submission.cb_submissions) {
             auto guard = cb.cb->ReadLock();
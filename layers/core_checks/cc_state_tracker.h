@@ -36,6 +36,7 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
     CommandBufferSubState(vvl::CommandBuffer &cb, CoreChecks &validator);
 
     void Begin(const VkCommandBufferBeginInfo &begin_info) final;
+    void End() final;
 
     void RecordActionCommand(LastBound &last_bound, const Location &loc) final;
 
@@ -171,6 +172,10 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
     // currently need to hold in Command buffer because it can be a suspended renderpassss
     std::vector<VkOffset2D> fragment_density_offsets;
 
+    // With the deferred_command_validation setting, the checks of the recorded commands that only depend on the command
+    // parameters and the objects they use. They are run together at vkEndCommandBuffer, on the worker threads.
+    std::vector<std::function<void()>> deferred_checks;
+
     // Validation functions run at primary CB queue submit time
     using QueueCallback = std::function<bool(const class vvl::Queue &queue_state, const vvl::CommandBuffer &cb_state)>;
     std::vector<QueueCallback> queue_submit_functions;
@@ -183,6 +188,14 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
                                              VkQueue waiting_queue, const Location &loc)>;
     std::vector<EventCallback> event_updates;
 
+    // The callbacks a secondary command buffer adds to the primary executing it, copied once when its recording ends. Every
+    // vkCmdExecuteCommands of it then adds a single callback running them instead of copying each one.
+    struct ExecuteSummary {
+        std::vector<QueueCallback> queue_submit_functions;
+        std::vector<EventCallback> event_updates;
+    };
+    std::shared_ptr<const ExecuteSummary> execute_summary;
+
     // Validation functions run when secondary CB is executed in primary
     std::vector<
         std::function<bool(const vvl::CommandBuffer &secondary, const vvl::CommandBuffer *primary, const vvl::Framebuffer *)>>
@@ -192,10 +205,59 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
                                    uint32_t perf_query_pass, QueryMap *local_query_to_state_map)>>
         query_updates;
 
+    // Descriptor set states that draws in this command buffer already validated (and recorded), the ds_slots only remember the
+    // last one. Saves revalidating when the draws alternate between pipelines or sets.
+    bool IsDescriptorSetValidated(const DescriptorSetValidationKey &key) const { return validated_descriptor_sets.count(key) != 0; }
+    void AddValidatedDescriptorSet(const DescriptorSetValidationKey &key);
+
+    // Address range of each descriptor buffer of the last vkCmdBindDescriptorBuffersEXT, from the binding address to the end of
+    // the VkBuffer there that reaches the furthest (empty if there is none). An offset that stays within it is valid without
+    // looking up the buffers again, as long as no buffer address range was added or removed since it was computed.
+    const vvl::range<VkDeviceAddress> *GetDescriptorBufferWindow(uint32_t buffer_index, uint64_t address_ranges_version) const {
+        if (buffer_index >= descriptor_buffer_windows.size() || address_ranges_version != descriptor_buffer_windows_version) {
+            return nullptr;
+        }
+        return &descriptor_buffer_windows[buffer_index];
+    }
+
+    // Shader binding tables of the vkCmdTraceRays*KHR commands recorded so far. Their buffer checks only depend on the region and
+    // on the buffers at its address, so tracing again with the same table does not look them up again, as long as no buffer
+    // address range was added or removed since.
+    bool IsShaderBindingTableValidated(vvl::Field table, const VkStridedDeviceAddressRegionKHR &region,
+                                       uint64_t address_ranges_version) const;
+    void AddValidatedShaderBindingTable(vvl::Field table, const VkStridedDeviceAddressRegionKHR &region,
+                                        uint64_t address_ranges_version);
+
+    // The last draw command recorded, and the graphics_state_change_count it was validated against. A draw with the same command
+    // and nothing changed in between gets the same results from the graphics checks in ValidateActionState.
+    bool IsGraphicsStateValidated(vvl::Func command) const {
+        return validated_graphics_command == command && validated_graphics_state == base.graphics_state_change_count;
+    }
+
   private:
     void ResetCBState();
     void UpdateActionPipelineState(LastBound &last_bound, const vvl::Pipeline &pipeline_state);
 
+    // Bounded, the keys of a set that keeps changing are never used again
+    static constexpr size_t kMaxValidatedDescriptorSets = 4096;
+    vvl::unordered_set<DescriptorSetValidationKey, DescriptorSetValidationKey::Hash> validated_descriptor_sets;
+    vvl::Func validated_graphics_command = vvl::Func::Empty;
+    uint64_t validated_graphics_state = 0;
+
+    small_vector<vvl::range<VkDeviceAddress>, 4> descriptor_buffer_windows;
+    uint64_t descriptor_buffer_windows_version = 0;
+
+    struct ValidatedShaderBindingTable {
+        vvl::Field table;
+        VkDeviceAddress device_address;
+        VkDeviceSize size;
+        VkDeviceSize stride;
+    };
+    // A few tables per trace, an application cycling through more than this gets them validated again
+    static constexpr size_t kMaxValidatedShaderBindingTables = 16;
+    small_vector<ValidatedShaderBindingTable, 4> validated_shader_binding_tables;
+    uint64_t validated_shader_binding_tables_version = 0;
+
     // Funnel because Image/Buffer copies have 2 variations for the regions
     template <typename RegionType>
     void RecordCopyBufferCommon(vvl::Buffer &src_buffer_state, vvl::Buffer &dst_buffer_state, uint32_t region_count,
@@ -216,7 +278,7 @@ class QueueSubState : public vvl::QueueSubState {
   public:
     QueueSubState(CoreChecks &core_checks, vvl::Queue& q);
 
-    void PreSubmit(std::vector<vvl::QueueSubmission> &submissions) override;
+    void PreSubmit(vvl::span<vvl::QueueSubmission> submissions) override;
 
     // Override Retire to validate submissions in the order defined by synchronization
     void Retire(vvl::QueueSubmission&) override;
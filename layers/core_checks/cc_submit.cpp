@@ -69,13 +69,7 @@ void QueueSubmissionValidator::Validate(const vvl::QueueSubmission& submission)
     }
 
     // Validate image layouts on the command buffer boundaries
-    {
-        vvl::unordered_map<const vvl::Image*, ImageLayoutMap> local_image_layout_map;
-        for (const vvl::CommandBufferSubmission& cb_submission : submission.cb_submissions) {
-            auto cb_guard = cb_submission.cb->ReadLock();
-            core_checks.ValidateCmdBufImageLayouts(submission.loc.Get(), *cb_submission.cb, local_image_layout_map);
-        }
-    }
+    ValidateImageLayouts(submission);
 
     // Check that image being presented has correct layout
     if (submission.swapchain) {
@@ -94,6 +88,78 @@ void QueueSubmissionValidator::Validate(const vvl::QueueSubmission& submission)
     }
 }
 
+void QueueSubmissionValidator::ValidateImageLayouts(const vvl::QueueSubmission& submission) const {
+    if (core_checks.disabled[image_layout_validation]) {
+        return;
+    }
+    const Location& loc = submission.loc.Get();
+
+    size_t layout_map_count = 0;
+    for (const vvl::CommandBufferSubmission& cb_submission : submission.cb_submissions) {
+        auto cb_guard = cb_submission.cb->ReadLock();
+        layout_map_count += cb_submission.cb->image_layout_registry.size();
+    }
+    constexpr size_t kMinParallelLayoutMaps = 256;
+    if (layout_map_count < kMinParallelLayoutMaps) {
+        vvl::unordered_map<const vvl::Image*, ImageLayoutMap> local_image_layout_map;
+        for (const vvl::CommandBufferSubmission& cb_submission : submission.cb_submissions) {
+            auto cb_guard = cb_submission.cb->ReadLock();
+            core_checks.ValidateCmdBufImageLayouts(loc, *cb_submission.cb, local_image_layout_map);
+        }
+        return;
+    }
+
+    // The layouts of an image only depend on the command buffers that use it, in submission order. So the uses are
+    // grouped by image and each image is validated by one task, the command buffers stay read locked until all are done.
+    struct ImageUse {
+        const vvl::CommandBuffer* cb_state;
+        const CommandBufferImageLayoutMap* cb_layout_map;
+    };
+    struct ImageUses {
+        std::shared_ptr<const vvl::Image> image_state;
+        small_vector<ImageUse, 2> uses;
+    };
+    std::vector<ImageUses> images;
+    vvl::unordered_map<VkImage, size_t> image_indices;
+    std::vector<ReadLockGuard> cb_guards;
+    vvl::unordered_set<const vvl::CommandBuffer*> locked_cbs;
+    for (const vvl::CommandBufferSubmission& cb_submission : submission.cb_submissions) {
+        const vvl::CommandBuffer& cb_state = *cb_submission.cb;
+        // The same command buffer can be submitted more than once in a batch, only lock it once
+        if (locked_cbs.insert(&cb_state).second) {
+            cb_guards.emplace_back(cb_state.ReadLock());
+        }
+        for (const auto& [image, cb_layout_map] : cb_state.image_layout_registry) {
+            if (!cb_layout_map || cb_layout_map->empty()) {
+                continue;
+            }
+            auto [it, inserted] = image_indices.try_emplace(image, images.size());
+            if (inserted) {
+                auto image_state = core_checks.Get<vvl::Image>(image);
+                // TODO - things like ANGLE might have external images which have their layouts transitioned implicitly
+                // https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/8940
+                if (image_state && image_state->external_memory_handle_types != 0) {
+                    image_state.reset();
+                }
+                images.emplace_back(ImageUses{std::move(image_state), {}});
+            }
+            images[it->second].uses.emplace_back(ImageUse{&cb_state, cb_layout_map.get()});
+        }
+    }
+
+    core_checks.submit_layout_pool.ParallelFor(static_cast<uint32_t>(images.size()), [&](uint32_t i) {
+        const ImageUses& image_uses = images[i];
+        if (!image_uses.image_state) {
+            return;
+        }
+        const vvl::Image& image_state = *image_uses.image_state;
+        ImageLayoutMap local_layout_map(image_state.subresource_encoder.SubresourceCount());
+        for (const ImageUse& use : image_uses.uses) {
+            core_checks.ValidateCmdBufImageLayout(loc, *use.cb_state, image_state, *use.cb_layout_map, local_layout_map);
+        }
+    });
+}
+
 void QueueSubmissionValidator::Update(vvl::QueueSubmission& submission) {
     for (vvl::CommandBufferSubmission& cb_submission : submission.cb_submissions) {
         auto cb_guard = cb_submission.cb->WriteLock();
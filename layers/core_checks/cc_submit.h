@@ -37,4 +37,7 @@ struct QueueSubmissionValidator {
     QueueSubmissionValidator(CoreChecks &core_checks) : core_checks(core_checks) {}
     void Validate(const vvl::QueueSubmission &submission) const;
     void Update(vvl::QueueSubmission &submission);
+
+  private:
+    void ValidateImageLayouts(const vvl::QueueSubmission &submission) const;
 };
@@ -1298,16 +1298,18 @@ bool CoreChecks::ValidateAccessMask(const LogObjectList &objlist, const Location
     return skip;
 }
 
-bool CoreChecks::ValidateWaitEventsAtSubmit(const vvl::CommandBuffer &cb_state, size_t eventCount, size_t firstEventIndex,
-                                            VkPipelineStageFlags2 sourceStageMask, vku::safe_VkDependencyInfo dependency_info,
+bool CoreChecks::ValidateWaitEventsAtSubmit(const vvl::CommandBuffer &cb_state,
+                                            const std::vector<std::shared_ptr<vvl::Event>> &wait_events,
+                                            VkPipelineStageFlags2 sourceStageMask,
+                                            const vku::safe_VkDependencyInfo &dependency_info,
                                             const EventMap &local_event_signal_info, VkQueue waiting_queue, const Location &loc) {
     bool skip = false;
     const vvl::DeviceState &state_data = cb_state.dev_data;
     VkPipelineStageFlags2KHR stage_mask = 0;
-    const auto max_event = std::min((firstEventIndex + eventCount), cb_state.events.size());
     bool any_event2 = false;
-    for (size_t event_index = firstEventIndex; event_index < max_event; ++event_index) {
-        auto event = cb_state.events[event_index];
+    for (const auto &event_state : wait_events) {
+        if (event_state->Destroyed()) continue;
+        const VkEvent event = event_state->VkHandle();
 
         // The event signal map tracks src_stage from the last SetEvent within the
         // *current* queue submission. If the current submission does not have
@@ -1316,16 +1318,14 @@ bool CoreChecks::ValidateWaitEventsAtSubmit(const vvl::CommandBuffer &cb_state,
         // conveniently stored in the vvl::Event object itself (after each queue
         // submit, vvl::CommandBuffer::Submit() updates vvl::Event, so it contains
         // the last src_stage from that submission).
-        vku::safe_VkDependencyInfo set_dependency_info = {};
-        if (const auto *event_info = vvl::Find(local_event_signal_info, event)) {
+        const vku::safe_VkDependencyInfo *set_dependency_info = nullptr;
+        if (const auto *event_info = local_event_signal_info.Find(*event_state)) {
             stage_mask |= event_info->src_stage_mask;
-            set_dependency_info = event_info->dependency_info;
+            set_dependency_info = &event_info->dependency_info;
             // The "set event" is found in the current submission (the same queue); there can't be inter-queue usage errors
         } else {
-            auto event_state = state_data.Get<vvl::Event>(event);
-            if (!event_state) continue;
             stage_mask |= event_state->signal_src_stage_mask;
-            set_dependency_info = event_state->dependency_info;
+            set_dependency_info = &event_state->dependency_info;
 
             if (event_state->signaling_queue != VK_NULL_HANDLE && event_state->signaling_queue != waiting_queue) {
                 const LogObjectList objlist(cb_state.Handle(), event, event_state->signaling_queue, waiting_queue);
@@ -1336,11 +1336,11 @@ bool CoreChecks::ValidateWaitEventsAtSubmit(const vvl::CommandBuffer &cb_state,
             }
         }
 
-        bool event2 = set_dependency_info.sType == VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+        bool event2 = set_dependency_info->sType == VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
         any_event2 |= event2;
 
         if ((dependency_info.dependencyFlags & VK_DEPENDENCY_ASYMMETRIC_EVENT_BIT_KHR) == 0) {
-            if (event2 && !CompareDependencyInfo(*set_dependency_info.ptr(), *dependency_info.ptr())) {
+            if (event2 && !CompareDependencyInfo(*set_dependency_info->ptr(), *dependency_info.ptr())) {
                 const LogObjectList objlist(cb_state.Handle(), event);
                 // This could be moved to record time, if both vkCmdWaitEvents2 and vkSetEvents2 are in the same command buffer
                 skip |= state_data.LogError(
@@ -1348,10 +1348,10 @@ bool CoreChecks::ValidateWaitEventsAtSubmit(const vvl::CommandBuffer &cb_state,
                     "event %s is being waited on without VK_DEPENDENCY_ASYMMETRIC_EVENT_BIT_KHR and was "
                     "signaled by vkCmdSetEvent2, but %s.",
                     state_data.FormatHandle(event).c_str(),
-                    string_VkDependencyInfo(state_data, *set_dependency_info.ptr(), *dependency_info.ptr()).c_str());
+                    string_VkDependencyInfo(state_data, *set_dependency_info->ptr(), *dependency_info.ptr()).c_str());
             }
         } else {
-            if ((set_dependency_info.dependencyFlags & VK_DEPENDENCY_ASYMMETRIC_EVENT_BIT_KHR) == 0) {
+            if ((set_dependency_info->dependencyFlags & VK_DEPENDENCY_ASYMMETRIC_EVENT_BIT_KHR) == 0) {
                 const LogObjectList objlist(cb_state.Handle(), event);
                 skip |= state_data.LogError(
                     "VUID-vkCmdWaitEvents2-pEvents-10789", objlist, loc,
@@ -1368,14 +1368,14 @@ bool CoreChecks::ValidateWaitEventsAtSubmit(const vvl::CommandBuffer &cb_state,
             for (uint32_t i = 0; i < dependency_info.imageMemoryBarrierCount; ++i) {
                 union_src_stage_mask |= dependency_info.pImageMemoryBarriers[i].srcStageMask;
             }
-            if (union_src_stage_mask != set_dependency_info.pMemoryBarriers[0].srcStageMask) {
+            if (union_src_stage_mask != set_dependency_info->pMemoryBarriers[0].srcStageMask) {
                 const LogObjectList objlist(cb_state.Handle(), event);
                 skip |=
                     state_data.LogError("VUID-vkCmdWaitEvents2-pEvents-10790", objlist, loc,
                                         "union of all srcStageMask members is %s, but event was set with "
                                         "pDependencyInfos->pMemoryBarriers[0].srcStageMask %s.",
                                         string_VkPipelineStageFlags2(union_src_stage_mask).c_str(),
-                                        string_VkPipelineStageFlags2(set_dependency_info.pMemoryBarriers[0].srcStageMask).c_str());
+                                        string_VkPipelineStageFlags2(set_dependency_info->pMemoryBarriers[0].srcStageMask).c_str());
             }
         }
     }
@@ -2339,6 +2339,7 @@ bool CoreChecks::ValidateBarrierQueueFamilies(const LogObjectList &objects, cons
 
 bool CoreChecks::ValidateBufferBarrier(const LogObjectList &objects, const Location &barrier_loc,
                                        const vvl::CommandBuffer &cb_state, const BufferBarrier &mem_barrier) const {
+    VVL_CheckStatsScope(dispatch_device_, "CoreChecks::ValidateBufferBarrier");
     bool skip = false;
 
     // Validate buffer barrier queue family indices
@@ -2377,6 +2378,14 @@ bool CoreChecks::ValidateBufferBarrier(const LogObjectList &objects, const Locat
 
 bool CoreChecks::ValidateImageBarrier(const LogObjectList &objlist, const vvl::CommandBuffer &cb_state, const ImageBarrier &barrier,
                                       const Location &barrier_loc, ImageLayoutRegistry &local_layout_registry) const {
+    auto image_state = Get<vvl::Image>(barrier.image);
+    return ValidateImageBarrier(objlist, cb_state, barrier, barrier_loc, image_state.get(), local_layout_registry);
+}
+
+bool CoreChecks::ValidateImageBarrier(const LogObjectList &objlist, const vvl::CommandBuffer &cb_state, const ImageBarrier &barrier,
+                                      const Location &barrier_loc, const vvl::Image *image_state,
+                                      ImageLayoutRegistry &local_layout_registry) const {
+    VVL_CheckStatsScope(dispatch_device_, "CoreChecks::ValidateImageBarrier");
     bool skip = false;
 
     const VkImageLayout old_layout = barrier.oldLayout;
@@ -2421,7 +2430,7 @@ bool CoreChecks::ValidateImageBarrier(const LogObjectList &objlist, const vvl::C
         }
     }
 
-    if (auto image_state = Get<vvl::Image>(barrier.image)) {
+    if (image_state) {
         const auto &vuid_no_memory = GetImageBarrierVUID(barrier_loc, vvl::ImageError::kNoMemory);
         skip |=
             ValidateMemoryIsBoundToImage(cb_state.Handle(), *image_state, barrier_loc.dot(Field::image), vuid_no_memory.c_str());
@@ -2476,23 +2485,60 @@ bool CoreChecks::ValidateDependencyInfo(const LogObjectList &objects, const Loca
     // Keeps state between ValidateImageBarrier calls.
     ImageLayoutRegistry local_layout_registry;
 
+    // The stage and access mask checks of a barrier only depend on its masks and ownership transfer direction, and render graphs
+    // emit hundreds of barriers with a few distinct masks. A combination that passed is not checked again for the next barriers.
+    struct BarrierMasks {
+        VkPipelineStageFlags2 src_stage_mask;
+        VkAccessFlags2 src_access_mask;
+        VkPipelineStageFlags2 dst_stage_mask;
+        VkAccessFlags2 dst_access_mask;
+        OwnershipTransferOp transfer_op;
+
+        bool operator==(const BarrierMasks &other) const {
+            return src_stage_mask == other.src_stage_mask && src_access_mask == other.src_access_mask &&
+                   dst_stage_mask == other.dst_stage_mask && dst_access_mask == other.dst_access_mask &&
+                   transfer_op == other.transfer_op;
+        }
+    };
+    small_vector<BarrierMasks, 8> valid_masks;
+    constexpr size_t kMaxValidMasks = 32;
+    auto validate_memory_barrier = [&](const Location &barrier_loc, const SyncMemoryBarrier &barrier,
+                                       OwnershipTransferOp transfer_op) {
+        const BarrierMasks masks{barrier.srcStageMask, barrier.srcAccessMask, barrier.dstStageMask, barrier.dstAccessMask,
+                                 transfer_op};
+        if (std::find(valid_masks.begin(), valid_masks.end(), masks) != valid_masks.end()) {
+            return false;
+        }
+        const bool barrier_skip =
+            ValidateMemoryBarrier(objects, barrier_loc, cb_state, barrier, transfer_op, dep_info.dependencyFlags);
+        if (!barrier_skip && valid_masks.size() < kMaxValidMasks) {
+            valid_masks.emplace_back(masks);
+        }
+        return barrier_skip;
+    };
+
     for (uint32_t i = 0; i < dep_info.memoryBarrierCount; ++i) {
         const Location barrier_loc = dep_info_loc.dot(Struct::VkMemoryBarrier2, Field::pMemoryBarriers, i);
         const SyncMemoryBarrier barrier(dep_info.pMemoryBarriers[i]);
-        skip |= ValidateMemoryBarrier(objects, barrier_loc, cb_state, barrier);
+        skip |= validate_memory_barrier(barrier_loc, barrier, OwnershipTransferOp::none);
     }
+    // Barriers of the same image are usually next to each other (one per mip level or aspect), it is only looked up once
+    std::shared_ptr<const vvl::Image> image_state;
     for (uint32_t i = 0; i < dep_info.imageMemoryBarrierCount; ++i) {
         const Location barrier_loc = dep_info_loc.dot(Struct::VkImageMemoryBarrier2, Field::pImageMemoryBarriers, i);
         const ImageBarrier barrier(dep_info.pImageMemoryBarriers[i]);
         const OwnershipTransferOp transfer_op = barrier.TransferOp(cb_state.command_pool->queueFamilyIndex);
-        skip |= ValidateMemoryBarrier(objects, barrier_loc, cb_state, barrier, transfer_op, dep_info.dependencyFlags);
-        skip |= ValidateImageBarrier(objects, cb_state, barrier, barrier_loc, local_layout_registry);
+        skip |= validate_memory_barrier(barrier_loc, barrier, transfer_op);
+        if (!image_state || image_state->VkHandle() != barrier.image) {
+            image_state = Get<vvl::Image>(barrier.image);
+        }
+        skip |= ValidateImageBarrier(objects, cb_state, barrier, barrier_loc, image_state.get(), local_layout_registry);
     }
     for (uint32_t i = 0; i < dep_info.bufferMemoryBarrierCount; ++i) {
         const Location barrier_loc = dep_info_loc.dot(Struct::VkBufferMemoryBarrier2, Field::pBufferMemoryBarriers, i);
         const BufferBarrier barrier(dep_info.pBufferMemoryBarriers[i]);
         const OwnershipTransferOp transfer_op = barrier.TransferOp(cb_state.command_pool->queueFamilyIndex);
-        skip |= ValidateMemoryBarrier(objects, barrier_loc, cb_state, barrier, transfer_op, dep_info.dependencyFlags);
+        skip |= validate_memory_barrier(barrier_loc, barrier, transfer_op);
         skip |= ValidateBufferBarrier(objects, barrier_loc, cb_state, barrier);
     }
 
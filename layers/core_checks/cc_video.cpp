@@ -115,7 +115,8 @@ bool CoreChecks::IsImageCompatibleWithVideoSession(const vvl::Image &image_state
     if (image_state.create_info.flags & VK_IMAGE_CREATE_VIDEO_PROFILE_INDEPENDENT_BIT_KHR) {
         return IsSupportedVideoFormat(image_state.create_info, vs_state.create_info.pVideoProfile);
     } else {
-        return image_state.supported_video_profiles.find(vs_state.profile) != image_state.supported_video_profiles.end();
+        const auto &supported_video_profiles = image_state.GetSupportedVideoProfiles();
+        return supported_video_profiles.find(vs_state.profile) != supported_video_profiles.end();
     }
 }
 
@@ -920,18 +921,18 @@ bool core::ValidateVideoProfileInfo(const StateObject &state, const VkVideoProfi
     (void)codec_feature_not_enabled_msg;
 
     if (GetBitSetCount(profile->chromaSubsampling) != 1) {
-        skip |= state.LogError("VUID-VkVideoProfileInfoKHR-chromaSubsampling-07013", error_obj.objlist,
+        skip |= state.LogError("VUID-VkVideoProfileInfoKHR-chromaSubsampling-07013", error_obj.handle,
                                loc.dot(Field::chromaSubsampling), "must have a single bit set.");
     }
 
     if (GetBitSetCount(profile->lumaBitDepth) != 1) {
-        skip |= state.LogError("VUID-VkVideoProfileInfoKHR-lumaBitDepth-07014", error_obj.objlist, loc.dot(Field::lumaBitDepth),
+        skip |= state.LogError("VUID-VkVideoProfileInfoKHR-lumaBitDepth-07014", error_obj.handle, loc.dot(Field::lumaBitDepth),
                                "must have a single bit set.");
     }
 
     if (profile->chromaSubsampling != VK_VIDEO_CHROMA_SUBSAMPLING_MONOCHROME_BIT_KHR) {
         if (GetBitSetCount(profile->chromaBitDepth) != 1) {
-            skip |= state.LogError("VUID-VkVideoProfileInfoKHR-chromaSubsampling-07015", error_obj.objlist,
+            skip |= state.LogError("VUID-VkVideoProfileInfoKHR-chromaSubsampling-07015", error_obj.handle,
                                    loc.dot(Field::chromaBitDepth), "must have a single bit set.");
         }
     }
@@ -940,7 +941,7 @@ bool core::ValidateVideoProfileInfo(const StateObject &state, const VkVideoProfi
         case VK_VIDEO_CODEC_OPERATION_DECODE_H264_BIT_KHR: {
             const auto decode_h264 = vku::FindStructInPNextChain<VkVideoDecodeH264ProfileInfoKHR>(profile->pNext);
             if (decode_h264 == nullptr) {
-                skip |= state.LogError("VUID-VkVideoProfileInfoKHR-videoCodecOperation-07179", error_obj.objlist,
+                skip |= state.LogError("VUID-VkVideoProfileInfoKHR-videoCodecOperation-07179", error_obj.handle,
                                        loc.dot(Field::pNext), profile_pnext_msg, "VkVideoDecodeH264ProfileInfoKHR");
             }
             break;
@@ -949,7 +950,7 @@ bool core::ValidateVideoProfileInfo(const StateObject &state, const VkVideoProfi
         case VK_VIDEO_CODEC_OPERATION_DECODE_H265_BIT_KHR: {
             const auto decode_h265 = vku::FindStructInPNextChain<VkVideoDecodeH265ProfileInfoKHR>(profile->pNext);
             if (decode_h265 == nullptr) {
-                skip |= state.LogError("VUID-VkVideoProfileInfoKHR-videoCodecOperation-07180", error_obj.objlist,
+                skip |= state.LogError("VUID-VkVideoProfileInfoKHR-videoCodecOperation-07180", error_obj.handle,
                                        loc.dot(Field::pNext), profile_pnext_msg, "VkVideoDecodeH265ProfileInfoKHR");
             }
             break;
@@ -958,7 +959,7 @@ bool core::ValidateVideoProfileInfo(const StateObject &state, const VkVideoProfi
         case VK_VIDEO_CODEC_OPERATION_DECODE_AV1_BIT_KHR: {
             const auto decode_av1 = vku::FindStructInPNextChain<VkVideoDecodeAV1ProfileInfoKHR>(profile->pNext);
             if (decode_av1 == nullptr) {
-                skip |= state.LogError("VUID-VkVideoProfileInfoKHR-videoCodecOperation-09256", error_obj.objlist,
+                skip |= state.LogError("VUID-VkVideoProfileInfoKHR-videoCodecOperation-09256", error_obj.handle,
                                        loc.dot(Field::pNext), profile_pnext_msg, "VkVideoDecodeAV1ProfileInfoKHR");
             }
             break;
@@ -988,14 +989,14 @@ bool core::ValidateVideoProfileInfo(const StateObject &state, const VkVideoProfi
                             break;
                     }
                     skip |=
-                        state.LogError(vuid, error_obj.objlist, loc.dot(Field::videoCodecOperation), codec_feature_not_enabled_msg,
+                        state.LogError(vuid, error_obj.handle, loc.dot(Field::videoCodecOperation), codec_feature_not_enabled_msg,
                                        string_VkVideoCodecOperationFlagBitsKHR(profile->videoCodecOperation), "videoDecodeVP9");
                 }
             }
 
             const auto decode_vp9 = vku::FindStructInPNextChain<VkVideoDecodeVP9ProfileInfoKHR>(profile->pNext);
             if (decode_vp9 == nullptr) {
-                skip |= state.LogError("VUID-VkVideoProfileInfoKHR-videoCodecOperation-10791", error_obj.objlist,
+                skip |= state.LogError("VUID-VkVideoProfileInfoKHR-videoCodecOperation-10791", error_obj.handle,
                                        loc.dot(Field::pNext), profile_pnext_msg, "VkVideoDecodeVP9ProfileInfoKHR");
             }
             break;
@@ -1004,7 +1005,7 @@ bool core::ValidateVideoProfileInfo(const StateObject &state, const VkVideoProfi
         case VK_VIDEO_CODEC_OPERATION_ENCODE_H264_BIT_KHR: {
             const auto encode_h264 = vku::FindStructInPNextChain<VkVideoEncodeH264ProfileInfoKHR>(profile->pNext);
             if (encode_h264 == nullptr) {
-                skip |= state.LogError("VUID-VkVideoProfileInfoKHR-videoCodecOperation-07181", error_obj.objlist,
+                skip |= state.LogError("VUID-VkVideoProfileInfoKHR-videoCodecOperation-07181", error_obj.handle,
                                        loc.dot(Field::pNext), profile_pnext_msg, "VkVideoEncodeH264ProfileInfoKHR");
             }
             break;
@@ -1013,7 +1014,7 @@ bool core::ValidateVideoProfileInfo(const StateObject &state, const VkVideoProfi
         case VK_VIDEO_CODEC_OPERATION_ENCODE_H265_BIT_KHR: {
             const auto encode_h265 = vku::FindStructInPNextChain<VkVideoEncodeH265ProfileInfoKHR>(profile->pNext);
             if (encode_h265 == nullptr) {
-                skip |= state.LogError("VUID-VkVideoProfileInfoKHR-videoCodecOperation-07182", error_obj.objlist,
+                skip |= state.LogError("VUID-VkVideoProfileInfoKHR-videoCodecOperation-07182", error_obj.handle,
                                        loc.dot(Field::pNext), profile_pnext_msg, "VkVideoEncodeH265ProfileInfoKHR");
             }
             break;
@@ -1043,14 +1044,14 @@ bool core::ValidateVideoProfileInfo(const StateObject &state, const VkVideoProfi
                             break;
                     }
                     skip |=
-                        state.LogError(vuid, error_obj.objlist, loc.dot(Field::videoCodecOperation), codec_feature_not_enabled_msg,
+                        state.LogError(vuid, error_obj.handle, loc.dot(Field::videoCodecOperation), codec_feature_not_enabled_msg,
                                        string_VkVideoCodecOperationFlagBitsKHR(profile->videoCodecOperation), "videoEncodeAV1");
                 }
             }
 
             const auto encode_av1 = vku::FindStructInPNextChain<VkVideoEncodeAV1ProfileInfoKHR>(profile->pNext);
             if (encode_av1 == nullptr) {
-                skip |= state.LogError("VUID-VkVideoProfileInfoKHR-videoCodecOperation-10262", error_obj.objlist,
+                skip |= state.LogError("VUID-VkVideoProfileInfoKHR-videoCodecOperation-10262", error_obj.handle,
                                        loc.dot(Field::pNext), profile_pnext_msg, "VkVideoEncodeAV1ProfileInfoKHR");
             }
             break;
@@ -1089,7 +1090,7 @@ bool core::ValidateVideoProfileListInfo(const StateObject &state, const VkVideoP
                 case VK_VIDEO_CODEC_OPERATION_DECODE_AV1_BIT_KHR:
                 case VK_VIDEO_CODEC_OPERATION_DECODE_VP9_BIT_KHR:
                     if (has_decode_profile) {
-                        skip |= state.LogError("VUID-VkVideoProfileListInfoKHR-pProfiles-06813", error_obj.objlist, loc,
+                        skip |= state.LogError("VUID-VkVideoProfileListInfoKHR-pProfiles-06813", error_obj.handle, loc,
                                                "contains more than one profile with decode codec operation.");
                     }
                     has_decode_profile = true;
@@ -1110,12 +1111,12 @@ bool core::ValidateVideoProfileListInfo(const StateObject &state, const VkVideoP
     }
 
     if (expect_decode_profile && !has_decode_profile) {
-        skip |= state.LogError(missing_decode_profile_msg_code, error_obj.objlist, loc.dot(vvl::Field::pProfiles),
+        skip |= state.LogError(missing_decode_profile_msg_code, error_obj.handle, loc.dot(vvl::Field::pProfiles),
                                "contains no video profile specifying a video decode operation.");
     }
 
     if (expect_encode_profile && !has_encode_profile) {
-        skip |= state.LogError(missing_encode_profile_msg_code, error_obj.objlist, loc.dot(vvl::Field::pProfiles),
+        skip |= state.LogError(missing_encode_profile_msg_code, error_obj.handle, loc.dot(vvl::Field::pProfiles),
                                "contains no video profile specifying a video encode operation.");
     }
 
@@ -3532,7 +3533,7 @@ bool CoreChecks::ValidateVideoEncodeQuantizationMapInfo(const vvl::CommandBuffer
                                  "the bound video session %s was created with.\nSupported video profiles for the image:\n%s",
                                  FormatHandle(iv_state->Handle()).c_str(), FormatHandle(iv_state->image_state->Handle()).c_str(),
                                  string_VideoProfileDesc(*vs_state->profile).c_str(), FormatHandle(vs_state->Handle()).c_str(),
-                                 string_SupportedVideoProfiles(iv_state->image_state->supported_video_profiles).c_str());
+                                 string_SupportedVideoProfiles(iv_state->image_state->GetSupportedVideoProfiles()).c_str());
             }
         }
     }
@@ -5011,7 +5012,7 @@ bool CoreChecks::PreCallValidateCmdBeginVideoCodingKHR(VkCommandBuffer commandBu
                                 FormatHandle(reference_resource.image_view_state->Handle()).c_str(),
                                 FormatHandle(reference_resource.image_state->Handle()).c_str(),
                                 string_VideoProfileDesc(*vs_state->profile).c_str(), FormatHandle(pBeginInfo->videoSession).c_str(),
-                                string_SupportedVideoProfiles(reference_resource.image_state->supported_video_profiles).c_str());
+                                string_SupportedVideoProfiles(reference_resource.image_state->GetSupportedVideoProfiles()).c_str());
                         }
                     }
 
@@ -5458,7 +5459,7 @@ bool CoreChecks::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer commandBuffer,
                                  FormatHandle(pDecodeInfo->dstPictureResource.imageViewBinding).c_str(),
                                  FormatHandle(dst_resource.image_state->Handle()).c_str(),
                                  string_VideoProfileDesc(*vs_state->profile).c_str(), FormatHandle(*vs_state).c_str(),
-                                 string_SupportedVideoProfiles(dst_resource.image_state->supported_video_profiles).c_str());
+                                 string_SupportedVideoProfiles(dst_resource.image_state->GetSupportedVideoProfiles()).c_str());
             }
         }
 
@@ -5940,7 +5941,7 @@ bool CoreChecks::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer commandBuffer,
                                  FormatHandle(pEncodeInfo->srcPictureResource.imageViewBinding).c_str(),
                                  FormatHandle(src_resource.image_state->Handle()).c_str(),
                                  string_VideoProfileDesc(*vs_state->profile).c_str(), FormatHandle(*vs_state).c_str(),
-                                 string_SupportedVideoProfiles(src_resource.image_state->supported_video_profiles).c_str());
+                                 string_SupportedVideoProfiles(src_resource.image_state->GetSupportedVideoProfiles()).c_str());
             }
         }
 
@@ -39,7 +39,10 @@
 #include "stateless/sl_spirv.h"
 #include <spirv-tools/libspirv.hpp>
 
+#include "utils/hash_util.h"
+#include "utils/shader_utils.h"
 #include "utils/sync_utils.h"
+#include "utils/task_pool.h"
 
 namespace vvl {
 struct DrawDispatchVuid;
@@ -199,7 +202,7 @@ bool ValidateVideoProfileListInfo(const StateObject& state, const VkVideoProfile
                                   const char* missing_encode_profile_msg_code);
 }  // namespace core
 
-class CoreChecks : public vvl::DeviceProxy {
+class CoreChecks final : public vvl::DeviceProxy {
     using BaseClass = vvl::DeviceProxy;
 
   public:
@@ -211,6 +214,8 @@ class CoreChecks : public vvl::DeviceProxy {
     GlobalQFOTransferBarrierMap<QFOBufferTransferBarrier> qfo_release_buffer_barrier_map;
     VkValidationCacheEXT core_validation_cache = VK_NULL_HANDLE;
     std::string validation_cache_path;
+    // Size of the validation cache data last read from or written to |validation_cache_path|
+    size_t saved_validation_cache_size = 0;
 
     // The options are set from extensions/features only, so only need ot create once.
     // This also is needed for shader caching (You can have the same SPIR-V, but different Vulkan features making it legal/illegal
@@ -218,6 +223,62 @@ class CoreChecks : public vvl::DeviceProxy {
     spvtools::ValidatorOptions spirv_val_options;
     uint32_t spirv_val_option_hash;
     stateless::SpirvValidator stateless_spirv_validator;
+    // From stateless_spirv_validator.GetDeviceHash(), part of the key of the cached stateless SPIR-V check results
+    uint64_t spirv_module_check_hash = 0;
+
+    // Every dynamic state ValidateGraphicsDynamicStateSetStatus can require with the enabled features/extensions, so a shader
+    // object draw with all of them set is known to be fine with a single compare.
+    CBDynamicFlags shader_object_dynamic_states_checked;
+
+    // With the async_spirv_validation setting, spirv-val of the vkCreateShaderModule code runs on these workers. Its result is
+    // waited for the first time the module is used to create a pipeline, which runs it right away if no worker started it.
+    struct DeferredSpirvValidation {
+        std::shared_ptr<const spirv::Module> module_state;
+        std::vector<uint32_t> code;
+        std::once_flag once;
+        bool valid = true;
+    };
+    std::unique_ptr<vvl::JobQueue> spirv_validation_queue;
+    // The successful validations are removed once run, the others are kept so that pipelines skip the invalid module
+    mutable vvl::unordered_map<const spirv::Module *, std::shared_ptr<DeferredSpirvValidation>> deferred_spirv_validation_map;
+    mutable std::mutex deferred_spirv_validation_lock;
+
+    // Keys of the producer/consumer entry point pairs which ValidateInterfaceBetweenStages() checked without logging anything.
+    // The check only reads the unspecialized modules, so specialization constants are not part of the key.
+    mutable vvl::unordered_set<uint64_t> valid_stage_interfaces;
+    mutable std::shared_mutex valid_stage_interfaces_lock;
+
+    // What ValidateShaderStage() gets from the specialized copy of a module, which is made with spirv-opt and then validated and
+    // parsed again. Many pipelines use the same few specializations of a module, so the results of the specializations that
+    // logged nothing are kept, keyed by GetSpecializationKey().
+    struct SpecializedStageInfo {
+        spirv::LocalSize local_size;
+        uint32_t total_workgroup_shared_memory = 0;
+        uint32_t total_task_payload_memory = 0;
+    };
+    mutable vvl::unordered_map<uint64_t, SpecializedStageInfo> specialized_stage_cache;
+    mutable std::shared_mutex specialized_stage_cache_lock;
+
+    // The bound shader objects (and which stages are bound at all) of the draws whose ValidateDrawShaderObjectCombination() logged
+    // nothing. Renderers draw with a few combinations over and over, so most draws only look the combination up. All of it is
+    // dropped when a shader object is destroyed, as its handle could be given to a new shader object.
+    using ShaderObjectCombination = std::array<uint64_t, kShaderObjectStageCount + 1>;
+    struct ShaderObjectCombinationHash {
+        size_t operator()(const ShaderObjectCombination& combination) const {
+            return static_cast<size_t>(hash_util::Hash64(combination.data(), sizeof(combination)));
+        }
+    };
+    mutable vvl::unordered_set<ShaderObjectCombination, ShaderObjectCombinationHash> valid_shader_object_combinations;
+    mutable std::shared_mutex valid_shader_object_combinations_lock;
+
+    // Validates the image layouts of submissions that use many images, each image is validated by one task
+    mutable vvl::TaskPool submit_layout_pool;
+    // Looks up the buffers at the input addresses of acceleration structure builds with many geometries
+    mutable vvl::TaskPool build_input_pool;
+    // Runs the deferred_checks of a command buffer at vkEndCommandBuffer (deferred_command_validation setting)
+    mutable vvl::TaskPool deferred_check_pool;
+    // Validates the descriptors of huge statically used arrays at draw time, in chunks
+    mutable vvl::TaskPool descriptor_validation_pool;
 
     CoreChecks(vvl::dispatch::Device* dev, core::Instance* instance_vo)
         : BaseClass(dev, instance_vo, LayerObjectTypeCoreValidation),
@@ -254,6 +315,7 @@ class CoreChecks : public vvl::DeviceProxy {
                                      const Location& submit_loc) const;
     bool ValidateDynamicStateIsSet(const LastBound& last_bound_state, const CBDynamicFlags& state_status_cb,
                                    CBDynamicState dynamic_state, const vvl::DrawDispatchVuid& vuid) const;
+    CBDynamicFlags GetShaderObjectDynamicStatesChecked() const;
     bool ValidateGraphicsDynamicStateSetStatus(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const;
     bool ValidateDrawDynamicStatePipelineRenderPass(const LastBound& last_bound_state, const vvl::Pipeline& pipeline,
                                                     const vvl::RenderPass& rp_state, const vvl::DrawDispatchVuid& vuid) const;
@@ -333,6 +395,10 @@ class CoreChecks : public vvl::DeviceProxy {
 
     bool ValidateImageBarrier(const LogObjectList& objlist, const vvl::CommandBuffer& cb_state, const ImageBarrier& barrier,
                               const Location& barrier_loc, ImageLayoutRegistry& local_layout_registry) const;
+    // |image_state| is the state of barrier.image, looked up by the caller
+    bool ValidateImageBarrier(const LogObjectList& objlist, const vvl::CommandBuffer& cb_state, const ImageBarrier& barrier,
+                              const Location& barrier_loc, const vvl::Image* image_state,
+                              ImageLayoutRegistry& local_layout_registry) const;
 
     bool ValidateBarriers(const Location& loc, const vvl::CommandBuffer& cb_state, VkPipelineStageFlags src_stage_mask,
                           VkPipelineStageFlags dst_stage_mask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers,
@@ -697,6 +763,7 @@ class CoreChecks : public vvl::DeviceProxy {
     bool ValidateDrawShaderObjectNextStage(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const;
     bool ValidateDrawShaderObjectBoundShader(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const;
     bool ValidateDrawShaderObject(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const;
+    bool ValidateDrawShaderObjectCombination(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const;
     bool ValidateDrawShaderObjectLinking(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const;
     bool ValidateDrawShaderObjectPushConstantAndLayout(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const;
     bool ValidateDrawShaderObjectMesh(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const;
@@ -709,8 +776,9 @@ class CoreChecks : public vvl::DeviceProxy {
                                          const vvl::DrawDispatchVuid& vuid) const;
     bool ValidateActionStateProtectedMemory(const LastBound& last_bound_state, const VkPipelineBindPoint bind_point,
                                             const vvl::Pipeline* pipeline, const vvl::DrawDispatchVuid& vuid) const;
-    static bool ValidateWaitEventsAtSubmit(const vvl::CommandBuffer& cb_state, size_t eventCount, size_t firstEventIndex,
-                                           VkPipelineStageFlags2 sourceStageMask, vku::safe_VkDependencyInfo dependency_info,
+    static bool ValidateWaitEventsAtSubmit(const vvl::CommandBuffer& cb_state,
+                                           const std::vector<std::shared_ptr<vvl::Event>>& wait_events,
+                                           VkPipelineStageFlags2 sourceStageMask, const vku::safe_VkDependencyInfo& dependency_info,
                                            const EventMap& local_event_signal_info, VkQueue waiting_queue, const Location& loc);
     bool ValidateQueueFamilyIndices(const Location& loc, const vvl::CommandBuffer& cb_state, const vvl::Queue& queue_state) const;
     VkResult CoreLayerCreateValidationCacheEXT(VkDevice device, const VkValidationCacheCreateInfoEXT* pCreateInfo,
@@ -863,11 +931,20 @@ class CoreChecks : public vvl::DeviceProxy {
                                        const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders,
                                        const RecordObject& record_obj, chassis::ShaderObject& chassis_state) override;
     bool RunSpirvValidation(spv_const_binary_t& binary, const Location& loc, ValidationCache* cache) const;
+    bool ValidateSpirvStateless(const spirv::Module& module_state, const spirv::StatelessData& stateless_data,
+                                const Location& loc) const;
     bool ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo& create_info, const Location& create_info_loc) const;
+    bool CanDeferSpirvValidation(const VkShaderModuleCreateInfo& create_info) const;
+    void RunDeferredSpirvValidation(DeferredSpirvValidation& deferred) const;
+    // Returns false if spirv-val found an error in the module
+    bool WaitForDeferredSpirvValidation(const spirv::Module& module_state) const;
     bool PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                            const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
                                            const ErrorObject& error_obj) const override;
     virtual bool ValidateShaderStage(const ShaderStageState& stage_state, const vvl::Pipeline* pipeline, const Location& loc) const;
+    // Hash of the module code, the entry point and the values its spec constants get
+    static uint64_t GetSpecializationKey(const spirv::Module& module_state, const spirv::EntryPoint& entrypoint,
+                                         const std::unordered_map<uint32_t, std::vector<uint32_t>>& id_value_map);
     bool ValidatePointSizeShaderState(const spirv::Module& module_state, const spirv::EntryPoint& entrypoint,
                                       const vvl::Pipeline& pipeline, VkShaderStageFlagBits stage, const Location& loc) const;
     bool ValidatePrimitiveRateShaderState(const spirv::Module& module_state, const spirv::EntryPoint& entrypoint,
@@ -902,9 +979,13 @@ class CoreChecks : public vvl::DeviceProxy {
     bool ValidatePrimitiveTopology(const spirv::Module& module_state, const spirv::EntryPoint& entrypoint,
                                    const vvl::Pipeline& pipeline, const Location& loc) const;
     bool ValidateSpecializations(const vku::safe_VkSpecializationInfo* spec, const Location& loc) const;
+    // Skips the pairs that were already found valid
     bool ValidateInterfaceBetweenStages(const spirv::Module& producer, const spirv::EntryPoint& producer_entrypoint,
                                         const spirv::Module& consumer, const spirv::EntryPoint& consumer_entrypoint,
                                         const Location& create_info_loc) const;
+    bool ValidateInterfaceSlotsBetweenStages(const spirv::Module& producer, const spirv::EntryPoint& producer_entrypoint,
+                                             const spirv::Module& consumer, const spirv::EntryPoint& consumer_entrypoint,
+                                             const Location& create_info_loc) const;
     bool ValidateFsOutputsAgainstRenderPass(const spirv::Module& module_state, const spirv::EntryPoint& entrypoint,
                                             const vvl::Pipeline& pipeline, uint32_t subpass_index,
                                             const Location& create_info_loc) const;
@@ -1128,6 +1209,8 @@ class CoreChecks : public vvl::DeviceProxy {
 
     bool ValidateCmdBufImageLayouts(const Location& loc, const vvl::CommandBuffer& cb_state,
                                     vvl::unordered_map<const vvl::Image*, ImageLayoutMap>& local_image_layout_state) const;
+    bool ValidateCmdBufImageLayout(const Location& loc, const vvl::CommandBuffer& cb_state, const vvl::Image& image_state,
+                                   const CommandBufferImageLayoutMap& cb_layout_map, ImageLayoutMap& local_layout_map) const;
 
     void UpdateCmdBufImageLayouts(const vvl::CommandBuffer& cb_state);
 
@@ -1195,6 +1278,13 @@ class CoreChecks : public vvl::DeviceProxy {
     template <typename RegionType>
     bool ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buffer& src_buffer_state, const vvl::Buffer& dst_buffer_state,
                                      uint32_t regionCount, const RegionType* pRegions, const Location& loc) const;
+    // With the deferred_command_validation setting, ValidateCmdCopyBufferBounds() is run at vkEndCommandBuffer instead
+    void EnqueueValidateCmdCopyBufferBounds(core::CommandBufferSubState& cb_sub_state, const vvl::Buffer& src_buffer_state,
+                                            const vvl::Buffer& dst_buffer_state, uint32_t region_count, const VkBufferCopy* regions,
+                                            const Location& loc);
+    void EnqueueValidateCmdCopyBufferBounds(core::CommandBufferSubState& cb_sub_state, const vvl::Buffer& src_buffer_state,
+                                            const vvl::Buffer& dst_buffer_state, uint32_t region_count,
+                                            const VkBufferCopy2* regions, const Location& loc);
 
     template <typename HandleT>
     bool ValidateImageBounds(const HandleT handle, const vvl::Image& image_state, VkExtent3D extent, VkOffset3D offset,
@@ -1371,6 +1461,23 @@ class CoreChecks : public vvl::DeviceProxy {
                                                 VkDeviceAddress indirectDeviceAddress, const ErrorObject& error_obj) const override;
     bool PreCallValidateCmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffer, VkDeviceAddress indirectDeviceAddress,
                                                  const ErrorObject& error_obj) const override;
+    void RecordTraceRaysShaderBindingTables(VkCommandBuffer commandBuffer,
+                                            const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable,
+                                            const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable,
+                                            const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable,
+                                            const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable);
+    void PostCallRecordCmdTraceRaysKHR(VkCommandBuffer commandBuffer,
+                                       const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable,
+                                       const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable,
+                                       const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable,
+                                       const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, uint32_t width,
+                                       uint32_t height, uint32_t depth, const RecordObject& record_obj) override;
+    void PostCallRecordCmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer,
+                                               const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable,
+                                               const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable,
+                                               const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable,
+                                               const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable,
+                                               VkDeviceAddress indirectDeviceAddress, const RecordObject& record_obj) override;
     bool ValidateDeferredOperation(VkDevice device, VkDeferredOperationKHR deferred_operation, const Location& loc,
                                    const char* vuid) const;
     void FinishDeviceSetup(const VkDeviceCreateInfo* pCreateInfo, const Location& loc) override;
@@ -1404,6 +1511,9 @@ class CoreChecks : public vvl::DeviceProxy {
     bool PreCallValidateCmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const ErrorObject& error_obj) const override;
     void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator,
                                     const RecordObject& record_obj) override;
+    void SaveValidationCache(const Location& loc);
+    void PostCallRecordGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData,
+                                            const RecordObject& record_obj) override;
     bool PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence,
                                     const ErrorObject& error_obj) const override;
     void PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence,
@@ -1567,6 +1677,8 @@ class CoreChecks : public vvl::DeviceProxy {
                                          const ErrorObject& error_obj) const override;
     bool PreCallValidateDestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks* pAllocator,
                                          const ErrorObject& error_obj) const override;
+    void PreCallRecordDestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks* pAllocator,
+                                       const RecordObject& record_obj) override;
     bool PreCallValidateCmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCount, const VkShaderStageFlagBits* pStages,
                                           const VkShaderEXT* pShaders, const ErrorObject& error_obj) const override;
     bool PreCallValidateGetShaderBinaryDataEXT(VkDevice device, VkShaderEXT shader, size_t* pDataSize, void* pData,
@@ -2499,6 +2611,9 @@ class CoreChecks : public vvl::DeviceProxy {
     bool PreCallValidateCmdBindDescriptorBuffersEXT(VkCommandBuffer commandBuffer, uint32_t bufferCount,
                                                     const VkDescriptorBufferBindingInfoEXT* pBindingInfos,
                                                     const ErrorObject& error_obj) const override;
+    void PostCallRecordCmdBindDescriptorBuffersEXT(VkCommandBuffer commandBuffer, uint32_t bufferCount,
+                                                   const VkDescriptorBufferBindingInfoEXT* pBindingInfos,
+                                                   const RecordObject& record_obj) override;
     bool ValidateDescriptorAddressInfoEXT(const VkDescriptorAddressInfoEXT* address_info, const Location& address_loc) const;
     bool ValidateGetDescriptorDataSize(const VkDescriptorGetInfoEXT& descriptor_info, const size_t data_size,
                                        const Location& descriptor_info_loc) const;
@@ -18,7 +18,10 @@
 #include "descriptor_validator.h"
 #include <vulkan/vulkan_core.h>
 #include <vulkan/utility/vk_format_utils.h>
+#include <algorithm>
 #include <sstream>
+#include <type_traits>
+#include "containers/scratch_arena.h"
 #include "generated/spirv_grammar_helper.h"
 #include "generated/spirv_validation_helper.h"
 #include "state_tracker/shader_stage_state.h"
@@ -33,6 +36,7 @@
 #include "state_tracker/shader_module.h"
 #include "drawdispatch/drawdispatch_vuids.h"
 #include "utils/action_command_utils.h"
+#include "utils/task_pool.h"
 
 namespace vvl {
 
@@ -111,7 +115,7 @@ std::string DescriptorValidator::DescribeDescriptor(const spirv::ResourceInterfa
 
 DescriptorValidator::DescriptorValidator(vvl::DeviceProxy &dev, CommandBuffer &cb_state, DescriptorSet &descriptor_set,
                                          uint32_t set_index, VkFramebuffer framebuffer, const VulkanTypedHandle *shader_handle,
-                                         const Location &loc)
+                                         const Location &loc, TaskPool *task_pool)
     : Logger(dev.debug_report),
       dev_proxy(dev),
       cb_state(cb_state),
@@ -119,14 +123,44 @@ DescriptorValidator::DescriptorValidator(vvl::DeviceProxy &dev, CommandBuffer &c
       framebuffer(framebuffer),
       loc(loc),
       vuids(GetDrawDispatchVuid(loc.function)),
+      task_pool(task_pool),
       set_index(set_index),
       shader_handle(shader_handle) {}
 
+// Bindless arrays can hold hundreds of thousands of descriptors, all validated at every draw when not partially bound
+static constexpr uint32_t kParallelDescriptorCount = 4096;
+static constexpr uint32_t kDescriptorsPerTask = 1024;
+
 template <typename T>
 bool DescriptorValidator::ValidateDescriptorsStatic(const spirv::ResourceInterfaceVariable &resource_variable,
                                                     const T &binding) const {
+    if (!task_pool || binding.count < kParallelDescriptorCount) {
+        return ValidateDescriptorRangeStatic(resource_variable, binding, 0, binding.count, nullptr);
+    }
+
+    // Like the serial loop, a task stops at its first error, and the other tasks stop once one of them found an error
+    std::atomic<bool> found_error{false};
+    const uint32_t task_count = (binding.count + kDescriptorsPerTask - 1) / kDescriptorsPerTask;
+    task_pool->ParallelFor(task_count, [&](uint32_t task_index) {
+        const uint32_t begin = task_index * kDescriptorsPerTask;
+        const uint32_t end = std::min(begin + kDescriptorsPerTask, binding.count);
+        if (ValidateDescriptorRangeStatic(resource_variable, binding, begin, end, &found_error)) {
+            found_error.store(true, std::memory_order_relaxed);
+        }
+    });
+    return found_error.load();
+}
+
+template <typename T>
+bool DescriptorValidator::ValidateDescriptorRangeStatic(const spirv::ResourceInterfaceVariable &resource_variable,
+                                                        const T &binding, uint32_t begin, uint32_t end,
+                                                        const std::atomic<bool> *stop) const {
     bool skip = false;
-    for (uint32_t index = 0; !skip && index < binding.count; index++) {
+    VerifiedImageLayouts verified_layouts;
+    for (uint32_t index = begin; !skip && index < end; index++) {
+        if (stop && stop->load(std::memory_order_relaxed)) {
+            break;
+        }
         const auto &descriptor = binding.descriptors[index];
 
         if (!binding.updated[index]) {
@@ -138,7 +172,11 @@ bool DescriptorValidator::ValidateDescriptorsStatic(const spirv::ResourceInterfa
                          GetActionType(loc.Get().function));
             return skip;  // early return if invalid
         }
-        skip |= ValidateDescriptor(resource_variable, index, binding.type, descriptor);
+        if constexpr (std::is_base_of_v<ImageDescriptor, std::decay_t<decltype(descriptor)>>) {
+            skip |= ValidateDescriptor(resource_variable, index, binding.type, descriptor, &verified_layouts);
+        } else {
+            skip |= ValidateDescriptor(resource_variable, index, binding.type, descriptor);
+        }
     }
     return skip;
 }
@@ -204,7 +242,7 @@ bool DescriptorValidator::ValidateBindingDynamic(const spirv::ResourceInterfaceV
             break;
         case DescriptorClass::ImageSampler: {
             auto &img_sampler_binding = static_cast<ImageSamplerBinding &>(binding);
-            if (dev_proxy.gpuav_settings.validate_image_layout) {
+            if (dev_proxy.gpuav_settings.validate_image_layout && img_sampler_binding.updated[index]) {
                 auto &descriptor = img_sampler_binding.descriptors[index];
                 descriptor.UpdateImageLayoutDrawState(cb_state);
             }
@@ -213,7 +251,7 @@ bool DescriptorValidator::ValidateBindingDynamic(const spirv::ResourceInterfaceV
         }
         case DescriptorClass::Image: {
             auto &img_binding = static_cast<ImageBinding &>(binding);
-            if (dev_proxy.gpuav_settings.validate_image_layout) {
+            if (dev_proxy.gpuav_settings.validate_image_layout && img_binding.updated[index]) {
                 auto &descriptor = img_binding.descriptors[index];
                 descriptor.UpdateImageLayoutDrawState(cb_state);
             }
@@ -282,11 +320,13 @@ bool DescriptorValidator::ValidateDescriptor(const spirv::ResourceInterfaceVaria
 
 // 'index' is the index into the descriptor
 bool DescriptorValidator::ValidateDescriptor(const spirv::ResourceInterfaceVariable &resource_variable, const uint32_t index,
-                                             VkDescriptorType descriptor_type, const ImageDescriptor &image_descriptor) const {
+                                             VkDescriptorType descriptor_type, const ImageDescriptor &image_descriptor,
+                                             VerifiedImageLayouts *verified_layouts) const {
     // We skip various parts of checks for core check to prevent false positive when we don't know the index
     bool skip = false;
     const bool is_gpu_av = dev_proxy.container_type == LayerObjectTypeGpuAssisted;
-    std::vector<const Sampler *> sampler_states;
+    // Done for every image descriptor a draw accesses, keep it off the heap
+    vvl::ScratchVector<const Sampler *> sampler_states;
     const VkImageView image_view = image_descriptor.GetImageView();
     const ImageView *image_view_state = image_descriptor.GetImageViewState();
 
@@ -457,13 +497,21 @@ bool DescriptorValidator::ValidateDescriptor(const spirv::ResourceInterfaceVaria
         }
     }
 
-    if (!dev_proxy.disabled[image_layout_validation]) {
-        VkImageLayout image_layout = image_descriptor.GetImageLayout();
+    const VkImageLayout image_layout = image_descriptor.GetImageLayout();
+    bool layout_verified = false;
+    if (verified_layouts) {
+        auto it = verified_layouts->find(image_view_state);
+        layout_verified = it != verified_layouts->end() && it->second == image_layout;
+    }
+    if (!dev_proxy.disabled[image_layout_validation] && !layout_verified) {
         // Verify Image Layout
         // No "invalid layout" VUID required for this call, since the optimal_layout parameter is UNDEFINED.
         bool hit_error = false;
         dev_proxy.VerifyImageLayout(cb_state, *image_view_state, image_layout, loc.Get(),
                                     "VUID-VkDescriptorImageInfo-imageLayout-00344", &hit_error);
+        if (!hit_error && verified_layouts) {
+            (*verified_layouts)[image_view_state] = image_layout;
+        }
         if (hit_error) {
             std::stringstream msg;
             if (!descriptor_set.IsPushDescriptor()) {
@@ -884,9 +932,11 @@ bool DescriptorValidator::ValidateDescriptor(const spirv::ResourceInterfaceVaria
 }
 
 bool DescriptorValidator::ValidateDescriptor(const spirv::ResourceInterfaceVariable &resource_variable, const uint32_t index,
-                                             VkDescriptorType descriptor_type, const ImageSamplerDescriptor &descriptor) const {
+                                             VkDescriptorType descriptor_type, const ImageSamplerDescriptor &descriptor,
+                                             VerifiedImageLayouts *verified_layouts) const {
     bool skip = false;
-    skip |= ValidateDescriptor(resource_variable, index, descriptor_type, static_cast<const ImageDescriptor &>(descriptor));
+    skip |= ValidateDescriptor(resource_variable, index, descriptor_type, static_cast<const ImageDescriptor &>(descriptor),
+                               verified_layouts);
     if (skip) {
         return skip;
     }
@@ -16,8 +16,10 @@
  */
 
 #pragma once
+#include <atomic>
 #include <vulkan/vulkan.h>
 #include "error_message/error_location.h"
+#include "containers/custom_containers.h"
 
 namespace spirv {
 struct ResourceInterfaceVariable;
@@ -36,11 +38,14 @@ class SamplerDescriptor;
 class CommandBuffer;
 class Sampler;
 class DescriptorSet;
+class ImageView;
+class TaskPool;
 
 class DescriptorValidator : public Logger {
   public:
     DescriptorValidator(DeviceProxy& dev, vvl::CommandBuffer& cb_state, vvl::DescriptorSet& descriptor_set, uint32_t set_index,
-                        VkFramebuffer framebuffer, const VulkanTypedHandle* shader_handle, const Location& loc);
+                        VkFramebuffer framebuffer, const VulkanTypedHandle* shader_handle, const Location& loc,
+                        TaskPool* task_pool = nullptr);
 
     // Used with normal validation where we know which descriptors are accessed.
     bool ValidateBindingStatic(const spirv::ResourceInterfaceVariable& binding_info, const vvl::DescriptorBinding& binding) const;
@@ -53,8 +58,16 @@ class DescriptorValidator : public Logger {
     void SetLocationForGpuAv(const Location& loc) { this->loc = LocationCapture(loc); }
 
   private:
+    // Image views of a binding already found to match the command buffer layouts, with the layout of their descriptor.
+    // Texture arrays often hold the same view many times, the layout map is then only walked once for it.
+    using VerifiedImageLayouts = vvl::unordered_map<const ImageView*, VkImageLayout>;
+
     template <typename T>
     bool ValidateDescriptorsStatic(const spirv::ResourceInterfaceVariable& binding_info, const T& binding) const;
+    // Validates the descriptors in [begin, end), stops early once |stop| is set by another chunk of the same binding
+    template <typename T>
+    bool ValidateDescriptorRangeStatic(const spirv::ResourceInterfaceVariable& binding_info, const T& binding, uint32_t begin,
+                                       uint32_t end, const std::atomic<bool>* stop) const;
 
     template <typename T>
     bool ValidateDescriptorsDynamic(const spirv::ResourceInterfaceVariable& binding_info, const T& binding, const uint32_t index);
@@ -62,9 +75,11 @@ class DescriptorValidator : public Logger {
     bool ValidateDescriptor(const spirv::ResourceInterfaceVariable& binding_info, const uint32_t index,
                             VkDescriptorType descriptor_type, const vvl::BufferDescriptor& descriptor) const;
     bool ValidateDescriptor(const spirv::ResourceInterfaceVariable& binding_info, const uint32_t index,
-                            VkDescriptorType descriptor_type, const vvl::ImageDescriptor& descriptor) const;
+                            VkDescriptorType descriptor_type, const vvl::ImageDescriptor& descriptor,
+                            VerifiedImageLayouts* verified_layouts = nullptr) const;
     bool ValidateDescriptor(const spirv::ResourceInterfaceVariable& binding_info, const uint32_t index,
-                            VkDescriptorType descriptor_type, const vvl::ImageSamplerDescriptor& descriptor) const;
+                            VkDescriptorType descriptor_type, const vvl::ImageSamplerDescriptor& descriptor,
+                            VerifiedImageLayouts* verified_layouts = nullptr) const;
     bool ValidateDescriptor(const spirv::ResourceInterfaceVariable& binding_info, const uint32_t index,
                             VkDescriptorType descriptor_type, const vvl::TexelDescriptor& descriptor) const;
     bool ValidateDescriptor(const spirv::ResourceInterfaceVariable& binding_info, const uint32_t index,
@@ -85,6 +100,8 @@ class DescriptorValidator : public Logger {
     const VkFramebuffer framebuffer;
     LocationCapture loc;
     const DrawDispatchVuid& vuids;
+    // When set, the static validation of huge arrays is split across the pool threads
+    TaskPool* task_pool;
 
     // For GPU-AV, these can become aliased and need to be mutable between descriptor accesses
     uint32_t set_index;
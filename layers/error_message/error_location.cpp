@@ -16,9 +16,13 @@
  * limitations under the License.
  */
 #include "error_location.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <sstream>
 #include "generated/error_location_helper.h"
 
-void Location::AppendFields(std::ostream& out) const {
+void Location::AppendFields(std::string& out) const {
     if (prev) {
         // When apply a .dot(sub_index) we duplicate the field item
         // Instead of dealing with partial non-const Location, just do the check here
@@ -29,38 +33,49 @@ void Location::AppendFields(std::ostream& out) const {
 
         // check if need connector from last item
         if (prev_loc.structure != vvl::Struct::Empty || prev_loc.field != vvl::Field::Empty) {
-            out << ((prev_loc.index == kNoIndex && IsFieldPointer(prev_loc.field)) ? "->" : ".");
+            out += (prev_loc.index == kNoIndex && IsFieldPointer(prev_loc.field)) ? "->" : ".";
         }
     }
     if (isPNext && structure != vvl::Struct::Empty) {
-        out << "pNext<" << vvl::String(structure) << (field != vvl::Field::Empty ? ">." : ">");
+        out += "pNext<";
+        out += vvl::String(structure);
+        out += (field != vvl::Field::Empty) ? ">." : ">";
     }
     if (field != vvl::Field::Empty) {
-        out << vvl::String(field);
+        out += vvl::String(field);
         if (index != kNoIndex) {
-            out << "[" << index << "]";
+            char index_str[16];
+            snprintf(index_str, sizeof(index_str), "[%" PRIu32 "]", index);
+            out += index_str;
         }
     }
 }
 
 std::string Location::Fields() const {
-    std::stringstream out;
+    std::string out;
     AppendFields(out);
-    return out.str();
+    return out;
 }
 
-std::string Location::Message() const {
-    std::stringstream out;
+void Location::AppendMessage(std::string& out) const {
     if (debug_region && !debug_region->empty()) {
-        out << "[ Debug region: " << *debug_region << " ] ";
+        out += "[ Debug region: ";
+        out += *debug_region;
+        out += " ] ";
     }
-    out << StringFunc() << "(): ";
+    out += StringFunc();
+    out += "(): ";
+    const size_t fields_start = out.size();
     AppendFields(out);
-    std::string message = out.str();
     // Remove space in the end when no fields are added
-    if (message.back() == ' ') {
-        message.pop_back();
+    if (out.size() == fields_start) {
+        out.pop_back();
     }
+}
+
+std::string Location::Message() const {
+    std::string message;
+    AppendMessage(message);
     return message;
 }
 
@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <string>
+#include <type_traits>
 
 #include "generated/error_location_helper.h"
 #include "logging.h"
@@ -29,6 +30,9 @@
 
 // Holds the 'Location' of where the code is inside a function/struct/etc
 // see docs/error_object.md for more details
+//
+// Built for every array element and struct member that is validated, even when nothing is wrong, so it is only a few enums
+// and a pointer to the parent Location. Nothing is turned into a string until a message is logged (see Message())
 struct Location {
     static const uint32_t kNoIndex = vvl::kU32Max;
 
@@ -42,11 +46,11 @@ struct Location {
     const Location* prev{};
     mutable const std::string* debug_region{};
 
-    Location(vvl::Func func, vvl::Struct s, vvl::Field f = vvl::Field::Empty, uint32_t i = kNoIndex)
+    constexpr Location(vvl::Func func, vvl::Struct s, vvl::Field f = vvl::Field::Empty, uint32_t i = kNoIndex)
         : function(func), structure(s), field(f), index(i), isPNext(false), prev(nullptr) {}
-    Location(vvl::Func func, vvl::Field f = vvl::Field::Empty, uint32_t i = kNoIndex)
+    constexpr Location(vvl::Func func, vvl::Field f = vvl::Field::Empty, uint32_t i = kNoIndex)
         : function(func), structure(vvl::Struct::Empty), field(f), index(i), isPNext(false), prev(nullptr) {}
-    Location(const Location& prev_loc, vvl::Struct s, vvl::Field f, uint32_t i, bool p)
+    constexpr Location(const Location& prev_loc, vvl::Struct s, vvl::Field f, uint32_t i, bool p)
         : function(prev_loc.function), structure(s), field(f), index(i), isPNext(p), prev(&prev_loc) {}
     Location(const Location& loc, std::string& debug_region)
         : function(loc.function),
@@ -57,31 +61,34 @@ struct Location {
           prev(loc.prev),
           debug_region(&debug_region) {}
 
-    void AppendFields(std::ostream &out) const;
+    void AppendFields(std::string &out) const;
 
     // Returns concatenated fields, does not include function part.
     std::string Fields() const;
 
+    // Appends the location as it appears in the error message, so the caller can build the whole message in one buffer
+    void AppendMessage(std::string &out) const;
+
     // Returns location representation as it appears in the error message. Used by the LogError().
     std::string Message() const;
 
     // the dot() method is for walking down into a structure that is being validated
     // eg:  loc.dot(Field::pMemoryBarriers, 5).dot(Field::srcStagemask)
-    Location dot(vvl::Struct s, vvl::Field sub_field, uint32_t sub_index = kNoIndex) const {
+    constexpr Location dot(vvl::Struct s, vvl::Field sub_field, uint32_t sub_index = kNoIndex) const {
         Location result(*this, s, sub_field, sub_index, false);
         return result;
     }
-    Location dot(vvl::Field sub_field, uint32_t sub_index = kNoIndex) const {
+    constexpr Location dot(vvl::Field sub_field, uint32_t sub_index = kNoIndex) const {
         Location result(*this, this->structure, sub_field, sub_index, false);
         return result;
     }
-    Location dot(uint32_t sub_index) const {
+    constexpr Location dot(uint32_t sub_index) const {
         Location result(*this, this->structure, this->field, sub_index, false);
         return result;
     }
 
     // same as dot() but will mark these were part of a pNext struct
-    Location pNext(vvl::Struct s, vvl::Field sub_field = vvl::Field::Empty, uint32_t sub_index = kNoIndex) const {
+    constexpr Location pNext(vvl::Struct s, vvl::Field sub_field = vvl::Field::Empty, uint32_t sub_index = kNoIndex) const {
         Location result(*this, s, sub_field, sub_index, true);
         return result;
     }
@@ -90,22 +97,27 @@ struct Location {
     const char* StringStruct() const { return vvl::String(structure); }
     const char* StringField() const { return vvl::String(field); }
 };
+static_assert(std::is_trivially_copyable_v<Location> && std::is_trivially_destructible_v<Location>,
+              "Location is created on the hot path for every validated member, it must stay a plain value");
 
 std::string PrintPNextChain(vvl::Struct in_struct, const void* in_pNext);
 
 // Contains the base information needed for errors to be logged out
 // Created for each function as a starting point to build off of
+//
+// Every call through the chassis builds one, so it holds no LogObjectList (pass |handle| to LogError() and it is
+// only created if a message is logged)
 struct ErrorObject {
     const Location location;   // starting location (Always the function entrypoint)
     const VulkanTypedHandle handle;  // dispatchable handle is always first parameter of the function call
-    const LogObjectList objlist;
     const chassis::HandleData* handle_data;
 
     ErrorObject(vvl::Func command_, VulkanTypedHandle handle_)
-        : location(Location(command_)), handle(handle_), objlist(handle), handle_data(nullptr) {}
+        : location(Location(command_)), handle(handle_), handle_data(nullptr) {}
     ErrorObject(vvl::Func command_, VulkanTypedHandle handle_, const chassis::HandleData* handle_data_)
-        : location(Location(command_)), handle(handle_), objlist(handle), handle_data(handle_data_) {}
+        : location(Location(command_)), handle(handle_), handle_data(handle_data_) {}
 };
+static_assert(std::is_trivially_destructible_v<ErrorObject>, "ErrorObject is created for every call, keep it a plain value");
 
 namespace vvl {
 
@@ -16,8 +16,12 @@
  */
 #include "logging.h"
 
+#include <algorithm>
+#include <cinttypes>
 #include <csignal>
+#include <cstdio>
 #include <cstring>
+#include <utility>
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 #include <debugapi.h>
 #endif
@@ -32,6 +36,7 @@
 #include "error_location.h"
 #include "utils/hash_util.h"
 #include "utils/text_utils.h"
+#include "utils/thread_utils.h"
 #include "error_message/log_message_type.h"
 
 [[maybe_unused]] const char *kVUIDUndefined = "VUID_Undefined";
@@ -97,8 +102,82 @@ void DebugReport::RemoveDebugUtilsCallback(uint64_t callback) {
 }
 
 // We try to return as early as we can if we know we don't need to spend time logging the message
+static thread_local uint64_t thread_message_count = 0;
+
+// We have a few speical VUID we never actually want to suppress.
+// If a new VUID is added here, make sure to add it in VkLayerTest.VuidHashStability test as well.
+static bool IsExemptFromMessageLimit(uint32_t vuid_hash) {
+    // We want to print DebugPrintf message forever, otherwise user will mistake duplicate limit for things not printing
+    return (vuid_hash == 0x4fe1fef9) ||
+           // GPU-AV gives lots of warnings on setup to inform user which settings we are adjusting under them
+           (vuid_hash == 0x24b5c69f);
+}
+
+uint64_t DebugReport::GetThreadMessageCount() { return thread_message_count; }
+
+const std::atomic<uint32_t> *DebugReport::FindMessageCount(uint32_t vuid_hash) const {
+    if (vuid_hash != 0) {
+        for (uint32_t probe = 0; probe < kMessageCountProbes; ++probe) {
+            const MessageCount &slot = message_counts[(vuid_hash + probe) % kMessageCountSlots];
+            const uint32_t slot_hash = slot.vuid_hash.load(std::memory_order_acquire);
+            if (slot_hash == vuid_hash) {
+                return &slot.count;
+            }
+            // Slots are never released, so the probe sequence of a VUID that has one can not contain an empty slot
+            if (slot_hash == 0) {
+                return nullptr;
+            }
+        }
+    }
+    std::lock_guard<std::mutex> lock(message_count_overflow_mutex);
+    auto it = message_count_overflow.find(vuid_hash);
+    return it != message_count_overflow.end() ? it->second.get() : nullptr;
+}
+
+std::atomic<uint32_t> &DebugReport::GetMessageCount(uint32_t vuid_hash) {
+    if (vuid_hash != 0) {
+        for (uint32_t probe = 0; probe < kMessageCountProbes; ++probe) {
+            MessageCount &slot = message_counts[(vuid_hash + probe) % kMessageCountSlots];
+            uint32_t slot_hash = slot.vuid_hash.load(std::memory_order_acquire);
+            if (slot_hash == 0 && slot.vuid_hash.compare_exchange_strong(slot_hash, vuid_hash, std::memory_order_acq_rel)) {
+                return slot.count;
+            }
+            // Either it was already ours, or another thread claimed the empty slot for the same VUID first
+            if (slot_hash == vuid_hash) {
+                return slot.count;
+            }
+        }
+    }
+    std::lock_guard<std::mutex> lock(message_count_overflow_mutex);
+    auto &count = message_count_overflow[vuid_hash];
+    if (!count) {
+        count = std::make_unique<std::atomic<uint32_t>>(0);
+    }
+    return *count;
+}
+
+bool DebugReport::IsMessageReported(VkFlags msg_flags, std::string_view vuid_text) const {
+    VkDebugUtilsMessageSeverityFlagsEXT msg_severity;
+    VkDebugUtilsMessageTypeFlagsEXT msg_type;
+    DebugReportFlagsToAnnotFlags(msg_flags, &msg_severity, &msg_type);
+    bool reported = (active_msg_severities & msg_severity) && (active_msg_types & msg_type);
+
+    const uint32_t vuid_hash = hash_util::VuidHash(vuid_text);
+    reported = reported && filter_message_ids.find(vuid_hash) == filter_message_ids.end();
+
+    if (reported && duplicate_message_limit > 0 && !IsExemptFromMessageLimit(vuid_hash)) {
+        const std::atomic<uint32_t> *message_count = FindMessageCount(vuid_hash);
+        reported = !message_count || message_count->load(std::memory_order_relaxed) < duplicate_message_limit;
+    }
+    if (!reported) {
+        ++thread_message_count;
+    }
+    return reported;
+}
+
 bool DebugReport::LogMessage(VkFlags msg_flags, std::string_view vuid_text, const LogObjectList &objects, const Location &loc,
                              const std::string &main_message) {
+    ++thread_message_count;
     // Convert the info to the VK_EXT_debug_utils format
     VkDebugUtilsMessageSeverityFlagsEXT msg_severity;
     VkDebugUtilsMessageTypeFlagsEXT msg_type;
@@ -113,31 +192,21 @@ bool DebugReport::LogMessage(VkFlags msg_flags, std::string_view vuid_text, cons
         return false;
     }
 
-    // We have a few speical VUID we never actually want to suppress.
-    // If a new VUID is added here, make sure to add it in VkLayerTest.VuidHashStability test as well.
-    const bool skip_checking_limit =
-        // We want to print DebugPrintf message forever, otherwise user will mistake duplicate limit for things not printing
-        (vuid_hash == 0x4fe1fef9) ||
-        // GPU-AV gives lots of warnings on setup to inform user which settings we are adjusting under them
-        (vuid_hash == 0x24b5c69f);
+    const bool skip_checking_limit = IsExemptFromMessageLimit(vuid_hash);
 
     // Count for this particular message is over the limit, ignore it
     bool at_message_limit = false;
     if (duplicate_message_limit > 0 && !skip_checking_limit) {
-        auto vuid_count_it = duplicate_message_count_map.find(vuid_hash);
-        if (vuid_count_it == duplicate_message_count_map.end()) {
-            duplicate_message_count_map.emplace(vuid_hash, 1);
-        } else if (vuid_count_it->second >= duplicate_message_limit) {
+        std::atomic<uint32_t> &message_count = GetMessageCount(vuid_hash);
+        if (message_count.load(std::memory_order_relaxed) >= duplicate_message_limit) {
             return false;
-        } else {
-            // In theory we have not locked the mutex yet
-            // 1. Its hard to have 2 exact VUID be called at same time
-            // 2. This limit is rarely, if ever, used to get an exact amount and really just there to stop spamming the user
-            vuid_count_it->second++;
-            if (vuid_count_it->second >= duplicate_message_limit) {
-                at_message_limit = true;
-            }
         }
+        // Threads racing past the check above can take the count over the limit, only the one that reaches it is reported last
+        const uint32_t count = message_count.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (count > duplicate_message_limit) {
+            return false;
+        }
+        at_message_limit = count == duplicate_message_limit;
     }
 
     std::unique_lock<std::mutex> lock(debug_output_mutex);
@@ -195,6 +264,35 @@ bool DebugReport::LogMessage(VkFlags msg_flags, std::string_view vuid_text, cons
         object_name_infos.push_back(object_name_info);
     }
 
+    // The text format is more minimal and will have other information in the callback, the JSON is designed to contain everything
+    std::string full_message = message_format_settings.json ? CreateMessageJson(msg_flags, loc, object_name_infos, vuid_hash,
+                                                                                vuid_text, main_message, at_message_limit)
+                                                            : CreateMessageText(loc, vuid_text, main_message, at_message_limit);
+
+    if (message_delivery_settings.async) {
+        QueuedMessage message;
+        message.msg_flags = msg_flags;
+        message.vuid_text = vuid_text;
+        message.vuid_hash = vuid_hash;
+        message.full_message = std::move(full_message);
+        message.object_names.reserve(object_name_infos.size());
+        for (VkDebugUtilsObjectNameInfoEXT &object_name_info : object_name_infos) {
+            message.object_names.emplace_back(object_name_info.pObjectName ? object_name_info.pObjectName : "");
+            object_name_info.pObjectName = nullptr;
+        }
+        message.object_name_infos = std::move(object_name_infos);
+        for (const VkDebugUtilsLabelEXT &label : queue_labels) {
+            message.queue_labels.emplace_back(&label);
+        }
+        for (const VkDebugUtilsLabelEXT &label : cmd_buf_labels) {
+            message.cmd_buf_labels.emplace_back(&label);
+        }
+        // The delivery thread needs debug_output_mutex to read the callback list, so it can not be held while waiting for room
+        lock.unlock();
+        QueueMessage(std::move(message));
+        return false;
+    }
+
     VkDebugUtilsMessengerCallbackDataEXT callback_data = vku::InitStructHelper();
     callback_data.flags = 0;
     callback_data.pMessageIdName = vuid_text.data();
@@ -207,15 +305,21 @@ bool DebugReport::LogMessage(VkFlags msg_flags, std::string_view vuid_text, cons
     callback_data.objectCount = static_cast<uint32_t>(object_name_infos.size());
     callback_data.pObjects = object_name_infos.data();
 
-    // The text format is more minimal and will have other information in the callback, the JSON is designed to contain everything
-    std::string full_message = message_format_settings.json ? CreateMessageJson(msg_flags, loc, object_name_infos, vuid_hash,
-                                                                                vuid_text, main_message, at_message_limit)
-                                                            : CreateMessageText(loc, vuid_text, main_message, at_message_limit);
+    return CallCallbacks(debug_callback_list, msg_flags, callback_data, object_name_infos, full_message);
+}
+
+// Caller must keep every callback in |callback_list| alive, either by holding debug_output_mutex or by flushing before removal
+bool DebugReport::CallCallbacks(const std::vector<VkLayerDbgFunctionState> &callback_list, VkFlags msg_flags,
+                                VkDebugUtilsMessengerCallbackDataEXT &callback_data,
+                                std::vector<VkDebugUtilsObjectNameInfoEXT> &object_name_infos,
+                                const std::string &full_message) const {
+    VkDebugUtilsMessageSeverityFlagsEXT msg_severity;
+    VkDebugUtilsMessageTypeFlagsEXT msg_type;
+    DebugReportFlagsToAnnotFlags(msg_flags, &msg_severity, &msg_type);
 
-    const auto callback_list = &debug_callback_list;
     // We only output to default callbacks if there are no non-default callbacks
     bool use_default_callbacks = true;
-    for (const auto &current_callback : *callback_list) {
+    for (const auto &current_callback : callback_list) {
         use_default_callbacks &= current_callback.IsDefault();
     }
 
@@ -227,7 +331,7 @@ bool DebugReport::LogMessage(VkFlags msg_flags, std::string_view vuid_text, cons
 
     const char *layer_prefix = "Validation";
     bool bail = false;
-    for (const auto &current_callback : *callback_list) {
+    for (const auto &current_callback : callback_list) {
         // Skip callback if it's a default callback and there are non-default callbacks present
         if (current_callback.IsDefault() && !use_default_callbacks) continue;
 
@@ -250,7 +354,7 @@ bool DebugReport::LogMessage(VkFlags msg_flags, std::string_view vuid_text, cons
             }
             if (current_callback.debug_report_callback_function_ptr(
                     msg_flags, ConvertCoreObjectToDebugReportObject(object_name_infos[0].objectType),
-                    object_name_infos[0].objectHandle, vuid_hash, 0, layer_prefix, full_message.c_str(),
+                    object_name_infos[0].objectHandle, callback_data.messageIdNumber, 0, layer_prefix, full_message.c_str(),
                     current_callback.pUserData)) {
                 bail = true;
             }
@@ -259,24 +363,132 @@ bool DebugReport::LogMessage(VkFlags msg_flags, std::string_view vuid_text, cons
     return bail;
 }
 
+DebugReport::~DebugReport() {
+    {
+        std::unique_lock<std::mutex> lock(delivery_mutex);
+        delivery_stop = true;
+    }
+    delivery_queued_cv.notify_one();
+    if (delivery_thread.joinable()) {
+        delivery_thread.join();
+    }
+}
+
+void DebugReport::QueueMessage(QueuedMessage &&message) {
+    std::unique_lock<std::mutex> lock(delivery_mutex);
+    if (!delivery_thread.joinable()) {
+        delivery_thread = std::thread(&DebugReport::DeliverMessages, this);
+    }
+    const size_t queue_size = std::max(message_delivery_settings.queue_size, 1u);
+    if (delivery_queue.size() >= queue_size) {
+        switch (message_delivery_settings.overflow) {
+            case MessageQueueOverflow::Block:
+                delivery_progress_cv.wait(lock, [this, queue_size] { return delivery_queue.size() < queue_size; });
+                break;
+            case MessageQueueOverflow::DropOldest:
+                delivery_queue.pop_front();
+                ++dropped_message_count;
+                break;
+            case MessageQueueOverflow::DropNewest:
+                ++dropped_message_count;
+                return;
+        }
+    }
+    delivery_queue.emplace_back(std::move(message));
+    lock.unlock();
+    delivery_queued_cv.notify_one();
+}
+
+void DebugReport::FlushMessages() {
+    std::unique_lock<std::mutex> lock(delivery_mutex);
+    delivery_progress_cv.wait(lock, [this] { return delivery_queue.empty() && !delivery_in_progress; });
+}
+
+void DebugReport::DeliverMessages() {
+    vvl::ConfigureCurrentThread("DebugReportDelivery");
+    std::vector<VkLayerDbgFunctionState> callback_list;
+    std::vector<VkDebugUtilsLabelEXT> queue_labels;
+    std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
+    for (;;) {
+        std::unique_lock<std::mutex> lock(delivery_mutex);
+        delivery_in_progress = false;
+        delivery_progress_cv.notify_all();
+        // Drain the queue before stopping so nothing logged before vkDestroyInstance is lost
+        delivery_queued_cv.wait(lock, [this] { return !delivery_queue.empty() || delivery_stop; });
+        if (delivery_queue.empty()) {
+            return;
+        }
+        QueuedMessage message = std::move(delivery_queue.front());
+        delivery_queue.pop_front();
+        delivery_in_progress = true;
+        const uint64_t dropped = std::exchange(dropped_message_count, 0);
+        lock.unlock();
+        delivery_progress_cv.notify_all();
+
+        if (dropped != 0) {
+            message.full_message = "(" + std::to_string(dropped) +
+                                   " earlier messages were dropped because the message delivery queue was full)\n" +
+                                   message.full_message;
+        }
+        for (size_t i = 0; i < message.object_name_infos.size(); ++i) {
+            message.object_name_infos[i].pObjectName =
+                message.object_names[i].empty() ? nullptr : message.object_names[i].c_str();
+        }
+        queue_labels.clear();
+        for (const LoggingLabel &label : message.queue_labels) {
+            queue_labels.emplace_back(label.Export());
+        }
+        cmd_buf_labels.clear();
+        for (const LoggingLabel &label : message.cmd_buf_labels) {
+            cmd_buf_labels.emplace_back(label.Export());
+        }
+
+        VkDebugUtilsMessengerCallbackDataEXT callback_data = vku::InitStructHelper();
+        callback_data.flags = 0;
+        callback_data.pMessageIdName = message.vuid_text.c_str();
+        callback_data.messageIdNumber = vvl_bit_cast<int32_t>(message.vuid_hash);
+        callback_data.pMessage = nullptr;
+        callback_data.queueLabelCount = static_cast<uint32_t>(queue_labels.size());
+        callback_data.pQueueLabels = queue_labels.empty() ? nullptr : queue_labels.data();
+        callback_data.cmdBufLabelCount = static_cast<uint32_t>(cmd_buf_labels.size());
+        callback_data.pCmdBufLabels = cmd_buf_labels.empty() ? nullptr : cmd_buf_labels.data();
+        callback_data.objectCount = static_cast<uint32_t>(message.object_name_infos.size());
+        callback_data.pObjects = message.object_name_infos.data();
+
+        // Copy the list so the slow part runs without debug_output_mutex, LayerDestroyCallback flushes before removing one
+        {
+            std::unique_lock<std::mutex> output_lock(debug_output_mutex);
+            callback_list = debug_callback_list;
+        }
+        CallCallbacks(callback_list, message.msg_flags, callback_data, message.object_name_infos, message.full_message);
+    }
+}
+
 std::string DebugReport::CreateMessageText(const Location &loc, std::string_view vuid_text, const std::string &main_message,
                                            bool at_message_limit) {
-    std::ostringstream oss;
+    // Built in a per thread buffer that keeps its capacity, so the only allocation is the returned copy
+    thread_local std::string out;
+    out.clear();
 
 #if defined(BUILD_SELF_VVL)
-    oss << "[Self Validation] ";  // How we know if the error is from Self Validation when debugging GPU-AV
+    out += "[Self Validation] ";  // How we know if the error is from Self Validation when debugging GPU-AV
 #endif
 
     if (message_format_settings.display_application_name && !message_format_settings.application_name.empty()) {
-        oss << "[AppName: " << message_format_settings.application_name << "] ";
+        out += "[AppName: ";
+        out += message_format_settings.application_name;
+        out += "] ";
     }
 
     if (at_message_limit) {
-        oss << "(Warning - This VUID has now been reported " << duplicate_message_limit
-            << " times, which is the duplicated_message_limit value, this will be the last time reporting it).\n";
+        out += "(Warning - This VUID has now been reported ";
+        out += std::to_string(duplicate_message_limit);
+        out += " times, which is the duplicated_message_limit value, this will be the last time reporting it).\n";
     }
 
-    oss << loc.Message() << " " << main_message;
+    loc.AppendMessage(out);
+    out += ' ';
+    out += main_message;
 
     // Append the spec error text to the error message, unless it contains a word treated as special
     if ((vuid_text.find("VUID-") != std::string::npos)) {
@@ -305,19 +517,26 @@ std::string DebugReport::CreateMessageText(const Location &loc, std::string_view
             // Add period at end if forgotten
             // This provides better seperation between error message and spec text
             if (main_message.back() != '.' && main_message.back() != '\n') {
-                oss << '.';
+                out += '.';
             }
 
             // Start Vulkan spec text with a new line to make it easier visually
             if (main_message.back() != '\n') {
-                oss << '\n';
+                out += '\n';
             }
 
-            oss << "The Vulkan spec states: " << spec_text << " (" << spec_url_base << spec_url_section << "#" << vuid_text << ")";
+            out += "The Vulkan spec states: ";
+            out += spec_text;
+            out += " (";
+            out += spec_url_base;
+            out += spec_url_section;
+            out += '#';
+            out += vuid_text;
+            out += ')';
         }
     }
 
-    return oss.str();
+    return out;
 }
 
 std::string DebugReport::CreateMessageJson(VkFlags msg_flags, const Location &loc,
@@ -455,61 +674,60 @@ std::string DebugReport::CreateMessageJson(VkFlags msg_flags, const Location &lo
     return oss.str();
 }
 
-void DebugReport::SetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
-    if (pNameInfo->pObjectName) {
-        debug_utils_object_name_map[pNameInfo->objectHandle] = pNameInfo->pObjectName;
+static void SetObjectName(DebugReport::ObjectNameMap &map, uint64_t object, const char *name) {
+    if (name) {
+        map.insert_or_assign(object, std::make_shared<const std::string>(name));
     } else {
-        debug_utils_object_name_map.erase(pNameInfo->objectHandle);
+        map.erase(object);
     }
 }
 
-void DebugReport::SetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
-    if (pNameInfo->pObjectName) {
-        debug_object_name_map[pNameInfo->object] = pNameInfo->pObjectName;
-    } else {
-        debug_object_name_map.erase(pNameInfo->object);
+// Empty if the object has no name
+static std::shared_ptr<const std::string> FindObjectName(const DebugReport::ObjectNameMap &map, uint64_t object) {
+    auto found = map.find(object);
+    if (found == map.end() || !found->second || found->second->empty()) {
+        return {};
     }
+    return found->second;
+}
+
+void DebugReport::SetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
+    SetObjectName(debug_utils_object_name_map, pNameInfo->objectHandle, pNameInfo->pObjectName);
+}
+
+void DebugReport::SetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo) {
+    SetObjectName(debug_object_name_map, pNameInfo->object, pNameInfo->pObjectName);
 }
 
-// NoLock suffix means that the function itself does not hold debug_output_mutex lock,
-// and it's **mandatory responsibility** of the caller to hold this lock.
+// NoLock suffix is historical, the names have their own locks and debug_output_mutex may or may not be held by the caller
 std::string DebugReport::GetUtilsObjectNameNoLock(const uint64_t object) const {
-    std::string label = "";
-    const auto utils_name_iter = debug_utils_object_name_map.find(object);
-    if (utils_name_iter != debug_utils_object_name_map.end()) {
-        label = utils_name_iter->second;
-    }
-    return label;
+    const auto name = FindObjectName(debug_utils_object_name_map, object);
+    return name ? *name : std::string();
 }
 
-// NoLock suffix means that the function itself does not hold debug_output_mutex lock,
-// and it's **mandatory responsibility** of the caller to hold this lock.
 std::string DebugReport::GetMarkerObjectNameNoLock(const uint64_t object) const {
-    std::string label = "";
-    const auto marker_name_iter = debug_object_name_map.find(object);
-    if (marker_name_iter != debug_object_name_map.end()) {
-        label = marker_name_iter->second;
-    }
-    return label;
+    const auto name = FindObjectName(debug_object_name_map, object);
+    return name ? *name : std::string();
 }
 
 std::string DebugReport::FormatHandle(const char *handle_type_name, uint64_t handle) const {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
-    std::string handle_name = GetUtilsObjectNameNoLock(handle);
-    if (handle_name.empty()) {
-        handle_name = GetMarkerObjectNameNoLock(handle);
-    }
+    char handle_str[24];
+    snprintf(handle_str, sizeof(handle_str), " 0x%" PRIx64, handle);
 
-    std::ostringstream str;
-    str << handle_type_name << " ";
-    str << "0x" << std::hex << handle;
+    std::string str = handle_type_name;
+    str += handle_str;
 
-    if (!handle_name.empty()) {
-        str << "[" << handle_name.c_str() << "]";
+    // Look the name up without copying it out with Get*ObjectNameNoLock()
+    auto handle_name = FindObjectName(debug_utils_object_name_map, handle);
+    if (!handle_name) {
+        handle_name = FindObjectName(debug_object_name_map, handle);
     }
-    return str.str();
+    if (handle_name) {
+        str += '[';
+        str += *handle_name;
+        str += ']';
+    }
+    return str;
 }
 
 template <typename Map>
@@ -717,6 +935,10 @@ VKAPI_ATTR void DeactivateInstanceDebugCallbacks(DebugReport *debug_report) {
 
 bool DebugReport::LogMessageVaList(VkFlags msg_flags, std::string_view vuid_text, const LogObjectList &objects, const Location &loc,
                                    const char *format, va_list argptr) {
+    // Once a message is filtered or over the duplicate limit, do not pay for formatting it
+    if (!IsMessageReported(msg_flags, vuid_text)) {
+        return false;
+    }
     const std::string main_message = text::VFormat(format, argptr);
     return LogMessage(msg_flags, vuid_text, objects, loc, main_message);
 }
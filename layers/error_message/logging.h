@@ -18,10 +18,14 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstdarg>
+#include <deque>
 #include <mutex>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 #include <memory>
 
@@ -29,6 +33,7 @@
 #include <vulkan/vk_enum_string_helper.h>
 
 #include "containers/custom_containers.h"
+#include "containers/sharded_map.h"
 #include "containers/small_vector.h"
 #include "generated/vk_object_types.h"
 #include "error_message/log_message_type.h"
@@ -181,6 +186,21 @@ struct MessageFormatSettings {
     std::string application_name;
 };
 
+// What a producer does when the async delivery queue is full
+enum class MessageQueueOverflow {
+    Block,       // wait for the delivery thread to make room
+    DropOldest,  // discard the oldest queued message
+    DropNewest,  // discard the new message
+};
+
+struct MessageDeliverySettings {
+    // Messages are handed to a dedicated thread that calls the debug callbacks, so a slow callback does not stall validation.
+    // The return value of the callbacks is ignored, since the Vulkan call has already gone down the chain when they run.
+    bool async = false;
+    uint32_t queue_size = 1024;
+    MessageQueueOverflow overflow = MessageQueueOverflow::Block;
+};
+
 #if defined(__clang__)
 #define DECORATE_PRINTF(_fmt_argnum, _first_param_num) __attribute__((format(printf, _fmt_argnum, _first_param_num)))
 #elif defined(__GNUC__)
@@ -191,6 +211,8 @@ struct MessageFormatSettings {
 
 class DebugReport {
   public:
+    ~DebugReport();
+
     std::vector<VkLayerDbgFunctionState> debug_callback_list;
     // We use unordered_set to use trivial hashing for filter_message_ids as we already store hashed values
     vvl::unordered_set<uint32_t> filter_message_ids{};
@@ -202,9 +224,16 @@ class DebugReport {
     bool force_default_log_callback{false};
     uint32_t device_created = 0;
     MessageFormatSettings message_format_settings;
+    MessageDeliverySettings message_delivery_settings;
 
+    // Waits until every message queued for async delivery has been passed to the callbacks. Must be called without
+    // debug_output_mutex held.
+    void FlushMessages();
+
+    using ObjectNameMap = vvl::ShardedMap<uint64_t, std::shared_ptr<const std::string>>;
     void SetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo);
     void SetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo);
+    // The names are not guarded by debug_output_mutex, these can be called with or without it held
     std::string GetUtilsObjectNameNoLock(const uint64_t object) const;
     std::string GetMarkerObjectNameNoLock(const uint64_t object) const;
 
@@ -231,6 +260,14 @@ class DebugReport {
     bool LogMessage(VkFlags msg_flags, std::string_view vuid_text, const LogObjectList &objects, const Location &loc,
                     const std::string &main_message);
 
+    // False if LogMessage() would drop the message because of its severity, the message filter or the duplicate limit, so that
+    // callers can skip formatting it. A dropped message is counted by GetThreadMessageCount() as if it was logged.
+    bool IsMessageReported(VkFlags msg_flags, std::string_view vuid_text) const;
+
+    // Number of messages the calling thread tried to log, including the ones that were filtered out or over the duplicate
+    // limit. A check that did not change it found nothing, whatever the message settings are.
+    static uint64_t GetThreadMessageCount();
+
     void BeginQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLabelEXT *label_info);
     void EndQueueDebugUtilsLabel(VkQueue queue);
     void InsertQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLabelEXT *label_info);
@@ -242,20 +279,66 @@ class DebugReport {
     void EraseCmdDebugUtilsLabel(VkCommandBuffer command_buffer);
 
   private:
+    // Owning copy of everything the callbacks are given, so it can outlive the call that logged it
+    struct QueuedMessage {
+        VkFlags msg_flags;
+        std::string vuid_text;
+        uint32_t vuid_hash;
+        std::string full_message;
+        std::vector<VkDebugUtilsObjectNameInfoEXT> object_name_infos;
+        std::vector<std::string> object_names;  // pObjectName of object_name_infos[i], empty if it has none
+        std::vector<LoggingLabel> queue_labels;
+        std::vector<LoggingLabel> cmd_buf_labels;
+    };
+
+    bool CallCallbacks(const std::vector<VkLayerDbgFunctionState> &callback_list, VkFlags msg_flags,
+                       VkDebugUtilsMessengerCallbackDataEXT &callback_data,
+                       std::vector<VkDebugUtilsObjectNameInfoEXT> &object_name_infos, const std::string &full_message) const;
+    void QueueMessage(QueuedMessage &&message);
+    void DeliverMessages();
+
     std::string CreateMessageText(const Location &loc, std::string_view vuid_text, const std::string &main_message,
                                   bool at_message_limit);
     std::string CreateMessageJson(VkFlags msg_flags, const Location &loc,
                                   const std::vector<VkDebugUtilsObjectNameInfoEXT> &object_name_infos, const uint32_t vuid_hash,
                                   std::string_view vuid_text, const std::string &main_message, bool at_message_limit);
 
+    const std::atomic<uint32_t> *FindMessageCount(uint32_t vuid_hash) const;
+    std::atomic<uint32_t> &GetMessageCount(uint32_t vuid_hash);
+
     VkDebugUtilsMessageSeverityFlagsEXT active_msg_severities{0};
     VkDebugUtilsMessageTypeFlagsEXT active_msg_types{0};
-    vvl::unordered_map<uint32_t, uint32_t> duplicate_message_count_map{};
+
+    // Times each VUID was reported, for duplicate_message_limit. Every thread that logs updates these, so most VUIDs get a slot in
+    // a fixed open addressed table and are counted with atomics. Only a VUID that finds no free slot within kMessageCountProbes,
+    // or whose hash is 0 (the empty slot value), uses the locked map.
+    struct MessageCount {
+        std::atomic<uint32_t> vuid_hash{0};
+        std::atomic<uint32_t> count{0};
+    };
+    static constexpr uint32_t kMessageCountSlots = 1024;
+    static constexpr uint32_t kMessageCountProbes = 8;
+    std::array<MessageCount, kMessageCountSlots> message_counts{};
+    mutable std::mutex message_count_overflow_mutex;
+    vvl::unordered_map<uint32_t, std::unique_ptr<std::atomic<uint32_t>>> message_count_overflow;
 
     vvl::unordered_map<VkQueue, std::unique_ptr<LoggingLabelState>> debug_utils_queue_labels;
     vvl::unordered_map<VkCommandBuffer, std::unique_ptr<LoggingLabelState>> debug_utils_cmd_buffer_labels;
-    vvl::unordered_map<uint64_t, std::string> debug_object_name_map;
-    vvl::unordered_map<uint64_t, std::string> debug_utils_object_name_map;
+    // Names are kept away from debug_output_mutex, so naming every object does not wait for message output (or the other way
+    // around). The names are immutable once set, a lookup only copies the pointer under the read lock of one shard and the string
+    // is only copied when a message is formatted.
+    ObjectNameMap debug_object_name_map;
+    ObjectNameMap debug_utils_object_name_map;
+
+    // Async delivery, see MessageDeliverySettings. The thread is started by the first queued message.
+    std::mutex delivery_mutex;
+    std::condition_variable delivery_queued_cv;    // signaled when a message is queued or the thread must stop
+    std::condition_variable delivery_progress_cv;  // signaled when a message is taken off the queue or delivered
+    std::deque<QueuedMessage> delivery_queue;
+    bool delivery_in_progress = false;
+    bool delivery_stop = false;
+    uint64_t dropped_message_count = 0;
+    std::thread delivery_thread;
 };
 
 class Logger {
@@ -276,6 +359,16 @@ class Logger {
         return result;
     }
 
+    // Same as LogError, but the message is only built when it is going to be reported
+    template <typename MessageFunc>
+    bool LogErrorDeferred(std::string_view vuid_text, const LogObjectList &objlist, const Location &loc,
+                          MessageFunc &&make_message) const {
+        if (!debug_report->IsMessageReported(kErrorBit, vuid_text)) {
+            return false;
+        }
+        return debug_report->LogMessage(kErrorBit, vuid_text, objlist, loc, make_message());
+    }
+
     // Currently works like LogWarning, but allows developer to better categorize the warning
     bool DECORATE_PRINTF(5, 6) LogUndefinedValue(std::string_view vuid_text, const LogObjectList &objlist, const Location &loc,
                                                  const char *format, ...) const {
@@ -344,6 +437,8 @@ VKAPI_ATTR VkResult LayerCreateReportCallback(DebugReport *debug_report, bool de
 
 template <typename T>
 static inline void LayerDestroyCallback(DebugReport *debug_report, T callback) {
+    // Messages already queued may still call this callback
+    debug_report->FlushMessages();
     std::unique_lock<std::mutex> lock(debug_report->debug_output_mutex);
     debug_report->RemoveDebugUtilsCallback(CastToUint64(callback));
 }
@@ -15,6 +15,8 @@
  */
 #pragma once
 
+#include <type_traits>
+
 #include "chassis/chassis_handle_data.h"
 #include "generated/error_location_helper.h"
 
@@ -37,3 +39,4 @@ struct RecordObject {
 
     bool HasResult() { return result != VK_RESULT_MAX_ENUM; }
 };
+static_assert(std::is_trivially_destructible_v<RecordObject>, "RecordObject is created for every call, keep it a plain value");
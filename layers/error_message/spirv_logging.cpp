@@ -16,8 +16,11 @@
  */
 
 #include "spirv_logging.h"
+#include <algorithm>
+#include <iterator>
 #include <string>
 #include <cstring>
+#include <unordered_map>
 
 // Fix GCC 13 issues with regex
 #if defined(__GNUC__) && (__GNUC__ > 12)
@@ -432,24 +435,29 @@ void GetExecutionModelNames(const std::vector<uint32_t> &instructions, std::ostr
     }
 }
 
-// Find the OpLine/DebugLine just before the failing instruction indicated by the debug info.
-// Return the offset into the instructions array
-uint32_t GetDebugLineOffset(const std::vector<uint32_t> &instructions, uint32_t instruction_position) {
+DebugLineIndex::DebugLineIndex(const std::vector<uint32_t> &instructions) {
     uint32_t index = 0;
     uint32_t shader_debug_info_set_id = 0;
     uint32_t last_line_inst_offset = 0;
+    std::unordered_map<uint32_t, const char *> id_to_name;
 
     uint32_t offset = kModuleStartingOffset;
     while (offset < instructions.size()) {
         const uint32_t instruction = instructions[offset];
         const uint32_t length = Length(instruction);
         const uint32_t opcode = Opcode(instruction);
+        const uint32_t previous_line_inst_offset = last_line_inst_offset;
 
         if (opcode == spv::OpExtInstImport) {
             const char *str = reinterpret_cast<const char *>(&instructions[offset + 2]);
             if (strcmp(str, "NonSemantic.Shader.DebugInfo.100") == 0) {
                 shader_debug_info_set_id = instructions[offset + 1];
             }
+        } else if (opcode == spv::OpName) {
+            id_to_name[instructions[offset + 1]] = reinterpret_cast<const char *>(&instructions[offset + 2]);
+        } else if (opcode == spv::OpFunction) {
+            const auto name_it = id_to_name.find(instructions[offset + 2]);
+            function_ranges_.push_back({index, index, name_it != id_to_name.end() ? name_it->second : ""});
         }
 
         if (opcode == spv::OpExtInst && instructions[offset + 3] == shader_debug_info_set_id &&
@@ -459,17 +467,41 @@ uint32_t GetDebugLineOffset(const std::vector<uint32_t> &instructions, uint32_t
             last_line_inst_offset = offset;
         } else if (opcode == spv::OpFunctionEnd) {
             last_line_inst_offset = 0;  // debug lines can't cross functions boundaries
+            if (!function_ranges_.empty()) {
+                function_ranges_.back().last_position = index;
+            }
         }
 
-        if (index == instruction_position) {
-            break;
+        if (last_line_inst_offset != previous_line_inst_offset) {
+            line_changes_.push_back({index, last_line_inst_offset});
         }
         index++;
 
         offset += length;
     }
+}
+
+uint32_t DebugLineIndex::GetDebugLineOffset(uint32_t instruction_position) const {
+    // Last change at or before the instruction
+    auto it = std::upper_bound(line_changes_.begin(), line_changes_.end(), instruction_position,
+                               [](uint32_t position, const LineChange &change) { return position < change.instruction_position; });
+    if (it == line_changes_.begin()) {
+        return 0;
+    }
+    return std::prev(it)->line_inst_offset;
+}
 
-    return last_line_inst_offset;
+const char *DebugLineIndex::GetFunctionName(uint32_t instruction_position) const {
+    auto it = std::upper_bound(function_ranges_.begin(), function_ranges_.end(), instruction_position,
+                               [](uint32_t position, const FunctionRange &range) { return position < range.first_position; });
+    if (it == function_ranges_.begin()) {
+        return nullptr;
+    }
+    const FunctionRange &range = *std::prev(it);
+    if (instruction_position > range.last_position || range.name.empty()) {
+        return nullptr;
+    }
+    return range.name.c_str();
 }
 
 }  // namespace spirv
\ No newline at end of file
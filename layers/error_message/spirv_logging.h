@@ -18,6 +18,7 @@
 #pragma once
 #include <vector>
 #include <sstream>
+#include <string>
 #include <cstdint>
 
 namespace spirv {
@@ -36,5 +37,32 @@ void GetShaderSourceInfo(std::ostringstream &ss, const std::vector<uint32_t> &in
 const char* GetOpString(const std::vector<uint32_t>& instructions, uint32_t string_id);
 uint32_t GetConstantValue(const std::vector<uint32_t>& instructions, uint32_t constant_id);
 void GetExecutionModelNames(const std::vector<uint32_t>& instructions, std::ostringstream& ss);
-uint32_t GetDebugLineOffset(const std::vector<uint32_t>& instructions, uint32_t instruction_position);
+
+// Maps the instruction position of a GPU-AV error back to the OpLine/DebugLine and function it is in.
+// Built with a single walk of the module, then every reported error is a binary search.
+class DebugLineIndex {
+  public:
+    explicit DebugLineIndex(const std::vector<uint32_t>& instructions);
+
+    // Offset in the instructions of the OpLine/DebugLine just before the instruction, 0 if there is none
+    uint32_t GetDebugLineOffset(uint32_t instruction_position) const;
+    // OpName of the function holding the instruction, nullptr if not in a function or the function has no name
+    const char* GetFunctionName(uint32_t instruction_position) const;
+
+  private:
+    // Instruction positions where the OpLine/DebugLine in effect changes, sorted by position
+    struct LineChange {
+        uint32_t instruction_position;
+        uint32_t line_inst_offset;
+    };
+    std::vector<LineChange> line_changes_;
+
+    // From OpFunction to OpFunctionEnd, sorted by position
+    struct FunctionRange {
+        uint32_t first_position;
+        uint32_t last_position;
+        std::string name;
+    };
+    std::vector<FunctionRange> function_ranges_;
+};
 }  // namespace spirv
@@ -21,7 +21,9 @@
 #include "gpuav/resources/gpuav_vulkan_objects.h"
 #include "gpuav/instrumentation/gpuav_shader_instrumentor.h"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 struct LastBound;
 namespace chassis {
@@ -72,6 +74,7 @@ class Validator : public GpuShaderInstrumentor {
     // -------------
   public:
     void FinishDeviceSetup(const VkDeviceCreateInfo* pCreateInfo, const Location& loc) final;
+    void UpdateMemoryAccounting() const final;
 
     void InternalVmaError(LogObjectList objlist, VkResult result, const char* const specific_message) const;
 
@@ -87,6 +90,32 @@ class Validator : public GpuShaderInstrumentor {
                                    VkBuffer* pBuffer, const RecordObject& record_obj, chassis::CreateBuffer& chassis_state) final;
     void PreCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo,
                                          const RecordObject& record_obj) final;
+    void PreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject& record_obj) final;
+
+    // Called before synchronization commands: validation commands deferred up to the next one are recorded there
+    void FlushDeferredValidationCmds(VkCommandBuffer commandBuffer, const Location& loc);
+    void PreCallRecordCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask,
+                                         VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags,
+                                         uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers,
+                                         uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers,
+                                         uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers,
+                                         const RecordObject& record_obj) final;
+    void PreCallRecordCmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfoKHR* pDependencyInfo,
+                                             const RecordObject& record_obj) final;
+    void PreCallRecordCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo,
+                                          const RecordObject& record_obj) final;
+    void PreCallRecordCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
+                                    VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask,
+                                    uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers,
+                                    uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers,
+                                    uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers,
+                                    const RecordObject& record_obj) final;
+    void PreCallRecordCmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
+                                        const VkDependencyInfoKHR* pDependencyInfos, const RecordObject& record_obj) final;
+    void PreCallRecordCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
+                                     const VkDependencyInfo* pDependencyInfos, const RecordObject& record_obj) final;
+    void PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
+                                         const VkCommandBuffer* pCommandBuffers, const RecordObject& record_obj) final;
 
     void PreCallActionCommand(Validator& gpuav, CommandBufferSubState& cb_state, VkPipelineBindPoint bind_point,
                               const Location& loc);
@@ -212,12 +241,31 @@ class Validator : public GpuShaderInstrumentor {
 
     VmaAllocator vma_allocator_ = {};
     std::unique_ptr<vko::DescriptorSetManager> desc_set_manager_;
+    // Buffer blocks outliving the command buffers they were allocated for, reused by the next command buffers
+    vko::BufferBlockPools buffer_block_pools_;
 
     // This is so universally used, that we decided currently to not be in vko::SharedResourcesCache
-    vko::Buffer indices_buffer_;
+    // Created on first use, filling it at vkCreateDevice time was a noticeable part of the device creation cost
+    const vko::Buffer& GetIndicesBuffer();
     uint32_t indices_buffer_alignment_ = 0;
 
+    // Instrumented action commands recorded so far, used to pick the ones reporting their errors with gpuav_sampling_*
+    std::atomic<uint32_t> sampled_draws_count_{0};
+    std::atomic<uint32_t> sampled_dispatches_count_{0};
+    std::atomic<uint32_t> sampled_trace_rays_count_{0};
+
+    // Size the debug printf output buffer grew to after a submission overflowed it (zero until then), used by the command
+    // buffers recorded afterwards instead of debug_printf_buffer_size
+    std::atomic<uint32_t> debug_printf_grown_buffer_size_{0};
+    std::atomic<uint32_t> debug_printf_overflow_count_{0};
+    // Decoding plans by format string text, shared by the shaders using the same format string
+    std::mutex debug_printf_interned_plans_lock_;
+    vvl::unordered_map<std::string, std::shared_ptr<const debug_printf::DecodingPlan>> debug_printf_interned_plans_;
+
   private:
+    vko::Buffer indices_buffer_;
+    std::once_flag indices_buffer_once_;
+
     std::string instrumented_shader_cache_path_{};
 
     // Make sure we call the right versions of any timeline semaphore functions.
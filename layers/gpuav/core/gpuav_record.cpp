@@ -84,6 +84,64 @@ void Validator::PreCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, c
     debug_printf::RegisterDebugPrintf(*this, gpuav_cb_state);
 }
 
+void Validator::PreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
+    FlushDeferredValidationCmds(commandBuffer, record_obj.location);
+}
+
+void Validator::FlushDeferredValidationCmds(VkCommandBuffer commandBuffer, const Location &loc) {
+    auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    if (!cb_state) {
+        InternalError(commandBuffer, loc, "Unrecognized command buffer.");
+        return;
+    }
+    valcmd::FlushTraceRaysValidationCmds(*this, SubState(*cb_state));
+}
+
+void Validator::PreCallRecordCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask,
+                                                VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags,
+                                                uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers,
+                                                uint32_t bufferMemoryBarrierCount,
+                                                const VkBufferMemoryBarrier *pBufferMemoryBarriers,
+                                                uint32_t imageMemoryBarrierCount,
+                                                const VkImageMemoryBarrier *pImageMemoryBarriers, const RecordObject &record_obj) {
+    FlushDeferredValidationCmds(commandBuffer, record_obj.location);
+}
+
+void Validator::PreCallRecordCmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfoKHR *pDependencyInfo,
+                                                    const RecordObject &record_obj) {
+    PreCallRecordCmdPipelineBarrier2(commandBuffer, pDependencyInfo, record_obj);
+}
+
+void Validator::PreCallRecordCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo,
+                                                 const RecordObject &record_obj) {
+    FlushDeferredValidationCmds(commandBuffer, record_obj.location);
+}
+
+void Validator::PreCallRecordCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
+                                           VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask,
+                                           uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers,
+                                           uint32_t bufferMemoryBarrierCount,
+                                           const VkBufferMemoryBarrier *pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount,
+                                           const VkImageMemoryBarrier *pImageMemoryBarriers, const RecordObject &record_obj) {
+    FlushDeferredValidationCmds(commandBuffer, record_obj.location);
+}
+
+void Validator::PreCallRecordCmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
+                                               const VkDependencyInfoKHR *pDependencyInfos, const RecordObject &record_obj) {
+    PreCallRecordCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos, record_obj);
+}
+
+void Validator::PreCallRecordCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
+                                            const VkDependencyInfo *pDependencyInfos, const RecordObject &record_obj) {
+    FlushDeferredValidationCmds(commandBuffer, record_obj.location);
+}
+
+// Secondary command buffers can write indirect buffers, and synchronize these writes themselves
+void Validator::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
+                                                const VkCommandBuffer *pCommandBuffers, const RecordObject &record_obj) {
+    FlushDeferredValidationCmds(commandBuffer, record_obj.location);
+}
+
 void Instance::InternalWarning(LogObjectList objlist, const Location &loc, const char *const specific_message) const {
     char const *vuid = gpuav_settings.debug_printf_only ? "WARNING-DEBUG-PRINTF" : "WARNING-GPU-Assisted-Validation";
     LogWarning(vuid, objlist, loc, "Internal Warning: %s", specific_message);
@@ -148,6 +206,7 @@ void Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCa
     DestroySubstate();
 
     shared_resources_manager.Clear();
+    buffer_block_pools_.DestroyBuffers();
 
     indices_buffer_.Destroy();
 
@@ -155,6 +214,7 @@ void Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCa
 
     // State Tracker (BaseClass) can end up making vma calls through callbacks - so destroy allocator last
     if (vma_allocator_) {
+        buffer_block_pools_.DestroyVmaPools();
         vmaDestroyAllocator(vma_allocator_);
     }
 
@@ -167,6 +227,9 @@ void Validator::PreCallActionCommand(Validator &gpuav, CommandBufferSubState &cb
     if (cb_state.max_actions_cmd_validation_reached_) {
         return;
     }
+    if (!gpuav.WaitForInstrumentedShaderValidation(cb_state.base.lastBound[ConvertToVvlBindPoint(bind_point)], loc)) {
+        return;
+    }
     PreCallSetupShaderInstrumentationResources(gpuav, cb_state, bind_point, loc);
 }
 
@@ -17,6 +17,9 @@
 
 #include "gpuav/core/gpuav_settings.h"
 
+#include <mutex>
+#include <string_view>
+
 #include "profiling/profiling.h"
 
 // Fix GCC 13 issues with regex
@@ -45,6 +48,10 @@ void GpuAVSettings::DisableShaderInstrumentationAndOptions() {
     shader_instrumentation.vertex_attribute_fetch_oob = false;
     // Because of this setting, cannot really have an "enabled" parameter to pass to this method
     select_instrumented_shaders = false;
+    cache_instrumented_shaders = false;
+    lazy_instrumentation = false;
+    compress_original_spirv = false;
+    sampling = {};
 }
 bool GpuAVSettings::IsBufferValidationEnabled() const {
     return validate_indirect_draws_buffers || validate_indirect_dispatches_buffers || validate_indirect_trace_rays_buffers ||
@@ -58,21 +65,113 @@ void GpuAVSettings::SetBufferValidationEnabled(bool enabled) {
     validate_index_buffers = enabled;
 }
 
+// Most shader selection patterns are a name, or a part of a name between ".*", and never need a std::regex. The others are
+// only compiled the first time a name is matched, since building a std::regex costs far more than the settings parsing, and
+// most runs never create a pipeline with a debug name.
+struct GpuAVSettings::ShaderSelectionMatcher {
+    struct Pattern {
+        enum class Kind { Exact, Prefix, Suffix, Contains, Regex };
+        Kind kind;
+        std::string text;  // literal part of the name, or the whole regex
+    };
+    std::vector<Pattern> patterns;
+
+    std::once_flag compile_once;
+    std::vector<std::regex> regexes;  // one per Regex pattern, in order
+
+    explicit ShaderSelectionMatcher(const std::vector<std::string> &pattern_strings) {
+        for (const std::string &pattern : pattern_strings) {
+            patterns.emplace_back(Classify(pattern));
+        }
+    }
+
+    static Pattern Classify(const std::string &pattern) {
+        constexpr std::string_view kAnything = ".*";
+        constexpr std::string_view kSpecialChars = "^$\\.*+?()[]{}|";
+        std::string_view literal = pattern;
+        const bool leading_anything = literal.substr(0, kAnything.size()) == kAnything;
+        if (leading_anything) {
+            literal.remove_prefix(kAnything.size());
+        }
+        const bool trailing_anything =
+            literal.size() >= kAnything.size() && literal.substr(literal.size() - kAnything.size()) == kAnything;
+        if (trailing_anything) {
+            literal.remove_suffix(kAnything.size());
+        }
+        if (literal.find_first_of(kSpecialChars) != std::string_view::npos) {
+            return {Pattern::Kind::Regex, pattern};
+        }
+        Pattern::Kind kind = Pattern::Kind::Exact;
+        if (leading_anything && trailing_anything) {
+            kind = Pattern::Kind::Contains;
+        } else if (leading_anything) {
+            kind = Pattern::Kind::Suffix;
+        } else if (trailing_anything) {
+            kind = Pattern::Kind::Prefix;
+        }
+        return {kind, std::string(literal)};
+    }
+
+    // "." does not match line terminators in ECMAScript
+    static bool AnythingMatches(std::string_view s) { return s.find_first_of("\r\n") == std::string_view::npos; }
+
+    bool Matches(const std::string &name) {
+        const std::string_view view = name;
+        size_t regex_index = 0;
+        for (const Pattern &pattern : patterns) {
+            const std::string_view text = pattern.text;
+            switch (pattern.kind) {
+                case Pattern::Kind::Exact:
+                    if (view == text) {
+                        return true;
+                    }
+                    break;
+                case Pattern::Kind::Prefix:
+                    if (view.substr(0, text.size()) == text && AnythingMatches(view.substr(text.size()))) {
+                        return true;
+                    }
+                    break;
+                case Pattern::Kind::Suffix:
+                    if (view.size() >= text.size() && view.substr(view.size() - text.size()) == text &&
+                        AnythingMatches(view.substr(0, view.size() - text.size()))) {
+                        return true;
+                    }
+                    break;
+                case Pattern::Kind::Contains:
+                    for (size_t pos = view.find(text); pos != std::string_view::npos; pos = view.find(text, pos + 1)) {
+                        if (AnythingMatches(view.substr(0, pos)) && AnythingMatches(view.substr(pos + text.size()))) {
+                            return true;
+                        }
+                    }
+                    break;
+                case Pattern::Kind::Regex:
+                    std::call_once(compile_once, [this]() {
+                        for (const Pattern &regex_pattern : patterns) {
+                            if (regex_pattern.kind == Pattern::Kind::Regex) {
+                                regexes.emplace_back(regex_pattern.text, std::regex_constants::ECMAScript);
+                            }
+                        }
+                    });
+                    if (std::regex_match(name, regexes[regex_index++])) {
+                        return true;
+                    }
+                    break;
+            }
+        }
+        return false;
+    }
+};
+
 void GpuAVSettings::SetShaderSelectionRegexes(std::vector<std::string> &&shader_selection_regexes) {
     this->shader_selection_regexes = std::move(shader_selection_regexes);
+    shader_selection_matcher = std::make_shared<ShaderSelectionMatcher>(this->shader_selection_regexes);
 }
 
 bool GpuAVSettings::MatchesAnyShaderSelectionRegex(const std::string &debug_name) {
-    if (debug_name.empty()) {
+    if (debug_name.empty() || !shader_selection_matcher) {
         return false;
     }
-    for (const std::string &shader_selection_regex_str : shader_selection_regexes) {
-        std::regex regex(shader_selection_regex_str, std::regex_constants::ECMAScript);
-        if (std::regex_match(debug_name, regex)) {
-            return true;
-        }
-    }
-    return false;
+    return shader_selection_matcher->Matches(debug_name);
 }
 
 void GpuAVSettings::SetOnlyDebugPrintf() {
@@ -85,11 +184,18 @@ void GpuAVSettings::SetOnlyDebugPrintf() {
 }
 
 void GpuAVSettings::TracyLogSettings() const {
-#if defined(TRACY_ENABLE)
+#if defined(TRACY_ENABLE) || defined(VVL_PERFETTO)
     VVL_TracyMessageStream("GpuAVSettings:");
     VVL_TracyMessageStream("  safe_mode: " << safe_mode);
+    VVL_TracyMessageStream("  safe_mode_targeted: " << safe_mode_targeted);
     VVL_TracyMessageStream("  force_on_robustness: " << force_on_robustness);
     VVL_TracyMessageStream("  select_instrumented_shaders: " << select_instrumented_shaders);
+    VVL_TracyMessageStream("  cache_instrumented_shaders: " << cache_instrumented_shaders);
+    VVL_TracyMessageStream("  lazy_instrumentation: " << lazy_instrumentation);
+    VVL_TracyMessageStream("  compress_original_spirv: " << compress_original_spirv);
+    VVL_TracyMessageStream("  sampling.draws: " << sampling.draws);
+    VVL_TracyMessageStream("  sampling.dispatches: " << sampling.dispatches);
+    VVL_TracyMessageStream("  sampling.trace_rays: " << sampling.trace_rays);
     if (!shader_selection_regexes.empty()) {
         VVL_TracyMessageStream("  shader_selection_regexes:");
         for (size_t i = 0; i < shader_selection_regexes.size(); ++i) {
@@ -106,6 +212,8 @@ void GpuAVSettings::TracyLogSettings() const {
     VVL_TracyMessageStream("  validate_image_layout: " << validate_image_layout);
     VVL_TracyMessageStream("  vma_linear_output: " << vma_linear_output);
     VVL_TracyMessageStream("  debug_validate_instrumented_shaders: " << debug_validate_instrumented_shaders);
+    VVL_TracyMessageStream("  debug_validate_instrumented_shaders_async: " << debug_validate_instrumented_shaders_async);
+    VVL_TracyMessageStream("  debug_validate_instrumented_shaders_wait: " << debug_validate_instrumented_shaders_wait);
     VVL_TracyMessageStream("  debug_dump_instrumented_shaders: " << debug_dump_instrumented_shaders);
     VVL_TracyMessageStream("  debug_max_instrumentations_count: " << debug_max_instrumentations_count);
     VVL_TracyMessageStream("  debug_print_instrumentation_info: " << debug_print_instrumentation_info);
@@ -119,6 +227,7 @@ void GpuAVSettings::TracyLogSettings() const {
     VVL_TracyMessageStream("  debug_printf_enabled: " << debug_printf_enabled);
     VVL_TracyMessageStream("  debug_printf_to_stdout: " << debug_printf_to_stdout);
     VVL_TracyMessageStream("  debug_printf_verbose: " << debug_printf_verbose);
+    VVL_TracyMessageStream("  debug_printf_aggregate: " << debug_printf_aggregate);
     VVL_TracyMessageStream("  debug_printf_buffer_size: " << debug_printf_buffer_size);
 #endif
 }
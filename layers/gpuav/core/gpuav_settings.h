@@ -16,6 +16,7 @@
  */
 #pragma once
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -23,10 +24,27 @@
 
 struct GpuAVSettings {
     bool safe_mode = false;
+    // Safe mode only guards the accesses the instrumentation can not prove valid statically
+    bool safe_mode_targeted = false;
 
     bool force_on_robustness = false;
     bool select_instrumented_shaders = false;
     std::vector<std::string> shader_selection_regexes{};
+    // Built from shader_selection_regexes, shared by the copies of the settings
+    struct ShaderSelectionMatcher;
+    std::shared_ptr<ShaderSelectionMatcher> shader_selection_matcher;
+    // Save the instrumented shaders on disk and reuse them in the next runs
+    bool cache_instrumented_shaders = false;
+    // Create graphics and compute pipelines uninstrumented, and build their instrumented variant when they are first bound
+    bool lazy_instrumentation = false;
+    // Keep the original SPIR-V of the instrumented shaders compressed, it is only needed again to report errors
+    bool compress_original_spirv = false;
+    // Only one out of N action commands of each type reports the errors found by the instrumented shaders, 1 reports them all
+    struct Sampling {
+        uint32_t draws = 1;
+        uint32_t dispatches = 1;
+        uint32_t trace_rays = 1;
+    } sampling;
 
     bool validate_indirect_draws_buffers = true;
     bool validate_indirect_dispatches_buffers = true;
@@ -40,6 +58,9 @@ struct GpuAVSettings {
     bool vma_linear_output = true;
 
     bool debug_validate_instrumented_shaders = false;
+    // spirv-val of the instrumented shaders runs on a worker thread, the first command using a shader can wait for it
+    bool debug_validate_instrumented_shaders_async = false;
+    bool debug_validate_instrumented_shaders_wait = false;
     bool debug_dump_instrumented_shaders = false;
     uint32_t debug_max_instrumentations_count = 0;  // zero is same as "unlimited"
     bool debug_print_instrumentation_info = false;
@@ -73,6 +94,8 @@ struct GpuAVSettings {
     bool debug_printf_enabled = false;
     bool debug_printf_to_stdout = false;
     bool debug_printf_verbose = false;
+    // Identical messages of a readback are reported once, with their count
+    bool debug_printf_aggregate = false;
     uint32_t debug_printf_buffer_size = 1024;
 
     void TracyLogSettings() const;
@@ -141,20 +141,28 @@ static VKAPI_ATTR VkResult VKAPI_CALL gpuVkCreateImage(VkDevice device, const Vk
 static VKAPI_ATTR void VKAPI_CALL gpuVkDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator) {
     DispatchDestroyImage(device, image, pAllocator);
 }
+static VKAPI_ATTR void VKAPI_CALL gpuVkGetPhysicalDeviceMemoryProperties2(VkPhysicalDevice physicalDevice,
+                                                                         VkPhysicalDeviceMemoryProperties2 *pMemoryProperties) {
+    DispatchGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
+}
 static VKAPI_ATTR void VKAPI_CALL gpuVkCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
                                                      uint32_t regionCount, const VkBufferCopy *pRegions) {
     DispatchCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
 }
 
-static VkResult UtilInitializeVma(VkInstance instance, VkPhysicalDevice physical_device, VkDevice device,
+static VkResult UtilInitializeVma(VkInstance instance, VkPhysicalDevice physical_device, VkDevice device, bool use_memory_budget,
                                   VmaAllocator *pAllocator) {
-    VmaVulkanFunctions functions;
+    VmaVulkanFunctions functions = {};
     VmaAllocatorCreateInfo allocator_info = {};
     allocator_info.instance = instance;
     allocator_info.device = device;
     allocator_info.physicalDevice = physical_device;
 
     allocator_info.flags |= VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
+    // Without VK_EXT_memory_budget, VMA estimates the budget of each heap from the heap sizes
+    if (use_memory_budget) {
+        allocator_info.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+    }
 
     functions.vkGetInstanceProcAddr = static_cast<PFN_vkGetInstanceProcAddr>(gpuVkGetInstanceProcAddr);
     functions.vkGetDeviceProcAddr = static_cast<PFN_vkGetDeviceProcAddr>(gpuVkGetDeviceProcAddr);
@@ -176,6 +184,9 @@ static VkResult UtilInitializeVma(VkInstance instance, VkPhysicalDevice physical
     functions.vkCreateImage = static_cast<PFN_vkCreateImage>(gpuVkCreateImage);
     functions.vkDestroyImage = static_cast<PFN_vkDestroyImage>(gpuVkDestroyImage);
     functions.vkCmdCopyBuffer = static_cast<PFN_vkCmdCopyBuffer>(gpuVkCmdCopyBuffer);
+    // GPU-AV requires Vulkan 1.1, where this is core
+    functions.vkGetPhysicalDeviceMemoryProperties2KHR =
+        static_cast<PFN_vkGetPhysicalDeviceMemoryProperties2KHR>(gpuVkGetPhysicalDeviceMemoryProperties2);
     allocator_info.pVulkanFunctions = &functions;
 
     return vmaCreateAllocator(&allocator_info, pAllocator);
@@ -234,7 +245,8 @@ void Validator::FinishDeviceSetup(const VkDeviceCreateInfo *pCreateInfo, const L
     // Need the device to be created before we can query features for settings
     InitSettings(loc);
 
-    VkResult result = UtilInitializeVma(instance, physical_device, device, &vma_allocator_);
+    VkResult result = UtilInitializeVma(instance, physical_device, device, IsExtEnabled(extensions.vk_ext_memory_budget),
+                                        &vma_allocator_);
     if (result != VK_SUCCESS) {
         InternalVmaError(device, result, "Could not initialize VMA");
         return;
@@ -252,25 +264,15 @@ void Validator::FinishDeviceSetup(const VkDeviceCreateInfo *pCreateInfo, const L
 
     DescriptorChecksOnFinishDeviceSetup(*this);
 
-    // Create error logging buffer allocation pool
-    {
-        VkBufferCreateInfo error_buffer_ci = vku::InitStructHelper();
-        error_buffer_ci.size = glsl::kErrorBufferByteSize;
-        error_buffer_ci.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-        VmaAllocationCreateInfo error_buffer_alloc_ci = {};
-        error_buffer_alloc_ci.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-        error_buffer_alloc_ci.preferredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
-        uint32_t mem_type_index;
-        result = vmaFindMemoryTypeIndexForBufferInfo(vma_allocator_, &error_buffer_ci, &error_buffer_alloc_ci, &mem_type_index);
-        if (result != VK_SUCCESS) {
-            InternalVmaError(device, result, "Unable to find memory type index.");
-            return;
-        }
-    }
+    // Dedicated VMA pools of the buffers of every command buffer, see vko::GpuResourcesManager
+    buffer_block_pools_.Create(*this);
 
-    // Create command indices buffer
-    {
-        indices_buffer_alignment_ = sizeof(uint32_t) * static_cast<uint32_t>(phys_dev_props.limits.minStorageBufferOffsetAlignment);
+    // The command indices buffer is only created by the first command buffer using it, see GetIndicesBuffer()
+    indices_buffer_alignment_ = sizeof(uint32_t) * static_cast<uint32_t>(phys_dev_props.limits.minStorageBufferOffsetAlignment);
+}
+
+const vko::Buffer &Validator::GetIndicesBuffer() {
+    std::call_once(indices_buffer_once_, [this]() {
         VkBufferCreateInfo buffer_info = vku::InitStructHelper();
         buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
         buffer_info.size = cst::indices_count * indices_buffer_alignment_;
@@ -287,7 +289,8 @@ void Validator::FinishDeviceSetup(const VkDeviceCreateInfo *pCreateInfo, const L
         for (uint32_t i = 0; i < buffer_info.size / sizeof(uint32_t); ++i) {
             indices_ptr[i] = i / (indices_buffer_alignment_ / sizeof(uint32_t));
         }
-    }
+    });
+    return indices_buffer_;
 }
 
 namespace setting {
@@ -381,6 +384,23 @@ void Validator::InitSettings(const Location &loc) {
     gpuav_settings.TracyLogSettings();
 }
 
+void Validator::UpdateMemoryAccounting() const {
+    BaseClass::UpdateMemoryAccounting();
+    if (!vma_allocator_) {
+        return;
+    }
+    // Device memory of the VMA blocks, including the unused space of the blocks
+    VmaBudget budgets[VK_MAX_MEMORY_HEAPS] = {};
+    vmaGetHeapBudgets(vma_allocator_, budgets);
+    uint64_t block_bytes = 0;
+    for (uint32_t heap_i = 0; heap_i < phys_dev_mem_props.memoryHeapCount; ++heap_i) {
+        block_bytes += budgets[heap_i].statistics.blockBytes;
+    }
+    memory_accounting.Set(vvl::profiling::MemorySubsystem::GpuavVma, block_bytes);
+    memory_accounting.Set(vvl::profiling::MemorySubsystem::GpuavVmaPools,
+                          buffer_block_pools_.GetVmaPoolsStatistics().blockBytes);
+}
+
 void Validator::InternalVmaError(LogObjectList objlist, VkResult result, const char *const specific_message) const {
     aborted_ = true;
     std::string error_message = specific_message;
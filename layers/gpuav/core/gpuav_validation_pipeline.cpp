@@ -19,6 +19,7 @@
 
 #include "generated/dispatch_functions.h"
 #include "gpuav/core/gpuav.h"
+#include "gpuav/descriptor_validation/gpuav_descriptor_set.h"
 #include "gpuav/resources/gpuav_state_trackers.h"
 #include "gpuav/shaders/gpuav_shaders_constants.h"
 #include "state_tracker/pipeline_state.h"
@@ -142,7 +143,10 @@ void RestorablePipelineState::Create(CommandBufferSubState &cb_state, VkPipeline
 
     LastBound &last_bound = cb_state.base.lastBound[vvl_bind_point];
     if (last_bound.pipeline_state) {
-        pipeline_ = last_bound.pipeline_state->VkHandle();
+        // Restore the instrumented variant if it was bound over the application pipeline
+        pipeline_ = cb_state.lazy_instrumented_pipelines[vvl_bind_point] != VK_NULL_HANDLE
+                        ? cb_state.lazy_instrumented_pipelines[vvl_bind_point]
+                        : last_bound.pipeline_state->VkHandle();
 
     } else {
         assert(shader_objects_.empty());
@@ -174,7 +178,7 @@ void RestorablePipelineState::Create(CommandBufferSubState &cb_state, VkPipeline
     }
 
     if (last_bound.push_descriptor_set) {
-        push_descriptor_set_writes_ = last_bound.push_descriptor_set->GetWrites();
+        push_descriptor_set_writes_ = SubState(*last_bound.push_descriptor_set).GetPushDescriptorWrites();
     }
 
     // Do not handle cb_state.active_render_pass->use_dynamic_rendering_inherited for now
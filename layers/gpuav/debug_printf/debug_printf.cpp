@@ -195,201 +195,326 @@ struct DebugPrintfBufferInfo {
           action_command_index(action_command_index){};
 };
 
+// Upper bound of the automatic growth of the output buffer after an overflow
+static constexpr uint32_t kMaxDebugPrintfBufferSize = 64u * 1024u * 1024u;
+
 struct DebugPrintfCbState {
     std::vector<DebugPrintfBufferInfo> buffer_infos;
 };
 
-void AnalyzeAndGenerateMessage(Validator &gpuav, VkCommandBuffer command_buffer, DebugPrintfBufferInfo &buffer_info,
-                               uint32_t *const debug_output_buffer, const Location &loc) {
-    uint32_t output_buffer_dwords_counts = debug_output_buffer[gpuav::kDebugPrintfOutputBufferDWordsCount];
-    if (!output_buffer_dwords_counts) return;
-
-    uint32_t output_record_i = gpuav::kDebugPrintfOutputBufferData;  // get first OutputRecord index
-    while (debug_output_buffer[output_record_i]) {
-        std::stringstream shader_message;
+// Format string split into substrings with 1 or 0 value, the 64-bit specifiers already rewritten for snprintf.
+// Built the first time a message of the format string is read back, the next messages only have their values applied.
+struct DecodingPlan {
+    std::vector<Substring> substrings;
+    // A 64-bit signed int is printed without "%ld"
+    bool missing_64_bit_signed_specifier = false;
+};
 
-        OutputRecord *debug_record = reinterpret_cast<OutputRecord *>(&debug_output_buffer[output_record_i]);
-        // Lookup the VkShaderModule handle and SPIR-V code used to create the shader, using the unique shader ID value returned
-        // by the instrumented shader.
-        const gpuav::InstrumentedShader *instrumented_shader = nullptr;
-        auto it = gpuav.instrumented_shaders_map_.find(debug_record->shader_id);
-        if (it != gpuav.instrumented_shaders_map_.end()) {
-            instrumented_shader = &it->second;
+static std::shared_ptr<const DecodingPlan> BuildDecodingPlan(const std::string &format_string) {
+    auto plan = std::make_shared<DecodingPlan>();
+    plan->substrings = ParseFormatString(format_string);
+    for (Substring &substring : plan->substrings) {
+        if (!substring.needs_value || !substring.is_64_bit) {
+            continue;
+        }
+        if (substring.type == NumericTypeUint) {
+            std::array<std::string_view, 3> format_strings = {{"%ul", "%lu", "%lx"}};
+            for (const auto &ul_string : format_strings) {
+                size_t ul_pos = substring.string.find(ul_string);
+                if (ul_pos == std::string::npos) continue;
+                if (ul_string != "%lu") {
+                    substring.string.replace(ul_pos + 1, 2, PRIx64);
+                } else {
+                    substring.string.replace(ul_pos + 1, 2, PRIu64);
+                }
+                break;
+            }
+        } else if (substring.type == NumericTypeSint) {
+            size_t ld_pos = substring.string.find("%ld");
+            if (ld_pos != std::string::npos) {
+                substring.string.replace(ld_pos + 1, 2, PRId64);
+            } else {
+                plan->missing_64_bit_signed_specifier = true;
+            }
         }
+    }
+    return plan;
+}
 
-        // without the instrumented spirv, there is nothing valuable to print out
-        if (!instrumented_shader || instrumented_shader->original_spirv.empty()) {
-            gpuav.InternalWarning(LogObjectList(), loc, "Can't find instructions from any handles in shader_map");
-            return;
+// Plans are looked up by OpString id in the shader, then interned by format string text for the shaders sharing it
+static std::shared_ptr<const DecodingPlan> GetDecodingPlan(Validator &gpuav, const InstrumentedShader &instrumented_shader,
+                                                           uint32_t shader_id, uint32_t format_string_id) {
+    InstrumentedShader::DebugPrintfPlans &shader_plans = *instrumented_shader.debug_printf_plans;
+    {
+        std::lock_guard<std::mutex> guard(shader_plans.lock);
+        auto it = shader_plans.string_id_to_plan.find(format_string_id);
+        if (it != shader_plans.string_id_to_plan.end()) {
+            return it->second;
         }
+    }
 
-        // Search through the shader source for the printf format string for this invocation
-        std::string format_string;
-        const char *op_string = ::spirv::GetOpString(instrumented_shader->original_spirv, debug_record->format_string_id);
-        if (op_string) {
-            format_string = std::string(op_string);
-        } else {
-            // We have plumbed the OpString from the instrumented shader
-            for (auto debug_instrumented_info : gpuav.intenral_only_debug_printf_) {
-                if ((debug_instrumented_info.unique_shader_id == debug_record->shader_id) &&
-                    (debug_record->format_string_id == debug_instrumented_info.op_string_id)) {
-                    format_string = debug_instrumented_info.op_string_text;
-                    break;
-                }
+    // Search through the shader source for the printf format string for this invocation
+    std::string format_string;
+    std::vector<uint32_t> decompressed_spirv;
+    const std::vector<uint32_t> &original_spirv = instrumented_shader.GetOriginalSpirv(decompressed_spirv);
+    const char *op_string = ::spirv::GetOpString(original_spirv, format_string_id);
+    if (op_string) {
+        format_string = std::string(op_string);
+    } else {
+        // We have plumbed the OpString from the instrumented shader
+        std::unique_lock<std::mutex> guard(gpuav.intenral_only_debug_printf_lock_);
+        for (const auto &debug_instrumented_info : gpuav.intenral_only_debug_printf_) {
+            if ((debug_instrumented_info.unique_shader_id == shader_id) &&
+                (format_string_id == debug_instrumented_info.op_string_id)) {
+                format_string = debug_instrumented_info.op_string_text;
+                break;
             }
         }
+    }
+
+    std::shared_ptr<const DecodingPlan> plan;
+    {
+        std::lock_guard<std::mutex> guard(gpuav.debug_printf_interned_plans_lock_);
+        std::shared_ptr<const DecodingPlan> &interned_plan = gpuav.debug_printf_interned_plans_[format_string];
+        if (!interned_plan) {
+            interned_plan = BuildDecodingPlan(format_string);
+        }
+        plan = interned_plan;
+    }
+
+    std::lock_guard<std::mutex> guard(shader_plans.lock);
+    shader_plans.string_id_to_plan.emplace(format_string_id, plan);
+    return plan;
+}
 
-        // Break the format string into strings with 1 or 0 value
-        auto format_substrings = ParseFormatString(format_string);
-        void *current_value = static_cast<void *>(&debug_record->values);
-        // Sprintf each format substring into a temporary string then add that to the message
-        for (size_t substring_i = 0; substring_i < format_substrings.size(); substring_i++) {
-            auto &substring = format_substrings[substring_i];
-            std::string temp_string;
-            size_t needed = 0;
-
-            if (substring.needs_value) {
-                if (substring.is_64_bit) {
-                    if (substring.type == NumericTypeUint) {
-                        std::array<std::string_view, 3> format_strings = {{"%ul", "%lu", "%lx"}};
-                        for (const auto &ul_string : format_strings) {
-                            size_t ul_pos = substring.string.find(ul_string);
-                            if (ul_pos == std::string::npos) continue;
-                            if (ul_string != "%lu") {
-                                substring.string.replace(ul_pos + 1, 2, PRIx64);
-                            } else {
-                                substring.string.replace(ul_pos + 1, 2, PRIu64);
-                            }
-                            break;
-                        }
-
-                        const uint64_t value = *static_cast<uint64_t *>(current_value);
-                        // +1 for null terminator
+// Sprintf each format substring of the plan into a temporary string then add that to the message
+static std::string DecodeMessage(Validator &gpuav, VkCommandBuffer command_buffer, const DecodingPlan &plan,
+                                 const OutputRecord &debug_record, const Location &loc) {
+    if (plan.missing_64_bit_signed_specifier) {
+        gpuav.InternalWarning(command_buffer, loc, "Trying to DebugPrintf a 64-bit signed int but not using \"%%ld\" to print it.");
+    }
+
+    std::stringstream shader_message;
+    const void *current_value = static_cast<const void *>(&debug_record.values);
+    for (size_t substring_i = 0; substring_i < plan.substrings.size(); substring_i++) {
+        const Substring &substring = plan.substrings[substring_i];
+        std::string temp_string;
+        size_t needed = 0;
+
+        if (substring.needs_value) {
+            bool is_64_bit = substring.is_64_bit;
+            if (is_64_bit) {
+                if (substring.type == NumericTypeUint) {
+                    const uint64_t value = *static_cast<const uint64_t *>(current_value);
+                    // +1 for null terminator
+                    needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
+                    temp_string.resize(needed);
+                    std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
+                } else if (substring.type == NumericTypeSint) {
+                    const uint32_t *current_ptr = static_cast<const uint32_t *>(current_value);
+                    const uint32_t low = *current_ptr;
+                    const uint32_t high = *(current_ptr + 1);
+                    // Need to shift into uint before casting to signed int to avoid undefined behavior
+                    // https://learn.microsoft.com/en-us/cpp/cpp/left-shift-and-right-shift-operators-input-and-output?view=msvc-170#footnotes
+                    const uint64_t value_unsigned = (static_cast<uint64_t>(high) << 32) | low;
+                    const int64_t value = static_cast<int64_t>(value_unsigned);
+
+                    needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
+                    temp_string.resize(needed);
+                    std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
+                } else {
+                    assert(false);  // non-supported type
+                }
+            } else {
+                if (substring.type == NumericTypeUint) {
+                    // +1 for null terminator
+                    const uint32_t value = *static_cast<const uint32_t *>(current_value);
+                    needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
+                    temp_string.resize(needed);
+                    std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
+
+                } else if (substring.type == NumericTypeSint) {
+                    // When dealing with signed int, we need to know which size the int was to print the correct value
+                    if (debug_record.signed_8_bitmask & (1 << substring_i)) {
+                        const int8_t value = *static_cast<const int8_t *>(current_value);
                         needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
                         temp_string.resize(needed);
                         std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
-                    } else if (substring.type == NumericTypeSint) {
-                        size_t ld_pos = substring.string.find("%ld");
-                        if (ld_pos != std::string::npos) {
-                            substring.string.replace(ld_pos + 1, 2, PRId64);
-                        } else {
-                            gpuav.InternalWarning(command_buffer, loc,
-                                                  "Trying to DebugPrintf a 64-bit signed int but not using \"%%ld\" to print it.");
-                        }
-
-                        const uint32_t *current_ptr = static_cast<uint32_t *>(current_value);
-                        const uint32_t low = *current_ptr;
-                        const uint32_t high = *(current_ptr + 1);
-                        // Need to shift into uint before casting to signed int to avoid undefined behavior
-                        // https://learn.microsoft.com/en-us/cpp/cpp/left-shift-and-right-shift-operators-input-and-output?view=msvc-170#footnotes
-                        const uint64_t value_unsigned = (static_cast<uint64_t>(high) << 32) | low;
-                        const int64_t value = static_cast<int64_t>(value_unsigned);
-
+                    } else if (debug_record.signed_16_bitmask & (1 << substring_i)) {
+                        const int16_t value = *static_cast<const int16_t *>(current_value);
                         needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
                         temp_string.resize(needed);
                         std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
                     } else {
-                        assert(false);  // non-supported type
-                    }
-                } else {
-                    if (substring.type == NumericTypeUint) {
-                        // +1 for null terminator
-                        const uint32_t value = *static_cast<uint32_t *>(current_value);
+                        const int32_t value = *static_cast<const int32_t *>(current_value);
                         needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
                         temp_string.resize(needed);
                         std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
+                    }
 
-                    } else if (substring.type == NumericTypeSint) {
-                        // When dealing with signed int, we need to know which size the int was to print the correct value
-                        if (debug_record->signed_8_bitmask & (1 << substring_i)) {
-                            const int8_t value = *static_cast<int8_t *>(current_value);
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
-                        } else if (debug_record->signed_16_bitmask & (1 << substring_i)) {
-                            const int16_t value = *static_cast<int16_t *>(current_value);
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
-                        } else {
-                            const int32_t value = *static_cast<int32_t *>(current_value);
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
-                        }
-
-                    } else if (substring.type == NumericTypeFloat) {
-                        // On the CPU printf the "%f" is used for 16, 32, and 64-bit floats,
-                        // but we need to store the 64-bit floats in 2 dwords in our GPU side buffer.
-                        // Using the bitmask, we know if the incoming float was 64-bit or not.
-                        // This is much simpler than enforcing a %lf which doesn't line up with how the CPU side works
-                        if (debug_record->double_bitmask & (1 << substring_i)) {
-                            substring.is_64_bit = true;
-                            const double value = *static_cast<double *>(current_value);
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
-                        } else {
-                            const float value = *static_cast<float *>(current_value);
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
-                        }
+                } else if (substring.type == NumericTypeFloat) {
+                    // On the CPU printf the "%f" is used for 16, 32, and 64-bit floats,
+                    // but we need to store the 64-bit floats in 2 dwords in our GPU side buffer.
+                    // Using the bitmask, we know if the incoming float was 64-bit or not.
+                    // This is much simpler than enforcing a %lf which doesn't line up with how the CPU side works
+                    if (debug_record.double_bitmask & (1 << substring_i)) {
+                        is_64_bit = true;
+                        const double value = *static_cast<const double *>(current_value);
+                        needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
+                        temp_string.resize(needed);
+                        std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
+                    } else {
+                        const float value = *static_cast<const float *>(current_value);
+                        needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
+                        temp_string.resize(needed);
+                        std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
                     }
                 }
-
-                const uint32_t offset = substring.is_64_bit ? 2 : 1;
-                current_value = static_cast<uint32_t *>(current_value) + offset;
-
-            } else {
-                // incase where someone just printing a string with no arguments to it
-                needed = std::snprintf(nullptr, 0, substring.string.c_str()) + 1;
-                temp_string.resize(needed);
-                std::snprintf(&temp_string[0], needed, substring.string.c_str());
             }
 
-            shader_message << temp_string.c_str();
+            const uint32_t offset = is_64_bit ? 2 : 1;
+            current_value = static_cast<const uint32_t *>(current_value) + offset;
+
+        } else {
+            // incase where someone just printing a string with no arguments to it
+            needed = std::snprintf(nullptr, 0, substring.string.c_str()) + 1;
+            temp_string.resize(needed);
+            std::snprintf(&temp_string[0], needed, substring.string.c_str());
         }
 
-        const bool use_stdout = gpuav.gpuav_settings.debug_printf_to_stdout;
+        shader_message << temp_string.c_str();
+    }
+    return shader_message.str();
+}
+
+void AnalyzeAndGenerateMessage(Validator &gpuav, VkCommandBuffer command_buffer, DebugPrintfBufferInfo &buffer_info,
+                               uint32_t *const debug_output_buffer, const Location &loc) {
+    uint32_t output_buffer_dwords_counts = debug_output_buffer[gpuav::kDebugPrintfOutputBufferDWordsCount];
+    if (!output_buffer_dwords_counts) return;
+
+    const bool use_stdout = gpuav.gpuav_settings.debug_printf_to_stdout;
+    auto report_message = [&gpuav, &buffer_info, command_buffer, use_stdout, &loc](
+                              const OutputRecord &debug_record, const InstrumentedShader &instrumented_shader,
+                              const std::string &shader_message) {
         if (gpuav.gpuav_settings.debug_printf_verbose) {
             GpuShaderInstrumentor::ShaderMessageInfo shader_info{
-                debug_record->stage_id,     debug_record->stage_info_0,         debug_record->stage_info_1,
-                debug_record->stage_info_2, debug_record->instruction_position, debug_record->shader_id};
+                debug_record.stage_id,     debug_record.stage_info_0,         debug_record.stage_info_1,
+                debug_record.stage_info_2, debug_record.instruction_position, debug_record.shader_id};
 
             std::string debug_info_message =
-                gpuav.GenerateDebugInfoMessage(command_buffer, shader_info, instrumented_shader, buffer_info.pipeline_bind_point,
+                gpuav.GenerateDebugInfoMessage(command_buffer, shader_info, &instrumented_shader, buffer_info.pipeline_bind_point,
                                                buffer_info.action_command_index);
             if (use_stdout) {
-                std::cout << "VVL-DEBUG-PRINTF " << shader_message.str() << '\n' << debug_info_message;
+                std::cout << "VVL-DEBUG-PRINTF " << shader_message << '\n' << debug_info_message;
             } else {
                 LogObjectList objlist(command_buffer);
-                gpuav.LogInfo("VVL-DEBUG-PRINTF", objlist, loc, "DebugPrintf:\n%s\n%s", shader_message.str().c_str(),
+                gpuav.LogInfo("VVL-DEBUG-PRINTF", objlist, loc, "DebugPrintf:\n%s\n%s", shader_message.c_str(),
                               debug_info_message.c_str());
             }
 
         } else {
             if (use_stdout) {
-                std::cout << shader_message.str();
+                std::cout << shader_message;
             } else {
-                gpuav.LogInfo("VVL-DEBUG-PRINTF", gpuav.device, loc, "DebugPrintf:\n%s", shader_message.str().c_str());
+                gpuav.LogInfo("VVL-DEBUG-PRINTF", gpuav.device, loc, "DebugPrintf:\n%s", shader_message.c_str());
             }
         }
+    };
+
+    // With debug_printf_aggregate, messages with the same text from the same instruction are reported after the readback
+    struct AggregatedMessage {
+        const OutputRecord *first_record;
+        const InstrumentedShader *instrumented_shader;
+        std::string shader_message;
+        uint32_t count;
+    };
+    std::vector<AggregatedMessage> aggregated_messages;
+    vvl::unordered_map<std::string, size_t> aggregated_message_indices;
+
+    uint32_t output_record_i = gpuav::kDebugPrintfOutputBufferData;  // get first OutputRecord index
+    while (debug_output_buffer[output_record_i]) {
+        OutputRecord *debug_record = reinterpret_cast<OutputRecord *>(&debug_output_buffer[output_record_i]);
+        // Lookup the VkShaderModule handle and SPIR-V code used to create the shader, using the unique shader ID value returned
+        // by the instrumented shader.
+        const gpuav::InstrumentedShader *instrumented_shader = nullptr;
+        auto it = gpuav.instrumented_shaders_map_.find(debug_record->shader_id);
+        if (it != gpuav.instrumented_shaders_map_.end()) {
+            instrumented_shader = &it->second;
+        }
+
+        // without the instrumented spirv, there is nothing valuable to print out
+        if (!instrumented_shader || !instrumented_shader->HasOriginalSpirv()) {
+            gpuav.InternalWarning(LogObjectList(), loc, "Can't find instructions from any handles in shader_map");
+            return;
+        }
+
+        std::shared_ptr<const DecodingPlan> plan =
+            GetDecodingPlan(gpuav, *instrumented_shader, debug_record->shader_id, debug_record->format_string_id);
+        std::string shader_message = DecodeMessage(gpuav, command_buffer, *plan, *debug_record, loc);
+
+        if (gpuav.gpuav_settings.debug_printf_aggregate) {
+            std::string key = std::to_string(debug_record->shader_id) + ':' + std::to_string(debug_record->instruction_position) +
+                              ':' + shader_message;
+            auto [index_it, inserted] = aggregated_message_indices.emplace(std::move(key), aggregated_messages.size());
+            if (inserted) {
+                aggregated_messages.push_back({debug_record, instrumented_shader, std::move(shader_message), 1});
+            } else {
+                aggregated_messages[index_it->second].count++;
+            }
+        } else {
+            report_message(*debug_record, *instrumented_shader, shader_message);
+        }
         output_record_i += debug_record->size;
     }
+
+    for (AggregatedMessage &aggregated_message : aggregated_messages) {
+        if (aggregated_message.count > 1) {
+            // Keep the new line of the message at the end
+            const bool ends_with_new_line =
+                !aggregated_message.shader_message.empty() && aggregated_message.shader_message.back() == '\n';
+            const size_t count_pos = aggregated_message.shader_message.size() - (ends_with_new_line ? 1 : 0);
+            aggregated_message.shader_message.insert(count_pos,
+                                                     " (printed " + std::to_string(aggregated_message.count) + " times)");
+        }
+        report_message(*aggregated_message.first_record, *aggregated_message.instrumented_shader,
+                       aggregated_message.shader_message);
+    }
+
+    const VkDeviceSize buffer_size = buffer_info.output_mem_buffer.size;
     if ((output_record_i - gpuav::kDebugPrintfOutputBufferData) < output_buffer_dwords_counts) {
+        // The shader keeps counting the dwords of the messages that did not fit, so we know how large the buffer needed to be.
+        // Grow it for the command buffers recorded from now on, so the messages are not lost again.
+        const VkDeviceSize needed_size =
+            sizeof(uint32_t) * (VkDeviceSize(output_buffer_dwords_counts) + gpuav::kDebugPrintfOutputBufferData);
+        uint32_t grown_size = std::max(gpuav.gpuav_settings.debug_printf_buffer_size, 1024u);
+        while (grown_size < needed_size && grown_size < kMaxDebugPrintfBufferSize) {
+            grown_size *= 2;
+        }
+        grown_size = std::min(grown_size, kMaxDebugPrintfBufferSize);
+        uint32_t current_size = gpuav.debug_printf_grown_buffer_size_.load();
+        while (current_size < grown_size &&
+               !gpuav.debug_printf_grown_buffer_size_.compare_exchange_weak(current_size, grown_size)) {
+        }
+        const uint32_t overflow_count = ++gpuav.debug_printf_overflow_count_;
+
         std::stringstream message;
-        message << "Debug Printf message was truncated due to a buffer size (" << gpuav.gpuav_settings.debug_printf_buffer_size
-                << ") being too small for the messages. (This can be adjusted with VK_LAYER_PRINTF_BUFFER_SIZE or vkconfig)";
+        message << "Debug Printf message was truncated due to a buffer size (" << buffer_size
+                << ") being too small for the messages (" << needed_size << " bytes were needed, overflowed " << overflow_count
+                << " time(s) so far). ";
+        if (needed_size <= grown_size) {
+            message << "Command buffers recorded from now on will use a buffer size of " << grown_size << ". ";
+        }
+        message << "(The initial size can be adjusted with VK_LAYER_PRINTF_BUFFER_SIZE or vkconfig)";
         gpuav.InternalWarning(command_buffer, loc, message.str().c_str());
     }
 
     // Only memset what is needed, in case we are only using a small portion of a large buffer_size.
     // At the same time we want to make sure we don't memset past the actual VkBuffer allocation
-    uint32_t clear_size =
-        sizeof(uint32_t) * (debug_output_buffer[gpuav::kDebugPrintfOutputBufferDWordsCount] + gpuav::kDebugPrintfOutputBufferData);
-    clear_size = std::min(gpuav.gpuav_settings.debug_printf_buffer_size, clear_size);
-    memset(debug_output_buffer, 0, clear_size);
+    VkDeviceSize clear_size =
+        sizeof(uint32_t) * (VkDeviceSize(debug_output_buffer[gpuav::kDebugPrintfOutputBufferDWordsCount]) +
+                            gpuav::kDebugPrintfOutputBufferData);
+    clear_size = std::min(buffer_size, clear_size);
+    memset(debug_output_buffer, 0, (size_t)clear_size);
 }
 
 #if defined(__GNUC__)
@@ -402,9 +527,10 @@ void RegisterDebugPrintf(Validator &gpuav, CommandBufferSubState &cb_state) {
     }
 
     cb_state.on_instrumentation_desc_set_update_functions.emplace_back(
-        [debug_printf_buffer_size = gpuav.gpuav_settings.debug_printf_buffer_size](
-            CommandBufferSubState &cb, VkPipelineBindPoint bind_point, VkDescriptorBufferInfo &out_buffer_info,
-            uint32_t &out_dst_binding) {
+        [&gpuav](CommandBufferSubState &cb, VkPipelineBindPoint bind_point, VkDescriptorBufferInfo &out_buffer_info,
+                 uint32_t &out_dst_binding) {
+            const uint32_t debug_printf_buffer_size =
+                std::max(gpuav.gpuav_settings.debug_printf_buffer_size, gpuav.debug_printf_grown_buffer_size_.load());
             vko::BufferRange debug_printf_output_buffer =
                 cb.gpu_resources_manager.GetHostVisibleBufferRange(debug_printf_buffer_size);
             std::memset(debug_printf_output_buffer.offset_mapped_ptr, 0, (size_t)debug_printf_buffer_size);
@@ -16,6 +16,7 @@
  */
 
 #include "gpuav/descriptor_validation/gpuav_descriptor_set.h"
+#include <algorithm>
 #include <mutex>
 
 #include "gpuav/core/gpuav.h"
@@ -32,11 +33,17 @@ using vvl::DescriptorClass;
 namespace gpuav {
 
 DescriptorSetSubState::DescriptorSetSubState(const vvl::DescriptorSet &set, Validator &state_data)
-    : vvl::DescriptorSetSubState(set), input_buffer_(state_data) {
+    : vvl::DescriptorSetSubState(set), input_buffers_{{vko::Buffer(state_data), vko::Buffer(state_data)}} {
     BuildBindingLayouts();
+    dirty_binding_ranges_.resize(binding_layouts_.size());
+    prev_dirty_binding_ranges_.resize(binding_layouts_.size());
 }
 
-DescriptorSetSubState::~DescriptorSetSubState() { input_buffer_.Destroy(); }
+DescriptorSetSubState::~DescriptorSetSubState() {
+    for (vko::Buffer &input_buffer : input_buffers_) {
+        input_buffer.Destroy();
+    }
+}
 
 void DescriptorSetSubState::BuildBindingLayouts() {
     const uint32_t binding_count = (base.GetBindingCount() > 0) ? base.GetLayout()->GetMaxBinding() + 1 : 0;
@@ -140,96 +147,169 @@ static glsl::DescriptorState GetInData(const vvl::MutableDescriptor &desc) {
     return glsl::DescriptorState(desc_class, glsl::kNullDescriptor, vvl::kU32Max);
 }
 
+// data points to the state of the first descriptor of the binding
 template <typename Binding>
-void FillBindingInData(const Binding &binding, glsl::DescriptorState *data, uint32_t &index) {
-    for (uint32_t di = 0; di < binding.count; di++) {
+void FillBindingInData(const Binding &binding, glsl::DescriptorState *data, const vvl::range<uint32_t> &range) {
+    for (uint32_t di = range.begin; di < range.end; di++) {
         if (!binding.updated[di]) {
-            data[index++] = glsl::DescriptorState();
+            data[di] = glsl::DescriptorState();
         } else {
-            data[index++] = GetInData(binding.descriptors[di]);
+            data[di] = GetInData(binding.descriptors[di]);
         }
     }
 }
 
 // Inline Uniforms are currently treated as a single descriptor. Writes to any offsets cause the whole range to be valid.
 template <>
-void FillBindingInData(const vvl::InlineUniformBinding &binding, glsl::DescriptorState *data, uint32_t &index) {
+void FillBindingInData(const vvl::InlineUniformBinding &binding, glsl::DescriptorState *data, const vvl::range<uint32_t> &range) {
     // While not techincally a "null descriptor" we want to skip it as if it is one
-    data[index++] = glsl::DescriptorState(DescriptorClass::InlineUniform, glsl::kNullDescriptor, vvl::kU32Max);
+    data[0] = glsl::DescriptorState(DescriptorClass::InlineUniform, glsl::kNullDescriptor, vvl::kU32Max);
 }
 
-VkDeviceAddress DescriptorSetSubState::GetTypeAddress(Validator &gpuav) {
-    std::lock_guard guard(state_lock_);
-    const uint32_t current_version = current_version_.load();
-
-    // Will be empty on first time getting the state
-    if (input_buffer_.Address() != 0) {
-        if (last_used_version_ == current_version) {
-            return input_buffer_.Address();  // nothing has changed
-        } else {
-            // will replace (descriptor array size might have change, so need to resize buffer)
-            input_buffer_.Destroy();
-        }
+static void MergeRange(vvl::range<uint32_t> &dst, const vvl::range<uint32_t> &src) {
+    if (src.empty()) {
+        return;
     }
-
-    last_used_version_ = current_version;
-
-    if (base.GetNonInlineDescriptorCount() == 0) {
-        // no descriptors case, return a dummy state object
-        return input_buffer_.Address();
+    if (dst.empty()) {
+        dst = src;
+        return;
     }
+    dst = {std::min(dst.begin, src.begin), std::max(dst.end, src.end)};
+}
 
-    VkBufferCreateInfo buffer_info = vku::InitStruct<VkBufferCreateInfo>();
-    buffer_info.size = base.GetNonInlineDescriptorCount() * sizeof(glsl::DescriptorState);
-    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
-
-    // The descriptor state buffer can be very large (4mb+ in some games). Allocating it as HOST_CACHED
-    // and manually flushing it at the end of the state updates is faster than using HOST_COHERENT.
-    VmaAllocationCreateInfo alloc_info{};
-    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
-    const bool success = input_buffer_.Create(&buffer_info, &alloc_info);
-    if (!success) {
-        return 0;
-    }
-
-    auto data = (glsl::DescriptorState *)input_buffer_.GetMappedPtr();
-
-    uint32_t index = 0;
+void DescriptorSetSubState::FillInData(Validator &gpuav, glsl::DescriptorState *data,
+                                       const std::vector<vvl::range<uint32_t>> *binding_ranges) const {
     for (const auto &binding : base) {
+        vvl::range<uint32_t> range(0, binding->count);
+        if (binding_ranges) {
+            const vvl::range<uint32_t> &dirty_range = (*binding_ranges)[binding->binding];
+            range = {std::min(dirty_range.begin, binding->count), std::min(dirty_range.end, binding->count)};
+            if (!range.non_empty()) {
+                continue;
+            }
+        }
+
+        glsl::DescriptorState *binding_data = data + binding_layouts_[binding->binding].start;
         switch (binding->descriptor_class) {
             case DescriptorClass::InlineUniform:
-                FillBindingInData(static_cast<const vvl::InlineUniformBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::InlineUniformBinding &>(*binding), binding_data, range);
                 break;
             case DescriptorClass::GeneralBuffer:
-                FillBindingInData(static_cast<const vvl::BufferBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::BufferBinding &>(*binding), binding_data, range);
                 break;
             case DescriptorClass::TexelBuffer:
-                FillBindingInData(static_cast<const vvl::TexelBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::TexelBinding &>(*binding), binding_data, range);
                 break;
             case DescriptorClass::Mutable:
-                FillBindingInData(static_cast<const vvl::MutableBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::MutableBinding &>(*binding), binding_data, range);
                 break;
             case DescriptorClass::PlainSampler:
-                FillBindingInData(static_cast<const vvl::SamplerBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::SamplerBinding &>(*binding), binding_data, range);
                 break;
             case DescriptorClass::ImageSampler:
-                FillBindingInData(static_cast<const vvl::ImageSamplerBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::ImageSamplerBinding &>(*binding), binding_data, range);
                 break;
             case DescriptorClass::Image:
-                FillBindingInData(static_cast<const vvl::ImageBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::ImageBinding &>(*binding), binding_data, range);
                 break;
             case DescriptorClass::AccelerationStructure:
-                FillBindingInData(static_cast<const vvl::AccelerationStructureBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::AccelerationStructureBinding &>(*binding), binding_data, range);
                 break;
             case DescriptorClass::Invalid:
                 gpuav.InternalError(gpuav.device, Location(vvl::Func::Empty), "Unknown DescriptorClass");
         }
     }
+}
+
+VkDeviceAddress DescriptorSetSubState::GetTypeAddress(Validator &gpuav) {
+    std::lock_guard guard(state_lock_);
+    const uint32_t current_version = current_version_.load();
+
+    const vko::Buffer &current_input_buffer = input_buffers_[current_input_buffer_i_];
+    // Will be empty on first time getting the state
+    if (!current_input_buffer.IsDestroyed() && last_used_version_ == current_version) {
+        return current_input_buffer.Address();  // nothing has changed
+    }
+
+    last_used_version_ = current_version;
+
+    if (base.GetNonInlineDescriptorCount() == 0) {
+        // no descriptors case, return a dummy state object
+        return 0;
+    }
+
+    // Leave the buffer handed out last untouched, unless it has never been filled
+    const uint32_t input_buffer_i = current_input_buffer.IsDestroyed() ? current_input_buffer_i_ : current_input_buffer_i_ ^ 1u;
+    vko::Buffer &input_buffer = input_buffers_[input_buffer_i];
+
+    bool fill_all_descriptors = false;
+    if (input_buffer.IsDestroyed()) {
+        VkBufferCreateInfo buffer_info = vku::InitStruct<VkBufferCreateInfo>();
+        buffer_info.size = base.GetNonInlineDescriptorCount() * sizeof(glsl::DescriptorState);
+        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+        // The descriptor state buffer can be very large (4mb+ in some games). Allocating it as HOST_CACHED
+        // and manually flushing it at the end of the state updates is faster than using HOST_COHERENT.
+        VmaAllocationCreateInfo alloc_info{};
+        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+        const bool success = input_buffer.Create(&buffer_info, &alloc_info);
+        if (!success) {
+            return 0;
+        }
+        fill_all_descriptors = true;
+    }
+
+    auto data = (glsl::DescriptorState *)input_buffer.GetMappedPtr();
+    if (fill_all_descriptors) {
+        FillInData(gpuav, data, nullptr);
+    } else {
+        // This buffer missed the writes of the previous version, and of the current one
+        for (size_t binding_i = 0; binding_i < dirty_binding_ranges_.size(); ++binding_i) {
+            MergeRange(prev_dirty_binding_ranges_[binding_i], dirty_binding_ranges_[binding_i]);
+        }
+        FillInData(gpuav, data, &prev_dirty_binding_ranges_);
+    }
+    std::swap(prev_dirty_binding_ranges_, dirty_binding_ranges_);
+    for (vvl::range<uint32_t> &dirty_range : dirty_binding_ranges_) {
+        dirty_range = {};
+    }
 
     // Flush the descriptor state buffer before unmapping so that the new state is visible to the GPU
-    input_buffer_.FlushAllocation();
+    input_buffer.FlushAllocation();
+
+    current_input_buffer_i_ = input_buffer_i;
+    return input_buffer.Address();
+}
+
+void DescriptorSetSubState::NotifyWrite(uint32_t binding, uint32_t array_element, uint32_t descriptor_count) {
+    std::lock_guard guard(state_lock_);
+    // Consecutive descriptors roll over to the next bindings
+    while (descriptor_count > 0 && binding < dirty_binding_ranges_.size()) {
+        const vvl::DescriptorBinding *binding_state = base.GetBinding(binding);
+        if (!binding_state) {
+            ++binding;
+            continue;
+        }
+        if (binding_state->type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK) {
+            // Treated as a single descriptor, and descriptor_count is a byte size
+            MergeRange(dirty_binding_ranges_[binding], {0, 1});
+            break;
+        }
+        const uint32_t first = std::min(array_element, binding_state->count);
+        const uint32_t written_count = std::min(descriptor_count, binding_state->count - first);
+        MergeRange(dirty_binding_ranges_[binding], {first, first + written_count});
+        descriptor_count -= written_count;
+        array_element = 0;
+        ++binding;
+    }
+}
 
-    return input_buffer_.Address();
+void DescriptorSetSubState::NotifyPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *writes) {
+    push_descriptor_writes_.clear();
+    push_descriptor_writes_.reserve(write_count);
+    for (uint32_t i = 0; i < write_count; i++) {
+        push_descriptor_writes_.emplace_back(&writes[i]);
+    }
 }
 
 void DescriptorSetSubState::NotifyUpdate() { current_version_++; }
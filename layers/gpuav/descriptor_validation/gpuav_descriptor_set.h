@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <mutex>
 #include <vector>
@@ -24,9 +25,13 @@
 #include "gpuav/resources/gpuav_vulkan_objects.h"
 #include "gpuav/spirv/interface.h"
 #include "containers/limits.h"
+#include "containers/range.h"
 
 namespace gpuav {
 class Validator;
+namespace glsl {
+struct DescriptorState;
+}
 
 // Information about how each descriptor was accessed
 struct DescriptorAccess {
@@ -42,6 +47,11 @@ class DescriptorSetSubState : public vvl::DescriptorSetSubState {
     virtual ~DescriptorSetSubState();
 
     void NotifyUpdate() override;
+    void NotifyWrite(uint32_t binding, uint32_t array_element, uint32_t descriptor_count) override;
+    void NotifyPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *writes) override;
+
+    // The writes last pushed, to push them again after binding a validation pipeline
+    const std::vector<vku::safe_VkWriteDescriptorSet> &GetPushDescriptorWrites() const { return push_descriptor_writes_; }
 
     VkDeviceAddress GetTypeAddress(Validator &gpuav);
 
@@ -49,15 +59,27 @@ class DescriptorSetSubState : public vvl::DescriptorSetSubState {
 
   private:
     void BuildBindingLayouts();
+    // If binding_ranges is null, fill the state of all descriptors
+    void FillInData(Validator &gpuav, glsl::DescriptorState *data,
+                    const std::vector<vvl::range<uint32_t>> *binding_ranges) const;
 
     std::vector<gpuav::spirv::BindingLayout> binding_layouts_;
+    std::vector<vku::safe_VkWriteDescriptorSet> push_descriptor_writes_;
 
     // Since we will re-bind the same descriptor set many times, keeping a version allows us to know if things have changed and
     // worth re-saving the new information
     std::atomic<uint32_t> current_version_{0};
     // Set when created the last used state
     uint32_t last_used_version_{0};
-    vko::Buffer input_buffer_;
+
+    // The descriptor state is double buffered: updates are written to the buffer not handed out last,
+    // so that command buffers submitted with the previous version keep a consistent view of it
+    std::array<vko::Buffer, 2> input_buffers_;
+    uint32_t current_input_buffer_i_ = 0;
+    // Per binding, range of descriptors written since the last call to GetTypeAddress, and the one written before it.
+    // Their union is what is stale in the buffer about to be updated.
+    std::vector<vvl::range<uint32_t>> dirty_binding_ranges_;
+    std::vector<vvl::range<uint32_t>> prev_dirty_binding_ranges_;
 
     mutable std::mutex state_lock_;
 };
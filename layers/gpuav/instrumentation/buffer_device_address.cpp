@@ -28,6 +28,11 @@ struct BufferDeviceAddressCbState {
     }
 
     vko::BufferRange bda_ranges_snapshot_ptr{};
+
+    // Table uploaded by a previous submission, reused as long as no buffer address range was added or removed since.
+    // It is never written again, so submissions in flight can keep reading it.
+    bool has_uploaded_bda_table = false;
+    uint64_t uploaded_bda_table_version = 0;
 };
 
 void RegisterBufferDeviceAddressValidation(Validator& gpuav, CommandBufferSubState& cb) {
@@ -53,6 +58,14 @@ void RegisterBufferDeviceAddressValidation(Validator& gpuav, CommandBufferSubSta
             return;
         }
 
+        // bda_ranges_snapshot_ptr already points to an up to date table
+        const uint64_t bda_ranges_version = gpuav.device_state->GetBufferAddressRangesVersion();
+        if (bda_cb_state->has_uploaded_bda_table && bda_cb_state->uploaded_bda_table_version == bda_ranges_version) {
+            return;
+        }
+        bda_cb_state->has_uploaded_bda_table = true;
+        bda_cb_state->uploaded_bda_table_version = bda_ranges_version;
+
         // Update buffer device address (BDA) table
         // One snapshot update per CB submission, to prevent concurrent submissions of the same CB to write and read
         // to the same snapshot.
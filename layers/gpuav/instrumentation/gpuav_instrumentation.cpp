@@ -18,6 +18,7 @@
 #include "gpuav/instrumentation/gpuav_instrumentation.h"
 
 #include "chassis/chassis_modification_state.h"
+#include "containers/scratch_arena.h"
 #include "containers/small_vector.h"
 #include "gpuav/core/gpuav.h"
 #include "gpuav/error_message/gpuav_vuids.h"
@@ -268,9 +269,54 @@ static std::pair<std::optional<VertexAttributeFetchLimit>, std::optional<VertexA
     return {vertex_attribute_fetch_limit_vertex_input_rate, vertex_attribute_fetch_limit_instance_input_rate};
 }
 
-void UpdateInstrumentationDescSet(Validator &gpuav, CommandBufferSubState &cb_state, VkPipelineBindPoint bind_point,
-                                  VkDescriptorSet instrumentation_desc_set, const Location &loc,
-                                  InstrumentationErrorBlob &out_instrumentation_error_blob) {
+// Action commands left out by gpuav_sampling_* point the instrumentation at this buffer instead of the errors counts of their
+// command buffer. Every count is far past kMaxErrorsPerCmd, so the instrumented shaders skip writing the errors they find.
+struct SampledOutCmdErrorsCounts {
+    vko::Buffer buffer;
+    bool valid = false;
+
+    SampledOutCmdErrorsCounts(Validator &gpuav, VkDeviceSize byte_size) : buffer(gpuav) {
+        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
+        buffer_info.size = byte_size;
+        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        VmaAllocationCreateInfo alloc_info = {};
+        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        alloc_info.preferredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        const bool success = buffer.Create(&buffer_info, &alloc_info);
+        if (!success) {
+            valid = false;
+            return;
+        }
+        valid = true;
+
+        // Never cleared, so leave room for the counts to keep going up
+        auto errors_counts_ptr = (uint32_t *)buffer.GetMappedPtr();
+        std::fill(errors_counts_ptr, errors_counts_ptr + byte_size / sizeof(uint32_t), 1u << 31);
+    }
+
+    ~SampledOutCmdErrorsCounts() { buffer.Destroy(); }
+};
+
+// Picks one instrumented action command out of gpuav_sampling_* for each command type, counting across command buffers
+static bool IsActionCommandSampled(Validator &gpuav, VkPipelineBindPoint bind_point) {
+    const auto &sampling = gpuav.gpuav_settings.sampling;
+    switch (bind_point) {
+        case VK_PIPELINE_BIND_POINT_GRAPHICS:
+            return sampling.draws == 1 || gpuav.sampled_draws_count_.fetch_add(1, std::memory_order_relaxed) % sampling.draws == 0;
+        case VK_PIPELINE_BIND_POINT_COMPUTE:
+            return sampling.dispatches == 1 ||
+                   gpuav.sampled_dispatches_count_.fetch_add(1, std::memory_order_relaxed) % sampling.dispatches == 0;
+        case VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR:
+            return sampling.trace_rays == 1 ||
+                   gpuav.sampled_trace_rays_count_.fetch_add(1, std::memory_order_relaxed) % sampling.trace_rays == 0;
+        default:
+            return true;
+    }
+}
+
+VkDescriptorSet UpdateInstrumentationDescSet(Validator &gpuav, CommandBufferSubState &cb_state, VkPipelineBindPoint bind_point,
+                                             bool is_sampled, const Location &loc,
+                                             InstrumentationErrorBlob &out_instrumentation_error_blob) {
     small_vector<VkWriteDescriptorSet, 8> desc_writes = {};
 
     VkDescriptorBufferInfo error_output_desc_buffer_info = {};
@@ -290,7 +336,6 @@ void UpdateInstrumentationDescSet(Validator &gpuav, CommandBufferSubState &cb_st
             wds.descriptorCount = 1;
             wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
             wds.pBufferInfo = &error_output_desc_buffer_info;
-            wds.dstSet = instrumentation_desc_set;
             desc_writes.emplace_back(wds);
         }
 
@@ -298,7 +343,7 @@ void UpdateInstrumentationDescSet(Validator &gpuav, CommandBufferSubState &cb_st
 
         {
             indices_desc_buffer_info.range = sizeof(uint32_t);
-            indices_desc_buffer_info.buffer = gpuav.indices_buffer_.VkHandle();
+            indices_desc_buffer_info.buffer = gpuav.GetIndicesBuffer().VkHandle();
             indices_desc_buffer_info.offset = 0;
 
             VkWriteDescriptorSet wds = vku::InitStructHelper();
@@ -306,7 +351,6 @@ void UpdateInstrumentationDescSet(Validator &gpuav, CommandBufferSubState &cb_st
             wds.descriptorCount = 1;
             wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
             wds.pBufferInfo = &indices_desc_buffer_info;
-            wds.dstSet = instrumentation_desc_set;
             desc_writes.emplace_back(wds);
         }
 
@@ -317,7 +361,6 @@ void UpdateInstrumentationDescSet(Validator &gpuav, CommandBufferSubState &cb_st
             wds.descriptorCount = 1;
             wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
             wds.pBufferInfo = &indices_desc_buffer_info;
-            wds.dstSet = instrumentation_desc_set;
             desc_writes.emplace_back(wds);
         }
 
@@ -326,13 +369,18 @@ void UpdateInstrumentationDescSet(Validator &gpuav, CommandBufferSubState &cb_st
             cmd_errors_counts_desc_buffer_info.range = VK_WHOLE_SIZE;
             cmd_errors_counts_desc_buffer_info.buffer = cb_state.GetCmdErrorsCountsBuffer();
             cmd_errors_counts_desc_buffer_info.offset = 0;
+            if (!is_sampled) {
+                SampledOutCmdErrorsCounts &resource = gpuav.shared_resources_manager.GetOrCreate<SampledOutCmdErrorsCounts>(
+                    gpuav, cb_state.GetCmdErrorsCountsBufferByteSize());
+                if (!resource.valid) return VK_NULL_HANDLE;
+                cmd_errors_counts_desc_buffer_info.buffer = resource.buffer.VkHandle();
+            }
 
             VkWriteDescriptorSet wds = vku::InitStructHelper();
             wds.dstBinding = glsl::kBindingInstCmdErrorsCount;
             wds.descriptorCount = 1;
             wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
             wds.pBufferInfo = &cmd_errors_counts_desc_buffer_info;
-            wds.dstSet = instrumentation_desc_set;
             desc_writes.emplace_back(wds);
         }
 
@@ -340,33 +388,41 @@ void UpdateInstrumentationDescSet(Validator &gpuav, CommandBufferSubState &cb_st
         // Only need to update if a draw (that is not mesh) is coming as we instrument all vertex entry points
 
         if (gpuav.gpuav_settings.shader_instrumentation.vertex_attribute_fetch_oob && vvl::IsCommandDrawVertex(loc.function)) {
-            // This check is only for indexed draws
-            if (vvl::IsCommandDrawVertexIndexed(loc.function)) {
-                vko::BufferRange vertex_attribute_fetch_limits_buffer_range =
-                    cb_state.gpu_resources_manager.GetHostVisibleBufferRange(4 * sizeof(uint32_t));
-                if (vertex_attribute_fetch_limits_buffer_range.buffer == VK_NULL_HANDLE) {
-                    return;
-                }
-
-                auto vertex_attribute_fetch_limits_buffer_ptr =
-                    (uint32_t *)vertex_attribute_fetch_limits_buffer_range.offset_mapped_ptr;
-
-                const auto [vertex_attribute_fetch_limit_vertex_input_rate, vertex_attribute_fetch_limit_instance_input_rate] =
+            // This check is only for indexed draws, and its errors would not be reported for draws left out by sampling
+            std::optional<VertexAttributeFetchLimit> vertex_attribute_fetch_limit_vertex_input_rate;
+            std::optional<VertexAttributeFetchLimit> vertex_attribute_fetch_limit_instance_input_rate;
+            if (is_sampled && vvl::IsCommandDrawVertexIndexed(loc.function)) {
+                std::tie(vertex_attribute_fetch_limit_vertex_input_rate, vertex_attribute_fetch_limit_instance_input_rate) =
                     GetVertexAttributeFetchLimits(cb_state.base);
+            }
+
+            // Without any limit, there is nothing the shader check could find
+            if (vertex_attribute_fetch_limit_vertex_input_rate.has_value() ||
+                vertex_attribute_fetch_limit_instance_input_rate.has_value()) {
+                std::array<uint32_t, 4> vertex_attribute_fetch_limits{};
                 if (vertex_attribute_fetch_limit_vertex_input_rate.has_value()) {
-                    vertex_attribute_fetch_limits_buffer_ptr[0] = 1u;
-                    vertex_attribute_fetch_limits_buffer_ptr[1] =
+                    vertex_attribute_fetch_limits[0] = 1u;
+                    vertex_attribute_fetch_limits[1] =
                         (uint32_t)vertex_attribute_fetch_limit_vertex_input_rate->max_vertex_attributes_count;
-                } else {
-                    vertex_attribute_fetch_limits_buffer_ptr[0] = 0u;
                 }
-
                 if (vertex_attribute_fetch_limit_instance_input_rate.has_value()) {
-                    vertex_attribute_fetch_limits_buffer_ptr[2] = 1u;
-                    vertex_attribute_fetch_limits_buffer_ptr[3] =
+                    vertex_attribute_fetch_limits[2] = 1u;
+                    vertex_attribute_fetch_limits[3] =
                         (uint32_t)vertex_attribute_fetch_limit_instance_input_rate->max_vertex_attributes_count;
-                } else {
-                    vertex_attribute_fetch_limits_buffer_ptr[2] = 0u;
+                }
+
+                // Limits only change with the bound pipeline or vertex buffers, successive draws reuse the ones uploaded last
+                if (cb_state.last_vertex_attribute_fetch_limits_buffer_range.buffer == VK_NULL_HANDLE ||
+                    cb_state.last_vertex_attribute_fetch_limits != vertex_attribute_fetch_limits) {
+                    vko::BufferRange vertex_attribute_fetch_limits_buffer_range =
+                        cb_state.gpu_resources_manager.GetHostVisibleBufferRange(sizeof(vertex_attribute_fetch_limits));
+                    if (vertex_attribute_fetch_limits_buffer_range.buffer == VK_NULL_HANDLE) {
+                        return VK_NULL_HANDLE;
+                    }
+                    std::memcpy(vertex_attribute_fetch_limits_buffer_range.offset_mapped_ptr, vertex_attribute_fetch_limits.data(),
+                                sizeof(vertex_attribute_fetch_limits));
+                    cb_state.last_vertex_attribute_fetch_limits = vertex_attribute_fetch_limits;
+                    cb_state.last_vertex_attribute_fetch_limits_buffer_range = vertex_attribute_fetch_limits_buffer_range;
                 }
 
                 out_instrumentation_error_blob.vertex_attribute_fetch_limit_vertex_input_rate =
@@ -375,20 +431,19 @@ void UpdateInstrumentationDescSet(Validator &gpuav, CommandBufferSubState &cb_st
                     vertex_attribute_fetch_limit_instance_input_rate;
                 out_instrumentation_error_blob.index_buffer_binding = cb_state.base.index_buffer_binding;
 
-                vertex_attribute_fetch_limits_buffer_bi.buffer = vertex_attribute_fetch_limits_buffer_range.buffer;
-                vertex_attribute_fetch_limits_buffer_bi.offset = vertex_attribute_fetch_limits_buffer_range.offset;
-                vertex_attribute_fetch_limits_buffer_bi.range = vertex_attribute_fetch_limits_buffer_range.size;
+                vertex_attribute_fetch_limits_buffer_bi.buffer = cb_state.last_vertex_attribute_fetch_limits_buffer_range.buffer;
+                vertex_attribute_fetch_limits_buffer_bi.offset = cb_state.last_vertex_attribute_fetch_limits_buffer_range.offset;
+                vertex_attribute_fetch_limits_buffer_bi.range = cb_state.last_vertex_attribute_fetch_limits_buffer_range.size;
             } else {
-                // Point all non-indexed draws to our global buffer that will bypass the check in shader
+                // Point all other draws to our global buffer that will bypass the check in shader
                 VertexAttributeFetchOff &resource = gpuav.shared_resources_manager.GetOrCreate<VertexAttributeFetchOff>(gpuav);
-                if (!resource.valid) return;
+                if (!resource.valid) return VK_NULL_HANDLE;
                 vertex_attribute_fetch_limits_buffer_bi.buffer = resource.buffer.VkHandle();
                 vertex_attribute_fetch_limits_buffer_bi.offset = 0;
                 vertex_attribute_fetch_limits_buffer_bi.range = VK_WHOLE_SIZE;
             }
 
             VkWriteDescriptorSet wds = vku::InitStructHelper();
-            wds.dstSet = instrumentation_desc_set;
             wds.dstBinding = glsl::kBindingInstVertexAttributeFetchLimits;
             wds.descriptorCount = 1;
             wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
@@ -397,10 +452,10 @@ void UpdateInstrumentationDescSet(Validator &gpuav, CommandBufferSubState &cb_st
         }
     }
 
-    std::vector<VkDescriptorBufferInfo> buffer_infos(cb_state.on_instrumentation_desc_set_update_functions.size());
+    vvl::ScratchVector<VkDescriptorBufferInfo> buffer_infos;
+    buffer_infos.resize(cb_state.on_instrumentation_desc_set_update_functions.size());
     for (size_t func_i = 0; func_i < cb_state.on_instrumentation_desc_set_update_functions.size(); ++func_i) {
         VkWriteDescriptorSet wds = vku::InitStructHelper();
-        wds.dstSet = instrumentation_desc_set;
         wds.dstBinding = vvl::kU32Max;
         wds.descriptorCount = 1;
         wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
@@ -414,12 +469,36 @@ void UpdateInstrumentationDescSet(Validator &gpuav, CommandBufferSubState &cb_st
         desc_writes.emplace_back(wds);
     }
 
-    DispatchUpdateDescriptorSets(gpuav.device, static_cast<uint32_t>(desc_writes.size()), desc_writes.data(), 0, nullptr);
+    // Per action command data travels through the dynamic offsets, so an action command using the same buffers as the previous
+    // one can bind the previous descriptor set again instead of allocating and writing a new one
+    if (cb_state.last_instrumentation_desc_set != VK_NULL_HANDLE &&
+        vko::AreSameBufferDescriptorWrites(cb_state.last_instrumentation_desc_set_writes, desc_writes)) {
+        return cb_state.last_instrumentation_desc_set;
+    }
+
+    // After a command buffer reset, the descriptor set handed out for the same action command of the new recording is usually
+    // the one it used before, still holding the same writes: those are then not done again
+    VkDescriptorSet instrumentation_desc_set = cb_state.gpu_resources_manager.GetManagedDescriptorSet(
+        cb_state.GetInstrumentationDescriptorSetLayout(), desc_writes);
+    if (!instrumentation_desc_set) {
+        gpuav.InternalError(cb_state.VkHandle(), loc, "Unable to allocate instrumentation descriptor sets.");
+        return VK_NULL_HANDLE;
+    }
+
+    cb_state.last_instrumentation_desc_set_writes.clear();
+    for (const VkWriteDescriptorSet &wds : desc_writes) {
+        cb_state.last_instrumentation_desc_set_writes.emplace_back(wds.dstBinding, *wds.pBufferInfo);
+    }
+    cb_state.last_instrumentation_desc_set = instrumentation_desc_set;
+
+    return instrumentation_desc_set;
 }
 
 static bool WasInstrumented(const LastBound &last_bound) {
     if (last_bound.pipeline_state) {
-        return last_bound.pipeline_state->instrumentation_data.was_instrumented;
+        const CommandBufferSubState &cb_state = SubState(last_bound.cb_state);
+        return last_bound.pipeline_state->instrumentation_data.was_instrumented ||
+               cb_state.lazy_instrumented_pipelines[ConvertToVvlBindPoint(last_bound.bind_point)] != VK_NULL_HANDLE;
     }
     for (uint32_t i = 0; i < kShaderObjectStageCount; ++i) {
         const auto stage = static_cast<ShaderObjectStage>(i);
@@ -462,19 +541,17 @@ void PreCallSetupShaderInstrumentationResources(Validator &gpuav, CommandBufferS
         return;
     }
 
-    VkDescriptorSet instrumentation_desc_set =
-        cb_state.gpu_resources_manager.GetManagedDescriptorSet(cb_state.GetInstrumentationDescriptorSetLayout());
-    if (!instrumentation_desc_set) {
-        gpuav.InternalError(cb_state.VkHandle(), loc, "Unable to allocate instrumentation descriptor sets.");
-        return;
-    }
-
     // Pathetic way of trying to make sure we take care of updating all
     // bindings of the instrumentation descriptor set
     assert(gpuav.instrumentation_bindings_.size() == 9);
 
+    const bool is_sampled = IsActionCommandSampled(gpuav, bind_point);
     InstrumentationErrorBlob instrumentation_error_blob;
-    UpdateInstrumentationDescSet(gpuav, cb_state, bind_point, instrumentation_desc_set, loc, instrumentation_error_blob);
+    VkDescriptorSet instrumentation_desc_set =
+        UpdateInstrumentationDescSet(gpuav, cb_state, bind_point, is_sampled, loc, instrumentation_error_blob);
+    if (!instrumentation_desc_set) {
+        return;
+    }
 
     instrumentation_error_blob.operation_index = (bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS)  ? cb_state.draw_index
                                                  : (bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) ? cb_state.compute_index
@@ -601,7 +678,7 @@ void PreCallSetupShaderInstrumentationResources(Validator &gpuav, CommandBufferS
 
     CommandBufferSubState::ErrorLoggerFunc error_logger = [&gpuav, &cb_state, loc, instrumentation_error_blob](
                                                               const uint32_t *error_record, const LogObjectList &objlist,
-                                                              const std::vector<std::string> &initial_label_stack) {
+                                                              const vvl::LabelStack &initial_label_stack) {
         bool skip = false;
         skip |=
             LogInstrumentationError(gpuav, cb_state, objlist, instrumentation_error_blob, initial_label_stack, error_record, loc);
@@ -1080,7 +1157,7 @@ bool LogMessageInstIndexedDraw(Validator &gpuav, const uint32_t *error_record, s
 //
 bool LogInstrumentationError(Validator &gpuav, const CommandBufferSubState &cb_state, const LogObjectList &objlist,
                              const InstrumentationErrorBlob &instrumentation_error_blob,
-                             const std::vector<std::string> &initial_label_stack, const uint32_t *error_record,
+                             const vvl::LabelStack &initial_label_stack, const uint32_t *error_record,
                              const Location &loc) {
     // The second word in the debug output buffer is the number of words that would have
     // been written by the shader instrumentation, if there was enough room in the buffer we provided.
@@ -32,6 +32,7 @@ struct LogObjectList;
 
 namespace vvl {
 struct LabelCommand;
+class LabelStack;
 class DescriptorSet;
 }
 
@@ -42,9 +43,10 @@ class CommandBufferSubState;
 class Queue;
 struct InstrumentationErrorBlob;
 
-void UpdateInstrumentationDescSet(Validator& gpuav, CommandBufferSubState& cb_state, VkPipelineBindPoint bind_point,
-                                  VkDescriptorSet instrumentation_desc_set, const Location& loc,
-                                  InstrumentationErrorBlob& out_instrumentation_error_blob);
+// Returns the instrumentation descriptor set to bind for the action command, VK_NULL_HANDLE on failure
+VkDescriptorSet UpdateInstrumentationDescSet(Validator& gpuav, CommandBufferSubState& cb_state, VkPipelineBindPoint bind_point,
+                                             bool is_sampled, const Location& loc,
+                                             InstrumentationErrorBlob& out_instrumentation_error_blob);
 
 void PreCallSetupShaderInstrumentationResources(Validator& gpuav, CommandBufferSubState& cb_state, VkPipelineBindPoint bind_point,
                                                 const Location& loc);
@@ -83,7 +85,7 @@ struct InstrumentationErrorBlob {
 // Return true iff an error has been found
 bool LogInstrumentationError(Validator& gpuav, const CommandBufferSubState& cb_state, const LogObjectList& objlist,
                              const InstrumentationErrorBlob& instrumentation_error_blob,
-                             const std::vector<std::string>& initial_label_stack, const uint32_t* error_record,
+                             const vvl::LabelStack& initial_label_stack, const uint32_t* error_record,
                              const Location& loc);
 
 // Return true iff an error has been found in error_record, among the list of errors this function manages
@@ -0,0 +1,223 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gpuav/instrumentation/gpuav_shader_cache.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+#include "utils/hash_util.h"
+
+namespace gpuav {
+
+namespace {
+// "GAVC"
+constexpr uint32_t kCacheMagic = 0x43564147;
+// Bump when the file layout changes
+constexpr uint32_t kCacheFormatVersion = 1;
+
+struct EntryHeader {
+    uint64_t key;
+    uint32_t word_count;
+    // Hash of the words, catches truncated or corrupted entries
+    uint32_t words_hash;
+};
+
+// Exclusive lock on a file, held by at most one process at a time
+class FileLock {
+  public:
+    explicit FileLock(const std::string &path) {
+#if defined(_WIN32)
+        handle_ = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (handle_ != INVALID_HANDLE_VALUE) {
+            OVERLAPPED overlapped = {};
+            locked_ = LockFileEx(handle_, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped) != 0;
+        }
+#else
+        fd_ = open(path.c_str(), O_RDWR | O_CREAT, 0600);
+        if (fd_ != -1) {
+            locked_ = flock(fd_, LOCK_EX) == 0;
+        }
+#endif
+    }
+    ~FileLock() {
+#if defined(_WIN32)
+        if (handle_ != INVALID_HANDLE_VALUE) {
+            if (locked_) {
+                OVERLAPPED overlapped = {};
+                UnlockFileEx(handle_, 0, MAXDWORD, MAXDWORD, &overlapped);
+            }
+            CloseHandle(handle_);
+        }
+#else
+        if (fd_ != -1) {
+            if (locked_) {
+                flock(fd_, LOCK_UN);
+            }
+            close(fd_);
+        }
+#endif
+    }
+    FileLock(const FileLock &) = delete;
+    FileLock &operator=(const FileLock &) = delete;
+
+    bool IsLocked() const { return locked_; }
+
+  private:
+#if defined(_WIN32)
+    HANDLE handle_ = INVALID_HANDLE_VALUE;
+#else
+    int fd_ = -1;
+#endif
+    bool locked_ = false;
+};
+}  // namespace
+
+InstrumentedShaderCache::InstrumentedShaderCache(std::string path) : path_(std::move(path)) {}
+
+void InstrumentedShaderCache::ReadFileOnce() {
+    if (!file_read_) {
+        // No file lock, the file is replaced at once when saved
+        ReadFile(path_, entries_);
+        file_read_ = true;
+    }
+}
+
+void InstrumentedShaderCache::ReadFile(const std::string &path, EntryMap &entries) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file) {
+        return;
+    }
+    uint32_t header[2] = {};
+    if (!file.read(reinterpret_cast<char *>(header), sizeof(header)) || header[0] != kCacheMagic ||
+        header[1] != kCacheFormatVersion) {
+        return;
+    }
+
+    EntryHeader entry_header;
+    while (file.read(reinterpret_cast<char *>(&entry_header), sizeof(entry_header))) {
+        if (entry_header.word_count > kMaxFileSize / sizeof(uint32_t)) {
+            break;
+        }
+        std::vector<uint32_t> spirv(entry_header.word_count);
+        const std::streamsize byte_count = std::streamsize(spirv.size() * sizeof(uint32_t));
+        if (!file.read(reinterpret_cast<char *>(spirv.data()), byte_count) ||
+            hash_util::Hash32(spirv.data(), size_t(byte_count)) != entry_header.words_hash) {
+            // The rest of the file cannot be trusted
+            break;
+        }
+        // Entries already in the map are newer
+        entries.emplace(entry_header.key, Entry{std::move(spirv), false});
+    }
+}
+
+bool InstrumentedShaderCache::Find(uint64_t key, std::vector<uint32_t> &out_spirv) {
+    std::lock_guard<std::mutex> guard(lock_);
+    ReadFileOnce();
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        return false;
+    }
+    it->second.used = true;
+    out_spirv = it->second.spirv;
+    return true;
+}
+
+void InstrumentedShaderCache::Add(uint64_t key, const std::vector<uint32_t> &spirv) {
+    std::lock_guard<std::mutex> guard(lock_);
+    ReadFileOnce();
+    entries_.insert_or_assign(key, Entry{spirv, true});
+    has_new_entries_ = true;
+}
+
+uint64_t InstrumentedShaderCache::MemoryUsage() {
+    std::lock_guard<std::mutex> guard(lock_);
+    uint64_t bytes = 0;
+    for (const auto &[key, entry] : entries_) {
+        bytes += entry.spirv.capacity() * sizeof(uint32_t);
+    }
+    return bytes;
+}
+
+bool InstrumentedShaderCache::Save() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!has_new_entries_) {
+        return true;
+    }
+
+    FileLock file_lock(path_ + ".lock");
+    if (!file_lock.IsLocked()) {
+        return false;
+    }
+
+    // Keep what other processes saved since the file was read
+    ReadFile(path_, entries_);
+
+    // The entries used in this run come first, so they are the last ones to go over the size limit
+    std::vector<std::pair<const uint64_t, Entry> *> ordered_entries;
+    ordered_entries.reserve(entries_.size());
+    for (auto &key_entry : entries_) {
+        ordered_entries.emplace_back(&key_entry);
+    }
+    std::stable_partition(ordered_entries.begin(), ordered_entries.end(),
+                          [](const std::pair<const uint64_t, Entry> *key_entry) { return key_entry->second.used; });
+
+    const std::string temp_path = path_ + ".tmp";
+    {
+        std::ofstream file(temp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        const uint32_t header[2] = {kCacheMagic, kCacheFormatVersion};
+        file.write(reinterpret_cast<const char *>(header), sizeof(header));
+        size_t file_size = sizeof(header);
+        for (const auto *key_entry : ordered_entries) {
+            const std::vector<uint32_t> &spirv = key_entry->second.spirv;
+            const size_t byte_count = spirv.size() * sizeof(uint32_t);
+            if (file_size + sizeof(EntryHeader) + byte_count > kMaxFileSize) {
+                break;
+            }
+            const EntryHeader entry_header = {key_entry->first, uint32_t(spirv.size()),
+                                              hash_util::Hash32(spirv.data(), byte_count)};
+            file.write(reinterpret_cast<const char *>(&entry_header), sizeof(entry_header));
+            file.write(reinterpret_cast<const char *>(spirv.data()), std::streamsize(byte_count));
+            file_size += sizeof(EntryHeader) + byte_count;
+        }
+        if (!file) {
+            return false;
+        }
+    }
+
+    // Readers that do not take the lock see either the old or the new file, never a partial one
+    std::error_code error;
+    std::filesystem::rename(temp_path, path_, error);
+    if (error) {
+        return false;
+    }
+    has_new_entries_ = false;
+    return true;
+}
+
+}  // namespace gpuav
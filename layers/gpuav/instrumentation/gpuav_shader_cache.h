@@ -0,0 +1,75 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "containers/custom_containers.h"
+
+namespace gpuav {
+
+// Instrumented SPIR-V saved on disk, so the next runs of an application do not instrument the same shaders again.
+//
+// The keys are built by the caller from everything the instrumentation output depends on: the original SPIR-V, the shader id
+// baked into the instrumentation, the descriptor set layouts, and the settings, features and layer version of the device.
+// An empty entry records that the shader did not need any instrumentation.
+//
+// The file is shared by all the processes of the user. It is read when the first shader is looked up, not at device
+// creation, and written back at device destruction under a file lock, merged with what other processes wrote in the meantime.
+class InstrumentedShaderCache {
+  public:
+    // Entries not used during the run are the first ones dropped once the file goes over this size
+    static constexpr size_t kMaxFileSize = 128 * 1024 * 1024;
+
+    // A missing or invalid file starts an empty cache
+    explicit InstrumentedShaderCache(std::string path);
+
+    bool Find(uint64_t key, std::vector<uint32_t> &out_spirv);
+    void Add(uint64_t key, const std::vector<uint32_t> &spirv);
+
+    // Returns false if the file could not be written, the cache is still usable
+    bool Save();
+
+    // Bytes of SPIR-V held in memory by the entries
+    uint64_t MemoryUsage();
+
+    const std::string &GetPath() const { return path_; }
+
+  private:
+    struct Entry {
+        std::vector<uint32_t> spirv;
+        // Found or added during this run
+        bool used = false;
+    };
+    using EntryMap = vvl::unordered_map<uint64_t, Entry>;
+
+    static void ReadFile(const std::string &path, EntryMap &entries);
+    // Reads the file the first time, lock_ must be held
+    void ReadFileOnce();
+
+    const std::string path_;
+
+    std::mutex lock_;
+    EntryMap entries_;
+    bool file_read_ = false;
+    bool has_new_entries_ = false;
+};
+
+}  // namespace gpuav
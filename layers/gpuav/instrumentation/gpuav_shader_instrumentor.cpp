@@ -17,13 +17,17 @@
 
 #include "gpuav/instrumentation/gpuav_shader_instrumentor.h"
 #include <vulkan/vulkan_core.h>
+#include <algorithm>
 #include <cstdint>
 
 #include "error_message/error_location.h"
 #include "generated/vk_extension_helper.h"
 #include "generated/dispatch_functions.h"
 #include "chassis/chassis_modification_state.h"
+#include "utils/file_system_utils.h"
+#include "utils/hash_util.h"
 #include "utils/shader_utils.h"
+#include "utils/spirv_compression.h"
 
 #include "gpuav/shaders/gpuav_shaders_constants.h"
 #include "gpuav/shaders/gpuav_error_codes.h"
@@ -35,6 +39,7 @@
 #include "state_tracker/pipeline_state.h"
 #include "state_tracker/descriptor_sets.h"
 #include "state_tracker/shader_object_state.h"
+#include "state_tracker/last_bound_state.h"
 #include "gpuav/resources/gpuav_state_trackers.h"
 
 #include "gpuav/spirv/module.h"
@@ -47,15 +52,28 @@
 #include "gpuav/spirv/debug_printf_pass.h"
 #include "gpuav/spirv/post_process_descriptor_indexing_pass.h"
 #include "gpuav/spirv/vertex_attribute_fetch_oob.h"
+#include "gpuav/instrumentation/gpuav_shader_cache.h"
 
 #include <filesystem>
 #include <cassert>
+#include <chrono>
 #include <filesystem>
 namespace fs = std::filesystem;
+#include <iostream>
 #include <string>
 
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__GNU__)
+#include <unistd.h>
+#endif
+
 namespace gpuav {
 
+GpuShaderInstrumentor::GpuShaderInstrumentor(vvl::dispatch::Device *dev, vvl::InstanceProxy *instance, LayerObjectTypeId type)
+    : BaseClass(dev, instance, type) {}
+
+// Out of line for the unique_ptr to the incomplete InstrumentedShaderCache
+GpuShaderInstrumentor::~GpuShaderInstrumentor() {}
+
 ReadLockGuard GpuShaderInstrumentor::ReadLock() const {
     if (global_settings.fine_grained_locking) {
         return ReadLockGuard(validation_object_mutex, std::defer_lock);
@@ -163,6 +181,62 @@ void GpuShaderInstrumentor::FinishDeviceSetup(const VkDeviceCreateInfo *pCreateI
         Cleanup();
         return;
     }
+
+    if (gpuav_settings.cache_instrumented_shaders) {
+        CreateInstrumentedShaderCache();
+    }
+    if (gpuav_settings.lazy_instrumentation) {
+        lazy_instrumentation_queue_ = std::make_unique<vvl::JobQueue>();
+    }
+    if (gpuav_settings.debug_validate_instrumented_shaders && gpuav_settings.debug_validate_instrumented_shaders_async) {
+        shader_validation_queue_ = std::make_unique<vvl::JobQueue>();
+    }
+}
+
+void GpuShaderInstrumentor::CreateInstrumentedShaderCache() {
+    // Everything that changes the instrumentation of a shader, other than the shader itself and its descriptor set layouts
+    const uint64_t settings[] = {
+        gpuav_settings.safe_mode,
+        gpuav_settings.safe_mode_targeted,
+        gpuav_settings.debug_printf_enabled,
+        gpuav_settings.debug_max_instrumentations_count,
+        instrumentation_desc_set_bind_index_,
+    };
+    const uint64_t hashes[] = {
+        VK_HEADER_VERSION_COMPLETE,
+        api_version.Value(),
+        hash_util::Hash64(settings, sizeof(settings)),
+        hash_util::Hash64(&gpuav_settings.shader_instrumentation, sizeof(gpuav_settings.shader_instrumentation)),
+        hash_util::Hash64(&extensions, sizeof(extensions)),
+        hash_util::Hash64(&modified_features, sizeof(modified_features)),
+    };
+    instrumented_shader_cache_device_hash_ = hash_util::Hash64(hashes, sizeof(hashes));
+
+    std::string cache_path = GetTempFilePath() + "/gpuav_instrumented_shader_cache";
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__GNU__)
+    cache_path += "-" + std::to_string(getuid());
+#endif
+    cache_path += ".bin";
+    instrumented_shader_cache_ = std::make_unique<InstrumentedShaderCache>(std::move(cache_path));
+}
+
+uint64_t GpuShaderInstrumentor::GetInstrumentedShaderCacheKey(
+    const vvl::span<const uint32_t> &input_spirv, uint32_t unique_shader_id,
+    const InstrumentationDescriptorSetLayouts &instrumentation_dsl) const {
+    std::vector<uint64_t> hashes = {
+        instrumented_shader_cache_device_hash_,
+        hash_util::Hash64(input_spirv.data(), input_spirv.size() * sizeof(uint32_t)),
+        // The id is baked in the instrumented code. Ids are given in creation order, which is the same from run to run for
+        // most applications.
+        unique_shader_id,
+        instrumentation_dsl.has_bindless_descriptors,
+        instrumentation_dsl.pipeline_robust_buffers,
+        instrumentation_dsl.pipeline_robust_vertex_inputs,
+    };
+    for (const std::vector<spirv::BindingLayout> &set_bindings : instrumentation_dsl.set_index_to_bindings_layout_lut) {
+        hashes.emplace_back(hash_util::Hash64(set_bindings.data(), set_bindings.size() * sizeof(spirv::BindingLayout)));
+    }
+    return hash_util::Hash64(hashes.data(), hashes.size() * sizeof(uint64_t));
 }
 
 void GpuShaderInstrumentor::Cleanup() {
@@ -181,8 +255,73 @@ void GpuShaderInstrumentor::Cleanup() {
     }
 }
 
+const std::vector<uint32_t> &InstrumentedShader::GetOriginalSpirv(std::vector<uint32_t> &storage) const {
+    if (compressed_spirv.empty()) {
+        return original_spirv;
+    }
+    if (!::spirv::DecompressWords(compressed_spirv, storage)) {
+        assert(false);
+        storage.clear();
+    }
+    return storage;
+}
+
+const ::spirv::DebugLineIndex &InstrumentedShader::GetDebugLineIndex(const std::vector<uint32_t> &original_spirv) const {
+    std::call_once(debug_line_index->once,
+                   [&]() { debug_line_index->index = std::make_unique<::spirv::DebugLineIndex>(original_spirv); });
+    return *debug_line_index->index;
+}
+
+void GpuShaderInstrumentor::AddInstrumentedShader(uint32_t unique_shader_id, VkPipeline pipeline, VkShaderModule shader_module,
+                                                  VkShaderEXT shader_object, std::vector<uint32_t> &&original_spirv) {
+    InstrumentedShader instrumented_shader{pipeline,
+                                           shader_module,
+                                           shader_object,
+                                           {},
+                                           {},
+                                           std::make_shared<InstrumentedShader::LazyDebugLineIndex>(),
+                                           std::make_shared<InstrumentedShader::DebugPrintfPlans>()};
+    if (gpuav_settings.compress_original_spirv && !original_spirv.empty()) {
+        // Only read again when an error is reported
+        instrumented_shader.compressed_spirv = ::spirv::CompressWords(original_spirv);
+    } else {
+        instrumented_shader.original_spirv = std::move(original_spirv);
+    }
+    instrumented_spirv_bytes_.fetch_add(instrumented_shader.SpirvBytes(), std::memory_order_relaxed);
+    instrumented_shaders_map_.insert_or_assign(unique_shader_id, std::move(instrumented_shader));
+}
+
+void GpuShaderInstrumentor::RemoveInstrumentedShader(uint32_t unique_shader_id) {
+    if (auto it = instrumented_shaders_map_.pop(unique_shader_id); it != instrumented_shaders_map_.end()) {
+        instrumented_spirv_bytes_.fetch_sub(it->second.SpirvBytes(), std::memory_order_relaxed);
+    }
+}
+
+void GpuShaderInstrumentor::UpdateMemoryAccounting() const {
+    uint64_t bytes = instrumented_spirv_bytes_.load(std::memory_order_relaxed);
+    if (instrumented_shader_cache_) {
+        bytes += instrumented_shader_cache_->MemoryUsage();
+    }
+    memory_accounting.Set(vvl::profiling::MemorySubsystem::GpuavShaders, bytes);
+}
+
 void GpuShaderInstrumentor::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
                                                        const RecordObject &record_obj) {
+    // Finishes the variants still being built, they use the device and the shader cache
+    lazy_instrumentation_queue_.reset();
+    shader_validation_queue_.reset();
+    // The invalid shaders no command used were not reported yet
+    for (const auto &[unique_shader_id, pending] : pending_shader_validations_) {
+        if (!pending->valid) {
+            LogInstrumentedShaderValidationError(*pending);
+        }
+    }
+    pending_shader_validations_.clear();
+    if (instrumented_shader_cache_ && !instrumented_shader_cache_->Save()) {
+        LogInfo("WARNING-cache-write-error", device, record_obj.location, "Cannot write GPU-AV instrumented shader cache at %s",
+                instrumented_shader_cache_->GetPath().c_str());
+    }
+    instrumented_shader_cache_.reset();
     Cleanup();
     BaseClass::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 }
@@ -286,7 +425,7 @@ void GpuShaderInstrumentor::PreCallRecordGetShaderBinaryDataEXT(VkDevice device,
     VkShaderEXT original_handle = VK_NULL_HANDLE;
 
     auto it = instrumented_shaders_map_.find(sub_state.unique_shader_id);
-    if (it == instrumented_shaders_map_.end() || it->second.original_spirv.empty()) {
+    if (it == instrumented_shaders_map_.end() || !it->second.HasOriginalSpirv()) {
         // This will occur if the shader was so simple we didn't even instrument anything
         return;
     }
@@ -295,8 +434,10 @@ void GpuShaderInstrumentor::PreCallRecordGetShaderBinaryDataEXT(VkDevice device,
     VkShaderCreateInfoEXT create_info_copy = *sub_state.original_create_info.ptr();
     // The pCode doesn't live in the safe struct, we need to grab it from our other map
     const gpuav::InstrumentedShader *instrumented_shader = &it->second;
-    create_info_copy.pCode = instrumented_shader->original_spirv.data();
-    create_info_copy.codeSize = instrumented_shader->original_spirv.size() * sizeof(uint32_t);
+    std::vector<uint32_t> decompressed_spirv;
+    const std::vector<uint32_t> &original_spirv = instrumented_shader->GetOriginalSpirv(decompressed_spirv);
+    create_info_copy.pCode = original_spirv.data();
+    create_info_copy.codeSize = original_spirv.size() * sizeof(uint32_t);
 
     // Only warn on the first call to query the size
     if (pData == nullptr) {
@@ -448,8 +589,8 @@ void GpuShaderInstrumentor::PostCallRecordCreateShadersEXT(VkDevice device, uint
             code = shader_object_state->spirv->words_;
         }
 
-        instrumented_shaders_map_.insert_or_assign(instrumentation_data.unique_shader_id, VK_NULL_HANDLE, VK_NULL_HANDLE,
-                                                   shader_handle, std::move(code));
+        AddInstrumentedShader(instrumentation_data.unique_shader_id, VK_NULL_HANDLE, VK_NULL_HANDLE, shader_handle,
+                              std::move(code));
     }
 }
 
@@ -457,7 +598,7 @@ void GpuShaderInstrumentor::PreCallRecordDestroyShaderEXT(VkDevice device, VkSha
                                                           const VkAllocationCallbacks *pAllocator, const RecordObject &record_obj) {
     if (auto shader_object_state = Get<vvl::ShaderObject>(shader)) {
         auto &sub_state = SubState(*shader_object_state);
-        instrumented_shaders_map_.pop(sub_state.unique_shader_id);
+        RemoveInstrumentedShader(sub_state.unique_shader_id);
 
         if (sub_state.original_handle != VK_NULL_HANDLE) {
             DispatchDestroyShaderEXT(device, sub_state.original_handle, nullptr);
@@ -474,7 +615,10 @@ void GpuShaderInstrumentor::PreCallRecordCreateGraphicsPipelines(VkDevice device
 
     chassis_state.shader_instrumentations_metadata.resize(count);
     chassis_state.modified_create_infos.resize(count);
+    chassis_state.lazy_instrumentations.resize(count);
 
+    PipelineInstrumentationBatch batch;
+    batch.instrumentation_dsls.resize(count);
     for (uint32_t i = 0; i < count; ++i) {
         const auto &pipeline_state = pipeline_states[i];
         const Location create_info_loc = record_obj.location.dot(vvl::Field::pCreateInfos, i);
@@ -486,22 +630,30 @@ void GpuShaderInstrumentor::PreCallRecordCreateGraphicsPipelines(VkDevice device
         if (!NeedPipelineCreationShaderInstrumentation(*pipeline_state, create_info_loc)) {
             continue;
         }
+        if (CanInstrumentPipelineLazily(*pipeline_state)) {
+            chassis_state.lazy_instrumentations[i] = true;
+            continue;
+        }
 
         auto &shader_instrumentation_metadata = chassis_state.shader_instrumentations_metadata[i];
 
-        bool success = false;
         if (pipeline_state->linking_shaders != 0) {
-            success = PreCallRecordPipelineCreationShaderInstrumentationGPL(pAllocator, *pipeline_state, new_pipeline_ci,
-                                                                            create_info_loc, shader_instrumentation_metadata);
+            if (!PreCallRecordPipelineCreationShaderInstrumentationGPL(pAllocator, *pipeline_state, new_pipeline_ci,
+                                                                       create_info_loc, shader_instrumentation_metadata)) {
+                return;
+            }
         } else {
-            success = PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci,
-                                                                         create_info_loc, shader_instrumentation_metadata);
-        }
-        if (!success) {
-            return;
+            PreCallRecordPipelineCreationShaderInstrumentation(*pipeline_state, i, new_pipeline_ci, create_info_loc,
+                                                               shader_instrumentation_metadata, batch);
         }
     }
 
+    InstrumentPipelineShaders(batch);
+    if (!ApplyPipelineShaderInstrumentation(pAllocator, pipeline_states, chassis_state.modified_create_infos,
+                                            chassis_state.shader_instrumentations_metadata, batch)) {
+        return;
+    }
+
     chassis_state.is_modified = true;
     chassis_state.pCreateInfos = reinterpret_cast<VkGraphicsPipelineCreateInfo *>(chassis_state.modified_create_infos.data());
 }
@@ -515,7 +667,10 @@ void GpuShaderInstrumentor::PreCallRecordCreateComputePipelines(VkDevice device,
 
     chassis_state.shader_instrumentations_metadata.resize(count);
     chassis_state.modified_create_infos.resize(count);
+    chassis_state.lazy_instrumentations.resize(count);
 
+    PipelineInstrumentationBatch batch;
+    batch.instrumentation_dsls.resize(count);
     for (uint32_t i = 0; i < count; ++i) {
         const auto &pipeline_state = pipeline_states[i];
         const Location create_info_loc = record_obj.location.dot(vvl::Field::pCreateInfos, i);
@@ -527,14 +682,21 @@ void GpuShaderInstrumentor::PreCallRecordCreateComputePipelines(VkDevice device,
         if (!NeedPipelineCreationShaderInstrumentation(*pipeline_state, create_info_loc)) {
             continue;
         }
+        if (CanInstrumentPipelineLazily(*pipeline_state)) {
+            chassis_state.lazy_instrumentations[i] = true;
+            continue;
+        }
 
         auto &shader_instrumentation_metadata = chassis_state.shader_instrumentations_metadata[i];
 
-        bool success = PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci,
-                                                                          create_info_loc, shader_instrumentation_metadata);
-        if (!success) {
-            return;
-        }
+        PreCallRecordPipelineCreationShaderInstrumentation(*pipeline_state, i, new_pipeline_ci, create_info_loc,
+                                                           shader_instrumentation_metadata, batch);
+    }
+
+    InstrumentPipelineShaders(batch);
+    if (!ApplyPipelineShaderInstrumentation(pAllocator, pipeline_states, chassis_state.modified_create_infos,
+                                            chassis_state.shader_instrumentations_metadata, batch)) {
+        return;
     }
 
     chassis_state.is_modified = true;
@@ -550,6 +712,8 @@ void GpuShaderInstrumentor::PreCallRecordCreateRayTracingPipelinesKHR(
     chassis_state.shader_instrumentations_metadata.resize(count);
     chassis_state.modified_create_infos.resize(count);
 
+    PipelineInstrumentationBatch batch;
+    batch.instrumentation_dsls.resize(count);
     for (uint32_t i = 0; i < count; ++i) {
         const auto &pipeline_state = pipeline_states[i];
         const Location create_info_loc = record_obj.location.dot(vvl::Field::pCreateInfos, i);
@@ -564,11 +728,14 @@ void GpuShaderInstrumentor::PreCallRecordCreateRayTracingPipelinesKHR(
 
         auto &shader_instrumentation_metadata = chassis_state.shader_instrumentations_metadata[i];
 
-        bool success = PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci,
-                                                                          create_info_loc, shader_instrumentation_metadata);
-        if (!success) {
-            return;
-        }
+        PreCallRecordPipelineCreationShaderInstrumentation(*pipeline_state, i, new_pipeline_ci, create_info_loc,
+                                                           shader_instrumentation_metadata, batch);
+    }
+
+    InstrumentPipelineShaders(batch);
+    if (!ApplyPipelineShaderInstrumentation(pAllocator, pipeline_states, chassis_state.modified_create_infos,
+                                            chassis_state.shader_instrumentations_metadata, batch)) {
+        return;
     }
 
     chassis_state.is_modified = true;
@@ -612,6 +779,11 @@ void GpuShaderInstrumentor::PostCallRecordCreateGraphicsPipelines(VkDevice devic
         // Move all instrumentation until the final linking time
         if (pipeline_state->create_flags & VK_PIPELINE_CREATE_LIBRARY_BIT_KHR) continue;
 
+        if (chassis_state.lazy_instrumentations[i]) {
+            lazy_instrumented_pipelines_.insert_or_assign(pipeline_handle, std::make_shared<LazyInstrumentedPipeline>());
+            continue;
+        }
+
         auto &shader_instrumentation_metadata = chassis_state.shader_instrumentations_metadata[i];
         if (pipeline_state->linking_shaders != 0) {
             PostCallRecordPipelineCreationShaderInstrumentationGPL(*pipeline_state, pAllocator, shader_instrumentation_metadata);
@@ -641,6 +813,11 @@ void GpuShaderInstrumentor::PostCallRecordCreateComputePipelines(VkDevice device
 
         UtilCopyCreatePipelineFeedbackData(pCreateInfos[i], chassis_state.modified_create_infos[i]);
 
+        if (chassis_state.lazy_instrumentations[i]) {
+            lazy_instrumented_pipelines_.insert_or_assign(pipeline_handle, std::make_shared<LazyInstrumentedPipeline>());
+            continue;
+        }
+
         auto pipeline_state = Get<vvl::Pipeline>(pipeline_handle);
         ASSERT_AND_CONTINUE(pipeline_state);
         auto &shader_instrumentation_metadata = chassis_state.shader_instrumentations_metadata[i];
@@ -720,8 +897,17 @@ void GpuShaderInstrumentor::PostCallRecordCreateRayTracingPipelinesKHR(
 void GpuShaderInstrumentor::PreCallRecordDestroyPipeline(VkDevice device, VkPipeline pipeline,
                                                          const VkAllocationCallbacks *pAllocator, const RecordObject &record_obj) {
     if (auto pipeline_state = Get<vvl::Pipeline>(pipeline)) {
+        if (auto lazy_it = lazy_instrumented_pipelines_.pop(pipeline); lazy_it != lazy_instrumented_pipelines_.end()) {
+            LazyInstrumentedPipeline &lazy_pipeline = *lazy_it->second;
+            std::unique_lock<std::mutex> guard(lazy_pipeline.lock);
+            lazy_pipeline.destroyed = true;
+            if (lazy_pipeline.instrumented_pipeline != VK_NULL_HANDLE) {
+                DispatchDestroyPipeline(device, lazy_pipeline.instrumented_pipeline, pAllocator);
+                lazy_pipeline.instrumented_pipeline = VK_NULL_HANDLE;
+            }
+        }
         for (auto [unique_shader_id, shader_module_handle] : pipeline_state->instrumentation_data.instrumented_shader_modules) {
-            instrumented_shaders_map_.pop(unique_shader_id);
+            RemoveInstrumentedShader(unique_shader_id);
             DispatchDestroyShaderModule(device, shader_module_handle, pAllocator);
         }
         if (pipeline_state->instrumentation_data.pre_raster_lib != VK_NULL_HANDLE) {
@@ -827,8 +1013,36 @@ bool GpuShaderInstrumentor::NeedPipelineCreationShaderInstrumentation(vvl::Pipel
     return true;
 }
 
+static bool IsRobustBufferBehavior(VkPipelineRobustnessBufferBehavior behavior) {
+    return behavior == VK_PIPELINE_ROBUSTNESS_BUFFER_BEHAVIOR_ROBUST_BUFFER_ACCESS ||
+           behavior == VK_PIPELINE_ROBUSTNESS_BUFFER_BEHAVIOR_ROBUST_BUFFER_ACCESS_2;
+}
+
+// A stage can only keep the pipeline robustness by not overriding it, or by overriding it with another robust behavior
+static bool IsStageRobustBufferBehavior(VkPipelineRobustnessBufferBehavior behavior) {
+    return behavior == VK_PIPELINE_ROBUSTNESS_BUFFER_BEHAVIOR_DEVICE_DEFAULT || IsRobustBufferBehavior(behavior);
+}
+
 void GpuShaderInstrumentor::BuildDescriptorSetLayoutInfo(const vvl::Pipeline &pipeline_state,
                                                          InstrumentationDescriptorSetLayouts &out_instrumentation_dsl) {
+    if (enabled_features.pipelineRobustness) {
+        if (const auto robustness_ci =
+                vku::FindStructInPNextChain<VkPipelineRobustnessCreateInfo>(pipeline_state.GetCreateInfoPNext())) {
+            bool robust_buffers =
+                IsRobustBufferBehavior(robustness_ci->storageBuffers) && IsRobustBufferBehavior(robustness_ci->uniformBuffers);
+            bool robust_vertex_inputs = IsRobustBufferBehavior(robustness_ci->vertexInputs);
+            for (const auto &stage_ci : pipeline_state.shader_stages_ci) {
+                const auto stage_robustness_ci = vku::FindStructInPNextChain<VkPipelineRobustnessCreateInfo>(stage_ci.pNext);
+                if (!stage_robustness_ci) continue;
+                robust_buffers &= IsStageRobustBufferBehavior(stage_robustness_ci->storageBuffers) &&
+                                  IsStageRobustBufferBehavior(stage_robustness_ci->uniformBuffers);
+                robust_vertex_inputs &= IsStageRobustBufferBehavior(stage_robustness_ci->vertexInputs);
+            }
+            out_instrumentation_dsl.pipeline_robust_buffers = robust_buffers;
+            out_instrumentation_dsl.pipeline_robust_vertex_inputs = robust_vertex_inputs;
+        }
+    }
+
     const auto pipeline_layout = pipeline_state.PipelineLayoutState();
     if (!pipeline_layout) return;
 
@@ -864,18 +1078,19 @@ void GpuShaderInstrumentor::BuildDescriptorSetLayoutInfo(const vvl::DescriptorSe
     auto dsl_bindings = set_layout_state.GetBindings();
     for (uint32_t binding_index = 0; binding_index < dsl_bindings.size(); binding_index++) {
         auto &dsl_binding = dsl_bindings[binding_index];
+        const VkDescriptorBindingFlags flags = set_layout_state.GetDescriptorBindingFlagsFromBinding(binding_index);
+        const uint32_t is_bindless = vvl::IsBindless(flags) ? 1 : 0;
+        if (is_bindless) {
+            out_instrumentation_dsl.has_bindless_descriptors = true;
+        }
+
         if (dsl_binding.descriptorType == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK) {
-            binding_layouts[dsl_binding.binding] = {start, 1};
+            binding_layouts[dsl_binding.binding] = {start, 1, is_bindless};
             start += 1;
         } else {
-            binding_layouts[dsl_binding.binding] = {start, dsl_binding.descriptorCount};
+            binding_layouts[dsl_binding.binding] = {start, dsl_binding.descriptorCount, is_bindless};
             start += dsl_binding.descriptorCount;
         }
-
-        const VkDescriptorBindingFlags flags = set_layout_state.GetDescriptorBindingFlagsFromBinding(binding_index);
-        if (vvl::IsBindless(flags)) {
-            out_instrumentation_dsl.has_bindless_descriptors = true;
-        }
     }
 }
 
@@ -940,22 +1155,23 @@ bool GpuShaderInstrumentor::IsShaderSelectedForInstrumentation(vku::safe_VkShade
 // 4. VK_EXT_shader_module_identifier
 //    We will skip these as we don't know the incoming SPIR-V
 // Note: Shader Objects are handled in their own path as they don't use pipelines
+//
+// This only selects the shaders to instrument, InstrumentPipelineShaders() and ApplyPipelineShaderInstrumentation() do the rest
+// once every pipeline of the call was looked at.
 template <typename SafeCreateInfo>
-bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
-    const VkAllocationCallbacks *pAllocator, vvl::Pipeline &pipeline_state, SafeCreateInfo &modified_pipeline_ci,
-    const Location &loc, std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata) {
+void GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
+    vvl::Pipeline &pipeline_state, uint32_t pipeline_index, SafeCreateInfo &modified_pipeline_ci, const Location &loc,
+    std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata, PipelineInstrumentationBatch &batch) {
     // Init here instead of in chassis so we don't pay cost when GPU-AV is not used
     const size_t total_stages = pipeline_state.stage_states.size();
     shader_instrumentation_metadata.resize(total_stages);
 
-    InstrumentationDescriptorSetLayouts instrumentation_dsl;
-    BuildDescriptorSetLayoutInfo(pipeline_state, instrumentation_dsl);
+    BuildDescriptorSetLayoutInfo(pipeline_state, batch.instrumentation_dsls[pipeline_index]);
 
     for (uint32_t stage_state_i = 0; stage_state_i < static_cast<uint32_t>(pipeline_state.stage_states.size()); ++stage_state_i) {
         const auto &stage_state = pipeline_state.stage_states[stage_state_i];
-        auto modified_module_state = std::const_pointer_cast<vvl::ShaderModule>(stage_state.module_state);
-        ASSERT_AND_CONTINUE(modified_module_state);
-        auto &instrumentation_metadata = shader_instrumentation_metadata[stage_state_i];
+        const auto &module_state = stage_state.module_state;
+        ASSERT_AND_CONTINUE(module_state);
 
         // Check pNext for inlined SPIR-V
         // ---
@@ -968,49 +1184,72 @@ bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
                 const_cast<vku::safe_VkShaderModuleCreateInfo *>(reinterpret_cast<const vku::safe_VkShaderModuleCreateInfo *>(
                     vku::FindStructInPNextChain<VkShaderModuleCreateInfo>(stage_ci.pNext)));
 
-            if (!IsShaderSelectedForInstrumentation(modified_shader_module_ci, modified_module_state->VkHandle(),
+            if (!IsShaderSelectedForInstrumentation(modified_shader_module_ci, module_state->VkHandle(),
                                                     loc.dot(vvl::Field::pStages, stage_state_i).dot(vvl::Field::module))) {
                 continue;
             }
         }
-        std::vector<uint32_t> instrumented_spirv;
-        const uint32_t unique_shader_id = unique_shader_module_id_++;
-        const bool is_shader_instrumented =
-            InstrumentShader(modified_module_state->spirv->words_, unique_shader_id, instrumentation_dsl, loc, instrumented_spirv);
-        if (is_shader_instrumented) {
-            instrumentation_metadata.unique_shader_id = unique_shader_id;
-            if (modified_module_state->VkHandle() != VK_NULL_HANDLE) {
-                // If the user used vkCreateShaderModule, we create a new VkShaderModule to replace with the instrumented
-                // shader
-                VkShaderModuleCreateInfo instrumented_shader_module_ci = vku::InitStructHelper();
-                instrumented_shader_module_ci.pCode = instrumented_spirv.data();
-                instrumented_shader_module_ci.codeSize = instrumented_spirv.size() * sizeof(uint32_t);
-                VkShaderModule instrumented_shader_module = VK_NULL_HANDLE;
-                VkResult result =
-                    DispatchCreateShaderModule(device, &instrumented_shader_module_ci, pAllocator, &instrumented_shader_module);
-                if (result == VK_SUCCESS) {
-                    SetShaderModule(modified_pipeline_ci, *stage_state.pipeline_create_info, instrumented_shader_module,
-                                    stage_state_i);
+        batch.jobs.emplace_back(ShaderInstrumentationJob{pipeline_index, stage_state_i, unique_shader_module_id_++,
+                                                         module_state->spirv->words_, modified_shader_module_ci, loc});
+    }
+}
 
-                    pipeline_state.instrumentation_data.instrumented_shader_modules.emplace_back(
-                        std::pair<uint32_t, VkShaderModule>{unique_shader_id, instrumented_shader_module});
-                } else {
-                    InternalError(device, loc, "Unable to replace non-instrumented shader with instrumented one.");
-                    return false;
-                }
-            } else if (modified_shader_module_ci) {
-                // The user is inlining the Shader Module into the pipeline, so just need to update the spirv
-                instrumentation_metadata.passed_in_shader_stage_ci = true;
-                // TODO - This makes a copy, but could save on Chassis stack instead (then remove function from VUL).
-                // The core issue is we always use std::vector<uint32_t> but Safe Struct manages its own version of the pCode
-                // memory. It would be much harder to change everything from std::vector and instead to adjust Safe Struct to not
-                // double-free the memory on us. If making any changes, we have to consider a case where the user inlines the
-                // fragment shader, but use a normal VkShaderModule in the vertex shader.
-                modified_shader_module_ci->SetCode(instrumented_spirv);
+// The SPIR-V modules of the shaders are independent from each other, so the passes of the different shaders run in parallel
+void GpuShaderInstrumentor::InstrumentPipelineShaders(PipelineInstrumentationBatch &batch) {
+    instrumentation_pool_.ParallelFor(static_cast<uint32_t>(batch.jobs.size()), [this, &batch](uint32_t job_i) {
+        ShaderInstrumentationJob &job = batch.jobs[job_i];
+        job.is_instrumented = InstrumentShader(job.input_spirv, job.unique_shader_id,
+                                               batch.instrumentation_dsls[job.pipeline_index], job.loc, job.instrumented_spirv);
+    });
+}
+
+template <typename SafeCreateInfo>
+bool GpuShaderInstrumentor::ApplyPipelineShaderInstrumentation(
+    const VkAllocationCallbacks *pAllocator, const PipelineStates &pipeline_states,
+    std::vector<SafeCreateInfo> &modified_pipeline_cis,
+    std::vector<std::vector<chassis::ShaderInstrumentationMetadata>> &shader_instrumentations_metadata,
+    PipelineInstrumentationBatch &batch) {
+    for (ShaderInstrumentationJob &job : batch.jobs) {
+        if (!job.is_instrumented) {
+            continue;
+        }
+        vvl::Pipeline &pipeline_state = *pipeline_states[job.pipeline_index];
+        SafeCreateInfo &modified_pipeline_ci = modified_pipeline_cis[job.pipeline_index];
+        const auto &stage_state = pipeline_state.stage_states[job.stage_state_index];
+        auto &instrumentation_metadata = shader_instrumentations_metadata[job.pipeline_index][job.stage_state_index];
+
+        instrumentation_metadata.unique_shader_id = job.unique_shader_id;
+        if (stage_state.module_state->VkHandle() != VK_NULL_HANDLE) {
+            // If the user used vkCreateShaderModule, we create a new VkShaderModule to replace with the instrumented
+            // shader
+            VkShaderModuleCreateInfo instrumented_shader_module_ci = vku::InitStructHelper();
+            instrumented_shader_module_ci.pCode = job.instrumented_spirv.data();
+            instrumented_shader_module_ci.codeSize = job.instrumented_spirv.size() * sizeof(uint32_t);
+            VkShaderModule instrumented_shader_module = VK_NULL_HANDLE;
+            VkResult result =
+                DispatchCreateShaderModule(device, &instrumented_shader_module_ci, pAllocator, &instrumented_shader_module);
+            if (result == VK_SUCCESS) {
+                SetShaderModule(modified_pipeline_ci, *stage_state.pipeline_create_info, instrumented_shader_module,
+                                job.stage_state_index);
+
+                pipeline_state.instrumentation_data.instrumented_shader_modules.emplace_back(
+                    std::pair<uint32_t, VkShaderModule>{job.unique_shader_id, instrumented_shader_module});
             } else {
-                assert(false);
+                InternalError(device, job.loc, "Unable to replace non-instrumented shader with instrumented one.");
                 return false;
             }
+        } else if (job.modified_shader_module_ci) {
+            // The user is inlining the Shader Module into the pipeline, so just need to update the spirv
+            instrumentation_metadata.passed_in_shader_stage_ci = true;
+            // TODO - This makes a copy, but could save on Chassis stack instead (then remove function from VUL).
+            // The core issue is we always use std::vector<uint32_t> but Safe Struct manages its own version of the pCode
+            // memory. It would be much harder to change everything from std::vector and instead to adjust Safe Struct to not
+            // double-free the memory on us. If making any changes, we have to consider a case where the user inlines the
+            // fragment shader, but use a normal VkShaderModule in the vertex shader.
+            job.modified_shader_module_ci->SetCode(job.instrumented_spirv);
+        } else {
+            assert(false);
+            return false;
         }
     }
     return true;
@@ -1022,6 +1261,14 @@ void GpuShaderInstrumentor::PostCallRecordPipelineCreationShaderInstrumentation(
     // if we return early from NeedPipelineCreationShaderInstrumentation, will need to skip at this point in PostCall
     if (shader_instrumentation_metadata.empty()) return;
 
+    if (RegisterPipelineInstrumentedShaders(pipeline_state, shader_instrumentation_metadata)) {
+        pipeline_state.instrumentation_data.was_instrumented = true;
+    }
+}
+
+bool GpuShaderInstrumentor::RegisterPipelineInstrumentedShaders(
+    const vvl::Pipeline &pipeline_state, std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata) {
+    bool was_instrumented = false;
     for (uint32_t stage_state_i = 0; stage_state_i < static_cast<uint32_t>(pipeline_state.stage_states.size()); ++stage_state_i) {
         auto &instrumentation_metadata = shader_instrumentation_metadata[stage_state_i];
 
@@ -1029,7 +1276,7 @@ void GpuShaderInstrumentor::PostCallRecordPipelineCreationShaderInstrumentation(
         if (!instrumentation_metadata.IsInstrumented()) {
             continue;
         }
-        pipeline_state.instrumentation_data.was_instrumented = true;
+        was_instrumented = true;
 
         const auto &stage_state = pipeline_state.stage_states[stage_state_i];
         auto &module_state = stage_state.module_state;
@@ -1047,9 +1294,164 @@ void GpuShaderInstrumentor::PostCallRecordPipelineCreationShaderInstrumentation(
             shader_module_handle = kPipelineStageInfoHandle;
         }
 
-        instrumented_shaders_map_.insert_or_assign(instrumentation_metadata.unique_shader_id, pipeline_state.VkHandle(),
-                                                   shader_module_handle, VK_NULL_HANDLE, std::move(code));
+        AddInstrumentedShader(instrumentation_metadata.unique_shader_id, pipeline_state.VkHandle(), shader_module_handle,
+                              VK_NULL_HANDLE, std::move(code));
     }
+    return was_instrumented;
+}
+
+bool GpuShaderInstrumentor::CanInstrumentPipelineLazily(const vvl::Pipeline &pipeline_state) const {
+    // The variant is created again from the create info once the pipeline is bound, the libraries of a linked pipeline could be
+    // destroyed by then
+    return gpuav_settings.lazy_instrumentation && !pipeline_state.library_create_info;
+}
+
+static VkResult DispatchCreateInstrumentedPipeline(VkDevice device, const vku::safe_VkGraphicsPipelineCreateInfo &create_info,
+                                                   VkPipeline *pipeline) {
+    return DispatchCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, create_info.ptr(), nullptr, pipeline);
+}
+
+static VkResult DispatchCreateInstrumentedPipeline(VkDevice device, const vku::safe_VkComputePipelineCreateInfo &create_info,
+                                                   VkPipeline *pipeline) {
+    return DispatchCreateComputePipelines(device, VK_NULL_HANDLE, 1, create_info.ptr(), nullptr, pipeline);
+}
+
+// The shaders are selected on the calling thread, the rest (instrumentation passes and pipeline creation) is done on
+// lazy_instrumentation_queue_
+template <typename SafeCreateInfo>
+void GpuShaderInstrumentor::StartLazyPipelineInstrumentation(const std::shared_ptr<vvl::Pipeline> &pipeline_state,
+                                                             const SafeCreateInfo &create_info,
+                                                             const std::shared_ptr<LazyInstrumentedPipeline> &lazy_pipeline) {
+    const Location loc(vvl::Func::vkCmdBindPipeline);
+
+    const auto pipeline_layout = pipeline_state->PipelineLayoutState();
+    const auto rp_state = pipeline_state->RenderPassState();
+    if ((pipeline_layout && pipeline_layout->Destroyed()) || (rp_state && rp_state->Destroyed())) {
+        InternalWarning(pipeline_state->VkHandle(), loc,
+                        "The pipeline layout or render pass of the pipeline was destroyed before the pipeline was first bound, its "
+                        "instrumented variant cannot be created and it will not be validated.");
+        lazy_pipeline->status.store(LazyInstrumentedPipeline::Status::NotInstrumented, std::memory_order_release);
+        return;
+    }
+
+    // Owned by the job
+    struct BuildState {
+        PipelineStates pipeline_states;
+        std::vector<SafeCreateInfo> modified_pipeline_cis;
+        std::vector<std::vector<chassis::ShaderInstrumentationMetadata>> shader_instrumentations_metadata;
+        PipelineInstrumentationBatch batch;
+    };
+    auto build = std::make_shared<BuildState>();
+    build->pipeline_states.emplace_back(pipeline_state);
+    build->modified_pipeline_cis.resize(1);
+    build->shader_instrumentations_metadata.resize(1);
+    build->batch.instrumentation_dsls.resize(1);
+
+    SafeCreateInfo &modified_pipeline_ci = build->modified_pipeline_cis[0];
+    modified_pipeline_ci.initialize(&create_info);
+    // The base pipeline might be gone by now, and the variant has to be created even if it is not in a pipeline cache
+    modified_pipeline_ci.flags &= ~(VK_PIPELINE_CREATE_DERIVATIVE_BIT | VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT);
+    modified_pipeline_ci.basePipelineHandle = VK_NULL_HANDLE;
+    modified_pipeline_ci.basePipelineIndex = -1;
+    if (auto flags2_ci = const_cast<VkPipelineCreateFlags2CreateInfo *>(
+            vku::FindStructInPNextChain<VkPipelineCreateFlags2CreateInfo>(modified_pipeline_ci.pNext))) {
+        flags2_ci->flags &= ~(VK_PIPELINE_CREATE_2_DERIVATIVE_BIT | VK_PIPELINE_CREATE_2_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT);
+    }
+
+    PreCallRecordPipelineCreationShaderInstrumentation(*pipeline_state, 0, modified_pipeline_ci, loc,
+                                                       build->shader_instrumentations_metadata[0], build->batch);
+    if (build->batch.jobs.empty()) {
+        lazy_pipeline->status.store(LazyInstrumentedPipeline::Status::NotInstrumented, std::memory_order_release);
+        return;
+    }
+
+    lazy_instrumentation_queue_->Post([this, build, lazy_pipeline]() {
+        std::unique_lock<std::mutex> guard(lazy_pipeline->lock);
+        if (lazy_pipeline->destroyed) {
+            return;
+        }
+        const Location loc(vvl::Func::vkCmdBindPipeline);
+        vvl::Pipeline &pipeline_state = *build->pipeline_states[0];
+        SafeCreateInfo &modified_pipeline_ci = build->modified_pipeline_cis[0];
+        auto &shader_instrumentation_metadata = build->shader_instrumentations_metadata[0];
+
+        InstrumentPipelineShaders(build->batch);
+        const bool any_instrumented = std::any_of(build->batch.jobs.begin(), build->batch.jobs.end(),
+                                                  [](const ShaderInstrumentationJob &job) { return job.is_instrumented; });
+        if (!any_instrumented || !ApplyPipelineShaderInstrumentation(nullptr, build->pipeline_states, build->modified_pipeline_cis,
+                                                                     build->shader_instrumentations_metadata, build->batch)) {
+            lazy_pipeline->status.store(LazyInstrumentedPipeline::Status::NotInstrumented, std::memory_order_release);
+            return;
+        }
+
+        // The application can destroy its shader modules once the pipeline is created, so the stages left as they are still need
+        // a module of their own
+        for (uint32_t stage_state_i = 0; stage_state_i < static_cast<uint32_t>(pipeline_state.stage_states.size());
+             ++stage_state_i) {
+            const auto &stage_state = pipeline_state.stage_states[stage_state_i];
+            const auto &module_state = stage_state.module_state;
+            if (shader_instrumentation_metadata[stage_state_i].IsInstrumented() || !module_state || !module_state->spirv ||
+                module_state->VkHandle() == VK_NULL_HANDLE) {
+                continue;
+            }
+            VkShaderModuleCreateInfo shader_module_ci = vku::InitStructHelper();
+            shader_module_ci.pCode = module_state->spirv->words_.data();
+            shader_module_ci.codeSize = module_state->spirv->words_.size() * sizeof(uint32_t);
+            VkShaderModule shader_module = VK_NULL_HANDLE;
+            if (DispatchCreateShaderModule(device, &shader_module_ci, nullptr, &shader_module) != VK_SUCCESS) {
+                InternalWarning(pipeline_state.VkHandle(), loc,
+                                "Unable to copy a shader module of the pipeline, its instrumented variant was not created.");
+                lazy_pipeline->status.store(LazyInstrumentedPipeline::Status::NotInstrumented, std::memory_order_release);
+                return;
+            }
+            SetShaderModule(modified_pipeline_ci, *stage_state.pipeline_create_info, shader_module, stage_state_i);
+            // 0 is never a unique shader id, so only the module is released with the pipeline
+            pipeline_state.instrumentation_data.instrumented_shader_modules.emplace_back(
+                std::pair<uint32_t, VkShaderModule>{0u, shader_module});
+        }
+
+        VkPipeline instrumented_pipeline = VK_NULL_HANDLE;
+        if (DispatchCreateInstrumentedPipeline(device, modified_pipeline_ci, &instrumented_pipeline) != VK_SUCCESS) {
+            InternalWarning(pipeline_state.VkHandle(), loc,
+                            "Unable to create the instrumented variant of the pipeline, it will not be validated.");
+            lazy_pipeline->status.store(LazyInstrumentedPipeline::Status::NotInstrumented, std::memory_order_release);
+            return;
+        }
+
+        RegisterPipelineInstrumentedShaders(pipeline_state, shader_instrumentation_metadata);
+        lazy_pipeline->instrumented_pipeline = instrumented_pipeline;
+        lazy_pipeline->status.store(LazyInstrumentedPipeline::Status::Ready, std::memory_order_release);
+    });
+}
+
+VkPipeline GpuShaderInstrumentor::GetLazyInstrumentedPipeline(const vvl::Pipeline &pipeline_state) {
+    if (!lazy_instrumentation_queue_) {
+        return VK_NULL_HANDLE;
+    }
+    auto lazy_it = lazy_instrumented_pipelines_.find(pipeline_state.VkHandle());
+    if (lazy_it == lazy_instrumented_pipelines_.end()) {
+        return VK_NULL_HANDLE;
+    }
+    const std::shared_ptr<LazyInstrumentedPipeline> lazy_pipeline = lazy_it->second;
+
+    auto status = lazy_pipeline->status.load(std::memory_order_acquire);
+    if (status == LazyInstrumentedPipeline::Status::Ready) {
+        return lazy_pipeline->instrumented_pipeline;
+    }
+    // Only the first bind starts the build, the commands recorded until the variant is ready are not validated
+    if (status == LazyInstrumentedPipeline::Status::NotStarted &&
+        lazy_pipeline->status.compare_exchange_strong(status, LazyInstrumentedPipeline::Status::Pending)) {
+        auto pipeline_ptr = Get<vvl::Pipeline>(pipeline_state.VkHandle());
+        if (!pipeline_ptr) {
+            return VK_NULL_HANDLE;
+        }
+        if (pipeline_state.GetCreateInfoSType() == VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO) {
+            StartLazyPipelineInstrumentation(pipeline_ptr, pipeline_state.GraphicsCreateInfo(), lazy_pipeline);
+        } else {
+            StartLazyPipelineInstrumentation(pipeline_ptr, pipeline_state.ComputeCreateInfo(), lazy_pipeline);
+        }
+    }
+    return VK_NULL_HANDLE;
 }
 
 // While have an almost duplicated function is not ideal, the core issue is we have a single, templated function designed for
@@ -1244,8 +1646,8 @@ void GpuShaderInstrumentor::PostCallRecordPipelineCreationShaderInstrumentationG
                 shader_module_handle = kPipelineStageInfoHandle;
             }
 
-            instrumented_shaders_map_.insert_or_assign(instrumentation_metadata.unique_shader_id, lib->VkHandle(),
-                                                       shader_module_handle, VK_NULL_HANDLE, std::move(code));
+            AddInstrumentedShader(instrumentation_metadata.unique_shader_id, lib->VkHandle(), shader_module_handle,
+                                  VK_NULL_HANDLE, std::move(code));
         }
     }
 }
@@ -1264,6 +1666,41 @@ static bool GpuValidateShader(const std::vector<uint32_t> &input, bool SetRelaxB
     return (result == SPV_SUCCESS);
 }
 
+// Runs spirv-val on an instrumented shader, on failure both versions of the shader are dumped and |error_message| is set
+static bool ValidateInstrumentedShader(uint32_t unique_shader_id, const vvl::span<const uint32_t> &input_spirv,
+                                       const std::vector<uint32_t> &instrumented_spirv, bool relaxed_block_layout,
+                                       bool scalar_block_layout, spv_target_env target_env, bool input_spirv_dumped,
+                                       std::string &error_message) {
+    std::string spirv_val_error;
+    if (GpuValidateShader(instrumented_spirv, relaxed_block_layout, scalar_block_layout, target_env, spirv_val_error)) {
+        return true;
+    }
+    if (!input_spirv_dumped) {
+        const auto non_instrumented_spirv_file = fs::absolute("dump_" + std::to_string(unique_shader_id) + "_before.spv");
+        DumpSpirvToFile(non_instrumented_spirv_file.string(), input_spirv.data(), input_spirv.size());
+    }
+
+    const auto instrumented_spirv_file = fs::absolute("dump_" + std::to_string(unique_shader_id) + "_after_invalid.spv");
+    DumpSpirvToFile(instrumented_spirv_file.string(), instrumented_spirv.data(), instrumented_spirv.size());
+
+    std::ostringstream strm;
+    const auto invalid_file_path = std::filesystem::absolute(instrumented_spirv_file);
+    strm << "Instrumented shader (id " << unique_shader_id << ") is invalid, spirv-val error:\n"
+         << spirv_val_error << "\nInvalid spirv dumped to " << invalid_file_path;
+    error_message = strm.str();
+    return false;
+}
+
+// Machine readable summary of a shader (following the GPUAV_PASS_STATS line of each pass run on it) to help pick the shaders
+// worth excluding with select_instrumented_shaders
+static void PrintShaderStats(uint32_t unique_shader_id, size_t spirv_words_before, size_t spirv_words_after,
+                             std::chrono::steady_clock::time_point start_time) {
+    const auto elapsed_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time).count();
+    std::cout << "GPUAV_SHADER_STATS shader_id=" << unique_shader_id << " spirv_words_before=" << spirv_words_before
+              << " spirv_words_after=" << spirv_words_after << " time_us=" << elapsed_us << '\n';
+}
+
 // Call the SPIR-V Optimizer to run the instrumentation pass on the shader.
 bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &input_spirv, uint32_t unique_shader_id,
                                              const InstrumentationDescriptorSetLayouts &instrumentation_dsl, const Location &loc,
@@ -1279,12 +1716,25 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
         const auto non_instrumented_spirv_file = fs::absolute("dump_" + std::to_string(unique_shader_id) + "_before.spv");
         DumpSpirvToFile(non_instrumented_spirv_file.string(), input_spirv.data(), input_spirv.size());
     }
-
+    const auto instrumentation_start_time = std::chrono::steady_clock::now();
+
+    // The debug settings want to see the passes run
+    const bool use_cache = instrumented_shader_cache_ && !gpuav_settings.debug_dump_instrumented_shaders &&
+                           !gpuav_settings.debug_print_instrumentation_info;
+    uint64_t cache_key = 0;
+    if (use_cache) {
+        cache_key = GetInstrumentedShaderCacheKey(input_spirv, unique_shader_id, instrumentation_dsl);
+        if (instrumented_shader_cache_->Find(cache_key, out_instrumented_spirv)) {
+            // An empty entry is a shader that needs no instrumentation
+            return !out_instrumented_spirv.empty();
+        }
+    }
     spirv::Settings module_settings(loc);
     // Use the unique_shader_id as a shader ID so we can look up its handle later in the shader_map.
     module_settings.shader_id = unique_shader_id;
     module_settings.output_buffer_descriptor_set = instrumentation_desc_set_bind_index_;
     module_settings.safe_mode = gpuav_settings.safe_mode;
+    module_settings.safe_mode_targeted = gpuav_settings.safe_mode && gpuav_settings.safe_mode_targeted;
     module_settings.print_debug_info = gpuav_settings.debug_print_instrumentation_info;
     module_settings.max_instrumentations_count = gpuav_settings.debug_max_instrumentations_count;
     module_settings.support_non_semantic_info =
@@ -1293,6 +1743,8 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
 
     spirv::Module module(input_spirv, debug_report, module_settings, modified_features,
                          instrumentation_dsl.set_index_to_bindings_layout_lut);
+    // The internal debug printfs are kept on the side, a shader that adds some cannot come from the cache
+    std::vector<spirv::InternalOnlyDebugPrintf> internal_debug_printfs;
 
     bool modified = false;
 
@@ -1303,7 +1755,7 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
         modified |= oob_pass.Run();
 
         // Depending on the DescriptorClass, will add dedicated check
-        if (!modified_features.robustBufferAccess) {
+        if (!modified_features.robustBufferAccess && !instrumentation_dsl.pipeline_robust_buffers) {
             // This check is for catching OOB in a UBO/SSBO which is caught with robustBufferAccess
             spirv::DescriptorClassGeneralBufferPass general_buffer_pass(module);
             modified |= general_buffer_pass.Run();
@@ -1333,7 +1785,7 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
     }
 
     if (gpuav_settings.shader_instrumentation.vertex_attribute_fetch_oob) {
-        if (!modified_features.robustBufferAccess) {
+        if (!modified_features.robustBufferAccess && !instrumentation_dsl.pipeline_robust_vertex_inputs) {
             spirv::VertexAttributeFetchOob pass(module);
             modified |= pass.Run();
         }
@@ -1356,12 +1808,24 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
     // 2. We might want to debug the above passes and want to inject our own debug printf calls
     if (gpuav_settings.debug_printf_enabled) {
         // binding slot allows debug printf to be slotted in the same set as GPU-AV if needed
-        spirv::DebugPrintfPass pass(module, intenral_only_debug_printf_, glsl::kBindingInstDebugPrintf);
+        spirv::DebugPrintfPass pass(module, internal_debug_printfs, glsl::kBindingInstDebugPrintf);
         modified |= pass.Run();
     }
+    if (!internal_debug_printfs.empty()) {
+        std::unique_lock<std::mutex> guard(intenral_only_debug_printf_lock_);
+        intenral_only_debug_printf_.insert(intenral_only_debug_printf_.end(), internal_debug_printfs.begin(),
+                                           internal_debug_printfs.end());
+    }
+
+    if (gpuav_settings.debug_print_instrumentation_info && !modified) {
+        PrintShaderStats(unique_shader_id, input_spirv.size(), input_spirv.size(), instrumentation_start_time);
+    }
 
     // If nothing was instrumented, leave early to save time
     if (!modified) {
+        if (use_cache) {
+            instrumented_shader_cache_->Add(cache_key, {});
+        }
         return false;
     }
 
@@ -1370,37 +1834,144 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
     // translate internal representation of SPIR-V into legal SPIR-V binary
     module.ToBinary(out_instrumented_spirv);
 
-    spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(extensions.vk_khr_spirv_1_4));
+    if (gpuav_settings.debug_print_instrumentation_info) {
+        PrintShaderStats(unique_shader_id, input_spirv.size(), out_instrumented_spirv.size(), instrumentation_start_time);
+    }
+
     // (Maybe) validate the instrumented and linked shader
-    bool is_instrumented_spirv_valid = true;
+    if (gpuav_settings.debug_validate_instrumented_shaders && shader_validation_queue_) {
+        auto pending = std::make_shared<PendingShaderValidation>();
+        pending->unique_shader_id = unique_shader_id;
+        pending->function = loc.function;
+        pending->input_spirv.assign(input_spirv.begin(), input_spirv.end());
+        pending->instrumented_spirv = out_instrumented_spirv;
+        pending->add_to_cache = use_cache && internal_debug_printfs.empty();
+        pending->cache_key = cache_key;
+        {
+            std::unique_lock<std::mutex> guard(pending_shader_validations_lock_);
+            pending_shader_validations_[unique_shader_id] = pending;
+            pending_shader_validation_count_.store(static_cast<uint32_t>(pending_shader_validations_.size()),
+                                                   std::memory_order_release);
+        }
+        shader_validation_queue_->Post([this, pending]() { RunInstrumentedShaderValidation(*pending); });
+        return true;
+    }
     if (gpuav_settings.debug_validate_instrumented_shaders) {
-        std::string spirv_val_error;
-
-        is_instrumented_spirv_valid = GpuValidateShader(out_instrumented_spirv, extensions.vk_khr_relaxed_block_layout,
-                                                        extensions.vk_ext_scalar_block_layout, target_env, spirv_val_error);
-        if (!is_instrumented_spirv_valid) {
-            if (!gpuav_settings.debug_dump_instrumented_shaders) {
-                const auto non_instrumented_spirv_file = fs::absolute("dump_" + std::to_string(unique_shader_id) + "_before.spv");
-                DumpSpirvToFile(non_instrumented_spirv_file.string(), input_spirv.data(), input_spirv.size());
-            }
-
-            const auto instrumented_spirv_file = fs::absolute("dump_" + std::to_string(unique_shader_id) + "_after_invalid.spv");
-            DumpSpirvToFile(instrumented_spirv_file.string(), out_instrumented_spirv.data(), out_instrumented_spirv.size());
-
-            std::ostringstream strm;
-            const auto invalid_file_path = std::filesystem::absolute(instrumented_spirv_file);
-            strm << "Instrumented shader (id " << unique_shader_id << ") is invalid, spirv-val error:\n"
-                 << spirv_val_error << "\nInvalid spirv dumped to " << invalid_file_path
-                 << "\nProceeding with non instrumented shader.";
-            InternalError(device, loc, strm.str().c_str());
+        const spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(extensions.vk_khr_spirv_1_4));
+        std::string error_message;
+        if (!ValidateInstrumentedShader(unique_shader_id, input_spirv, out_instrumented_spirv,
+                                        extensions.vk_khr_relaxed_block_layout, extensions.vk_ext_scalar_block_layout, target_env,
+                                        gpuav_settings.debug_dump_instrumented_shaders, error_message)) {
+            error_message += "\nProceeding with non instrumented shader.";
+            InternalError(device, loc, error_message.c_str());
             return false;
         }
     }
-    if (is_instrumented_spirv_valid && gpuav_settings.debug_dump_instrumented_shaders) {
+    if (gpuav_settings.debug_dump_instrumented_shaders) {
         const auto instrumented_spirv_file = fs::absolute("dump_" + std::to_string(unique_shader_id) + "_after.spv");
         DumpSpirvToFile(instrumented_spirv_file.string(), out_instrumented_spirv.data(), out_instrumented_spirv.size());
     }
 
+    if (use_cache && internal_debug_printfs.empty()) {
+        instrumented_shader_cache_->Add(cache_key, out_instrumented_spirv);
+    }
+    return true;
+}
+
+void GpuShaderInstrumentor::RunInstrumentedShaderValidation(PendingShaderValidation &pending) {
+    std::call_once(pending.once, [this, &pending]() {
+        const spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(extensions.vk_khr_spirv_1_4));
+        pending.valid = ValidateInstrumentedShader(pending.unique_shader_id, pending.input_spirv, pending.instrumented_spirv,
+                                                   extensions.vk_khr_relaxed_block_layout, extensions.vk_ext_scalar_block_layout,
+                                                   target_env, gpuav_settings.debug_dump_instrumented_shaders,
+                                                   pending.error_message);
+        if (pending.valid && pending.add_to_cache) {
+            instrumented_shader_cache_->Add(pending.cache_key, pending.instrumented_spirv);
+        }
+        if (!pending.valid && !gpuav_settings.debug_validate_instrumented_shaders_wait) {
+            LogInstrumentedShaderValidationError(pending);
+        }
+        pending.input_spirv = {};
+        pending.instrumented_spirv = {};
+    });
+
+    if (!pending.valid && gpuav_settings.debug_validate_instrumented_shaders_wait) {
+        return;
+    }
+    std::unique_lock<std::mutex> guard(pending_shader_validations_lock_);
+    auto it = pending_shader_validations_.find(pending.unique_shader_id);
+    if (it != pending_shader_validations_.end() && it->second.get() == &pending) {
+        pending_shader_validations_.erase(it);
+        pending_shader_validation_count_.store(static_cast<uint32_t>(pending_shader_validations_.size()),
+                                               std::memory_order_release);
+    }
+}
+
+void GpuShaderInstrumentor::LogInstrumentedShaderValidationError(const PendingShaderValidation &pending) const {
+    // Unlike InternalError() this can be called from a worker, GPU-AV stays enabled as the shader is already in use
+    char const *vuid = gpuav_settings.debug_printf_only ? "UNASSIGNED-DEBUG-PRINTF" : "UNASSIGNED-GPU-Assisted-Validation";
+    LogError(vuid, device, Location(pending.function), "Internal Error, %s\nThe instrumented shader is already in use.",
+             pending.error_message.c_str());
+}
+
+bool GpuShaderInstrumentor::WaitForInstrumentedShaderValidation(const LastBound &last_bound, const Location &loc) {
+    if (!gpuav_settings.debug_validate_instrumented_shaders_wait ||
+        pending_shader_validation_count_.load(std::memory_order_acquire) == 0) {
+        return true;
+    }
+    // The instrumented shaders are registered with the pipeline (or the libraries it was linked from) or the shader object
+    small_vector<VkPipeline, 4> pipelines;
+    small_vector<VkShaderEXT, kShaderObjectStageCount> shader_objects;
+    if (last_bound.pipeline_state) {
+        pipelines.emplace_back(last_bound.pipeline_state->VkHandle());
+        if (const auto *library_info = last_bound.pipeline_state->library_create_info) {
+            pipelines.insert(pipelines.end(), library_info->pLibraries, library_info->pLibraries + library_info->libraryCount);
+        }
+    } else {
+        for (uint32_t i = 0; i < kShaderObjectStageCount; ++i) {
+            const auto stage = static_cast<ShaderObjectStage>(i);
+            if (last_bound.IsValidShaderBound(stage)) {
+                shader_objects.emplace_back(last_bound.GetShader(stage));
+            }
+        }
+    }
+
+    std::vector<std::shared_ptr<PendingShaderValidation>> used;
+    {
+        std::unique_lock<std::mutex> guard(pending_shader_validations_lock_);
+        for (const auto &[unique_shader_id, pending] : pending_shader_validations_) {
+            auto it = instrumented_shaders_map_.find(unique_shader_id);
+            if (it == instrumented_shaders_map_.end()) {
+                continue;  // the pipeline creation using it is not done, it can not be bound yet
+            }
+            const InstrumentedShader &instrumented_shader = it->second;
+            const bool is_used =
+                (instrumented_shader.pipeline != VK_NULL_HANDLE &&
+                 std::find(pipelines.begin(), pipelines.end(), instrumented_shader.pipeline) != pipelines.end()) ||
+                (instrumented_shader.shader_object != VK_NULL_HANDLE &&
+                 std::find(shader_objects.begin(), shader_objects.end(), instrumented_shader.shader_object) !=
+                     shader_objects.end());
+            if (is_used) {
+                used.emplace_back(pending);
+            }
+        }
+    }
+
+    for (const auto &pending : used) {
+        // Runs it here if no worker started it yet, otherwise waits for the worker
+        RunInstrumentedShaderValidation(*pending);
+        if (pending->valid) {
+            continue;
+        }
+        {
+            std::unique_lock<std::mutex> guard(pending_shader_validations_lock_);
+            pending_shader_validations_.erase(pending->unique_shader_id);
+            pending_shader_validation_count_.store(static_cast<uint32_t>(pending_shader_validations_.size()),
+                                                   std::memory_order_release);
+        }
+        InternalError(device, loc, pending->error_message.c_str());
+        return false;
+    }
     return true;
 }
 
@@ -1529,10 +2100,14 @@ static void GenerateStageMessage(std::ostringstream &ss, const GpuShaderInstrume
 // 1. The "old" way using OpLine/OpSource
 // 2. The "new" way using NonSemantic Shader DebugInfo
 static std::string FindShaderSource(std::ostringstream &ss, const std::vector<uint32_t> &instructions,
-                                    uint32_t instruction_position, bool debug_printf_only) {
+                                    const ::spirv::DebugLineIndex &debug_line_index, uint32_t instruction_position,
+                                    bool debug_printf_only) {
     ss << "SPIR-V Instruction Index = " << instruction_position << '\n';
+    if (const char *function_name = debug_line_index.GetFunctionName(instruction_position)) {
+        ss << "SPIR-V Function = " << function_name << '\n';
+    }
 
-    const uint32_t last_line_inst_offset = ::spirv::GetDebugLineOffset(instructions, instruction_position);
+    const uint32_t last_line_inst_offset = debug_line_index.GetDebugLineOffset(instruction_position);
     if (last_line_inst_offset != 0) {
         Instruction last_line_inst(instructions.data() + last_line_inst_offset);
         ss << (debug_printf_only ? "Debug shader printf message generated at " : "Shader validation error occurred at ");
@@ -1550,12 +2125,14 @@ std::string GpuShaderInstrumentor::GenerateDebugInfoMessage(VkCommandBuffer comm
                                                             VkPipelineBindPoint pipeline_bind_point,
                                                             uint32_t operation_index) const {
     std::ostringstream ss;
-    if (!instrumented_shader || instrumented_shader->original_spirv.empty()) {
+    if (!instrumented_shader || !instrumented_shader->HasOriginalSpirv()) {
         ss << "[Internal Error] - Can't get instructions from shader_map\n";
         return ss.str();
     }
 
-    GenerateStageMessage(ss, shader_info, instrumented_shader->original_spirv);
+    std::vector<uint32_t> decompressed_spirv;
+    const std::vector<uint32_t> &original_spirv = instrumented_shader->GetOriginalSpirv(decompressed_spirv);
+    GenerateStageMessage(ss, shader_info, original_spirv);
 
     ss << std::hex << std::showbase;
     if (instrumented_shader->shader_module == VK_NULL_HANDLE && instrumented_shader->shader_object == VK_NULL_HANDLE) {
@@ -1603,7 +2180,8 @@ std::string GpuShaderInstrumentor::GenerateDebugInfoMessage(VkCommandBuffer comm
     }
     ss << std::dec << std::noshowbase;
 
-    FindShaderSource(ss, instrumented_shader->original_spirv, shader_info.instruction_position, gpuav_settings.debug_printf_only);
+    FindShaderSource(ss, original_spirv, instrumented_shader->GetDebugLineIndex(original_spirv), shader_info.instruction_position,
+                     gpuav_settings.debug_printf_only);
 
     return ss.str();
 }
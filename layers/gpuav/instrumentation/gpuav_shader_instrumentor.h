@@ -17,11 +17,17 @@
 #pragma once
 
 #include "error_message/error_location.h"
+#include "error_message/spirv_logging.h"
 #include "state_tracker/shader_instruction.h"
 #include "state_tracker/state_tracker.h"
 #include "gpuav/spirv/interface.h"
 #include "containers/custom_containers.h"
+#include "utils/task_pool.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 
 // There is a spirv::Instruction used for normal validation.
@@ -33,6 +39,7 @@ using Instruction = ::spirv::Instruction;
 namespace vvl {
 struct LabelCommand;
 }
+struct LastBound;
 
 namespace chassis {
 struct ShaderInstrumentationMetadata;
@@ -41,6 +48,10 @@ struct ShaderObjectInstrumentationData;
 
 namespace gpuav {
 class Validator;
+class InstrumentedShaderCache;
+namespace debug_printf {
+struct DecodingPlan;
+}  // namespace debug_printf
 
 // There are 3 ways to have a null VkShaderModule
 // 1. Use GPL for something like Vertex Input which won't have a shader
@@ -58,8 +69,43 @@ struct InstrumentedShader {
     VkPipeline pipeline;
     VkShaderModule shader_module;
     VkShaderEXT shader_object;
-    // We keep the original SPIR-V so we can match up where the error occured to map to shader source files
+    // We keep the original SPIR-V so we can match up where the error occured to map to shader source files.
+    // With gpuav_compress_original_spirv only compressed_spirv is kept, use GetOriginalSpirv()
     std::vector<uint32_t> original_spirv;
+    std::vector<uint8_t> compressed_spirv;
+
+    bool HasOriginalSpirv() const { return !original_spirv.empty() || !compressed_spirv.empty(); }
+    // Returns original_spirv, or |storage| filled with the decompressed words
+    const std::vector<uint32_t> &GetOriginalSpirv(std::vector<uint32_t> &storage) const;
+    size_t SpirvBytes() const { return original_spirv.size() * sizeof(uint32_t) + compressed_spirv.size(); }
+
+    // Built from |original_spirv| the first time an error of this shader is reported, then reused by the next ones
+    const ::spirv::DebugLineIndex &GetDebugLineIndex(const std::vector<uint32_t> &original_spirv) const;
+
+    struct LazyDebugLineIndex {
+        std::once_flag once;
+        std::unique_ptr<::spirv::DebugLineIndex> index;
+    };
+    std::shared_ptr<LazyDebugLineIndex> debug_line_index = std::make_shared<LazyDebugLineIndex>();
+
+    // Decoding plans of the debug printf format strings of this shader by OpString id, filled as their messages are read back
+    struct DebugPrintfPlans {
+        std::mutex lock;
+        vvl::unordered_map<uint32_t, std::shared_ptr<const debug_printf::DecodingPlan>> string_id_to_plan;
+    };
+    std::shared_ptr<DebugPrintfPlans> debug_printf_plans = std::make_shared<DebugPrintfPlans>();
+};
+
+// With gpuav_lazy_instrumentation, graphics and compute pipelines are created with the application shaders. The first time one
+// is bound, its instrumented variant is built in the background, and it is bound over the application pipeline once ready.
+struct LazyInstrumentedPipeline {
+    enum class Status { NotStarted, Pending, Ready, NotInstrumented };
+    std::atomic<Status> status{Status::NotStarted};
+    // Held while the variant is built, destroying the pipeline waits for it
+    std::mutex lock;
+    bool destroyed = false;
+    // Valid once the status is Ready
+    VkPipeline instrumented_pipeline = VK_NULL_HANDLE;
 };
 
 // Historically this was an common interface to both GPU-AV and DebugPrintf before the were merged together.
@@ -70,8 +116,8 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
     using BaseClass = vvl::DeviceProxy;
 
   public:
-    GpuShaderInstrumentor(vvl::dispatch::Device *dev, vvl::InstanceProxy *instance, LayerObjectTypeId type)
-        : BaseClass(dev, instance, type) {}
+    GpuShaderInstrumentor(vvl::dispatch::Device *dev, vvl::InstanceProxy *instance, LayerObjectTypeId type);
+    ~GpuShaderInstrumentor();
 
     ReadLockGuard ReadLock() const override;
     WriteLockGuard WriteLock() override;
@@ -79,6 +125,7 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
     void FinishDeviceSetup(const VkDeviceCreateInfo *pCreateInfo, const Location &loc) override;
     void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
                                     const RecordObject &record_obj) override;
+    void UpdateMemoryAccounting() const override;
 
     bool ValidateCmdWaitEvents(VkCommandBuffer command_buffer, VkPipelineStageFlags2 src_stage_mask, const Location &loc) const;
     bool PreCallValidateCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
@@ -153,6 +200,14 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
 
     bool IsSelectiveInstrumentationEnabled(const void *pNext);
 
+    // Returns the instrumented variant to bind over a pipeline created with gpuav_lazy_instrumentation. Returns VK_NULL_HANDLE
+    // while the variant is not ready, the first call starts building it.
+    VkPipeline GetLazyInstrumentedPipeline(const vvl::Pipeline &pipeline_state);
+
+    // With gpuav_debug_validate_instrumented_shaders_wait, waits for spirv-val of the instrumented shaders the command uses if a
+    // worker did not get to them yet. Returns false if one is invalid, GPU-AV is disabled then.
+    bool WaitForInstrumentedShaderValidation(const LastBound &last_bound, const Location &loc);
+
     struct ShaderMessageInfo {
         uint32_t stage_id;
         uint32_t stage_info_0;
@@ -175,6 +230,10 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
     // to the SPIR-V Instrumentation, and afterwards we don't need to save it.
     struct InstrumentationDescriptorSetLayouts {
         bool has_bindless_descriptors = false;
+        // Set when VkPipelineRobustnessCreateInfo makes the pipeline robust even if the device features are not,
+        // letting the passes covered by robustness be skipped for this pipeline only
+        bool pipeline_robust_buffers = false;
+        bool pipeline_robust_vertex_inputs = false;
         // < set , [ bindings ] >
         std::vector<std::vector<spirv::BindingLayout>> set_index_to_bindings_layout_lut;
     };
@@ -185,12 +244,47 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
     void BuildDescriptorSetLayoutInfo(const vvl::DescriptorSetLayout &set_layout_state, const uint32_t set_layout_index,
                                       InstrumentationDescriptorSetLayouts &out_instrumentation_dsl);
 
+    // A shader of a vkCreate*Pipelines call that was selected for instrumentation
+    struct ShaderInstrumentationJob {
+        uint32_t pipeline_index;
+        uint32_t stage_state_index;
+        uint32_t unique_shader_id;
+        vvl::span<const uint32_t> input_spirv;
+        // Non-null if the SPIR-V is inlined in VkPipelineShaderStageCreateInfo::pNext
+        vku::safe_VkShaderModuleCreateInfo *modified_shader_module_ci;
+        Location loc;
+        std::vector<uint32_t> instrumented_spirv;
+        bool is_instrumented = false;
+    };
+    // The shaders of all the pipelines of a call are selected first, then instrumented together on instrumentation_pool_, and
+    // only then are the instrumented shaders put in the create infos.
+    struct PipelineInstrumentationBatch {
+        // One per create info, read by the jobs of its pipeline
+        std::vector<InstrumentationDescriptorSetLayouts> instrumentation_dsls;
+        std::vector<ShaderInstrumentationJob> jobs;
+    };
+
+    template <typename SafeCreateInfo>
+    void PreCallRecordPipelineCreationShaderInstrumentation(
+        vvl::Pipeline &pipeline_state, uint32_t pipeline_index, SafeCreateInfo &modified_pipeline_ci, const Location &loc,
+        std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata, PipelineInstrumentationBatch &batch);
+    void InstrumentPipelineShaders(PipelineInstrumentationBatch &batch);
     template <typename SafeCreateInfo>
-    [[nodiscard]] bool PreCallRecordPipelineCreationShaderInstrumentation(
-        const VkAllocationCallbacks *pAllocator, vvl::Pipeline &pipeline_state, SafeCreateInfo &modified_pipeline_ci,
-        const Location &loc, std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata);
+    [[nodiscard]] bool ApplyPipelineShaderInstrumentation(
+        const VkAllocationCallbacks *pAllocator, const PipelineStates &pipeline_states,
+        std::vector<SafeCreateInfo> &modified_pipeline_cis,
+        std::vector<std::vector<chassis::ShaderInstrumentationMetadata>> &shader_instrumentations_metadata,
+        PipelineInstrumentationBatch &batch);
     void PostCallRecordPipelineCreationShaderInstrumentation(
         vvl::Pipeline &pipeline_state, std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata);
+    // Returns if any shader of the pipeline was instrumented
+    bool RegisterPipelineInstrumentedShaders(const vvl::Pipeline &pipeline_state,
+                                             std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata);
+
+    bool CanInstrumentPipelineLazily(const vvl::Pipeline &pipeline_state) const;
+    template <typename SafeCreateInfo>
+    void StartLazyPipelineInstrumentation(const std::shared_ptr<vvl::Pipeline> &pipeline_state, const SafeCreateInfo &create_info,
+                                          const std::shared_ptr<LazyInstrumentedPipeline> &lazy_pipeline);
 
     // We have GPL variations for graphics as they defer instrumentation until linking
     [[nodiscard]] bool PreCallRecordPipelineCreationShaderInstrumentationGPL(
@@ -206,6 +300,8 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
     bool InstrumentShader(const vvl::span<const uint32_t> &input_spirv, uint32_t unique_shader_id,
                           const InstrumentationDescriptorSetLayouts &instrumentation_dsl, const Location &loc,
                           std::vector<uint32_t> &out_instrumented_spirv);
+    uint64_t GetInstrumentedShaderCacheKey(const vvl::span<const uint32_t> &input_spirv, uint32_t unique_shader_id,
+                                           const InstrumentationDescriptorSetLayouts &instrumentation_dsl) const;
 
   public:
     VkDescriptorSetLayout GetInstrumentationDescriptorSetLayout() { return instrumentation_desc_layout_; }
@@ -225,7 +321,9 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
     vvl::concurrent_unordered_map<uint32_t, InstrumentedShader> instrumented_shaders_map_;
     std::vector<VkDescriptorSetLayoutBinding> instrumentation_bindings_;
 
+    // Shaders are instrumented on several threads, guarded by intenral_only_debug_printf_lock_
     std::vector<spirv::InternalOnlyDebugPrintf> intenral_only_debug_printf_;
+    mutable std::mutex intenral_only_debug_printf_lock_;
 
     // These are the same as enabled_features, but may have been altered at setup time. This should be use for any feature GPU-AV
     // might force on. We need to track these changes separately so that they don't influence non-GPU-AV parts of validation.
@@ -237,6 +335,51 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
     bool IsShaderSelectedForInstrumentation(vku::safe_VkShaderModuleCreateInfo *modified_shader_module_ci,
                                             VkShaderModule modified_shader, const Location &loc);
     void Cleanup();
+    void CreateInstrumentedShaderCache();
+
+    // Every insert and removal of instrumented_shaders_map_ goes through these, to keep instrumented_spirv_bytes_ up to date
+    void AddInstrumentedShader(uint32_t unique_shader_id, VkPipeline pipeline, VkShaderModule shader_module,
+                               VkShaderEXT shader_object, std::vector<uint32_t> &&original_spirv);
+    void RemoveInstrumentedShader(uint32_t unique_shader_id);
+    std::atomic<uint64_t> instrumented_spirv_bytes_{0};
+
+    // Runs the instrumentation passes of the shaders of a vkCreate*Pipelines call
+    vvl::TaskPool instrumentation_pool_;
+
+    vvl::concurrent_unordered_map<VkPipeline, std::shared_ptr<LazyInstrumentedPipeline>> lazy_instrumented_pipelines_;
+    // Null unless gpuav_lazy_instrumentation is set
+    std::unique_ptr<vvl::JobQueue> lazy_instrumentation_queue_;
+
+    // With gpuav_debug_validate_instrumented_shaders_async, spirv-val of the instrumented shaders runs on
+    // shader_validation_queue_ instead of delaying the pipeline creation. The shader is used before it is validated.
+    struct PendingShaderValidation {
+        uint32_t unique_shader_id = 0;
+        vvl::Func function = vvl::Func::Empty;
+        // Only kept to dump it if the instrumented shader is invalid
+        std::vector<uint32_t> input_spirv;
+        std::vector<uint32_t> instrumented_spirv;
+        // The shader only goes in the instrumented shader cache once it is known to be valid
+        bool add_to_cache = false;
+        uint64_t cache_key = 0;
+        std::once_flag once;
+        bool valid = true;
+        std::string error_message;
+    };
+    void RunInstrumentedShaderValidation(PendingShaderValidation &pending);
+    void LogInstrumentedShaderValidationError(const PendingShaderValidation &pending) const;
+    std::unique_ptr<vvl::JobQueue> shader_validation_queue_;
+    // The valid shaders are removed once validated. With gpuav_debug_validate_instrumented_shaders_wait the invalid ones are kept
+    // for the first command using them to report.
+    vvl::unordered_map<uint32_t, std::shared_ptr<PendingShaderValidation>> pending_shader_validations_;
+    std::mutex pending_shader_validations_lock_;
+    // Size of pending_shader_validations_, every command reads it without locking
+    std::atomic<uint32_t> pending_shader_validation_count_{0};
+
+    // Null unless gpuav_cache_instrumented_shaders is set
+    std::unique_ptr<InstrumentedShaderCache> instrumented_shader_cache_;
+    // Hash of the device state the instrumentation depends on, part of every cache key
+    uint64_t instrumented_shader_cache_device_hash_ = 0;
+
     // These are objects used to inject our descriptor set into the command buffer
     VkDescriptorSetLayout instrumentation_desc_layout_ = VK_NULL_HANDLE;
     VkPipelineLayout instrumentation_pipeline_layout_ = VK_NULL_HANDLE;
@@ -22,6 +22,7 @@
 #include "state_tracker/pipeline_state.h"
 #include "state_tracker/shader_module.h"
 #include "state_tracker/shader_object_state.h"
+#include "utils/math_utils.h"
 
 #include "profiling/profiling.h"
 
@@ -190,14 +191,27 @@ void RegisterPostProcessingValidation(Validator& gpuav, CommandBufferSubState& c
                 const std::vector<gpuav::spirv::BindingLayout>& binding_layouts = SubState(*desc_set).GetBindingLayouts();
                 for (uint32_t binding = 0; binding < binding_layouts.size(); binding++) {
                     const gpuav::spirv::BindingLayout& binding_layout = binding_layouts[binding];
-                    for (uint32_t descriptor_i = 0; descriptor_i < binding_layout.count; descriptor_i++) {
-                        const glsl::PostProcessDescriptorIndexSlot slot = slot_ptr[binding_layout.start + descriptor_i];
-                        if (slot.meta_data & glsl::kPostProcessMetaMaskAccessed) {
+                    // Large bindless arrays are mostly made of descriptors that were never accessed, so first build a mask of
+                    // the accessed slots of each group of 32 (branchless, so the compiler can vectorize it) and then only
+                    // visit the bits that are set.
+                    for (uint32_t group_start = 0; group_start < binding_layout.count; group_start += 32) {
+                        const uint32_t group_count = std::min(32u, binding_layout.count - group_start);
+                        const glsl::PostProcessDescriptorIndexSlot* group_slots = slot_ptr + binding_layout.start + group_start;
+                        uint32_t accessed_mask = 0;
+                        for (uint32_t i = 0; i < group_count; i++) {
+                            accessed_mask |= uint32_t((group_slots[i].meta_data & glsl::kPostProcessMetaMaskAccessed) != 0) << i;
+                        }
+
+                        while (accessed_mask != 0) {
+                            const uint32_t i = static_cast<uint32_t>(LeastSignificantBit(accessed_mask));
+                            accessed_mask &= accessed_mask - 1;
+
+                            const glsl::PostProcessDescriptorIndexSlot slot = group_slots[i];
                             const uint32_t shader_id = slot.meta_data & glsl::kShaderIdMask;
                             const uint32_t action_index =
                                 (slot.meta_data & glsl::kPostProcessMetaMaskActionIndex) >> glsl::kPostProcessMetaShiftActionIndex;
                             descriptor_access_map[shader_id].emplace_back(
-                                DescriptorAccess{binding, descriptor_i, slot.variable_id, action_index});
+                                DescriptorAccess{binding, group_start + i, slot.variable_id, action_index});
                         }
                     }
                 }
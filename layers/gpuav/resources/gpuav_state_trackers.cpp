@@ -28,6 +28,8 @@
 
 #include "profiling/profiling.h"
 
+#include <algorithm>
+
 namespace gpuav {
 
 CommandBufferSubState::CommandBufferSubState(Validator &gpuav, vvl::CommandBuffer &cb)
@@ -39,22 +41,6 @@ CommandBufferSubState::CommandBufferSubState(Validator &gpuav, vvl::CommandBuffe
 CommandBufferSubState::~CommandBufferSubState() {}
 
 void CommandBufferSubState::AllocateResources(const Location &loc) {
-    VkResult result = VK_SUCCESS;
-
-    // Instrumentation descriptor set layout
-    if (instrumentation_desc_set_layout_ == VK_NULL_HANDLE) {
-        assert(!gpuav_.instrumentation_bindings_.empty());
-        VkDescriptorSetLayoutCreateInfo instrumentation_desc_set_layout_ci = vku::InitStructHelper();
-        instrumentation_desc_set_layout_ci.bindingCount = static_cast<uint32_t>(gpuav_.instrumentation_bindings_.size());
-        instrumentation_desc_set_layout_ci.pBindings = gpuav_.instrumentation_bindings_.data();
-        result = DispatchCreateDescriptorSetLayout(gpuav_.device, &instrumentation_desc_set_layout_ci, nullptr,
-                                                   &instrumentation_desc_set_layout_);
-        if (result != VK_SUCCESS) {
-            gpuav_.InternalError(gpuav_.device, loc, "Unable to create instrumentation descriptor set layout.");
-            return;
-        }
-    }
-
     // Error output buffer
     {
         error_output_buffer_range_ = gpu_resources_manager.GetHostVisibleBufferRange(glsl::kErrorBufferByteSize);
@@ -88,6 +74,12 @@ void CommandBufferSubState::AllocateResources(const Location &loc) {
     }
 }
 
+VkDescriptorSetLayout CommandBufferSubState::GetInstrumentationDescriptorSetLayout() const {
+    const VkDescriptorSetLayout instrumentation_desc_set_layout = gpuav_.GetInstrumentationDescriptorSetLayout();
+    assert(instrumentation_desc_set_layout != VK_NULL_HANDLE);
+    return instrumentation_desc_set_layout;
+}
+
 // Common logic after any draw/dispatch/traceRays
 void CommandBufferSubState::RecordActionCommand(LastBound &last_bound, const Location &loc) {
     if (max_actions_cmd_validation_reached_) {
@@ -151,6 +143,18 @@ void CommandBufferSubState::RecordEndRenderPass(const VkSubpassEndInfo *, const
     valcmd::FlushValidationCmds(gpuav_, *this);
 }
 
+// Called after the application pipeline was bound, so the instrumented variant is bound over it
+void CommandBufferSubState::RecordBindPipeline(VkPipelineBindPoint bind_point, vvl::Pipeline &pipeline) {
+    if (!gpuav_.gpuav_settings.lazy_instrumentation) {
+        return;
+    }
+    const VkPipeline instrumented_pipeline = gpuav_.GetLazyInstrumentedPipeline(pipeline);
+    lazy_instrumented_pipelines[ConvertToVvlBindPoint(bind_point)] = instrumented_pipeline;
+    if (instrumented_pipeline != VK_NULL_HANDLE) {
+        DispatchCmdBindPipeline(VkHandle(), bind_point, instrumented_pipeline);
+    }
+}
+
 void CommandBufferSubState::ResetCBState(bool should_destroy) {
     // Free or return to cache GPU resources
 
@@ -169,11 +173,6 @@ void CommandBufferSubState::ResetCBState(bool should_destroy) {
     }
     per_command_error_loggers.clear();
 
-    if (should_destroy && instrumentation_desc_set_layout_ != VK_NULL_HANDLE) {
-        DispatchDestroyDescriptorSetLayout(gpuav_.device, instrumentation_desc_set_layout_, nullptr);
-        instrumentation_desc_set_layout_ = VK_NULL_HANDLE;
-    }
-
     if (should_destroy) {
         error_output_buffer_range_ = {};
         cmd_errors_counts_buffer_.Destroy();
@@ -183,6 +182,10 @@ void CommandBufferSubState::ResetCBState(bool should_destroy) {
     compute_index = 0;
     trace_rays_index = 0;
     action_command_count = 0;
+    lazy_instrumented_pipelines.fill(VK_NULL_HANDLE);
+    last_instrumentation_desc_set = VK_NULL_HANDLE;
+    last_instrumentation_desc_set_writes.clear();
+    last_vertex_attribute_fetch_limits_buffer_range = {};
 
     ClearPushConstants();
 }
@@ -208,7 +211,7 @@ void CommandBufferSubState::IncrementCommandCount(VkPipelineBindPoint bind_point
 }
 
 std::string CommandBufferSubState::GetDebugLabelRegion(uint32_t label_command_i,
-                                                       const std::vector<std::string> &initial_label_stack) const {
+                                                       const vvl::LabelStack &initial_label_stack) const {
     std::string debug_region_name;
     if (label_command_i != vvl::kU32Max) {
         debug_region_name = base.GetDebugRegionName(base.GetLabelCommands(), label_command_i, initial_label_stack);
@@ -217,12 +220,7 @@ std::string CommandBufferSubState::GetDebugLabelRegion(uint32_t label_command_i,
         // no debug label region was yet opened in the corresponding command buffer,
         // but still a region might have been started in another previously submitted
         // command buffer. So just compute region name from initial_label_stack.
-        for (const std::string &label_name : initial_label_stack) {
-            if (!debug_region_name.empty()) {
-                debug_region_name += "::";
-            }
-            debug_region_name += label_name;
-        }
+        debug_region_name = initial_label_stack.GetRegionName();
     }
     return debug_region_name;
 }
@@ -244,8 +242,11 @@ bool CommandBufferSubState::PreSubmit(QueueSubState &queue, const Location &loc)
         VkCommandBufferBeginInfo cb_bi = vku::InitStructHelper();
         cb_bi.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
         DispatchBeginCommandBuffer(per_pre_submission_cb, &cb_bi);
-        for (auto &pre_submission_func : on_pre_cb_submission_functions) {
-            pre_submission_func(gpuav_, *this, per_pre_submission_cb);
+        {
+            VVL_TracyVkZone(GetTracyVkCtx(), per_pre_submission_cb, "gpuav_pre_submission_uploads");
+            for (auto &pre_submission_func : on_pre_cb_submission_functions) {
+                pre_submission_func(gpuav_, *this, per_pre_submission_cb);
+            }
         }
         DispatchEndCommandBuffer(per_pre_submission_cb);
 
@@ -274,8 +275,11 @@ bool CommandBufferSubState::PostSubmit(QueueSubState &queue, const Location &loc
         VkCommandBufferBeginInfo cb_bi = vku::InitStructHelper();
         cb_bi.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
         DispatchBeginCommandBuffer(per_post_submission_cb, &cb_bi);
-        for (auto &post_submission_func : on_post_cb_submission_functions) {
-            post_submission_func(gpuav_, *this, per_post_submission_cb);
+        {
+            VVL_TracyVkZone(GetTracyVkCtx(), per_post_submission_cb, "gpuav_post_submission_readbacks");
+            for (auto &post_submission_func : on_post_cb_submission_functions) {
+                post_submission_func(gpuav_, *this, per_post_submission_cb);
+            }
         }
         DispatchEndCommandBuffer(per_post_submission_cb);
 
@@ -297,7 +301,7 @@ bool CommandBufferSubState::PostSubmit(QueueSubState &queue, const Location &loc
 bool CommandBufferSubState::NeedsPostProcess() { return error_output_buffer_range_.buffer != VK_NULL_HANDLE; }
 
 // For the given command buffer, map its debug data buffers and read their contents for analysis.
-void CommandBufferSubState::OnCompletion(VkQueue queue, const std::vector<std::string> &initial_label_stack, const Location &loc) {
+void CommandBufferSubState::OnCompletion(VkQueue queue, const vvl::LabelStack &initial_label_stack, const Location &loc) {
     VVL_ZoneScoped;
 
     // CommandBuffer::Destroy can happen on an other thread,
@@ -307,8 +311,13 @@ void CommandBufferSubState::OnCompletion(VkQueue queue, const std::vector<std::s
         return;
     }
 
+    // The shaders only increment a command errors count right before reserving room for an error record. So when no error was
+    // written, the errors counts are all still zero and both buffers are reused as they are, without being cleared.
+    bool errors_written = false;
     {
         auto error_output_buffer_ptr = (uint32_t *)error_output_buffer_range_.offset_mapped_ptr;
+        // No-op unless the buffer landed in host cached, non coherent memory
+        gpu_resources_manager.InvalidateAllocation(error_output_buffer_range_);
 
         // The second word in the debug output buffer is the number of words that would have
         // been written by the shader instrumentation, if there was enough room in the buffer we provided.
@@ -319,6 +328,7 @@ void CommandBufferSubState::OnCompletion(VkQueue queue, const std::vector<std::s
 
         // A zero here means that the shader instrumentation didn't write anything.
         if (total_words != 0) {
+            errors_written = true;
             uint32_t *const error_records_start = &error_output_buffer_ptr[cst::stream_output_data_offset];
             assert(glsl::kErrorBufferByteSize > cst::stream_output_data_offset);
             uint32_t *const error_records_end =
@@ -342,15 +352,21 @@ void CommandBufferSubState::OnCompletion(VkQueue queue, const std::vector<std::s
 
             VVL_TracyPlot("GPU-AV errors count", int64_t(total_words / glsl::kErrorRecordSize));
 
-            // Clear the written size and any error messages. Note that this preserves the first word, which contains flags.
+            // Clear the written size and the error messages that were written, the rest of the buffer was never touched. Note that
+            // this preserves the first word, which contains flags.
             assert(glsl::kErrorBufferByteSize > cst::stream_output_data_offset);
-            memset(&error_output_buffer_ptr[cst::stream_output_flags_offset + 1], 0,
-                   size_t(error_output_buffer_range_.size) - sizeof(uint32_t));
+            const size_t records_byte_size =
+                std::min(size_t(total_words) * sizeof(uint32_t),
+                         size_t(error_output_buffer_range_.size) - cst::stream_output_data_offset * sizeof(uint32_t));
+            memset(error_records_start, 0, records_byte_size);
+            error_output_buffer_ptr[cst::stream_output_size_offset] = 0;
+            gpu_resources_manager.FlushAllocation(error_output_buffer_range_);
         }
-        error_output_buffer_ptr[cst::stream_output_size_offset] = 0;
     }
 
-    cmd_errors_counts_buffer_.Clear();
+    if (errors_written) {
+        cmd_errors_counts_buffer_.Clear();
+    }
     if (gpuav_.aborted_) {
         return;
     }
@@ -461,7 +477,7 @@ void QueueSubState::SubmitBarrier(const Location &loc, uint64_t seq) {
     }
 }
 
-void QueueSubState::PreSubmit(std::vector<vvl::QueueSubmission> &submissions) {
+void QueueSubState::PreSubmit(vvl::span<vvl::QueueSubmission> submissions) {
     bool success = true;
     for (const auto &submission : submissions) {
         auto loc = submission.loc.Get();
@@ -42,7 +42,7 @@ class QueueSubState;
 class CommandBufferSubState : public vvl::CommandBufferSubState {
   public:
     struct LabelLogging {
-        const std::vector<std::string> &initial_label_stack;
+        const vvl::LabelStack &initial_label_stack;
         const vvl::unordered_map<uint32_t, uint32_t> &action_cmd_i_to_label_cmd_i_map;
     };
 
@@ -76,18 +76,24 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
 
     std::vector<PushConstantData> push_constant_data_chunks;
     std::array<VkPipelineLayout, vvl::BindPointCount> push_constant_latest_used_layout{};
+    // Instrumented variants bound over the application pipelines (gpuav_lazy_instrumentation)
+    std::array<VkPipeline, vvl::BindPointCount> lazy_instrumented_pipelines{};
+    // Last instrumentation descriptor set written, with the buffer bound at each of its bindings
+    VkDescriptorSet last_instrumentation_desc_set = VK_NULL_HANDLE;
+    vko::BufferDescriptorWrites last_instrumentation_desc_set_writes;
+    // Vertex attribute fetch limits last uploaded for an indexed draw, and the buffer range holding them
+    std::array<uint32_t, 4> last_vertex_attribute_fetch_limits{};
+    vko::BufferRange last_vertex_attribute_fetch_limits_buffer_range{};
 
     CommandBufferSubState(Validator &gpuav, vvl::CommandBuffer &cb);
     ~CommandBufferSubState();
 
     [[nodiscard]] bool PreSubmit(QueueSubState &queue, const Location &loc);
     [[nodiscard]] bool PostSubmit(QueueSubState &queue, const Location &loc);
-    void OnCompletion(VkQueue queue, const std::vector<std::string> &initial_label_stack, const Location &loc);
+    void OnCompletion(VkQueue queue, const vvl::LabelStack &initial_label_stack, const Location &loc);
 
-    const VkDescriptorSetLayout &GetInstrumentationDescriptorSetLayout() const {
-        assert(instrumentation_desc_set_layout_ != VK_NULL_HANDLE);
-        return instrumentation_desc_set_layout_;
-    }
+    // Device wide layout, so that instrumentation descriptor sets can be recycled across command buffers
+    VkDescriptorSetLayout GetInstrumentationDescriptorSetLayout() const;
 
     const vko::BufferRange &GetErrorOutputBufferRange() const {
         assert(error_output_buffer_range_.buffer != VK_NULL_HANDLE);
@@ -103,13 +109,14 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
 
     void IncrementCommandCount(VkPipelineBindPoint bind_point, const Location &loc);
 
-    std::string GetDebugLabelRegion(uint32_t label_command_i, const std::vector<std::string> &initial_label_stack) const;
+    std::string GetDebugLabelRegion(uint32_t label_command_i, const vvl::LabelStack &initial_label_stack) const;
 
     void Destroy() final;
     void Reset(const Location &loc) final;
 
     void RecordActionCommand(LastBound &last_bound, const Location &loc) final;
     void UpdateLastBoundDescriptorSets(VkPipelineBindPoint bind_point, const Location &loc) final;
+    void RecordBindPipeline(VkPipelineBindPoint bind_point, vvl::Pipeline &pipeline) final;
 
     void RecordPushConstants(VkPipelineLayout layout, VkShaderStageFlags stage_flags, uint32_t offset, uint32_t size,
                              const void *values) final;
@@ -122,7 +129,7 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
     // Using stdext::inplace_function over std::function to allocate memory in place
     using ErrorLoggerFunc =
         stdext::inplace_function<bool(const uint32_t *error_record, const LogObjectList &objlist,
-                                      const std::vector<std::string> &initial_label_stack),
+                                      const vvl::LabelStack &initial_label_stack),
                                  288 /*lambda storage size (bytes), large enough to store biggest error lambda*/>;
     std::vector<ErrorLoggerFunc> per_command_error_loggers;
     vvl::unordered_map<uint32_t, uint32_t> action_cmd_i_to_label_cmd_i_map;
@@ -139,7 +146,6 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
     bool NeedsPostProcess();
 
     Validator &gpuav_;
-    VkDescriptorSetLayout instrumentation_desc_set_layout_ = VK_NULL_HANDLE;
 };
 
 static inline CommandBufferSubState &SubState(vvl::CommandBuffer &cb) {
@@ -172,7 +178,7 @@ class QueueSubState : public vvl::QueueSubState {
     QueueSubState(Validator &gpuav, vvl::Queue &q);
     virtual ~QueueSubState();
 
-    void PreSubmit(std::vector<vvl::QueueSubmission> &submissions) override;
+    void PreSubmit(vvl::span<vvl::QueueSubmission> submissions) override;
     void PostSubmit(std::deque<vvl::QueueSubmission> &submissions) override;
     void Retire(vvl::QueueSubmission &) override;
 
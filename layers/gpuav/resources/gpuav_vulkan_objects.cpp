@@ -20,6 +20,7 @@
 #include "gpuav/core/gpuav.h"
 #include "generated/dispatch_functions.h"
 #include "utils/math_utils.h"
+#include <algorithm>
 #include <mutex>
 #include <vulkan/utility/vk_struct_helper.hpp>
 
@@ -41,6 +42,18 @@ DescriptorSetManager::~DescriptorSetManager() {
 
 VkResult DescriptorSetManager::GetDescriptorSet(VkDescriptorPool *out_desc_pool, VkDescriptorSetLayout ds_layout,
                                                 VkDescriptorSet *out_desc_sets) {
+    {
+        std::lock_guard guard(lock_);
+        auto recycled_desc_sets_it = recycled_desc_sets_.find(ds_layout);
+        if (recycled_desc_sets_it != recycled_desc_sets_.end() && !recycled_desc_sets_it->second.empty()) {
+            const PooledDescriptorSet recycled_desc_set = recycled_desc_sets_it->second.back();
+            recycled_desc_sets_it->second.pop_back();
+            *out_desc_pool = recycled_desc_set.desc_pool;
+            *out_desc_sets = recycled_desc_set.desc_set;
+            return VK_SUCCESS;
+        }
+    }
+
     std::vector<VkDescriptorSet> desc_sets;
     VkResult result = GetDescriptorSets(1, out_desc_pool, ds_layout, &desc_sets);
     assert(result == VK_SUCCESS);
@@ -118,6 +131,36 @@ VkResult DescriptorSetManager::GetDescriptorSets(uint32_t count, VkDescriptorPoo
     return result;
 }
 
+VkResult DescriptorSetManager::ReserveDescriptorSets(uint32_t count, VkDescriptorSetLayout ds_layout,
+                                                     std::vector<PooledDescriptorSet> &out_desc_sets) {
+    {
+        std::lock_guard guard(lock_);
+        auto recycled_desc_sets_it = recycled_desc_sets_.find(ds_layout);
+        if (recycled_desc_sets_it != recycled_desc_sets_.end()) {
+            std::vector<PooledDescriptorSet> &recycled_desc_sets = recycled_desc_sets_it->second;
+            const size_t recycled_count = std::min<size_t>(count, recycled_desc_sets.size());
+            out_desc_sets.insert(out_desc_sets.end(), recycled_desc_sets.end() - recycled_count, recycled_desc_sets.end());
+            recycled_desc_sets.resize(recycled_desc_sets.size() - recycled_count);
+            count -= static_cast<uint32_t>(recycled_count);
+        }
+    }
+
+    if (count == 0) {
+        return VK_SUCCESS;
+    }
+
+    VkDescriptorPool desc_pool = VK_NULL_HANDLE;
+    std::vector<VkDescriptorSet> desc_sets;
+    const VkResult result = GetDescriptorSets(count, &desc_pool, ds_layout, &desc_sets);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+    for (VkDescriptorSet desc_set : desc_sets) {
+        out_desc_sets.emplace_back(PooledDescriptorSet{desc_pool, desc_set});
+    }
+    return result;
+}
+
 void DescriptorSetManager::PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDescriptorSet desc_set) {
     std::lock_guard guard(lock_);
 
@@ -141,12 +184,36 @@ void DescriptorSetManager::PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDe
     return;
 }
 
+void DescriptorSetManager::RecycleDescriptorSet(VkDescriptorPool desc_pool, VkDescriptorSetLayout ds_layout,
+                                                VkDescriptorSet desc_set) {
+    std::lock_guard guard(lock_);
+    assert(desc_pool_map_.find(desc_pool) != desc_pool_map_.end());
+    recycled_desc_sets_[ds_layout].emplace_back(PooledDescriptorSet{desc_pool, desc_set});
+}
+
+void DescriptorSetManager::RecycleDescriptorSets(VkDescriptorSetLayout ds_layout,
+                                                 const std::vector<PooledDescriptorSet> &desc_sets) {
+    std::lock_guard guard(lock_);
+    std::vector<PooledDescriptorSet> &recycled_desc_sets = recycled_desc_sets_[ds_layout];
+    recycled_desc_sets.insert(recycled_desc_sets.end(), desc_sets.begin(), desc_sets.end());
+}
+
+uint32_t SharedResourcesCache::NextSlotIndex() {
+    static std::atomic<uint32_t> next_slot_index{0};
+    const uint32_t slot_index = next_slot_index.fetch_add(1, std::memory_order_relaxed);
+    assert(slot_index < kMaxSlots && "More types cached than SharedResourcesCache::kMaxSlots");
+    return slot_index;
+}
+
 void SharedResourcesCache::Clear() {
-    for (auto &[key, value] : shared_validation_resources_map_) {
-        auto &[object, destructor] = value;
-        destructor(object);
+    // Destroy in reverse creation order, an object can rely on the ones created before it
+    for (auto it = creation_order_.rbegin(); it != creation_order_.rend(); ++it) {
+        Slot &slot = slots_[*it];
+        slot.destructor(slot.object.load(std::memory_order_relaxed));
+        slot.object.store(nullptr, std::memory_order_relaxed);
+        slot.destructor = nullptr;
     }
-    shared_validation_resources_map_.clear();
+    creation_order_.clear();
 }
 
 void *Buffer::GetMappedPtr() const { return mapped_ptr; }
@@ -246,38 +313,143 @@ void BufferRange::Clear() const {
     memset((uint8_t *)offset_mapped_ptr, 0, static_cast<size_t>(size));
 }
 
-GpuResourcesManager::GpuResourcesManager(Validator &gpuav) : gpuav_(gpuav) {
+// Past this size, a block is destroyed instead of being pooled
+constexpr VkDeviceSize kMaxPooledByteSizePerPool = 64 * 1024 * 1024;
+
+void BufferBlockPool::Create(Validator &gpuav, VkBufferUsageFlags buffer_usage_flags, const VmaAllocationCreateInfo &allocation_ci,
+                             bool linear_algorithm) {
+    gpuav_ = &gpuav;
+    buffer_usage_flags_ = buffer_usage_flags;
+    allocation_ci_ = allocation_ci;
+
+    VkBufferCreateInfo buffer_ci = vku::InitStructHelper();
+    buffer_ci.size = 4096;  // Only used to find the memory type
+    buffer_ci.usage = buffer_usage_flags;
+    uint32_t mem_type_index = 0;
+    VkResult result = vmaFindMemoryTypeIndexForBufferInfo(gpuav.vma_allocator_, &buffer_ci, &allocation_ci, &mem_type_index);
+    if (result != VK_SUCCESS) {
+        return;
+    }
+
+    VmaPoolCreateInfo pool_ci = {};
+    pool_ci.memoryTypeIndex = mem_type_index;
+    if (linear_algorithm) {
+        pool_ci.flags |= VMA_POOL_CREATE_LINEAR_ALGORITHM_BIT;
+    }
+    result = vmaCreatePool(gpuav.vma_allocator_, &pool_ci, &vma_pool_);
+    if (result != VK_SUCCESS) {
+        vma_pool_ = VK_NULL_HANDLE;
+        return;
+    }
+    heap_index_ = gpuav.phys_dev_mem_props.memoryTypes[mem_type_index].heapIndex;
+    allocation_ci_.pool = vma_pool_;
+}
+
+void BufferBlockPool::AddVmaPoolStatistics(VmaStatistics &out_statistics) const {
+    if (vma_pool_ == VK_NULL_HANDLE) {
+        return;
+    }
+    VmaStatistics statistics = {};
+    vmaGetPoolStatistics(gpuav_->vma_allocator_, vma_pool_, &statistics);
+    out_statistics.blockCount += statistics.blockCount;
+    out_statistics.allocationCount += statistics.allocationCount;
+    out_statistics.blockBytes += statistics.blockBytes;
+    out_statistics.allocationBytes += statistics.allocationBytes;
+}
+
+void BufferBlockPool::DestroyVmaPool() {
+    if (vma_pool_ != VK_NULL_HANDLE) {
+        vmaDestroyPool(gpuav_->vma_allocator_, vma_pool_);
+        vma_pool_ = VK_NULL_HANDLE;
+        allocation_ci_.pool = VK_NULL_HANDLE;
+    }
+}
+
+// Idle blocks are given back to the driver once their heap gets close to its budget (VK_EXT_memory_budget, or an estimate)
+bool BufferBlockPool::IsHeapNearBudget() const {
+    if (vma_pool_ == VK_NULL_HANDLE) {
+        return false;
+    }
+    VmaBudget budgets[VK_MAX_MEMORY_HEAPS] = {};
+    vmaGetHeapBudgets(gpuav_->vma_allocator_, budgets);
+    const VmaBudget &heap_budget = budgets[heap_index_];
+    return heap_budget.usage > heap_budget.budget / 5 * 4;
+}
+
+Buffer BufferBlockPool::Get(Validator &gpuav, VkDeviceSize size_class) {
+    std::lock_guard guard(lock_);
+    auto blocks_it = size_class_to_blocks_.find(size_class);
+    if (blocks_it == size_class_to_blocks_.end() || blocks_it->second.empty()) {
+        return Buffer(gpuav);
+    }
+    Buffer buffer = blocks_it->second.back();
+    blocks_it->second.pop_back();
+    pooled_byte_size_ -= buffer.Size();
+    return buffer;
+}
+
+void BufferBlockPool::Put(Buffer &buffer) {
+    if (buffer.IsDestroyed()) {
+        return;
+    }
+    const bool heap_near_budget = IsHeapNearBudget();
+    std::lock_guard guard(lock_);
+    if (destroyed_ || heap_near_budget || pooled_byte_size_ + buffer.Size() > kMaxPooledByteSizePerPool) {
+        buffer.Destroy();
+        return;
+    }
+    pooled_byte_size_ += buffer.Size();
+    size_class_to_blocks_[buffer.Size()].emplace_back(buffer);
+}
+
+void BufferBlockPool::DestroyBuffers() {
+    std::lock_guard guard(lock_);
+    for (auto &[size_class, blocks] : size_class_to_blocks_) {
+        for (Buffer &buffer : blocks) {
+            buffer.Destroy();
+        }
+    }
+    size_class_to_blocks_.clear();
+    pooled_byte_size_ = 0;
+    destroyed_ = true;
+}
+
+void BufferBlockPools::Create(Validator &gpuav) {
     {
         VmaAllocationCreateInfo alloc_ci = {};
         alloc_ci.usage = VMA_MEMORY_USAGE_AUTO;
         alloc_ci.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
-        host_visible_buffer_cache_.Create(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT |
-                                              VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-                                          alloc_ci);
+        // Holds the error output buffers, allocated and released with their command buffers
+        host_visible.Create(gpuav,
+                            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT |
+                                VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                            alloc_ci, gpuav.gpuav_settings.vma_linear_output);
     }
 
     {
         VmaAllocationCreateInfo alloc_ci = {};
         alloc_ci.usage = VMA_MEMORY_USAGE_AUTO;
         alloc_ci.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
-        host_cached_buffer_cache_.Create(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT |
-                                             VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-                                         alloc_ci);
+        host_cached.Create(gpuav,
+                           VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT |
+                               VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                           alloc_ci, false);
     }
 
     {
         VmaAllocationCreateInfo alloc_ci = {};
         alloc_ci.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
-        device_local_buffer_cache_.Create(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT |
-                                              VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-                                          alloc_ci);
+        device_local.Create(gpuav,
+                            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT |
+                                VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                            alloc_ci, false);
     }
 
     {
         VmaAllocationCreateInfo alloc_ci = {};
         alloc_ci.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
-        device_local_indirect_buffer_cache_.Create(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
-                                                   alloc_ci);
+        device_local_indirect.Create(gpuav, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, alloc_ci,
+                                     false);
     }
 
     {
@@ -285,12 +457,47 @@ GpuResourcesManager::GpuResourcesManager(Validator &gpuav) : gpuav_(gpuav) {
         alloc_ci.usage = VMA_MEMORY_USAGE_AUTO;
         alloc_ci.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT |
                          VMA_ALLOCATION_CREATE_HOST_ACCESS_ALLOW_TRANSFER_INSTEAD_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
-        staging_buffer_cache_.Create(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT |
-                                         VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-                                     alloc_ci);
+        staging.Create(gpuav,
+                       VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT |
+                           VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                       alloc_ci, false);
     }
 }
 
+VmaStatistics BufferBlockPools::GetVmaPoolsStatistics() const {
+    VmaStatistics statistics = {};
+    host_visible.AddVmaPoolStatistics(statistics);
+    host_cached.AddVmaPoolStatistics(statistics);
+    device_local.AddVmaPoolStatistics(statistics);
+    device_local_indirect.AddVmaPoolStatistics(statistics);
+    staging.AddVmaPoolStatistics(statistics);
+    return statistics;
+}
+
+void BufferBlockPools::DestroyVmaPools() {
+    host_visible.DestroyVmaPool();
+    host_cached.DestroyVmaPool();
+    device_local.DestroyVmaPool();
+    device_local_indirect.DestroyVmaPool();
+    staging.DestroyVmaPool();
+}
+
+void BufferBlockPools::DestroyBuffers() {
+    host_visible.DestroyBuffers();
+    host_cached.DestroyBuffers();
+    device_local.DestroyBuffers();
+    device_local_indirect.DestroyBuffers();
+    staging.DestroyBuffers();
+}
+
+GpuResourcesManager::GpuResourcesManager(Validator &gpuav) : gpuav_(gpuav) {
+    host_visible_buffer_cache_.Create(gpuav.buffer_block_pools_.host_visible);
+    host_cached_buffer_cache_.Create(gpuav.buffer_block_pools_.host_cached);
+    device_local_buffer_cache_.Create(gpuav.buffer_block_pools_.device_local);
+    device_local_indirect_buffer_cache_.Create(gpuav.buffer_block_pools_.device_local_indirect);
+    staging_buffer_cache_.Create(gpuav.buffer_block_pools_.staging);
+}
+
 VkDescriptorSet GpuResourcesManager::GetManagedDescriptorSet(VkDescriptorSetLayout desc_set_layout) {
     // Look for a descriptor set layout matching input,
     // if found get or add an associated descriptor set
@@ -300,16 +507,23 @@ VkDescriptorSet GpuResourcesManager::GetManagedDescriptorSet(VkDescriptorSetLayo
         }
 
         if (layout_to_sets.first_available_desc_set == layout_to_sets.cached_descriptors.size()) {
-            CachedDescriptor cached_descriptor;
-            const VkResult result = gpuav_.desc_set_manager_->GetDescriptorSet(&cached_descriptor.desc_pool, desc_set_layout,
-                                                                               &cached_descriptor.desc_set);
-            if (result != VK_SUCCESS) {
+            // Reserve a batch growing with the command buffer needs, a command buffer with many action commands then only goes
+            // to the device level descriptor set manager a handful of times
+            constexpr uint32_t min_reserved_desc_sets = 16;
+            constexpr uint32_t max_reserved_desc_sets = 256;
+            const uint32_t reserve_count = std::clamp(static_cast<uint32_t>(layout_to_sets.cached_descriptors.size()),
+                                                      min_reserved_desc_sets, max_reserved_desc_sets);
+            const VkResult result =
+                gpuav_.desc_set_manager_->ReserveDescriptorSets(reserve_count, desc_set_layout, layout_to_sets.cached_descriptors);
+            if (result != VK_SUCCESS || layout_to_sets.first_available_desc_set == layout_to_sets.cached_descriptors.size()) {
                 return VK_NULL_HANDLE;
             }
-            layout_to_sets.cached_descriptors.emplace_back(cached_descriptor);
         }
 
         assert(layout_to_sets.first_available_desc_set < layout_to_sets.cached_descriptors.size());
+        // Caller is going to write the descriptor set, what it held before does not matter anymore
+        layout_to_sets.cached_descriptors_writes.resize(layout_to_sets.cached_descriptors.size());
+        layout_to_sets.cached_descriptors_writes[layout_to_sets.first_available_desc_set].clear();
         return layout_to_sets.cached_descriptors[layout_to_sets.first_available_desc_set++].desc_set;
     }
 
@@ -321,6 +535,67 @@ VkDescriptorSet GpuResourcesManager::GetManagedDescriptorSet(VkDescriptorSetLayo
     return GetManagedDescriptorSet(desc_set_layout);
 }
 
+VkDescriptorSet GpuResourcesManager::GetManagedDescriptorSet(VkDescriptorSetLayout desc_set_layout,
+                                                             vvl::span<VkWriteDescriptorSet> desc_writes) {
+    // Look at what the next descriptor set handed out holds before GetManagedDescriptorSet forgets it
+    BufferDescriptorWrites previous_writes;
+    for (LayoutToSets &layout_to_sets : cache_layouts_to_sets_) {
+        if (layout_to_sets.desc_set_layout == desc_set_layout &&
+            layout_to_sets.first_available_desc_set < layout_to_sets.cached_descriptors_writes.size()) {
+            previous_writes = std::move(layout_to_sets.cached_descriptors_writes[layout_to_sets.first_available_desc_set]);
+            break;
+        }
+    }
+
+    const VkDescriptorSet desc_set = GetManagedDescriptorSet(desc_set_layout);
+    if (desc_set == VK_NULL_HANDLE) {
+        return VK_NULL_HANDLE;
+    }
+
+    for (VkWriteDescriptorSet &wds : desc_writes) {
+        wds.dstSet = desc_set;
+    }
+
+    const bool same_writes = AreSameBufferDescriptorWrites(previous_writes, desc_writes);
+    if (!same_writes) {
+        previous_writes.clear();
+        for (const VkWriteDescriptorSet &wds : desc_writes) {
+            previous_writes.emplace_back(wds.dstBinding, *wds.pBufferInfo);
+        }
+    }
+
+    for (LayoutToSets &layout_to_sets : cache_layouts_to_sets_) {
+        if (layout_to_sets.desc_set_layout == desc_set_layout) {
+            assert(layout_to_sets.cached_descriptors[layout_to_sets.first_available_desc_set - 1].desc_set == desc_set);
+            layout_to_sets.cached_descriptors_writes[layout_to_sets.first_available_desc_set - 1] = std::move(previous_writes);
+            break;
+        }
+    }
+
+    if (same_writes) {
+        return desc_set;
+    }
+
+    DispatchUpdateDescriptorSets(gpuav_.device, static_cast<uint32_t>(desc_writes.size()), desc_writes.data(), 0, nullptr);
+    return desc_set;
+}
+
+bool AreSameBufferDescriptorWrites(const BufferDescriptorWrites &writes, vvl::span<const VkWriteDescriptorSet> desc_writes) {
+    if (writes.empty() || writes.size() != desc_writes.size()) {
+        return false;
+    }
+    for (size_t write_i = 0; write_i < desc_writes.size(); ++write_i) {
+        const auto &[dst_binding, buffer_info] = writes[write_i];
+        const VkWriteDescriptorSet &wds = desc_writes[write_i];
+        assert(wds.descriptorCount == 1 && wds.pBufferInfo);
+        if (dst_binding != wds.dstBinding || buffer_info.buffer != wds.pBufferInfo->buffer ||
+            buffer_info.offset != wds.pBufferInfo->offset || buffer_info.range != wds.pBufferInfo->range) {
+            return false;
+        }
+    }
+    return true;
+}
+
 // Arbitrary, big enough
 constexpr VkDeviceSize buffer_address_alignment = 128;
 
@@ -391,10 +666,9 @@ void GpuResourcesManager::ReturnResources() {
 
 void GpuResourcesManager::DestroyResources() {
     for (LayoutToSets &layout_to_set : cache_layouts_to_sets_) {
-        for (CachedDescriptor &cached_descriptor : layout_to_set.cached_descriptors) {
-            gpuav_.desc_set_manager_->PutBackDescriptorSet(cached_descriptor.desc_pool, cached_descriptor.desc_set);
-        }
+        gpuav_.desc_set_manager_->RecycleDescriptorSets(layout_to_set.desc_set_layout, layout_to_set.cached_descriptors);
         layout_to_set.cached_descriptors.clear();
+        layout_to_set.cached_descriptors_writes.clear();
     }
     cache_layouts_to_sets_.clear();
 
@@ -405,10 +679,7 @@ void GpuResourcesManager::DestroyResources() {
     staging_buffer_cache_.DestroyBuffers();
 }
 
-void GpuResourcesManager::BufferCache::Create(VkBufferUsageFlags buffer_usage_flags, const VmaAllocationCreateInfo allocation_ci) {
-    buffer_usage_flags_ = buffer_usage_flags;
-    allocation_ci_ = allocation_ci;
-}
+void GpuResourcesManager::BufferCache::Create(BufferBlockPool &block_pool) { block_pool_ = &block_pool; }
 
 GpuResourcesManager::BufferCache::~BufferCache() { DestroyBuffers(); }
 
@@ -461,19 +732,34 @@ vko::BufferRange GpuResourcesManager::BufferCache::GetBufferRange(Validator &gpu
         }
     }
 
-    // Did not find a cached buffer, create one, cache it and return its handle
-    Buffer buffer(gpuav);
-    VkBufferCreateInfo buffer_ci = vku::InitStructHelper();
-    buffer_ci.size = std::max(min_buffer_block_byte_size, byte_size);
-    buffer_ci.usage = buffer_usage_flags_;
-    const bool success = buffer.Create(&buffer_ci, &allocation_ci_);
-    if (!success) {
-        return {};
+    // Did not find a cached buffer, get one from the pool or create one, cache it and return its handle.
+    // Block sizes are rounded up to a size class so that blocks can be reused across GpuResourcesManager
+    VkDeviceSize block_byte_size = std::max(min_buffer_block_byte_size, byte_size);
+    constexpr VkDeviceSize max_pow2_size_class = 16 * 1024 * 1024;
+    if (block_byte_size <= max_pow2_size_class) {
+        VkDeviceSize size_class = 1;
+        while (size_class < block_byte_size) {
+            size_class <<= 1;
+        }
+        block_byte_size = size_class;
+    } else {
+        block_byte_size = Align<VkDeviceSize>(block_byte_size, max_pow2_size_class);
     }
-    CachedBufferBlock cached_buffer_block{buffer, {0, buffer_ci.size}, {0, byte_size}};
+
+    Buffer buffer = block_pool_->Get(gpuav, block_byte_size);
+    if (buffer.IsDestroyed()) {
+        VkBufferCreateInfo buffer_ci = vku::InitStructHelper();
+        buffer_ci.size = block_byte_size;
+        buffer_ci.usage = block_pool_->BufferUsageFlags();
+        const bool success = buffer.Create(&buffer_ci, &block_pool_->AllocationCreateInfo());
+        if (!success) {
+            return {};
+        }
+    }
+    CachedBufferBlock cached_buffer_block{buffer, {0, block_byte_size}, {0, byte_size}};
     cached_buffers_blocks_.emplace_back(cached_buffer_block);
 
-    total_available_byte_size_ += buffer_ci.size - byte_size;
+    total_available_byte_size_ += block_byte_size - byte_size;
 
     return {buffer.VkHandle(),
             cached_buffer_block.used_range.begin,
@@ -493,9 +779,15 @@ void GpuResourcesManager::BufferCache::ReturnBuffers() {
 
 void GpuResourcesManager::BufferCache::DestroyBuffers() {
     for (CachedBufferBlock &cached_buffer_block : cached_buffers_blocks_) {
-        cached_buffer_block.buffer.Destroy();
+        if (block_pool_) {
+            block_pool_->Put(cached_buffer_block.buffer);
+        } else {
+            cached_buffer_block.buffer.Destroy();
+        }
     }
     cached_buffers_blocks_.clear();
+    total_available_byte_size_ = 0;
+    next_avail_buffer_pos_hint_ = 0;
 }
 
 bool StagingBuffer::CanDeviceEverStage(Validator &gpuav) {
@@ -19,11 +19,16 @@
 
 #include "external/vma/vma.h"
 
-#include <typeinfo>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include "containers/custom_containers.h"
 #include "containers/range.h"
+#include "containers/span.h"
 
 struct Location;
 namespace gpuav {
@@ -36,10 +41,22 @@ class DescriptorSetManager {
     DescriptorSetManager(VkDevice device, uint32_t num_bindings_in_set);
     ~DescriptorSetManager();
 
+    struct PooledDescriptorSet {
+        VkDescriptorPool desc_pool = VK_NULL_HANDLE;
+        VkDescriptorSet desc_set = VK_NULL_HANDLE;
+    };
+
     VkResult GetDescriptorSet(VkDescriptorPool *out_desc_pool, VkDescriptorSetLayout ds_layout, VkDescriptorSet *out_desc_sets);
+    // Hands out count descriptor sets in one go, recycled ones first, so command buffers recording in parallel can reserve
+    // them in bulk instead of contending on the manager lock at each action command
+    VkResult ReserveDescriptorSets(uint32_t count, VkDescriptorSetLayout ds_layout,
+                                   std::vector<PooledDescriptorSet> &out_desc_sets);
     VkResult GetDescriptorSets(uint32_t count, VkDescriptorPool *out_pool, VkDescriptorSetLayout ds_layout,
                                std::vector<VkDescriptorSet> *out_desc_sets);
     void PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDescriptorSet desc_set);
+    // Keep the descriptor set allocated, GetDescriptorSet(s) will hand it out again for the same layout
+    void RecycleDescriptorSet(VkDescriptorPool desc_pool, VkDescriptorSetLayout ds_layout, VkDescriptorSet desc_set);
+    void RecycleDescriptorSets(VkDescriptorSetLayout ds_layout, const std::vector<PooledDescriptorSet> &desc_sets);
 
   private:
     struct PoolTracker {
@@ -49,6 +66,7 @@ class DescriptorSetManager {
     VkDevice device;
     uint32_t num_bindings_in_set;
     vvl::unordered_map<VkDescriptorPool, PoolTracker> desc_pool_map_;
+    vvl::unordered_map<VkDescriptorSetLayout, std::vector<PooledDescriptorSet>> recycled_desc_sets_;
     mutable std::mutex lock_;
 };
 
@@ -94,12 +112,72 @@ struct BufferRange {
     void Clear() const;
 };
 
+// Buffer blocks of destroyed GpuResourcesManager, handed to the next ones instead of going back to VMA.
+// Applications freeing and re-allocating their command buffers every frame then do not allocate memory in steady state.
+// Blocks are binned by size class (power of two byte sizes), the pool is shared by all threads of a device.
+// Blocks are allocated from a dedicated VMA pool, so they do not interleave with the other use cases and GPU-AV allocations.
+class BufferBlockPool {
+  public:
+    // Creates the VMA pool of the memory type VMA picks for |allocation_ci|. Blocks come from the default VMA pools if it fails.
+    void Create(Validator &gpuav, VkBufferUsageFlags buffer_usage_flags, const VmaAllocationCreateInfo &allocation_ci,
+                bool linear_algorithm);
+    VkBufferUsageFlags BufferUsageFlags() const { return buffer_usage_flags_; }
+    // Allocation info of the blocks, pointing to the dedicated VMA pool
+    const VmaAllocationCreateInfo &AllocationCreateInfo() const { return allocation_ci_; }
+    void AddVmaPoolStatistics(VmaStatistics &out_statistics) const;
+    void DestroyVmaPool();
+
+    // Returned buffer is destroyed if no block of this size class is available
+    Buffer Get(Validator &gpuav, VkDeviceSize size_class);
+    // Buffer is destroyed instead of pooled if the pool is full or has been cleared
+    void Put(Buffer &buffer);
+    void DestroyBuffers();
+
+  private:
+    bool IsHeapNearBudget() const;
+
+    Validator *gpuav_ = nullptr;
+    VkBufferUsageFlags buffer_usage_flags_{};
+    VmaAllocationCreateInfo allocation_ci_{};
+    VmaPool vma_pool_ = VK_NULL_HANDLE;
+    uint32_t heap_index_ = 0;
+
+    std::mutex lock_;
+    vvl::unordered_map<VkDeviceSize, std::vector<Buffer>> size_class_to_blocks_;
+    VkDeviceSize pooled_byte_size_ = 0;
+    bool destroyed_ = false;
+};
+
+// One pool per GpuResourcesManager buffer cache
+struct BufferBlockPools {
+    BufferBlockPool host_visible;
+    BufferBlockPool host_cached;
+    BufferBlockPool device_local;
+    BufferBlockPool device_local_indirect;
+    BufferBlockPool staging;
+
+    void Create(Validator &gpuav);
+    // Sizes of the blocks of the dedicated VMA pools, and of the allocations in them
+    VmaStatistics GetVmaPoolsStatistics() const;
+    void DestroyBuffers();
+    // After all buffers allocated from the pools are destroyed
+    void DestroyVmaPools();
+};
+
+// Destination binding and buffer of buffer descriptor writes, enough to tell if a descriptor set already holds them
+using BufferDescriptorWrites = std::vector<std::pair<uint32_t, VkDescriptorBufferInfo>>;
+bool AreSameBufferDescriptorWrites(const BufferDescriptorWrites &writes, vvl::span<const VkWriteDescriptorSet> desc_writes);
+
 // Register/Create and register GPU resources, all to be destroyed upon a call to DestroyResources
 class GpuResourcesManager {
   public:
     explicit GpuResourcesManager(Validator &gpuav);
 
     VkDescriptorSet GetManagedDescriptorSet(VkDescriptorSetLayout desc_set_layout);
+    // Same as above, then applies the buffer descriptor writes |desc_writes| to the returned descriptor set.
+    // Descriptor sets handed out again after ReturnResources still hold the writes of the previous recording, and the buffers
+    // they point to are still alive: when the writes are the same, vkUpdateDescriptorSets is skipped.
+    VkDescriptorSet GetManagedDescriptorSet(VkDescriptorSetLayout desc_set_layout, vvl::span<VkWriteDescriptorSet> desc_writes);
 
     vko::BufferRange GetHostVisibleBufferRange(VkDeviceSize size);
     vko::BufferRange GetHostCachedBufferRange(VkDeviceSize size);
@@ -115,13 +193,12 @@ class GpuResourcesManager {
     Validator &gpuav_;
 
   private:
-    struct CachedDescriptor {
-        VkDescriptorPool desc_pool = VK_NULL_HANDLE;
-        VkDescriptorSet desc_set = VK_NULL_HANDLE;
-    };
+    using CachedDescriptor = DescriptorSetManager::PooledDescriptorSet;
     struct LayoutToSets {
         VkDescriptorSetLayout desc_set_layout = VK_NULL_HANDLE;
         std::vector<CachedDescriptor> cached_descriptors;
+        // Last writes done through GetManagedDescriptorSet to each of cached_descriptors, empty if unknown
+        std::vector<BufferDescriptorWrites> cached_descriptors_writes;
         size_t first_available_desc_set = 0;
     };
     std::vector<LayoutToSets> cache_layouts_to_sets_;
@@ -129,7 +206,7 @@ class GpuResourcesManager {
     class BufferCache {
       public:
         BufferCache() = default;
-        void Create(VkBufferUsageFlags buffer_usage_flags, const VmaAllocationCreateInfo allocation_ci);
+        void Create(BufferBlockPool &block_pool);
         vko::BufferRange GetBufferRange(Validator &gpuav, VkDeviceSize byte_size, VkDeviceSize alignment,
                                         VkDeviceSize min_buffer_block_byte_size = 0);
         ~BufferCache();
@@ -138,8 +215,7 @@ class GpuResourcesManager {
         void DestroyBuffers();
 
       private:
-        VkBufferUsageFlags buffer_usage_flags_{};
-        VmaAllocationCreateInfo allocation_ci_{};
+        BufferBlockPool *block_pool_ = nullptr;
 
         struct CachedBufferBlock {
             vko::Buffer buffer;
@@ -196,27 +272,18 @@ class CommandPool {
     uint32_t cmd_buffer_ring_head_ = 0;
 };
 
-// Cache a single object of type T. Key is *only* based on typeid(T)
+// Cache a single object of type T. Key is *only* based on the type T
+// Each type gets its own slot index the first time it is used with any cache, so looking up an object is a direct array access.
 class SharedResourcesCache {
   public:
     // Try get an object, returns null if not found
     template <typename T>
     T *TryGet() {
-        auto entry = shared_validation_resources_map_.find(typeid(T));
-        if (entry == shared_validation_resources_map_.cend()) {
-            return nullptr;
-        }
-        T *t = reinterpret_cast<T *>(entry->second.first);
-        return t;
+        return static_cast<T *>(slots_[SlotIndex<T>()].object.load(std::memory_order_acquire));
     }
     template <typename T>
     const T *TryGet() const {
-        auto entry = shared_validation_resources_map_.find(typeid(T));
-        if (entry == shared_validation_resources_map_.cend()) {
-            return nullptr;
-        }
-        const T *t = reinterpret_cast<const T *>(entry->second.first);
-        return t;
+        return static_cast<const T *>(slots_[SlotIndex<T>()].object.load(std::memory_order_acquire));
     }
 
     // Get an object, assuming it has been created
@@ -239,30 +306,45 @@ class SharedResourcesCache {
     // only the entry cached upon the first call to Get<T> will be retrieved
     template <typename T, class... ConstructorTypes>
     T &GetOrCreate(ConstructorTypes &&...args) {
-        T *t = TryGet<T>();
-        if (t) return *t;
-
-        auto entry =
-            shared_validation_resources_map_.insert({typeid(T), {new T(std::forward<ConstructorTypes>(args)...), [](void *ptr) {
-                                                                     auto obj = static_cast<T *>(ptr);
-                                                                     delete obj;
-                                                                 }}});
-        return *static_cast<T *>(entry.first->second.first);
+        const uint32_t slot_index = SlotIndex<T>();
+        if (void *object = slots_[slot_index].object.load(std::memory_order_acquire)) {
+            return *static_cast<T *>(object);
+        }
+
+        // Constructed without holding the lock, as a constructor can itself get or create other objects of this cache
+        auto new_object = std::make_unique<T>(std::forward<ConstructorTypes>(args)...);
+
+        std::lock_guard<std::mutex> guard(creation_lock_);
+        Slot &slot = slots_[slot_index];
+        if (void *object = slot.object.load(std::memory_order_relaxed)) {
+            // Another thread created it first, ours is destroyed
+            return *static_cast<T *>(object);
+        }
+        slot.destructor = [](void *ptr) { delete static_cast<T *>(ptr); };
+        creation_order_.emplace_back(slot_index);
+        T *created_object = new_object.release();
+        slot.object.store(created_object, std::memory_order_release);
+        return *created_object;
     }
 
     void Clear();
 
   private:
-    using TypeInfoRef = std::reference_wrapper<const std::type_info>;
-    struct Hasher {
-        std::size_t operator()(TypeInfoRef code) const { return code.get().hash_code(); }
-    };
-    struct EqualTo {
-        bool operator()(TypeInfoRef lhs, TypeInfoRef rhs) const { return lhs.get() == rhs.get(); }
-    };
+    static constexpr uint32_t kMaxSlots = 64;
+    static uint32_t NextSlotIndex();
+    template <typename T>
+    static uint32_t SlotIndex() {
+        static const uint32_t slot_index = NextSlotIndex();
+        return slot_index;
+    }
 
-    vvl::unordered_map<TypeInfoRef, std::pair<void * /*object*/, void (*)(void *) /*object destructor*/>, Hasher, EqualTo>
-        shared_validation_resources_map_;
+    struct Slot {
+        std::atomic<void *> object{nullptr};
+        void (*destructor)(void *) = nullptr;
+    };
+    std::array<Slot, kMaxSlots> slots_;
+    std::vector<uint32_t> creation_order_;
+    std::mutex creation_lock_;
 };
 
 }  // namespace vko
@@ -178,6 +178,9 @@ bool BufferDeviceAddressPass::RequiresInstrumentation(const Function& function,
 }
 
 bool BufferDeviceAddressPass::Instrument() {
+    // Blocks created when splitting a block around a guarded access are the rest of the one we split up
+    bool is_original_new_block = true;
+
     // Can safely loop function list as there is no injecting of new Functions until linking time
     for (const auto& function : module_.functions_) {
         if (function->instrumentation_added_) continue;
@@ -192,6 +195,11 @@ bool BufferDeviceAddressPass::Instrument() {
             }
             auto& block_instructions = current_block.instructions_;
 
+            if (is_original_new_block) {
+                block_checked_pointers_.clear();
+            }
+            is_original_new_block = true;
+
             if (!module_.settings_.safe_mode) {
                 // Pre-Pass optimization where we detect statically all the offsets inside a BDA Struct that are accessed.
                 // From here we can create a range and only do the check once since there is no real way to split a VkBuffer mid
@@ -243,18 +251,40 @@ bool BufferDeviceAddressPass::Instrument() {
                 // Every instruction is analyzed by the specific pass and lets us know if we need to inject a function or not
                 if (!RequiresInstrumentation(*function, *(inst_it->get()), meta)) continue;
 
-                if (IsMaxInstrumentationsCount()) continue;
-                instrumentations_count_++;
+                const uint32_t pointer_id = meta.target_instruction->Operand(0);
+                uint32_t guard_result_id = 0;
+                if (module_.settings_.safe_mode_targeted) {
+                    auto checked_it = block_checked_pointers_.find(pointer_id);
+                    if (checked_it != block_checked_pointers_.end() && meta.access_size <= checked_it->second.access_size &&
+                        meta.alignment_literal <= checked_it->second.alignment) {
+                        guard_result_id = checked_it->second.result_id;
+                    }
+                }
+
+                if (guard_result_id == 0) {
+                    if (IsMaxInstrumentationsCount()) continue;
+                    instrumentations_count_++;
+                }
 
                 if (!module_.settings_.safe_mode) {
                     CreateFunctionCall(current_block, &inst_it, meta);
                 } else {
                     InjectConditionalData ic_data = InjectFunctionPre(*function.get(), block_it, inst_it);
-                    ic_data.function_result_id = CreateFunctionCall(current_block, nullptr, meta);
+                    if (guard_result_id != 0) {
+                        // The check of the same pointer earlier in the block dominates this access
+                        ic_data.function_result_id = guard_result_id;
+                    } else {
+                        ic_data.function_result_id = CreateFunctionCall(current_block, nullptr, meta);
+                        if (module_.settings_.safe_mode_targeted) {
+                            block_checked_pointers_[pointer_id] =
+                                CheckedPointer{ic_data.function_result_id, meta.access_size, meta.alignment_literal};
+                        }
+                    }
                     InjectFunctionPost(current_block, ic_data);
                     // Skip the newly added valid and invalid block. Start searching again from newly split merge block
                     block_it++;
                     block_it++;
+                    is_original_new_block = false;
                     break;
                 }
             }
@@ -59,6 +59,15 @@ class BufferDeviceAddressPass : public Pass {
     };
     vvl::unordered_map<uint32_t, Range> block_struct_range_map_;
     vvl::unordered_set<uint32_t> block_skip_list_;
+
+    // For targeted safe mode, the pointers already checked in the block. A later access through the same pointer, of at most the
+    // same size and alignment, can not fail where the first one passed so it branches on the first result instead
+    struct CheckedPointer {
+        uint32_t result_id = 0;
+        uint32_t access_size = 0;
+        uint32_t alignment = 0;
+    };
+    vvl::unordered_map<uint32_t, CheckedPointer> block_checked_pointers_;
 };
 
 }  // namespace spirv
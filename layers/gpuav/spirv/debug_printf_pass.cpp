@@ -495,6 +495,7 @@ bool DebugPrintfPass::Instrument() {
     }
 
     for (const auto& function : module_.functions_) {
+        if (!HasTargetOpcode(*function)) continue;
         for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
             BasicBlock& current_block = **block_it;
 
@@ -30,7 +30,9 @@ struct Type;
 class DebugPrintfPass : public Pass {
   public:
     DebugPrintfPass(Module& module, std::vector<InternalOnlyDebugPrintf>& debug_printf, uint32_t binding_slot = 0)
-        : Pass(module, kNullOffline), intenral_only_debug_printf_(debug_printf), binding_slot_(binding_slot) {}
+        : Pass(module, kNullOffline), intenral_only_debug_printf_(debug_printf), binding_slot_(binding_slot) {
+        target_opcodes_ = {spv::OpExtInst};
+    }
     const char* Name() const final { return "DebugPrintfPass"; }
 
     bool Instrument() final;
@@ -32,6 +32,7 @@ const static OfflineFunction kOfflineFunction = {"inst_descriptor_class_texel_bu
 
 DescriptorClassTexelBufferPass::DescriptorClassTexelBufferPass(Module& module) : Pass(module, kOfflineModule) {
     module.use_bda_ = true;
+    target_opcodes_ = {spv::OpImageFetch, spv::OpImageWrite, spv::OpImageRead};
 }
 
 // By appending the LinkInfo, it will attempt at linking stage to add the function.
@@ -176,6 +177,7 @@ bool DescriptorClassTexelBufferPass::Instrument() {
     // Can safely loop function list as there is no injecting of new Functions until linking time
     for (const auto& function : module_.functions_) {
         if (function->instrumentation_added_) continue;
+        if (!HasTargetOpcode(*function)) continue;
         for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
             BasicBlock& current_block = **block_it;
 
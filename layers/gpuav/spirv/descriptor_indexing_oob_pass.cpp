@@ -40,8 +40,8 @@ const static OfflineFunction kOfflineFunctionBindlessCombined = {"inst_descripto
 DescriptorIndexingOOBPass::DescriptorIndexingOOBPass(Module& module) : Pass(module, kOfflineModule) { module.use_bda_ = true; }
 
 // By appending the LinkInfo, it will attempt at linking stage to add the function.
-uint32_t DescriptorIndexingOOBPass::GetLinkFunctionId(bool is_combined_image_sampler) {
-    if (!module_.has_bindless_descriptors_) {
+uint32_t DescriptorIndexingOOBPass::GetLinkFunctionId(bool is_bindless, bool is_combined_image_sampler) {
+    if (!is_bindless) {
         return GetLinkFunction(link_non_bindless_id_, kOfflineFunctionNonBindless);
     } else if (is_combined_image_sampler) {
         return GetLinkFunction(link_bindless_combined_image_sampler_id_, kOfflineFunctionBindlessCombined);
@@ -50,11 +50,46 @@ uint32_t DescriptorIndexingOOBPass::GetLinkFunctionId(bool is_combined_image_sam
     }
 }
 
-uint32_t DescriptorIndexingOOBPass::CreateFunctionCall(BasicBlock& block, InstructionIt* inst_it, const InstructionMeta& meta) {
-    const Constant& set_constant = module_.type_manager_.GetConstantUInt32(meta.descriptor_set);
-    const Constant& binding_constant = module_.type_manager_.GetConstantUInt32(meta.descriptor_binding);
-    const uint32_t descriptor_index_id = CastToUint32(meta.descriptor_index_id, block, inst_it);  // might be int32
+// Even if the layout has bindless descriptors, the other bindings still have their Uninitialized and Destroyed descriptors
+// validated on the CPU at draw time, so the bindless checks for them could never fire and are left out of the shader.
+bool DescriptorIndexingOOBPass::IsBindlessBinding(const Instruction& var_inst, uint32_t set, uint32_t binding) const {
+    if (!module_.has_bindless_descriptors_) {
+        return false;
+    }
+    const auto& lut = module_.set_index_to_bindings_layout_lut_;
+    if (set >= lut.size() || binding >= lut[set].size() || lut[set][binding].bindless != 0) {
+        return true;
+    }
+    // We don't know where the end of a runtime array is on the CPU
+    const Variable* variable = module_.type_manager_.FindVariableById(var_inst.ResultId());
+    return !variable || variable->PointerType(module_.type_manager_)->spv_type_ == SpvType::kRuntimeArray;
+}
+
+// Non bindless descriptors only have their index checked, so a constant index below the binding descriptor count can not fail
+bool DescriptorIndexingOOBPass::IsIndexProvenInBounds(const Instruction& var_inst, uint32_t set, uint32_t binding,
+                                                      uint32_t index_id) const {
+    const auto& lut = module_.set_index_to_bindings_layout_lut_;
+    if (set >= lut.size() || binding >= lut[set].size() || IsBindlessBinding(var_inst, set, binding)) {
+        return false;
+    }
+    const Constant* index_constant = module_.type_manager_.FindConstantById(index_id);
+    if (!index_constant || index_constant->inst_.Opcode() != spv::OpConstant || index_constant->type_.spv_type_ != SpvType::kInt ||
+        index_constant->type_.inst_.Word(2) != 32) {
+        return false;
+    }
+    // A negative signed index is a large unsigned one
+    return index_constant->GetValueUint32() < lut[set][binding].count;
+}
+
+bool DescriptorIndexingOOBPass::IsProvenInBounds(const InstructionMeta& meta) const {
+    if (!IsIndexProvenInBounds(*meta.var_inst, meta.descriptor_set, meta.descriptor_binding, meta.descriptor_index_id)) {
+        return false;
+    }
+    return !meta.sampler_var_inst || IsIndexProvenInBounds(*meta.sampler_var_inst, meta.sampler_descriptor_set,
+                                                           meta.sampler_descriptor_binding, meta.sampler_descriptor_index_id);
+}
 
+void DescriptorIndexingOOBPass::CopySampledImage(BasicBlock& block, InstructionIt* inst_it, const InstructionMeta& meta) {
     if (meta.image_inst) {
         const uint32_t opcode = meta.target_instruction->Opcode();
         if (opcode != spv::OpImageRead && opcode != spv::OpImageFetch && opcode != spv::OpImageWrite) {
@@ -82,6 +117,14 @@ uint32_t DescriptorIndexingOOBPass::CreateFunctionCall(BasicBlock& block, Instru
             }
         }
     }
+}
+
+uint32_t DescriptorIndexingOOBPass::CreateFunctionCall(BasicBlock& block, InstructionIt* inst_it, const InstructionMeta& meta) {
+    const Constant& set_constant = module_.type_manager_.GetConstantUInt32(meta.descriptor_set);
+    const Constant& binding_constant = module_.type_manager_.GetConstantUInt32(meta.descriptor_binding);
+    const uint32_t descriptor_index_id = CastToUint32(meta.descriptor_index_id, block, inst_it);  // might be int32
+
+    CopySampledImage(block, inst_it, meta);
 
     BindingLayout binding_layout = module_.set_index_to_bindings_layout_lut_[meta.descriptor_set][meta.descriptor_binding];
     const Constant& binding_layout_size = module_.type_manager_.GetConstantUInt32(binding_layout.count);
@@ -91,7 +134,8 @@ uint32_t DescriptorIndexingOOBPass::CreateFunctionCall(BasicBlock& block, Instru
     const uint32_t inst_position_id = module_.type_manager_.CreateConstantUInt32(inst_position).Id();
 
     uint32_t function_result = module_.TakeNextId();
-    const uint32_t function_def = GetLinkFunctionId(meta.is_combined_image_sampler);
+    const bool is_bindless = IsBindlessBinding(*meta.var_inst, meta.descriptor_set, meta.descriptor_binding);
+    const uint32_t function_def = GetLinkFunctionId(is_bindless, meta.is_combined_image_sampler);
     const uint32_t bool_type = module_.type_manager_.GetTypeBool().Id();
 
     block.CreateInstruction(spv::OpFunctionCall,
@@ -119,9 +163,13 @@ uint32_t DescriptorIndexingOOBPass::CreateFunctionCall(BasicBlock& block, Instru
         const Constant& sampler_binding_layout_size = module_.type_manager_.GetConstantUInt32(sampler_binding_layout.count);
         const Constant& sampler_binding_layout_offset = module_.type_manager_.GetConstantUInt32(sampler_binding_layout.start);
 
+        const bool is_sampler_bindless =
+            IsBindlessBinding(*meta.sampler_var_inst, meta.sampler_descriptor_set, meta.sampler_descriptor_binding);
+        const uint32_t sampler_function_def = GetLinkFunctionId(is_sampler_bindless, meta.is_combined_image_sampler);
+
         block.CreateInstruction(
             spv::OpFunctionCall,
-            {bool_type, valid_sampler, function_def, inst_position_id, sampler_set_constant.Id(), sampler_binding_constant.Id(),
+            {bool_type, valid_sampler, sampler_function_def, inst_position_id, sampler_set_constant.Id(), sampler_binding_constant.Id(),
              sampler_descriptor_index_id, sampler_binding_layout_size.Id(), sampler_binding_layout_offset.Id()},
             inst_it);
 
@@ -399,6 +447,7 @@ bool DescriptorIndexingOOBPass::Instrument() {
             // Don't clear if the new block occurs from control flow breaking one up
             if (is_original_new_block) {
                 block_instrumented_table_.clear();
+                block_guarded_accesses_.clear();
             }
             is_original_new_block = true;  // Always reset once we start
 
@@ -445,14 +494,41 @@ bool DescriptorIndexingOOBPass::Instrument() {
                     }
                 }
 
-                if (IsMaxInstrumentationsCount()) continue;
-                instrumentations_count_++;
+                const std::array<uint32_t, 6> descriptors = {
+                    meta.descriptor_set,         meta.descriptor_binding,         meta.descriptor_index_id,
+                    meta.sampler_descriptor_set, meta.sampler_descriptor_binding, meta.sampler_descriptor_index_id};
+                uint32_t guard_result_id = 0;
+                if (module_.settings_.safe_mode_targeted) {
+                    if (IsProvenInBounds(meta)) {
+                        continue;
+                    }
+                    for (const GuardedAccess& guarded_access : block_guarded_accesses_) {
+                        if (guarded_access.descriptors == descriptors) {
+                            guard_result_id = guarded_access.result_id;
+                            break;
+                        }
+                    }
+                }
+
+                if (guard_result_id == 0) {
+                    if (IsMaxInstrumentationsCount()) continue;
+                    instrumentations_count_++;
+                }
 
                 if (!module_.settings_.safe_mode) {
                     CreateFunctionCall(current_block, &inst_it, meta);
                 } else {
                     InjectConditionalData ic_data = InjectFunctionPre(*function.get(), block_it, inst_it);
-                    ic_data.function_result_id = CreateFunctionCall(current_block, nullptr, meta);
+                    if (guard_result_id != 0) {
+                        // The check of the same descriptors earlier in the block dominates this access
+                        CopySampledImage(current_block, nullptr, meta);
+                        ic_data.function_result_id = guard_result_id;
+                    } else {
+                        ic_data.function_result_id = CreateFunctionCall(current_block, nullptr, meta);
+                        if (module_.settings_.safe_mode_targeted) {
+                            block_guarded_accesses_.emplace_back(GuardedAccess{descriptors, ic_data.function_result_id});
+                        }
+                    }
                     InjectFunctionPost(current_block, ic_data);
                     // Skip the newly added valid and invalid block. Start searching again from newly split merge block
                     block_it++;
@@ -469,7 +545,7 @@ bool DescriptorIndexingOOBPass::Instrument() {
 
 void DescriptorIndexingOOBPass::PrintDebugInfo() const {
     std::cout << "DescriptorIndexingOOBPass instrumentation count: " << instrumentations_count_ << " ("
-              << (module_.has_bindless_descriptors_ ? "Bindless version" : "Non Bindless version") << ")\n";
+              << (module_.has_bindless_descriptors_ ? "Bindless version for bindless bindings" : "Non Bindless version") << ")\n";
 }
 
 }  // namespace spirv
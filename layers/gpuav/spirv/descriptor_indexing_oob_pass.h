@@ -15,6 +15,8 @@
 #pragma once
 
 #include <stdint.h>
+#include <array>
+#include <vector>
 #include "pass.h"
 
 namespace gpuav {
@@ -50,8 +52,12 @@ class DescriptorIndexingOOBPass : public Pass {
 
     bool RequiresInstrumentation(const Function& function, const Instruction& inst, InstructionMeta& meta);
     uint32_t CreateFunctionCall(BasicBlock& block, InstructionIt* inst_it, const InstructionMeta& meta);
+    void CopySampledImage(BasicBlock& block, InstructionIt* inst_it, const InstructionMeta& meta);
 
-    uint32_t GetLinkFunctionId(bool is_combined_image_sampler);
+    uint32_t GetLinkFunctionId(bool is_bindless, bool is_combined_image_sampler);
+    bool IsBindlessBinding(const Instruction& var_inst, uint32_t set, uint32_t binding) const;
+    bool IsIndexProvenInBounds(const Instruction& var_inst, uint32_t set, uint32_t binding, uint32_t index_id) const;
+    bool IsProvenInBounds(const InstructionMeta& meta) const;
 
     // < original ID, new CopyObject ID >
     vvl::unordered_map<uint32_t, uint32_t> copy_object_map_;
@@ -61,6 +67,14 @@ class DescriptorIndexingOOBPass : public Pass {
     // < Variable ID, [descriptor index IDs accessed with this variable >
     vvl::unordered_map<uint32_t, vvl::unordered_set<uint32_t>> block_instrumented_table_;
 
+    // For targeted safe mode, the checks already done in the block, a later access to the same descriptors branches on their
+    // result instead of being checked again
+    struct GuardedAccess {
+        std::array<uint32_t, 6> descriptors;  // set, binding and index ID of the image (or buffer) and of the sampler
+        uint32_t result_id;
+    };
+    std::vector<GuardedAccess> block_guarded_accesses_;
+
     // Function IDs to link in
     uint32_t link_bindless_id_ = 0;
     uint32_t link_bindless_combined_image_sampler_id_ = 0;
@@ -104,6 +104,10 @@ struct Function {
     vvl::unordered_map<uint32_t, const Instruction*> inst_map_;
     const Instruction* FindInstruction(uint32_t id) const;
 
+    // Every opcode found in the blocks when the function was parsed (or linked in).
+    // Lets a pass skip the function without walking it if none of the opcodes it instruments are present.
+    vvl::unordered_set<uint32_t> opcodes_;
+
     // A slower version of BasicBlock::CreateInstruction() that will search the entire function for |id| and then inject the
     // instruction after. Only to be used if you need to suddenly walk back to find an instruction, but normally instructions should
     // be added as you go forward only.
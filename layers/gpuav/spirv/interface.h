@@ -45,6 +45,9 @@ namespace spirv {
 struct BindingLayout {
     uint32_t start;
     uint32_t count;
+    // Non-zero if the binding is "bindless" (see vvl::IsBindless), only then does the instrumentation need to check for
+    // Uninitialized and Destroyed descriptors. (uint32_t to keep the struct free of padding as it is hashed)
+    uint32_t bindless = 0;
 };
 
 // When running the DebugPrintf pass, if we detect an instrumented shader has a printf call (for debugging) we can hold them until
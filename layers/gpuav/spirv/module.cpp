@@ -218,6 +218,7 @@ Module::Module(vvl::span<const uint32_t> words, DebugReport* debug_report, const
         } else if (function_end_found) {
             current_function->post_block_inst_.emplace_back(std::move(new_inst));
         } else if (block_found) {
+            current_function->opcodes_.insert(opcode);
             current_block->instructions_.emplace_back(std::move(new_inst));
         } else {
             current_function->pre_block_inst_.emplace_back(std::move(new_inst));
@@ -227,6 +228,17 @@ Module::Module(vvl::span<const uint32_t> words, DebugReport* debug_report, const
     }
 }
 
+uint32_t Module::CountFunctionInstructions() const {
+    uint32_t count = 0;
+    for (const auto& function : functions_) {
+        count += static_cast<uint32_t>(function->pre_block_inst_.size() + function->post_block_inst_.size());
+        for (const auto& block : function->blocks_) {
+            count += static_cast<uint32_t>(block->instructions_.size());
+        }
+    }
+    return count;
+}
+
 bool Module::HasCapability(spv::Capability capability) {
     for (const auto& inst : capabilities_) {
         if (inst->Word(1) == capability) {
@@ -692,6 +704,7 @@ void Module::LinkFunctions(const LinkInfo& info) {
             }
 
             if (link_basic_block) {
+                new_function->opcodes_.insert(new_inst->Opcode());
                 // Need for a possible FindInstruction() lookup
                 link_basic_block->instructions_.emplace_back(std::move(new_inst));
             } else {
@@ -48,6 +48,9 @@ struct Settings {
     // When off (unsafe mode) reduce amount of work so compiling the pipeline/shader is quicker
     // This is a global setting for all passes
     bool safe_mode;
+    // With safe_mode, the accesses the passes can prove are valid (ex: constant index into a fixed size descriptor array), or
+    // that a check earlier in the same block already covers, are not checked again
+    bool safe_mode_targeted;
     // Used to help debug
     bool print_debug_info;
     // zero is same as "unlimited"
@@ -105,6 +108,9 @@ class Module {
 
     // Helpers
     bool HasCapability(spv::Capability capability);
+
+    // Number of instructions inside all functions, used to report how much each pass grew the shader
+    uint32_t CountFunctionInstructions() const;
     void AddCapability(spv::Capability capability);
     void AddExtension(const char* extension);
     void AddDebugName(const char* name, uint32_t id);
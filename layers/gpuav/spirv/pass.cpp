@@ -14,7 +14,9 @@
  */
 
 #include "pass.h"
+#include <chrono>
 #include <cstdint>
+#include <iostream>
 #include <spirv/unified1/spirv.hpp>
 #include "function_basic_block.h"
 #include "generated/spirv_grammar_helper.h"
@@ -27,9 +29,37 @@ namespace gpuav {
 namespace spirv {
 
 bool Pass::Run() {
+    if (!target_opcodes_.empty()) {
+        bool has_target = false;
+        for (const auto& function : module_.functions_) {
+            if (HasTargetOpcode(*function)) {
+                has_target = true;
+                break;
+            }
+        }
+        if (!has_target) {
+            return false;  // nothing this pass instruments is in the module
+        }
+    }
+
+    const bool print_debug_info = module_.settings_.print_debug_info;
+    uint32_t instruction_count_before = 0;
+    std::chrono::steady_clock::time_point start_time;
+    if (print_debug_info) {
+        instruction_count_before = module_.CountFunctionInstructions();
+        start_time = std::chrono::steady_clock::now();
+    }
+
     const bool modified = Instrument();
-    if (module_.settings_.print_debug_info) {
+
+    if (print_debug_info) {
+        const auto elapsed_us =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time).count();
         PrintDebugInfo();
+        // Single key=value line per pass so the cost of each pass can be collected across shaders with a script
+        std::cout << "GPUAV_PASS_STATS shader_id=" << module_.settings_.shader_id << " pass=" << Name()
+                  << " checks=" << instrumentations_count_ << " instructions_before=" << instruction_count_before
+                  << " instructions_after=" << module_.CountFunctionInstructions() << " time_us=" << elapsed_us << '\n';
     }
 
     // Detect if any functions were applied that we need to add now
@@ -39,6 +69,18 @@ bool Pass::Run() {
     return modified;
 }
 
+bool Pass::HasTargetOpcode(const Function& function) const {
+    if (target_opcodes_.empty()) {
+        return true;
+    }
+    for (uint32_t opcode : target_opcodes_) {
+        if (function.opcodes_.find(opcode) != function.opcodes_.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 const Variable& Pass::GetBuiltinVariable(uint32_t built_in) {
     uint32_t variable_id = 0;
     for (const auto& annotation : module_.annotations_) {
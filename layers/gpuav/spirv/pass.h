@@ -74,6 +74,9 @@ class Pass {
 
     bool IsMaxInstrumentationsCount() const;
 
+    // Uses the opcode census of the function to know if there could be anything to instrument in it
+    bool HasTargetOpcode(const Function& function) const;
+
     InjectConditionalData InjectFunctionPre(Function& function, const BasicBlockIt original_block_it, InstructionIt inst_it);
     void InjectFunctionPost(BasicBlock& original_block, const InjectConditionalData& ic_data);
 
@@ -87,6 +90,10 @@ class Pass {
 
     uint32_t instrumentations_count_ = 0;
 
+    // Opcodes RequiresInstrumentation() can return true for, set by the passes that only look at a few opcodes.
+    // If no function contains any of them, Run() will not walk the module at all. Empty means any instruction could be a target.
+    std::vector<uint32_t> target_opcodes_;
+
     // This is a very basic amount of Control Flow helpers to help track during any pass
     struct ControlFlow {
         bool in_loop = false;
@@ -28,7 +28,10 @@ const static OfflineModule kOfflineModule = {instrumentation_ray_query_comp, ins
 
 const static OfflineFunction kOfflineFunction = {"inst_ray_query", instrumentation_ray_query_comp_function_0_offset};
 
-RayQueryPass::RayQueryPass(Module& module) : Pass(module, kOfflineModule) { module.use_bda_ = true; }
+RayQueryPass::RayQueryPass(Module& module) : Pass(module, kOfflineModule) {
+    module.use_bda_ = true;
+    target_opcodes_ = {spv::OpRayQueryInitializeKHR};
+}
 
 // By appending the LinkInfo, it will attempt at linking stage to add the function.
 uint32_t RayQueryPass::GetLinkFunctionId() { return GetLinkFunction(link_function_id_, kOfflineFunction); }
@@ -69,6 +72,7 @@ bool RayQueryPass::Instrument() {
     // Can safely loop function list as there is no injecting of new Functions until linking time
     for (const auto& function : module_.functions_) {
         if (function->instrumentation_added_) continue;
+        if (!HasTargetOpcode(*function)) continue;
         for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
             BasicBlock& current_block = **block_it;
 
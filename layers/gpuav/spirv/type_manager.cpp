@@ -21,6 +21,9 @@
 namespace gpuav {
 namespace spirv {
 
+// Key for the lookup maps made of 2 words
+static inline uint64_t PackKey(uint32_t high, uint32_t low) { return (uint64_t(high) << 32) | low; }
+
 // Simplest way to check if same type is see if items line up.
 // Even if types have an RefId, it should be the same unless there are already duplicated types.
 bool Type::operator==(Type const& other) const {
@@ -92,7 +95,8 @@ const Type& TypeManager::AddType(std::unique_ptr<Instruction> new_inst, SpvType
             runtime_array_types_.push_back(new_type);
             break;
         case SpvType::kPointer:
-            pointer_types_.push_back(new_type);
+            // If there are duplicates, keep the first one found
+            pointer_types_.emplace(PackKey(inst->Word(2), inst->Word(3)), new_type);
             break;
         case SpvType::kForwardPointer:
             forward_pointer_types_.push_back(new_type);
@@ -351,15 +355,9 @@ const Type& TypeManager::GetTypeSampledImage(const Type& image_type) {
 }
 
 const Type& TypeManager::GetTypePointer(spv::StorageClass storage_class, const Type& pointer_type) {
-    for (const auto type : pointer_types_) {
-        if (type->inst_.Word(2) != storage_class) {
-            continue;
-        }
-
-        const Type* this_pointer_type = FindTypeById(type->inst_.Word(3));
-        if (this_pointer_type && (*this_pointer_type == pointer_type)) {
-            return *type;
-        }
+    auto it = pointer_types_.find(PackKey(uint32_t(storage_class), pointer_type.Id()));
+    if (it != pointer_types_.end()) {
+        return *it->second;
     }
 
     const uint32_t type_id = module_.TakeNextId();
@@ -478,10 +476,11 @@ const Constant& TypeManager::AddConstant(std::unique_ptr<Instruction> new_inst,
     const Constant* new_constant = id_to_constant_[inst->ResultId()].get();
 
     if (inst->Opcode() == spv::OpConstant) {
+        // If there are duplicates, keep the first one found
         if (type.inst_.Opcode() == spv::OpTypeInt && type.inst_.Word(2) == 32) {
-            int_32bit_constants_.push_back(new_constant);
+            int_32bit_constants_.emplace(PackKey(type.Id(), inst->Word(3)), new_constant);
         } else if (type.inst_.Opcode() == spv::OpTypeFloat && type.inst_.Word(2) == 32) {
-            float_32bit_constants_.push_back(new_constant);
+            float_32bit_constants_.emplace(PackKey(type.Id(), inst->Word(3)), new_constant);
         }
     } else if (inst->Opcode() == spv::OpConstantNull) {
         null_constants_.push_back(new_constant);
@@ -491,21 +490,13 @@ const Constant& TypeManager::AddConstant(std::unique_ptr<Instruction> new_inst,
 }
 
 const Constant* TypeManager::FindConstantInt32(uint32_t type_id, uint32_t value) const {
-    for (const auto constant : int_32bit_constants_) {
-        if (constant->type_.Id() == type_id && value == constant->inst_.Word(3)) {
-            return constant;
-        }
-    }
-    return nullptr;
+    auto it = int_32bit_constants_.find(PackKey(type_id, value));
+    return (it == int_32bit_constants_.end()) ? nullptr : it->second;
 }
 
 const Constant* TypeManager::FindConstantFloat32(uint32_t type_id, uint32_t value) const {
-    for (const auto constant : float_32bit_constants_) {
-        if (constant->type_.Id() == type_id && value == constant->inst_.Word(3)) {
-            return constant;
-        }
-    }
-    return nullptr;
+    auto it = float_32bit_constants_.find(PackKey(type_id, value));
+    return (it == float_32bit_constants_.end()) ? nullptr : it->second;
 }
 
 const Constant* TypeManager::FindConstantById(uint32_t id) const {
@@ -180,14 +180,18 @@ class TypeManager {
     std::vector<const Type*> sampled_image_types_;
     std::vector<const Type*> array_types_;
     std::vector<const Type*> runtime_array_types_;
-    std::vector<const Type*> pointer_types_;
+    // Large shaders have a pointer type for nearly every storage class/type combination, so look them up by
+    // < storage class | pointee type ID >
+    vvl::unordered_map<uint64_t, const Type*> pointer_types_;
     std::vector<const Type*> forward_pointer_types_;
     std::vector<const Type*> function_types_;
     // Only for types we want to avoid when linking
     std::vector<const Type*> linking_struct_types_;
 
-    std::vector<const Constant*> int_32bit_constants_;
-    std::vector<const Constant*> float_32bit_constants_;
+    // Large shaders can have thousands of constants and passes look them up for every instrumented instruction
+    // < type ID | value >
+    vvl::unordered_map<uint64_t, const Constant*> int_32bit_constants_;
+    vvl::unordered_map<uint64_t, const Constant*> float_32bit_constants_;
     const Constant* uint_32bit_zero_constants_ = nullptr;
     const Constant* float_32bit_zero_constants_ = nullptr;
     const Constant* vec3_zero_constants_ = nullptr;
@@ -23,6 +23,7 @@
 #include "gpuav/shaders/gpuav_error_header.h"
 #include "gpuav/shaders/validation_cmd/push_data.h"
 #include "generated/gpuav_offline_spirv.h"
+#include "profiling/profiling.h"
 #include "containers/limits.h"
 
 namespace gpuav {
@@ -97,6 +98,14 @@ void CopyBufferToImage(Validator &gpuav, const Location &loc, CommandBufferSubSt
         return;
     }
 
+    // Streaming code can record many copies only touching the stencil aspect, do not pay for any validation resources then
+    const auto regions = vvl::make_span(copy_buffer_to_img_info->pRegions, copy_buffer_to_img_info->regionCount);
+    if (std::none_of(regions.begin(), regions.end(), [](const VkBufferImageCopy2 &region) {
+            return region.imageSubresource.aspectMask == VK_IMAGE_ASPECT_DEPTH_BIT;
+        })) {
+        return;
+    }
+
     ValidationCommandsCommon &val_cmd_common =
         cb_state.shared_resources_cache.GetOrCreate<ValidationCommandsCommon>(gpuav, cb_state, loc);
     valpipe::ComputePipeline<CopyBufferToImageValidationShader> &validation_pipeline =
@@ -115,9 +124,7 @@ void CopyBufferToImage(Validator &gpuav, const Location &loc, CommandBufferSubSt
         CopyBufferToImageValidationShader shader_resources;
 
         // Allocate buffer that will be used to store pRegions
-        uint32_t max_texels_count_in_regions = copy_buffer_to_img_info->pRegions[0].imageExtent.width *
-                                               copy_buffer_to_img_info->pRegions[0].imageExtent.height *
-                                               copy_buffer_to_img_info->pRegions[0].imageExtent.depth;
+        uint32_t max_texels_count_in_regions = 0;
 
         // Needs to be kept in sync with copy_buffer_to_image.comp
         struct BufferImageCopy {
@@ -152,7 +159,7 @@ void CopyBufferToImage(Validator &gpuav, const Location &loc, CommandBufferSubSt
         uint32_t gpu_regions_count = 0;
         BufferImageCopy *gpu_regions_ptr =
             reinterpret_cast<BufferImageCopy *>(&gpu_regions_u32_ptr[uniform_buffer_constants_byte_size / sizeof(uint32_t)]);
-        for (const auto &cpu_region : vvl::make_span(copy_buffer_to_img_info->pRegions, copy_buffer_to_img_info->regionCount)) {
+        for (const auto &cpu_region : regions) {
             if (cpu_region.imageSubresource.aspectMask != VK_IMAGE_ASPECT_DEPTH_BIT) {
                 continue;
             }
@@ -187,11 +194,11 @@ void CopyBufferToImage(Validator &gpuav, const Location &loc, CommandBufferSubSt
                          cpu_region.imageExtent.width * cpu_region.imageExtent.height * cpu_region.imageExtent.depth);
 
             ++gpu_regions_count;
+        }
 
-            if (gpu_regions_count == 0) {
-                // Nothing to validate
-                return;
-            }
+        if (gpu_regions_count == 0) {
+            // Nothing to validate
+            return;
         }
 
         gpu_regions_u32_ptr[0] = image_state->create_info.extent.width;
@@ -219,6 +226,7 @@ void CopyBufferToImage(Validator &gpuav, const Location &loc, CommandBufferSubSt
     // Setup validation pipeline
     // ---
     {
+        VVL_TracyVkZone(GetTracyVkCtx(), cb_state.VkHandle(), "gpuav_valcmd_copy_buffer_to_image");
         DispatchCmdBindPipeline(cb_state.VkHandle(), VK_PIPELINE_BIND_POINT_COMPUTE, validation_pipeline.pipeline);
 
         DispatchCmdDispatch(cb_state.VkHandle(), group_count_x, 1, 1);
@@ -226,7 +234,7 @@ void CopyBufferToImage(Validator &gpuav, const Location &loc, CommandBufferSubSt
 
     CommandBufferSubState::ErrorLoggerFunc error_logger = [&gpuav, loc, src_buffer = copy_buffer_to_img_info->srcBuffer](
                                                               const uint32_t *error_record, const LogObjectList &objlist,
-                                                              const std::vector<std::string> &) {
+                                                              const vvl::LabelStack &) {
         bool skip = false;
         using namespace glsl;
 
@@ -22,6 +22,7 @@
 #include "gpuav/shaders/gpuav_error_header.h"
 #include "gpuav/shaders/validation_cmd/push_data.h"
 #include "generated/gpuav_offline_spirv.h"
+#include "profiling/profiling.h"
 
 namespace gpuav {
 namespace valcmd {
@@ -100,13 +101,14 @@ void DispatchIndirect(Validator &gpuav, const Location &loc, CommandBufferSubSta
     // Setup validation pipeline
     // ---
     {
+        VVL_TracyVkZone(GetTracyVkCtx(), cb_state.VkHandle(), "gpuav_valcmd_dispatch_indirect");
         DispatchCmdBindPipeline(cb_state.VkHandle(), VK_PIPELINE_BIND_POINT_COMPUTE, validation_pipeline.pipeline);
 
         DispatchCmdDispatch(cb_state.VkHandle(), 1, 1, 1);
     }
 
     CommandBufferSubState::ErrorLoggerFunc error_logger = [&gpuav, loc](const uint32_t *error_record, const LogObjectList &objlist,
-                                                                        const std::vector<std::string> &) {
+                                                                        const vvl::LabelStack &) {
         bool skip = false;
         using namespace glsl;
 
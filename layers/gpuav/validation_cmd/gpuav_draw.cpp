@@ -61,21 +61,62 @@ struct SharedDrawValidationResources {
 
 using ValidationCommandFunc = stdext::inplace_function<void(Validator &gpuav, CommandBufferSubState &cb_state), 192>;
 struct ValidationCmdCbState {
+    // Commands computing the parameters of the indirect dispatches of per_render_pass_validation_commands
+    std::vector<ValidationCommandFunc> per_render_pass_setup_commands;
     std::vector<ValidationCommandFunc> per_render_pass_validation_commands;
 };
 
+// All validation commands of a render pass are recorded back to back, and only share synchronization:
+// each category of commands only reads user buffers, and reports errors using atomics, so its dispatches need no barriers between
+// them. Validating thousands of indirect draws thus costs 3 pipeline barriers instead of 1 to 3 per draw.
 void FlushValidationCmds(Validator &gpuav, CommandBufferSubState &cb_state) {
     ValidationCmdCbState *val_cmd_cb_state = cb_state.shared_resources_cache.TryGet<ValidationCmdCbState>();
-    if (!val_cmd_cb_state) {
+    if (!val_cmd_cb_state || val_cmd_cb_state->per_render_pass_validation_commands.empty()) {
         return;
     }
 
     valpipe::RestorablePipelineState restorable_state(cb_state, VK_PIPELINE_BIND_POINT_COMPUTE);
+    VVL_TracyVkZone(GetTracyVkCtx(), cb_state.VkHandle(), "gpuav_valcmd_draws");
+
+    if (!val_cmd_cb_state->per_render_pass_setup_commands.empty()) {
+        // Sync indirect buffer writes - the same command buffer could be executed concurrently
+        // for all we know
+        {
+            VkMemoryBarrier barrier_write_after_read = vku::InitStructHelper();
+            barrier_write_after_read.srcAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+            barrier_write_after_read.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+            DispatchCmdPipelineBarrier(cb_state.VkHandle(), VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+                                       VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &barrier_write_after_read, 0, nullptr, 0,
+                                       nullptr);
+        }
+
+        for (auto &setup_cmd : val_cmd_cb_state->per_render_pass_setup_commands) {
+            setup_cmd(gpuav, cb_state);
+        }
+        val_cmd_cb_state->per_render_pass_setup_commands.clear();
+
+        // Sync indirect buffer reads
+        {
+            VkMemoryBarrier barrier_read_after_write = vku::InitStructHelper();
+            barrier_read_after_write.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+            barrier_read_after_write.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+            DispatchCmdPipelineBarrier(cb_state.VkHandle(), VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                       VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, 0, 1, &barrier_read_after_write, 0, nullptr, 0,
+                                       nullptr);
+        }
+    }
 
     for (auto &validation_cmd : val_cmd_cb_state->per_render_pass_validation_commands) {
         validation_cmd(gpuav, cb_state);
     }
     val_cmd_cb_state->per_render_pass_validation_commands.clear();
+
+    // synchronize draw buffers validation (read) against subsequent writes
+    VkMemoryBarrier barrier_write_after_read = vku::InitStructHelper();
+    barrier_write_after_read.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    barrier_write_after_read.dstAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+    DispatchCmdPipelineBarrier(cb_state.VkHandle(), VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1,
+                               &barrier_write_after_read, 0, nullptr, 0, nullptr);
 }
 
 struct FirstInstanceValidationShader {
@@ -212,30 +253,6 @@ void FirstInstance(Validator &gpuav, CommandBufferSubState &cb_state, const Loca
 
             VVL_TracyPlot("gpuav::valcmd::FirstInstance Dispatch size", int64_t(work_group_count));
             DispatchCmdDispatch(cb_state.VkHandle(), work_group_count, 1, 1);
-
-            // synchronize draw buffer validation (read) against subsequent writes
-            std::array<VkBufferMemoryBarrier, 2> buffer_memory_barriers = {};
-            uint32_t buffer_memory_barriers_count = 1;
-            buffer_memory_barriers[0] = vku::InitStructHelper();
-            buffer_memory_barriers[0].srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
-            buffer_memory_barriers[0].dstAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
-            buffer_memory_barriers[0].buffer = api_buffer;
-            buffer_memory_barriers[0].offset = api_offset;
-            buffer_memory_barriers[0].size = work_group_count * sizeof(uint32_t);
-
-            if (api_count_buffer) {
-                buffer_memory_barriers[1] = vku::InitStructHelper();
-                buffer_memory_barriers[1].srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
-                buffer_memory_barriers[1].dstAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
-                buffer_memory_barriers[1].buffer = api_count_buffer;
-                buffer_memory_barriers[1].offset = api_count_buffer_offset;
-                buffer_memory_barriers[1].size = sizeof(uint32_t);
-                ++buffer_memory_barriers_count;
-            }
-
-            DispatchCmdPipelineBarrier(cb_state.VkHandle(), VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT,
-                                       VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, buffer_memory_barriers_count,
-                                       buffer_memory_barriers.data(), 0, nullptr);
         }
     };
 
@@ -248,7 +265,7 @@ void FirstInstance(Validator &gpuav, CommandBufferSubState &cb_state, const Loca
         !cb_state.base.GetLabelCommands().empty() ? uint32_t(cb_state.base.GetLabelCommands().size() - 1) : vvl::kU32Max;
     ErrorLoggerFunc error_logger = [&gpuav, &cb_state, loc, vuid, api_struct_name, label_command_i](
                                        const uint32_t *error_record, const LogObjectList &objlist,
-                                       const std::vector<std::string> &initial_label_stack) {
+                                       const vvl::LabelStack &initial_label_stack) {
         bool skip = false;
         using namespace glsl;
 
@@ -389,17 +406,6 @@ void CountBuffer(Validator &gpuav, CommandBufferSubState &cb_state, const Locati
         {
             DispatchCmdBindPipeline(cb_state.VkHandle(), VK_PIPELINE_BIND_POINT_COMPUTE, validation_pipeline.pipeline);
             DispatchCmdDispatch(cb_state.VkHandle(), 1, 1, 1);
-            // synchronize draw buffer validation (read) against subsequent writes
-            VkBufferMemoryBarrier count_buffer_memory_barrier = vku::InitStructHelper();
-            count_buffer_memory_barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
-            count_buffer_memory_barrier.dstAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
-            count_buffer_memory_barrier.buffer = api_count_buffer;
-            count_buffer_memory_barrier.offset = api_count_buffer_offset;
-            count_buffer_memory_barrier.size = sizeof(uint32_t);
-
-            DispatchCmdPipelineBarrier(cb_state.VkHandle(), VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT,
-                                       VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 1, &count_buffer_memory_barrier, 0,
-                                       nullptr);
         }
     };
 
@@ -413,7 +419,7 @@ void CountBuffer(Validator &gpuav, CommandBufferSubState &cb_state, const Locati
     ErrorLoggerFunc error_logger = [&gpuav, &cb_state, loc, api_buffer, draw_buffer_size = draw_buffer_state->create_info.size,
                                     api_offset, api_struct_size_byte, api_stride, api_struct_name, vuid,
                                     label_command_i](const uint32_t *error_record, const LogObjectList &objlist,
-                                                     const std::vector<std::string> &initial_label_stack) {
+                                                     const vvl::LabelStack &initial_label_stack) {
         bool skip = false;
         using namespace glsl;
 
@@ -592,30 +598,6 @@ void DrawMeshIndirect(Validator &gpuav, CommandBufferSubState &cb_state, const L
                 const uint32_t work_group_count = std::min(api_draw_count, max_held_draw_cmds);
                 VVL_TracyPlot("gpuav::valcmd::DrawMeshIndirect Dispatch size", int64_t(work_group_count));
                 DispatchCmdDispatch(cb_state.VkHandle(), work_group_count, 1, 1);
-
-                // synchronize draw buffer validation (read) against subsequent writes
-                std::array<VkBufferMemoryBarrier, 2> buffer_memory_barriers = {};
-                uint32_t buffer_memory_barriers_count = 1;
-                buffer_memory_barriers[0] = vku::InitStructHelper();
-                buffer_memory_barriers[0].srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
-                buffer_memory_barriers[0].dstAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
-                buffer_memory_barriers[0].buffer = api_buffer;
-                buffer_memory_barriers[0].offset = api_offset;
-                buffer_memory_barriers[0].size = work_group_count * sizeof(uint32_t);
-
-                if (api_count_buffer) {
-                    buffer_memory_barriers[1] = vku::InitStructHelper();
-                    buffer_memory_barriers[1].srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
-                    buffer_memory_barriers[1].dstAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
-                    buffer_memory_barriers[1].buffer = api_count_buffer;
-                    buffer_memory_barriers[1].offset = api_count_buffer_offset;
-                    buffer_memory_barriers[1].size = sizeof(uint32_t);
-                    ++buffer_memory_barriers_count;
-                }
-
-                DispatchCmdPipelineBarrier(cb_state.VkHandle(), VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT,
-                                           VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, buffer_memory_barriers_count,
-                                           buffer_memory_barriers.data(), 0, nullptr);
             }
         };
 
@@ -628,7 +610,7 @@ void DrawMeshIndirect(Validator &gpuav, CommandBufferSubState &cb_state, const L
         !cb_state.base.GetLabelCommands().empty() ? uint32_t(cb_state.base.GetLabelCommands().size() - 1) : vvl::kU32Max;
     ErrorLoggerFunc error_logger = [&gpuav, &cb_state, loc, is_task_shader, label_command_i](
                                        const uint32_t *error_record, const LogObjectList &objlist,
-                                       const std::vector<std::string> &initial_label_stack) {
+                                       const vvl::LabelStack &initial_label_stack) {
         bool skip = false;
         using namespace glsl;
 
@@ -837,11 +819,32 @@ void DrawIndexedIndirectIndexBuffer(Validator &gpuav, CommandBufferSubState &cb_
         return;
     }
 
-    ValidationCommandFunc validation_cmd = [index_buffer_binding = cb_state.base.index_buffer_binding, api_buffer, api_offset,
-                                            api_stride, api_draw_count, api_count_buffer, api_count_buffer_offset,
-                                            draw_i = cb_state.draw_index,
-                                            error_logger_i = uint32_t(cb_state.per_command_error_loggers.size()),
-                                            loc](Validator &gpuav, CommandBufferSubState &cb_state) {
+    // Parameters of the validation indirect dispatch, written by the setup dispatch
+    vko::BufferRange validation_dispatch_params_buffer_range =
+        cb_state.gpu_resources_manager.GetDeviceLocalIndirectBufferRange(3 * sizeof(uint32_t));
+    if (validation_dispatch_params_buffer_range.buffer == VK_NULL_HANDLE) {
+        return;
+    }
+
+    const uint32_t index_bits_size = GetIndexBitsSize(cb_state.base.index_buffer_binding.index_type);
+    const uint32_t max_indices_in_buffer = static_cast<uint32_t>(cb_state.base.index_buffer_binding.size / (index_bits_size / 8u));
+
+    glsl::DrawIndexedIndirectIndexBufferPushData push_constants{};
+    if (api_count_buffer != VK_NULL_HANDLE) {
+        push_constants.flags |= glsl::kIndexedIndirectDrawFlags_DrawCountFromBuffer;
+        push_constants.api_count_buffer_offset_dwords = uint32_t(api_count_buffer_offset / sizeof(uint32_t));
+    }
+    push_constants.api_stride_dwords = api_stride / sizeof(uint32_t);
+    push_constants.bound_index_buffer_indices_count = max_indices_in_buffer;
+    push_constants.api_draw_count = api_draw_count;
+    push_constants.api_offset_dwords = uint32_t(api_offset / sizeof(uint32_t));
+
+    // Draw count being stored in a GPU buffer,
+    // setup a compute pipeline to determine the size of the validation indirect dispatch
+    ValidationCommandFunc setup_validation_cmd = [push_constants, api_count_buffer,
+                                                  dispatch_params_buffer = validation_dispatch_params_buffer_range.buffer,
+                                                  dispatch_params_offset = validation_dispatch_params_buffer_range.offset,
+                                                  loc](Validator &gpuav, CommandBufferSubState &cb_state) {
         SharedDrawValidationResources &shared_draw_validation_resources =
             gpuav.shared_resources_manager.GetOrCreate<SharedDrawValidationResources>(gpuav);
         if (!shared_draw_validation_resources.valid) {
@@ -852,6 +855,38 @@ void DrawIndexedIndirectIndexBuffer(Validator &gpuav, CommandBufferSubState &cb_
         if (!setup_validation_dispatch_pipeline.valid) {
             return;
         }
+
+        SetupDrawCountDispatchIndirectShader setup_validation_shader_resources;
+        setup_validation_shader_resources.push_constants = push_constants;
+        if (api_count_buffer != VK_NULL_HANDLE) {
+            setup_validation_shader_resources.count_buffer_binding.info = {api_count_buffer, 0, sizeof(uint32_t)};
+        } else {
+            setup_validation_shader_resources.count_buffer_binding.info = {shared_draw_validation_resources.dummy_buffer.VkHandle(),
+                                                                           0, VK_WHOLE_SIZE};
+        }
+
+        setup_validation_shader_resources.dispatch_indirect_buffer_binding.info = {dispatch_params_buffer, dispatch_params_offset,
+                                                                                   3 * sizeof(uint32_t)};
+
+        if (!setup_validation_dispatch_pipeline.BindShaderResources(gpuav, cb_state, setup_validation_shader_resources)) {
+            return;
+        }
+
+        DispatchCmdBindPipeline(cb_state.VkHandle(), VK_PIPELINE_BIND_POINT_COMPUTE, setup_validation_dispatch_pipeline.pipeline);
+        DispatchCmdDispatch(cb_state.VkHandle(), 1, 1, 1);
+    };
+
+    ValidationCommandFunc validation_cmd = [push_constants, api_buffer, api_count_buffer,
+                                            dispatch_params_buffer = validation_dispatch_params_buffer_range.buffer,
+                                            dispatch_params_offset = validation_dispatch_params_buffer_range.offset,
+                                            draw_i = cb_state.draw_index,
+                                            error_logger_i = uint32_t(cb_state.per_command_error_loggers.size()),
+                                            loc](Validator &gpuav, CommandBufferSubState &cb_state) {
+        SharedDrawValidationResources &shared_draw_validation_resources =
+            gpuav.shared_resources_manager.GetOrCreate<SharedDrawValidationResources>(gpuav);
+        if (!shared_draw_validation_resources.valid) {
+            return;
+        }
         ValidationCommandsCommon &val_cmd_common =
             cb_state.shared_resources_cache.GetOrCreate<ValidationCommandsCommon>(gpuav, cb_state, loc);
         valpipe::ComputePipeline<DrawIndexedIndirectIndexBufferShader> &validation_pipeline =
@@ -861,129 +896,28 @@ void DrawIndexedIndirectIndexBuffer(Validator &gpuav, CommandBufferSubState &cb_
             return;
         }
 
-        const uint32_t index_bits_size = GetIndexBitsSize(index_buffer_binding.index_type);
-        const uint32_t max_indices_in_buffer = static_cast<uint32_t>(index_buffer_binding.size / (index_bits_size / 8u));
-
-        vko::BufferRange validation_dispatch_params_buffer_range =
-            cb_state.gpu_resources_manager.GetDeviceLocalIndirectBufferRange(3 * sizeof(uint32_t));
-
-        if (validation_dispatch_params_buffer_range.buffer == VK_NULL_HANDLE) {
-            return;
-        }
-
-        glsl::DrawIndexedIndirectIndexBufferPushData push_constants{};
+        DrawIndexedIndirectIndexBufferShader validation_shader_resources;
+        validation_shader_resources.push_constants = push_constants;
         if (api_count_buffer != VK_NULL_HANDLE) {
-            push_constants.flags |= glsl::kIndexedIndirectDrawFlags_DrawCountFromBuffer;
-            push_constants.api_count_buffer_offset_dwords = uint32_t(api_count_buffer_offset / sizeof(uint32_t));
+            validation_shader_resources.count_buffer_binding.info = {api_count_buffer, 0, sizeof(uint32_t)};
+        } else {
+            validation_shader_resources.count_buffer_binding.info = {shared_draw_validation_resources.dummy_buffer.VkHandle(), 0,
+                                                                     VK_WHOLE_SIZE};
         }
-        push_constants.api_stride_dwords = api_stride / sizeof(uint32_t);
-        push_constants.bound_index_buffer_indices_count = max_indices_in_buffer;
-        push_constants.api_draw_count = api_draw_count;
-        push_constants.api_offset_dwords = uint32_t(api_offset / sizeof(uint32_t));
-
-        // Draw count being stored in a GPU buffer,
-        // setup a compute pipeline to determine the size of the validation indirect dispatch
-        {
-            SetupDrawCountDispatchIndirectShader setup_validation_shader_resources;
-            setup_validation_shader_resources.push_constants = push_constants;
-            if (api_count_buffer != VK_NULL_HANDLE) {
-                setup_validation_shader_resources.count_buffer_binding.info = {api_count_buffer, 0, sizeof(uint32_t)};
-            } else {
-                setup_validation_shader_resources.count_buffer_binding.info = {
-                    shared_draw_validation_resources.dummy_buffer.VkHandle(), 0, VK_WHOLE_SIZE};
-            }
-
-            setup_validation_shader_resources.dispatch_indirect_buffer_binding.info = {
-                validation_dispatch_params_buffer_range.buffer, validation_dispatch_params_buffer_range.offset,
-                validation_dispatch_params_buffer_range.size};
-
-            if (!setup_validation_dispatch_pipeline.BindShaderResources(gpuav, cb_state, setup_validation_shader_resources)) {
-                return;
-            }
-
-            DispatchCmdBindPipeline(cb_state.VkHandle(), VK_PIPELINE_BIND_POINT_COMPUTE,
-                                    setup_validation_dispatch_pipeline.pipeline);
-
-            // Sync indirect buffer writes - the same command buffer could be executed concurrently
-            // for all we know
-            {
-                VkBufferMemoryBarrier barrier_write_after_read = vku::InitStructHelper();
-                barrier_write_after_read.srcAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
-                barrier_write_after_read.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
-                barrier_write_after_read.buffer = validation_dispatch_params_buffer_range.buffer;
-                barrier_write_after_read.offset = validation_dispatch_params_buffer_range.offset;
-                barrier_write_after_read.size = validation_dispatch_params_buffer_range.size;
-
-                DispatchCmdPipelineBarrier(cb_state.VkHandle(), VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
-                                           VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 1, &barrier_write_after_read, 0,
-                                           nullptr);
-            }
-
-            DispatchCmdDispatch(cb_state.VkHandle(), 1, 1, 1);
+        validation_shader_resources.draw_buffer_binding.info = {api_buffer, 0, VK_WHOLE_SIZE};
 
-            // Sync indirect buffer reads
-            {
-                VkBufferMemoryBarrier barrier_read_after_write = vku::InitStructHelper();
-                barrier_read_after_write.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
-                barrier_read_after_write.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
-                barrier_read_after_write.buffer = validation_dispatch_params_buffer_range.buffer;
-                barrier_read_after_write.offset = validation_dispatch_params_buffer_range.offset;
-                barrier_read_after_write.size = validation_dispatch_params_buffer_range.size;
-
-                DispatchCmdPipelineBarrier(cb_state.VkHandle(), VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
-                                           VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, 0, 0, nullptr, 1, &barrier_read_after_write, 0,
-                                           nullptr);
-            }
+        if (!BindShaderResources(validation_pipeline, gpuav, cb_state, draw_i, error_logger_i, validation_shader_resources)) {
+            return;
         }
 
-        // Setup validation pipeline
-        {
-            DrawIndexedIndirectIndexBufferShader validation_shader_resources;
-            validation_shader_resources.push_constants = push_constants;
-            if (api_count_buffer != VK_NULL_HANDLE) {
-                validation_shader_resources.count_buffer_binding.info = {api_count_buffer, 0, sizeof(uint32_t)};
-            } else {
-                validation_shader_resources.count_buffer_binding.info = {shared_draw_validation_resources.dummy_buffer.VkHandle(),
-                                                                         0, VK_WHOLE_SIZE};
-            }
-            validation_shader_resources.draw_buffer_binding.info = {api_buffer, 0, VK_WHOLE_SIZE};
+        DispatchCmdBindPipeline(cb_state.VkHandle(), VK_PIPELINE_BIND_POINT_COMPUTE, validation_pipeline.pipeline);
 
-            if (!BindShaderResources(validation_pipeline, gpuav, cb_state, draw_i, error_logger_i, validation_shader_resources)) {
-                return;
-            }
-
-            DispatchCmdBindPipeline(cb_state.VkHandle(), VK_PIPELINE_BIND_POINT_COMPUTE, validation_pipeline.pipeline);
-
-            // One draw will check all VkDrawIndexedIndirectCommand
-            DispatchCmdDispatchIndirect(cb_state.VkHandle(), validation_dispatch_params_buffer_range.buffer,
-                                        validation_dispatch_params_buffer_range.offset);
-            // synchronize draw buffer validation (read) against subsequent writes
-            std::array<VkBufferMemoryBarrier, 2> buffer_memory_barriers = {};
-            uint32_t buffer_memory_barriers_count = 1;
-            buffer_memory_barriers[0] = vku::InitStructHelper();
-            buffer_memory_barriers[0].srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
-            buffer_memory_barriers[0].dstAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
-            buffer_memory_barriers[0].buffer = api_buffer;
-            buffer_memory_barriers[0].offset = api_offset;
-            buffer_memory_barriers[0].size = VK_WHOLE_SIZE;
-
-            if (api_count_buffer) {
-                buffer_memory_barriers[1] = vku::InitStructHelper();
-                buffer_memory_barriers[1].srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
-                buffer_memory_barriers[1].dstAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
-                buffer_memory_barriers[1].buffer = api_count_buffer;
-                buffer_memory_barriers[1].offset = api_count_buffer_offset;
-                buffer_memory_barriers[1].size = sizeof(uint32_t);
-                ++buffer_memory_barriers_count;
-            }
-
-            DispatchCmdPipelineBarrier(cb_state.VkHandle(), VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT,
-                                       VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, buffer_memory_barriers_count,
-                                       buffer_memory_barriers.data(), 0, nullptr);
-        }
+        // One draw will check all VkDrawIndexedIndirectCommand
+        DispatchCmdDispatchIndirect(cb_state.VkHandle(), dispatch_params_buffer, dispatch_params_offset);
     };
 
     ValidationCmdCbState &val_cmd_cb_state = cb_state.shared_resources_cache.GetOrCreate<ValidationCmdCbState>();
+    val_cmd_cb_state.per_render_pass_setup_commands.emplace_back(std::move(setup_validation_cmd));
     val_cmd_cb_state.per_render_pass_validation_commands.emplace_back(std::move(validation_cmd));
 
     const uint32_t label_command_i =
@@ -991,7 +925,7 @@ void DrawIndexedIndirectIndexBuffer(Validator &gpuav, CommandBufferSubState &cb_
     ErrorLoggerFunc error_logger = [&gpuav, &cb_state, loc, vuid, api_buffer, api_offset, api_stride,
                                     index_buffer_binding = cb_state.base.index_buffer_binding,
                                     label_command_i](const uint32_t *error_record, const LogObjectList &objlist,
-                                                     const std::vector<std::string> &initial_label_stack) {
+                                                     const vvl::LabelStack &initial_label_stack) {
         bool skip = false;
         using namespace glsl;
 
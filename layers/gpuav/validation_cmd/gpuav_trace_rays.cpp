@@ -23,6 +23,7 @@
 #include "gpuav/shaders/gpuav_error_header.h"
 #include "gpuav/shaders/validation_cmd/push_data.h"
 #include "generated/gpuav_offline_spirv.h"
+#include "profiling/profiling.h"
 #include "error_message/error_strings.h"
 #include "containers/limits.h"
 
@@ -40,21 +41,59 @@ struct TraceRaysValidationShader {
     std::vector<VkWriteDescriptorSet> GetDescriptorWrites(VkDescriptorSet desc_set) const { return {}; }
 };
 
-void TraceRaysIndirect(Validator& gpuav, const Location& loc, CommandBufferSubState& cb_state,
-                       VkDeviceAddress indirect_data_address) {
-    if (!gpuav.gpuav_settings.validate_indirect_trace_rays_buffers) {
-        return;
-    }
+// Limits checked by the validation shader, queried once per device
+struct TraceRaysValidationLimits {
+    glsl::TraceRaysPushData push_constants{};
 
-    if (!gpuav.modified_features.shaderInt64) {
-        return;
+    TraceRaysValidationLimits(Validator& gpuav) {
+        const uint64_t ray_query_dimension_max_width =
+            static_cast<uint64_t>(gpuav.phys_dev_props.limits.maxComputeWorkGroupCount[0]) *
+            static_cast<uint64_t>(gpuav.phys_dev_props.limits.maxComputeWorkGroupSize[0]);
+        const uint64_t ray_query_dimension_max_height =
+            static_cast<uint64_t>(gpuav.phys_dev_props.limits.maxComputeWorkGroupCount[1]) *
+            static_cast<uint64_t>(gpuav.phys_dev_props.limits.maxComputeWorkGroupSize[1]);
+        const uint64_t ray_query_dimension_max_depth =
+            static_cast<uint64_t>(gpuav.phys_dev_props.limits.maxComputeWorkGroupCount[2]) *
+            static_cast<uint64_t>(gpuav.phys_dev_props.limits.maxComputeWorkGroupSize[2]);
+        VkPhysicalDeviceRayTracingPipelinePropertiesKHR rt_pipeline_props = vku::InitStructHelper();
+        VkPhysicalDeviceProperties2 props2 = vku::InitStructHelper(&rt_pipeline_props);
+        DispatchGetPhysicalDeviceProperties2(gpuav.physical_device, &props2);
+
+        push_constants.trace_rays_width_limit =
+            static_cast<uint32_t>(std::min<uint64_t>(ray_query_dimension_max_width, vvl::kU32Max));
+        push_constants.trace_rays_height_limit =
+            static_cast<uint32_t>(std::min<uint64_t>(ray_query_dimension_max_height, vvl::kU32Max));
+        push_constants.trace_rays_depth_limit =
+            static_cast<uint32_t>(std::min<uint64_t>(ray_query_dimension_max_depth, vvl::kU32Max));
+        push_constants.max_ray_dispatch_invocation_count = rt_pipeline_props.maxRayDispatchInvocationCount;
     }
+};
 
-    if (cb_state.max_actions_cmd_validation_reached_) {
+struct TraceRaysValidationCmd {
+    VkDeviceAddress indirect_data_address;
+    uint32_t cmd_index;
+    uint32_t error_logger_index;
+    Location loc;
+};
+
+struct TraceRaysValidationCmdCbState {
+    // Indirect trace rays recorded since the last synchronization command, not validated yet
+    std::vector<TraceRaysValidationCmd> pending_validation_cmds;
+};
+
+// Any write to an indirect buffer read by a trace rays needs a synchronization command between the two, so up to the next
+// synchronization command the indirect data of all previous trace rays is what they read.
+// Their validation dispatches are thus recorded back to back there, sharing the pipeline binding, the pipeline state
+// save/restore and a single barrier, instead of interrupting each trace rays with its own validation dispatch.
+void FlushTraceRaysValidationCmds(Validator& gpuav, CommandBufferSubState& cb_state) {
+    TraceRaysValidationCmdCbState* val_cmd_cb_state = cb_state.shared_resources_cache.TryGet<TraceRaysValidationCmdCbState>();
+    if (!val_cmd_cb_state || val_cmd_cb_state->pending_validation_cmds.empty()) {
         return;
     }
 
-    valpipe::RestorablePipelineState restorable_state(cb_state, VK_PIPELINE_BIND_POINT_COMPUTE);
+    std::vector<TraceRaysValidationCmd> validation_cmds = std::move(val_cmd_cb_state->pending_validation_cmds);
+    val_cmd_cb_state->pending_validation_cmds.clear();
+    const Location& loc = validation_cmds.front().loc;
 
     ValidationCommandsCommon& val_cmd_common =
         cb_state.shared_resources_cache.GetOrCreate<ValidationCommandsCommon>(gpuav, cb_state, loc);
@@ -64,49 +103,54 @@ void TraceRaysIndirect(Validator& gpuav, const Location& loc, CommandBufferSubSt
     if (!validation_pipeline.valid) {
         return;
     }
+    const TraceRaysValidationLimits& limits = gpuav.shared_resources_manager.GetOrCreate<TraceRaysValidationLimits>(gpuav);
 
-    // Setup shader resources
-    // ---
-    {
-        const uint64_t ray_query_dimension_max_width =
-            static_cast<uint64_t>(gpuav.phys_dev_props.limits.maxComputeWorkGroupCount[0]) *
-            static_cast<uint64_t>(gpuav.phys_dev_props.limits.maxComputeWorkGroupSize[0]);
-        const uint64_t ray_query_dimension_max_height =
-            static_cast<uint64_t>(gpuav.phys_dev_props.limits.maxComputeWorkGroupCount[1]) *
-            static_cast<uint64_t>(gpuav.phys_dev_props.limits.maxComputeWorkGroupSize[1]);
-        const uint64_t ray_query_dimension_max_depth =
-            static_cast<uint64_t>(gpuav.phys_dev_props.limits.maxComputeWorkGroupCount[2]) *
-            static_cast<uint64_t>(gpuav.phys_dev_props.limits.maxComputeWorkGroupSize[2]);
-        VkPhysicalDeviceRayTracingPipelinePropertiesKHR rt_pipeline_props = vku::InitStructHelper();
-        VkPhysicalDeviceProperties2 props2 = vku::InitStructHelper(&rt_pipeline_props);
-        DispatchGetPhysicalDeviceProperties2(gpuav.physical_device, &props2);
+    valpipe::RestorablePipelineState restorable_state(cb_state, VK_PIPELINE_BIND_POINT_COMPUTE);
+    VVL_TracyVkZone(GetTracyVkCtx(), cb_state.VkHandle(), "gpuav_valcmd_trace_rays_indirect");
+    DispatchCmdBindPipeline(cb_state.VkHandle(), VK_PIPELINE_BIND_POINT_COMPUTE, validation_pipeline.pipeline);
 
+    for (const TraceRaysValidationCmd& validation_cmd : validation_cmds) {
         TraceRaysValidationShader shader_resources;
-        shader_resources.push_constants.indirect_data = indirect_data_address;
-        shader_resources.push_constants.trace_rays_width_limit =
-            static_cast<uint32_t>(std::min<uint64_t>(ray_query_dimension_max_width, vvl::kU32Max));
-        shader_resources.push_constants.trace_rays_height_limit =
-            static_cast<uint32_t>(std::min<uint64_t>(ray_query_dimension_max_height, vvl::kU32Max));
-        shader_resources.push_constants.trace_rays_depth_limit =
-            static_cast<uint32_t>(std::min<uint64_t>(ray_query_dimension_max_depth, vvl::kU32Max));
-        shader_resources.push_constants.max_ray_dispatch_invocation_count = rt_pipeline_props.maxRayDispatchInvocationCount;
+        shader_resources.push_constants = limits.push_constants;
+        shader_resources.push_constants.indirect_data = validation_cmd.indirect_data_address;
 
-        if (!BindShaderResources(validation_pipeline, gpuav, cb_state, cb_state.compute_index,
-                                 uint32_t(cb_state.per_command_error_loggers.size()), shader_resources)) {
-            return;
+        if (!BindShaderResources(validation_pipeline, gpuav, cb_state, validation_cmd.cmd_index,
+                                 validation_cmd.error_logger_index, shader_resources)) {
+            break;
         }
+
+        DispatchCmdDispatch(cb_state.VkHandle(), 1, 1, 1);
     }
 
-    // Setup validation pipeline
-    // ---
-    {
-        DispatchCmdBindPipeline(cb_state.VkHandle(), VK_PIPELINE_BIND_POINT_COMPUTE, validation_pipeline.pipeline);
+    // Synchronize indirect data validation (read) against subsequent writes
+    VkMemoryBarrier barrier_write_after_read = vku::InitStructHelper();
+    barrier_write_after_read.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    barrier_write_after_read.dstAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+    DispatchCmdPipelineBarrier(cb_state.VkHandle(), VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1,
+                               &barrier_write_after_read, 0, nullptr, 0, nullptr);
+}
 
-        DispatchCmdDispatch(cb_state.VkHandle(), 1, 1, 1);
+void TraceRaysIndirect(Validator& gpuav, const Location& loc, CommandBufferSubState& cb_state,
+                       VkDeviceAddress indirect_data_address) {
+    if (!gpuav.gpuav_settings.validate_indirect_trace_rays_buffers) {
+        return;
+    }
+
+    if (!gpuav.modified_features.shaderInt64) {
+        return;
+    }
+
+    if (cb_state.max_actions_cmd_validation_reached_) {
+        return;
     }
 
+    // Validation dispatch is recorded at the next synchronization command, see FlushTraceRaysValidationCmds
+    TraceRaysValidationCmdCbState& val_cmd_cb_state = cb_state.shared_resources_cache.GetOrCreate<TraceRaysValidationCmdCbState>();
+    val_cmd_cb_state.pending_validation_cmds.emplace_back(TraceRaysValidationCmd{
+        indirect_data_address, cb_state.compute_index, uint32_t(cb_state.per_command_error_loggers.size()), loc});
+
     CommandBufferSubState::ErrorLoggerFunc error_logger = [&gpuav, loc](const uint32_t* error_record, const LogObjectList& objlist,
-                                                                        const std::vector<std::string>&) {
+                                                                        const vvl::LabelStack&) {
         bool skip = false;
         using namespace glsl;
 
@@ -27,6 +27,9 @@ class Validator;
 namespace valcmd {
 void TraceRaysIndirect(Validator &gpuav, const Location &loc, CommandBufferSubState &cb_state,
                        VkDeviceAddress indirect_data_address);
+// Records the validation of the indirect trace rays recorded since the last call.
+// Needs to be called before any synchronization command, and before the end of the command buffer.
+void FlushTraceRaysValidationCmds(Validator &gpuav, CommandBufferSubState &cb_state);
 
 }
 }  // namespace gpuav
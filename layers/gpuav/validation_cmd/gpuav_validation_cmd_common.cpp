@@ -118,8 +118,9 @@ ValidationCommandsCommon::ValidationCommandsCommon(Validator &gpuav, CommandBuff
 
     VkDescriptorBufferInfo cmd_indices_buffer_desc_info = {};
 
-    assert(!gpuav_.indices_buffer_.IsDestroyed());
-    cmd_indices_buffer_desc_info.buffer = gpuav_.indices_buffer_.VkHandle();
+    const vko::Buffer &indices_buffer = gpuav_.GetIndicesBuffer();
+    assert(!indices_buffer.IsDestroyed());
+    cmd_indices_buffer_desc_info.buffer = indices_buffer.VkHandle();
     cmd_indices_buffer_desc_info.offset = 0;
     cmd_indices_buffer_desc_info.range = sizeof(uint32_t);
 
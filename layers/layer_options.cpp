@@ -25,7 +25,9 @@
 #include "error_message/error_location.h"
 #include "generated/error_location_helper.h"
 #include "utils/hash_util.h"
+#include <algorithm>
 #include <cstring>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <vulkan/layer/vk_layer_settings.hpp>
@@ -175,6 +177,20 @@ const char *VK_LAYER_DUPLICATE_MESSAGE_LIMIT = "duplicate_message_limit";
 const char *VK_LAYER_FINE_GRAINED_LOCKING = "fine_grained_locking";
 // Debug settings used for internal development
 const char *VK_LAYER_DEBUG_DISABLE_SPIRV_VAL = "debug_disable_spirv_val";
+const char *VK_LAYER_DEBUG_CALL_STATS_FILE = "debug_call_stats_file";
+const char *VK_LAYER_QUEUE_RETIRE_THREADS = "queue_retire_threads";
+const char *VK_LAYER_QUEUE_RETIRE_CPU_AFFINITY = "queue_retire_cpu_affinity";
+const char *VK_LAYER_THREAD_CPU_AFFINITY = "thread_cpu_affinity";
+const char *VK_LAYER_THREAD_PRIORITY = "thread_priority";
+const char *VK_LAYER_THREAD_POOL_SIZE = "thread_pool_size";
+const char *VK_LAYER_ASYNC_SPIRV_VALIDATION = "async_spirv_validation";
+const char *VK_LAYER_DEFERRED_COMMAND_VALIDATION = "deferred_command_validation";
+const char *VK_LAYER_INTERNAL_ALLOCATION_CALLBACKS = "internal_allocation_callbacks";
+const char *VK_LAYER_BULK_TEARDOWN = "bulk_teardown";
+const char *VK_LAYER_THREAD_SAFETY_SAMPLING = "thread_safety_sampling";
+const char *VK_LAYER_VALIDATION_FRAME_BUDGET_US = "validation_frame_budget_us";
+const char *VK_LAYER_VALIDATION_FRAME_STRIDE = "validation_frame_stride";
+const char *VK_LAYER_LOW_MEMORY_PRESET = "low_memory_preset";
 
 // DebugPrintf (which is now part of GPU-AV internally)
 // ---
@@ -185,11 +201,13 @@ const char *VK_LAYER_PRINTF_ENABLE = "printf_enable";
 const char *VK_LAYER_PRINTF_TO_STDOUT = "printf_to_stdout";
 const char *VK_LAYER_PRINTF_VERBOSE = "printf_verbose";
 const char *VK_LAYER_PRINTF_BUFFER_SIZE = "printf_buffer_size";
+const char *VK_LAYER_PRINTF_AGGREGATE = "printf_aggregate";
 
 // GPU-AV
 // ---
 const char *VK_LAYER_GPUAV_ENABLE = "gpuav_enable";
 const char *VK_LAYER_GPUAV_SAFE_MODE = "gpuav_safe_mode";
+const char *VK_LAYER_GPUAV_SAFE_MODE_TARGETED = "gpuav_safe_mode_targeted";
 const char *VK_LAYER_GPUAV_SHADER_INSTRUMENTATION = "gpuav_shader_instrumentation";
 const char *VK_LAYER_GPUAV_DESCRIPTOR_CHECKS = "gpuav_descriptor_checks";
 const char *VK_LAYER_GPUAV_BUFFER_ADDRESS_OOB = "gpuav_buffer_address_oob";
@@ -198,6 +216,12 @@ const char *VK_LAYER_GPUAV_POST_PROCESS_DESCRIPTOR_INDEXING = "gpuav_post_proces
 const char *VK_LAYER_GPUAV_VERTEX_ATTRIBUTE_FETCH_OOB = "gpuav_vertex_attribute_fetch_oob";
 const char *VK_LAYER_GPUAV_SELECT_INSTRUMENTED_SHADERS = "gpuav_select_instrumented_shaders";
 const char *VK_LAYER_GPUAV_SHADERS_TO_INSTRUMENT = "gpuav_shaders_to_instrument";
+const char *VK_LAYER_GPUAV_CACHE_INSTRUMENTED_SHADERS = "gpuav_cache_instrumented_shaders";
+const char *VK_LAYER_GPUAV_LAZY_INSTRUMENTATION = "gpuav_lazy_instrumentation";
+const char *VK_LAYER_GPUAV_COMPRESS_ORIGINAL_SPIRV = "gpuav_compress_original_spirv";
+const char *VK_LAYER_GPUAV_SAMPLING_DRAWS = "gpuav_sampling_draws";
+const char *VK_LAYER_GPUAV_SAMPLING_DISPATCHES = "gpuav_sampling_dispatches";
+const char *VK_LAYER_GPUAV_SAMPLING_TRACE_RAYS = "gpuav_sampling_trace_rays";
 
 const char *VK_LAYER_GPUAV_BUFFERS_VALIDATION = "gpuav_buffers_validation";
 const char *VK_LAYER_GPUAV_INDIRECT_DRAWS_BUFFERS = "gpuav_indirect_draws_buffers";
@@ -213,6 +237,8 @@ const char *VK_LAYER_GPUAV_FORCE_ON_ROBUSTNESS = "gpuav_force_on_robustness";
 
 const char *VK_LAYER_GPUAV_DEBUG_DISABLE_ALL = "gpuav_debug_disable_all";
 const char *VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS = "gpuav_debug_validate_instrumented_shaders";
+const char *VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS_ASYNC = "gpuav_debug_validate_instrumented_shaders_async";
+const char *VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS_WAIT = "gpuav_debug_validate_instrumented_shaders_wait";
 const char *VK_LAYER_GPUAV_DEBUG_DUMP_INSTRUMENTED_SHADERS = "gpuav_debug_dump_instrumented_shaders";
 const char *VK_LAYER_GPUAV_DEBUG_MAX_INSTRUMENTATIONS_COUNT = "gpuav_debug_max_instrumentations_count";
 const char *VK_LAYER_GPUAV_DEBUG_PRINT_INSTRUMENTATION_INFO = "gpuav_debug_print_instrumentation_info";
@@ -222,11 +248,19 @@ const char *VK_LAYER_GPUAV_DEBUG_PRINT_INSTRUMENTATION_INFO = "gpuav_debug_print
 const char *VK_LAYER_SYNCVAL_SUBMIT_TIME_VALIDATION = "syncval_submit_time_validation";
 const char *VK_LAYER_SYNCVAL_SHADER_ACCESSES_HEURISTIC = "syncval_shader_accesses_heuristic";
 const char *VK_LAYER_SYNCVAL_MESSAGE_EXTRA_PROPERTIES = "syncval_message_extra_properties";
+const char *VK_LAYER_SYNCVAL_QUEUE_HISTORY_MEMORY_LIMIT = "syncval_queue_history_memory_limit";
+const char *VK_LAYER_SYNCVAL_ASYNC_SUBMIT_VALIDATION = "syncval_async_submit_validation";
 
 // Message Formatting
 // ---
 const char *VK_LAYER_MESSAGE_FORMAT_JSON = "message_format_json";
 const char *VK_LAYER_MESSAGE_FORMAT_DISPLAY_APPLICATION_NAME = "message_format_display_application_name";
+
+// Message Delivery
+// ---
+const char *VK_LAYER_MESSAGE_DELIVERY_ASYNC = "message_delivery_async";
+const char *VK_LAYER_MESSAGE_DELIVERY_QUEUE_SIZE = "message_delivery_queue_size";
+const char *VK_LAYER_MESSAGE_DELIVERY_OVERFLOW = "message_delivery_overflow";
 // Until post 1.3.290 SDK release, these were not possible to set via environment variables
 const char *VK_LAYER_LOG_FILENAME = "log_filename";
 const char *VK_LAYER_DEBUG_ACTION = "debug_action";
@@ -556,6 +590,8 @@ static void ValidateLayerSettingsProvided(const VkLayerSettingsCreateInfoEXT *la
             required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
         } else if (strcmp(VK_LAYER_FINE_GRAINED_LOCKING, setting.pSettingName) == 0) {
             required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
+        } else if (strcmp(VK_LAYER_LOW_MEMORY_PRESET, setting.pSettingName) == 0) {
+            required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
         } else if (strcmp(VK_LAYER_MESSAGE_ID_FILTER, setting.pSettingName) == 0) {
             required_type = VK_LAYER_SETTING_TYPE_STRING_EXT;
         } else if (strcmp(VK_LAYER_CUSTOM_STYPE_LIST, setting.pSettingName) == 0) {
@@ -580,6 +616,8 @@ static void ValidateLayerSettingsProvided(const VkLayerSettingsCreateInfoEXT *la
             required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
         } else if (strcmp(VK_LAYER_GPUAV_SAFE_MODE, setting.pSettingName) == 0) {
             required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
+        } else if (strcmp(VK_LAYER_GPUAV_SAFE_MODE_TARGETED, setting.pSettingName) == 0) {
+            required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
         } else if (strcmp(VK_LAYER_GPUAV_SHADER_INSTRUMENTATION, setting.pSettingName) == 0) {
             required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
         } else if (strcmp(VK_LAYER_GPUAV_DESCRIPTOR_CHECKS, setting.pSettingName) == 0) {
@@ -614,10 +652,20 @@ static void ValidateLayerSettingsProvided(const VkLayerSettingsCreateInfoEXT *la
             required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
         } else if (strcmp(VK_LAYER_SYNCVAL_MESSAGE_EXTRA_PROPERTIES, setting.pSettingName) == 0) {
             required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
+        } else if (strcmp(VK_LAYER_SYNCVAL_QUEUE_HISTORY_MEMORY_LIMIT, setting.pSettingName) == 0) {
+            required_type = VK_LAYER_SETTING_TYPE_UINT32_EXT;
+        } else if (strcmp(VK_LAYER_SYNCVAL_ASYNC_SUBMIT_VALIDATION, setting.pSettingName) == 0) {
+            required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
         } else if (strcmp(VK_LAYER_MESSAGE_FORMAT_JSON, setting.pSettingName) == 0) {
             required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
         } else if (strcmp(VK_LAYER_MESSAGE_FORMAT_DISPLAY_APPLICATION_NAME, setting.pSettingName) == 0) {
             required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
+        } else if (strcmp(VK_LAYER_MESSAGE_DELIVERY_ASYNC, setting.pSettingName) == 0) {
+            required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
+        } else if (strcmp(VK_LAYER_MESSAGE_DELIVERY_QUEUE_SIZE, setting.pSettingName) == 0) {
+            required_type = VK_LAYER_SETTING_TYPE_UINT32_EXT;
+        } else if (strcmp(VK_LAYER_MESSAGE_DELIVERY_OVERFLOW, setting.pSettingName) == 0) {
+            required_type = VK_LAYER_SETTING_TYPE_STRING_EXT;
         } else if (strcmp(VK_LAYER_LOG_FILENAME, setting.pSettingName) == 0) {
             required_type = VK_LAYER_SETTING_TYPE_STRING_EXT;
         } else if (strcmp(VK_LAYER_DEBUG_ACTION, setting.pSettingName) == 0) {
@@ -746,6 +794,30 @@ static void ProcessDebugReportSettings(ConfigAndEnvSettings *settings_data, VkuL
                                 debug_report->message_format_settings.display_application_name);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_MESSAGE_DELIVERY_ASYNC)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_MESSAGE_DELIVERY_ASYNC, debug_report->message_delivery_settings.async);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_MESSAGE_DELIVERY_QUEUE_SIZE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_MESSAGE_DELIVERY_QUEUE_SIZE,
+                                debug_report->message_delivery_settings.queue_size);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_MESSAGE_DELIVERY_OVERFLOW)) {
+        std::string setting_value;
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_MESSAGE_DELIVERY_OVERFLOW, setting_value);
+        if (setting_value == "BLOCK") {
+            debug_report->message_delivery_settings.overflow = MessageQueueOverflow::Block;
+        } else if (setting_value == "DROP_OLDEST") {
+            debug_report->message_delivery_settings.overflow = MessageQueueOverflow::DropOldest;
+        } else if (setting_value == "DROP_NEWEST") {
+            debug_report->message_delivery_settings.overflow = MessageQueueOverflow::DropNewest;
+        } else {
+            setting_warnings.emplace_back("The setting " + std::string(VK_LAYER_MESSAGE_DELIVERY_OVERFLOW) + " was set to " +
+                                          setting_value + " which is not one of BLOCK, DROP_OLDEST or DROP_NEWEST.");
+        }
+    }
+
     std::string log_filename = "stdout";  // Default
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_LOG_FILENAME)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_LOG_FILENAME, log_filename);
@@ -902,6 +974,26 @@ static void ProcessDebugReportSettings(ConfigAndEnvSettings *settings_data, VkuL
     }
 }
 
+// Comma separated CPU indices, ex: "2,3"
+static uint64_t GetCpuAffinitySetting(VkuLayerSettingSet layer_setting_set, const char *setting_name,
+                                      std::vector<std::string> &setting_warnings) {
+    std::string cpu_list;
+    vkuGetLayerSettingValue(layer_setting_set, setting_name, cpu_list);
+    uint64_t cpu_affinity_mask = 0;
+    std::stringstream stream(cpu_list);
+    std::string cpu;
+    while (std::getline(stream, cpu, ',')) {
+        char *end = nullptr;
+        const unsigned long index = std::strtoul(cpu.c_str(), &end, 10);
+        if (end != cpu.c_str() && index < 64) {
+            cpu_affinity_mask |= 1ull << index;
+        } else if (!cpu.empty()) {
+            setting_warnings.emplace_back(std::string(setting_name) + ": ignoring \"" + cpu + "\", CPU indices must be below 64.");
+        }
+    }
+    return cpu_affinity_mask;
+}
+
 static const char *GetDefaultPrefix() {
 #ifdef __ANDROID__
     return "vvl";
@@ -988,6 +1080,77 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_DEBUG_DISABLE_SPIRV_VAL, global_settings.debug_disable_spirv_val);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_DEBUG_CALL_STATS_FILE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_DEBUG_CALL_STATS_FILE, global_settings.debug_call_stats_file);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_QUEUE_RETIRE_THREADS)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_QUEUE_RETIRE_THREADS, global_settings.queue_retire_threads);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_ASYNC_SPIRV_VALIDATION)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_ASYNC_SPIRV_VALIDATION, global_settings.async_spirv_validation);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_DEFERRED_COMMAND_VALIDATION)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_DEFERRED_COMMAND_VALIDATION,
+                                global_settings.deferred_command_validation);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_INTERNAL_ALLOCATION_CALLBACKS)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_INTERNAL_ALLOCATION_CALLBACKS,
+                                global_settings.internal_allocation_callbacks);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_BULK_TEARDOWN)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_BULK_TEARDOWN, global_settings.bulk_teardown);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_THREAD_SAFETY_SAMPLING)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_THREAD_SAFETY_SAMPLING, global_settings.thread_safety_sampling);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_VALIDATION_FRAME_BUDGET_US)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_VALIDATION_FRAME_BUDGET_US, global_settings.validation_frame_budget_us);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_VALIDATION_FRAME_STRIDE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_VALIDATION_FRAME_STRIDE, global_settings.validation_frame_stride);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_LOW_MEMORY_PRESET)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_LOW_MEMORY_PRESET, global_settings.low_memory_preset);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_QUEUE_RETIRE_CPU_AFFINITY)) {
+        global_settings.queue_retire_cpu_affinity =
+            GetCpuAffinitySetting(layer_setting_set, VK_LAYER_QUEUE_RETIRE_CPU_AFFINITY, setting_warnings);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_THREAD_CPU_AFFINITY)) {
+        global_settings.threads.cpu_affinity_mask =
+            GetCpuAffinitySetting(layer_setting_set, VK_LAYER_THREAD_CPU_AFFINITY, setting_warnings);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_THREAD_PRIORITY)) {
+        std::string setting_value;
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_THREAD_PRIORITY, setting_value);
+        if (setting_value == "DEFAULT") {
+            global_settings.threads.priority = vvl::ThreadPriority::Default;
+        } else if (setting_value == "LOW") {
+            global_settings.threads.priority = vvl::ThreadPriority::Low;
+        } else if (setting_value == "IDLE") {
+            global_settings.threads.priority = vvl::ThreadPriority::Idle;
+        } else {
+            setting_warnings.emplace_back("The setting " + std::string(VK_LAYER_THREAD_PRIORITY) + " was set to " + setting_value +
+                                          " which is not one of DEFAULT, LOW or IDLE.");
+        }
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_THREAD_POOL_SIZE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_THREAD_POOL_SIZE, global_settings.threads.pool_size);
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_CUSTOM_STYPE_LIST)) {
         vkuGetLayerSettingValues(layer_setting_set, VK_LAYER_CUSTOM_STYPE_LIST, GetCustomStypeInfo());
     }
@@ -997,6 +1160,10 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_SAFE_MODE, gpuav_settings.safe_mode);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_SAFE_MODE_TARGETED)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_SAFE_MODE_TARGETED, gpuav_settings.safe_mode_targeted);
+    }
+
     bool shader_instrumentation_enabled = true;
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_SHADER_INSTRUMENTATION)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_SHADER_INSTRUMENTATION, shader_instrumentation_enabled);
@@ -1041,6 +1208,34 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
             gpuav_settings.SetShaderSelectionRegexes(std::move(shaders_to_instrument));
         }
 
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_CACHE_INSTRUMENTED_SHADERS)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_CACHE_INSTRUMENTED_SHADERS,
+                                    gpuav_settings.cache_instrumented_shaders);
+        }
+
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_LAZY_INSTRUMENTATION)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_LAZY_INSTRUMENTATION, gpuav_settings.lazy_instrumentation);
+        }
+
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_COMPRESS_ORIGINAL_SPIRV)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_COMPRESS_ORIGINAL_SPIRV,
+                                    gpuav_settings.compress_original_spirv);
+        }
+
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_SAMPLING_DRAWS)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_SAMPLING_DRAWS, gpuav_settings.sampling.draws);
+        }
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_SAMPLING_DISPATCHES)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_SAMPLING_DISPATCHES, gpuav_settings.sampling.dispatches);
+        }
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_SAMPLING_TRACE_RAYS)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_SAMPLING_TRACE_RAYS, gpuav_settings.sampling.trace_rays);
+        }
+        // Zero would mean never validating, which is what disabling shader instrumentation is for
+        gpuav_settings.sampling.draws = std::max(gpuav_settings.sampling.draws, 1u);
+        gpuav_settings.sampling.dispatches = std::max(gpuav_settings.sampling.dispatches, 1u);
+        gpuav_settings.sampling.trace_rays = std::max(gpuav_settings.sampling.trace_rays, 1u);
+
         // No need to enable shader instrumentation options is no instrumentation is done
         if (!gpuav_settings.IsShaderInstrumentationEnabled()) {
             gpuav_settings.DisableShaderInstrumentationAndOptions();
@@ -1087,6 +1282,16 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                                 gpuav_settings.debug_validate_instrumented_shaders);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS_ASYNC)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS_ASYNC,
+                                gpuav_settings.debug_validate_instrumented_shaders_async);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS_WAIT)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS_WAIT,
+                                gpuav_settings.debug_validate_instrumented_shaders_wait);
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_DEBUG_DUMP_INSTRUMENTED_SHADERS)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_DEBUG_DUMP_INSTRUMENTED_SHADERS,
                                 gpuav_settings.debug_dump_instrumented_shaders);
@@ -1122,6 +1327,10 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PRINTF_VERBOSE, gpuav_settings.debug_printf_verbose);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PRINTF_AGGREGATE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PRINTF_AGGREGATE, gpuav_settings.debug_printf_aggregate);
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PRINTF_BUFFER_SIZE)) {
         const uint32_t default_buffer_size = gpuav_settings.debug_printf_buffer_size;
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PRINTF_BUFFER_SIZE, gpuav_settings.debug_printf_buffer_size);
@@ -1149,6 +1358,26 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                                 syncval_settings.message_extra_properties);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_QUEUE_HISTORY_MEMORY_LIMIT)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_QUEUE_HISTORY_MEMORY_LIMIT,
+                                syncval_settings.queue_history_memory_limit);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_ASYNC_SUBMIT_VALIDATION)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_ASYNC_SUBMIT_VALIDATION,
+                                syncval_settings.async_submit_validation);
+    }
+
+    // Turns on the settings that trade some speed or message detail for memory. The ones set explicitly are kept.
+    if (global_settings.low_memory_preset) {
+        if (!vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_COMPRESS_ORIGINAL_SPIRV)) {
+            gpuav_settings.compress_original_spirv = true;
+        }
+        if (!vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_QUEUE_HISTORY_MEMORY_LIMIT)) {
+            syncval_settings.queue_history_memory_limit = 32;
+        }
+    }
+
     const char *REMOVED_VK_LAYER_SYNCVAL_MESSAGE_EXTRA_PROPERTIES_PRETTY_PRINT = "syncval_message_extra_properties_pretty_print";
     if (vkuHasLayerSetting(layer_setting_set, REMOVED_VK_LAYER_SYNCVAL_MESSAGE_EXTRA_PROPERTIES_PRETTY_PRINT)) {
         setting_warnings.emplace_back(std::string(REMOVED_VK_LAYER_SYNCVAL_MESSAGE_EXTRA_PROPERTIES_PRETTY_PRINT) +
@@ -24,6 +24,7 @@
 #include <cstdint>
 #include <vulkan/vulkan.h>
 #include <vulkan/utility/vk_struct_helper.hpp>
+#include "utils/thread_utils.h"
 
 #define OBJECT_LAYER_NAME "VK_LAYER_KHRONOS_validation"
 
@@ -84,6 +85,35 @@ struct GlobalSettings {
     bool fine_grained_locking = true;
 
     bool debug_disable_spirv_val = false;
+    // When set, per entry point call stats are collected and written to this file at vkDestroyDevice
+    std::string debug_call_stats_file;
+
+    // Most threads the queue submissions are retired on, 0 is at most one per queue
+    uint32_t queue_retire_threads = 0;
+    // Bit N lets the retire threads run on CPU N, 0 is the affinity of |threads|
+    uint64_t queue_retire_cpu_affinity = 0;
+    // Affinity, priority and pool size of every thread the layer starts
+    vvl::ThreadSettings threads;
+    // Runs spirv-val of vkCreateShaderModule on background threads, the result is waited for when creating a pipeline
+    bool async_spirv_validation = false;
+    // The checks of recorded commands that do not depend on the command buffer state are run at vkEndCommandBuffer, on worker
+    // threads, instead of in the vkCmd* call
+    bool deferred_command_validation = false;
+    // Internal containers allocate through the VkAllocationCallbacks of vkCreateInstance, see InternalMemoryResource
+    bool internal_allocation_callbacks = false;
+    // The objects not destroyed before vkDestroyDevice/vkDestroyInstance are reported with one message per object type
+    bool bulk_teardown = false;
+    // Thread safety checks one out of N uses of each object type on each thread, 1 checks every use
+    uint32_t thread_safety_sampling = 1;
+    // Layer CPU time allowed per presented frame, over it the optional checks are turned off until there is room again. 0 is
+    // no budget
+    uint32_t validation_frame_budget_us = 0;
+    // Command buffer recording is validated one frame out of N, the frames in between only track state. 0 and 1 validate every
+    // frame
+    uint32_t validation_frame_stride = 1;
+    // Defaults the memory saving settings of GPU-AV and synchronization validation, and reports the peak layer memory at
+    // vkDestroyDevice
+    bool low_memory_preset = false;
 };
 
 class DebugReport;
@@ -28,13 +28,19 @@ enum ObjectStatusFlagBits {
     OBJSTATUS_CUSTOM_ALLOCATOR = 0x00000002,  // Allocated with custom allocator
 };
 
+// Objects allocated from a pool, each pool locks its own so that pools used on different threads do not contend
+struct ObjTrackChildren {
+    mutable std::shared_mutex lock;
+    vvl::unordered_set<uint64_t> handles;
+};
+
 // Object and state information structure
 struct ObjTrackState {
     uint64_t handle;                                               // Object handle (new)
     VulkanObjectType object_type;                                  // Object type identifier
     ObjectStatusFlags status;                                      // Object state
     uint64_t parent_object;                                        // Parent object
-    std::unique_ptr<vvl::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool only)
+    std::unique_ptr<ObjTrackChildren> child_objects;               // Child objects (used for VkDescriptorPool only)
 };
 
 typedef vvl::concurrent_unordered_map<uint64_t, std::shared_ptr<ObjTrackState>, 6> object_map_type;
@@ -46,6 +52,8 @@ class Tracker : public Logger {
     Tracker(DebugReport *dr) : Logger(dr) {}
 
     void DestroyUndestroyedObjects(VulkanObjectType object_type, const Location &loc);
+    // One message for every object of |object_type| still alive, listing the first of them
+    bool ReportLeakedObjectsInBulk(VulkanObjectType object_type, const std::string &error_code, const Location &loc) const;
 
     template <typename T1>
     bool ValidateDestroyObject(T1 object_handle, VulkanObjectType object_type, const VkAllocationCallbacks *pAllocator,
@@ -103,6 +111,9 @@ class Tracker : public Logger {
         node->status = custom_allocator ? OBJSTATUS_CUSTOM_ALLOCATOR : OBJSTATUS_NONE;
         node->handle = object_handle;
         node->parent_object = HandleToUint64(parent_object);
+        if (object_type == kVulkanObjectTypeDescriptorPool) {
+            node->child_objects = std::make_unique<ObjTrackChildren>();
+        }
 
         const bool inserted = obj_map.insert(object_handle, node);
         if (!inserted) {
@@ -116,9 +127,6 @@ class Tracker : public Logger {
                      string_VulkanObjectType(object_type), object_handle);
             return;
         }
-        if (object_type == kVulkanObjectTypeDescriptorPool) {
-            node->child_objects.reset(new vvl::unordered_set<uint64_t>);
-        }
     }
 
     void DestroyObjectSilently(uint64_t object, VulkanObjectType object_type, const Location &loc);
@@ -127,9 +135,8 @@ class Tracker : public Logger {
     void RecordDestroyObject(T1 object_handle, VulkanObjectType object_type, const Location &loc) {
         auto object = HandleToUint64(object_handle);
         if (object != HandleToUint64(VK_NULL_HANDLE)) {
-            if (object_map[object_type].contains(object)) {
-                DestroyObjectSilently(object, object_type, loc);
-            }
+            // Single map operation, an object that is not tracked is just left alone
+            object_map[object_type].erase(object);
         }
     }
 
@@ -200,14 +207,11 @@ class Device : public vvl::base::Device {
   public:
     // Override chassis read/write locks for this validation object
     // This override takes a deferred lock. i.e. it is not acquired.
-    // This class does its own locking with a shared mutex.
+    // This class relies on its concurrent object maps, plus a lock per descriptor pool for its allocated sets.
     ReadLockGuard ReadLock() const override;
     WriteLockGuard WriteLock() override;
 
     Tracker tracker;
-    mutable std::shared_mutex object_lifetime_mutex;
-    WriteLockGuard WriteSharedLock() { return WriteLockGuard(object_lifetime_mutex); }
-    ReadLockGuard ReadSharedLock() const { return ReadLockGuard(object_lifetime_mutex); }
 
     object_list_map_type linked_graphics_pipeline_map;
 
@@ -216,6 +220,7 @@ class Device : public vvl::base::Device {
     ~Device();
 
     void FinishDeviceSetup(const VkDeviceCreateInfo *pCreateInfo, const Location &loc) override;
+    void UpdateMemoryAccounting() const override;
 
     void DestroyLeakedObjects();
     bool ReportUndestroyedObjects(const Location &loc) const;
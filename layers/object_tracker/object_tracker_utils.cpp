@@ -109,6 +109,18 @@ void Device::FinishDeviceSetup(const VkDeviceCreateInfo *pCreateInfo, const Loca
     tracker.SetDeviceHandle(device);
 }
 
+void Device::UpdateMemoryAccounting() const {
+    // The key and shared_ptr of each map entry, plus the node allocated next to its control block. Hash table buckets and the
+    // child objects of descriptor pools are not counted.
+    constexpr uint64_t kEntryBytes =
+        sizeof(uint64_t) + sizeof(std::shared_ptr<ObjTrackState>) + sizeof(ObjTrackState) + 2 * sizeof(uint64_t);
+    uint64_t object_count = 0;
+    for (const auto &map : tracker.object_map) {
+        object_count += map.size();
+    }
+    memory_accounting.Set(vvl::profiling::MemorySubsystem::ObjectTracker, object_count * kEntryBytes);
+}
+
 bool Device::CheckPipelineObjectValidity(uint64_t object_handle, const char *invalid_handle_vuid, const Location &loc) const {
      bool skip = false;
      const auto &itr = linked_graphics_pipeline_map.find(object_handle);
@@ -148,12 +160,27 @@ void Tracker::DestroyObjectSilently(uint64_t object, VulkanObjectType object_typ
     }
 }
 
-void Tracker::DestroyUndestroyedObjects(VulkanObjectType object_type, const Location &loc) {
-    auto snapshot = object_map[object_type].snapshot();
+void Tracker::DestroyUndestroyedObjects(VulkanObjectType object_type, const Location &) {
+    // Every object of the type goes at once, there is nothing left to race with
+    object_map[object_type].clear();
+}
+
+bool Tracker::ReportLeakedObjectsInBulk(VulkanObjectType object_type, const std::string &error_code, const Location &loc) const {
+    const size_t count = object_map[object_type].size();
+    if (count == 0) {
+        return false;
+    }
+    constexpr size_t kMaxListedObjects = 8;
+    size_t listed = 0;
+    auto snapshot = object_map[object_type].snapshot(
+        [&listed](const std::shared_ptr<ObjTrackState> &) { return listed++ < kMaxListedObjects; });
+    LogObjectList objlist(handle_);
     for (const auto &item : snapshot) {
-        auto object_info = item.second;
-        DestroyObjectSilently(object_info->handle, object_type, loc);
+        objlist.add(ObjTrackStateTypedHandle(*item.second));
     }
+    return LogError(error_code, objlist, loc,
+                    "Object Tracking - For %s, %zu %s objects have not been destroyed (the first %zu are listed).",
+                    FormatHandle(handle_).c_str(), count, string_VulkanObjectType(object_type), snapshot.size());
 }
 
 bool Device::ValidateAnonymousObject(uint64_t object, VkObjectType core_object_type, const char *invalid_handle_vuid,
@@ -194,7 +221,8 @@ void Device::AllocateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescripto
     tracker.CreateObject(descriptor_set, kVulkanObjectTypeDescriptorSet, nullptr, loc, descriptor_pool);
     auto itr = tracker.object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptor_pool));
     if (itr != tracker.object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        itr->second->child_objects->insert(HandleToUint64(descriptor_set));
+        WriteLockGuard guard(itr->second->child_objects->lock);
+        itr->second->child_objects->handles.insert(HandleToUint64(descriptor_set));
     }
 }
 
@@ -406,6 +434,9 @@ void Device::CreateSwapchainImageObject(VkImage swapchain_image, VkSwapchainKHR
 
 bool Instance::ReportLeakedObjects(VulkanObjectType object_type, const std::string &error_code,
                                            const Location &loc) const {
+    if (global_settings.bulk_teardown && object_type != kVulkanObjectTypeImage) {
+        return tracker.ReportLeakedObjectsInBulk(object_type, error_code, loc);
+    }
     bool skip = false;
 
     // The state tracker also tracks implicit images created for swapchains and reports them as leak.
@@ -433,6 +464,9 @@ bool Instance::ReportLeakedObjects(VulkanObjectType object_type, const std::stri
 
 bool Device::ReportLeakedObjects(VulkanObjectType object_type, const std::string &error_code,
                                        const Location &loc) const {
+    if (global_settings.bulk_teardown) {
+        return tracker.ReportLeakedObjectsInBulk(object_type, error_code, loc);
+    }
     bool skip = false;
 
     auto snapshot = tracker.object_map[object_type].snapshot();
@@ -536,13 +570,11 @@ void Device::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallb
 
 void Device::PostCallRecordGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue *pQueue,
                                           const RecordObject &record_obj) {
-    auto lock = WriteSharedLock();
     CreateQueue(*pQueue, record_obj.location);
 }
 
 void Device::PostCallRecordGetDeviceQueue2(VkDevice device, const VkDeviceQueueInfo2 *pQueueInfo, VkQueue *pQueue,
                                            const RecordObject &record_obj) {
-    auto lock = WriteSharedLock();
     CreateQueue(*pQueue, record_obj.location);
 }
 
@@ -578,7 +610,6 @@ bool Device::PreCallValidateUpdateDescriptorSets(VkDevice device, uint32_t descr
 bool Device::PreCallValidateResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags,
                                                 const ErrorObject &error_obj) const {
     bool skip = false;
-    auto lock = ReadSharedLock();
     // Checked by chassis: device: "VUID-vkResetDescriptorPool-device-parameter"
 
     skip |= ValidateObject(descriptorPool, kVulkanObjectTypeDescriptorPool, false,
@@ -588,7 +619,8 @@ bool Device::PreCallValidateResetDescriptorPool(VkDevice device, VkDescriptorPoo
     auto itr = tracker.object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != tracker.object_map[kVulkanObjectTypeDescriptorPool].end()) {
         auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
+        ReadLockGuard guard(pool_node->child_objects->lock);
+        for (auto set : pool_node->child_objects->handles) {
             skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
                                           kVUIDUndefined, error_obj.location);
         }
@@ -598,16 +630,16 @@ bool Device::PreCallValidateResetDescriptorPool(VkDevice device, VkDescriptorPoo
 
 void Device::PreCallRecordResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags,
                                               const RecordObject &record_obj) {
-    auto lock = WriteSharedLock();
     // A DescriptorPool's descriptor sets are implicitly deleted when the pool is reset. Remove this pool's descriptor sets from
     // our descriptorSet map.
     auto itr = tracker.object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != tracker.object_map[kVulkanObjectTypeDescriptorPool].end()) {
         auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
+        WriteLockGuard guard(pool_node->child_objects->lock);
+        for (auto set : pool_node->child_objects->handles) {
             RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, record_obj.location);
         }
-        pool_node->child_objects->clear();
+        pool_node->child_objects->handles.clear();
     }
 }
 
@@ -641,7 +673,6 @@ bool Device::PreCallValidateBeginCommandBuffer(VkCommandBuffer commandBuffer, co
 void Device::PostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t *pSwapchainImageCount,
                                                  VkImage *pSwapchainImages, const RecordObject &record_obj) {
     if (record_obj.result < VK_SUCCESS) return;
-    auto lock = WriteSharedLock();
     if (pSwapchainImages != NULL) {
         for (uint32_t i = 0; i < *pSwapchainImageCount; i++) {
             CreateSwapchainImageObject(pSwapchainImages[i], swapchain, record_obj.location.dot(Field::pSwapchainImages, i));
@@ -751,7 +782,6 @@ void Device::PostCallRecordAllocateCommandBuffers(VkDevice device, const VkComma
 bool Device::PreCallValidateAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo,
                                                    VkDescriptorSet *pDescriptorSets, const ErrorObject &error_obj) const {
     bool skip = false;
-    auto lock = ReadSharedLock();
     // Checked by chassis: device: "VUID-vkAllocateDescriptorSets-device-parameter"
 
     const Location allocate_info = error_obj.location.dot(Field::pAllocateInfo);
@@ -769,7 +799,6 @@ bool Device::PreCallValidateAllocateDescriptorSets(VkDevice device, const VkDesc
 void Device::PostCallRecordAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo,
                                                   VkDescriptorSet *pDescriptorSets, const RecordObject &record_obj) {
     if (record_obj.result < VK_SUCCESS) return;
-    auto lock = WriteSharedLock();
     for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; i++) {
         AllocateDescriptorSet(pAllocateInfo->descriptorPool, pDescriptorSets[i],
                               record_obj.location.dot(Field::pDescriptorSets, i));
@@ -815,7 +844,6 @@ void Device::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapchainKHR sw
 
 bool Device::PreCallValidateFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount,
                                                const VkDescriptorSet *pDescriptorSets, const ErrorObject &error_obj) const {
-    auto lock = ReadSharedLock();
     bool skip = false;
     // Checked by chassis: device: "VUID-vkFreeDescriptorSets-device-parameter"
 
@@ -834,7 +862,6 @@ bool Device::PreCallValidateFreeDescriptorSets(VkDevice device, VkDescriptorPool
 }
 void Device::PreCallRecordFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount,
                                              const VkDescriptorSet *pDescriptorSets, const RecordObject &record_obj) {
-    auto lock = WriteSharedLock();
     std::shared_ptr<ObjTrackState> pool_node = nullptr;
     auto itr = tracker.object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != tracker.object_map[kVulkanObjectTypeDescriptorPool].end()) {
@@ -842,15 +869,17 @@ void Device::PreCallRecordFreeDescriptorSets(VkDevice device, VkDescriptorPool d
     }
     for (uint32_t i = 0; i < descriptorSetCount; i++) {
         RecordDestroyObject(pDescriptorSets[i], kVulkanObjectTypeDescriptorSet, record_obj.location);
-        if (pool_node) {
-            pool_node->child_objects->erase(HandleToUint64(pDescriptorSets[i]));
+    }
+    if (pool_node) {
+        WriteLockGuard guard(pool_node->child_objects->lock);
+        for (uint32_t i = 0; i < descriptorSetCount; i++) {
+            pool_node->child_objects->handles.erase(HandleToUint64(pDescriptorSets[i]));
         }
     }
 }
 
 bool Device::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                   const VkAllocationCallbacks *pAllocator, const ErrorObject &error_obj) const {
-    auto lock = ReadSharedLock();
     bool skip = false;
     // Checked by chassis: device: "VUID-vkDestroyDescriptorPool-device-parameter"
 
@@ -862,7 +891,8 @@ bool Device::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDescriptorP
     auto itr = tracker.object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != tracker.object_map[kVulkanObjectTypeDescriptorPool].end()) {
         auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
+        ReadLockGuard guard(pool_node->child_objects->lock);
+        for (auto set : pool_node->child_objects->handles) {
             skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
                                           kVUIDUndefined, error_obj.location);
         }
@@ -874,14 +904,14 @@ bool Device::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDescriptorP
 }
 void Device::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                 const VkAllocationCallbacks *pAllocator, const RecordObject &record_obj) {
-    auto lock = WriteSharedLock();
     auto itr = tracker.object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != tracker.object_map[kVulkanObjectTypeDescriptorPool].end()) {
         auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
+        WriteLockGuard guard(pool_node->child_objects->lock);
+        for (auto set : pool_node->child_objects->handles) {
             RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, record_obj.location);
         }
-        pool_node->child_objects->clear();
+        pool_node->child_objects->handles.clear();
     }
     RecordDestroyObject(descriptorPool, kVulkanObjectTypeDescriptorPool, record_obj.location);
 }
@@ -0,0 +1,255 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "profiling/call_stats.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+
+#include "utils/math_utils.h"
+
+namespace vvl {
+namespace profiling {
+
+const char* String(CallPhase phase) {
+    switch (phase) {
+        case CallPhase::PreCallValidate:
+            return "PreCallValidate";
+        case CallPhase::PreCallRecord:
+            return "PreCallRecord";
+        case CallPhase::Dispatch:
+            return "Dispatch";
+        case CallPhase::PostCallRecord:
+            return "PostCallRecord";
+        case CallPhase::Count:
+            break;
+    }
+    return "Unknown";
+}
+
+namespace {
+
+struct CheckRegistry {
+    std::mutex lock;
+    std::vector<const char*> names;
+};
+
+CheckRegistry& GetCheckRegistry() {
+    static CheckRegistry registry;
+    return registry;
+}
+
+}  // namespace
+
+uint32_t RegisterCheck(const char* name) {
+    CheckRegistry& registry = GetCheckRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    if (registry.names.size() >= kMaxChecks) {
+        return kInvalidCheck;
+    }
+    registry.names.emplace_back(name);
+    return uint32_t(registry.names.size() - 1);
+}
+
+thread_local ScopedCheckTimer* ScopedCheckTimer::current_ = nullptr;
+
+CallStats::CallStats()
+    : histograms_(new Histogram[kFuncCount * uint32_t(CallPhase::Count)]), checks_(new CheckTotals[kMaxChecks]) {}
+
+uint32_t CallStats::BucketOf(uint64_t ns) {
+    const uint32_t high = uint32_t(ns >> 32);
+    const int msb = high ? 32 + MostSignificantBit(high) : MostSignificantBit(uint32_t(ns));
+    return std::min(uint32_t(std::max(msb, 0)), kBucketCount - 1);
+}
+
+void CallStats::Add(Func func, CallPhase phase, uint64_t ns) {
+    Histogram& histogram = histograms_[size_t(func) * uint32_t(CallPhase::Count) + uint32_t(phase)];
+    histogram.total_ns.fetch_add(ns, std::memory_order_relaxed);
+    histogram.buckets[BucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t current = histogram.min_ns.load(std::memory_order_relaxed);
+    while (ns < current && !histogram.min_ns.compare_exchange_weak(current, ns, std::memory_order_relaxed)) {
+    }
+    current = histogram.max_ns.load(std::memory_order_relaxed);
+    while (ns > current && !histogram.max_ns.compare_exchange_weak(current, ns, std::memory_order_relaxed)) {
+    }
+}
+
+void CallStats::AddCheck(uint32_t check, uint64_t ns, uint64_t self_ns) {
+    CheckTotals& totals = checks_[check];
+    totals.count.fetch_add(1, std::memory_order_relaxed);
+    totals.total_ns.fetch_add(ns, std::memory_order_relaxed);
+    totals.self_ns.fetch_add(self_ns, std::memory_order_relaxed);
+    uint64_t current = totals.max_ns.load(std::memory_order_relaxed);
+    while (ns > current && !totals.max_ns.compare_exchange_weak(current, ns, std::memory_order_relaxed)) {
+    }
+}
+
+void CallStats::AddStartup(std::string step, uint64_t ns) { startup_steps_.emplace_back(std::move(step), ns); }
+
+namespace {
+
+// Snapshot of a histogram, so a report is consistent even if other threads are still recording
+struct Samples {
+    uint64_t count = 0;
+    uint64_t total_ns = 0;
+    uint64_t min_ns = 0;
+    uint64_t max_ns = 0;
+    uint64_t buckets[CallStats::kBucketCount] = {};
+
+    double BucketLow(uint32_t i) const { return std::max(i == 0 ? 0.0 : std::ldexp(1.0, int(i)), double(min_ns)); }
+    double BucketHigh(uint32_t i) const {
+        const double high = i == CallStats::kBucketCount - 1 ? double(max_ns) : std::ldexp(1.0, int(i) + 1);
+        return std::min(high, double(max_ns));
+    }
+
+    // Value below which the given fraction of the samples fall, interpolated linearly inside the bucket
+    double Quantile(double fraction) const {
+        const double rank = fraction * double(count);
+        double seen = 0.0;
+        for (uint32_t i = 0; i < CallStats::kBucketCount; ++i) {
+            if (buckets[i] == 0) {
+                continue;
+            }
+            if (seen + double(buckets[i]) >= rank) {
+                const double t = (rank - seen) / double(buckets[i]);
+                return BucketLow(i) + t * (BucketHigh(i) - BucketLow(i));
+            }
+            seen += double(buckets[i]);
+        }
+        return double(max_ns);
+    }
+
+    // Approximate sum of the `top_count` slowest samples, assuming samples are spread evenly inside each bucket
+    double TopTotal(uint64_t top_count) const {
+        double total = 0.0;
+        uint64_t remaining = top_count;
+        for (uint32_t i = CallStats::kBucketCount; i-- > 0 && remaining > 0;) {
+            if (buckets[i] == 0) {
+                continue;
+            }
+            const uint64_t taken = std::min(remaining, buckets[i]);
+            // The slowest `taken` samples of the bucket sit in its upper part
+            const double t = double(taken) / double(buckets[i]);
+            const double low = BucketHigh(i) - t * (BucketHigh(i) - BucketLow(i));
+            total += double(taken) * (low + BucketHigh(i)) / 2.0;
+            remaining -= taken;
+        }
+        return total;
+    }
+};
+
+void WriteRow(std::ostream& out, const std::string& name, uint64_t count, double avg, double median, double min, double max) {
+    // Same units as stats.py, with enough digits for calls that only take a few microseconds
+    char values[160];
+    snprintf(values, sizeof(values), ",%" PRIu64 ",%.6f,%.6f,%.6f,%.6f\n", count, avg / 1e6, median / 1e6, min / 1e6, max / 1e6);
+    out << name << values;
+}
+
+}  // namespace
+
+void CallStats::WriteCsv(std::ostream& out) const {
+    out << "Zone Name,Count,Avg (ms),Median (ms),Min (ms),Max (ms)\n";
+    for (const auto& [step, ns] : startup_steps_) {
+        WriteRow(out, "Startup_" + step, 1, double(ns), double(ns), double(ns), double(ns));
+    }
+    for (size_t func = 0; func < kFuncCount; ++func) {
+        for (uint32_t phase = 0; phase < uint32_t(CallPhase::Count); ++phase) {
+            const Histogram& histogram = histograms_[func * uint32_t(CallPhase::Count) + phase];
+            Samples samples;
+            for (uint32_t i = 0; i < kBucketCount; ++i) {
+                samples.buckets[i] = histogram.buckets[i].load(std::memory_order_relaxed);
+                samples.count += samples.buckets[i];
+            }
+            if (samples.count == 0) {
+                continue;
+            }
+            samples.total_ns = histogram.total_ns.load(std::memory_order_relaxed);
+            samples.min_ns = histogram.min_ns.load(std::memory_order_relaxed);
+            samples.max_ns = histogram.max_ns.load(std::memory_order_relaxed);
+
+            const std::string name = std::string(String(CallPhase(phase))) + "_" + String(Func(func));
+            WriteRow(out, name, samples.count, double(samples.total_ns) / double(samples.count), samples.Quantile(0.5),
+                     double(samples.min_ns), double(samples.max_ns));
+
+            const std::pair<const char*, double> tops[] = {{" (top 25%)", 0.25}, {" (top 10%)", 0.10}};
+            for (const auto& [suffix, fraction] : tops) {
+                const uint64_t top_count = std::max<uint64_t>(1, uint64_t(std::ceil(double(samples.count) * fraction)));
+                WriteRow(out, name + suffix, top_count, samples.TopTotal(top_count) / double(top_count),
+                         samples.Quantile(1.0 - fraction / 2.0), samples.Quantile(1.0 - fraction), double(samples.max_ns));
+            }
+        }
+    }
+}
+
+bool CallStats::WriteCsv(const std::string& path) const {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    WriteCsv(file);
+    return bool(file);
+}
+
+void CallStats::WriteChecksCsv(std::ostream& out) const {
+    struct Row {
+        const char* name;
+        uint64_t count;
+        uint64_t total_ns;
+        uint64_t self_ns;
+        uint64_t max_ns;
+    };
+    std::vector<Row> rows;
+    {
+        CheckRegistry& registry = GetCheckRegistry();
+        std::lock_guard<std::mutex> guard(registry.lock);
+        for (size_t check = 0; check < registry.names.size(); ++check) {
+            const CheckTotals& totals = checks_[check];
+            const uint64_t count = totals.count.load(std::memory_order_relaxed);
+            if (count == 0) {
+                continue;
+            }
+            rows.emplace_back(Row{registry.names[check], count, totals.total_ns.load(std::memory_order_relaxed),
+                                  totals.self_ns.load(std::memory_order_relaxed), totals.max_ns.load(std::memory_order_relaxed)});
+        }
+    }
+    std::sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) { return a.self_ns > b.self_ns; });
+
+    out << "Check,Count,Self (ms),Total (ms),Avg (ms),Max (ms)\n";
+    for (const Row& row : rows) {
+        char values[160];
+        snprintf(values, sizeof(values), ",%" PRIu64 ",%.6f,%.6f,%.6f,%.6f\n", row.count, double(row.self_ns) / 1e6,
+                 double(row.total_ns) / 1e6, double(row.total_ns) / double(row.count) / 1e6, double(row.max_ns) / 1e6);
+        out << row.name << values;
+    }
+}
+
+bool CallStats::WriteChecksCsv(const std::string& path) const {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    WriteChecksCsv(file);
+    return bool(file);
+}
+
+}  // namespace profiling
+}  // namespace vvl
@@ -0,0 +1,181 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "generated/error_location_helper.h"
+#include "profiling/validation_budget.h"
+
+// Per entry point call counts and latency histograms, always compiled in (unlike the Tracy zones in profiling.h) and turned
+// on at runtime with the debug_call_stats_file setting. See profiling.md
+namespace vvl {
+namespace profiling {
+
+// Matches the Tracy zones emitted by the chassis, ex: "PreCallValidate_vkQueueSubmit"
+enum class CallPhase : uint32_t {
+    PreCallValidate = 0,
+    PreCallRecord,
+    Dispatch,
+    PostCallRecord,
+    Count,
+};
+
+const char* String(CallPhase phase);
+
+// Validation functions timed with VVL_CheckStatsScope() get an index at the first call of each site, shared by all devices.
+// Returns kInvalidCheck once kMaxChecks sites are registered.
+static constexpr uint32_t kMaxChecks = 512;
+static constexpr uint32_t kInvalidCheck = UINT32_MAX;
+uint32_t RegisterCheck(const char* name);
+
+class CallStats {
+  public:
+    // Bucket i holds latencies in [2^i, 2^(i+1)) nanoseconds, bucket 0 also holds 0 and the last bucket everything above
+    static constexpr uint32_t kBucketCount = 40;
+
+    CallStats();
+
+    void Add(Func func, CallPhase phase, uint64_t ns);
+    // One step of the instance or device creation, written as a "Startup_<step>" row. Only called while the device is created.
+    void AddStartup(std::string step, uint64_t ns);
+
+    // One row per entry point and phase that was called at least once, plus "top 25%" and "top 10%" rows, with the same
+    // columns as the tables written by stats.py so they can be fed to compare.py.
+    // Median, and everything in the top rows except Max, are interpolated from the histogram.
+    void WriteCsv(std::ostream& out) const;
+    bool WriteCsv(const std::string& path) const;
+
+    void AddCheck(uint32_t check, uint64_t ns, uint64_t self_ns);
+    // One row per check that ran, the slowest first (by self time, the time not spent in the checks it calls)
+    void WriteChecksCsv(std::ostream& out) const;
+    bool WriteChecksCsv(const std::string& path) const;
+
+  private:
+    struct Histogram {
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> min_ns{UINT64_MAX};
+        std::atomic<uint64_t> max_ns{0};
+        std::atomic<uint64_t> buckets[kBucketCount] = {};
+    };
+
+    struct CheckTotals {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> self_ns{0};
+        std::atomic<uint64_t> max_ns{0};
+    };
+
+    static uint32_t BucketOf(uint64_t ns);
+
+    std::unique_ptr<Histogram[]> histograms_;
+    std::unique_ptr<CheckTotals[]> checks_;
+    std::vector<std::pair<std::string, uint64_t>> startup_steps_;
+};
+
+inline uint64_t ElapsedNs(std::chrono::steady_clock::time_point start) {
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+// Times the enclosing scope for the call stats and the validation budget, does nothing when both are null (the settings are off)
+class ScopedCallTimer {
+  public:
+    ScopedCallTimer(CallStats* stats, ValidationBudget* budget, Func func, CallPhase phase)
+        : stats_(stats), budget_(phase == CallPhase::Dispatch ? nullptr : budget), func_(func), phase_(phase) {
+        if (stats_ || budget_) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+    ~ScopedCallTimer() {
+        if (stats_ || budget_) {
+            const uint64_t ns = ElapsedNs(start_);
+            if (stats_) {
+                stats_->Add(func_, phase_, ns);
+            }
+            if (budget_) {
+                budget_->AddLayerTime(ns);
+            }
+        }
+    }
+    ScopedCallTimer(const ScopedCallTimer&) = delete;
+    ScopedCallTimer& operator=(const ScopedCallTimer&) = delete;
+
+  private:
+    CallStats* stats_;
+    // The driver time of the Dispatch phase does not count against the budget
+    ValidationBudget* budget_;
+    Func func_;
+    CallPhase phase_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// Times the enclosing validation function, the time of the timers opened inside it on the same thread is removed from its self time
+class ScopedCheckTimer {
+  public:
+    ScopedCheckTimer(CallStats* stats, uint32_t check) : stats_(check == kInvalidCheck ? nullptr : stats), check_(check) {
+        if (stats_) {
+            parent_ = current_;
+            current_ = this;
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+    ~ScopedCheckTimer() {
+        if (stats_) {
+            const uint64_t ns = ElapsedNs(start_);
+            stats_->AddCheck(check_, ns, ns - std::min(ns, children_ns_));
+            current_ = parent_;
+            if (parent_) {
+                parent_->children_ns_ += ns;
+            }
+        }
+    }
+    ScopedCheckTimer(const ScopedCheckTimer&) = delete;
+    ScopedCheckTimer& operator=(const ScopedCheckTimer&) = delete;
+
+  private:
+    static thread_local ScopedCheckTimer* current_;
+
+    CallStats* stats_;
+    uint32_t check_;
+    ScopedCheckTimer* parent_ = nullptr;
+    uint64_t children_ns_ = 0;
+    std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace profiling
+}  // namespace vvl
+
+// Used by the chassis next to each VVL_ZoneScopedN(), dispatch is a vvl::dispatch::Device*
+#define VVL_CallStatsScope(dispatch, func, phase)                                                                       \
+    vvl::profiling::ScopedCallTimer call_stats_timer((dispatch)->call_stats.get(), (dispatch)->validation_budget.get(), \
+                                                     vvl::Func::func, vvl::profiling::CallPhase::phase)
+
+// Times a validation function for the checks table of debug_call_stats_file, dispatch is a vvl::dispatch::Device* and name a
+// string literal. At most one per scope.
+#define VVL_CheckStatsScope(dispatch, name)                                                   \
+    static const uint32_t check_stats_id = vvl::profiling::RegisterCheck(name);              \
+    vvl::profiling::ScopedCheckTimer check_stats_timer((dispatch)->call_stats.get(), check_stats_id)
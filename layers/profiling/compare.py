@@ -1,5 +1,6 @@
 #!/usr/bin/env python3
 import csv
+import json
 import sys
 import argparse
 import re
@@ -20,6 +21,34 @@ def pad_ansi(s, width):
     pad_count = width - len(visible)
     return s + " " * pad_count
 
+def read_benchmark_data(filename):
+    """
+    Reads the JSON written by vk_layer_benchmarks or vk_container_benchmarks (tests/benchmarks)
+    and returns the same dictionary as read_overall_data(). Each entry point becomes a zone
+    named "<workload>/<entry point> [layers]" or "<workload>/<entry point> [no layers]", or
+    "<workload>/<benchmark>" for the container benchmarks, and the nanosecond timings are
+    converted to milliseconds.
+    """
+    try:
+        with open(filename, 'r') as jsonfile:
+            results = json.load(jsonfile)
+    except FileNotFoundError:
+        print(f"Error: File '{filename}' not found.", file=sys.stderr)
+        sys.exit(1)
+    data = {}
+    for entry in results.get("workloads", []):
+        zone = f"{entry.get('workload')}/{entry.get('entry_point')}"
+        if "layers" in entry:
+            zone += " [layers]" if entry["layers"] else " [no layers]"
+        data[zone] = {
+            "Count": int(entry.get("count", 0)),
+            "Avg (ms)": float(entry.get("avg_ns", 0)) / 1e6,
+            "Median (ms)": float(entry.get("median_ns", 0)) / 1e6,
+            "Min (ms)": float(entry.get("min_ns", 0)) / 1e6,
+            "Max (ms)": float(entry.get("max_ns", 0)) / 1e6
+        }
+    return data
+
 def read_overall_data(filename):
     """
     Reads the CSV file and returns a dictionary mapping zone names to metrics.
@@ -30,6 +59,8 @@ def read_overall_data(filename):
       - Count: int
       - Avg (ms), Median (ms), Min (ms), Max (ms): float
     """
+    if filename.endswith(".json"):
+        return read_benchmark_data(filename)
     data = {}
     try:
         with open(filename, 'r', newline='') as csvfile:
@@ -95,10 +126,28 @@ def format_diff(ref_val, comp_val):
     # ANSI 24-bit color escape sequence.
     color_code = f"\033[38;2;{R};{G};{B}m"
     reset_code = "\033[0m"
-    diff_str = f"{perc_diff:+.2f}% ({diff:+.2f} ms)"
+    # Benchmark timings are in the microsecond range, keep enough digits for them to show up
+    diff_str = f"{perc_diff:+.2f}% ({diff:+.2f} ms)" if abs(diff) >= 0.01 else f"{perc_diff:+.2f}% ({diff * 1e6:+.0f} ns)"
     return f"{color_code}{diff_str}{reset_code}"
 
-def main(reference_csv, comparison_csv):
+def find_regressions(ref_data, comp_data, max_regression):
+    """
+    Returns the (zone, percentage) of the zones whose median is more than max_regression percent
+    slower in comp_data. The "[no layers]" benchmark zones only measure the driver and are skipped.
+    """
+    regressions = []
+    for zone in sorted(set(ref_data.keys()) & set(comp_data.keys())):
+        if zone.endswith(" [no layers]"):
+            continue
+        ref_median = ref_data[zone]["Median (ms)"]
+        if ref_median <= 0:
+            continue
+        perc_diff = (comp_data[zone]["Median (ms)"] - ref_median) / ref_median * 100.0
+        if perc_diff > max_regression:
+            regressions.append((zone, perc_diff))
+    return regressions
+
+def main(reference_csv, comparison_csv, max_regression=None):
     # Read overall timing data from both CSV files.
     ref_data = read_overall_data(reference_csv)
     comp_data = read_overall_data(comparison_csv)
@@ -155,13 +204,27 @@ def main(reference_csv, comparison_csv):
         for zone in sorted(extra_in_comp):
             print(" -", zone)
 
+    if max_regression is None:
+        return 0
+    regressions = find_regressions(ref_data, comp_data, max_regression)
+    if not regressions:
+        print(f"\nNo median regressed by more than {max_regression}%")
+        return 0
+    print(f"\nMedian regressed by more than {max_regression}%:", file=sys.stderr)
+    for zone, perc_diff in regressions:
+        print(f" - {zone}: {perc_diff:+.2f}%", file=sys.stderr)
+    return 1
+
 if __name__ == "__main__":
     parser = argparse.ArgumentParser(
-        description="Compare two CSV files of zone timings (overall rows only). The first CSV is used as the reference."
+        description="Compare two CSV files of zone timings (overall rows only), or two JSON files written by "
+                    "vk_layer_benchmarks or vk_container_benchmarks. The first file is used as the reference."
     )
     parser.add_argument("reference_csv", help="Reference CSV file")
     parser.add_argument("comparison_csv", help="CSV file to compare")
+    parser.add_argument("--max-regression", type=float, default=None, metavar="PERCENT",
+                        help="Exit with 1 if the median of a zone is more than PERCENT slower than in the reference")
     args = parser.parse_args()
     
     # Pass the parsed arguments to main as parameters.
-    main(args.reference_csv, args.comparison_csv)
+    sys.exit(main(args.reference_csv, args.comparison_csv, args.max_regression))
@@ -0,0 +1,72 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "profiling/memory_accounting.h"
+
+namespace vvl {
+namespace profiling {
+
+// Also the names of the Tracy plots, so they must stay string literals
+const char* MemorySubsystemName(MemorySubsystem subsystem) {
+    switch (subsystem) {
+        case MemorySubsystem::StateTracker:
+            return "StateTracker";
+        case MemorySubsystem::Descriptors:
+            return "Descriptors";
+        case MemorySubsystem::ObjectTracker:
+            return "ObjectTracker";
+        case MemorySubsystem::SyncAccessLogs:
+            return "SyncAccessLogs";
+        case MemorySubsystem::SyncAccessMaps:
+            return "SyncAccessMaps";
+        case MemorySubsystem::GpuavVma:
+            return "GpuavVma";
+        case MemorySubsystem::GpuavVmaPools:
+            return "GpuavVmaPools";
+        case MemorySubsystem::GpuavShaders:
+            return "GpuavShaders";
+        case MemorySubsystem::Count:
+            break;
+    }
+    return "Unknown";
+}
+
+uint64_t MemoryAccounting::Total() const {
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < kSubsystemCount; ++i) {
+        if (MemorySubsystem(i) != MemorySubsystem::GpuavVmaPools) {
+            total += Get(MemorySubsystem(i));
+        }
+    }
+    return total;
+}
+
+static void StoreMax(std::atomic<uint64_t>& peak, uint64_t value) {
+    uint64_t current = peak.load(std::memory_order_relaxed);
+    while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+void MemoryAccounting::UpdatePeaks() {
+    for (uint32_t i = 0; i < kSubsystemCount; ++i) {
+        StoreMax(peaks_[i], Get(MemorySubsystem(i)));
+    }
+    StoreMax(peak_total_, Total());
+}
+
+}  // namespace profiling
+}  // namespace vvl
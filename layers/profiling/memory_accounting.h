@@ -0,0 +1,70 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace vvl {
+namespace profiling {
+
+// Parts of the layer whose memory is accounted per device. See profiling.md
+enum class MemorySubsystem : uint32_t {
+    StateTracker,    // State objects of the tracked Vulkan objects, without descriptor sets
+    Descriptors,     // Descriptor sets and their descriptors
+    ObjectTracker,   // Object lifetime nodes
+    SyncAccessLogs,  // Access logs of the recorded command buffers
+    SyncAccessMaps,  // Range maps of the last submitted batch of each queue
+    GpuavVma,        // Device memory allocated by GPU-AV through VMA
+    GpuavVmaPools,   // Part of GpuavVma in the dedicated pools of the GPU-AV buffer block pools
+    GpuavShaders,    // SPIR-V kept for error reporting and in the instrumented shader cache
+    Count,
+};
+
+const char* MemorySubsystemName(MemorySubsystem subsystem);
+
+// Bytes used by each subsystem. Subsystems that change often and at known points add and remove their bytes as they go,
+// the others set theirs when they are asked, in base::Device::UpdateMemoryAccounting().
+class MemoryAccounting {
+  public:
+    static constexpr uint32_t kSubsystemCount = uint32_t(MemorySubsystem::Count);
+
+    void Add(MemorySubsystem subsystem, uint64_t bytes) { Counter(subsystem).fetch_add(bytes, std::memory_order_relaxed); }
+    void Sub(MemorySubsystem subsystem, uint64_t bytes) { Counter(subsystem).fetch_sub(bytes, std::memory_order_relaxed); }
+    void Set(MemorySubsystem subsystem, uint64_t bytes) { Counter(subsystem).store(bytes, std::memory_order_relaxed); }
+    uint64_t Get(MemorySubsystem subsystem) const { return bytes_[uint32_t(subsystem)].load(std::memory_order_relaxed); }
+    // Sum of the subsystems, without GpuavVmaPools which is part of GpuavVma
+    uint64_t Total() const;
+
+    // Peaks are only as fine as the calls to UpdatePeaks(), the chassis calls it at each vkQueuePresentKHR with the
+    // low_memory_preset setting
+    void UpdatePeaks();
+    uint64_t PeakTotal() const { return peak_total_.load(std::memory_order_relaxed); }
+    uint64_t Peak(MemorySubsystem subsystem) const { return peaks_[uint32_t(subsystem)].load(std::memory_order_relaxed); }
+
+  private:
+    std::atomic<uint64_t>& Counter(MemorySubsystem subsystem) { return bytes_[uint32_t(subsystem)]; }
+
+    std::array<std::atomic<uint64_t>, kSubsystemCount> bytes_{};
+    std::array<std::atomic<uint64_t>, kSubsystemCount> peaks_{};
+    std::atomic<uint64_t> peak_total_{0};
+};
+
+}  // namespace profiling
+}  // namespace vvl
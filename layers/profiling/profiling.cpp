@@ -20,6 +20,7 @@
 #include "profiling/profiling.h"
 
 #include "containers/custom_containers.h"
+#include "utils/thread_utils.h"
 
 #include <cstdlib>
 #include <thread>
@@ -281,7 +282,7 @@ void TracyVkCollector::Create(VkDevice device, VkQueue queue, uint32_t queue_fam
     (void)result;
 
     collector->collect_thread = std::thread([collector_ptr = collector.get()]() {
-        tracy::SetThreadName("TracyVkCollector::Collect Worker");
+        vvl::ConfigureCurrentThread("TracyVkCollector::Collect Worker");
 
         while (true) {
             std::unique_lock<std::mutex> collect_lock(collector_ptr->collect_mutex);
@@ -538,3 +539,40 @@ void TracyVkZoneEnd(tracy::VkCtxManualScope &scope_to_close, VkQueue queue) {
 #endif
 
 #endif  // #if defined(TRACY_ENABLE)
+
+#if defined(VVL_PERFETTO)
+
+#include "profiling/profiling.h"
+
+#include <mutex>
+
+PERFETTO_TRACK_EVENT_STATIC_STORAGE_IN_NAMESPACE(vvl_perfetto);
+
+namespace vvl {
+namespace profiling {
+
+void InitPerfetto() {
+    static std::once_flag init_once;
+    std::call_once(init_once, [] {
+        perfetto::TracingInitArgs args;
+        // The events go to the traced daemon, next to the ones of the application and of the system
+        args.backends = perfetto::kSystemBackend;
+        perfetto::Tracing::Initialize(args);
+        vvl_perfetto::TrackEvent::Register();
+    });
+}
+
+void PerfettoSetThreadName(const char* name) {
+    if (!perfetto::Tracing::IsInitialized()) {
+        return;
+    }
+    const perfetto::ThreadTrack track = perfetto::ThreadTrack::Current();
+    perfetto::protos::gen::TrackDescriptor desc = track.Serialize();
+    desc.mutable_thread()->set_thread_name(name);
+    vvl_perfetto::TrackEvent::SetTrackDescriptor(track, desc);
+}
+
+}  // namespace profiling
+}  // namespace vvl
+
+#endif  // #if defined(VVL_PERFETTO)
@@ -65,6 +65,66 @@
         }                                                              \
     }
 
+#elif defined(VVL_PERFETTO)
+// Same zones, plots and messages as track events of the "vvl" category of the Perfetto SDK. They are recorded only while a
+// system tracing session enables the category, see profiling.md
+#include <perfetto.h>
+
+#include <sstream>
+#include <string>
+
+// In a namespace so the categories do not clash with an application that also uses the Perfetto SDK
+PERFETTO_DEFINE_CATEGORIES_IN_NAMESPACE(vvl_perfetto, perfetto::Category("vvl").SetDescription("Vulkan Validation Layers"));
+PERFETTO_USE_CATEGORIES_FROM_NAMESPACE(vvl_perfetto);
+
+namespace vvl {
+namespace profiling {
+// Connects to the system tracing service (traced) the first time it is called
+void InitPerfetto();
+void PerfettoSetThreadName(const char* name);
+}  // namespace profiling
+}  // namespace vvl
+
+// Define CPU zones
+#define VVL_ZoneScoped TRACE_EVENT("vvl", perfetto::StaticString(__func__))
+#define VVL_ZoneScopedN(name) TRACE_EVENT("vvl", perfetto::StaticString(name))
+#define VVL_TracyCZone(zone_name, active) TRACE_EVENT_BEGIN("vvl", perfetto::StaticString(#zone_name))
+#define VVL_TracyCZoneEnd(zone_name) TRACE_EVENT_END("vvl")
+#define VVL_TracyCFrameMark TRACE_EVENT_INSTANT("vvl", "Frame")
+
+// Thread naming
+#define VVL_TracySetThreadName(name) vvl::profiling::PerfettoSetThreadName(name)
+
+// Print messages
+#define VVL_TracyMessage(txt, size) TRACE_EVENT_INSTANT("vvl", "Message", "text", std::string(txt, size))
+#define VVL_TracyMessageL(txt) TRACE_EVENT_INSTANT("vvl", "Message", "text", txt)
+#define VVL_TracyPlot(name, value) \
+    TRACE_COUNTER("vvl", perfetto::CounterTrack(perfetto::DynamicString(name)), int64_t(value))
+#define VVL_TracyMessageStream(message)                    \
+    {                                                      \
+        std::stringstream tracy_ss;                        \
+        tracy_ss << message;                               \
+        const std::string tracy_s = tracy_ss.str();        \
+        VVL_TracyMessage(tracy_s.c_str(), tracy_s.size()); \
+    }
+#define VVL_TracyMessageMap(map, key_printer, value_printer)               \
+    {                                                                      \
+        static int tracy_map_log_i = 0;                                    \
+        std::string tracy_map_log_str = #map " ";                          \
+        tracy_map_log_str += std::to_string(tracy_map_log_i++);            \
+        tracy_map_log_str += " - size: ";                                  \
+        tracy_map_log_str += std::to_string(map.size());                   \
+        tracy_map_log_str += " - one pair: ";                              \
+        for (const auto& [key, value] : map) {                             \
+            std::string key_value_str = tracy_map_log_str;                 \
+            key_value_str += " | key: ";                                   \
+            key_value_str += key_printer(key);                             \
+            key_value_str += " - value: ";                                 \
+            key_value_str += value_printer(value);                         \
+            VVL_TracyMessage(key_value_str.c_str(), key_value_str.size()); \
+        }                                                                  \
+    }
+
 #else
 #define VVL_ZoneScoped
 #define VVL_ZoneScopedN(name)
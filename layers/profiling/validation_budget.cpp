@@ -0,0 +1,74 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "profiling/validation_budget.h"
+
+#include <algorithm>
+
+namespace vvl {
+namespace profiling {
+
+ValidationBudget::ValidationBudget(uint64_t budget_ns, uint32_t enabled_mask) : budget_ns_(budget_ns) {
+    for (LayerObjectTypeId object_type : kShedOrder) {
+        if (enabled_mask & (1u << object_type)) {
+            sheddable_.push_back(object_type);
+        }
+    }
+    frames_to_bring_back_.resize(sheddable_.size(), kFramesUnderBudget);
+    frames_since_brought_back_.resize(sheddable_.size(), kMaxFramesUnderBudget);
+}
+
+std::optional<ValidationBudget::Change> ValidationBudget::EndFrame() {
+    const uint64_t frame_ns = frame_ns_.exchange(0, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> guard(lock_);
+    for (uint32_t& frames : frames_since_brought_back_) {
+        frames = std::min(frames + 1, kMaxFramesUnderBudget);
+    }
+
+    if (frame_ns > budget_ns_) {
+        frames_under_ = 0;
+        if (++frames_over_ < kFramesOverBudget || shed_count_ == sheddable_.size()) {
+            return std::nullopt;
+        }
+        frames_over_ = 0;
+        const uint32_t index = shed_count_++;
+        if (frames_since_brought_back_[index] < frames_to_bring_back_[index]) {
+            frames_to_bring_back_[index] = std::min(frames_to_bring_back_[index] * 2, kMaxFramesUnderBudget);
+        }
+        shed_mask_.fetch_or(1u << sheddable_[index], std::memory_order_relaxed);
+        return Change{sheddable_[index], true, frame_ns};
+    }
+
+    frames_over_ = 0;
+    if (frame_ns > budget_ns_ / 2 || shed_count_ == 0) {
+        frames_under_ = 0;
+        return std::nullopt;
+    }
+    const uint32_t index = shed_count_ - 1;
+    if (++frames_under_ < frames_to_bring_back_[index]) {
+        return std::nullopt;
+    }
+    frames_under_ = 0;
+    shed_count_--;
+    frames_since_brought_back_[index] = 0;
+    shed_mask_.fetch_and(~(1u << sheddable_[index]), std::memory_order_relaxed);
+    return Change{sheddable_[index], false, frame_ns};
+}
+
+}  // namespace profiling
+}  // namespace vvl
@@ -0,0 +1,86 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "chassis/layer_object_id.h"
+
+namespace vvl {
+namespace profiling {
+
+// Keeps the layer CPU time of each presented frame under the validation_frame_budget_us setting. See profiling.md
+//
+// The chassis adds up the time of the PreCallValidate, PreCallRecord and PostCallRecord phases of every device entry point,
+// and ends a frame at each vkQueuePresentKHR. When frames keep going over the budget the next validation object of kShedOrder
+// is shed, and once frames stay well under it the last shed one is brought back.
+// Only the PreCallValidate phase of a shed object is skipped, its record phases keep running so that its state is up to date
+// whenever it is brought back.
+class ValidationBudget {
+  public:
+    // Best practices first since it only reports advice, then the command buffer checks of sync validation which cost the most
+    // per command. Core, stateless, object lifetime and thread safety checks catch crashes and are never shed.
+    static constexpr LayerObjectTypeId kShedOrder[] = {LayerObjectTypeBestPractices, LayerObjectTypeSyncValidation};
+
+    // Frames in a row over the budget before shedding
+    static constexpr uint32_t kFramesOverBudget = 3;
+    // Frames in a row under half the budget before bringing an object back. Doubled, up to the max, each time that object has
+    // to be shed again before the same number of frames went by, so a check that does not fit the budget stops flapping
+    static constexpr uint32_t kFramesUnderBudget = 60;
+    static constexpr uint32_t kMaxFramesUnderBudget = 60 * 64;
+
+    // enabled_mask has bit N set when the device has the validation object of LayerObjectTypeId N
+    ValidationBudget(uint64_t budget_ns, uint32_t enabled_mask);
+
+    void AddLayerTime(uint64_t ns) { frame_ns_.fetch_add(ns, std::memory_order_relaxed); }
+
+    // Bit N is set when the PreCallValidate phase of the validation object of LayerObjectTypeId N has to be skipped
+    uint32_t ShedMask() const { return shed_mask_.load(std::memory_order_relaxed); }
+
+    struct Change {
+        LayerObjectTypeId object_type;
+        bool shed;  // false when it was brought back
+        uint64_t frame_ns;
+    };
+    // Called at every present, returns the validation object that was shed or brought back by this frame, if any
+    std::optional<Change> EndFrame();
+
+  private:
+    const uint64_t budget_ns_;
+    // kShedOrder without the validation objects the device does not have
+    std::vector<LayerObjectTypeId> sheddable_;
+
+    std::atomic<uint64_t> frame_ns_{0};
+    std::atomic<uint32_t> shed_mask_{0};
+
+    // Presents can come from several threads
+    std::mutex lock_;
+    uint32_t shed_count_ = 0;
+    uint32_t frames_over_ = 0;
+    uint32_t frames_under_ = 0;
+    // Indexed like sheddable_
+    std::vector<uint32_t> frames_to_bring_back_;
+    std::vector<uint32_t> frames_since_brought_back_;
+};
+
+}  // namespace profiling
+}  // namespace vvl
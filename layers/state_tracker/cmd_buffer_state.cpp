@@ -123,14 +123,14 @@ static bool GetMetalExport(const VkEventCreateInfo *info) {
 
 namespace vvl {
 
-Event::Event(VkEvent handle, const VkEventCreateInfo *create_info)
+Event::Event(VkEvent handle, const VkEventCreateInfo *create_info, std::shared_ptr<EventIndexAllocator> index_allocator)
     : StateObject(handle, kVulkanObjectTypeEvent),
-      flags(create_info->flags)
+      flags(create_info->flags),
+      dense_index(index_allocator->Allocate()),
 #ifdef VK_USE_PLATFORM_METAL_EXT
-      ,
-      metal_event_export(GetMetalExport(create_info))
+      metal_event_export(GetMetalExport(create_info)),
 #endif  // VK_USE_PLATFORM_METAL_EXT
-{
+      index_allocator_(std::move(index_allocator)) {
 }
 
 CommandPool::CommandPool(DeviceState &dev, VkCommandPool handle, const VkCommandPoolCreateInfo *create_info, VkQueueFlags flags)
@@ -159,10 +159,10 @@ void CommandPool::Free(uint32_t count, const VkCommandBuffer *command_buffers) {
     }
 }
 
-void CommandPool::Reset(const Location &loc) {
+void CommandPool::Reset() {
     for (auto &entry : commandBuffers) {
         auto guard = entry.second->WriteLock();
-        entry.second->Reset(loc);
+        entry.second->ResetFromPool();
     }
 }
 
@@ -223,10 +223,9 @@ void CommandBuffer::RemoveChild(std::shared_ptr<StateObject> &child_node) {
 // Reset the command buffer state
 // Maintain the createInfo and set state to CB_NEW, but clear all other state
 void CommandBuffer::ResetCBState() {
-    // Remove object bindings
-    for (const auto &obj : object_bindings) {
-        obj->RemoveParent(this);
-    }
+    // Remove object bindings, without locking and erasing from every bound object
+    UnlinkAllChildren();
+    reset_pending_ = false;
     object_bindings.clear();
     broken_bindings.clear();
 
@@ -240,6 +239,8 @@ void CommandBuffer::ResetCBState() {
     command_count = 0;
     submit_count = 0;
     image_layout_change_count = 1;  // Start at 1. 0 is insert value for validation cache versions, s.t. new == dirty
+    graphics_state_change_count++;  // Never rewound, so a count cached before the reset can't match again
+    attachments_change_count = 1;
 
     dynamic_state_status.cb.reset();
     dynamic_state_status.pipeline.reset();
@@ -269,8 +270,15 @@ void CommandBuffer::ResetCBState() {
     active_queries.clear();
     started_queries.clear();
     render_pass_queries.clear();
-    image_layout_registry.clear();
+    // Aliased layout maps are shared by several images, only the others are kept for the next recording
     aliased_image_layout_map.clear();
+    spare_image_layout_maps.clear();
+    for (auto &[image, layout_map] : image_layout_registry) {
+        if (layout_map && layout_map.use_count() == 1) {
+            spare_image_layout_maps.emplace(image, std::move(layout_map));
+        }
+    }
+    image_layout_registry.clear();
     current_vertex_buffer_binding_info.clear();
     primary_command_buffer = VK_NULL_HANDLE;
     linked_command_buffers.clear();
@@ -310,12 +318,20 @@ void CommandBuffer::Reset(const Location &loc) {
     }
 }
 
+void CommandBuffer::ResetFromPool() {
+    UnlinkAllChildren();
+    state = CbState::New;
+    reset_pending_ = true;
+    Invalidate(true);
+}
+
 void CommandBuffer::Destroy() {
     // Remove the cb debug labels
     dev_data.debug_report->EraseCmdDebugUtilsLabel(VkHandle());
     {
         auto guard = WriteLock();
         ResetCBState();
+        spare_image_layout_maps.clear();
     }
     for (auto &item : sub_states_) {
         item.second->Destroy();
@@ -411,8 +427,15 @@ std::shared_ptr<CommandBufferImageLayoutMap> CommandBuffer::GetOrCreateImageLayo
             aliased_image_layout_map.emplace(p_global_layout_map, image_layout_map);
         }
     } else {
-        image_layout_map =
-            std::make_shared<CommandBufferImageLayoutMap>(image_state.subresource_encoder.SubresourceCount(), image_state.GetId());
+        auto spare = spare_image_layout_maps.find(image_state.VkHandle());
+        if (spare != spare_image_layout_maps.end() && image_state.GetId() == spare->second->image_id) {
+            image_layout_map = std::move(spare->second);
+            image_layout_map->clear();
+            spare_image_layout_maps.erase(spare);
+        } else {
+            image_layout_map = std::make_shared<CommandBufferImageLayoutMap>(image_state.subresource_encoder.SubresourceCount(),
+                                                                             image_state.GetId());
+        }
     }
     if (iter != image_layout_registry.end()) {
         // overwrite the stale entry
@@ -425,6 +448,7 @@ std::shared_ptr<CommandBufferImageLayoutMap> CommandBuffer::GetOrCreateImageLayo
 }
 
 void CommandBuffer::RecordBeginQuery(const QueryObject &query_obj, const Location &loc) {
+    graphics_state_change_count++;
     active_queries.insert(query_obj);
     started_queries.insert(query_obj);
 
@@ -439,6 +463,7 @@ void CommandBuffer::RecordBeginQuery(const QueryObject &query_obj, const Locatio
 }
 
 void CommandBuffer::RecordEndQuery(const QueryObject &query_obj, const Location &loc) {
+    graphics_state_change_count++;
     active_queries.erase(query_obj);
     updated_queries.insert(query_obj);
     if (query_obj.inside_render_pass) {
@@ -463,6 +488,7 @@ bool CommandBuffer::UpdatesQuery(const QueryObject &query_obj) const {
 }
 
 void CommandBuffer::RecordEndQueries(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
+    graphics_state_change_count++;
     for (uint32_t slot = firstQuery; slot < (firstQuery + queryCount); slot++) {
         QueryObject query_obj = {queryPool, slot};
         active_queries.erase(query_obj);
@@ -587,7 +613,10 @@ void CommandBuffer::UpdateSubpassAttachments() {
         if (attachment_index != VK_ATTACHMENT_UNUSED) {
             active_attachments[attachment_index].type = AttachmentInfo::Type::Color;
             active_attachments[attachment_index].color_index = index;
-            active_color_attachments_index.insert(index);
+            if (std::find(active_color_attachments_index.begin(), active_color_attachments_index.end(), index) ==
+                active_color_attachments_index.end()) {
+                active_color_attachments_index.emplace_back(index);
+            }
             active_subpasses[attachment_index].used = true;
             active_subpasses[attachment_index].usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
             active_subpasses[attachment_index].layout = subpass.pColorAttachments[index].layout;
@@ -665,6 +694,7 @@ void CommandBuffer::UpdateAttachmentsView(const VkRenderPassBeginInfo *pRenderPa
 void CommandBuffer::RecordBeginRenderPass(const VkRenderPassBeginInfo &render_pass_begin,
                                           const VkSubpassBeginInfo &subpass_begin_info, const Location &loc) {
     command_count++;
+    graphics_state_change_count++;
     active_framebuffer = dev_data.Get<vvl::Framebuffer>(render_pass_begin.framebuffer);
     active_render_pass = dev_data.Get<vvl::RenderPass>(render_pass_begin.renderPass);
     render_area = render_pass_begin.renderArea;
@@ -696,6 +726,7 @@ void CommandBuffer::RecordBeginRenderPass(const VkRenderPassBeginInfo &render_pa
     render_pass_device_mask = chained_device_group_struct ? chained_device_group_struct->deviceMask : initial_device_mask;
 
     attachment_source = AttachmentSource::RenderPass;
+    attachments_change_count++;
     active_subpasses.clear();
     active_attachments.clear();
 
@@ -716,8 +747,10 @@ void CommandBuffer::RecordBeginRenderPass(const VkRenderPassBeginInfo &render_pa
 void CommandBuffer::RecordNextSubpass(const VkSubpassBeginInfo &subpass_begin_info, const VkSubpassEndInfo *subpass_end_info,
                                       const Location &loc) {
     command_count++;
+    graphics_state_change_count++;
     SetActiveSubpass(GetActiveSubpass() + 1);
     active_subpass_contents = subpass_begin_info.contents;
+    attachments_change_count++;
     ASSERT_AND_RETURN(active_render_pass);
 
     if (active_framebuffer) {
@@ -740,6 +773,7 @@ void CommandBuffer::RecordNextSubpass(const VkSubpassBeginInfo &subpass_begin_in
 }
 
 void CommandBuffer::RecordEndRenderPass(const VkSubpassEndInfo *subpass_end_info, const Location &loc) {
+    graphics_state_change_count++;
     // Call first so SubState can use render pass object before we destroy it
     for (auto &item : sub_states_) {
         item.second->RecordEndRenderPass(subpass_end_info, loc);
@@ -748,6 +782,7 @@ void CommandBuffer::RecordEndRenderPass(const VkSubpassEndInfo *subpass_end_info
     command_count++;
     active_render_pass = nullptr;
     attachment_source = AttachmentSource::Empty;
+    attachments_change_count++;
     active_attachments.clear();
     active_subpasses.clear();
     active_color_attachments_index.clear();
@@ -758,6 +793,7 @@ void CommandBuffer::RecordEndRenderPass(const VkSubpassEndInfo *subpass_end_info
 
 void CommandBuffer::RecordBeginRendering(const VkRenderingInfo &rendering_info, const Location &loc) {
     command_count++;
+    graphics_state_change_count++;
     active_render_pass = std::make_shared<vvl::RenderPass>(&rendering_info, true);
     render_area = rendering_info.renderArea;
     render_pass_queries.clear();
@@ -787,7 +823,9 @@ void CommandBuffer::RecordBeginRendering(const VkRenderingInfo &rendering_info,
     has_render_pass_instance = true;
 
     attachment_source = AttachmentSource::DynamicRendering;
+    attachments_change_count++;
     active_attachments.clear();
+    active_color_attachments_index.clear();
     // add 2 for the Depth and Stencil
     // multiple by 2 because every attachment might have a resolve
     // add 1 for FragmentDensityMap (doesn't need a resolve)
@@ -806,7 +844,7 @@ void CommandBuffer::RecordBeginRendering(const VkRenderingInfo &rendering_info,
             color_attachment.image_view = dev_data.Get<vvl::ImageView>(rendering_info.pColorAttachments[i].imageView).get();
             color_attachment.type = AttachmentInfo::Type::Color;
             color_attachment.color_index = i;
-            active_color_attachments_index.insert(i);
+            active_color_attachments_index.emplace_back(i);
             if (rendering_info.pColorAttachments[i].resolveMode != VK_RESOLVE_MODE_NONE &&
                 rendering_info.pColorAttachments[i].resolveImageView != VK_NULL_HANDLE) {
                 auto &resolve_attachment = active_attachments[GetDynamicRenderingColorResolveAttachmentIndex(i)];
@@ -853,6 +891,7 @@ void CommandBuffer::RecordBeginRendering(const VkRenderingInfo &rendering_info,
 }
 
 void CommandBuffer::RecordEndRendering(const VkRenderingEndInfoEXT *pRenderingEndInfo) {
+    graphics_state_change_count++;
     // Call first so SubState can use render pass object before we destroy it
     for (auto &item : sub_states_) {
         item.second->RecordEndRendering(pRenderingEndInfo);
@@ -1094,7 +1133,7 @@ void vvl::CommandBuffer::RecordEncodeVideo(const VkVideoEncodeInfoKHR &encode_in
 }
 
 void CommandBuffer::Begin(const VkCommandBufferBeginInfo *pBeginInfo) {
-    if (CbState::Recorded == state || CbState::InvalidComplete == state) {
+    if (CbState::Recorded == state || CbState::InvalidComplete == state || reset_pending_) {
         Location loc(Func::vkBeginCommandBuffer);
         Reset(loc);
     }
@@ -1119,6 +1158,7 @@ void CommandBuffer::Begin(const VkCommandBufferBeginInfo *pBeginInfo) {
                 if (inheritance_info.framebuffer) {
                     active_framebuffer = dev_data.Get<vvl::Framebuffer>(inheritance_info.framebuffer);
                     attachment_source = AttachmentSource::Inheritance;
+                    attachments_change_count++;
                     active_subpasses.clear();
                     active_attachments.clear();
 
@@ -1168,6 +1208,7 @@ void CommandBuffer::End(VkResult result) {
 
 void CommandBuffer::RecordExecuteCommands(vvl::span<const VkCommandBuffer> secondary_command_buffers, const Location &loc) {
     command_count++;
+    graphics_state_change_count++;
     uint32_t cmd_index = 0;
     for (const VkCommandBuffer sub_command_buffer : secondary_command_buffers) {
         auto secondary_cb_state = dev_data.GetWrite<CommandBuffer>(sub_command_buffer);
@@ -1593,6 +1634,7 @@ void CommandBuffer::RecordStateCmd(CBDynamicState state) {
 }
 
 void CommandBuffer::RecordDynamicState(CBDynamicState state) {
+    graphics_state_change_count++;
     dynamic_state_status.cb.set(state);
     dynamic_state_status.pipeline.set(state);
     dynamic_state_status.history.set(state);
@@ -1923,6 +1965,7 @@ void CommandBuffer::RecordPushConstants(const vvl::PipelineLayout &pipeline_layo
 
 void CommandBuffer::RecordBeginConditionalRendering() {
     command_count++;
+    graphics_state_change_count++;
     conditional_rendering_active = true;
     conditional_rendering_inside_render_pass = active_render_pass != nullptr;
     conditional_rendering_subpass = GetActiveSubpass();
@@ -1930,6 +1973,7 @@ void CommandBuffer::RecordBeginConditionalRendering() {
 
 void CommandBuffer::RecordEndConditionalRendering() {
     command_count++;
+    graphics_state_change_count++;
     conditional_rendering_active = false;
     conditional_rendering_inside_render_pass = false;
     conditional_rendering_subpass = 0;
@@ -1937,6 +1981,7 @@ void CommandBuffer::RecordEndConditionalRendering() {
 
 void CommandBuffer::RecordSetRenderingInputAttachmentIndices(const VkRenderingInputAttachmentIndexInfo *pLocationInfo) {
     command_count++;
+    graphics_state_change_count++;
     rendering_attachments.set_color_indexes = true;
     rendering_attachments.color_indexes.resize(pLocationInfo->colorAttachmentCount);
     for (uint32_t i = 0; i < pLocationInfo->colorAttachmentCount; ++i) {
@@ -2016,6 +2061,7 @@ bool CommandBuffer::HasExternalFormatResolveAttachment() const {
 }
 
 void CommandBuffer::BindShader(VkShaderStageFlagBits shader_stage, vvl::ShaderObject *shader_object_state) {
+    graphics_state_change_count++;
     auto &last_bound_state = lastBound[ConvertStageToVvlBindPoint(shader_stage)];
     const auto stage_index = static_cast<uint32_t>(ConvertToShaderObjectStage(shader_stage));
     last_bound_state.shader_object_bound[stage_index] = true;
@@ -2025,6 +2071,7 @@ void CommandBuffer::BindShader(VkShaderStageFlagBits shader_stage, vvl::ShaderOb
 // Only called for Graphics and during Multiview
 // "When multiview is enabled, at the beginning of each subpass all non-render pass state is undefined."
 void CommandBuffer::UnbindResources() {
+    graphics_state_change_count++;
     // Vertex and index buffers
     index_buffer_binding.reset();
     current_vertex_buffer_binding_info.clear();
@@ -2109,11 +2156,10 @@ void CommandBuffer::EndLabel() {
     label_commands_.emplace_back(LabelCommand{false, std::string()});
 }
 
-void CommandBuffer::ReplayLabelCommands(const vvl::span<const LabelCommand> &label_commands,
-                                        std::vector<std::string> &label_stack) {
+void CommandBuffer::ReplayLabelCommands(const vvl::span<const LabelCommand> &label_commands, LabelStack &label_stack) {
     for (const LabelCommand &command : label_commands) {
         if (command.begin) {
-            label_stack.emplace_back(command.label_name.empty() ? "(empty label)" : command.label_name);
+            label_stack.push_back(command.label_name.empty() ? "(empty label)" : command.label_name);
         } else if (!label_stack.empty()) {
             // The above condition is needed for several reasons. On the primary command buffer level
             // the labels are not necessary balanced. And if the empty stack is detected in the context
@@ -2125,7 +2171,7 @@ void CommandBuffer::ReplayLabelCommands(const vvl::span<const LabelCommand> &lab
 }
 
 std::string CommandBuffer::GetDebugRegionName(const std::vector<LabelCommand> &label_commands, uint32_t label_command_index,
-                                              const std::vector<std::string> &initial_label_stack) {
+                                              const LabelStack &initial_label_stack) {
     if (label_command_index >= label_commands.size()) {
         // Can happen due to core validation error when in-use command buffer was re-recorded.
         // It's a bug if this happens in a valid vulkan program.
@@ -2136,14 +2182,7 @@ std::string CommandBuffer::GetDebugRegionName(const std::vector<LabelCommand> &l
     vvl::CommandBuffer::ReplayLabelCommands(label_commands_to_replay, label_stack);
 
     // Build up complete debug region name from all enclosing regions
-    std::string debug_region;
-    for (const std::string &label_name : label_stack) {
-        if (!debug_region.empty()) {
-            debug_region += "::";
-        }
-        debug_region += label_name;
-    }
-    return debug_region;
+    return label_stack.GetRegionName();
 }
 
 std::string CommandBuffer::DescribeInvalidatedState(CBDynamicState dynamic_state) const {
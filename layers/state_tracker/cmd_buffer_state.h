@@ -23,6 +23,7 @@
 #include "state_tracker/pipeline_sub_state.h"
 #include "state_tracker/video_session_state.h"
 #include "state_tracker/last_bound_state.h"
+#include "state_tracker/label_stack.h"
 #include "state_tracker/query_state.h"
 #include "state_tracker/vertex_index_buffer_state.h"
 #include "utils/sync_utils.h"
@@ -108,12 +109,38 @@ struct SubpassInfo {
 
 namespace vvl {
 
+// Hands out small indices to the events of a device, an index is reused once the vvl::Event holding it is freed
+class EventIndexAllocator {
+  public:
+    uint32_t Allocate() {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (free_indices_.empty()) {
+            return index_count_++;
+        }
+        const uint32_t index = free_indices_.back();
+        free_indices_.pop_back();
+        return index;
+    }
+    void Free(uint32_t index) {
+        std::lock_guard<std::mutex> guard(lock_);
+        free_indices_.push_back(index);
+    }
+
+  private:
+    std::mutex lock_;
+    std::vector<uint32_t> free_indices_;
+    uint32_t index_count_ = 0;
+};
+
 class Event : public StateObject {
   public:
-    Event(VkEvent handle, const VkEventCreateInfo *create_info);
+    Event(VkEvent handle, const VkEventCreateInfo *create_info, std::shared_ptr<EventIndexAllocator> index_allocator);
+    ~Event() { index_allocator_->Free(dense_index); }
     VkEvent VkHandle() const { return handle_.Cast<VkEvent>(); }
 
     const VkEventCreateFlags flags;
+    // Unique among the events of the device that are still referenced, lets per submission event state be a dense array
+    const uint32_t dense_index;
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
     const bool metal_event_export;
@@ -130,6 +157,9 @@ class Event : public StateObject {
 
     // Queue that signaled this event. It's null if event was signaled from the host.
     VkQueue signaling_queue = VK_NULL_HANDLE;
+
+  private:
+    std::shared_ptr<EventIndexAllocator> index_allocator_;
 };
 
 // Track command pools and their command buffers
@@ -150,7 +180,7 @@ class CommandPool : public StateObject {
 
     void Allocate(const VkCommandBufferAllocateInfo *allocate_info, const VkCommandBuffer *command_buffers);
     void Free(uint32_t count, const VkCommandBuffer *command_buffers);
-    void Reset(const Location &loc);
+    void Reset();
 
     void Destroy() override;
 };
@@ -166,6 +196,8 @@ class CommandBuffer : public RefcountedStateObject, public SubStateManager<Comma
 
   public:
     using AliasedLayoutMap = vvl::unordered_map<const ImageLayoutMap *, std::shared_ptr<CommandBufferImageLayoutMap>>;
+    // Color attachments tracked without a heap allocation, 8 is the maxColorAttachments of most devices
+    static constexpr uint32_t kInlineColorAttachmentCount = 8;
 
     VkCommandBufferAllocateInfo allocate_info;
 
@@ -185,6 +217,10 @@ class CommandBuffer : public RefcountedStateObject, public SubStateManager<Comma
     uint64_t command_count;  // Number of commands recorded. Currently only used with VK_KHR_performance_query
     uint64_t submit_count;   // Number of times CB has been submitted
     uint64_t image_layout_change_count;  // The sequence number for changes to image layout (for cached validation)
+    uint64_t attachments_change_count;   // The sequence number for changes to |active_attachments| (for cached validation)
+    // The sequence number for changes to the state the draw time graphics checks read (pipeline/shaders, dynamic state, render
+    // pass, vertex/index buffers, active queries). Descriptor sets and push constants are not included, they are cached separately.
+    uint64_t graphics_state_change_count = 1;
 
     // Track status of all vkCmdSet* calls, if 1, means it was set
     struct DynamicStateStatus {
@@ -419,7 +455,8 @@ class CommandBuffer : public RefcountedStateObject, public SubStateManager<Comma
     std::vector<AttachmentInfo> active_attachments;
     // Used for checking all color attachments, values will be [0, colorAttachmentCount - 1] from either VkRenderingInfo or the
     // current subpass. The "active" part means the imageView was not VK_NULL_HANDLE/VK_ATTACHMENT_UNUSED
-    vvl::unordered_set<uint32_t> active_color_attachments_index;
+    // Each index is only added once
+    small_vector<uint32_t, kInlineColorAttachmentCount> active_color_attachments_index;
     bool has_render_pass_striped;
     uint32_t striped_count;
     VkRect2D render_area;
@@ -444,10 +481,10 @@ class CommandBuffer : public RefcountedStateObject, public SubStateManager<Comma
     struct RenderingAttachment {
         // VkRenderingAttachmentLocationInfo
         bool set_color_locations = false;
-        std::vector<uint32_t> color_locations;
+        small_vector<uint32_t, kInlineColorAttachmentCount> color_locations;
         // VkRenderingInputAttachmentIndexInfo
         bool set_color_indexes = false;
-        std::vector<uint32_t> color_indexes;
+        small_vector<uint32_t, kInlineColorAttachmentCount> color_indexes;
         const uint32_t *depth_index = nullptr;
         const uint32_t *stencil_index = nullptr;
         void Reset() {
@@ -467,6 +504,8 @@ class CommandBuffer : public RefcountedStateObject, public SubStateManager<Comma
     vvl::unordered_set<QueryObject> render_pass_queries;
     ImageLayoutRegistry image_layout_registry;
     AliasedLayoutMap aliased_image_layout_map;  // storage for potentially aliased images
+    // Layout maps of the previous recording, reused when the same images are used again (ex: a frame recorded every frame)
+    ImageLayoutRegistry spare_image_layout_maps;
 
     vvl::unordered_map<uint32_t, vvl::VertexBufferBinding> current_vertex_buffer_binding_info;
     vvl::IndexBufferBinding index_buffer_binding;
@@ -528,6 +567,10 @@ class CommandBuffer : public RefcountedStateObject, public SubStateManager<Comma
     }
 
     void Reset(const Location &loc);
+    // Reset of the whole pool (vkResetCommandPool). The command buffer is in the initial state right away, it no longer uses
+    // the objects it recorded and its primaries are invalidated, but clearing what it recorded is left to the next Begin() or
+    // Destroy(). So a pool reset costs the same for every command buffer, however much they recorded.
+    void ResetFromPool();
 
     std::shared_ptr<const CommandBufferImageLayoutMap> GetImageLayoutMap(VkImage image) const;
     std::shared_ptr<CommandBufferImageLayoutMap> GetOrCreateImageLayoutMap(const vvl::Image &image_state);
@@ -684,6 +727,7 @@ class CommandBuffer : public RefcountedStateObject, public SubStateManager<Comma
 
     inline void BindLastBoundPipeline(vvl::BindPoint bind_point, vvl::Pipeline *pipe_state) {
         lastBound[bind_point].pipeline_state = pipe_state;
+        graphics_state_change_count++;
     }
     void BindShader(VkShaderStageFlagBits shader_stage, vvl::ShaderObject *shader_object_state);
 
@@ -698,14 +742,17 @@ class CommandBuffer : public RefcountedStateObject, public SubStateManager<Comma
 
     // Applies label commands to the label_stack: for "begin label" command it pushes
     // a label on the stack, and for the "end label" command it removes the top label.
-    static void ReplayLabelCommands(const vvl::span<const LabelCommand> &label_commands, std::vector<std::string> &label_stack);
+    static void ReplayLabelCommands(const vvl::span<const LabelCommand> &label_commands, LabelStack &label_stack);
     // Computes debug region by replaying given commands on top initial label stack.
     static std::string GetDebugRegionName(const std::vector<LabelCommand> &label_commands, uint32_t label_command_index,
-                                          const std::vector<std::string> &initial_label_stack = {});
+                                          const LabelStack &initial_label_stack = {});
 
   private:
     void ResetCBState();
 
+    // Set by ResetFromPool() until the recorded state is cleared
+    bool reset_pending_ = false;
+
     // Keep track of how many CmdBeginDebugUtilsLabelEXT calls have been made without a matching CmdEndDebugUtilsLabelEXT.
     // Negative value for a secondary command buffer indicates invalid state.
     // Negative value for a primary command buffer is allowed. Validation is done at submit time accross all command buffers.
@@ -50,30 +50,78 @@ vvl::DescriptorPool::DescriptorPool(vvl::DeviceState &dev, const VkDescriptorPoo
       maxSets(pCreateInfo->maxSets),
       max_descriptor_type_count(GetMaxTypeCounts(pCreateInfo)),
       available_sets_(pCreateInfo->maxSets),
-      available_counts_(max_descriptor_type_count),
-      dev_data_(dev) {}
+      dev_data_(dev) {
+    for (const auto &[type, max_count] : max_descriptor_type_count) {
+        type_counts_.emplace_back(TypeCount{type, max_count, max_count});
+    }
+}
+
+const vvl::DescriptorPool::TypeCount *vvl::DescriptorPool::FindTypeCount(uint32_t type) const {
+    for (const TypeCount &type_count : type_counts_) {
+        if (type_count.type == type) {
+            return &type_count;
+        }
+    }
+    return nullptr;
+}
+
+small_vector<uint32_t, 8> vvl::DescriptorPool::GetAvailableCounts(const std::map<uint32_t, uint32_t> &required_by_type) const {
+    small_vector<uint32_t, 8> available_counts;
+    available_counts.reserve(static_cast<uint32_t>(required_by_type.size()));
+    auto guard = ReadLock();
+    for (const auto &entry : required_by_type) {
+        const TypeCount *type_count = FindTypeCount(entry.first);
+        available_counts.emplace_back(type_count ? type_count->available : 0);
+    }
+    return available_counts;
+}
+
+void vvl::DescriptorPool::UpdateAvailableCounts(const DescriptorSetLayout &layout, uint32_t variable_count, bool allocate) {
+    for (uint32_t i = 0; i < layout.GetBindingCount(); ++i) {
+        // Types that are not in the pool are not counted, the driver can still give them with VK_KHR_maintenance1
+        TypeCount *type_count = FindTypeCount(static_cast<uint32_t>(layout.GetTypeFromIndex(i)));
+        if (!type_count) {
+            continue;
+        }
+        const bool is_variable = layout.GetDescriptorBindingFlagsFromIndex(i) & VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT;
+        const uint32_t descriptor_count = is_variable ? variable_count : layout.GetDescriptorCountFromIndex(i);
+        if (allocate) {
+            type_count->available -= descriptor_count;
+        } else {
+            type_count->available += descriptor_count;
+        }
+    }
+}
 
 void vvl::DescriptorPool::Allocate(const VkDescriptorSetAllocateInfo *alloc_info, const VkDescriptorSet *descriptor_sets,
                                    const vvl::AllocateDescriptorSetsData &ds_data) {
     auto guard = WriteLock();
     const auto alloc_count = alloc_info->descriptorSetCount;
-    // Account for sets and individual descriptors allocated from pool
     available_sets_ -= alloc_count;
-    for (auto it = ds_data.required_descriptors_by_type.begin(); it != ds_data.required_descriptors_by_type.end(); ++it) {
-        available_counts_[it->first] -= ds_data.required_descriptors_by_type.at(it->first);
-    }
 
     const auto *variable_count_info = vku::FindStructInPNextChain<VkDescriptorSetVariableDescriptorCountAllocateInfo>(alloc_info->pNext);
     const bool variable_count_valid =
         variable_count_info && variable_count_info->descriptorSetCount == alloc_count;
 
+    sets_.reserve(sets_.size() + alloc_count);
     // Create tracking object for each descriptor set; insert into global map and the pool's set.
     for (uint32_t i = 0; i < alloc_count; i++) {
         uint32_t variable_count = variable_count_valid ? variable_count_info->pDescriptorCounts[i] : 0;
 
-        auto new_ds = dev_data_.CreateDescriptorSet(descriptor_sets[i], this, ds_data.layout_nodes[i], variable_count);
+        // Account for the descriptors the same way DeviceState::PreCallValidateAllocateDescriptorSets() counted them
+        PoolSet pool_set{nullptr, 0};
+        if (const auto &layout = ds_data.layout_nodes[i]) {
+            if (variable_count_info && i < variable_count_info->descriptorSetCount) {
+                pool_set.variable_count = variable_count_info->pDescriptorCounts[i];
+            } else if (layout->GetBindingCount() > 0) {
+                pool_set.variable_count = layout->GetDescriptorCountFromIndex(layout->GetLastIndex());
+            }
+            UpdateAvailableCounts(*layout, pool_set.variable_count, true);
+        }
 
-        sets_.emplace(descriptor_sets[i], new_ds.get());
+        auto new_ds = dev_data_.CreateDescriptorSet(descriptor_sets[i], this, ds_data.layout_nodes[i], variable_count);
+        pool_set.set = new_ds.get();
+        sets_.insert_or_assign(descriptor_sets[i], pool_set);
         dev_data_.Add(std::move(new_ds));
     }
     // clamp the unsigned subtraction to the range [0, last_free_count]
@@ -96,13 +144,9 @@ void vvl::DescriptorPool::Free(uint32_t count, const VkDescriptorSet *descriptor
         if (descriptor_sets[i] != VK_NULL_HANDLE) {
             auto iter = sets_.find(descriptor_sets[i]);
             ASSERT_AND_CONTINUE(iter != sets_.end());
-            auto *set_state = iter->second;
-            const auto &layout = set_state->Layout();
-            uint32_t type_index = 0, descriptor_count = 0;
-            for (uint32_t j = 0; j < layout.GetBindingCount(); ++j) {
-                type_index = static_cast<uint32_t>(layout.GetTypeFromIndex(j));
-                descriptor_count = layout.GetDescriptorCountFromIndex(j);
-                available_counts_[type_index] += descriptor_count;
+            const PoolSet &pool_set = iter->second;
+            if (pool_set.set->GetLayout()) {
+                UpdateAvailableCounts(*pool_set.set->GetLayout(), pool_set.variable_count, false);
             }
             dev_data_.Destroy<vvl::DescriptorSet>(iter->first);
             sets_.erase(iter);
@@ -113,19 +157,21 @@ void vvl::DescriptorPool::Free(uint32_t count, const VkDescriptorSet *descriptor
 void vvl::DescriptorPool::Reset() {
     auto guard = WriteLock();
     // For every set off of this pool, clear it, remove from setMap, and free vvl::DescriptorSet
-    for (auto entry : sets_) {
+    for (const auto &entry : sets_) {
         dev_data_.Destroy<vvl::DescriptorSet>(entry.first);
     }
     sets_.clear();
-    // Reset available count for each type and available sets for this pool
-    available_counts_ = max_descriptor_type_count;
+    // All the descriptors are available again, there is no need to give back what each set took
+    for (TypeCount &type_count : type_counts_) {
+        type_count.available = type_count.max;
+    }
     available_sets_ = maxSets;
 }
 
 const VulkanTypedHandle *vvl::DescriptorPool::InUse() const {
     auto guard = ReadLock();
     for (const auto &entry : sets_) {
-        const auto *ds = entry.second;
+        const auto *ds = entry.second.set;
         if (ds) {
             return ds->InUse();
         }
@@ -501,6 +547,63 @@ vvl::DescriptorSetLayout::DescriptorSetLayout(VkDevice device, const VkDescripto
     }
 }
 
+vvl::TemplateWritePlan vvl::BuildTemplateWritePlan(const DescriptorSetLayout &layout,
+                                                   const VkDescriptorUpdateTemplateCreateInfo &create_info) {
+    TemplateWritePlan plan;
+    plan.layout_def = layout.GetLayoutId();
+    for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
+        const auto &entry = create_info.pDescriptorUpdateEntries[i];
+        uint32_t binding_count = layout.GetDescriptorCountFromBinding(entry.dstBinding);
+        uint32_t binding_being_updated = entry.dstBinding;
+        uint32_t dst_array_element = entry.dstArrayElement;
+
+        // Create a write for each descriptor, except for inline uniform blocks and acceleration structures that need only one
+        for (uint32_t j = 0; j < entry.descriptorCount; j++) {
+            if (dst_array_element >= binding_count) {
+                dst_array_element = 0;
+                binding_being_updated = layout.GetNextValidBinding(binding_being_updated);
+            }
+            TemplateWritePlan::Write write{binding_being_updated, dst_array_element, 1, entry.descriptorType,
+                                           entry.offset + j * entry.stride};
+            bool single_write = false;
+            switch (entry.descriptorType) {
+                case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK:
+                    // descriptorCount must match the dataSize member of the VkWriteDescriptorSetInlineUniformBlock structure
+                    write.descriptor_count = entry.descriptorCount;
+                    plan.inline_uniform_block_count++;
+                    single_write = true;
+                    break;
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+                    write.descriptor_count = entry.descriptorCount;
+                    plan.acceleration_structure_khr_count++;
+                    single_write = true;
+                    break;
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+                    write.descriptor_count = entry.descriptorCount;
+                    plan.acceleration_structure_nv_count++;
+                    single_write = true;
+                    break;
+                default:
+                    break;
+            }
+            plan.writes.emplace_back(write);
+            dst_array_element++;
+            if (single_write) {
+                break;
+            }
+        }
+    }
+    return plan;
+}
+
+vvl::DescriptorUpdateTemplate::DescriptorUpdateTemplate(VkDescriptorUpdateTemplate handle,
+                                                        const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo,
+                                                        const DescriptorSetLayout *layout)
+    : StateObject(handle, kVulkanObjectTypeDescriptorUpdateTemplate),
+      safe_create_info(pCreateInfo),
+      create_info(*safe_create_info.ptr()),
+      write_plan(layout ? BuildTemplateWritePlan(*layout, create_info) : TemplateWritePlan()) {}
+
 vvl::DescriptorSet::DescriptorSet(const VkDescriptorSet handle, vvl::DescriptorPool *pool_state,
                                   const std::shared_ptr<DescriptorSetLayout const> &layout, uint32_t variable_count,
                                   vvl::DeviceState *state_data)
@@ -659,28 +762,53 @@ void vvl::DescriptorSet::NotifyUpdate() {
     }
 }
 
+void vvl::DescriptorSet::NotifyWrite(uint32_t binding, uint32_t array_element, uint32_t descriptor_count) {
+    for (auto &item : sub_states_) {
+        item.second->NotifyWrite(binding, array_element, descriptor_count);
+    }
+}
+
 // Loop through the write updates to do for a push descriptor set, ignoring dstSet
+// The set is reused by the command buffer for every push while the layout stays compatible, the writes are not kept
 void vvl::DescriptorSet::PerformPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *write_descs) {
     assert(IsPushDescriptor());
     for (uint32_t i = 0; i < write_count; i++) {
-        PerformWriteUpdate(write_descs[i]);
+        WriteDescriptors(write_descs[i]);
     }
 
-    push_descriptor_set_writes.clear();
-    push_descriptor_set_writes.reserve(static_cast<std::size_t>(write_count));
-    for (uint32_t i = 0; i < write_count; i++) {
-        push_descriptor_set_writes.push_back(vku::safe_VkWriteDescriptorSet(&write_descs[i]));
+    for (auto &item : sub_states_) {
+        item.second->NotifyPushDescriptorsUpdate(write_count, write_descs);
     }
-
     NotifyUpdate();
 }
 
 // Perform write update in given update struct
 void vvl::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &update) {
+    if (WriteDescriptors(update)) {
+        Invalidate(false);
+    }
+    NotifyUpdate();
+}
+
+void vvl::DescriptorSet::PerformWriteUpdates(uint32_t write_count, const VkWriteDescriptorSet *writes) {
+    bool invalidate = false;
+    for (uint32_t i = 0; i < write_count; i++) {
+        invalidate |= WriteDescriptors(writes[i]);
+    }
+    if (invalidate) {
+        Invalidate(false);
+    }
+    NotifyUpdate();
+}
+
+bool vvl::DescriptorSet::WriteDescriptors(const VkWriteDescriptorSet &update) {
     // Perform update on a per-binding basis as consecutive updates roll over to next binding
     auto descriptors_remaining = update.descriptorCount;
     auto iter = FindDescriptor(update.dstBinding, update.dstArrayElement);
-    ASSERT_AND_RETURN(iter.IsValid());
+    if (!iter.IsValid()) {
+        assert(false);
+        return false;
+    }
     auto &orig_binding = iter.CurrentBinding();
 
     // Verify next consecutive binding matches type, stage flags & immutable sampler use and if AtEnd
@@ -694,14 +822,11 @@ void vvl::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &update)
     if (update.descriptorCount) {
         some_update_ = true;
         ++change_count_;
+        NotifyWrite(update.dstBinding, update.dstArrayElement, update.descriptorCount);
     }
 
-    if (!IsPushDescriptor() && !(orig_binding.binding_flags & (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT |
-                                                               VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT))) {
-        Invalidate(false);
-    }
-
-    NotifyUpdate();
+    return !IsPushDescriptor() && !(orig_binding.binding_flags & (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT |
+                                                                  VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT));
 }
 
 // Perform Copy update
@@ -727,6 +852,9 @@ void vvl::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &update, co
             dst_iter.updated(false);
         }
     }
+    if (update.descriptorCount) {
+        NotifyWrite(update.dstBinding, update.dstArrayElement, update.descriptorCount);
+    }
 
     if (!(layout_->GetDescriptorBindingFlagsFromBinding(update.dstBinding) &
           (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT))) {
@@ -763,21 +891,27 @@ void vvl::DescriptorSet::UpdateImageLayoutDrawStates(vvl::DeviceState *device_da
             case DescriptorClass::Image: {
                 auto *image_binding = static_cast<ImageBinding *>(binding);
                 for (uint32_t i = 0; i < image_binding->count; ++i) {
-                    image_binding->descriptors[i].UpdateImageLayoutDrawState(cb_state);
+                    if (image_binding->updated[i]) {
+                        image_binding->descriptors[i].UpdateImageLayoutDrawState(cb_state);
+                    }
                 }
                 break;
             }
             case DescriptorClass::ImageSampler: {
                 auto *image_binding = static_cast<ImageSamplerBinding *>(binding);
                 for (uint32_t i = 0; i < image_binding->count; ++i) {
-                    image_binding->descriptors[i].UpdateImageLayoutDrawState(cb_state);
+                    if (image_binding->updated[i]) {
+                        image_binding->descriptors[i].UpdateImageLayoutDrawState(cb_state);
+                    }
                 }
                 break;
             }
             case DescriptorClass::Mutable: {
                 auto *mutable_binding = static_cast<MutableBinding *>(binding);
                 for (uint32_t i = 0; i < mutable_binding->count; ++i) {
-                    mutable_binding->descriptors[i].UpdateImageLayoutDrawState(cb_state);
+                    if (mutable_binding->updated[i]) {
+                        mutable_binding->descriptors[i].UpdateImageLayoutDrawState(cb_state);
+                    }
                 }
                 break;
             }
@@ -21,6 +21,7 @@
 #include "state_tracker/state_object.h"
 #include "utils/hash_util.h"
 #include "state_tracker/shader_stage_state.h"
+#include "containers/paged_array.h"
 #include "containers/small_vector.h"
 #include "generated/vk_object_types.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
@@ -42,6 +43,8 @@ class BufferView;
 class Pipeline;
 class AccelerationStructureNV;
 class AccelerationStructureKHR;
+class DescriptorSetLayout;
+class DescriptorSetLayoutDef;
 struct AllocateDescriptorSetsData;
 
 // "bindless" does not have a concrete definition, but we use it as means to know:
@@ -67,15 +70,18 @@ class DescriptorPool : public StateObject {
     const VulkanTypedHandle *InUse() const override;
     uint32_t GetAvailableCount(uint32_t type) const {
         auto guard = ReadLock();
-        auto iter = available_counts_.find(type);
-        return iter != available_counts_.end() ? iter->second : 0;
+        const TypeCount *type_count = FindTypeCount(type);
+        return type_count ? type_count->available : 0;
     }
+    // The available count of each type of |required_by_type| (in its order), all read under one lock so the capacity of the
+    // pool is checked against the whole allocation at once
+    small_vector<uint32_t, 8> GetAvailableCounts(const std::map<uint32_t, uint32_t> &required_by_type) const;
 
     // The type map is only created once so can guarantee this will find if type was used
     // Unlike GetAvailableCount, this won't give a false positive that it just ran out of an available count
     bool IsAvailableType(uint32_t type) const {
         auto guard = ReadLock();
-        return available_counts_.find(type) != available_counts_.end();
+        return FindTypeCount(type) != nullptr;
     }
 
     uint32_t GetAvailableSets() const {
@@ -97,23 +103,65 @@ class DescriptorPool : public StateObject {
   protected:
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
-    uint32_t available_sets_;        // Available descriptor sets in this pool
-    TypeCountMap available_counts_;  // Available # of descriptors of each type in this pool
-    vvl::unordered_map<VkDescriptorSet, vvl::DescriptorSet *> sets_;  // Collection of all sets in this pool
+
+    // A pool only has a few descriptor types, so they are kept in a small array that is searched instead of hashed
+    struct TypeCount {
+        uint32_t type;
+        uint32_t max;
+        uint32_t available;
+    };
+    const TypeCount *FindTypeCount(uint32_t type) const;
+    TypeCount *FindTypeCount(uint32_t type) {
+        return const_cast<TypeCount *>(static_cast<const DescriptorPool *>(this)->FindTypeCount(type));
+    }
+    // Takes (or gives back) the descriptors a set of |layout| uses
+    void UpdateAvailableCounts(const DescriptorSetLayout &layout, uint32_t variable_count, bool allocate);
+
+    // What a set took from the pool, so the same amount is given back when it is freed
+    struct PoolSet {
+        vvl::DescriptorSet *set;
+        // Count taken for the VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT binding, if the layout has one
+        uint32_t variable_count;
+    };
+
+    uint32_t available_sets_;  // Available descriptor sets in this pool
+    small_vector<TypeCount, 4> type_counts_;
+    vvl::unordered_map<VkDescriptorSet, PoolSet> sets_;  // Collection of all sets in this pool
     DeviceState &dev_data_;
     mutable std::shared_mutex lock_;
     uint32_t freed_count{0};
 };
 
+// The VkWriteDescriptorSet a template update is decoded into, everything but the pointers to the application data.
+// The binding rollover only depends on the layout, so it is done once when the template is created.
+struct TemplateWritePlan {
+    struct Write {
+        uint32_t dst_binding;
+        uint32_t dst_array_element;
+        // 1, except for the byte size of an inline uniform block or the number of acceleration structures
+        uint32_t descriptor_count;
+        VkDescriptorType descriptor_type;
+        size_t offset;  // in pData
+    };
+    std::vector<Write> writes;
+    uint32_t inline_uniform_block_count = 0;
+    uint32_t acceleration_structure_khr_count = 0;
+    uint32_t acceleration_structure_nv_count = 0;
+    // Layout the plan was made for, null if there was none
+    std::shared_ptr<const DescriptorSetLayoutDef> layout_def;
+};
+
+TemplateWritePlan BuildTemplateWritePlan(const DescriptorSetLayout &layout, const VkDescriptorUpdateTemplateCreateInfo &create_info);
+
 class DescriptorUpdateTemplate : public StateObject {
   public:
     const vku::safe_VkDescriptorUpdateTemplateCreateInfo safe_create_info;
     const VkDescriptorUpdateTemplateCreateInfo &create_info;
+    // For the descriptorSetLayout, or the set of the pipelineLayout for push descriptors
+    const TemplateWritePlan write_plan;
 
-    DescriptorUpdateTemplate(VkDescriptorUpdateTemplate handle, const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo)
-        : StateObject(handle, kVulkanObjectTypeDescriptorUpdateTemplate),
-          safe_create_info(pCreateInfo),
-          create_info(*safe_create_info.ptr()) {}
+    DescriptorUpdateTemplate(VkDescriptorUpdateTemplate handle, const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo,
+                             const DescriptorSetLayout *layout);
 
     VkDescriptorUpdateTemplate VkHandle() const { return handle_.Cast<VkDescriptorUpdateTemplate>(); };
 };
@@ -733,7 +781,7 @@ template <typename T>
 class DescriptorBindingImpl : public DescriptorBinding {
   public:
     DescriptorBindingImpl(const VkDescriptorSetLayoutBinding &create_info, uint32_t count_, VkDescriptorBindingFlags binding_flags_)
-        : DescriptorBinding(create_info, count_, binding_flags_), descriptors(count_) {}
+        : DescriptorBinding(create_info, count_, binding_flags_), descriptors(count_, IsPaged(count_, binding_flags_)) {}
 
     const Descriptor *GetDescriptor(const uint32_t index) const override { return index < count ? &descriptors[index] : nullptr; }
 
@@ -770,9 +818,17 @@ class DescriptorBindingImpl : public DescriptorBinding {
         }
     }
 
+    // Large bindless arrays are usually sparsely written, their descriptors are only created when written
+    static constexpr uint32_t kMinPagedCount = 1024;
+    static bool IsPaged(uint32_t count, VkDescriptorBindingFlags flags) {
+        return count >= kMinPagedCount &&
+               (flags & (VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT)) != 0;
+    }
+
     // Most descriptor bindings will only have a single descriptor, so want to assume that
     // If they don't have 1, we will resize on construction (and never resize again) to the exact size with small_vector
-    small_vector<T, 1, uint32_t> descriptors;
+    // The descriptors that were never written must only be accessed as const, to not create their page
+    PagedArray<T> descriptors;
 };
 
 using SamplerBinding = DescriptorBindingImpl<SamplerDescriptor>;
@@ -785,14 +841,20 @@ using AccelerationStructureBinding = DescriptorBindingImpl<AccelerationStructure
 using MutableBinding = DescriptorBindingImpl<MutableDescriptor>;
 
 // Helper class to encapsulate the descriptor update template decoding logic
+// Sized so that most updates are decoded without allocating, the writes point into the pNext structs of this object
 struct DecodedTemplateUpdate {
-    std::vector<VkWriteDescriptorSet> desc_writes;
-    std::vector<VkWriteDescriptorSetInlineUniformBlock> inline_infos;
-    std::vector<VkWriteDescriptorSetAccelerationStructureKHR> inline_infos_khr;
-    std::vector<VkWriteDescriptorSetAccelerationStructureNV> inline_infos_nv;
-    DecodedTemplateUpdate(const DeviceState &device_data, VkDescriptorSet descriptorSet,
-                          const DescriptorUpdateTemplate &template_state, const void *pData,
-                          VkDescriptorSetLayout push_layout = VK_NULL_HANDLE);
+    small_vector<VkWriteDescriptorSet, 32> desc_writes;
+    small_vector<VkWriteDescriptorSetInlineUniformBlock, 2> inline_infos;
+    small_vector<VkWriteDescriptorSetAccelerationStructureKHR, 2> inline_infos_khr;
+    small_vector<VkWriteDescriptorSetAccelerationStructureNV, 2> inline_infos_nv;
+    // |push_layout| is the layout of the push descriptor set, it only needs a new plan if it is not the one of the template
+    DecodedTemplateUpdate(VkDescriptorSet descriptorSet, const DescriptorUpdateTemplate &template_state, const void *pData,
+                          const DescriptorSetLayout *push_layout = nullptr);
+    DecodedTemplateUpdate(const DecodedTemplateUpdate &) = delete;
+    DecodedTemplateUpdate &operator=(const DecodedTemplateUpdate &) = delete;
+
+  private:
+    void Decode(const TemplateWritePlan &plan, VkDescriptorSet descriptorSet, const void *pData);
 };
 
 /*
@@ -823,6 +885,11 @@ class DescriptorSetSubState {
 
     virtual void NotifyInvalidate(const StateObject::NodeList &invalid_nodes, bool unlink) {}
     virtual void NotifyUpdate() {}
+    // Called for each write or copy update, before NotifyUpdate. Written descriptors can roll over to the next bindings
+    virtual void NotifyWrite(uint32_t binding, uint32_t array_element, uint32_t descriptor_count) {}
+    // Called with the writes of each push to a push descriptor set, before NotifyUpdate. They only live for the call, a sub state
+    // needing them later has to copy them
+    virtual void NotifyPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *writes) {}
 
     const DescriptorSet &base;
 };
@@ -857,10 +924,13 @@ class DescriptorSet : public StateObject, public SubStateManager<DescriptorSetSu
     bool HasBinding(const uint32_t binding) const { return layout_->HasBinding(binding); };
 
     void NotifyUpdate();
+    void NotifyWrite(uint32_t binding, uint32_t array_element, uint32_t descriptor_count);
     // Perform a push update whose contents were just validated using ValidatePushDescriptorsUpdate
     virtual void PerformPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *write_descs);
     // Perform a WriteUpdate whose contents were just validated using ValidateWriteUpdate
     virtual void PerformWriteUpdate(const VkWriteDescriptorSet &);
+    // Same as PerformWriteUpdate() for each write, but only invalidates and notifies once
+    void PerformWriteUpdates(uint32_t write_count, const VkWriteDescriptorSet *writes);
     // Perform a CopyUpdate whose contents were just validated using ValidateCopyUpdate
     virtual void PerformCopyUpdate(const VkCopyDescriptorSet &, const DescriptorSet &src_set);
 
@@ -937,8 +1007,6 @@ class DescriptorSet : public StateObject, public SubStateManager<DescriptorSetSu
 
     uint64_t GetChangeCount() const { return change_count_; }
 
-    const std::vector<vku::safe_VkWriteDescriptorSet> &GetWrites() const { return push_descriptor_set_writes; }
-
     void Destroy() override;
 
     const DescriptorSetLayout &Layout() const { return *layout_; }
@@ -1081,6 +1149,9 @@ class DescriptorSet : public StateObject, public SubStateManager<DescriptorSetSu
         return std::unique_ptr<T, BindingDeleter>(new (location->data) T(create_info, descriptor_count, flags));
     }
 
+    // Returns true if the set has to be invalidated
+    bool WriteDescriptors(const VkWriteDescriptorSet &update);
+
     std::atomic<bool> some_update_;  // has any part of the set ever been updated?
     vvl::DescriptorPool *pool_state_;
     const std::shared_ptr<DescriptorSetLayout const> layout_;
@@ -1094,10 +1165,6 @@ class DescriptorSet : public StateObject, public SubStateManager<DescriptorSetSu
 
     // For a given dynamic offset index in the set, map to associated index of the descriptors in the set
     std::vector<std::pair<uint32_t, uint32_t>> dynamic_offset_idx_to_descriptor_list_;
-
-    // If this descriptor set is a push descriptor set, the descriptor
-    // set writes that were last pushed.
-    std::vector<vku::safe_VkWriteDescriptorSet> push_descriptor_set_writes;
 };
 
 // When updating a descriptor the VkDescriptorSetLayout can be sourced from 2 spots
@@ -41,7 +41,8 @@ vvl::IndirectCommandsLayout::IndirectCommandsLayout(vvl::DeviceState &dev, VkInd
       safe_create_info(pCreateInfo),
       create_info(*safe_create_info.ptr()),
       // default to graphics as it is most common and has most cases
-      bind_point(VK_PIPELINE_BIND_POINT_GRAPHICS) {
+      bind_point(VK_PIPELINE_BIND_POINT_GRAPHICS),
+      explicit_preprocess((pCreateInfo->flags & VK_INDIRECT_COMMANDS_LAYOUT_USAGE_EXPLICIT_PREPROCESS_BIT_EXT) != 0) {
     for (uint32_t i = 0; i < pCreateInfo->tokenCount; i++) {
         const VkIndirectCommandsLayoutTokenEXT &token = pCreateInfo->pTokens[i];
         switch (token.type) {
@@ -76,3 +77,19 @@ vvl::IndirectCommandsLayout::IndirectCommandsLayout(vvl::DeviceState &dev, VkInd
         }
     }
 }
+
+std::optional<VkDeviceSize> vvl::IndirectCommandsLayout::GetPreprocessSize(const IndirectExecutionSet &execution_set,
+                                                                           uint32_t max_sequence_count) const {
+    auto guard = ReadLockGuard{preprocess_sizes_lock_};
+    const auto it = preprocess_sizes_.find(PreprocessSizeKey(execution_set, max_sequence_count));
+    if (it == preprocess_sizes_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void vvl::IndirectCommandsLayout::SetPreprocessSize(const IndirectExecutionSet &execution_set, uint32_t max_sequence_count,
+                                                    VkDeviceSize size) const {
+    auto guard = WriteLockGuard{preprocess_sizes_lock_};
+    preprocess_sizes_[PreprocessSizeKey(execution_set, max_sequence_count)] = size;
+}
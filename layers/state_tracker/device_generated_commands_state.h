@@ -18,7 +18,10 @@
 #pragma once
 
 #include "state_tracker/state_object.h"
+#include "containers/custom_containers.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
+#include <optional>
+#include <shared_mutex>
 
 namespace vvl {
 class DeviceState;
@@ -63,8 +66,22 @@ class IndirectCommandsLayout : public StateObject {
     bool has_vertex_buffer_token = false;     // VK_INDIRECT_COMMANDS_TOKEN_TYPE_VERTEX_BUFFER_EXT
     bool has_draw_token = false;              // VK_INDIRECT_COMMANDS_TOKEN_TYPE_DRAW_*
     bool has_multi_draw_count_token = false;  // VK_INDIRECT_COMMANDS_TOKEN_TYPE_DRAW_*_COUNT_*
+    const bool explicit_preprocess;           // VK_INDIRECT_COMMANDS_LAYOUT_USAGE_EXPLICIT_PREPROCESS_BIT_EXT
 
     VkShaderStageFlags execution_set_token_shader_stage_flags = 0;
+
+    // The memory requirements size returned for this layout with an indirect execution set, so that executing the same
+    // layout, set and maxSequenceCount again does not query the driver again. The set is keyed by its id, which is never reused.
+    std::optional<VkDeviceSize> GetPreprocessSize(const IndirectExecutionSet &execution_set, uint32_t max_sequence_count) const;
+    void SetPreprocessSize(const IndirectExecutionSet &execution_set, uint32_t max_sequence_count, VkDeviceSize size) const;
+
+  private:
+    static uint64_t PreprocessSizeKey(const IndirectExecutionSet &execution_set, uint32_t max_sequence_count) {
+        return (uint64_t(execution_set.GetId()) << 32) | max_sequence_count;
+    }
+
+    mutable vvl::unordered_map<uint64_t, VkDeviceSize> preprocess_sizes_;
+    mutable std::shared_mutex preprocess_sizes_lock_;
 };
 
 }  // namespace vvl
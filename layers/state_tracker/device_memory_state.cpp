@@ -107,6 +107,38 @@ DeviceMemory::DeviceMemory(VkDeviceMemory handle, const VkMemoryAllocateInfo *in
       p_driver_data(nullptr),
       fake_base_address(fake_address) {
 }
+
+void DeviceMemory::AddBoundResource(StateObject &resource, VkDeviceSize offset, VkDeviceSize size) {
+    auto guard = WriteLockGuard{bound_resources_lock_};
+    bound_resources_.emplace(offset, BoundResource{resource.Handle(), resource.shared_from_this(), offset + size});
+    max_bound_size_ = std::max(max_bound_size_, size);
+}
+
+void DeviceMemory::RemoveBoundResource(const StateObject &resource, VkDeviceSize offset) {
+    auto guard = WriteLockGuard{bound_resources_lock_};
+    auto [first, last] = bound_resources_.equal_range(offset);
+    for (auto it = first; it != last; ++it) {
+        if (it->second.handle == resource.Handle()) {
+            bound_resources_.erase(it);
+            return;
+        }
+    }
+}
+
+StateObject::NodeList DeviceMemory::GetBoundResources(VkDeviceSize offset, VkDeviceSize size) const {
+    NodeList result;
+    auto guard = ReadLockGuard{bound_resources_lock_};
+    // Nothing bound can start more than max_bound_size_ before the range and still overlap it
+    const VkDeviceSize search_begin = offset > max_bound_size_ ? offset - max_bound_size_ : 0;
+    const VkDeviceSize end = offset + size;
+    for (auto it = bound_resources_.lower_bound(search_begin); it != bound_resources_.end() && it->first < end; ++it) {
+        if (it->second.end <= offset) continue;
+        if (auto node = it->second.node.lock()) {
+            result.emplace_back(std::move(node));
+        }
+    }
+    return result;
+}
 }  // namespace vvl
 
 void vvl::BindableLinearMemoryTracker::BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &memory_state,
@@ -114,9 +146,16 @@ void vvl::BindableLinearMemoryTracker::BindMemory(StateObject *parent, std::shar
     ASSERT_AND_RETURN(memory_state);
 
     memory_state->AddParent(parent);
+    memory_state->AddBoundResource(*parent, memory_offset, size);
     binding_ = {memory_state, memory_offset, 0u};
 }
 
+void vvl::BindableLinearMemoryTracker::RemoveBoundResource(const StateObject &parent) {
+    if (binding_.memory_state) {
+        binding_.memory_state->RemoveBoundResource(parent, binding_.memory_offset);
+    }
+}
+
 DeviceMemoryState vvl::BindableLinearMemoryTracker::GetBoundMemoryStates() const {
     return binding_.memory_state ? DeviceMemoryState{binding_.memory_state} : DeviceMemoryState{};
 }
@@ -160,39 +199,115 @@ unsigned vvl::BindableSparseMemoryTracker::CountDeviceMemory(VkDeviceMemory memo
 
 bool vvl::BindableSparseMemoryTracker::HasFullRangeBound() const {
     if (!is_resident_) {
-        VkDeviceSize current_offset = 0u;
-        {
-            auto guard = ReadLockGuard{binding_lock_};
-            for (const auto &range : binding_map_) {
-                if (current_offset != range.first.begin || !range.second.memory_state || range.second.memory_state->Invalid()) {
-                    return false;
-                }
-                current_offset = range.first.end;
+        auto guard = ReadLockGuard{binding_lock_};
+        // Bindings do not overlap, the whole resource is bound when all the bound bytes are within it and add up to its size
+        if (resource_bound_size_ != resource_size_ || total_bound_size_ != resource_size_) {
+            return false;
+        }
+        for (const auto &[memory, bound] : bound_sizes_) {
+            if (memory->Invalid()) {
+                return false;
             }
         }
-
-        if (current_offset != resource_size_) return false;
     }
 
     return true;
 }
 
+void vvl::BindableSparseMemoryTracker::UpdateBoundSize(StateObject *parent, const std::shared_ptr<vvl::DeviceMemory> &memory,
+                                                        const BindingMap::key_type &range, bool bound) {
+    if (!memory) {
+        return;
+    }
+    const VkDeviceSize size = range.distance();
+    const VkDeviceSize resource_size = (range & BindingMap::key_type(0, resource_size_)).distance();
+    if (bound) {
+        auto &memory_bound = bound_sizes_[memory.get()];
+        if (memory_bound.second == 0) {
+            memory_bound.first = memory;
+            memory->AddParent(parent);
+        }
+        memory_bound.second += size;
+        total_bound_size_ += size;
+        resource_bound_size_ += resource_size;
+    } else {
+        auto it = bound_sizes_.find(memory.get());
+        ASSERT_AND_RETURN(it != bound_sizes_.end() && it->second.second >= size);
+        it->second.second -= size;
+        total_bound_size_ -= size;
+        resource_bound_size_ -= resource_size;
+        if (it->second.second == 0) {
+            memory->RemoveParent(parent);
+            bound_sizes_.erase(it);
+        }
+    }
+}
+
+void vvl::BindableSparseMemoryTracker::OverwriteBindings(StateObject *parent, const Bindings &bindings) {
+    // The bound sizes are added first, so that a memory that stays bound is not removed and added again as a parent
+    for (const auto &[range, binding] : bindings) {
+        UpdateBoundSize(parent, binding.memory_state, range, true);
+    }
+    binding_map_.overwrite_ranges(bindings.begin(), bindings.end(),
+                                  [this, parent](const BindingMap::value_type &entry, const BindingMap::key_type &overwritten) {
+                                      UpdateBoundSize(parent, entry.second.memory_state, overwritten, false);
+                                  });
+}
+
 void vvl::BindableSparseMemoryTracker::BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &memory_state,
                                                   VkDeviceSize memory_offset, VkDeviceSize resource_offset, VkDeviceSize size) {
-    MemoryBinding memory_data{memory_state, memory_offset, resource_offset};
-    BindingMap::value_type item{{resource_offset, resource_offset + size}, memory_data};
+    if (size == 0) {
+        return;
+    }
+    const Bindings bindings{{{resource_offset, resource_offset + size}, {memory_state, memory_offset, resource_offset}}};
 
     auto guard = WriteLockGuard{binding_lock_};
+    OverwriteBindings(parent, bindings);
+}
 
-    // Since we don't know which ranges will be removed, we need to unbind everything and rebind later
-    for (auto &value_pair : binding_map_) {
-        if (value_pair.second.memory_state) value_pair.second.memory_state->RemoveParent(parent);
+void vvl::BindableSparseMemoryTracker::BindSparseMemory(StateObject *parent, std::vector<SparseMemoryBind> &binds) {
+    const auto by_offset = [](const SparseMemoryBind &a, const SparseMemoryBind &b) {
+        return a.resource_range.begin < b.resource_range.begin;
+    };
+    // Streamers bind disjoint pages, often already sorted
+    std::vector<SparseMemoryBind> sorted_binds;
+    const std::vector<SparseMemoryBind> *ordered_binds = &binds;
+    if (!std::is_sorted(binds.begin(), binds.end(), by_offset)) {
+        sorted_binds = binds;
+        std::sort(sorted_binds.begin(), sorted_binds.end(), by_offset);
+        ordered_binds = &sorted_binds;
+    }
+    for (size_t i = 1; i < ordered_binds->size(); ++i) {
+        if ((*ordered_binds)[i - 1].resource_range.end > (*ordered_binds)[i].resource_range.begin) {
+            // Binds that overlap each other have to be applied in order
+            BindableMemoryTracker::BindSparseMemory(parent, binds);
+            return;
+        }
     }
-    binding_map_.overwrite_range(item);
 
-    for (auto &value_pair : binding_map_) {
-        if (value_pair.second.memory_state) value_pair.second.memory_state->AddParent(parent);
+    Bindings bindings;
+    bindings.reserve(ordered_binds->size());
+    for (const SparseMemoryBind &bind : *ordered_binds) {
+        if (!bind.resource_range.non_empty()) {
+            continue;
+        }
+        if (!bindings.empty()) {
+            auto &[last_range, last_binding] = bindings.back();
+            // Null memory (unbinding) has no offset to follow
+            const bool follows_in_memory =
+                !bind.binding.memory_state ||
+                last_binding.memory_offset + last_range.distance() == bind.binding.memory_offset;
+            if (last_range.end == bind.resource_range.begin && last_binding.memory_state == bind.binding.memory_state &&
+                follows_in_memory) {
+                last_range.end = bind.resource_range.end;
+                continue;
+            }
+        }
+        bindings.emplace_back(bind.resource_range, bind.binding);
     }
+
+    auto guard = WriteLockGuard{binding_lock_};
+    OverwriteBindings(parent, bindings);
 }
 
 BoundMemoryRange vvl::BindableSparseMemoryTracker::GetBoundMemoryRange(const MemoryRange &range) const {
@@ -273,8 +388,8 @@ DeviceMemoryState vvl::BindableSparseMemoryTracker::GetBoundMemoryStates() const
 
     {
         auto guard = ReadLockGuard{binding_lock_};
-        for (auto &binding : binding_map_) {
-            if (binding.second.memory_state) dev_memory_states.emplace(binding.second.memory_state);
+        for (const auto &[memory, bound] : bound_sizes_) {
+            dev_memory_states.emplace(bound.first);
         }
     }
 
@@ -316,9 +431,18 @@ void vvl::BindableMultiplanarMemoryTracker::BindMemory(StateObject *parent, std:
 
     assert(resource_offset < planes_.size());
     memory_state->AddParent(parent);
+    memory_state->AddBoundResource(*parent, memory_offset, size);
     planes_[static_cast<size_t>(resource_offset)].binding = {memory_state, memory_offset, 0u};
 }
 
+void vvl::BindableMultiplanarMemoryTracker::RemoveBoundResource(const StateObject &parent) {
+    for (const auto &plane : planes_) {
+        if (plane.binding.memory_state) {
+            plane.binding.memory_state->RemoveBoundResource(parent, plane.binding.memory_offset);
+        }
+    }
+}
+
 // range needs to be between [0, planes_[0].size + planes_[1].size + planes_[2].size)
 // To access plane 0 range must be [0, planes_[0].size)
 // To access plane 1 range must be [planes_[0].size, planes_[1].size)
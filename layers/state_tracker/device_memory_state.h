@@ -88,6 +88,25 @@ class DeviceMemory : public StateObject {
     bool IsDedicatedImage() const { return GetDedicatedImage() != VK_NULL_HANDLE; }
 
     VkDeviceMemory VkHandle() const { return handle_.Cast<VkDeviceMemory>(); }
+
+    // Index of the non-sparse resources bound to this memory, by the range of the allocation they occupy.
+    // Looking for the resources overlapping a range (ex: an aliasing image) only visits the resources starting near it,
+    // instead of every object bound to the allocation.
+    void AddBoundResource(StateObject &resource, VkDeviceSize offset, VkDeviceSize size);
+    void RemoveBoundResource(const StateObject &resource, VkDeviceSize offset);
+    NodeList GetBoundResources(VkDeviceSize offset, VkDeviceSize size) const;
+
+  private:
+    struct BoundResource {
+        VulkanTypedHandle handle;
+        std::weak_ptr<StateObject> node;
+        VkDeviceSize end;
+    };
+    // Keyed by the offset the resource starts at
+    std::multimap<VkDeviceSize, BoundResource> bound_resources_;
+    // Largest bound size, limits how far before a range an overlapping resource can start
+    VkDeviceSize max_bound_size_ = 0;
+    mutable std::shared_mutex bound_resources_lock_;
 };
 
 // Generic memory binding struct to track objects bound to objects
@@ -102,6 +121,12 @@ struct MemoryBinding {
     VkDeviceSize resource_offset;
 };
 
+// One VkSparseMemoryBind, in resource space
+struct SparseMemoryBind {
+    vvl::range<VkDeviceSize> resource_range;
+    MemoryBinding binding;
+};
+
 class BindableMemoryTracker {
   public:
     using BufferRange = vvl::range<VkDeviceSize>;
@@ -117,6 +142,15 @@ class BindableMemoryTracker {
     virtual bool HasFullRangeBound() const = 0;
 
     virtual void BindMemory(StateObject *, std::shared_ptr<vvl::DeviceMemory> &, VkDeviceSize, VkDeviceSize, VkDeviceSize) = 0;
+    // All the binds of a VkSparse*MemoryBindInfo, in order
+    virtual void BindSparseMemory(StateObject *parent, std::vector<SparseMemoryBind> &binds) {
+        for (SparseMemoryBind &bind : binds) {
+            BindMemory(parent, bind.binding.memory_state, bind.binding.memory_offset, bind.resource_range.begin,
+                       bind.resource_range.distance());
+        }
+    }
+    // Removes the resource from the bound resource index of its memory, the bindings themselves are kept
+    virtual void RemoveBoundResource(const StateObject &) = 0;
 
     virtual BoundMemoryRange GetBoundMemoryRange(const MemoryRange &) const = 0;
     virtual BoundRanges GetBoundRanges(const BufferRange &ranges_bounds, const std::vector<BufferRange> &ranges) const = 0;
@@ -135,6 +169,7 @@ class BindableNoMemoryTracker : public BindableMemoryTracker {
     bool HasFullRangeBound() const override { return true; }
 
     void BindMemory(StateObject *, std::shared_ptr<vvl::DeviceMemory> &, VkDeviceSize, VkDeviceSize, VkDeviceSize) override {}
+    void RemoveBoundResource(const StateObject &) override {}
 
     BoundMemoryRange GetBoundMemoryRange(const MemoryRange &) const override { return BoundMemoryRange{}; }
     BoundRanges GetBoundRanges(const BufferRange &ranges_bounds, const std::vector<BufferRange> &ranges) const override {
@@ -157,6 +192,7 @@ class BindableLinearMemoryTracker : public BindableMemoryTracker {
 
     void BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &memory_state, VkDeviceSize memory_offset,
                     VkDeviceSize resource_offset, VkDeviceSize size) override;
+    void RemoveBoundResource(const StateObject &parent) override;
 
     BoundMemoryRange GetBoundMemoryRange(const MemoryRange &range) const override;
     // No need to have this overload for linear memory
@@ -182,6 +218,11 @@ class BindableSparseMemoryTracker : public BindableMemoryTracker {
 
     void BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &memory_state, VkDeviceSize memory_offset,
                     VkDeviceSize resource_offset, VkDeviceSize size) override;
+    // Binds that follow each other in both the resource and the same memory are merged, and when the binds do not overlap
+    // they are applied in a single pass over the binding map
+    void BindSparseMemory(StateObject *parent, std::vector<SparseMemoryBind> &binds) override;
+    // Sparse bindings change too often to be indexed
+    void RemoveBoundResource(const StateObject &) override {}
 
     BoundMemoryRange GetBoundMemoryRange(const MemoryRange &range) const override;
     // With a list of (VALID) buffer ranges as input, and `ranges_bounds` being a range that contains all of those buffer ranges,
@@ -197,7 +238,21 @@ class BindableSparseMemoryTracker : public BindableMemoryTracker {
   private:
     // This range map uses the range in resource space to know the size of the bound memory
     using BindingMap = sparse_container::range_map<VkDeviceSize, MemoryBinding>;
+
+    using Bindings = std::vector<std::pair<BindingMap::key_type, MemoryBinding>>;
+
+    // With binding_lock_ held for writing. |bindings| are sorted and do not overlap
+    void OverwriteBindings(StateObject *parent, const Bindings &bindings);
+    void UpdateBoundSize(StateObject *parent, const std::shared_ptr<vvl::DeviceMemory> &memory, const BindingMap::key_type &range,
+                         bool bound);
+
     BindingMap binding_map_;
+    // Bytes of the resource bound to each memory, the resource is a parent of the memories in here. Validation asks about the
+    // memories of a resource much more often than about its bindings, and there are usually a lot less memories than bindings.
+    vvl::unordered_map<const vvl::DeviceMemory *, std::pair<std::shared_ptr<vvl::DeviceMemory>, VkDeviceSize>> bound_sizes_;
+    // Bytes bound to a memory, in total and within [0, resource_size_)
+    VkDeviceSize total_bound_size_ = 0;
+    VkDeviceSize resource_bound_size_ = 0;
     mutable std::shared_mutex binding_lock_;
     VkDeviceSize resource_size_;
     bool is_resident_;
@@ -216,6 +271,7 @@ class BindableMultiplanarMemoryTracker : public BindableMemoryTracker {
 
     void BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &memory_state, VkDeviceSize memory_offset,
                     VkDeviceSize resource_offset, VkDeviceSize size) override;
+    void RemoveBoundResource(const StateObject &parent) override;
 
     BoundMemoryRange GetBoundMemoryRange(const MemoryRange &range) const override;
     // No reason to have this function for multi planar memory
@@ -252,6 +308,7 @@ class Bindable : public StateObject {
     }
 
     void Destroy() override {
+        memory_tracker_->RemoveBoundResource(*this);
         for (auto &state : memory_tracker_->GetBoundMemoryStates()) {
             state->RemoveParent(this);
         }
@@ -302,6 +359,9 @@ class Bindable : public StateObject {
                     const VkDeviceSize resource_offset, const VkDeviceSize mem_size) {
         memory_tracker_->BindMemory(parent, mem, memory_offset, resource_offset, mem_size);
     }
+    void BindSparseMemory(StateObject *parent, std::vector<SparseMemoryBind> &binds) {
+        memory_tracker_->BindSparseMemory(parent, binds);
+    }
 
     bool HasFullRangeBound() const { return memory_tracker_->HasFullRangeBound(); }
 
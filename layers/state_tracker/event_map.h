@@ -21,11 +21,51 @@
 
 #include "vulkan/vulkan.h"
 #include "containers/custom_containers.h"
+#include "state_tracker/cmd_buffer_state.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
+#include <limits>
+#include <vector>
 
 struct EventInfo {
     VkPipelineStageFlags2 src_stage_mask = VK_PIPELINE_STAGE_2_NONE;
     bool signal = false;  // signal (SetEvent) or unsignal (ResetEvent)
     vku::safe_VkDependencyInfo dependency_info = {};
 };
-using EventMap = vvl::unordered_map<VkEvent, EventInfo>;
+
+// Last set or reset of the events of a queue submission. Found with vvl::Event::dense_index instead of hashing the handles, as
+// pipelines synchronizing with events can set and wait on thousands of them per submission.
+class EventMap {
+  public:
+    struct Entry {
+        vvl::Event *event;
+        EventInfo info;
+    };
+
+    void Set(vvl::Event &event, EventInfo &&info) {
+        if (event.dense_index >= entry_indices_.size()) {
+            entry_indices_.resize(event.dense_index + 1, kNoEntry);
+        }
+        uint32_t &entry_index = entry_indices_[event.dense_index];
+        if (entry_index == kNoEntry) {
+            entry_index = static_cast<uint32_t>(entries_.size());
+            entries_.push_back({&event, std::move(info)});
+        } else {
+            entries_[entry_index].info = std::move(info);
+        }
+    }
+
+    const EventInfo *Find(const vvl::Event &event) const {
+        if (event.dense_index >= entry_indices_.size() || entry_indices_[event.dense_index] == kNoEntry) {
+            return nullptr;
+        }
+        return &entries_[entry_indices_[event.dense_index]].info;
+    }
+
+    // In the order the events were first set or reset
+    const std::vector<Entry> &Entries() const { return entries_; }
+
+  private:
+    static constexpr uint32_t kNoEntry = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> entry_indices_;
+    std::vector<Entry> entries_;
+};
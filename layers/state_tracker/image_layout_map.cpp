@@ -74,18 +74,36 @@ static bool UpdateLayoutMapRange(LayoutsMap& layout_map, const IndexRange& range
     return updated_current;
 }
 
-template <typename LayoutMap>
-static bool UpdateLayoutMap(LayoutMap& image_layout_map, RangeGenerator&& range_gen, const ImageLayoutState& entry) {
+// Most transitions cover the whole image (the range generator merges a full subresource range into a single range), or a
+// range that was already transitioned as a whole before. Then the map is empty, or has an entry with exactly that range,
+// and is updated without the search and split of UpdateLayoutMapRange. Returns false if the range needs the general path.
+template <typename LayoutsMap>
+static bool UpdateLayoutMapWholeEntry(LayoutsMap& layout_map, const IndexRange& range, const ImageLayoutState& new_entry,
+                                      bool& updated_current) {
+    if (layout_map.empty()) {
+        layout_map.insert(std::make_pair(range, new_entry));
+        updated_current = true;
+        return true;
+    }
+    auto it = layout_map.find(range);
+    if (it == layout_map.end()) {
+        return false;
+    }
+    ImageLayoutState& entry = it->second;
+    assert(entry.first_layout != kInvalidLayout);
+    if (new_entry.current_layout != kInvalidLayout &&
+        !ImageLayoutMatches(entry.aspect_mask, new_entry.current_layout, entry.current_layout)) {
+        entry.current_layout = new_entry.current_layout;
+        updated_current = true;
+    }
+    return true;
+}
+
+template <typename LayoutsMap>
+static bool UpdateLayoutMapRanges(LayoutsMap& layout_map, RangeGenerator& range_gen, const ImageLayoutState& entry) {
     bool updated = false;
-    // Unwrap the BothMaps entry here as this is a performance hotspot
-    if (image_layout_map.UsesSmallMap()) {
-        auto& layout_map = image_layout_map.GetSmallMap();
-        for (; range_gen->non_empty(); ++range_gen) {
-            updated |= UpdateLayoutMapRange(layout_map, *range_gen, entry);
-        }
-    } else {
-        auto& layout_map = image_layout_map.GetBigMap();
-        for (; range_gen->non_empty(); ++range_gen) {
+    for (; range_gen->non_empty(); ++range_gen) {
+        if (!UpdateLayoutMapWholeEntry(layout_map, *range_gen, entry, updated)) {
             updated |= UpdateLayoutMapRange(layout_map, *range_gen, entry);
         }
     }
@@ -93,11 +111,19 @@ static bool UpdateLayoutMap(LayoutMap& image_layout_map, RangeGenerator&& range_
 }
 
 template <typename LayoutMap>
-static bool IterateLayoutMapRanges(
-    const LayoutMap& image_layout_map, RangeGenerator&& gen,
-    std::function<bool(const IndexRange& range, const typename LayoutMap::mapped_type& layout_state)>&& func) {
+static bool UpdateLayoutMap(LayoutMap& image_layout_map, RangeGenerator&& range_gen, const ImageLayoutState& entry) {
+    // Unwrap the BothMaps entry here as this is a performance hotspot
+    if (image_layout_map.UsesSmallMap()) {
+        return UpdateLayoutMapRanges(image_layout_map.GetSmallMap(), range_gen, entry);
+    } else {
+        return UpdateLayoutMapRanges(image_layout_map.GetBigMap(), range_gen, entry);
+    }
+}
+
+template <typename LayoutsMap, typename Func>
+static bool IterateRanges(const LayoutsMap& layout_map, RangeGenerator& gen, Func& func) {
     for (; gen->non_empty(); ++gen) {
-        for (auto pos = image_layout_map.lower_bound(*gen); pos != image_layout_map.end() && gen->intersects(pos->first); ++pos) {
+        for (auto pos = layout_map.lower_bound(*gen); pos != layout_map.end() && gen->intersects(pos->first); ++pos) {
             // TODO: Usually func returns skip status. Often we accumulate skip and do not initiate immediate return.
             // Investigate if this function should accumuate skip value instead of immediate return.
             if (func(pos->first, pos->second)) {
@@ -108,6 +134,18 @@ static bool IterateLayoutMapRanges(
     return false;
 }
 
+template <typename LayoutMap>
+static bool IterateLayoutMapRanges(
+    const LayoutMap& image_layout_map, RangeGenerator&& gen,
+    std::function<bool(const IndexRange& range, const typename LayoutMap::mapped_type& layout_state)>&& func) {
+    // Same unwrapping as UpdateLayoutMap, the BothMaps iterators check which map they are on at every step
+    if (image_layout_map.UsesSmallMap()) {
+        return IterateRanges(image_layout_map.GetSmallMap(), gen, func);
+    } else {
+        return IterateRanges(image_layout_map.GetBigMap(), gen, func);
+    }
+}
+
 bool UpdateCurrentLayout(CommandBufferImageLayoutMap& image_layout_map, RangeGenerator&& range_gen, VkImageLayout layout,
                          VkImageLayout expected_layout, VkImageAspectFlags aspect_mask) {
     assert(layout != kInvalidLayout);
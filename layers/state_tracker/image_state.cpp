@@ -95,6 +95,19 @@ static std::vector<VkSparseImageMemoryRequirements> GetSparseRequirements(const
     return result;
 }
 
+static std::unique_ptr<const vvl::Image::VideoProfiles> MakeSupportedVideoProfiles(const vvl::DeviceState &dev_data,
+                                                                                   const VkImageCreateInfo *create_info) {
+    const auto *profile_list = vku::FindStructInPNextChain<VkVideoProfileListInfoKHR>(create_info->pNext);
+    if (!profile_list) {
+        return nullptr;
+    }
+    auto profiles = dev_data.video_profile_cache_.Get(dev_data.physical_device, profile_list);
+    if (profiles.empty()) {
+        return nullptr;
+    }
+    return std::make_unique<const vvl::Image::VideoProfiles>(std::move(profiles));
+}
+
 #ifdef VK_USE_PLATFORM_METAL_EXT
 static bool GetMetalExport(const VkImageCreateInfo *info, VkExportMetalObjectTypeFlagBitsEXT object_type_required) {
     bool retval = false;
@@ -135,12 +148,12 @@ Image::Image(const vvl::DeviceState &dev_data, VkImage img, const VkImageCreateI
 #endif  // VK_USE_PLATFORM_METAL_EXT
       subresource_encoder(GetSubresourceEncoderRange(dev_data, full_range)),
       store_device_as_workaround(dev_data.device),  // TODO REMOVE WHEN encoder can be const
-      supported_video_profiles(dev_data.video_profile_cache_.Get(
-          dev_data.physical_device, vku::FindStructInPNextChain<VkVideoProfileListInfoKHR>(pCreateInfo->pNext))) {
+      supported_video_profiles_(MakeSupportedVideoProfiles(dev_data, pCreateInfo)) {
     if (pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT) {
         bool is_resident = (pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT) != 0;
-        tracker_.emplace<BindableSparseMemoryTracker>(requirements.data(), is_resident);
-        SetMemoryTracker(&std::get<BindableSparseMemoryTracker>(tracker_));
+        auto &sparse_tracker = tracker_.emplace<std::unique_ptr<BindableSparseMemoryTracker>>(
+            std::make_unique<BindableSparseMemoryTracker>(requirements.data(), is_resident));
+        SetMemoryTracker(sparse_tracker.get());
     } else if (pCreateInfo->flags & VK_IMAGE_CREATE_DISJOINT_BIT) {
         tracker_.emplace<BindableMultiplanarMemoryTracker>(requirements.data(), vkuFormatPlaneCount(pCreateInfo->format));
         SetMemoryTracker(&std::get<BindableMultiplanarMemoryTracker>(tracker_));
@@ -174,13 +187,17 @@ Image::Image(const vvl::DeviceState &dev_data, VkImage img, const VkImageCreateI
 #endif  // VK_USE_PLATFORM_METAL_EXT
       subresource_encoder(GetSubresourceEncoderRange(dev_data, full_range)),
       store_device_as_workaround(dev_data.device),  // TODO REMOVE WHEN encoder can be const
-      supported_video_profiles(dev_data.video_profile_cache_.Get(
-          dev_data.physical_device, vku::FindStructInPNextChain<VkVideoProfileListInfoKHR>(pCreateInfo->pNext))) {
+      supported_video_profiles_(MakeSupportedVideoProfiles(dev_data, pCreateInfo)) {
 
     tracker_.emplace<BindableNoMemoryTracker>(requirements.data());
     SetMemoryTracker(&std::get<BindableNoMemoryTracker>(tracker_));
 }
 
+const Image::VideoProfiles &Image::GetSupportedVideoProfiles() const {
+    static const VideoProfiles kNoVideoProfiles;
+    return supported_video_profiles_ ? *supported_video_profiles_ : kNoVideoProfiles;
+}
+
 void Image::Destroy() {
     for (auto &item : sub_states_) {
         item.second->Destroy();
@@ -516,6 +533,12 @@ static VkImageUsageFlags GetInheritedUsage(const VkImageViewCreateInfo *ci, cons
     return (usage_create_info) ? usage_create_info->usage : image_state.create_info.usage;
 }
 
+// A view of some of the slices of a 3D image has the same normalized range as the image
+static bool IsWholeImage(bool is_depth_sliced, const VkImageSubresourceRange &range, const VkImageSubresourceRange &full_range) {
+    return !is_depth_sliced && range.aspectMask == full_range.aspectMask && range.baseMipLevel == 0 &&
+           range.levelCount == full_range.levelCount && range.baseArrayLayer == 0 && range.layerCount == full_range.layerCount;
+}
+
 static float GetImageViewMinLod(const VkImageViewCreateInfo *ci) {
     auto image_view_min_lod = vku::FindStructInPNextChain<VkImageViewMinLodCreateInfoEXT>(ci->pNext);
     return (image_view_min_lod) ? image_view_min_lod->minLod : 0.0f;
@@ -550,6 +573,7 @@ ImageView::ImageView(const DeviceState &device_state, const std::shared_ptr<vvl:
 #endif
       is_depth_sliced(IsDepthSliced()),
       normalized_subresource_range(image_state->NormalizeSubresourceRange(create_info.subresourceRange)),
+      is_whole_image(IsWholeImage(is_depth_sliced, normalized_subresource_range, image_state->full_range)),
       range_generator(image_state->subresource_encoder,
                       NormalizeImageLayoutSubresourceRange(device_state.extensions.vk_khr_maintenance9)),
       samples(image_state->create_info.samples),
@@ -620,6 +644,9 @@ bool ImageView::OverlapSubresource(const ImageView &compare_view) const {
     if (normalized_subresource_range.aspectMask != compare_view.normalized_subresource_range.aspectMask) {
         return false;
     }
+    if (is_whole_image || compare_view.is_whole_image) {
+        return true;
+    }
 
     // compare if overlap mip level
     if ((normalized_subresource_range.baseMipLevel < compare_view.normalized_subresource_range.baseMipLevel) &&
@@ -112,7 +112,9 @@ class Image : public Bindable, public SubStateManager<ImageSubState> {
     ReadLockGuard LayoutMapReadLock() const { return ReadLockGuard(*layout_map_lock); }
     WriteLockGuard LayoutMapWriteLock() { return WriteLockGuard(*layout_map_lock); }
 
-    vvl::unordered_set<std::shared_ptr<const vvl::VideoProfileDesc>> supported_video_profiles;
+    using VideoProfiles = vvl::unordered_set<std::shared_ptr<const vvl::VideoProfileDesc>>;
+    // Empty unless the image was created with a VkVideoProfileListInfoKHR
+    const VideoProfiles &GetSupportedVideoProfiles() const;
 
     Image(const DeviceState &dev_data, VkImage handle, const VkImageCreateInfo *pCreateInfo, VkFormatFeatureFlags2KHR features);
     Image(const DeviceState &dev_data, VkImage handle, const VkImageCreateInfo *pCreateInfo, VkSwapchainKHR swapchain,
@@ -221,12 +223,17 @@ class Image : public Bindable, public SubStateManager<ImageSubState> {
 
     template <typename UnaryPredicate>
     bool AnyImageAliasOf(const UnaryPredicate &pred) const {
-        // Look for another aliasing image and
-        // ObjectBindings() is thread safe since returns by value, and once
-        // the weak_ptr is successfully locked, the other image state won't
-        // be freed out from under us.
-        for (auto const &memory_state : GetBoundMemoryStates()) {
-            if (AnyAliasBindingOf(memory_state->ObjectBindings(), pred)) return true;
+        // A compatible alias is bound at the same offset of the same memory, so only the resources overlapping
+        // that offset are looked at. GetBoundResources() returns locked references, the other image state
+        // won't be freed out from under us.
+        const MemoryBinding *binding = Binding();
+        if (!binding) return false;
+        for (const auto &node : binding->memory_state->GetBoundResources(binding->memory_offset, 1)) {
+            if (node->Type() != kVulkanObjectTypeImage) continue;
+            auto other_image = static_cast<Image *>(node.get());
+            if ((other_image != this) && other_image->IsCompatibleAliasing(this)) {
+                if (pred(*other_image)) return true;
+            }
         }
         return false;
     }
@@ -245,9 +252,13 @@ class Image : public Bindable, public SubStateManager<ImageSubState> {
     // layouts map can address each slice.
     VkImageSubresourceRange GetSubresourceEncoderRange(const DeviceState &device_state, const VkImageSubresourceRange &full_range);
 
-    std::variant<std::monostate, BindableNoMemoryTracker, BindableLinearMemoryTracker, BindableSparseMemoryTracker,
-                 BindableMultiplanarMemoryTracker>
+    // The sparse tracker is several times larger than the others, only sparse images pay for it
+    std::variant<std::monostate, BindableNoMemoryTracker, BindableLinearMemoryTracker,
+                 std::unique_ptr<BindableSparseMemoryTracker>, BindableMultiplanarMemoryTracker>
         tracker_;
+
+    // Null for the (many) images that are not used for video
+    const std::unique_ptr<const VideoProfiles> supported_video_profiles_;
 };
 
 class ImageSubState {
@@ -278,6 +289,7 @@ class ImageView : public StateObject, public SubStateManager<ImageViewSubState>
 
     const bool is_depth_sliced;
     const VkImageSubresourceRange normalized_subresource_range;
+    const bool is_whole_image;  // normalized_subresource_range is the full_range of the image
     const subresource_adapter::RangeGenerator range_generator;
     const VkSampleCountFlagBits samples;
     const VkSamplerYcbcrConversion samplerConversion;  // Handle of the ycbcr sampler conversion the image was created with, if any
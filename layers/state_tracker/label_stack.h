@@ -0,0 +1,80 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "containers/small_vector.h"
+
+namespace vvl {
+
+// Debug label stack of a queue, captured for each submitted command buffer so the errors found once it completes can name
+// their debug region.
+//
+// The stack is a persistent list: push_back() adds a node on top of the ones shared with the copies and pop_back() only moves
+// to the node below, nodes are never modified. Capturing the stack is a reference count increment instead of copying every label.
+class LabelStack {
+  public:
+    bool empty() const { return top_ == nullptr; }
+    uint32_t size() const { return top_ ? top_->depth : 0; }
+
+    // Innermost label
+    const std::string &back() const {
+        assert(top_);
+        return top_->label;
+    }
+
+    void push_back(std::string label) { top_ = std::make_shared<const Node>(std::move(label), top_); }
+
+    void pop_back() {
+        assert(top_);
+        top_ = top_->below;
+    }
+
+    // Labels from the outermost to the innermost, separated with "::"
+    std::string GetRegionName() const {
+        small_vector<const std::string *, 8> labels;
+        for (const Node *node = top_.get(); node; node = node->below.get()) {
+            labels.emplace_back(&node->label);
+        }
+        std::string region_name;
+        for (uint32_t i = labels.size(); i > 0; --i) {
+            if (!region_name.empty()) {
+                region_name += "::";
+            }
+            region_name += *labels[i - 1];
+        }
+        return region_name;
+    }
+
+  private:
+    struct Node {
+        Node(std::string &&label, const std::shared_ptr<const Node> &below)
+            : label(std::move(label)), below(below), depth(below ? below->depth + 1 : 1) {}
+
+        const std::string label;
+        const std::shared_ptr<const Node> below;
+        const uint32_t depth;
+    };
+
+    std::shared_ptr<const Node> top_;
+};
+
+}  // namespace vvl
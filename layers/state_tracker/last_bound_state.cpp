@@ -808,6 +808,19 @@ VkShaderStageFlags LastBound::GetAllActiveBoundStages() const {
     return stages;
 }
 
+DescriptorSetValidationKey LastBound::GetValidationKey(const vvl::DescriptorSet &descriptor_set,
+                                                      const BindingVariableMap &binding_req_map,
+                                                      bool disabled_image_layout_validation) const {
+    DescriptorSetValidationKey key;
+    key.set = &descriptor_set;
+    key.set_change_count = descriptor_set.GetChangeCount();
+    key.binding_req_map = &binding_req_map;
+    key.pipeline = pipeline_state;
+    key.image_layout_change_count = disabled_image_layout_validation ? 0 : cb_state.image_layout_change_count;
+    key.attachments_change_count = cb_state.attachments_change_count;
+    return key;
+}
+
 bool LastBound::IsBoundSetCompatible(uint32_t set, const vvl::PipelineLayout &pipeline_layout) const {
     if ((set >= ds_slots.size()) || (set >= pipeline_layout.set_compat_ids.size())) {
         return false;
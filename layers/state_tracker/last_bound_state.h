@@ -19,6 +19,7 @@
 #pragma once
 
 #include "state_tracker/pipeline_layout_state.h"
+#include "state_tracker/shader_stage_state.h"
 #include "utils/vk_api_utils.h"
 #include "utils/shader_utils.h"
 #include "generated/dynamic_state_helper.h"
@@ -38,6 +39,34 @@ namespace spirv {
 struct EntryPoint;
 }  // namespace spirv
 
+// Everything the draw time validation of a bound descriptor set depends on, the set is not validated again until one changes
+struct DescriptorSetValidationKey {
+    const vvl::DescriptorSet *set{nullptr};
+    uint64_t set_change_count{~0ULL};
+    // The requirements on the set of the pipeline (or shader object) used
+    const BindingVariableMap *binding_req_map{nullptr};
+    const vvl::Pipeline *pipeline{nullptr};
+    // 0 if image layout validation is disabled
+    uint64_t image_layout_change_count{~0ULL};
+    uint64_t attachments_change_count{~0ULL};
+
+    bool operator==(const DescriptorSetValidationKey &other) const {
+        return set == other.set && set_change_count == other.set_change_count && binding_req_map == other.binding_req_map &&
+               pipeline == other.pipeline && image_layout_change_count == other.image_layout_change_count &&
+               attachments_change_count == other.attachments_change_count;
+    }
+    bool operator!=(const DescriptorSetValidationKey &other) const { return !(*this == other); }
+
+    struct Hash {
+        size_t operator()(const DescriptorSetValidationKey &key) const {
+            hash_util::HashCombiner hc;
+            hc << key.set << key.set_change_count << key.binding_req_map << key.pipeline << key.image_layout_change_count
+               << key.attachments_change_count;
+            return hc.Value();
+        }
+    };
+};
+
 // Track last states that are bound per pipeline bind point (Gfx & Compute)
 struct LastBound {
     LastBound(vvl::CommandBuffer &cb, const VkPipelineBindPoint bind_point) : cb_state(cb), bind_point(bind_point) {}
@@ -70,9 +99,7 @@ struct LastBound {
         PipelineLayoutCompatId compat_id_for_set{0};
 
         // Cache most recently validated descriptor state for ValidateActionState/UpdateImageLayoutDrawState
-        const vvl::DescriptorSet *validated_set{nullptr};
-        uint64_t validated_set_change_count{~0ULL};
-        uint64_t validated_set_image_layout_change_count{~0ULL};
+        DescriptorSetValidationKey validated;
 
         void Reset() {
             ds_state.reset();
@@ -143,6 +170,9 @@ struct LastBound {
     std::vector<vvl::ShaderObject *> GetAllBoundGraphicsShaders();
     bool IsAnyGraphicsShaderBound() const;
     VkShaderStageFlags GetAllActiveBoundStages() const;
+    // For the set bound to a slot, with the |binding_req_map| of the pipeline or shader object statically using it
+    DescriptorSetValidationKey GetValidationKey(const vvl::DescriptorSet &descriptor_set, const BindingVariableMap &binding_req_map,
+                                                bool disabled_image_layout_validation) const;
     bool IsBoundSetCompatible(uint32_t set, const vvl::PipelineLayout &pipeline_layout) const;
     bool IsBoundSetCompatible(uint32_t set, const vvl::ShaderObject &shader_object_state) const;
     std::string DescribeNonCompatibleSet(uint32_t set, const vvl::PipelineLayout &pipeline_layout) const;
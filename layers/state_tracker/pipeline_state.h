@@ -229,6 +229,18 @@ class Pipeline : public StateObject {
     // TODO - This could probably just be a check to VkGraphicsPipelineLibraryCreateInfoEXT::flags
     bool OwnsSubState(const std::shared_ptr<PipelineSubState> sub_state) const { return sub_state && (&sub_state->parent == this); }
 
+    // True when both sub-states were linked from the same library, so the checks between them already ran when it was created
+    bool LinkedFromSameLibrary(const PipelineSubState *a, const PipelineSubState *b) const {
+        return a && b && (&a->parent != this) && (&a->parent == &b->parent);
+    }
+    // The sub-state holding the shader of |stage|
+    const PipelineSubState *ShaderStageSubState(VkShaderStageFlagBits stage) const {
+        if (stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
+            return fragment_shader_state.get();
+        }
+        return pre_raster_state.get();
+    }
+
     // This grabs the render pass at pipeline creation time, if you are inside a command buffer, use the vvl::RenderPass inside the
     // command buffer! (The render pass can be different as they just have to be compatible, see
     // vkspec.html#renderpass-compatibility)
@@ -18,6 +18,8 @@
 #include "state_tracker/pipeline_sub_state.h"
 #include "state_tracker/pipeline_state.h"
 #include "state_tracker/shader_module.h"
+#include "utils/hash_vk_types.h"
+#include "utils/vk_struct_compare.h"
 
 bool PipelineSubState::IsIndependentSets() const {
     if (const auto layout_state = parent.PipelineLayoutState()) {
@@ -99,7 +101,7 @@ PreRasterState::PreRasterState(const vvl::Pipeline &p, const vvl::DeviceState &s
                 // don't need to worry about GroupDecoration in GPL
                 spirv::StatelessData *stateless_data_stage =
                     (stateless_data && i < kCommonMaxGraphicsShaderStages) ? &stateless_data[i] : nullptr;
-                auto spirv_module = std::make_shared<spirv::Module>(shader_ci->codeSize, shader_ci->pCode, stateless_data_stage);
+                auto spirv_module = state_data.CreateSpirvModule(shader_ci->codeSize, shader_ci->pCode, stateless_data_stage);
                 module_state = std::make_shared<vvl::ShaderModule>(VK_NULL_HANDLE, spirv_module);
                 if (stateless_data_stage) {
                     stateless_data_stage->pipeline_pnext_module = spirv_module;
@@ -163,32 +165,70 @@ PreRasterState::PreRasterState(const vvl::Pipeline &p, const vvl::DeviceState &s
     }
 }
 
-std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
+namespace {
+struct ColorBlendStateEqual {
+    bool operator()(const vku::safe_VkPipelineColorBlendStateCreateInfo &a,
+                    const vku::safe_VkPipelineColorBlendStateCreateInfo &b) const {
+        return ComparePipelineColorBlendStateCreateInfo(*a.ptr(), *b.ptr());
+    }
+};
+struct MultisampleStateEqual {
+    bool operator()(const vku::safe_VkPipelineMultisampleStateCreateInfo &a,
+                    const vku::safe_VkPipelineMultisampleStateCreateInfo &b) const {
+        // Exact without a pNext chain
+        return !a.pNext && !b.pNext && ComparePipelineMultisampleStateCreateInfo(*a.ptr(), *b.ptr());
+    }
+};
+struct DepthStencilStateEqual {
+    bool operator()(const vku::safe_VkPipelineDepthStencilStateCreateInfo &a,
+                    const vku::safe_VkPipelineDepthStencilStateCreateInfo &b) const {
+        return ComparePipelineDepthStencilStateCreateInfo(*a.ptr(), *b.ptr());
+    }
+};
+
+hash_util::Dictionary<vku::safe_VkPipelineColorBlendStateCreateInfo, std::hash<vku::safe_VkPipelineColorBlendStateCreateInfo>,
+                      ColorBlendStateEqual>
+    color_blend_state_dict;
+hash_util::Dictionary<vku::safe_VkPipelineMultisampleStateCreateInfo, std::hash<vku::safe_VkPipelineMultisampleStateCreateInfo>,
+                      MultisampleStateEqual>
+    multisample_state_dict;
+hash_util::Dictionary<vku::safe_VkPipelineDepthStencilStateCreateInfo,
+                      std::hash<vku::safe_VkPipelineDepthStencilStateCreateInfo>, DepthStencilStateEqual>
+    depth_stencil_state_dict;
+
+// The structs with a pNext chain get their own copy, chains are not compared
+template <typename SafeStruct, typename Dict>
+std::shared_ptr<const SafeStruct> LookUpSubState(Dict &dict, SafeStruct &&state) {
+    if (state.pNext) {
+        return std::make_shared<const SafeStruct>(std::move(state));
+    }
+    return dict.LookUp(std::move(state));
+}
+}  // namespace
+
+std::shared_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
     const vku::safe_VkPipelineColorBlendStateCreateInfo &cbs) {
-    // This is needlessly copied here. Might better to make this a plain pointer, with an optional "backing unique_ptr"
-    return std::make_unique<const vku::safe_VkPipelineColorBlendStateCreateInfo>(cbs);
+    return LookUpSubState(color_blend_state_dict, vku::safe_VkPipelineColorBlendStateCreateInfo(cbs));
 }
-std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
+std::shared_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
     const VkPipelineColorBlendStateCreateInfo &cbs) {
-    return std::make_unique<const vku::safe_VkPipelineColorBlendStateCreateInfo>(&cbs);
+    return LookUpSubState(color_blend_state_dict, vku::safe_VkPipelineColorBlendStateCreateInfo(&cbs));
 }
-std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
+std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
     const vku::safe_VkPipelineMultisampleStateCreateInfo &cbs) {
-    // This is needlessly copied here. Might better to make this a plain pointer, with an optional "backing unique_ptr"
-    return std::make_unique<const vku::safe_VkPipelineMultisampleStateCreateInfo>(cbs);
+    return LookUpSubState(multisample_state_dict, vku::safe_VkPipelineMultisampleStateCreateInfo(cbs));
 }
-std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
+std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
     const VkPipelineMultisampleStateCreateInfo &cbs) {
-    return std::make_unique<const vku::safe_VkPipelineMultisampleStateCreateInfo>(&cbs);
+    return LookUpSubState(multisample_state_dict, vku::safe_VkPipelineMultisampleStateCreateInfo(&cbs));
 }
-std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
+std::shared_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
     const vku::safe_VkPipelineDepthStencilStateCreateInfo &cbs) {
-    // This is needlessly copied here. Might better to make this a plain pointer, with an optional "backing unique_ptr"
-    return std::make_unique<const vku::safe_VkPipelineDepthStencilStateCreateInfo>(cbs);
+    return LookUpSubState(depth_stencil_state_dict, vku::safe_VkPipelineDepthStencilStateCreateInfo(cbs));
 }
-std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
+std::shared_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
     const VkPipelineDepthStencilStateCreateInfo &cbs) {
-    return std::make_unique<const vku::safe_VkPipelineDepthStencilStateCreateInfo>(&cbs);
+    return LookUpSubState(depth_stencil_state_dict, vku::safe_VkPipelineDepthStencilStateCreateInfo(&cbs));
 }
 std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> ToShaderStageCI(
     const vku::safe_VkPipelineShaderStageCreateInfo &cbs) {
@@ -218,8 +258,7 @@ void SetFragmentShaderInfoPrivate(const vvl::Pipeline &pipeline_state, FragmentS
                     // don't need to worry about GroupDecoration in GPL
                     spirv::StatelessData *stateless_data_stage =
                         (stateless_data && i < kCommonMaxGraphicsShaderStages) ? &stateless_data[i] : nullptr;
-                    auto spirv_module =
-                        std::make_shared<spirv::Module>(shader_ci->codeSize, shader_ci->pCode, stateless_data_stage);
+                    auto spirv_module = state_data.CreateSpirvModule(shader_ci->codeSize, shader_ci->pCode, stateless_data_stage);
                     module_state = std::make_shared<vvl::ShaderModule>(VK_NULL_HANDLE, spirv_module);
                     if (stateless_data_stage) {
                         stateless_data_stage->pipeline_pnext_module = spirv_module;
@@ -22,6 +22,8 @@
 #include "state_tracker/cmd_buffer_state.h"
 #include "state_tracker/render_pass_state.h"
 
+#include <algorithm>
+
 namespace vvl {
 
 QueryPool::QueryPool(VkQueryPool handle, const VkQueryPoolCreateInfo *pCreateInfo, uint32_t index_count,
@@ -52,6 +54,29 @@ QueryPool::QueryPool(VkQueryPool handle, const VkQueryPoolCreateInfo *pCreateInf
 
 void QueryPool::SetQueryState(uint32_t query, uint32_t perf_pass, QueryState state) {
     auto guard = WriteLock();
+    SetQueryStateLocked(query, perf_pass, state);
+}
+
+void QueryPool::SetQueryStates(uint32_t first, uint32_t count, uint32_t perf_pass, QueryState state) {
+    auto guard = WriteLock();
+    assert(first <= query_states_.size() && count <= query_states_.size() - first);
+    for (uint32_t query = first; query < first + count; ++query) {
+        SetQueryStateLocked(query, perf_pass, state);
+    }
+}
+
+void QueryPool::SetQueryStates(uint32_t perf_pass, const std::vector<QueryState> &states) {
+    auto guard = WriteLock();
+    assert(states.size() <= query_states_.size());
+    const uint32_t count = static_cast<uint32_t>(std::min(states.size(), query_states_.size()));
+    for (uint32_t query = 0; query < count; ++query) {
+        if (states[query] != QUERYSTATE_UNKNOWN) {
+            SetQueryStateLocked(query, perf_pass, states[query]);
+        }
+    }
+}
+
+void QueryPool::SetQueryStateLocked(uint32_t query, uint32_t perf_pass, QueryState state) {
     assert(query < query_states_.size());
     assert((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes));
     if (state == QUERYSTATE_RESET) {
@@ -100,6 +125,31 @@ QueryResultType QueryPool::GetQueryResultType(QueryState state, VkQueryResultFla
 
 }  // namespace vvl
 
+QueryState QueryMap::Get(VkQueryPool pool, uint32_t slot, uint32_t perf_pass) const {
+    auto it = states_.find(pool);
+    if (it == states_.end() || perf_pass >= it->second.size()) {
+        return QUERYSTATE_UNKNOWN;
+    }
+    const std::vector<QueryState> &states = it->second[perf_pass];
+    return slot < states.size() ? states[slot] : QUERYSTATE_UNKNOWN;
+}
+
+void QueryMap::SetRange(VkQueryPool pool, uint32_t first, uint32_t count, uint32_t perf_pass, QueryState state) {
+    if (count == 0) {
+        return;
+    }
+    auto &passes = states_[pool];
+    if (passes.size() <= perf_pass) {
+        passes.resize(perf_pass + 1);
+    }
+    std::vector<QueryState> &states = passes[perf_pass];
+    const size_t end = size_t(first) + count;
+    if (states.size() < end) {
+        states.resize(end, QUERYSTATE_UNKNOWN);
+    }
+    std::fill(states.begin() + first, states.begin() + end, state);
+}
+
 QueryCount::QueryCount(vvl::CommandBuffer &cb_state) {
     count = 1;
     subpass = 0;
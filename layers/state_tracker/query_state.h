@@ -52,6 +52,10 @@ class QueryPool : public StateObject {
     VkQueryPool VkHandle() const { return handle_.Cast<VkQueryPool>(); }
 
     void SetQueryState(uint32_t query, uint32_t perf_pass, QueryState state);
+    // Sets the state of the queries [first, first + count) under a single lock
+    void SetQueryStates(uint32_t first, uint32_t count, uint32_t perf_pass, QueryState state);
+    // Sets the state of each query which state in |states|, indexed by query, is not QUERYSTATE_UNKNOWN
+    void SetQueryStates(uint32_t perf_pass, const std::vector<QueryState> &states);
     QueryState GetQueryState(uint32_t query, uint32_t perf_pass) const;
     QueryResultType GetQueryResultType(QueryState state, VkQueryResultFlags flags);
 
@@ -70,6 +74,8 @@ class QueryPool : public StateObject {
   private:
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
+    // lock_ must be held for writing
+    void SetQueryStateLocked(uint32_t query, uint32_t perf_pass, QueryState state);
 
     std::vector<small_vector<QueryState, 1, uint32_t>> query_states_;
     mutable std::shared_mutex lock_;
@@ -125,7 +131,34 @@ inline bool operator==(const QueryObject &query1, const QueryObject &query2) {
     return ((query1.pool == query2.pool) && (query1.slot == query2.slot) && (query1.perf_pass == query2.perf_pass));
 }
 
-using QueryMap = vvl::unordered_map<QueryObject, QueryState>;
+// Query states set by a sequence of commands. The states are kept per query pool and performance pass in arrays indexed
+// by query, so that the commands working on many consecutive queries (ex: resetting a 4096 entries timestamp pool) do not
+// hash each query. QUERYSTATE_UNKNOWN is the state of the queries that were not set.
+class QueryMap {
+  public:
+    QueryState Get(VkQueryPool pool, uint32_t slot, uint32_t perf_pass) const;
+    QueryState Get(const QueryObject &query_obj) const { return Get(query_obj.pool, query_obj.slot, query_obj.perf_pass); }
+
+    void Set(const QueryObject &query_obj, QueryState state) {
+        SetRange(query_obj.pool, query_obj.slot, 1, query_obj.perf_pass, state);
+    }
+    void SetRange(VkQueryPool pool, uint32_t first, uint32_t count, uint32_t perf_pass, QueryState state);
+
+    // Calls func(pool, perf_pass, states) for each pool and performance pass that had a state set, |states| is indexed by query
+    template <typename Func>
+    void ForEachPool(Func &&func) const {
+        for (const auto &[pool, passes] : states_) {
+            for (uint32_t perf_pass = 0; perf_pass < passes.size(); ++perf_pass) {
+                if (!passes[perf_pass].empty()) {
+                    func(pool, perf_pass, passes[perf_pass]);
+                }
+            }
+        }
+    }
+
+  private:
+    vvl::unordered_map<VkQueryPool, small_vector<std::vector<QueryState>, 1, uint32_t>> states_;
+};
 
 struct QueryCount {
     uint32_t count;
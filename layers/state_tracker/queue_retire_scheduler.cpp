@@ -0,0 +1,96 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "state_tracker/queue_retire_scheduler.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "state_tracker/queue_state.h"
+#include "utils/thread_utils.h"
+
+namespace vvl {
+
+QueueRetireScheduler::QueueRetireScheduler(uint32_t max_threads, uint64_t cpu_affinity_mask)
+    : max_threads_(max_threads), cpu_affinity_mask_(cpu_affinity_mask) {}
+
+QueueRetireScheduler::~QueueRetireScheduler() {
+    std::vector<std::thread> workers;
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        // Every queue was destroyed before, and a queue is only destroyed once no worker is running it
+        assert(ready_queues_.empty());
+        exit_ = true;
+        workers = std::move(workers_);
+    }
+    cond_.notify_all();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+void QueueRetireScheduler::AddQueue() {
+    std::unique_lock<std::mutex> guard(lock_);
+    ++queue_count_;
+}
+
+void QueueRetireScheduler::RemoveQueue() {
+    std::unique_lock<std::mutex> guard(lock_);
+    assert(queue_count_ > 0);
+    --queue_count_;
+}
+
+void QueueRetireScheduler::Schedule(Queue &queue) {
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        ready_queues_.emplace_back(&queue);
+        // A busy worker can be blocked for a long time on a semaphore wait, the queue can not wait for it
+        const uint32_t thread_limit = max_threads_ ? std::min(max_threads_, queue_count_) : queue_count_;
+        if (idle_workers_ < ready_queues_.size() && workers_.size() < std::max(thread_limit, 1u)) {
+            workers_.emplace_back(&QueueRetireScheduler::WorkerFunc, this);
+            // Counted as idle until it picks up a queue, so that the next Schedule() does not start another one for nothing
+            ++idle_workers_;
+        }
+    }
+    cond_.notify_one();
+}
+
+uint32_t QueueRetireScheduler::WorkerCount() const {
+    std::unique_lock<std::mutex> guard(lock_);
+    return static_cast<uint32_t>(workers_.size());
+}
+
+void QueueRetireScheduler::WorkerFunc() {
+    ConfigureCurrentThread("QueueRetireWorker", cpu_affinity_mask_);
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        cond_.wait(guard, [this]() { return exit_ || !ready_queues_.empty(); });
+        if (exit_) {
+            break;
+        }
+        Queue *queue = ready_queues_.front();
+        ready_queues_.pop_front();
+        --idle_workers_;
+        guard.unlock();
+
+        queue->RetireReadySubmissions();
+
+        guard.lock();
+        ++idle_workers_;
+    }
+}
+
+}  // namespace vvl
@@ -0,0 +1,68 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vvl {
+
+class Queue;
+
+// Retires the submissions of all the queues of a device on a shared pool of worker threads, instead of one thread per queue.
+//
+// A queue is scheduled when it has submissions that Notify() allowed to retire. A worker then retires all of them in order,
+// so the submissions of a queue are still retired one at a time and in submission order, and a queue is never run by two
+// workers at once. Retiring can block: a wait on a semaphore signaled by another queue (or by the host) waits for that
+// signal to be retired. So when a queue is scheduled and every worker is busy, a new worker is started, up to the number of
+// queues (or |max_threads|), and the pool never has fewer unblocked workers than the threads it replaces.
+class QueueRetireScheduler {
+  public:
+    // |max_threads| of 0 means one per queue at most. |cpu_affinity_mask| of 0 uses the one of the ThreadSettings
+    QueueRetireScheduler(uint32_t max_threads, uint64_t cpu_affinity_mask);
+    ~QueueRetireScheduler();
+    QueueRetireScheduler(const QueueRetireScheduler &) = delete;
+    QueueRetireScheduler &operator=(const QueueRetireScheduler &) = delete;
+
+    void AddQueue();
+    void RemoveQueue();
+
+    // Called by the queue, with its lock held, the first time it has submissions to retire since it was last run
+    void Schedule(Queue &queue);
+
+    uint32_t WorkerCount() const;
+
+  private:
+    void WorkerFunc();
+
+    const uint32_t max_threads_;
+    const uint64_t cpu_affinity_mask_;
+
+    mutable std::mutex lock_;
+    std::condition_variable cond_;
+    std::deque<Queue *> ready_queues_;
+    std::vector<std::thread> workers_;
+    uint32_t idle_workers_ = 0;
+    uint32_t queue_count_ = 0;
+    bool exit_ = false;
+};
+
+}  // namespace vvl
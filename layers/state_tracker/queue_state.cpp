@@ -56,7 +56,47 @@ void vvl::QueueSubmission::EndUse() {
     }
 }
 
-vvl::PreSubmitResult vvl::Queue::PreSubmit(std::vector<vvl::QueueSubmission> &&submissions) {
+vvl::Queue::Queue(DeviceState &dev_data, VkQueue handle, uint32_t family_index, uint32_t queue_index, VkDeviceQueueCreateFlags flags,
+                  const VkQueueFamilyProperties &queueFamilyProperties)
+    : StateObject(handle, kVulkanObjectTypeQueue),
+      queue_family_index(family_index),
+      queue_index(queue_index),
+      create_flags(flags),
+      queue_family_properties(queueFamilyProperties),
+      dev_data_(dev_data),
+      retire_scheduler_(dev_data.retire_scheduler) {
+    retire_scheduler_.AddQueue();
+}
+
+vvl::QueueSubmission vvl::Queue::NewSubmission(const Location &loc) {
+    QueueSubmission submission(loc);
+    auto guard = Lock();
+    if (!recycled_submissions_.empty()) {
+        RecycledSubmission &recycled = recycled_submissions_.back();
+        submission.cb_submissions = std::move(recycled.cb_submissions);
+        submission.wait_semaphores = std::move(recycled.wait_semaphores);
+        submission.signal_semaphores = std::move(recycled.signal_semaphores);
+        recycled_submissions_.pop_back();
+    }
+    return submission;
+}
+
+void vvl::Queue::RecycleSubmission(QueueSubmission &submission) {
+    if (recycled_submissions_.size() >= kMaxRecycledSubmissions ||
+        submission.cb_submissions.capacity() > kMaxRecycledCapacity ||
+        submission.wait_semaphores.capacity() > kMaxRecycledCapacity ||
+        submission.signal_semaphores.capacity() > kMaxRecycledCapacity) {
+        return;
+    }
+    submission.cb_submissions.clear();
+    submission.wait_semaphores.clear();
+    submission.signal_semaphores.clear();
+    recycled_submissions_.emplace_back(RecycledSubmission{std::move(submission.cb_submissions),
+                                                          std::move(submission.wait_semaphores),
+                                                          std::move(submission.signal_semaphores)});
+}
+
+vvl::PreSubmitResult vvl::Queue::PreSubmit(vvl::span<vvl::QueueSubmission> submissions) {
     if (!submissions.empty()) {
         submissions.back().is_last_submission = true;
     }
@@ -97,9 +137,7 @@ vvl::PreSubmitResult vvl::Queue::PreSubmit(std::vector<vvl::QueueSubmission> &&s
         {
             auto guard = Lock();
             submissions_.emplace_back(std::move(submission));
-            if (!thread_) {
-                thread_ = std::make_unique<std::thread>(&Queue::ThreadFunc, this);
-            }
+            ScheduleIfReady();
         }
     }
     return result;
@@ -113,7 +151,14 @@ void vvl::Queue::Notify(uint64_t until_seq) {
     if (request_seq_ < until_seq) {
         request_seq_ = until_seq;
     }
-    cond_.notify_one();
+    ScheduleIfReady();
+}
+
+void vvl::Queue::ScheduleIfReady() {
+    if (!scheduled_ && !exit_thread_ && !submissions_.empty() && submissions_.front().seq <= request_seq_) {
+        scheduled_ = true;
+        retire_scheduler_.Schedule(*this);
+    }
 }
 
 void vvl::Queue::Wait(const Location &loc, uint64_t until_seq) {
@@ -240,16 +285,14 @@ void vvl::Queue::UpdatePresentOnlyQueueProgress(const DeviceState &device_state)
 }
 
 void vvl::Queue::Destroy() {
-    std::unique_ptr<std::thread> dead_thread;
     {
         auto guard = Lock();
-        exit_thread_ = true;
-        cond_.notify_all();
-        dead_thread = std::move(thread_);
-    }
-    if (dead_thread && dead_thread->joinable()) {
-        dead_thread->join();
-        dead_thread.reset();
+        if (!exit_thread_) {
+            exit_thread_ = true;
+            // A scheduler worker can still hold a pointer to the queue until it sees exit_thread_
+            cond_.wait(guard, [this]() { return !scheduled_; });
+            retire_scheduler_.RemoveQueue();
+        }
     }
     for (auto &item : sub_states_) {
         item.second->Destroy();
@@ -277,23 +320,6 @@ void vvl::Queue::PostSubmit(QueueSubmission &submission) {
     }
 }
 
-vvl::QueueSubmission *vvl::Queue::NextSubmission() {
-    QueueSubmission *result = nullptr;
-    // Find if the next submission is ready so that the thread function doesn't need to worry
-    // about locking.
-    auto guard = Lock();
-    while (!exit_thread_ && (submissions_.empty() || request_seq_ < submissions_.front().seq)) {
-        // The queue thread must wait forever if nothing is happening, until we tell it to exit
-        cond_.wait(guard);
-    }
-    if (!exit_thread_) {
-        result = &submissions_.front();
-        // NOTE: the submission must remain on the dequeue until we're done processing it so that
-        // anyone waiting for it can find the correct waiter
-    }
-    return result;
-}
-
 void vvl::Queue::Retire(QueueSubmission &submission) {
     submission.EndUse();
     for (auto &wait : submission.wait_semaphores) {
@@ -311,16 +337,20 @@ void vvl::Queue::Retire(QueueSubmission &submission) {
     }
 }
 
-void vvl::Queue::ThreadFunc() {
-    VVL_TracySetThreadName(__FUNCTION__);
-
-    QueueSubmission *submission = nullptr;
-
+void vvl::Queue::RetireReadySubmissions() {
     // Roll this queue forward, one submission at a time.
     while (true) {
-        submission = NextSubmission();
-        if (submission == nullptr) {
-            break;
+        QueueSubmission *submission = nullptr;
+        {
+            auto guard = Lock();
+            if (exit_thread_ || submissions_.empty() || request_seq_ < submissions_.front().seq) {
+                scheduled_ = false;
+                cond_.notify_all();
+                return;
+            }
+            // NOTE: the submission must remain on the dequeue until we're done processing it so that
+            // anyone waiting for it can find the correct waiter
+            submission = &submissions_.front();
         }
         Retire(*submission);
         // wake up anyone waiting for this submission to be retired
@@ -329,6 +359,7 @@ void vvl::Queue::ThreadFunc() {
             {
                 auto guard = Lock();
                 completed = std::move(submission->completed);
+                RecycleSubmission(*submission);
                 submissions_.pop_front();
             }
             completed.set_value();
@@ -20,10 +20,12 @@
 #include "state_tracker/state_object.h"
 #include "state_tracker/fence_state.h"
 #include "state_tracker/semaphore_state.h"
+#include "state_tracker/queue_retire_scheduler.h"
+#include "state_tracker/label_stack.h"
+#include "containers/span.h"
 #include <condition_variable>
 #include <deque>
 #include <future>
-#include <thread>
 #include <vector>
 #include <string>
 #include "error_message/error_location.h"
@@ -49,9 +51,9 @@ struct CommandBufferSubmission {
     // When GPU-AV starts doing error reporting, when command buffers have completed,
     // the label stack info stored in Queue state is lost.
     // => GPU-AV needs to track this initial label stack per command buffer submission.
-    std::vector<std::string> initial_label_stack;
+    LabelStack initial_label_stack;
 
-    CommandBufferSubmission(std::shared_ptr<vvl::CommandBuffer> cb, std::vector<std::string> initial_label_stack)
+    CommandBufferSubmission(std::shared_ptr<vvl::CommandBuffer> cb, LabelStack initial_label_stack)
         : cb(std::move(cb)), initial_label_stack(std::move(initial_label_stack)) {}
     CommandBufferSubmission(CommandBufferSubmission &&other)
         : cb(std::move(other.cb)), initial_label_stack(std::move(other.initial_label_stack)) {}
@@ -79,7 +81,7 @@ struct QueueSubmission {
     std::promise<void> completed;
     std::shared_future<void> waiter;
 
-    void AddCommandBuffer(std::shared_ptr<vvl::CommandBuffer> cb_state, std::vector<std::string> initial_label_stack) {
+    void AddCommandBuffer(std::shared_ptr<vvl::CommandBuffer> cb_state, LabelStack initial_label_stack) {
         cb_submissions.emplace_back(std::move(cb_state), std::move(initial_label_stack));
     }
 
@@ -137,29 +139,26 @@ struct PreSubmitResult {
 class Queue : public StateObject, public SubStateManager<QueueSubState> {
   public:
     Queue(DeviceState &dev_data, VkQueue handle, uint32_t family_index, uint32_t queue_index, VkDeviceQueueCreateFlags flags,
-          const VkQueueFamilyProperties &queueFamilyProperties)
-        : StateObject(handle, kVulkanObjectTypeQueue),
-          queue_family_index(family_index),
-          queue_index(queue_index),
-          create_flags(flags),
-          queue_family_properties(queueFamilyProperties),
-          dev_data_(dev_data) {}
+          const VkQueueFamilyProperties &queueFamilyProperties);
 
     ~Queue() { Destroy(); }
     void Destroy() override;
 
     VkQueue VkHandle() const { return handle_.Cast<VkQueue>(); }
 
-    // called from the various PreCallRecordQueueSubmit() methods
-    PreSubmitResult PreSubmit(std::vector<QueueSubmission> &&submissions);
+    // Reuses the vectors of a retired submission when there is one, so that a steady submission rate does not allocate them
+    QueueSubmission NewSubmission(const Location &loc);
+
+    // called from the various PreCallRecordQueueSubmit() methods, the submissions are moved into the queue
+    PreSubmitResult PreSubmit(vvl::span<QueueSubmission> submissions);
     // called from the various PostCallRecordQueueSubmit() methods
     void PostSubmit();
 
-    // Tell the queue thread that submissions up to and including the submission with
+    // Tell the retire scheduler that submissions up to and including the submission with
     // sequence number until_seq have finished. kU64Max means to finish all submissions.
     void Notify(uint64_t until_seq = kU64Max);
 
-    // Wait for the queue thread to finish processing submissions with sequence numbers
+    // Wait for the retire scheduler to finish processing submissions with sequence numbers
     // up to and including until_seq. kU64Max means to finish all submissions.
     void Wait(const Location &loc, uint64_t until_seq = kU64Max);
 
@@ -184,7 +183,7 @@ class Queue : public StateObject, public SubStateManager<QueueSubState> {
 
     // Track command buffer label stack accross all command buffers submitted to this queue.
     // Access to this variable relies on external queue synchronization.
-    std::vector<std::string> cmdbuf_label_stack;
+    LabelStack cmdbuf_label_stack;
 
     // Track the last closed label. It is used in the error messages to help locate unbalanced vkCmdEndDebugUtilsLabelEXT command.
     // Access to this variable relies on external queue synchronization.
@@ -207,26 +206,43 @@ class Queue : public StateObject, public SubStateManager<QueueSubState> {
     // called from the various PostCallRecordQueueSubmit() methods
     void PostSubmit(QueueSubmission &submission);
 
-    // called when the worker thread decides a submissions has finished executing
+    // called when the retire scheduler decides a submissions has finished executing
     void Retire(QueueSubmission &submission);
 
   private:
+    friend class QueueRetireScheduler;
+
     uint32_t timeline_wait_count_ = 0;
 
-    void ThreadFunc();
-    QueueSubmission *NextSubmission();
+    // Must be called with lock_ held, hands the queue to the retire scheduler if a submission can be retired
+    void ScheduleIfReady();
+    // Called by a retire scheduler worker, retires submissions in order until the next one has not been notified yet
+    void RetireReadySubmissions();
+    // Must be called with lock_ held, keeps the cleared vectors of a retired submission for NewSubmission()
+    void RecycleSubmission(QueueSubmission &submission);
 
     DeviceState &dev_data_;
+    QueueRetireScheduler &retire_scheduler_;
 
     // state related to submitting to the queue, all data members must
     // be accessed with lock_ held
-    std::unique_ptr<std::thread> thread_;
     std::deque<QueueSubmission> submissions_;
+    struct RecycledSubmission {
+        std::vector<CommandBufferSubmission> cb_submissions;
+        std::vector<SemaphoreInfo> wait_semaphores;
+        std::vector<SemaphoreInfo> signal_semaphores;
+    };
+    // Enough for the submissions in flight of a frame, the vectors grown by unusually large submissions are not kept
+    static constexpr size_t kMaxRecycledSubmissions = 16;
+    static constexpr size_t kMaxRecycledCapacity = 64;
+    std::vector<RecycledSubmission> recycled_submissions_;
     std::atomic<uint64_t> seq_{0};
     uint64_t request_seq_{0};
     bool exit_thread_{false};
+    // The queue is waiting for a scheduler worker, or being retired by one
+    bool scheduled_{false};
     mutable std::mutex lock_;
-    // condition to wake up the queue's thread
+    // Signaled when a scheduler worker is done with the queue, for Destroy()
     std::condition_variable cond_;
 };
 
@@ -239,7 +255,7 @@ class QueueSubState {
     virtual ~QueueSubState() {}
     virtual void Destroy() {}
 
-    virtual void PreSubmit(std::vector<QueueSubmission> &submissions) {}
+    virtual void PreSubmit(vvl::span<QueueSubmission> submissions) {}
     virtual void PostSubmit(std::deque<QueueSubmission> &submissions_) {}
     virtual void Retire(QueueSubmission &submission) {}
 
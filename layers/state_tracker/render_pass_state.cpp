@@ -280,12 +280,99 @@ static void InitRenderPassState(vvl::RenderPass &render_pass) {
 
 namespace vvl {
 
+// Dictionary of canonical form of the render pass compatibility records
+static RenderPassCompatDict render_pass_compat_dict;
+
+// Follows the comparisons done in CoreChecks::ValidateRenderPassCompatibility. Attachment references are replaced with the
+// format/samples/flags of the attachment, and arrays are trimmed of trailing VK_ATTACHMENT_UNUSED because a shorter array is
+// treated as padded with them.
+static RenderPassCompatId GetCanonicalCompatId(const VkRenderPassCreateInfo2 &create_info) {
+    RenderPassCompatDef def;
+
+    const auto add_attachment = [&def, &create_info](uint32_t attachment) {
+        if (attachment >= create_info.attachmentCount) {
+            def.emplace_back(VK_ATTACHMENT_UNUSED);
+            return;
+        }
+        const VkAttachmentDescription2 &description = create_info.pAttachments[attachment];
+        def.emplace_back(static_cast<uint32_t>(description.format));
+        def.emplace_back(static_cast<uint32_t>(description.samples));
+        def.emplace_back(description.flags);
+    };
+    const auto add_attachment_array = [&add_attachment, &def, &create_info](uint32_t count, const VkAttachmentReference2 *refs) {
+        uint32_t used_count = refs ? count : 0;
+        while (used_count > 0 && refs[used_count - 1].attachment >= create_info.attachmentCount) {
+            --used_count;
+        }
+        def.emplace_back(used_count);
+        for (uint32_t i = 0; i < used_count; ++i) {
+            add_attachment(refs[i].attachment);
+        }
+    };
+    const auto add_flags64 = [&def](uint64_t flags) {
+        def.emplace_back(static_cast<uint32_t>(flags));
+        def.emplace_back(static_cast<uint32_t>(flags >> 32));
+    };
+
+    def.emplace_back(create_info.flags);
+
+    def.emplace_back(create_info.subpassCount);
+    for (uint32_t subpass = 0; subpass < create_info.subpassCount; ++subpass) {
+        const VkSubpassDescription2 &description = create_info.pSubpasses[subpass];
+        add_attachment_array(description.inputAttachmentCount, description.pInputAttachments);
+        add_attachment_array(description.colorAttachmentCount, description.pColorAttachments);
+        if (create_info.subpassCount > 1) {
+            add_attachment_array(description.colorAttachmentCount, description.pResolveAttachments);
+        }
+        add_attachment(description.pDepthStencilAttachment ? description.pDepthStencilAttachment->attachment
+                                                           : VK_ATTACHMENT_UNUSED);
+        def.emplace_back(description.flags);
+        def.emplace_back(description.viewMask);
+
+        const auto fsr = vku::FindStructInPNextChain<VkFragmentShadingRateAttachmentInfoKHR>(description.pNext);
+        def.emplace_back(fsr ? 1u : 0u);
+        if (fsr) {
+            def.emplace_back(fsr->shadingRateAttachmentTexelSize.width);
+            def.emplace_back(fsr->shadingRateAttachmentTexelSize.height);
+        }
+    }
+
+    // The VkMemoryBarrier2 is looked up the same way the compatibility check does
+    const auto barrier = vku::FindStructInPNextChain<VkMemoryBarrier2>(create_info.pNext);
+    def.emplace_back(create_info.dependencyCount);
+    for (uint32_t i = 0; i < create_info.dependencyCount; ++i) {
+        const VkSubpassDependency2 &dependency = create_info.pDependencies[i];
+        def.emplace_back(dependency.srcSubpass);
+        def.emplace_back(dependency.dstSubpass);
+        add_flags64(barrier ? barrier->srcStageMask : dependency.srcStageMask);
+        add_flags64(barrier ? barrier->dstStageMask : dependency.dstStageMask);
+        add_flags64(barrier ? barrier->srcAccessMask : dependency.srcAccessMask);
+        add_flags64(barrier ? barrier->dstAccessMask : dependency.dstAccessMask);
+        def.emplace_back(dependency.dependencyFlags);
+        def.emplace_back(static_cast<uint32_t>(dependency.viewOffset));
+    }
+
+    def.emplace_back(create_info.correlatedViewMaskCount);
+    for (uint32_t i = 0; i < create_info.correlatedViewMaskCount; ++i) {
+        def.emplace_back(create_info.pCorrelatedViewMasks[i]);
+    }
+
+    const auto fdm = vku::FindStructInPNextChain<VkRenderPassFragmentDensityMapCreateInfoEXT>(create_info.pNext);
+    def.emplace_back(fdm ? 1u : 0u);
+    if (fdm) {
+        add_attachment(fdm->fragmentDensityMapAttachment.attachment);
+    }
+
+    return render_pass_compat_dict.LookUp(std::move(def));
+}
+
 RenderPass::RenderPass(VkRenderPass handle, VkRenderPassCreateInfo2 const *pCreateInfo)
     : StateObject(handle, kVulkanObjectTypeRenderPass),
       create_info(pCreateInfo),
       use_dynamic_rendering(false),
       use_dynamic_rendering_inherited(false),
-      has_multiview_enabled(IsRenderPassMultiViewEnabled(*create_info.ptr())) {
+      has_multiview_enabled(IsRenderPassMultiViewEnabled(*create_info.ptr())),
+      compat_id(GetCanonicalCompatId(*create_info.ptr())) {
     InitRenderPassState(*this);
 }
 
@@ -299,7 +386,8 @@ RenderPass::RenderPass(VkRenderPass handle, VkRenderPassCreateInfo const *pCreat
       create_info(ConvertCreateInfo(*pCreateInfo)),
       use_dynamic_rendering(false),
       use_dynamic_rendering_inherited(false),
-      has_multiview_enabled(IsRenderPassMultiViewEnabled(*create_info.ptr())) {
+      has_multiview_enabled(IsRenderPassMultiViewEnabled(*create_info.ptr())),
+      compat_id(GetCanonicalCompatId(*create_info.ptr())) {
     InitRenderPassState(*this);
 }
 
@@ -21,6 +21,7 @@
 #include "state_tracker/state_object.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
 #include <map>
+#include "utils/hash_util.h"
 
 namespace vvl {
 class ImageView;
@@ -60,6 +61,11 @@ struct SubpassLayout {
     VkImageLayout layout;
 };
 
+// Canonical form of everything ValidateRenderPassCompatibility compares, render passes with the same Id are compatible
+using RenderPassCompatDef = std::vector<uint32_t>;
+using RenderPassCompatDict = hash_util::Dictionary<RenderPassCompatDef, hash_util::IsOrderedContainer<RenderPassCompatDef>>;
+using RenderPassCompatId = RenderPassCompatDict::Id;
+
 namespace vvl {
 
 // Vulkan 1.0 has a VkRenderPass object, things like dynamic rendering moved the handle to be across various other structs/calls.
@@ -80,6 +86,8 @@ class RenderPass : public StateObject {
     const bool use_dynamic_rendering_inherited;
     const bool has_multiview_enabled;
     const bool rasterization_enabled{true};
+    // Only set for vkCreateRenderPass/vkCreateRenderPass2 render passes
+    const RenderPassCompatId compat_id;
     const vku::safe_VkRenderingInfo dynamic_rendering_begin_rendering_info;
     const vku::safe_VkPipelineRenderingCreateInfo dynamic_pipeline_rendering_create_info;
     const vku::safe_VkCommandBufferInheritanceRenderingInfo inheritance_rendering_info;
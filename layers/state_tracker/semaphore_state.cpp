@@ -50,6 +50,7 @@ vvl::Semaphore::Semaphore(DeviceState &dev, VkSemaphore handle, const VkSemaphor
 #endif  // VK_USE_PLATFORM_METAL_EXT
       completed_{type == VK_SEMAPHORE_TYPE_TIMELINE ? kSignal : kNone, SubmissionReference{},
                  type_create_info ? type_create_info->initialValue : 0},
+      completed_payload_(completed_.payload),
       next_payload_(completed_.payload + 1),
       dev_data_(dev) {
 }
@@ -116,7 +117,7 @@ void vvl::Semaphore::EnqueueWait(const SubmissionReference &wait_submit, uint64_
         if (timeline_.empty()) {
             if (scope_ != vvl::Semaphore::kInternal) {
                 // for external semaphore mark wait as completed, no guarantee of signal visibility
-                completed_ = SemOp(kWait, wait_submit, 0);
+                SetCompleted(SemOp(kWait, wait_submit, 0));
                 return;
             } else {
                 // generate binary payload value from the last completed signals
@@ -224,11 +225,6 @@ std::optional<vvl::SemaphoreInfo> vvl::Semaphore::GetPendingBinarySignalTimeline
     return signal_submit->queue->FindTimelineWaitWithoutResolvingSignal(signal_submit->seq);
 }
 
-uint64_t vvl::Semaphore::CurrentPayload() const {
-    auto guard = ReadLock();
-    return completed_.payload;
-}
-
 bool vvl::Semaphore::CanBinaryBeSignaled() const {
     assert(type == VK_SEMAPHORE_TYPE_BINARY);
     auto guard = ReadLock();
@@ -285,6 +281,9 @@ void vvl::Semaphore::GetLastBinarySignalSource(VkQueue &queue, vvl::Func &acquir
 
 bool vvl::Semaphore::HasResolvingTimelineSignal(uint64_t wait_payload) const {
     assert(type == VK_SEMAPHORE_TYPE_TIMELINE);
+    if (IsTimelinePayloadCompleted(wait_payload)) {
+        return true;
+    }
     auto guard = ReadLock();
 
     // For external semaphore we can't track the signal.
@@ -371,6 +370,9 @@ void vvl::Semaphore::RetireWait(vvl::Queue *current_queue, uint64_t payload, con
     std::shared_future<void> waiter;
     bool retire_external_payload = false;
     uint64_t external_payload = 0;
+    if (IsTimelinePayloadCompleted(payload)) {
+        return;
+    }
     {
         auto guard = WriteLock();
         if (payload <= completed_.payload) {
@@ -437,6 +439,9 @@ void vvl::Semaphore::RetireWait(vvl::Queue *current_queue, uint64_t payload, con
 }
 
 void vvl::Semaphore::RetireSignal(uint64_t payload) {
+    if (IsTimelinePayloadCompleted(payload)) {
+        return;
+    }
     auto guard = WriteLock();
     if (payload <= completed_.payload) {
         return;
@@ -468,7 +473,12 @@ void vvl::Semaphore::RetireTimePoint(uint64_t payload, OpType completed_op, Subm
         ++it;
     }
     timeline_.erase(timeline_.begin(), it);
-    completed_ = SemOp(completed_op, completed_submit, payload);
+    SetCompleted(SemOp(completed_op, completed_submit, payload));
+}
+
+void vvl::Semaphore::SetCompleted(const SemOp &completed) {
+    completed_ = completed;
+    completed_payload_.store(completed.payload, std::memory_order_release);
 }
 
 void vvl::Semaphore::WaitTimePoint(std::shared_future<void> &&waiter, uint64_t payload, bool unblock_validation_object,
@@ -488,7 +498,7 @@ void vvl::Semaphore::WaitTimePoint(std::shared_future<void> &&waiter, uint64_t p
             "INTERNAL-ERROR-VkSemaphore-state-timeout", Handle(), loc,
             "The Validation Layers hit a timeout waiting for timeline semaphore state to update. completed_.payload=%" PRIu64
             " wait_payload=%" PRIu64,
-            completed_.payload, payload);
+            CurrentPayload(), payload);
     }
 }
 
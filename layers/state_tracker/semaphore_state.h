@@ -19,6 +19,7 @@
 #pragma once
 #include "state_tracker/state_object.h"
 #include "state_tracker/submission_reference.h"
+#include <atomic>
 #include <future>
 #include <optional>
 #include <map>
@@ -123,9 +124,9 @@ class Semaphore : public RefcountedStateObject {
     // "and any semaphore signal operations on which it depends must have also been submitted for execution"
     std::optional<SemaphoreInfo> GetPendingBinarySignalTimelineDependency() const;
 
-    // Current payload value.
+    // Current payload value. Does not lock the semaphore.
     // If a queue submission command is pending execution, then the returned value may immediately be out of date
-    uint64_t CurrentPayload() const;
+    uint64_t CurrentPayload() const { return completed_payload_.load(std::memory_order_acquire); }
 
     bool CanBinaryBeSignaled() const;
     bool CanBinaryBeWaited() const;
@@ -165,6 +166,13 @@ class Semaphore : public RefcountedStateObject {
 
     // Mark timepoints up to and including payload as completed (notify waiters) and remove them from timeline
     void RetireTimePoint(uint64_t payload, OpType completed_op, SubmissionReference completed_submit);
+    void SetCompleted(const SemOp &completed);
+
+    // True if a timeline payload is known to be reached without taking the lock.
+    // Timeline payloads only grow, so a stale read can only give false negatives, which then take the locked path.
+    bool IsTimelinePayloadCompleted(uint64_t payload) const {
+        return type == VK_SEMAPHORE_TYPE_TIMELINE && payload <= completed_payload_.load(std::memory_order_acquire);
+    }
 
     // Waits for the waiter. Unblock parameter must be true if the caller is a validation object and false otherwise.
     // (validation object has to use {Begin/End}BlockingOperation() when waiting for the timepoint)
@@ -176,6 +184,10 @@ class Semaphore : public RefcountedStateObject {
 
     // the most recently completed operation
     SemOp completed_;
+    // Copy of completed_.payload that can be read without the lock, only written through SetCompleted().
+    // A timeline semaphore used as a frame counter is polled and retired by every queue thread, most of these calls only
+    // need the completed payload.
+    std::atomic<uint64_t> completed_payload_;
 
     // next payload value for binary semaphore operations
     uint64_t next_payload_;
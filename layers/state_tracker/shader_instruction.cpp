@@ -13,31 +13,17 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <sstream>
 #include "state_tracker/shader_instruction.h"
 #include "generated/spirv_grammar_helper.h"
 
 namespace spirv {
 
-Instruction::Instruction(std::vector<uint32_t>::const_iterator it)
-    : position_index_(0), operand_info_(GetOperandInfo(*it & 0x0ffffu)) {
-    // Get Length manually to save allocation of vector
-    const uint32_t length = (*it >> 16);
-    words_.reserve(length);
-    for (uint32_t i = 0; i < length; i++) {
-        words_.emplace_back(*it++);
-    }
-    SetResultTypeIndex();
-    UpdateDebugInfo();
-}
+Instruction::Instruction(std::vector<uint32_t>::const_iterator it) : Instruction(&*it) {}
 
-Instruction::Instruction(const uint32_t* it) : position_index_(0), operand_info_(GetOperandInfo(*it & 0x0ffffu)) {
-    // Get Length manually to save allocation of vector
-    const uint32_t length = (*it >> 16);
-    words_.reserve(length);
-    for (uint32_t i = 0; i < length; i++) {
-        words_.emplace_back(*it++);
-    }
+Instruction::Instruction(const uint32_t* it)
+    : words_(it), position_index_(0), operand_info_(GetOperandInfo(*it & 0x0ffffu)) {
     SetResultTypeIndex();
     UpdateDebugInfo();
 }
@@ -46,22 +32,51 @@ Instruction::Instruction(spirv_iterator it, uint32_t position)
     : position_index_(position), operand_info_(GetOperandInfo(*it & 0x0ffffu)) {
     // Get Length manually to save allocation of vector
     const uint32_t length = (*it >> 16);
-    words_.reserve(length);
+    owned_words_.reserve(length);
     for (uint32_t i = 0; i < length; i++) {
-        words_.emplace_back(*it++);
+        owned_words_.emplace_back(*it++);
     }
+    OwnedWordsChanged();
     SetResultTypeIndex();
     UpdateDebugInfo();
 }
 
 Instruction::Instruction(uint32_t length, spv::Op opcode) : position_index_(0), operand_info_(GetOperandInfo(opcode)) {
-    words_.reserve(length);
+    owned_words_.reserve(length);
     uint32_t first_word = (length << 16) | opcode;
-    words_.emplace_back(first_word);
+    owned_words_.emplace_back(first_word);
+    OwnedWordsChanged();
 
     SetResultTypeIndex();
 }
 
+Instruction::Instruction(const Instruction& other)
+    : words_(other.words_),
+      owned_words_(other.owned_words_),
+      result_id_index_(other.result_id_index_),
+      type_id_index_(other.type_id_index_),
+      operand_index_(other.operand_index_),
+      position_index_(other.position_index_),
+      operand_info_(other.operand_info_) {
+    if (IsOwned()) {
+        OwnedWordsChanged();
+    }
+    UpdateDebugInfo();
+}
+
+bool Instruction::operator==(Instruction const& other) const {
+    const uint32_t word_count = WordCount();
+    return word_count == other.WordCount() && std::equal(words_, words_ + word_count, other.words_);
+}
+
+uint32_t* Instruction::MutableWords() {
+    if (!IsOwned()) {
+        owned_words_.assign(words_, words_ + Length());
+        OwnedWordsChanged();
+    }
+    return owned_words_.data();
+}
+
 void Instruction::SetResultTypeIndex() {
     const bool has_result = OpcodeHasResult(Opcode());
     if (OpcodeHasType(Opcode())) {
@@ -84,7 +99,7 @@ void Instruction::UpdateDebugInfo() {
     d_result_id_ = ResultId();
     d_type_id_ = TypeId();
     // the words might not all be filled in yet
-    for (uint32_t i = 0; i < words_.size() && i < 12; i++) {
+    for (uint32_t i = 0; i < WordCount() && i < 12; i++) {
         d_words_[i] = words_[i];
     }
 #endif
@@ -221,35 +236,33 @@ spv::StorageClass Instruction::StorageClass() const {
 }
 
 void Instruction::Fill(const std::vector<uint32_t>& words) {
-    for (uint32_t word : words) {
-        words_.emplace_back(word);
-    }
+    MutableWords();
+    owned_words_.insert(owned_words_.end(), words.begin(), words.end());
+    OwnedWordsChanged();
     UpdateDebugInfo();
 }
 
 void Instruction::UpdateWord(uint32_t index, uint32_t data) {
-    words_[index] = data;
+    MutableWords()[index] = data;
 #ifndef NDEBUG
     d_words_[index] = data;
 #endif
 }
 
 void Instruction::AppendWord(uint32_t word) {
-    words_.emplace_back(word);
+    MutableWords();
+    owned_words_.emplace_back(word);
+    OwnedWordsChanged();
     const uint32_t new_length = Length() + 1;
     uint32_t first_word = (new_length << 16) | Opcode();
-    words_[0] = first_word;
+    owned_words_[0] = first_word;
     UpdateDebugInfo();
 }
 
-void Instruction::ToBinary(std::vector<uint32_t>& out) {
-    for (auto word : words_) {
-        out.push_back(word);
-    }
-}
+void Instruction::ToBinary(std::vector<uint32_t>& out) { out.insert(out.end(), words_, words_ + WordCount()); }
 
 void Instruction::ReplaceResultId(uint32_t new_result_id) {
-    words_[result_id_index_] = new_result_id;
+    MutableWords()[result_id_index_] = new_result_id;
     UpdateDebugInfo();
 }
 
@@ -280,7 +293,7 @@ void Instruction::ReplaceOperandId(uint32_t old_word, uint32_t new_word) {
         // insructions like OpPhi will be Composite which are just groups of Ids
         // We are not trying to replace/mess with with Control Flow, so all OperandKind::Label are ignored on purpose
         if (kind == OperandKind::Id || kind == OperandKind::Composite) {
-            words_[word_index] = new_word;
+            MutableWords()[word_index] = new_word;
             UpdateDebugInfo();
         }
     }
@@ -293,7 +306,7 @@ void Instruction::ReplaceLinkedId(vvl::unordered_map<uint32_t, uint32_t>& id_swa
         uint32_t old_id = words_[index];
         uint32_t new_id = id_swap_map[old_id];
         assert(new_id != 0);
-        words_[index] = new_id;
+        MutableWords()[index] = new_id;
     };
 
     auto swap_to_end = [this, swap](uint32_t start_index) {
@@ -38,11 +38,17 @@ namespace spirv {
 //
 // For more information of the physical module layout to help understand this struct:
 // https://github.com/KhronosGroup/SPIRV-Guide/blob/main/chapters/parsing_instructions.md
+//
+// The words are either borrowed from the SPIR-V binary the instruction was parsed from, which then must outlive it, or owned by
+// the instruction once it was created or modified by GPU-AV.
 class Instruction {
   public:
+    // Borrows the words from the binary
     Instruction(std::vector<uint32_t>::const_iterator it);
     Instruction(const uint32_t* it);
     ~Instruction() = default;
+    Instruction(const Instruction& other);
+    Instruction(Instruction&& other) = default;
 
     // The word used to define the Instruction
     uint32_t Word(uint32_t index) const { return words_[index]; }
@@ -85,10 +91,11 @@ class Instruction {
     // Auto-generated helper functions
     spv::StorageClass StorageClass() const;
 
-    bool operator==(Instruction const& other) const { return words_ == other.words_; }
-    bool operator!=(Instruction const& other) const { return words_ != other.words_; }
+    bool operator==(Instruction const& other) const;
+    bool operator!=(Instruction const& other) const { return !(*this == other); }
 
     // The following is only used for GPU-AV where we need to possibly update an Instruction
+    // Copies the words from the binary
     Instruction(spirv_iterator it, uint32_t position);
     // Assumes caller will fill remaining words
     Instruction(uint32_t length, spv::Op opcode);
@@ -105,16 +112,17 @@ class Instruction {
   private:
     void SetResultTypeIndex();
     void UpdateDebugInfo();
-
-    // When this class was created, for SPIR-V Instructions that could be used in Vulkan,
-    //   414 of 423 had 6 or less operands
-    //   361 of 423 had 5 or less operands
-    //   287 of 423 had 4 or less operands
-    // An extra word is still needed because each insturction has one word prior to the operands
-    static constexpr uint32_t word_vector_length = 7;
-
-    // Max capacity needs to be uint32_t because an instruction can have a string operand that is (2^16)-1 bytes long
-    small_vector<uint32_t, word_vector_length, uint32_t> words_;
+    // Number of words set so far, can be less than Length() while GPU-AV fills a new instruction
+    uint32_t WordCount() const { return IsOwned() ? static_cast<uint32_t>(owned_words_.size()) : Length(); }
+    bool IsOwned() const { return !owned_words_.empty(); }
+    // Copies borrowed words before they are modified
+    uint32_t* MutableWords();
+    void OwnedWordsChanged() { words_ = owned_words_.data(); }
+
+    // Points either in the binary or in owned_words_
+    const uint32_t* words_ = nullptr;
+    // Empty while the words are borrowed, so that parsing a module allocates nothing per instruction
+    std::vector<uint32_t> owned_words_;
     uint32_t result_id_index_ = 0;
     uint32_t type_id_index_ = 0;
     uint32_t operand_index_ = 1;
@@ -108,7 +108,7 @@ bool DecorationSet::HasAnyBuiltIn() const {
         return true;
     } else if (!member_decorations.empty()) {
         for (const auto& member : member_decorations) {
-            if (kInvalidValue != member.second.builtin) {
+            if (kInvalidValue != member.builtin) {
                 return true;
             }
         }
@@ -118,7 +118,7 @@ bool DecorationSet::HasAnyBuiltIn() const {
 
 bool DecorationSet::HasInMember(FlagBit flag_bit) const {
     for (const auto& decoration : member_decorations) {
-        if (decoration.second.Has(flag_bit)) {
+        if (decoration.Has(flag_bit)) {
             return true;
         }
     }
@@ -127,7 +127,7 @@ bool DecorationSet::HasInMember(FlagBit flag_bit) const {
 
 bool DecorationSet::AllMemberHave(FlagBit flag_bit) const {
     for (const auto& decoration : member_decorations) {
-        if (!decoration.second.Has(flag_bit)) {
+        if (!decoration.Has(flag_bit)) {
             return false;
         }
     }
@@ -498,8 +498,9 @@ bool EntryPoint::IsBuiltInWritten(spv::BuiltIn built_in, const Module& module_st
         return false;
     }
 
-    for (const auto& member : variable.type_struct_info->decorations.member_decorations) {
-        if (built_in != member.second.builtin) continue;
+    const auto& member_decorations = variable.type_struct_info->decorations.member_decorations;
+    for (uint32_t member_index = 0; member_index < member_decorations.size(); ++member_index) {
+        if (built_in != member_decorations[member_index].builtin) continue;
 
         // We have confirmed the Block variable was written to, now need to confirm an access to.
         // Because Built-in can't both be the input and output at the same time, we can confirm all accesses are either all
@@ -508,7 +509,6 @@ bool EntryPoint::IsBuiltInWritten(spv::BuiltIn built_in, const Module& module_st
         if (it == access_chain_map.end()) {
             return false;
         }
-        const uint32_t member_index = member.first;
         for (const auto access_chain_insn : it->second) {
             if (access_chain_insn->Length() < 5) continue;
 
@@ -932,16 +932,53 @@ EntryPoint::EntryPoint(const Module& module_state, const Instruction& entrypoint
     }
 }
 
-Module::StaticData::StaticData(const Module& module_state, StatelessData* stateless_data) {
+Module::Module(bool valid, const uint32_t* words, size_t word_count, StatelessData* stateless_data)
+    : valid_spirv(valid), data_(std::make_shared<ModuleData>(valid)), words_(data_->words), static_data_(data_->static_data) {
+    if (words) {
+        data_->words.assign(words, words + word_count);
+    }
+    // Parsing looks up what it already parsed through this Module, so it is done in place
+    data_->static_data.Parse(*this, stateless_data);
+}
+
+Module::Module(vvl::span<const uint32_t> code) : Module(true, code.data(), code.size(), nullptr) {}
+
+Module::Module(size_t codeSize, const uint32_t* pCode, StatelessData* stateless_data)
+    : Module(pCode && pCode[0] == spv::MagicNumber && ((codeSize % 4) == 0), pCode, codeSize / sizeof(uint32_t),
+             stateless_data) {}
+
+Module::Module(std::shared_ptr<ModuleData> data)
+    : valid_spirv(data->valid_spirv), data_(std::move(data)), words_(data_->words), static_data_(data_->static_data) {}
+
+void Module::StaticData::Parse(const Module& module_state, StatelessData* stateless_data) {
     if (!module_state.valid_spirv) return;
 
     // Parse the words first so we have instruction class objects to use
     {
-        std::vector<uint32_t>::const_iterator it = module_state.words_.cbegin();
-        it += 5;  // skip first 5 word of header
-        instructions.reserve(module_state.words_.size() * 4);
-        while (it != module_state.words_.cend()) {
-            auto new_insn = instructions.emplace_back(it);
+        const std::vector<uint32_t>& words = module_state.words_;
+        // skip first 5 word of header
+        static constexpr size_t kHeaderSize = 5;
+        if (words.size() < kHeaderSize) return;
+
+        // Count first so the instructions, which only point into the words, are allocated once
+        size_t instruction_count = 0;
+        size_t parsed_word_count = kHeaderSize;
+        while (parsed_word_count < words.size()) {
+            const uint32_t length = words[parsed_word_count] >> 16;
+            // Malformed, spirv-val will report it
+            if (length == 0 || length > words.size() - parsed_word_count) break;
+            parsed_word_count += length;
+            ++instruction_count;
+        }
+        instructions.reserve(instruction_count);
+        const size_t id_bound = std::min<size_t>(words[3], words.size());
+        definitions.Resize(id_bound);
+        decoration_index.Resize(id_bound);
+        type_struct_index.Resize(id_bound);
+
+        const uint32_t* it = words.data() + kHeaderSize;
+        for (size_t i = 0; i < instruction_count; ++i) {
+            const Instruction& new_insn = instructions.emplace_back(it);
             const uint32_t opcode = new_insn.Opcode();
 
             // Check for opcodes that would require reparsing of the words
@@ -955,7 +992,6 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
 
             it += new_insn.Length();
         }
-        instructions.shrink_to_fit();
     }
 
     // These have their own object class, but need entire module parsed first
@@ -967,6 +1003,15 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
     std::vector<const Instruction*> builtin_decoration_instructions;
 
     DebugNameMap debug_name_map;
+    debug_name_map.Resize(definitions.DenseSize());
+    auto get_decorations = [this](uint32_t id) -> DecorationSet& {
+        uint32_t& index = decoration_index[id];
+        if (index == kInvalidValue) {
+            index = static_cast<uint32_t>(decorations.size());
+            decorations.emplace_back();
+        }
+        return decorations[index];
+    };
 
     std::vector<uint32_t> store_pointer_ids;
     std::vector<uint32_t> load_pointer_ids;
@@ -1002,7 +1047,7 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
             // Decorations
             case spv::OpDecorate: {
                 const uint32_t target_id = insn.Word(1);
-                decorations[target_id].Add(insn.Word(2), insn.Length() > 3u ? insn.Word(3) : 0u);
+                get_decorations(target_id).Add(insn.Word(2), insn.Length() > 3u ? insn.Word(3) : 0u);
                 decoration_inst.push_back(&insn);
                 if (insn.Word(2) == spv::DecorationBuiltIn) {
                     builtin_decoration_instructions.push_back(&insn);
@@ -1013,7 +1058,14 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
             case spv::OpMemberDecorate: {
                 const uint32_t target_id = insn.Word(1);
                 const uint32_t member_index = insn.Word(2);
-                decorations[target_id].member_decorations[member_index].Add(insn.Word(3), insn.Length() > 4u ? insn.Word(4) : 0u);
+                // An OpTypeStruct can not have more members than an instruction has words, spirv-val reports the bogus indices
+                if (member_index < std::numeric_limits<uint16_t>::max()) {
+                    auto& member_decorations = get_decorations(target_id).member_decorations;
+                    if (member_index >= member_decorations.size()) {
+                        member_decorations.resize(member_index + 1);
+                    }
+                    member_decorations[member_index].Add(insn.Word(3), insn.Length() > 4u ? insn.Word(4) : 0u);
+                }
                 member_decoration_inst.push_back(&insn);
                 if (insn.Word(3) == spv::DecorationBuiltIn) {
                     builtin_decoration_instructions.push_back(&insn);
@@ -1302,28 +1354,74 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
 
     // Need to get struct first and EntryPoint's variables depend on it
     for (const auto& insn : type_struct_instructions) {
-        auto new_struct = type_structs.emplace_back(std::make_shared<TypeStructInfo>(module_state, *insn));
-        type_struct_map[new_struct->id] = new_struct;
-    }
-
-    // Need to get ImageAccesses as EntryPoint's variables depend on it
-    std::vector<std::shared_ptr<ImageAccess>> image_accesses;
-    ImageAccessMap image_access_map;
-
-    for (const auto& insn : image_instructions) {
-        auto new_access = image_accesses.emplace_back(std::make_shared<ImageAccess>(module_state, *insn, func_parameter_map));
-        if (!new_access->variable_image_insn.empty() && new_access->valid_access) {
-            for (const Instruction* image_insn : new_access->variable_image_insn) {
-                image_access_map[image_insn->ResultId()].push_back(new_access);
+        // So that the undecorated members are found too
+        const uint32_t index = decoration_index.Find(insn->ResultId());
+        if (index != kInvalidValue) {
+            auto& member_decorations = decorations[index].member_decorations;
+            if (!member_decorations.empty() && member_decorations.size() < insn->Length() - 2u) {
+                member_decorations.resize(insn->Length() - 2u);
             }
         }
+        // Only found once built, a struct can point to itself through a physical storage buffer pointer
+        type_structs.emplace_back(std::make_shared<TypeStructInfo>(module_state, *insn));
+        type_struct_index[insn->ResultId()] = static_cast<uint32_t>(type_structs.size() - 1);
+    }
+
+    // ImageAccesses and EntryPoints are built on demand, see GetEntryPoint()
+    entry_point_analysis = std::make_unique<EntryPointAnalysis>();
+    entry_point_analysis->entry_point_once = std::make_unique<std::once_flag[]>(entry_point_instructions.size());
+    entry_point_analysis->entry_points.resize(entry_point_instructions.size());
+    entry_point_analysis->entry_point_instructions = std::move(entry_point_instructions);
+    entry_point_analysis->image_instructions = std::move(image_instructions);
+    entry_point_analysis->func_parameter_map = std::move(func_parameter_map);
+    entry_point_analysis->access_chain_map = std::move(access_chain_map);
+    entry_point_analysis->variable_access_map = std::move(variable_access_map);
+    entry_point_analysis->debug_name_map = std::move(debug_name_map);
+}
+
+const std::shared_ptr<EntryPoint>& Module::GetEntryPoint(uint32_t index) const {
+    auto& analysis = *static_data_.entry_point_analysis;
+    assert(index < analysis.entry_points.size());
+
+    std::call_once(analysis.entry_point_once[index], [this, &analysis, index]() {
+        // Need to get ImageAccesses as EntryPoint's variables depend on it
+        std::call_once(analysis.image_access_once, [this, &analysis]() {
+            for (const auto& insn : analysis.image_instructions) {
+                auto new_access = std::make_shared<ImageAccess>(*this, *insn, analysis.func_parameter_map);
+                if (!new_access->variable_image_insn.empty() && new_access->valid_access) {
+                    for (const Instruction* image_insn : new_access->variable_image_insn) {
+                        analysis.image_access_map[image_insn->ResultId()].push_back(new_access);
+                    }
+                }
+            }
+        });
+        analysis.entry_points[index] =
+            std::make_shared<EntryPoint>(*this, *analysis.entry_point_instructions[index], analysis.image_access_map,
+                                         analysis.access_chain_map, analysis.variable_access_map, analysis.debug_name_map);
+    });
+    return analysis.entry_points[index];
+}
+
+uint64_t Module::GetCodeHash() const {
+    uint64_t hash = data_->code_hash.load(std::memory_order_relaxed);
+    if (hash == 0) {
+        // Threads racing here compute the same value
+        hash = hash_util::Hash64(words_.data(), words_.size() * sizeof(uint32_t));
+        data_->code_hash.store(hash, std::memory_order_relaxed);
     }
+    return hash;
+}
 
-    // Need to build the definitions table for FindDef before looking for which instructions each entry point uses
-    for (const auto& insn : entry_point_instructions) {
-        entry_points.emplace_back(std::make_shared<EntryPoint>(module_state, *insn, image_access_map, access_chain_map,
-                                                               variable_access_map, debug_name_map));
+const std::vector<std::shared_ptr<EntryPoint>>& Module::GetEntryPoints() const {
+    static const std::vector<std::shared_ptr<EntryPoint>> empty_entry_points;
+    if (!static_data_.entry_point_analysis) {
+        return empty_entry_points;
+    }
+    const uint32_t count = GetEntryPointCount();
+    for (uint32_t i = 0; i < count; ++i) {
+        GetEntryPoint(i);
     }
+    return static_data_.entry_point_analysis->entry_points;
 }
 
 std::shared_ptr<const TypeStructInfo> Module::GetTypeStructInfo(const Instruction* insn) const {
@@ -1336,8 +1434,8 @@ std::shared_ptr<const TypeStructInfo> Module::GetTypeStructInfo(const Instructio
             insn = FindDef(insn->Word(2));
         } else if (insn->Opcode() == spv::OpTypeStruct) {
             // return the actual execution modes for this id, or a default empty set.
-            const auto it = static_data_.type_struct_map.find(insn->ResultId());
-            return (it != static_data_.type_struct_map.end()) ? it->second : nullptr;
+            const uint32_t index = static_data_.type_struct_index.Find(insn->ResultId());
+            return (index != kInvalidValue) ? static_data_.type_structs[index] : nullptr;
         } else {
             return nullptr;
         }
@@ -1515,9 +1613,13 @@ std::string Module::DescribeInstruction(const Instruction& error_insn) const {
 
 std::shared_ptr<const EntryPoint> Module::FindEntrypoint(char const* name, VkShaderStageFlagBits stageBits) const {
     if (!name) return nullptr;
-    for (const auto& entry_point : static_data_.entry_points) {
-        if (entry_point->name.compare(name) == 0 && entry_point->stage == stageBits) {
-            return entry_point;
+    const uint32_t count = GetEntryPointCount();
+    for (uint32_t i = 0; i < count; ++i) {
+        // Match on the instruction to only build the entry point which is looked up
+        const Instruction& insn = *static_data_.entry_point_analysis->entry_point_instructions[i];
+        const auto stage = static_cast<VkShaderStageFlagBits>(ExecutionModelToShaderStageFlagBits(insn.Word(1)));
+        if (stage == stageBits && strcmp(insn.GetAsString(3), name) == 0) {
+            return GetEntryPoint(i);
         }
     }
     return nullptr;
@@ -1782,17 +1884,15 @@ char const* string_NumericType(uint32_t type) {
 const char* VariableBase::FindDebugName(const VariableBase& variable, const DebugNameMap& debug_name_map) {
     const char* name = "";
     // We prefer to always get the variable name if it has it
-    auto name_it = debug_name_map.find(variable.id);
-    if (name_it != debug_name_map.end()) {
-        name = name_it->second->GetAsString(2);
+    if (const Instruction* name_insn = debug_name_map.Find(variable.id)) {
+        name = name_insn->GetAsString(2);
     }
     // if the shader looks like
     //     layout(binding=0) uniform StructName { vec4 x };
     // The variable name will be an empty string, for this, grab the struct name instead
     if (!name[0] && variable.type_struct_info) {
-        name_it = debug_name_map.find(variable.type_struct_info->id);
-        if (name_it != debug_name_map.end()) {
-            name = name_it->second->GetAsString(2);
+        if (const Instruction* name_insn = debug_name_map.Find(variable.type_struct_info->id)) {
+            name = name_insn->GetAsString(2);
         }
     }
     return name;
@@ -2231,9 +2331,8 @@ TypeStructInfo::TypeStructInfo(const Module& module_state, const Instruction& st
         member.insn = module_state.FindDef(member.id);
         member.type_struct_info = module_state.GetTypeStructInfo(member.insn);
 
-        const auto it = decorations.member_decorations.find(i);
-        if (it != decorations.member_decorations.end()) {
-            member.decorations = &it->second;
+        if (i < decorations.member_decorations.size()) {
+            member.decorations = &decorations.member_decorations[i];
         }
     }
 }
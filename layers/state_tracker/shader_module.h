@@ -18,9 +18,12 @@
 #pragma once
 
 #include <vulkan/vulkan_core.h>
+#include <atomic>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <optional>
@@ -45,6 +48,39 @@ static constexpr uint32_t kInvalidValue = std::numeric_limits<uint32_t>::max();
 // Need to find a way to know if actually array length of zero, or a runtime array.
 static constexpr uint32_t kRuntimeArray = std::numeric_limits<uint32_t>::max();
 
+// Value of each <id> of a module. The ids are dense in [1, bound), so the values are stored in an array sized by the id bound of
+// the header, and the ids past it (only found in invalid SPIR-V) go in a map.
+template <typename T>
+class IdTable {
+  public:
+    explicit IdTable(T empty = T{}) : empty_(empty) {}
+
+    void Resize(size_t bound) { dense_.resize(bound, empty_); }
+    size_t DenseSize() const { return dense_.size(); }
+
+    // Returns the empty value for the ids that were never set
+    const T &Find(uint32_t id) const {
+        if (id < dense_.size()) {
+            return dense_[id];
+        }
+        if (overflow_.empty()) return empty_;
+        const auto it = overflow_.find(id);
+        return (it != overflow_.end()) ? it->second : empty_;
+    }
+
+    T &operator[](uint32_t id) {
+        if (id < dense_.size()) {
+            return dense_[id];
+        }
+        return overflow_.try_emplace(id, empty_).first->second;
+    }
+
+  private:
+    T empty_;
+    std::vector<T> dense_;
+    vvl::unordered_map<uint32_t, T> overflow_;
+};
+
 struct LocalSize {
     uint32_t x = 0;
     uint32_t y = 0;
@@ -100,8 +136,8 @@ struct DecorationSet : public DecorationBase {
     // Value of InputAttachmentIndex the variable starts
     uint32_t input_attachment_index_start = kInvalidValue;
 
-    // <index into struct, DecorationBase>
-    vvl::unordered_map<uint32_t, DecorationBase> member_decorations;
+    // Indexed by the member index. Once a member is decorated, it is sized by the member count of the OpTypeStruct.
+    std::vector<DecorationBase> member_decorations;
 
     void Add(uint32_t decoration, uint32_t value);
     bool HasAnyBuiltIn() const;
@@ -285,7 +321,7 @@ using ImageAccessMap = vvl::unordered_map<uint32_t, std::vector<std::shared_ptr<
 // Allows for grouping the access chains by which variables they are actually accessing
 using AccessChainVariableMap = vvl::unordered_map<uint32_t, std::vector<const Instruction *>>;
 // Mapping of OpName instructions
-using DebugNameMap = vvl::unordered_map<uint32_t, const Instruction *>;
+using DebugNameMap = IdTable<const Instruction *>;
 
 // A slot is a <Location, Component> mapping
 struct InterfaceSlot {
@@ -614,23 +650,29 @@ struct StatelessData {
 
 // Represents a SPIR-V Module
 // This holds the SPIR-V source and parse it
+struct ModuleData;
+
 struct Module {
     // Static/const data extracted from a SPIRV module at initialization time
     // The goal of this struct is to move everything that is ready only into here
     struct StaticData {
         StaticData() = default;
-        StaticData(const Module &module_state, StatelessData *stateless_data = nullptr);
+        // Fills this StaticData, which must be the one of |module_state| because the parsing looks itself up through it
+        void Parse(const Module &module_state, StatelessData *stateless_data);
         StaticData &operator=(StaticData &&) = default;
         StaticData(StaticData &&) = default;
 
-        // List of all instructions in the order they appear in the binary
+        // List of all instructions in the order they appear in the binary, their words are borrowed from Module::words_
         std::vector<Instruction> instructions;
         // Instructions that can be referenced by Ids
         // A mapping of <id> to the first word of its def. this is useful because walking type
         // trees, constant expressions, etc requires jumping all over the instruction stream.
-        vvl::unordered_map<uint32_t, const Instruction *> definitions;
+        // The id tables are sized by the id bound of the header (capped by the word count in case the bound is bogus)
+        IdTable<const Instruction *> definitions;
 
-        vvl::unordered_map<uint32_t, DecorationSet> decorations;
+        // Only the decorated ids have a DecorationSet, |decoration_index| gives its index in |decorations|
+        IdTable<uint32_t> decoration_index{kInvalidValue};
+        std::vector<DecorationSet> decorations;
         DecorationSet empty_decoration;  // all zero values, allows use to return a reference and not a copy each time
 
         // Execution Modes are tied to a Function <id>, multiple EntryPoints can point to the same Funciton <id>
@@ -672,12 +714,31 @@ struct Module {
         bool using_legacy_debug_info{false};
         uint32_t shader_debug_info_set_id = 0;  // non-zero means shader has NonSemantic.Shader.DebugInfo.100
 
-        // EntryPoint has pointer references inside it that need to be preserved
-        std::vector<std::shared_ptr<EntryPoint>> entry_points;
+        // The EntryPoint objects and the ImageAccess they depend on are the most expensive part of the parsing, and many modules
+        // are only ever used with one of their entry points (or none, if only the stateless checks run). They are built the
+        // first time they are looked up, this holds what is needed to do it.
+        struct EntryPointAnalysis {
+            std::vector<const Instruction *> entry_point_instructions;
+            std::vector<const Instruction *> image_instructions;
+            FuncParameterMap func_parameter_map;
+            AccessChainVariableMap access_chain_map;
+            VariableAccessMap variable_access_map;
+            DebugNameMap debug_name_map;
+
+            std::once_flag image_access_once;
+            ImageAccessMap image_access_map;
+
+            // Same order as entry_point_instructions, each one is built under its own once flag
+            std::unique_ptr<std::once_flag[]> entry_point_once;
+            // EntryPoint has pointer references inside it that need to be preserved
+            std::vector<std::shared_ptr<EntryPoint>> entry_points;
+        };
+        // Null if the module could not be parsed
+        std::unique_ptr<EntryPointAnalysis> entry_point_analysis;
 
         std::vector<std::shared_ptr<TypeStructInfo>> type_structs;  // All OpTypeStruct objects
-        // <OpTypeStruct ID, info> - used for faster lookup as there can many structs
-        vvl::unordered_map<uint32_t, std::shared_ptr<const TypeStructInfo>> type_struct_map;
+        // <OpTypeStruct ID, index in type_structs> - used for faster lookup as there can many structs
+        IdTable<uint32_t> type_struct_index{kInvalidValue};
 
         // Tracks accesses (load, store, atomic) to the instruction calling them
         // Example: the OpLoad does the "access" but need to know if a OpImageRead uses that OpLoad later
@@ -689,36 +750,36 @@ struct Module {
     // underlying spirv is not worth validating further
     const bool valid_spirv;
 
+    const std::shared_ptr<ModuleData> data_;
+
     // This is the SPIR-V module data content
-    const std::vector<uint32_t> words_;
+    const std::vector<uint32_t> &words_;
 
-    const StaticData static_data_;
+    const StaticData &static_data_;
 
     // Hold a handle so error message can know where the SPIR-V was from (VkShaderModule or VkShaderEXT)
     VulkanTypedHandle handle_;                            // Will be updated once its known its valid SPIR-V
     VulkanTypedHandle handle() const { return handle_; }  // matches normal convention to get handle
 
     // Used for when modifying the SPIR-V (spirv-opt, GPU-AV instrumentation, etc) and need reparse it for VVL validation
-    Module(vvl::span<const uint32_t> code) : valid_spirv(true), words_(code.begin(), code.end()), static_data_(*this) {}
+    Module(vvl::span<const uint32_t> code);
 
     // StatelessData is a pointer as we have cases were we don't need it and simpler to just null check the few cases that use it
-    Module(size_t codeSize, const uint32_t *pCode, StatelessData *stateless_data = nullptr)
-        : valid_spirv(pCode && pCode[0] == spv::MagicNumber && ((codeSize % 4) == 0)),
-          words_(pCode, pCode + codeSize / sizeof(uint32_t)),
-          static_data_(*this, stateless_data) {}
-
-    const Instruction *FindDef(uint32_t id) const {
-        auto it = static_data_.definitions.find(id);
-        if (it == static_data_.definitions.end()) return nullptr;
-        return it->second;
-    }
+    Module(size_t codeSize, const uint32_t *pCode, StatelessData *stateless_data = nullptr);
+
+    // Shares the parsing of another Module created from the same SPIR-V
+    explicit Module(std::shared_ptr<ModuleData> data);
+    Module(const Module &) = delete;
+    Module &operator=(const Module &) = delete;
+
+    const Instruction *FindDef(uint32_t id) const { return static_data_.definitions.Find(id); }
 
     const std::vector<Instruction> &GetInstructions() const { return static_data_.instructions; }
 
     const DecorationSet &GetDecorationSet(uint32_t id) const {
         // return the actual decorations for this id, or a default empty set.
-        const auto it = static_data_.decorations.find(id);
-        return (it != static_data_.decorations.end()) ? it->second : static_data_.empty_decoration;
+        const uint32_t index = static_data_.decoration_index.Find(id);
+        return (index != kInvalidValue) ? static_data_.decorations[index] : static_data_.empty_decoration;
     }
 
     const ExecutionModeSet &GetExecutionModeSet(uint32_t function_id) const {
@@ -739,6 +800,17 @@ struct Module {
     std::string DescribeInstruction(const Instruction &error_insn) const;
 
     std::shared_ptr<const EntryPoint> FindEntrypoint(char const *name, VkShaderStageFlagBits stageBits) const;
+    // Builds all the entry points, prefer FindEntrypoint() when only one is needed
+    const std::vector<std::shared_ptr<EntryPoint>> &GetEntryPoints() const;
+    // Hash64 of the words, computed the first time it is needed
+    uint64_t GetCodeHash() const;
+    // Builds the entry point of the index-th OpEntryPoint if it was not yet
+    const std::shared_ptr<EntryPoint> &GetEntryPoint(uint32_t index) const;
+    uint32_t GetEntryPointCount() const {
+        return static_data_.entry_point_analysis
+                   ? static_cast<uint32_t>(static_data_.entry_point_analysis->entry_point_instructions.size())
+                   : 0;
+    }
     LocalSize FindLocalSize(const EntryPoint &entrypoint) const;
 
     uint32_t CalculateWorkgroupSharedMemory() const;
@@ -768,6 +840,23 @@ struct Module {
         return std::any_of(static_data_.capability_list.begin(), static_data_.capability_list.end(),
                            [find_capability](const spv::Capability &capability) { return capability == find_capability; });
     }
+
+  private:
+    Module(bool valid, const uint32_t *words, size_t word_count, StatelessData *stateless_data);
+};
+
+// The words of a Module and what was parsed from them. It is immutable once parsed, so Modules created from the same SPIR-V can
+// share it.
+struct ModuleData {
+    const bool valid_spirv;
+    std::vector<uint32_t> words;
+    Module::StaticData static_data;
+    // What the parsing gathered for SpirvValidator, with pipeline_pnext_module left empty. Only set when the data is shared.
+    std::optional<StatelessData> stateless_data;
+    // Hash64 of the words, 0 until computed
+    mutable std::atomic<uint64_t> code_hash{0};
+
+    explicit ModuleData(bool valid) : valid_spirv(valid) {}
 };
 
 }  // namespace spirv
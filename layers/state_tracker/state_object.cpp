@@ -1,6 +1,6 @@
-/* Copyright (c) 2015-2024 The Khronos Group Inc.
- * Copyright (c) 2015-2024 Valve Corporation
- * Copyright (c) 2015-2024 LunarG, Inc.
+/* Copyright (c) 2015-2025 The Khronos Group Inc.
+ * Copyright (c) 2015-2025 Valve Corporation
+ * Copyright (c) 2015-2025 LunarG, Inc.
  * Copyright (C) 2015-2024 Google Inc.
  * Modifications Copyright (C) 2020 Advanced Micro Devices, Inc. All rights reserved.
  *
@@ -18,19 +18,37 @@
  */
 #include "state_tracker/state_object.h"
 
+#include <algorithm>
+
+static thread_local bool bulk_destroy_active = false;
+
+vvl::StateObject::BulkDestroyScope::BulkDestroyScope() : was_active_(bulk_destroy_active) { bulk_destroy_active = true; }
+vvl::StateObject::BulkDestroyScope::~BulkDestroyScope() { bulk_destroy_active = was_active_; }
+bool vvl::StateObject::BulkDestroyScope::Active() { return bulk_destroy_active; }
+
 vvl::StateObject::~StateObject() { Destroy(); }
 
 void vvl::StateObject::Destroy() {
-    Invalidate();
+    if (!BulkDestroyScope::Active()) {
+        Invalidate();
+    }
     destroyed_ = true;
 }
 
+std::shared_ptr<vvl::StateObject> vvl::StateObject::LockParent(const ParentLink& link) {
+    auto node = link.node.lock();
+    if (node && node->link_epoch_.load(std::memory_order_relaxed) != link.epoch) {
+        return nullptr;
+    }
+    return node;
+}
+
 const VulkanTypedHandle* vvl::StateObject::InUse() const {
     // NOTE: for performance reasons, this method calls up the tree
     // with the read lock held.
     auto guard = ReadLockTree();
     for (auto& item : parent_nodes_) {
-        auto node = item.second.lock();
+        auto node = LockParent(item.second);
         if (!node) {
             continue;
         }
@@ -42,9 +60,20 @@ const VulkanTypedHandle* vvl::StateObject::InUse() const {
 }
 
 bool vvl::StateObject::AddParent(StateObject* parent_node) {
+    const uint64_t epoch = parent_node->link_epoch_.load(std::memory_order_relaxed);
     auto guard = WriteLockTree();
-    auto result = parent_nodes_.emplace(parent_node->Handle(), std::weak_ptr<StateObject>(parent_node->shared_from_this()));
-    return result.second;
+    auto result = parent_nodes_.try_emplace(parent_node->Handle());
+    ParentLink& link = result.first->second;
+    if (!result.second && link.epoch == epoch && LockParent(link).get() == parent_node) {
+        return false;
+    }
+    // Either a new parent, or a stale link (unlinked parent, or destroyed parent whose handle was reused)
+    link.node = parent_node->shared_from_this();
+    link.epoch = epoch;
+    if (result.second && parent_nodes_.size() >= prune_size_) {
+        PruneParents();
+    }
+    return true;
 }
 
 void vvl::StateObject::RemoveParent(StateObject* parent_node) {
@@ -53,24 +82,51 @@ void vvl::StateObject::RemoveParent(StateObject* parent_node) {
     parent_nodes_.erase(parent_node->Handle());
 }
 
+void vvl::StateObject::PruneParents() {
+    for (auto it = parent_nodes_.begin(); it != parent_nodes_.end();) {
+        if (!LockParent(it->second)) {
+            it = parent_nodes_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    // Amortizes the sweep over the insertions, the map is at most twice the number of live parents
+    prune_size_ = std::max(kMinPruneSize, 2 * parent_nodes_.size());
+}
+
 // copy the current set of parents so that we don't need to hold the lock
 // while calling NotifyInvalidate on them, as that would lead to recursive locking.
 vvl::StateObject::NodeMap vvl::StateObject::GetParentsForInvalidate(bool unlink) {
     NodeMap result;
     if (unlink) {
         auto guard = WriteLockTree();
-        result = std::move(parent_nodes_);
+        for (auto& item : parent_nodes_) {
+            if (LockParent(item.second)) {
+                result.emplace(item.first, std::move(item.second.node));
+            }
+        }
         parent_nodes_.clear();
+        prune_size_ = kMinPruneSize;
     } else {
         auto guard = ReadLockTree();
-        result = parent_nodes_;
+        for (const auto& item : parent_nodes_) {
+            if (LockParent(item.second)) {
+                result.emplace(item.first, item.second.node);
+            }
+        }
     }
     return result;
 }
 
 vvl::StateObject::NodeMap vvl::StateObject::ObjectBindings() const {
     auto guard = ReadLockTree();
-    return parent_nodes_;
+    NodeMap result;
+    for (const auto& item : parent_nodes_) {
+        if (LockParent(item.second)) {
+            result.emplace(item.first, item.second.node);
+        }
+    }
+    return result;
 }
 
 void vvl::StateObject::Invalidate(bool unlink) {
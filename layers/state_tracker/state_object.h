@@ -93,6 +93,11 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     virtual bool AddParent(StateObject *parent_node);
     virtual void RemoveParent(StateObject *parent_node);
 
+    // Removes this object from the parents of all its children in O(1), for parents that drop all their children at once
+    // and often (ex: command buffer reset). The links still stored in the children are recognized as stale, and are reused
+    // by the next AddParent() of this object or pruned.
+    void UnlinkAllChildren() { link_epoch_.fetch_add(1, std::memory_order_relaxed); }
+
     // Invalidate is called on a state object to inform its parents that it
     // is being destroyed (unlink == true) or otherwise becoming invalid (unlink == false)
     void Invalidate(bool unlink = true);
@@ -100,6 +105,18 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     // Helper to let objects examine their immediate parents without holding the tree lock.
     NodeMap ObjectBindings() const;
 
+    // While alive, the objects destroyed on this thread do not Invalidate() their parents. For when all the objects of a
+    // device go away together (vkDestroyDevice), so the links between them no longer matter.
+    class BulkDestroyScope {
+      public:
+        BulkDestroyScope();
+        ~BulkDestroyScope();
+        static bool Active();
+
+      private:
+        const bool was_active_;
+    };
+
   protected:
     template <typename Derived, typename Shared = std::shared_ptr<Derived>>
     static Shared SharedFromThisImpl(Derived *derived) {
@@ -124,11 +141,27 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     ReadLockGuard ReadLockTree() const { return ReadLockGuard(tree_lock_); }
     WriteLockGuard WriteLockTree() { return WriteLockGuard(tree_lock_); }
 
+    struct ParentLink {
+        std::weak_ptr<StateObject> node;
+        // link_epoch_ of the parent when the link was added
+        uint64_t epoch;
+    };
+    // Returns the parent, or null if it is gone or has unlinked all its children since the link was added
+    static std::shared_ptr<StateObject> LockParent(const ParentLink &link);
+    // Must be called with the tree lock held for writing
+    void PruneParents();
+
+    static constexpr size_t kMinPruneSize = 16;
+
     // Set of immediate parent nodes for this object. For an in-use object, the
     // parent nodes should form a tree with the root being a command buffer.
-    NodeMap parent_nodes_;
+    unordered_map<VulkanTypedHandle, ParentLink> parent_nodes_;
+    // Size of parent_nodes_ at which the stale links are pruned
+    size_t prune_size_ = kMinPruneSize;
     // Lock guarding parent_nodes_, this lock MUST NOT be used for other purposes.
     mutable std::shared_mutex tree_lock_;
+    // Bumped by UnlinkAllChildren(), this object is only a parent of the children whose link has the current epoch
+    std::atomic<uint64_t> link_epoch_{0};
 };
 
 class RefcountedStateObject : public StateObject {
@@ -38,6 +38,7 @@
 #include "state_tracker/device_generated_commands_state.h"
 #include "state_tracker/wsi_state.h"
 #include "chassis/chassis_modification_state.h"
+#include "containers/object_pool.h"
 #include "spirv-tools/optimizer.hpp"
 
 // Used for debugging
@@ -470,7 +471,7 @@ struct BufferAddressInfillUpdateOps {
 };
 
 std::shared_ptr<Buffer> DeviceState::CreateBufferState(VkBuffer handle, const VkBufferCreateInfo *create_info) {
-    return std::make_shared<Buffer>(*this, handle, create_info);
+    return MakePooled<Buffer>("vvl::Buffer", *this, handle, create_info);
 }
 
 void DeviceState::PreCallRecordCreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo,
@@ -505,6 +506,7 @@ void DeviceState::PostCallRecordCreateBuffer(VkDevice device, const VkBufferCrea
 
         BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
         sparse_container::infill_update_range(buffer_address_map_, address_range, ops);
+        InvalidateBufferAddressSnapshot();
     }
 
     const VkBufferUsageFlags2 descriptor_buffer_usages =
@@ -557,7 +559,7 @@ std::shared_ptr<ImageView> DeviceState::CreateImageViewState(const std::shared_p
                                                              const VkImageViewCreateInfo *create_info,
                                                              VkFormatFeatureFlags2KHR format_features,
                                                              const VkFilterCubicImageViewImageFormatPropertiesEXT &cubic_props) {
-    return std::make_shared<ImageView>(*this, image_state, handle, create_info, format_features, cubic_props);
+    return MakePooled<ImageView>("vvl::ImageView", *this, image_state, handle, create_info, format_features, cubic_props);
 }
 
 void DeviceState::PostCallRecordCreateImageView(VkDevice device, const VkImageViewCreateInfo *pCreateInfo,
@@ -683,6 +685,7 @@ void DeviceState::PreCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer, c
 
                 return false;
             });
+            InvalidateBufferAddressSnapshot();
         }
     }
     Destroy<Buffer>(buffer);
@@ -1009,7 +1012,37 @@ void DeviceState::FinishDeviceSetup(const VkDeviceCreateInfo *pCreateInfo, const
 #endif
 }
 
+template <typename... States>
+static uint64_t StateObjectBytes(const DeviceState &device_state) {
+    return ((device_state.Count<States>() * sizeof(States)) + ...);
+}
+
+// Only counts the size of the base state objects, the validation objects that derive them and the memory they point to are not
+// counted, so this is a lower bound meant to compare runs and spot growth
+void DeviceState::UpdateMemoryAccounting() const {
+    const uint64_t state_bytes =
+        StateObjectBytes<vvl::Queue, vvl::RenderPass, vvl::DescriptorSetLayout, vvl::Sampler, vvl::ImageView, vvl::Image,
+                         vvl::BufferView, vvl::Buffer, vvl::PipelineCache, vvl::Pipeline, vvl::ShaderObject, vvl::DeviceMemory,
+                         vvl::Framebuffer, vvl::ShaderModule, vvl::DescriptorUpdateTemplate, vvl::Swapchain, vvl::DescriptorPool,
+                         vvl::CommandBuffer, vvl::CommandPool, vvl::PipelineLayout, vvl::Fence, vvl::QueryPool, vvl::Semaphore,
+                         vvl::Event, vvl::SamplerYcbcrConversion, vvl::VideoSession, vvl::VideoSessionParameters,
+                         vvl::AccelerationStructureNV, vvl::AccelerationStructureKHR, vvl::IndirectExecutionSet,
+                         vvl::IndirectCommandsLayout>(*this);
+    memory_accounting.Set(vvl::profiling::MemorySubsystem::StateTracker, state_bytes);
+
+    // The descriptor count comes from the immutable layout, so no lock is needed to read it
+    uint64_t descriptor_bytes = 0;
+    ForEachShared<vvl::DescriptorSet>([&descriptor_bytes](const std::shared_ptr<vvl::DescriptorSet> &set) {
+        descriptor_bytes += sizeof(vvl::DescriptorSet) + uint64_t(set->GetTotalDescriptorCount()) * sizeof(vvl::ImageDescriptor);
+    });
+    memory_accounting.Set(vvl::profiling::MemorySubsystem::Descriptors, descriptor_bytes);
+}
+
 void DeviceState::DestroyObjectMaps() {
+    // Everything below goes away, the objects do not need to unlink from each other one by one
+    vvl::StateObject::BulkDestroyScope bulk_destroy;
+    // No other thread can be validating with borrowed pointers anymore
+    borrow_reclaimer_.Flush();
     command_pool_map_.clear();
     assert(command_buffer_map_.empty());
     pipeline_map_.clear();
@@ -1056,6 +1089,8 @@ void DeviceState::DestroyObjectMaps() {
     query_pool_map_.clear();
     video_session_map_.clear();
     video_session_parameters_map_.clear();
+    // The command buffers of the pools were retired while the maps were cleared
+    borrow_reclaimer_.Flush();
 }
 
 void DeviceState::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
@@ -1111,17 +1146,17 @@ void DeviceState::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
                                            const RecordObject &record_obj) {
     CheckDebugCapture();
     auto queue_state = Get<Queue>(queue);
-    std::vector<QueueSubmission> submissions;
+    small_vector<QueueSubmission, 1> submissions;
     submissions.reserve(submitCount);
     if (submitCount == 0) {
-        QueueSubmission submission(record_obj.location);
+        QueueSubmission submission = queue_state->NewSubmission(record_obj.location);
         submission.AddFence(Get<Fence>(fence));
         submissions.emplace_back(std::move(submission));
     }
     // Now process each individual submit
     for (uint32_t submit_i = 0; submit_i < submitCount; submit_i++) {
         Location submit_loc = record_obj.location.dot(Struct::VkSubmitInfo, Field::pSubmits, submit_i);
-        QueueSubmission submission(submit_loc);
+        QueueSubmission submission = queue_state->NewSubmission(submit_loc);
         const VkSubmitInfo *submit = &pSubmits[submit_i];
         auto *timeline_info = vku::FindStructInPNextChain<VkTimelineSemaphoreSubmitInfo>(submit->pNext);
         for (uint32_t i = 0; i < submit->waitSemaphoreCount; ++i) {
@@ -1158,7 +1193,7 @@ void DeviceState::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
         submissions.emplace_back(std::move(submission));
     }
 
-    queue_state->PreSubmit(std::move(submissions));
+    queue_state->PreSubmit(submissions);
 }
 
 void DeviceState::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
@@ -1180,17 +1215,17 @@ void DeviceState::PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount,
                                             const RecordObject &record_obj) {
     CheckDebugCapture();
     auto queue_state = Get<Queue>(queue);
-    std::vector<QueueSubmission> submissions;
+    small_vector<QueueSubmission, 1> submissions;
     submissions.reserve(submitCount);
     if (submitCount == 0) {
-        QueueSubmission submission(record_obj.location);
+        QueueSubmission submission = queue_state->NewSubmission(record_obj.location);
         submission.AddFence(Get<Fence>(fence));
         submissions.emplace_back(std::move(submission));
     }
 
     for (uint32_t submit_i = 0; submit_i < submitCount; submit_i++) {
         Location submit_loc = record_obj.location.dot(Struct::VkSubmitInfo2, Field::pSubmits, submit_i);
-        QueueSubmission submission(submit_loc);
+        QueueSubmission submission = queue_state->NewSubmission(submit_loc);
         const VkSubmitInfo2KHR &submit = pSubmits[submit_i];
         for (const VkSemaphoreSubmitInfo &wait_sem_info : make_span(submit.pWaitSemaphoreInfos, submit.waitSemaphoreInfoCount)) {
             auto wait_semaphore = Get<Semaphore>(wait_sem_info.semaphore);
@@ -1215,7 +1250,7 @@ void DeviceState::PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount,
         }
         submissions.emplace_back(std::move(submission));
     }
-    queue_state->PreSubmit(std::move(submissions));
+    queue_state->PreSubmit(submissions);
 }
 
 void DeviceState::PostCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
@@ -1262,7 +1297,6 @@ void DeviceState::PostCallRecordAllocateMemory(VkDevice device, const VkMemoryAl
         // Stop tracking handle at this point. It can not be used for import operations anymore.
         // The map's erase is a no-op for externally created handles that are not tracked here.
         // NOTE: In contrast, the successful import does not transfer ownership of a Win32 handle.
-        WriteLockGuard guard(fd_handle_map_lock_);
         fd_handle_map_.erase(import_memory_fd_info->fd);
     }
     Add(CreateDeviceMemoryState(*pMemory, pAllocateInfo, fake_address, memory_type, memory_heap, std::move(dedicated_binding),
@@ -1275,28 +1309,12 @@ void DeviceState::PreCallRecordFreeMemory(VkDevice device, VkDeviceMemory mem, c
     if (auto mem_info = Get<DeviceMemory>(mem)) {
         fake_memory.Free(mem_info->fake_base_address);
     }
-    {
-        WriteLockGuard guard(fd_handle_map_lock_);
-        for (auto it = fd_handle_map_.begin(); it != fd_handle_map_.end();) {
-            if (it->second.device_memory == mem) {
-                it = fd_handle_map_.erase(it);
-                break;
-            } else {
-                ++it;
-            }
-        }
+    if (!fd_handle_map_.empty()) {
+        fd_handle_map_.erase_if([mem](int, const ExternalOpaqueInfo &info) { return info.device_memory == mem; });
     }
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    {
-        WriteLockGuard guard(win32_handle_map_lock_);
-        for (auto it = win32_handle_map_.begin(); it != win32_handle_map_.end();) {
-            if (it->second.device_memory == mem) {
-                it = win32_handle_map_.erase(it);
-                break;
-            } else {
-                ++it;
-            }
-        }
+    if (!win32_handle_map_.empty()) {
+        win32_handle_map_.erase_if([mem](HANDLE, const ExternalOpaqueInfo &info) { return info.device_memory == mem; });
     }
 #endif
     Destroy<DeviceMemory>(mem);
@@ -1314,29 +1332,31 @@ void DeviceState::PreCallRecordQueueBindSparse(VkQueue queue, uint32_t bindInfoC
                                                VkFence fence, const RecordObject &record_obj) {
     auto queue_state = Get<Queue>(queue);
 
-    std::vector<QueueSubmission> submissions;
+    small_vector<QueueSubmission, 1> submissions;
     submissions.reserve(bindInfoCount);
+    // The binds of a resource are applied together
+    std::vector<SparseMemoryBind> sparse_binds;
+    auto get_sparse_binds = [this, &sparse_binds](uint32_t bind_count, const VkSparseMemoryBind *binds) {
+        sparse_binds.clear();
+        for (uint32_t i = 0; i < bind_count; ++i) {
+            const VkSparseMemoryBind &bind = binds[i];
+            sparse_binds.emplace_back(SparseMemoryBind{{bind.resourceOffset, bind.resourceOffset + bind.size},
+                                                       {Get<DeviceMemory>(bind.memory), bind.memoryOffset, bind.resourceOffset}});
+        }
+    };
     for (uint32_t bind_idx = 0; bind_idx < bindInfoCount; ++bind_idx) {
         const VkBindSparseInfo &bind_info = pBindInfo[bind_idx];
         // Track objects tied to memory
         for (uint32_t j = 0; j < bind_info.bufferBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pBufferBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pBufferBinds[j].pBinds[k];
-                auto memory_state = Get<DeviceMemory>(sparse_binding.memory);
-                if (auto buffer_state = Get<Buffer>(bind_info.pBufferBinds[j].buffer)) {
-                    buffer_state->BindMemory(buffer_state.get(), memory_state, sparse_binding.memoryOffset,
-                                             sparse_binding.resourceOffset, sparse_binding.size);
-                }
+            if (auto buffer_state = Get<Buffer>(bind_info.pBufferBinds[j].buffer)) {
+                get_sparse_binds(bind_info.pBufferBinds[j].bindCount, bind_info.pBufferBinds[j].pBinds);
+                buffer_state->BindSparseMemory(buffer_state.get(), sparse_binds);
             }
         }
         for (uint32_t j = 0; j < bind_info.imageOpaqueBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pImageOpaqueBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pImageOpaqueBinds[j].pBinds[k];
-                auto memory_state = Get<DeviceMemory>(sparse_binding.memory);
-                if (auto image_state = Get<Image>(bind_info.pImageOpaqueBinds[j].image)) {
-                    image_state->BindMemory(image_state.get(), memory_state, sparse_binding.memoryOffset,
-                                            sparse_binding.resourceOffset, sparse_binding.size);
-                }
+            if (auto image_state = Get<Image>(bind_info.pImageOpaqueBinds[j].image)) {
+                get_sparse_binds(bind_info.pImageOpaqueBinds[j].bindCount, bind_info.pImageOpaqueBinds[j].pBinds);
+                image_state->BindSparseMemory(image_state.get(), sparse_binds);
             }
         }
         for (uint32_t j = 0; j < bind_info.imageBindCount; j++) {
@@ -1353,7 +1373,7 @@ void DeviceState::PreCallRecordQueueBindSparse(VkQueue queue, uint32_t bindInfoC
         }
         auto* timeline_info = vku::FindStructInPNextChain<VkTimelineSemaphoreSubmitInfo>(bind_info.pNext);
         Location submit_loc = record_obj.location.dot(Struct::VkBindSparseInfo, Field::pBindInfo, bind_idx);
-        QueueSubmission submission(submit_loc);
+        QueueSubmission submission = queue_state->NewSubmission(submit_loc);
         for (uint32_t i = 0; i < bind_info.waitSemaphoreCount; ++i) {
             auto wait_semaphore = Get<Semaphore>(bind_info.pWaitSemaphores[i]);
             uint64_t value{0};
@@ -1378,7 +1398,7 @@ void DeviceState::PreCallRecordQueueBindSparse(VkQueue queue, uint32_t bindInfoC
         submissions.emplace_back(std::move(submission));
     }
 
-    queue_state->PreSubmit(std::move(submissions));
+    queue_state->PreSubmit(submissions);
 }
 
 void DeviceState::PostCallRecordQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo *pBindInfo,
@@ -1802,7 +1822,7 @@ void DeviceState::PostCallRecordResetCommandPool(VkDevice device, VkCommandPool
     }
     // Reset all of the CBs allocated from this pool
     if (auto pool = Get<CommandPool>(commandPool)) {
-        pool->Reset(record_obj.location);
+        pool->Reset();
     }
 }
 
@@ -1867,6 +1887,18 @@ std::shared_ptr<Pipeline> DeviceState::CreateGraphicsPipelineState(
                                       stateless_data);
 }
 
+void DeviceState::BuildPipelineStates(uint32_t count, const std::function<void(uint32_t)> &build) const {
+    // Below this, starting the loop on the workers costs more than building the pipelines on this thread
+    constexpr uint32_t kMinParallelCount = 8;
+    if (count < kMinParallelCount) {
+        for (uint32_t i = 0; i < count; ++i) {
+            build(i);
+        }
+    } else {
+        pipeline_build_pool.ParallelFor(count, build);
+    }
+}
+
 // PreCallValidate used here to have a single global spot to build the vvl::Pipeline object so we can use it right away
 bool DeviceState::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                                          const VkGraphicsPipelineCreateInfo *pCreateInfos,
@@ -1875,9 +1907,9 @@ bool DeviceState::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipe
                                                          chassis::CreateGraphicsPipelines &chassis_state) const {
     bool skip = false;
     // Set up the state that CoreChecks, gpu_validation and later StateTracker Record will use.
-    pipeline_states.reserve(count);
+    pipeline_states.resize(count);
     auto pipeline_cache = Get<PipelineCache>(pipelineCache);
-    for (uint32_t i = 0; i < count; i++) {
+    BuildPipelineStates(count, [&](uint32_t i) {
         const auto &create_info = pCreateInfos[i];
         auto layout_state = Get<PipelineLayout>(create_info.layout);
         std::shared_ptr<const RenderPass> render_pass;
@@ -1896,9 +1928,11 @@ bool DeviceState::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipe
 
             render_pass = std::make_shared<RenderPass>(pipeline_rendering_ci, rasterization_enabled);
         }
-        pipeline_states.push_back(CreateGraphicsPipelineState(&create_info, pipeline_cache, std::move(render_pass),
-                                                              std::move(layout_state), chassis_state.stateless_data));
-    }
+        // Only the first pipeline is checked with the stateless data (see CoreChecks::PreCallValidateCreateGraphicsPipelines)
+        pipeline_states[i] =
+            CreateGraphicsPipelineState(&create_info, pipeline_cache, std::move(render_pass), std::move(layout_state),
+                                        i == 0 ? chassis_state.stateless_data : nullptr);
+    });
     return skip;
 }
 
@@ -1932,13 +1966,14 @@ bool DeviceState::PreCallValidateCreateComputePipelines(VkDevice device, VkPipel
                                                         const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                         const ErrorObject &error_obj, PipelineStates &pipeline_states,
                                                         chassis::CreateComputePipelines &chassis_state) const {
-    pipeline_states.reserve(count);
+    pipeline_states.resize(count);
     auto pipeline_cache = Get<PipelineCache>(pipelineCache);
-    for (uint32_t i = 0; i < count; i++) {
+    BuildPipelineStates(count, [&](uint32_t i) {
         // Create and initialize internal tracking data structure
-        pipeline_states.push_back(CreateComputePipelineState(
-            &pCreateInfos[i], pipeline_cache, Get<PipelineLayout>(pCreateInfos[i].layout), &chassis_state.stateless_data));
-    }
+        // Only the first pipeline is checked with the stateless data (see CoreChecks::PreCallValidateCreateComputePipelines)
+        pipeline_states[i] = CreateComputePipelineState(&pCreateInfos[i], pipeline_cache, Get<PipelineLayout>(pCreateInfos[i].layout),
+                                                        i == 0 ? &chassis_state.stateless_data : nullptr);
+    });
     return false;
 }
 
@@ -1972,13 +2007,13 @@ bool DeviceState::PreCallValidateCreateRayTracingPipelinesNV(VkDevice device, Vk
                                                              const VkRayTracingPipelineCreateInfoNV *pCreateInfos,
                                                              const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                              const ErrorObject &error_obj, PipelineStates &pipeline_states) const {
-    pipeline_states.reserve(count);
+    pipeline_states.resize(count);
     auto pipeline_cache = Get<PipelineCache>(pipelineCache);
-    for (uint32_t i = 0; i < count; i++) {
+    BuildPipelineStates(count, [&](uint32_t i) {
         // Create and initialize internal tracking data structure
-        pipeline_states.push_back(
-            CreateRayTracingPipelineState(&pCreateInfos[i], pipeline_cache, Get<PipelineLayout>(pCreateInfos[i].layout), nullptr));
-    }
+        pipeline_states[i] =
+            CreateRayTracingPipelineState(&pCreateInfos[i], pipeline_cache, Get<PipelineLayout>(pCreateInfos[i].layout), nullptr);
+    });
     return false;
 }
 
@@ -2013,13 +2048,13 @@ bool DeviceState::PreCallValidateCreateRayTracingPipelinesKHR(VkDevice device, V
                                                               const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                               const ErrorObject &error_obj, PipelineStates &pipeline_states,
                                                               chassis::CreateRayTracingPipelinesKHR &chassis_state) const {
-    pipeline_states.reserve(count);
+    pipeline_states.resize(count);
     auto pipeline_cache = Get<PipelineCache>(pipelineCache);
-    for (uint32_t i = 0; i < count; i++) {
+    BuildPipelineStates(count, [&](uint32_t i) {
         // Create and initialize internal tracking data structure
-        pipeline_states.push_back(
-            CreateRayTracingPipelineState(&pCreateInfos[i], pipeline_cache, Get<PipelineLayout>(pCreateInfos[i].layout), nullptr));
-    }
+        pipeline_states[i] =
+            CreateRayTracingPipelineState(&pCreateInfos[i], pipeline_cache, Get<PipelineLayout>(pCreateInfos[i].layout), nullptr);
+    });
     return false;
 }
 
@@ -2076,7 +2111,7 @@ void DeviceState::PostCallRecordCreateSampler(VkDevice device, const VkSamplerCr
         return;
     }
 
-    Add(std::make_shared<Sampler>(*pSampler, pCreateInfo));
+    Add(MakePooled<Sampler>("vvl::Sampler", *pSampler, pCreateInfo));
     if (pCreateInfo->borderColor == VK_BORDER_COLOR_INT_CUSTOM_EXT ||
         pCreateInfo->borderColor == VK_BORDER_COLOR_FLOAT_CUSTOM_EXT) {
         custom_border_color_sampler_count++;
@@ -2109,7 +2144,7 @@ std::shared_ptr<DescriptorPool> DeviceState::CreateDescriptorPoolState(VkDescrip
 std::shared_ptr<DescriptorSet> DeviceState::CreateDescriptorSet(VkDescriptorSet handle, DescriptorPool *pool,
                                                                 const std::shared_ptr<DescriptorSetLayout const> &layout,
                                                                 uint32_t variable_count) {
-    return std::make_shared<DescriptorSet>(handle, pool, layout, variable_count, this);
+    return MakePooled<DescriptorSet>("vvl::DescriptorSet", handle, pool, layout, variable_count, this);
 }
 std::shared_ptr<vvl::DescriptorSet> DeviceState::CreatePushDescriptorSet(
     const std::shared_ptr<vvl::DescriptorSetLayout const> &layout) {
@@ -2402,7 +2437,22 @@ void DeviceState::PostCallRecordCreateAccelerationStructureKHR(VkDevice device,
         return;
     }
     auto buffer_state = Get<Buffer>(pCreateInfo->buffer);
-    Add(CreateAccelerationStructureState(*pAccelerationStructure, pCreateInfo, std::move(buffer_state)));
+    auto as_state = CreateAccelerationStructureState(*pAccelerationStructure, pCreateInfo, std::move(buffer_state));
+    vvl::range<VkDeviceAddress> address_range;
+    if (as_state->buffer_state && (as_state->buffer_state->deviceAddress != 0 || as_state->buffer_device_address != 0)) {
+        address_range = as_state->GetDeviceAddressRange();
+    }
+    AddAccelerationStructureAddressRange(*as_state, address_range);
+    Add(std::move(as_state));
+}
+
+void DeviceState::PostCallRecordGetAccelerationStructureDeviceAddressKHR(VkDevice device,
+                                                                         const VkAccelerationStructureDeviceAddressInfoKHR *pInfo,
+                                                                         const RecordObject &record_obj) {
+    if (record_obj.device_address == 0) return;
+    if (auto as_state = Get<AccelerationStructureKHR>(pInfo->accelerationStructure)) {
+        AddAccelerationStructureAddressRange(*as_state, {record_obj.device_address, record_obj.device_address + 1});
+    }
 }
 
 void DeviceState::PostCallRecordBuildAccelerationStructuresKHR(
@@ -2587,6 +2637,9 @@ void DeviceState::PostCallRecordCmdCopyAccelerationStructureNV(VkCommandBuffer c
 void DeviceState::PreCallRecordDestroyAccelerationStructureKHR(VkDevice device, VkAccelerationStructureKHR accelerationStructure,
                                                                const VkAllocationCallbacks *pAllocator,
                                                                const RecordObject &record_obj) {
+    if (auto as_state = Get<AccelerationStructureKHR>(accelerationStructure)) {
+        RemoveAccelerationStructureAddressRanges(*as_state);
+    }
     Destroy<AccelerationStructureKHR>(accelerationStructure);
 }
 
@@ -2862,6 +2915,7 @@ void DeviceState::PostCallRecordCmdPushConstants2KHR(VkCommandBuffer commandBuff
 void DeviceState::PostCallRecordCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                    VkIndexType indexType, const RecordObject &record_obj) {
     auto cb_state = GetWrite<CommandBuffer>(commandBuffer);
+    cb_state->graphics_state_change_count++;
     if (buffer == VK_NULL_HANDLE) {
         if (enabled_features.maintenance6) {
             cb_state->index_buffer_binding.bound = true;
@@ -2884,6 +2938,7 @@ void DeviceState::PostCallRecordCmdBindIndexBuffer(VkCommandBuffer commandBuffer
 void DeviceState::PostCallRecordCmdBindIndexBuffer2(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                     VkDeviceSize size, VkIndexType indexType, const RecordObject &record_obj) {
     auto cb_state = GetWrite<CommandBuffer>(commandBuffer);
+    cb_state->graphics_state_change_count++;
     if (buffer == VK_NULL_HANDLE) {
         if (enabled_features.maintenance6) {
             cb_state->index_buffer_binding.bound = true;
@@ -2910,6 +2965,7 @@ void DeviceState::PostCallRecordCmdBindVertexBuffers(VkCommandBuffer commandBuff
                                                      const VkBuffer *pBuffers, const VkDeviceSize *pOffsets,
                                                      const RecordObject &record_obj) {
     auto cb_state = GetWrite<CommandBuffer>(commandBuffer);
+    cb_state->graphics_state_change_count++;
     cb_state->command_count++;
 
     for (uint32_t i = 0; i < bindingCount; ++i) {
@@ -3267,6 +3323,7 @@ void DeviceState::PostCallRecordCmdBeginTransformFeedbackEXT(VkCommandBuffer com
                                                              const VkDeviceSize *pCounterBufferOffsets,
                                                              const RecordObject &record_obj) {
     auto cb_state = GetWrite<CommandBuffer>(commandBuffer);
+    cb_state->graphics_state_change_count++;
 
     cb_state->command_count++;
     cb_state->transform_feedback_active = true;
@@ -3277,6 +3334,7 @@ void DeviceState::PostCallRecordCmdEndTransformFeedbackEXT(VkCommandBuffer comma
                                                            const VkDeviceSize *pCounterBufferOffsets,
                                                            const RecordObject &record_obj) {
     auto cb_state = GetWrite<CommandBuffer>(commandBuffer);
+    cb_state->graphics_state_change_count++;
 
     cb_state->command_count++;
     cb_state->transform_feedback_active = false;
@@ -3569,14 +3627,12 @@ void DeviceState::PostCallRecordGetSemaphoreFdKHR(VkDevice device, const VkSemap
         return;
     }
     if (auto semaphore_state = Get<Semaphore>(pGetFdInfo->semaphore)) {
-        // Record before locking with the WriteLockGuard
         RecordGetExternalSemaphoreState(*semaphore_state, pGetFdInfo->handleType);
 
         ExternalOpaqueInfo external_info = {};
         external_info.semaphore_flags = semaphore_state->flags;
         external_info.semaphore_type = semaphore_state->type;
 
-        WriteLockGuard guard(fd_handle_map_lock_);
         fd_handle_map_.insert_or_assign(*pFd, external_info);
     }
 }
@@ -3603,7 +3659,6 @@ void DeviceState::PostCallRecordGetMemoryWin32HandleKHR(VkDevice device, const V
         external_info.dedicated_image = memory_state->GetDedicatedImage();
         external_info.device_memory = pGetWin32HandleInfo->memory;
 
-        WriteLockGuard guard(win32_handle_map_lock_);
         // `insert_or_assign` ensures that information is updated when the system decides to re-use
         // closed handle value for a new handle. The validation layer does not track handle close operation
         // which is performed by 'CloseHandle' system call.
@@ -3627,7 +3682,6 @@ void DeviceState::PostCallRecordGetMemoryFdKHR(VkDevice device, const VkMemoryGe
         external_info.dedicated_image = memory_state->GetDedicatedImage();
         external_info.device_memory = memory_state->VkHandle();
 
-        WriteLockGuard guard(fd_handle_map_lock_);
         // `insert_or_assign` ensures that information is updated when the system decides to re-use
         // closed handle value for a new handle. The fd handle created inside Vulkan _can_ be closed
         // using the 'close' system call, which is not tracked by the validation layer.
@@ -3665,7 +3719,7 @@ void DeviceState::PostCallRecordCreateEvent(VkDevice device, const VkEventCreate
     if (record_obj.result != VK_SUCCESS) {
         return;
     }
-    Add(std::make_shared<Event>(*pEvent, pCreateInfo));
+    Add(std::make_shared<Event>(*pEvent, pCreateInfo, event_index_allocator_));
 }
 
 void DeviceState::RecordCreateSwapchainState(VkResult result, const VkSwapchainCreateInfoKHR *pCreateInfo,
@@ -3768,9 +3822,10 @@ void DeviceState::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresentIn
     const Location present_loc = record_obj.location.dot(Field::pPresentInfo);
     const auto *present_fence_info = vku::FindStructInPNextChain<VkSwapchainPresentFenceInfoKHR>(pPresentInfo->pNext);
 
-    std::vector<QueueSubmission> present_submissions;  // TODO: use small_vector. Update interfaces to use span
+    auto queue_state = Get<Queue>(queue);
+    small_vector<QueueSubmission, 1> present_submissions;
     for (uint32_t i = 0; i < pPresentInfo->swapchainCount; ++i) {
-        present_submissions.emplace_back(present_loc.dot(Field::pSwapchains, i));
+        present_submissions.emplace_back(queue_state->NewSubmission(present_loc.dot(Field::pSwapchains, i)));
         if (present_fence_info) {
             present_submissions.back().AddFence(Get<Fence>(present_fence_info->pFences[i]));
         }
@@ -3833,9 +3888,8 @@ void DeviceState::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresentIn
         }
     }
 
-    auto queue_state = Get<Queue>(queue);
     queue_state->is_used_for_presentation = true;
-    PreSubmitResult result = queue_state->PreSubmit(std::move(present_submissions));
+    PreSubmitResult result = queue_state->PreSubmit(present_submissions);
     const SubmissionReference present_submission_ref(queue_state.get(), result.submission_seq);
 
     if (!queue_state->is_used_for_regular_submits) {
@@ -4428,7 +4482,16 @@ void DeviceState::PostCallRecordCreateDescriptorUpdateTemplate(VkDevice device,
     if (record_obj.result != VK_SUCCESS) {
         return;
     }
-    Add(std::make_shared<DescriptorUpdateTemplate>(*pDescriptorUpdateTemplate, pCreateInfo));
+    // The layout the writes are planned for
+    std::shared_ptr<const DescriptorSetLayout> layout;
+    if (pCreateInfo->templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET) {
+        layout = Get<DescriptorSetLayout>(pCreateInfo->descriptorSetLayout);
+    } else if (auto pipeline_layout = Get<PipelineLayout>(pCreateInfo->pipelineLayout)) {
+        if (pCreateInfo->set < pipeline_layout->set_layouts.size()) {
+            layout = pipeline_layout->set_layouts[pCreateInfo->set];
+        }
+    }
+    Add(std::make_shared<DescriptorUpdateTemplate>(*pDescriptorUpdateTemplate, pCreateInfo, layout.get()));
 }
 
 void DeviceState::PostCallRecordCreateDescriptorUpdateTemplateKHR(VkDevice device,
@@ -4470,7 +4533,7 @@ void DeviceState::PostCallRecordCmdPushDescriptorSetWithTemplate(VkCommandBuffer
     cb_state->command_count++;
     auto dsl = pipeline_layout->set_layouts[set];
     // Decode the template into a set of write updates
-    DecodedTemplateUpdate decoded_template(*this, VK_NULL_HANDLE, *template_state, pData, dsl->VkHandle());
+    DecodedTemplateUpdate decoded_template(VK_NULL_HANDLE, *template_state, pData, dsl.get());
     cb_state->PushDescriptorSetState(template_state->create_info.pipelineBindPoint, pipeline_layout, set,
                                      static_cast<uint32_t>(decoded_template.desc_writes.size()),
                                      decoded_template.desc_writes.data(), record_obj.location);
@@ -4496,8 +4559,7 @@ void DeviceState::PostCallRecordCmdPushDescriptorSetWithTemplate2(
     cb_state->command_count++;
     auto dsl = pipeline_layout->set_layouts[pPushDescriptorSetWithTemplateInfo->set];
     // Decode the template into a set of write updates
-    DecodedTemplateUpdate decoded_template(*this, VK_NULL_HANDLE, *template_state, pPushDescriptorSetWithTemplateInfo->pData,
-                                           dsl->VkHandle());
+    DecodedTemplateUpdate decoded_template(VK_NULL_HANDLE, *template_state, pPushDescriptorSetWithTemplateInfo->pData, dsl.get());
     cb_state->PushDescriptorSetState(
         template_state->create_info.pipelineBindPoint, pipeline_layout, pPushDescriptorSetWithTemplateInfo->set,
         static_cast<uint32_t>(decoded_template.desc_writes.size()), decoded_template.desc_writes.data(), record_obj.location);
@@ -4658,24 +4720,19 @@ void DeviceState::PostCallRecordResetQueryPool(VkDevice device, VkQueryPool quer
     ASSERT_AND_RETURN(query_pool_state);
 
     // Reset the state of existing entries.
+    // Resetting a query resets all of its performance passes
     const uint32_t max_query_count = std::min(queryCount, query_pool_state->create_info.queryCount - firstQuery);
-    for (uint32_t i = 0; i < max_query_count; ++i) {
-        auto query_index = firstQuery + i;
-        query_pool_state->SetQueryState(query_index, 0, QUERYSTATE_RESET);
-        if (query_pool_state->create_info.queryType == VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR) {
-            for (uint32_t pass_index = 0; pass_index < query_pool_state->n_performance_passes; pass_index++) {
-                query_pool_state->SetQueryState(query_index, pass_index, QUERYSTATE_RESET);
-            }
-        }
-    }
+    query_pool_state->SetQueryStates(firstQuery, max_query_count, 0, QUERYSTATE_RESET);
 }
 
 void DeviceState::PerformUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet,
                                                              const DescriptorUpdateTemplate &template_state, const void *pData) {
-    // Translate the templated update into a normal update for validation...
-    DecodedTemplateUpdate decoded_template(*this, descriptorSet, template_state, pData);
-    PerformUpdateDescriptorSets(static_cast<uint32_t>(decoded_template.desc_writes.size()), decoded_template.desc_writes.data(), 0,
-                                NULL);
+    // All the writes are to the same set, it is only looked up and invalidated once
+    if (auto set_node = Get<DescriptorSet>(descriptorSet)) {
+        DecodedTemplateUpdate decoded_template(descriptorSet, template_state, pData);
+        set_node->PerformWriteUpdates(static_cast<uint32_t>(decoded_template.desc_writes.size()),
+                                      decoded_template.desc_writes.data());
+    }
 }
 
 void DeviceState::PostCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
@@ -4908,6 +4965,61 @@ void DeviceState::PostCallRecordCmdExecuteGeneratedCommandsEXT(VkCommandBuffer c
     } else if (bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR) {
         cb_state->RecordTraceRay(record_obj.location.function);
     }
+    // The indirect commands can bind their own pipelines, shaders and buffers
+    cb_state->graphics_state_change_count++;
+}
+
+std::shared_ptr<spirv::Module> DeviceState::CreateSpirvModule(size_t code_size, const uint32_t *code,
+                                                              spirv::StatelessData *stateless_data) const {
+    const bool valid_spirv = code && code[0] == spv::MagicNumber && ((code_size % 4) == 0);
+    if (!valid_spirv) {
+        return std::make_shared<spirv::Module>(code_size, code, stateless_data);
+    }
+    const size_t word_count = code_size / sizeof(uint32_t);
+    const uint64_t key = hash_util::Hash64(code, code_size);
+
+    {
+        std::unique_lock<std::mutex> guard(spirv_module_data_map_lock_);
+        auto it = spirv_module_data_map_.find(key);
+        if (it != spirv_module_data_map_.end()) {
+            std::shared_ptr<spirv::ModuleData> data = it->second.lock();
+            // The StatelessData can only be given if it was kept
+            if (data && (!stateless_data || data->stateless_data) && data->words.size() == word_count &&
+                std::equal(data->words.begin(), data->words.end(), code)) {
+                guard.unlock();
+                if (stateless_data) {
+                    *stateless_data = *data->stateless_data;
+                }
+                return std::make_shared<spirv::Module>(std::move(data));
+            }
+        }
+    }
+
+    auto module_state = std::make_shared<spirv::Module>(code_size, code, stateless_data);
+    // The parsing stopped early, the caller will reparse a flattened version of the code
+    if (stateless_data && stateless_data->has_group_decoration) {
+        return module_state;
+    }
+    // Nothing else refers to the data yet
+    module_state->data_->code_hash.store(key, std::memory_order_relaxed);
+    if (stateless_data) {
+        module_state->data_->stateless_data = *stateless_data;
+        module_state->data_->stateless_data->pipeline_pnext_module.reset();
+    }
+
+    std::unique_lock<std::mutex> guard(spirv_module_data_map_lock_);
+    spirv_module_data_map_[key] = module_state->data_;
+    if (spirv_module_data_map_.size() >= spirv_module_data_sweep_size_) {
+        for (auto it = spirv_module_data_map_.begin(); it != spirv_module_data_map_.end();) {
+            if (it->second.expired()) {
+                it = spirv_module_data_map_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        spirv_module_data_sweep_size_ = std::max<size_t>(64, spirv_module_data_map_.size() * 2);
+    }
+    return module_state;
 }
 
 void DeviceState::PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
@@ -4921,8 +5033,7 @@ void DeviceState::PreCallRecordCreateShaderModule(VkDevice device, const VkShade
         return;
     }
 
-    chassis_state.module_state =
-        std::make_shared<spirv::Module>(pCreateInfo->codeSize, pCreateInfo->pCode, &chassis_state.stateless_data);
+    chassis_state.module_state = CreateSpirvModule(pCreateInfo->codeSize, pCreateInfo->pCode, &chassis_state.stateless_data);
     if (chassis_state.module_state && chassis_state.stateless_data.has_group_decoration) {
         spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(extensions.vk_khr_spirv_1_4));
         spvtools::Optimizer optimizer(spirv_environment);
@@ -4952,8 +5063,8 @@ void DeviceState::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t create
             continue;
         }
         // don't need to worry about GroupDecoration with VK_EXT_shader_object
-        chassis_state.module_states[i] = std::make_shared<spirv::Module>(
-            create_info.codeSize, static_cast<const uint32_t *>(create_info.pCode), &chassis_state.stateless_data[i]);
+        chassis_state.module_states[i] = CreateSpirvModule(create_info.codeSize, static_cast<const uint32_t *>(create_info.pCode),
+                                                           &chassis_state.stateless_data[i]);
     }
 }
 
@@ -5127,6 +5238,7 @@ void DeviceState::PostCallRecordCmdBindVertexBuffers2(VkCommandBuffer commandBuf
                                                       const VkDeviceSize *pSizes, const VkDeviceSize *pStrides,
                                                       const RecordObject &record_obj) {
     auto cb_state = GetWrite<CommandBuffer>(commandBuffer);
+    cb_state->graphics_state_change_count++;
     if (pStrides) {
         cb_state->RecordStateCmd(CB_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE);
     }
@@ -5330,6 +5442,7 @@ void DeviceState::PostCallRecordCmdSetRenderingAttachmentLocations(VkCommandBuff
                                                                    const VkRenderingAttachmentLocationInfo *pLocationInfo,
                                                                    const RecordObject &record_obj) {
     auto cb_state = GetWrite<CommandBuffer>(commandBuffer);
+    cb_state->graphics_state_change_count++;
 
     cb_state->rendering_attachments.set_color_locations = true;
     cb_state->rendering_attachments.color_locations.resize(pLocationInfo->colorAttachmentCount);
@@ -5719,16 +5832,14 @@ void DeviceState::PostCallRecordGetShaderModuleIdentifierEXT(VkDevice, const VkS
                                                              VkShaderModuleIdentifierEXT *pIdentifier,
                                                              const RecordObject &record_obj) {
     if (const auto shader_state = Get<ShaderModule>(shaderModule); shader_state) {
-        WriteLockGuard guard(shader_identifier_map_lock_);
-        shader_identifier_map_.emplace(*pIdentifier, std::move(shader_state));
+        shader_identifier_map_.insert(*pIdentifier, std::move(shader_state));
     }
 }
 
 void DeviceState::PostCallRecordGetShaderModuleCreateInfoIdentifierEXT(VkDevice, const VkShaderModuleCreateInfo *pCreateInfo,
                                                                        VkShaderModuleIdentifierEXT *pIdentifier,
                                                                        const RecordObject &record_obj) {
-    WriteLockGuard guard(shader_identifier_map_lock_);
-    shader_identifier_map_.emplace(*pIdentifier, std::make_shared<ShaderModule>());
+    shader_identifier_map_.insert(*pIdentifier, std::make_shared<ShaderModule>());
 }
 
 void DeviceState::PostCallRecordGetBufferDeviceAddress(VkDevice device, const VkBufferDeviceAddressInfo *pInfo,
@@ -5743,6 +5854,173 @@ void DeviceState::PostCallRecordGetBufferDeviceAddress(VkDevice device, const Vk
         BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
         sparse_container::infill_update_range(buffer_address_map_, address_range, ops);
         buffer_device_address_ranges_version++;
+        InvalidateBufferAddressSnapshot();
+    }
+}
+
+DeviceState::BufferAddressMapStore DeviceState::GetBuffersByAddress(VkDeviceAddress address) const {
+    // std::atomic<std::shared_ptr> is C++20, and std::atomic_load() of a shared_ptr takes a lock in most implementations.
+    // Instead every thread keeps the last snapshot it read, and only locks when the published id is not the one it has.
+    struct SnapshotCache {
+        uint64_t id = 0;
+        std::shared_ptr<const BufferAddressSnapshot> snapshot;
+    };
+    thread_local SnapshotCache cache;
+
+    const uint64_t id = buffer_address_snapshot_id_.load(std::memory_order_acquire);
+    if (id == 0 || id != cache.id) {
+        // Ids are unique across devices, a thread can not mistake the snapshot of another device for this one
+        static std::atomic<uint64_t> next_snapshot_id{1};
+        {
+            ReadLockGuard guard(buffer_address_lock_);
+            cache.id = buffer_address_snapshot_id_.load(std::memory_order_relaxed);
+            cache.snapshot = buffer_address_snapshot_;
+        }
+        if (cache.id == 0) {
+            WriteLockGuard guard(buffer_address_lock_);
+            // Another reader can have rebuilt it in between
+            if (buffer_address_snapshot_id_.load(std::memory_order_relaxed) == 0) {
+                auto snapshot = std::make_shared<BufferAddressSnapshot>();
+                snapshot->begins.reserve(buffer_address_map_.size());
+                snapshot->ends.reserve(buffer_address_map_.size());
+                snapshot->buffers.reserve(buffer_address_map_.size());
+                for (const auto &[range, buffers] : buffer_address_map_) {
+                    snapshot->begins.emplace_back(range.begin);
+                    snapshot->ends.emplace_back(range.end);
+                    snapshot->buffers.emplace_back(buffers);
+                }
+                buffer_address_snapshot_ = std::move(snapshot);
+                buffer_address_snapshot_id_.store(next_snapshot_id.fetch_add(1, std::memory_order_relaxed),
+                                                  std::memory_order_release);
+            }
+            cache.id = buffer_address_snapshot_id_.load(std::memory_order_relaxed);
+            cache.snapshot = buffer_address_snapshot_;
+        }
+    }
+
+    const BufferAddressSnapshot &snapshot = *cache.snapshot;
+    auto it = std::upper_bound(snapshot.begins.begin(), snapshot.begins.end(), address);
+    if (it == snapshot.begins.begin()) {
+        return {};
+    }
+    const size_t index = static_cast<size_t>(std::distance(snapshot.begins.begin(), it)) - 1;
+    if (address >= snapshot.ends[index]) {
+        return {};
+    }
+    return snapshot.buffers[index];
+}
+
+void DeviceState::AddAccelerationStructureAddressRange(const AccelerationStructureKHR &as_state,
+                                                      vvl::range<VkDeviceAddress> address_range) {
+    WriteLockGuard guard(acceleration_structure_address_lock_);
+    auto [it, inserted] = acceleration_structure_address_ranges_.try_emplace(&as_state);
+    AccelerationStructureAddressRanges &ranges = it->second;
+    if (address_range.empty()) {
+        // Created on a buffer without a known address
+        if (inserted) {
+            unknown_address_acceleration_structure_count_.fetch_add(1, std::memory_order_acq_rel);
+        }
+        return;
+    }
+    for (const auto &range : ranges) {
+        if (range.includes(address_range.begin)) {
+            return;
+        }
+    }
+    if (!inserted && ranges.empty()) {
+        unknown_address_acceleration_structure_count_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    ranges.emplace_back(address_range);
+    acceleration_structure_address_snapshot_id_.store(0, std::memory_order_release);
+}
+
+void DeviceState::RemoveAccelerationStructureAddressRanges(const AccelerationStructureKHR &as_state) {
+    WriteLockGuard guard(acceleration_structure_address_lock_);
+    auto it = acceleration_structure_address_ranges_.find(&as_state);
+    if (it == acceleration_structure_address_ranges_.end()) {
+        return;
+    }
+    if (it->second.empty()) {
+        unknown_address_acceleration_structure_count_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    acceleration_structure_address_ranges_.erase(it);
+    acceleration_structure_address_snapshot_id_.store(0, std::memory_order_release);
+}
+
+const AccelerationStructureKHR *DeviceState::AccelerationStructureAddressSnapshot::Find(VkDeviceAddress address) const {
+    auto it = std::upper_bound(begins.begin(), begins.end(), address);
+    // Walk back over the ranges starting at or before the address while one of them can still reach past it
+    for (size_t i = static_cast<size_t>(std::distance(begins.begin(), it)); i > 0 && max_ends[i - 1] > address; --i) {
+        if (address < ends[i - 1]) {
+            return acceleration_structures[i - 1];
+        }
+    }
+    return nullptr;
+}
+
+const DeviceState::AccelerationStructureAddressSnapshot &DeviceState::GetAccelerationStructureAddressSnapshot() const {
+    // Same scheme as GetBuffersByAddress()
+    struct SnapshotCache {
+        uint64_t id = 0;
+        std::shared_ptr<const AccelerationStructureAddressSnapshot> snapshot;
+    };
+    thread_local SnapshotCache cache;
+
+    const uint64_t id = acceleration_structure_address_snapshot_id_.load(std::memory_order_acquire);
+    if (id == 0 || id != cache.id) {
+        static std::atomic<uint64_t> next_snapshot_id{1};
+        {
+            ReadLockGuard guard(acceleration_structure_address_lock_);
+            cache.id = acceleration_structure_address_snapshot_id_.load(std::memory_order_relaxed);
+            cache.snapshot = acceleration_structure_address_snapshot_;
+        }
+        if (cache.id == 0) {
+            WriteLockGuard guard(acceleration_structure_address_lock_);
+            if (acceleration_structure_address_snapshot_id_.load(std::memory_order_relaxed) == 0) {
+                std::vector<std::pair<vvl::range<VkDeviceAddress>, const AccelerationStructureKHR *>> sorted;
+                sorted.reserve(acceleration_structure_address_ranges_.size());
+                for (const auto &[as_state, address_ranges] : acceleration_structure_address_ranges_) {
+                    for (const auto &address_range : address_ranges) {
+                        sorted.emplace_back(address_range, as_state);
+                    }
+                }
+                std::sort(sorted.begin(), sorted.end(),
+                          [](const auto &a, const auto &b) { return a.first.begin < b.first.begin; });
+
+                auto snapshot = std::make_shared<AccelerationStructureAddressSnapshot>();
+                snapshot->begins.reserve(sorted.size());
+                snapshot->ends.reserve(sorted.size());
+                snapshot->max_ends.reserve(sorted.size());
+                snapshot->acceleration_structures.reserve(sorted.size());
+                VkDeviceAddress max_end = 0;
+                for (const auto &[address_range, as_state] : sorted) {
+                    max_end = std::max(max_end, address_range.end);
+                    snapshot->begins.emplace_back(address_range.begin);
+                    snapshot->ends.emplace_back(address_range.end);
+                    snapshot->max_ends.emplace_back(max_end);
+                    snapshot->acceleration_structures.emplace_back(as_state);
+                }
+                acceleration_structure_address_snapshot_ = std::move(snapshot);
+                acceleration_structure_address_snapshot_id_.store(next_snapshot_id.fetch_add(1, std::memory_order_relaxed),
+                                                                  std::memory_order_release);
+            }
+            cache.id = acceleration_structure_address_snapshot_id_.load(std::memory_order_relaxed);
+            cache.snapshot = acceleration_structure_address_snapshot_;
+        }
+    }
+    return *cache.snapshot;
+}
+
+const AccelerationStructureKHR *DeviceState::GetAccelerationStructureByAddress(VkDeviceAddress address) const {
+    return GetAccelerationStructureAddressSnapshot().Find(address);
+}
+
+void DeviceState::GetAccelerationStructuresByAddresses(vvl::span<const VkDeviceAddress> addresses,
+                                                       vvl::span<const AccelerationStructureKHR *> acceleration_structures) const {
+    assert(addresses.size() == acceleration_structures.size());
+    const AccelerationStructureAddressSnapshot &snapshot = GetAccelerationStructureAddressSnapshot();
+    for (size_t i = 0; i < addresses.size(); ++i) {
+        acceleration_structures[i] = snapshot.Find(addresses[i]);
     }
 }
 
@@ -5780,6 +6058,7 @@ void DeviceState::PostCallRecordCmdBindTransformFeedbackBuffersEXT(VkCommandBuff
                                                                    const VkDeviceSize *pOffsets, const VkDeviceSize *pSizes,
                                                                    const RecordObject &record_obj) {
     auto cb_state = GetWrite<CommandBuffer>(commandBuffer);
+    cb_state->graphics_state_change_count++;
     cb_state->transform_feedback_buffers_bound = bindingCount;
 }
 
@@ -24,11 +24,16 @@
 #include "utils/hash_vk_types.h"
 #include "state_tracker/video_session_state.h"  // TODO - Remove from this header
 #include "state_tracker/special_supported.h"
+#include "state_tracker/queue_retire_scheduler.h"
+#include "utils/task_pool.h"
 #include "device_state.h"
 #include "chassis/dispatch_object.h"
 #include "error_message/logging.h"
 #include "containers/span.h"
 #include "containers/custom_containers.h"
+#include "containers/epoch_reclaimer.h"
+#include "containers/state_object_map.h"
+#include "containers/sharded_map.h"
 #include "utils/android_ndk_types.h"
 #include "utils/vk_api_utils.h"
 #include "containers/range_map.h"
@@ -85,15 +90,28 @@ struct CreateShaderModule;
 
 namespace spirv {
 struct StatelessData;
+struct Module;
+struct ModuleData;
 }  // namespace spirv
 
-#define VALSTATETRACK_MAP_AND_TRAITS(handle_type, state_type, map_member)                 \
-    vvl::concurrent_unordered_map<handle_type, std::shared_ptr<state_type>> map_member;   \
-    template <typename Dummy>                                                             \
-    struct MapTraits<state_type, Dummy> {                                                 \
-        static constexpr bool kInstanceScope = false;                                     \
-        using MapType = decltype(map_member);                                             \
-        static MapType vvl::DeviceState::*Map() { return &vvl::DeviceState::map_member; } \
+// With handle wrapping, the state of non-dispatchable handles is found through the index kept in the HandleSlab of the device
+// that unwraps them, see StateObjectMap
+template <typename HandleType>
+vvl::HandleSlab* StateObjectMapSlab(vvl::dispatch::Device* dispatch_device) {
+    constexpr bool kDispatchable = std::is_same_v<HandleType, VkQueue> || std::is_same_v<HandleType, VkCommandBuffer>;
+    if (kDispatchable || !vvl::dispatch::HandleWrapper::wrap_handles) {
+        return nullptr;
+    }
+    return &dispatch_device->unique_id_mapping;
+}
+
+#define VALSTATETRACK_MAP_AND_TRAITS(handle_type, state_type, map_member)                                                        \
+    vvl::StateObjectMap<handle_type, std::shared_ptr<state_type>> map_member{StateObjectMapSlab<handle_type>(dispatch_device_)}; \
+    template <typename Dummy>                                                                                                    \
+    struct MapTraits<state_type, Dummy> {                                                                                        \
+        static constexpr bool kInstanceScope = false;                                                                            \
+        using MapType = decltype(map_member);                                                                                    \
+        static MapType vvl::DeviceState::*Map() { return &vvl::DeviceState::map_member; }                                        \
     };
 
 #define VALSTATETRACK_MAP_AND_TRAITS_INSTANCE_SCOPE(handle_type, state_type, map_member)      \
@@ -504,7 +522,7 @@ struct HasSubStates<State,
                     typename std::enable_if_t<std::is_member_function_pointer_v<decltype(&State::SetSubState)>>>
         : std::true_type {};
 
-class DeviceState : public vvl::base::Device {
+class DeviceState final : public vvl::base::Device {
     using Func = vvl::Func;
     using BaseClass = vvl::base::Device;
 
@@ -536,7 +554,8 @@ class DeviceState : public vvl::base::Device {
     DeviceState(vvl::dispatch::Device* dev, InstanceState* instance)
         : BaseClass(dev, instance, LayerObjectTypeStateTracker),
           instance_state(instance),
-          special_supported(dev->stateless_device_data.special_supported) {
+          special_supported(dev->stateless_device_data.special_supported),
+          retire_scheduler(global_settings.queue_retire_threads, global_settings.queue_retire_cpu_affinity) {
         physical_device_state = instance_state->Get<vvl::PhysicalDevice>(physical_device).get();
         physical_device_state->has_maintenance9 = dev->stateless_device_data.special_supported.has_maintenance9;
     }
@@ -564,6 +583,8 @@ class DeviceState : public vvl::base::Device {
         auto iter = map.pop(handle);
         if (iter != map.end()) {
             iter->second->Destroy();
+            // Other threads can still hold borrowed pointers to it
+            borrow_reclaimer_.Retire(std::move(iter->second));
         }
     }
 
@@ -606,7 +627,7 @@ class DeviceState : public vvl::base::Device {
         if (found_it == map.end()) {
             return nullptr;
         }
-        // NOTE: vvl::concurrent_unordered_map::find() makes a copy of the value, so it is safe to move out.
+        // NOTE: vvl::StateObjectMap::find() makes a copy of the value, so it is safe to move out.
         // But this will break everything, when switching to a different map type.
         return std::static_pointer_cast<State>(std::move(found_it->second));
     }
@@ -621,6 +642,15 @@ class DeviceState : public vvl::base::Device {
         return std::static_pointer_cast<State>(std::move(found_it->second));
     }
 
+    // Same as Get() without taking a reference, for the hot validation paths where the refcount atomics of the shared_ptr
+    // copies show up. Only valid inside the vvl::EpochReclaimer::Scope it was taken in: objects destroyed while the scope is
+    // open are kept alive until it closes. Never store the pointer.
+    template <typename State, typename Traits = typename state_object::Traits<State>>
+    const State* GetBorrowed(typename Traits::HandleType handle) const {
+        assert(EpochReclaimer::InScope());
+        return static_cast<const State*>(GetStateMap<State>().find_borrowed(handle));
+    }
+
     // GetRead() and GetWrite() return an already locked state object. Currently this is only supported by
     // vvl::CommandBuffer, because it has public ReadLock() and WriteLock() methods.
     // NOTE: Calling base class hook methods with a vvl::CommandBuffer lock held will lead to deadlock. Instead,
@@ -673,18 +703,20 @@ class DeviceState : public vvl::base::Device {
     // more efficient to store them using raw pointers. It is safe to do so (at time of writing) because those raw pointers come
     // from shared ones created when the buffer is first recorded, and they are removed from buffer_address_map_ at BufferDestroy
     // time
-    vvl::span<vvl::Buffer* const> GetBuffersByAddress(VkDeviceAddress address) const {
-        ReadLockGuard guard(buffer_address_lock_);
-        auto found_it = buffer_address_map_.find(address);
-        if (found_it == buffer_address_map_.end()) {
-            return vvl::make_span<vvl::Buffer* const>(nullptr, static_cast<size_t>(0));
-        }
-        return found_it->second;
-    }
+    using BufferAddressMapStore = small_vector<vvl::Buffer*, 1, size_t>;
+    using BufferAddressRangeMap = sparse_container::range_map<VkDeviceAddress, BufferAddressMapStore>;
+    // Does not lock unless the buffer addresses changed since the calling thread last looked one up. The list is copied, as the
+    // snapshot it comes from can be replaced by another thread.
+    BufferAddressMapStore GetBuffersByAddress(VkDeviceAddress address) const;
 
     // Return a count pair, {written addresses count, total address ranges count}
     using BufferAddressRange = vvl::range<VkDeviceAddress>;
     [[nodiscard]] size_t GetBufferAddressRangesCount() { return buffer_address_map_.size(); }
+    // Changes each time a buffer address range is added or removed, so a copy of the ranges can be reused while it is the same.
+    // Read it before GetBufferAddressRanges(), a change in between only makes the copy look outdated.
+    [[nodiscard]] uint64_t GetBufferAddressRangesVersion() const {
+        return buffer_address_version_.load(std::memory_order_acquire);
+    }
     void GetBufferAddressRanges(BufferAddressRange* ranges) const {
         ReadLockGuard guard(buffer_address_lock_);
 
@@ -694,6 +726,20 @@ class DeviceState : public vvl::base::Device {
         }
     }
 
+    // An acceleration structure whose device address range contains the address, null if there is none. Like
+    // GetBuffersByAddress(), does not lock unless acceleration structures were created or destroyed since the calling thread
+    // last looked one up.
+    const vvl::AccelerationStructureKHR* GetAccelerationStructureByAddress(VkDeviceAddress address) const;
+    // Same for many addresses, such as the instance references of a top level build, acceleration_structures[i] is set for
+    // addresses[i]. The index is only looked up once for all of them.
+    void GetAccelerationStructuresByAddresses(vvl::span<const VkDeviceAddress> addresses,
+                                              vvl::span<const vvl::AccelerationStructureKHR*> acceleration_structures) const;
+    // False while an acceleration structure has no known address, as its buffer address was never queried nor its own address,
+    // so a lookup miss proves nothing
+    bool AreAllAccelerationStructureAddressesKnown() const {
+        return unknown_address_acceleration_structure_count_.load(std::memory_order_acquire) == 0;
+    }
+
     VkDeviceSize AllocFakeMemory(VkDeviceSize size) { return fake_memory.Alloc(size); }
     void FreeFakeMemory(VkDeviceSize address) { fake_memory.Free(address); }
 
@@ -785,6 +831,7 @@ class DeviceState : public vvl::base::Device {
                                            const RecordObject& record_obj) override;
 
     virtual void FinishDeviceSetup(const VkDeviceCreateInfo* pCreateInfo, const Location& loc) override;
+    void UpdateMemoryAccounting() const override;
 
     void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator,
                                     const RecordObject& record_obj) override;
@@ -933,6 +980,14 @@ class DeviceState : public vvl::base::Device {
     void PreCallRecordDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator,
                                            const RecordObject& record_obj) override;
 
+    // Creates the spirv::Module of |code|. If another Module created from the same code is still alive, its parsing is shared
+    // instead of parsing the code again.
+    std::shared_ptr<spirv::Module> CreateSpirvModule(size_t code_size, const uint32_t* code,
+                                                     spirv::StatelessData* stateless_data) const;
+
+    // Calls build(i) for each of the |count| create infos of a vkCreate*Pipelines call, in parallel when there are many. The
+    // pipeline states do not depend on each other, build(i) must only write the i-th one.
+    void BuildPipelineStates(uint32_t count, const std::function<void(uint32_t)>& build) const;
     virtual std::shared_ptr<vvl::Pipeline> CreateGraphicsPipelineState(
         const VkGraphicsPipelineCreateInfo* create_info, std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
         std::shared_ptr<const vvl::RenderPass>&& render_pass, std::shared_ptr<const vvl::PipelineLayout>&& layout,
@@ -1799,6 +1854,9 @@ class DeviceState : public vvl::base::Device {
 
     void PostCallRecordGetBufferDeviceAddress(VkDevice device, const VkBufferDeviceAddressInfo* pInfo,
                                               const RecordObject& record_obj) override;
+    void PostCallRecordGetAccelerationStructureDeviceAddressKHR(VkDevice device,
+                                                                const VkAccelerationStructureDeviceAddressInfoKHR* pInfo,
+                                                                const RecordObject& record_obj) override;
     void PostCallRecordGetBufferDeviceAddressKHR(VkDevice device, const VkBufferDeviceAddressInfo* pInfo,
                                                  const RecordObject& record_obj) override;
     void PostCallRecordGetBufferDeviceAddressEXT(VkDevice device, const VkBufferDeviceAddressInfo* pInfo,
@@ -1832,8 +1890,7 @@ class DeviceState : public vvl::base::Device {
                                                        const RecordObject& record_obj) override;
 
     inline std::shared_ptr<vvl::ShaderModule> GetShaderModuleStateFromIdentifier(const VkShaderModuleIdentifierEXT& ident) {
-        ReadLockGuard guard(shader_identifier_map_lock_);
-        if (const auto itr = shader_identifier_map_.find(ident); itr != shader_identifier_map_.cend()) {
+        if (const auto itr = shader_identifier_map_.find(ident); itr != shader_identifier_map_.end()) {
             return itr->second;
         }
         return {};
@@ -1846,8 +1903,7 @@ class DeviceState : public vvl::base::Device {
             shader_id.identifierSize = shader_stage_id.identifierSize;
             const uint32_t copy_size = std::min(VK_MAX_SHADER_MODULE_IDENTIFIER_SIZE_EXT, shader_stage_id.identifierSize);
             std::copy(shader_stage_id.pIdentifier, shader_stage_id.pIdentifier + copy_size, shader_id.identifier);
-            ReadLockGuard guard(shader_identifier_map_lock_);
-            if (const auto itr = shader_identifier_map_.find(shader_id); itr != shader_identifier_map_.cend()) {
+            if (const auto itr = shader_identifier_map_.find(shader_id); itr != shader_identifier_map_.end()) {
                 return itr->second;
             }
         }
@@ -1874,8 +1930,7 @@ class DeviceState : public vvl::base::Device {
     };
 
     inline std::optional<ExternalOpaqueInfo> GetOpaqueInfoFromFdHandle(int fd) const {
-        ReadLockGuard guard(fd_handle_map_lock_);
-        if (const auto itr = fd_handle_map_.find(fd); itr != fd_handle_map_.cend()) {
+        if (const auto itr = fd_handle_map_.find(fd); itr != fd_handle_map_.end()) {
             return itr->second;
         }
         return {};
@@ -1883,8 +1938,7 @@ class DeviceState : public vvl::base::Device {
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
     inline std::optional<ExternalOpaqueInfo> GetOpaqueInfoFromWin32Handle(HANDLE handle) const {
-        ReadLockGuard guard(win32_handle_map_lock_);
-        if (const auto itr = win32_handle_map_.find(handle); itr != win32_handle_map_.cend()) {
+        if (const auto itr = win32_handle_map_.find(handle); itr != win32_handle_map_.end()) {
             return itr->second;
         }
         return {};
@@ -1904,6 +1958,11 @@ class DeviceState : public vvl::base::Device {
 
     SpecialSupported special_supported;
 
+    // Retires the submissions of every queue, must outlive queue_map_
+    vvl::QueueRetireScheduler retire_scheduler;
+    // Builds the pipeline states of the vkCreate*Pipelines calls with many create infos
+    mutable vvl::TaskPool pipeline_build_pool;
+
     std::vector<VkCooperativeMatrixPropertiesNV> cooperative_matrix_properties_nv;
     std::vector<VkCooperativeMatrixPropertiesKHR> cooperative_matrix_properties_khr;
     std::vector<VkCooperativeMatrixFlexibleDimensionsPropertiesNV> cooperative_matrix_flexible_dimensions_properties;
@@ -1927,9 +1986,6 @@ class DeviceState : public vvl::base::Device {
 
     mutable vvl::VideoProfileDesc::Cache video_profile_cache_;
 
-    using BufferAddressMapStore = small_vector<vvl::Buffer*, 1, size_t>;
-    using BufferAddressRangeMap = sparse_container::range_map<VkDeviceAddress, BufferAddressMapStore>;
-
     // tracks which queue family index were used when creating the device for quick lookup
     vvl::unordered_set<uint32_t> queue_family_index_set;
     // The queue count can different for the same queueFamilyIndex if the create flag are different
@@ -1943,6 +1999,50 @@ class DeviceState : public vvl::base::Device {
     // If vkGetBufferDeviceAddress is called, keep track of buffer <-> address mapping.
     BufferAddressRangeMap buffer_address_map_;
     mutable std::shared_mutex buffer_address_lock_;
+    // Immutable copy of buffer_address_map_ for GetBuffersByAddress(), only rebuilt when it is read after a change, so that
+    // creating many buffers costs a single rebuild
+    struct BufferAddressSnapshot {
+        // Sorted, the ranges do not overlap
+        std::vector<VkDeviceAddress> begins;
+        std::vector<VkDeviceAddress> ends;
+        std::vector<BufferAddressMapStore> buffers;
+    };
+    mutable std::shared_ptr<const BufferAddressSnapshot> buffer_address_snapshot_;  // guarded by buffer_address_lock_
+    // Unique across devices, 0 when buffer_address_map_ changed since the snapshot was made
+    mutable std::atomic<uint64_t> buffer_address_snapshot_id_{0};
+    std::atomic<uint64_t> buffer_address_version_{0};
+    // Called with buffer_address_lock_ held for writing
+    void InvalidateBufferAddressSnapshot() {
+        buffer_address_snapshot_id_.store(0, std::memory_order_release);
+        buffer_address_version_.fetch_add(1, std::memory_order_release);
+    }
+
+    // Address ranges of the acceleration structures, the ranges can overlap as acceleration structures can alias.
+    // The range backed by the buffer, and the address returned by vkGetAccelerationStructureDeviceAddressKHR when it is not
+    // in that range, which the specification allows for non generic acceleration structures.
+    using AccelerationStructureAddressRanges = small_vector<vvl::range<VkDeviceAddress>, 2, uint32_t>;
+    vvl::unordered_map<const vvl::AccelerationStructureKHR*, AccelerationStructureAddressRanges>
+        acceleration_structure_address_ranges_;
+    mutable std::shared_mutex acceleration_structure_address_lock_;
+    std::atomic<uint32_t> unknown_address_acceleration_structure_count_{0};
+    // Sorted copy of acceleration_structure_address_ranges_, rebuilt when it is read after a change
+    struct AccelerationStructureAddressSnapshot {
+        std::vector<VkDeviceAddress> begins;
+        std::vector<VkDeviceAddress> ends;
+        // Largest end of the ranges up to and including each one, ends the backward search of a lookup
+        std::vector<VkDeviceAddress> max_ends;
+        std::vector<const vvl::AccelerationStructureKHR*> acceleration_structures;
+
+        const vvl::AccelerationStructureKHR* Find(VkDeviceAddress address) const;
+    };
+    // guarded by acceleration_structure_address_lock_
+    mutable std::shared_ptr<const AccelerationStructureAddressSnapshot> acceleration_structure_address_snapshot_;
+    // Unique across devices, 0 when acceleration_structure_address_ranges_ changed since the snapshot was made
+    mutable std::atomic<uint64_t> acceleration_structure_address_snapshot_id_{0};
+    const AccelerationStructureAddressSnapshot& GetAccelerationStructureAddressSnapshot() const;
+    void AddAccelerationStructureAddressRange(const vvl::AccelerationStructureKHR& as_state,
+                                              vvl::range<VkDeviceAddress> address_range);
+    void RemoveAccelerationStructureAddressRanges(const vvl::AccelerationStructureKHR& as_state);
 
     // < external format, features >
     vvl::concurrent_unordered_map<uint64_t, VkFormatFeatureFlags2KHR> ahb_ext_formats_map;
@@ -1954,17 +2054,23 @@ class DeviceState : public vvl::base::Device {
     std::atomic<VkDeviceSize> samplerDescriptorBufferAddressSpaceSize = {0u};
 
     // Keep track of identifier -> state
-    vvl::unordered_map<VkShaderModuleIdentifierEXT, std::shared_ptr<vvl::ShaderModule>> shader_identifier_map_;
-    mutable std::shared_mutex shader_identifier_map_lock_;
+    vvl::ShardedMap<VkShaderModuleIdentifierEXT, std::shared_ptr<vvl::ShaderModule>> shader_identifier_map_;
+
+    // Parsed SPIR-V of the alive spirv::Modules, keyed by the hash of the code
+    mutable vvl::unordered_map<uint64_t, std::weak_ptr<spirv::ModuleData>> spirv_module_data_map_;
+    // Expired entries are removed when the map grows past this size
+    mutable size_t spirv_module_data_sweep_size_ = 64;
+    mutable std::mutex spirv_module_data_map_lock_;
 
     // If vkGetMemoryFdKHR is called, keep track of fd handle -> allocation info
-    vvl::unordered_map<int, ExternalOpaqueInfo> fd_handle_map_;
-    mutable std::shared_mutex fd_handle_map_lock_;
+    vvl::ShardedMap<int, ExternalOpaqueInfo> fd_handle_map_;
+
+    // Shared with the vvl::Events, which give back their index when freed
+    std::shared_ptr<vvl::EventIndexAllocator> event_index_allocator_ = std::make_shared<vvl::EventIndexAllocator>();
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
     // If vkGetMemoryWin32HandleKHR is called, keep track of HANDLE -> allocation info
-    vvl::unordered_map<HANDLE, ExternalOpaqueInfo> win32_handle_map_;
-    mutable std::shared_mutex win32_handle_map_lock_;
+    vvl::ShardedMap<HANDLE, ExternalOpaqueInfo> win32_handle_map_;
 #endif
 
   private:
@@ -2011,6 +2117,9 @@ class DeviceState : public vvl::base::Device {
 
     std::atomic<uint32_t> object_id_{1};  // 0 is an invalid id
 
+    // Keeps the destroyed objects alive for the scopes that can still use borrowed pointers to them
+    EpochReclaimer borrow_reclaimer_;
+
     // Simple base address allocator allow allow VkDeviceMemory allocations to appear to exist in a common address space.
     // At 256GB allocated/sec  ( > 8GB at 30Hz), will overflow in just over 2 years
     class FakeAllocator {
@@ -2062,6 +2171,11 @@ class DeviceProxy : public vvl::base::Device {
         return device_state->Get<State>(handle);
     }
 
+    template <typename State, typename Traits = typename state_object::Traits<State>>
+    const State* GetBorrowed(typename Traits::HandleType handle) const {
+        return device_state->GetBorrowed<State>(handle);
+    }
+
     template <typename State, typename Traits = typename state_object::Traits<State>,
               typename ReadLockedType = typename Traits::ReadLockedType>
     ReadLockedType GetRead(typename Traits::HandleType handle) const {
@@ -2083,7 +2197,7 @@ class DeviceProxy : public vvl::base::Device {
         return device_state->AnyOf<State>(fn);
     }
 
-    vvl::span<vvl::Buffer* const> GetBuffersByAddress(VkDeviceAddress address) const {
+    vvl::DeviceState::BufferAddressMapStore GetBuffersByAddress(VkDeviceAddress address) const {
         return const_cast<const vvl::DeviceState*>(device_state)->GetBuffersByAddress(address);
     }
 
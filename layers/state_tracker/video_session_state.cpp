@@ -432,10 +432,9 @@ VideoPictureID::VideoPictureID(VideoProfileDesc const &profile, VkVideoReference
 
 void VideoSessionDeviceState::Reset() {
     initialized_ = true;
-    for (size_t i = 0; i < is_active_.size(); ++i) {
-        is_active_[i] = false;
-        all_pictures_[i].clear();
-        pictures_per_id_[i].clear();
+    for (Slot &slot : slots_) {
+        slot.active = false;
+        slot.ClearPictures();
     }
     encode_.quality_level = 0;
     encode_.rate_control_state = VideoEncodeRateControlState();
@@ -444,74 +443,65 @@ void VideoSessionDeviceState::Reset() {
 void VideoSessionDeviceState::Activate(int32_t slot_index, const VideoPictureID &picture_id, const VideoPictureResource &res) {
     assert(!picture_id.IsBothFields());
 
-    if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= is_active_.size()) {
+    if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= slots_.size()) {
         // Out-of-bounds slot index
         return;
     }
+    const uint32_t picture_index = GetPictureIndex(picture_id);
+    if (picture_index >= kPicturesPerSlot) {
+        return;
+    }
 
-    is_active_[slot_index] = true;
+    Slot &slot = slots_[slot_index];
+    slot.active = true;
 
     if (picture_id.IsFrame()) {
         // If slot is activated with a frame then it overrides all previous pictures
-        all_pictures_[slot_index].clear();
-        pictures_per_id_[slot_index].clear();
+        slot.ClearPictures();
     }
 
-    auto prev_res_it = pictures_per_id_[slot_index].find(picture_id);
-    if (prev_res_it != pictures_per_id_[slot_index].end()) {
-        // If we replace an existing picture then remove it
-        all_pictures_[slot_index].erase(prev_res_it->second);
-    }
-
-    all_pictures_[slot_index].insert(res);
-    pictures_per_id_[slot_index][picture_id] = res;
+    // Replaces any existing picture with the same id
+    slot.pictures[picture_index] = res;
+    slot.picture_mask |= 1u << picture_index;
 }
 
 void VideoSessionDeviceState::Invalidate(int32_t slot_index, const VideoPictureID &picture_id) {
     assert(!picture_id.IsBothFields());
 
-    if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= is_active_.size()) {
+    if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= slots_.size()) {
         // Out-of-bounds slot index
         return;
     }
 
-    bool previous_is_frame = pictures_per_id_[slot_index].find(VideoPictureID::Frame()) != pictures_per_id_[slot_index].end();
+    Slot &slot = slots_[slot_index];
+    const bool previous_is_frame = slot.HasPicture(GetPictureIndex(VideoPictureID::Frame()));
     if (picture_id.IsFrame() || previous_is_frame) {
         // If invalidation happens due to a non-reference setup frame then it invalidates all previous pictures
         // Also invalidate all if the previous picture reference was a frame (e.g. a field invalidates a previous frame)
-        all_pictures_[slot_index].clear();
-        pictures_per_id_[slot_index].clear();
+        slot.ClearPictures();
     } else {
         // Invalidate any existing picture reference with the specified id by removing it
-        auto prev_res_it = pictures_per_id_[slot_index].find(picture_id);
-        if (prev_res_it != pictures_per_id_[slot_index].end()) {
-            VideoPictureResource res = prev_res_it->second;
-            pictures_per_id_[slot_index].erase(picture_id);
-            // Check if there are any more references to the previous resource
-            auto other_ref_it = std::find_if(std::begin(pictures_per_id_[slot_index]), std::end(pictures_per_id_[slot_index]),
-                                             [&res](const auto &it) { return it.second == res; });
-            if (other_ref_it == pictures_per_id_[slot_index].end()) {
-                // If there are no remaining references to the resource, remove it
-                all_pictures_[slot_index].erase(res);
-            }
+        const uint32_t picture_index = GetPictureIndex(picture_id);
+        if (picture_index < kPicturesPerSlot && slot.HasPicture(picture_index)) {
+            slot.pictures[picture_index] = VideoPictureResource();
+            slot.picture_mask &= ~(1u << picture_index);
         }
     }
 
     // If there are no remaining picture references then deactivate the slot
-    if (pictures_per_id_[slot_index].empty()) {
-        is_active_[slot_index] = false;
+    if (slot.picture_mask == 0) {
+        slot.active = false;
     }
 }
 
 void VideoSessionDeviceState::Deactivate(int32_t slot_index) {
-    if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= is_active_.size()) {
+    if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= slots_.size()) {
         // Out-of-bounds slot index
         return;
     }
 
-    is_active_[slot_index] = false;
-    all_pictures_[slot_index].clear();
-    pictures_per_id_[slot_index].clear();
+    slots_[slot_index].active = false;
+    slots_[slot_index].ClearPictures();
 }
 
 class RateControlStateMismatchRecorder {
@@ -19,6 +19,7 @@
 #include "state_tracker/state_object.h"
 #include "utils/hash_util.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
+#include <array>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -493,37 +494,39 @@ struct VideoEncodeRateControlState {
 
 class VideoSessionDeviceState {
   public:
-    VideoSessionDeviceState(uint32_t reference_slot_count = 0)
-        : initialized_(false),
-          is_active_(reference_slot_count, false),
-          all_pictures_(reference_slot_count),
-          pictures_per_id_(reference_slot_count),
-          encode_() {}
+    VideoSessionDeviceState(uint32_t reference_slot_count = 0) : initialized_(false), slots_(reference_slot_count), encode_() {}
 
     bool IsInitialized() const { return initialized_; }
     bool IsSlotActive(int32_t slot_index) const {
-        if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= is_active_.size()) {
+        if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= slots_.size()) {
             // Out-of-bounds slot index
             return false;
         }
-        return is_active_[slot_index];
+        return slots_[slot_index].active;
     }
 
     bool IsSlotPicture(int32_t slot_index, const VideoPictureResource &res) const {
-        if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= all_pictures_.size()) {
+        if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= slots_.size()) {
             // Out-of-bounds slot index
             return false;
         }
-        return all_pictures_[slot_index].find(res) != all_pictures_[slot_index].end();
+        const Slot &slot = slots_[slot_index];
+        for (uint32_t i = 0; i < kPicturesPerSlot; ++i) {
+            if (slot.HasPicture(i) && slot.pictures[i] == res) {
+                return true;
+            }
+        }
+        return false;
     }
 
     bool IsSlotPicture(int32_t slot_index, const VideoPictureID &picture_id, const VideoPictureResource &res) const {
-        if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= pictures_per_id_.size()) {
+        if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= slots_.size()) {
             // Out-of-bounds slot index
             return false;
         }
-        auto it = pictures_per_id_[slot_index].find(picture_id);
-        return it != pictures_per_id_[slot_index].end() && it->second == res;
+        const uint32_t picture_index = GetPictureIndex(picture_id);
+        const Slot &slot = slots_[slot_index];
+        return picture_index < kPicturesPerSlot && slot.HasPicture(picture_index) && slot.pictures[picture_index] == res;
     }
 
     uint32_t GetEncodeQualityLevel() const { return encode_.quality_level; }
@@ -543,10 +546,31 @@ class VideoSessionDeviceState {
                                   const vku::safe_VkVideoBeginCodingInfoKHR &begin_info, const Location &loc) const;
 
   private:
+    // A DPB slot holds at most a frame, a top field and a bottom field picture. They are kept in a fixed array indexed by
+    // picture id rather than in hash containers, as this state is copied for every submitted video command buffer.
+    static constexpr uint32_t kPicturesPerSlot = 3;
+    static uint32_t GetPictureIndex(const VideoPictureID &picture_id) {
+        if (picture_id.IsFrame()) return 0;
+        if (picture_id.IsTopField()) return 1;
+        if (picture_id.IsBottomField()) return 2;
+        return kPicturesPerSlot;
+    }
+
+    struct Slot {
+        bool active = false;
+        // Bit i is set if pictures[i] is present
+        uint8_t picture_mask = 0;
+        std::array<VideoPictureResource, kPicturesPerSlot> pictures;
+
+        bool HasPicture(uint32_t picture_index) const { return (picture_mask & (1u << picture_index)) != 0; }
+        void ClearPictures() {
+            picture_mask = 0;
+            pictures.fill(VideoPictureResource());
+        }
+    };
+
     bool initialized_;
-    std::vector<bool> is_active_;
-    std::vector<VideoPictureResources> all_pictures_;
-    std::vector<unordered_map<VideoPictureID, VideoPictureResource, VideoPictureID::hash>> pictures_per_id_;
+    std::vector<Slot> slots_;
 
     struct {
         uint32_t quality_level{0};
@@ -95,6 +95,8 @@ Swapchain::Swapchain(vvl::DeviceState &dev_data_, const VkSwapchainCreateInfoKHR
       exclusive_full_screen_access(false),
       shared_presentable(VK_PRESENT_MODE_SHARED_DEMAND_REFRESH_KHR == pCreateInfo->presentMode ||
                          VK_PRESENT_MODE_SHARED_CONTINUOUS_REFRESH_KHR == pCreateInfo->presentMode),
+      has_present_modes_create_info(vku::FindStructInPNextChain<VkSwapchainPresentModesCreateInfoKHR>(pCreateInfo->pNext) !=
+                                    nullptr),
       image_create_info(GetImageCreateInfo(pCreateInfo)),
       dev_data(dev_data_) {
     // Initialize with visible values for debugging purposes.
@@ -213,9 +215,9 @@ SwapchainImage Swapchain::GetSwapChainImage(uint32_t index) const {
 }
 
 std::shared_ptr<const vvl::Image> Swapchain::GetSwapChainImageShared(uint32_t index) const {
-    const SwapchainImage swapchain_image(GetSwapChainImage(index));
-    if (swapchain_image.image_state) {
-        return swapchain_image.image_state->shared_from_this();
+    // Called for every present and acquire, don't copy the whole SwapchainImage with its sync object references
+    if (index < images.size() && images[index].image_state) {
+        return images[index].image_state->shared_from_this();
     }
     return std::shared_ptr<const vvl::Image>();
 }
@@ -86,6 +86,8 @@ class Swapchain : public StateObject, public SubStateManager<SwapchainSubState>
     bool retired = false;
     bool exclusive_full_screen_access;
     const bool shared_presentable;
+    // VkSwapchainPresentModesCreateInfoKHR was chained, looked up once here instead of on every present
+    const bool has_present_modes_create_info;
     uint64_t max_present_id = 0;
     const vku::safe_VkImageCreateInfo image_create_info;
 
@@ -270,12 +270,28 @@ bool Device::manual_PreCallValidateCmdBindVertexBuffers2(VkCommandBuffer command
                      firstBinding, bindingCount, device_limits.maxVertexInputBindings);
     }
 
+    if (bindingCount > 0 && pBuffers == nullptr) {
+        skip |= LogError("VUID-vkCmdBindVertexBuffers2-pBuffers-parameter", commandBuffer, error_obj.location.dot(Field::pBuffers),
+                         "is NULL.");
+        return skip;
+    }
+
+    // Only look at each binding if one has a null buffer or a stride over the limit
+    bool has_null_buffer = false;
+    VkDeviceSize max_stride = 0;
     for (uint32_t i = 0; i < bindingCount; ++i) {
-        if (pBuffers == nullptr) {
-            skip |= LogError("VUID-vkCmdBindVertexBuffers2-pBuffers-parameter", commandBuffer,
-                             error_obj.location.dot(Field::pBuffers), "is NULL.");
-            return skip;
+        has_null_buffer |= pBuffers[i] == VK_NULL_HANDLE;
+    }
+    if (pStrides) {
+        for (uint32_t i = 0; i < bindingCount; ++i) {
+            max_stride = std::max(max_stride, pStrides[i]);
         }
+    }
+    if (!has_null_buffer && max_stride <= device_limits.maxVertexInputBindingStride) {
+        return skip;
+    }
+
+    for (uint32_t i = 0; i < bindingCount; ++i) {
         if (pBuffers[i] == VK_NULL_HANDLE) {
             const Location buffer_loc = error_obj.location.dot(Field::pBuffers, i);
             if (!enabled_features.nullDescriptor) {
@@ -612,7 +628,7 @@ bool Device::ValidateViewport(const VkViewport &viewport, VkCommandBuffer object
     // height
     bool height_healthy = true;
     const bool negative_height_enabled =
-        IsExtEnabled(extensions.vk_khr_maintenance1) || IsExtEnabled(extensions.vk_amd_negative_viewport_height);
+        IsAnyExtEnabled(extensions.vk_khr_maintenance1, extensions.vk_amd_negative_viewport_height);
     const auto max_h = device_limits.maxViewportDimensions[1];
 
     if (!negative_height_enabled && !(viewport.height > 0.0f)) {
@@ -690,6 +706,58 @@ bool Device::ValidateViewport(const VkViewport &viewport, VkCommandBuffer object
     return skip;
 }
 
+// Stricter than ValidateViewport: the dimensions are only compared as floats, and any NaN or infinite sum fails
+bool Device::AreViewportsValid(const VkViewport *viewports, uint32_t count) const {
+    constexpr float kMax = std::numeric_limits<float>::max();
+    constexpr float kLowest = std::numeric_limits<float>::lowest();
+    float min_width = kMax, max_width = 0.0f;
+    float min_height = kMax, max_abs_height = 0.0f;
+    float min_xy = kMax, max_y = kLowest;
+    float min_y_end = kMax, max_end = kLowest;
+    float min_depth = kMax, max_depth = kLowest;
+    // The sum of every component is NaN if any of them is
+    float nan_check = 0.0f;
+    for (uint32_t i = 0; i < count; ++i) {
+        const VkViewport &viewport = viewports[i];
+        const float x_end = viewport.x + viewport.width;
+        const float y_end = viewport.y + viewport.height;
+        min_width = std::min(min_width, viewport.width);
+        max_width = std::max(max_width, viewport.width);
+        min_height = std::min(min_height, viewport.height);
+        max_abs_height = std::max(max_abs_height, fabsf(viewport.height));
+        min_xy = std::min(min_xy, std::min(viewport.x, viewport.y));
+        max_y = std::max(max_y, viewport.y);
+        min_y_end = std::min(min_y_end, y_end);
+        max_end = std::max(max_end, std::max(x_end, y_end));
+        min_depth = std::min(min_depth, std::min(viewport.minDepth, viewport.maxDepth));
+        max_depth = std::max(max_depth, std::max(viewport.minDepth, viewport.maxDepth));
+        nan_check += x_end + y_end + viewport.minDepth + viewport.maxDepth;
+    }
+
+    const bool negative_height_enabled =
+        IsAnyExtEnabled(extensions.vk_khr_maintenance1, extensions.vk_amd_negative_viewport_height);
+    const float min_bound = device_limits.viewportBoundsRange[0];
+    const float max_bound = device_limits.viewportBoundsRange[1];
+    return !std::isnan(nan_check) && min_width > 0.0f &&
+           max_width <= static_cast<float>(device_limits.maxViewportDimensions[0]) &&
+           max_abs_height <= static_cast<float>(device_limits.maxViewportDimensions[1]) &&
+           (negative_height_enabled || min_height > 0.0f) && min_xy >= min_bound && max_y <= max_bound &&
+           min_y_end >= min_bound && max_end <= max_bound &&
+           (IsExtEnabled(extensions.vk_ext_depth_range_unrestricted) || (min_depth >= 0.0f && max_depth <= 1.0f));
+}
+
+bool Device::AreScissorsValid(const VkRect2D *scissors, uint32_t count) {
+    int32_t min_offset = 0;
+    int64_t max_end = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        const VkRect2D &scissor = scissors[i];
+        min_offset = std::min(min_offset, std::min(scissor.offset.x, scissor.offset.y));
+        max_end = std::max(max_end, std::max(int64_t(scissor.offset.x) + int64_t(scissor.extent.width),
+                                             int64_t(scissor.offset.y) + int64_t(scissor.extent.height)));
+    }
+    return min_offset >= 0 && max_end <= vvl::kI32Max;
+}
+
 bool Device::manual_PreCallValidateFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
                                                       const VkCommandBuffer *pCommandBuffers, const Context &context) const {
     bool skip = false;
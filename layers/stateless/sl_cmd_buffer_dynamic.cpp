@@ -43,7 +43,7 @@ bool Device::manual_PreCallValidateCmdSetViewportWithCount(VkCommandBuffer comma
         }
     }
 
-    if (pViewports) {
+    if (pViewports && !AreViewportsValid(pViewports, viewportCount)) {
         for (uint32_t viewport_i = 0; viewport_i < viewportCount; ++viewport_i) {
             const auto &viewport = pViewports[viewport_i];  // will crash on invalid ptr
             skip |= ValidateViewport(viewport, commandBuffer, error_obj.location.dot(Field::pViewports, viewport_i));
@@ -84,7 +84,7 @@ bool Device::manual_PreCallValidateCmdSetScissorWithCount(VkCommandBuffer comman
         }
     }
 
-    if (pScissors) {
+    if (pScissors && !AreScissorsValid(pScissors, scissorCount)) {
         for (uint32_t scissor_i = 0; scissor_i < scissorCount; ++scissor_i) {
             const Location scissor_loc = error_obj.location.dot(Field::pScissors, scissor_i);
             const auto &scissor = pScissors[scissor_i];  // will crash on invalid ptr
@@ -492,7 +492,7 @@ bool Device::manual_PreCallValidateCmdSetViewport(VkCommandBuffer commandBuffer,
         }
     }
 
-    if (pViewports) {
+    if (pViewports && !AreViewportsValid(pViewports, viewportCount)) {
         for (uint32_t viewport_i = 0; viewport_i < viewportCount; ++viewport_i) {
             const auto &viewport = pViewports[viewport_i];  // will crash on invalid ptr
             skip |= ValidateViewport(viewport, commandBuffer, error_obj.location.dot(Field::pViewports, viewport_i));
@@ -542,7 +542,7 @@ bool Device::manual_PreCallValidateCmdSetScissor(VkCommandBuffer commandBuffer,
         }
     }
 
-    if (pScissors) {
+    if (pScissors && !AreScissorsValid(pScissors, scissorCount)) {
         for (uint32_t scissor_i = 0; scissor_i < scissorCount; ++scissor_i) {
             const Location scissor_loc = error_obj.location.dot(Field::pScissors, scissor_i);
             const auto &scissor = pScissors[scissor_i];  // will crash on invalid ptr
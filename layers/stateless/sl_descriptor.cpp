@@ -342,6 +342,7 @@ bool Device::ValidateSamplerImageProcessingQCOM(const VkSamplerCreateInfo &creat
 
 bool Device::ValidateSamplerCreateInfo(const VkSamplerCreateInfo &create_info, const Location &create_info_loc,
                                        const Context &context) const {
+    VVL_CheckStatsScope(dispatch_device_, "stateless::Device::ValidateSamplerCreateInfo");
     bool skip = false;
 
     if (create_info.anisotropyEnable == VK_TRUE) {
@@ -591,6 +592,7 @@ bool Device::ValidateMutableDescriptorTypeCreateInfo(const VkDescriptorSetLayout
 
 bool Device::ValidateDescriptorSetLayoutCreateInfo(const VkDescriptorSetLayoutCreateInfo &create_info,
                                                    const Location &create_info_loc) const {
+    VVL_CheckStatsScope(dispatch_device_, "stateless::Device::ValidateDescriptorSetLayoutCreateInfo");
     bool skip = false;
 
     const bool has_descriptor_buffer_flag = (create_info.flags & VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT) != 0;
@@ -738,6 +740,7 @@ bool Device::manual_PreCallValidateFreeDescriptorSets(VkDevice device, VkDescrip
 
 bool Device::ValidateWriteDescriptorSet(const Context &context, const Location &loc, const uint32_t descriptorWriteCount,
                                         const VkWriteDescriptorSet *pDescriptorWrites) const {
+    VVL_CheckStatsScope(dispatch_device_, "stateless::Device::ValidateWriteDescriptorSet");
     bool skip = false;
     if (!pDescriptorWrites) {
         return skip;
@@ -31,6 +31,7 @@ namespace stateless {
 bool Device::manual_PreCallValidateCreateImage(VkDevice device, const VkImageCreateInfo *pCreateInfo,
                                                const VkAllocationCallbacks *pAllocator, VkImage *pImage,
                                                const Context &context) const {
+    VVL_CheckStatsScope(dispatch_device_, "stateless::Device::manual_PreCallValidateCreateImage");
     bool skip = false;
     const auto &error_obj = context.error_obj;
 
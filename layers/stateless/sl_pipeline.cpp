@@ -361,6 +361,7 @@ bool Device::manual_PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPi
                                                            const VkGraphicsPipelineCreateInfo *pCreateInfos,
                                                            const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                            const Context &context) const {
+    VVL_CheckStatsScope(dispatch_device_, "stateless::Device::manual_PreCallValidateCreateGraphicsPipelines");
     bool skip = false;
     const auto &error_obj = context.error_obj;
 
@@ -1319,6 +1320,7 @@ bool Device::manual_PreCallValidateCreateComputePipelines(VkDevice device, VkPip
                                                           const VkComputePipelineCreateInfo *pCreateInfos,
                                                           const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                           const Context &context) const {
+    VVL_CheckStatsScope(dispatch_device_, "stateless::Device::manual_PreCallValidateCreateComputePipelines");
     bool skip = false;
     const auto &error_obj = context.error_obj;
 
@@ -22,6 +22,7 @@
 #include "generated/spirv_grammar_helper.h"
 #include "chassis/dispatch_object.h"
 #include "state_tracker/shader_module.h"
+#include "utils/hash_util.h"
 #include <inttypes.h>
 #include <set>
 
@@ -70,6 +71,34 @@ SpirvValidator::SpirvValidator(DebugReport *debug_report, const vvl::StatelessDe
       enabled_features(stateless_device_data.enabled_features),
       special_supported(stateless_device_data.special_supported) {}
 
+uint64_t SpirvValidator::GetDeviceHash() const {
+    // Only the pointers are cleared, a struct that is not byte for byte the same only costs a cache miss
+    VkPhysicalDeviceVulkan11Properties props11 = phys_dev_props_core11;
+    props11.pNext = nullptr;
+    VkPhysicalDeviceVulkan12Properties props12 = phys_dev_props_core12;
+    props12.pNext = nullptr;
+    VkPhysicalDeviceVulkan13Properties props13 = phys_dev_props_core13;
+    props13.pNext = nullptr;
+    VkPhysicalDeviceVulkan14Properties props14 = phys_dev_props_core14;
+    props14.pNext = nullptr;
+    props14.pCopySrcLayouts = nullptr;
+    props14.pCopyDstLayouts = nullptr;
+
+    // phys_dev_ext_props is left out, it is the same for the same device and driver, which phys_dev_props identifies
+    const uint64_t hashes[] = {
+        VK_HEADER_VERSION_COMPLETE,
+        hash_util::Hash64(&extensions, sizeof(extensions)),
+        hash_util::Hash64(&enabled_features, sizeof(enabled_features)),
+        hash_util::Hash64(&special_supported, sizeof(special_supported)),
+        hash_util::Hash64(&phys_dev_props, sizeof(phys_dev_props)),
+        hash_util::Hash64(&props11, sizeof(props11)),
+        hash_util::Hash64(&props12, sizeof(props12)),
+        hash_util::Hash64(&props13, sizeof(props13)),
+        hash_util::Hash64(&props14, sizeof(props14)),
+    };
+    return hash_util::Hash64(hashes, sizeof(hashes));
+}
+
 // stateless spirv == doesn't require pipeline state and/or shader object info
 // Originally the goal was to move more validation to vkCreateShaderModule time in case the driver decided to parse an invalid
 // SPIR-V here, while that is likely not the case anymore, a bigger reason for checking here is to save on memory. There is a lot of
@@ -95,7 +124,7 @@ bool SpirvValidator::Validate(const spirv::Module &module_state, const spirv::St
         skip |= ValidateSubgroupRotateClustered(module_state, insn, loc);
     }
 
-    for (const auto &entry_point : module_state.static_data_.entry_points) {
+    for (const auto &entry_point : module_state.GetEntryPoints()) {
         skip |= ValidateShaderStageGroupNonUniform(module_state, stateless_data, entry_point->stage, loc);
         skip |= ValidateShaderStageInputOutputLimits(module_state, *entry_point, stateless_data, loc);
         skip |= ValidateShaderFloatControl(module_state, *entry_point, stateless_data, loc);
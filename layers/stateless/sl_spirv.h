@@ -46,6 +46,10 @@ class SpirvValidator : public Logger {
 
     bool Validate(const spirv::Module& module_state, const spirv::StatelessData& stateless_data, const Location& loc) const;
 
+    // Identifies everything Validate() reads from the device, a module that passed once passes again on a device with the same
+    // hash (used to cache the results across runs)
+    uint64_t GetDeviceHash() const;
+
     const APIVersion& api_version;
     const DeviceExtensions& extensions;
     const VkPhysicalDeviceProperties& phys_dev_props;
@@ -173,6 +173,67 @@ bool Context::ValidateAllocationCallbacks(const VkAllocationCallbacks &callback,
     return skip;
 }
 
+bool Context::ValidateArrayImpl(const Location &count_loc, const Location &array_loc, uint64_t count, bool array_is_null,
+                                bool count_required, bool array_required, const char *count_required_vuid,
+                                const char *array_required_vuid) const {
+    bool skip = false;
+
+    // Count parameters not tagged as optional cannot be 0
+    if (count_required && (count == 0)) {
+        skip |= log.LogError(count_required_vuid, error_obj.handle, count_loc, "must be greater than 0.");
+    }
+
+    // Array parameters not tagged as optional cannot be NULL, unless the count is 0
+    if (array_required && (count != 0) && array_is_null) {
+        skip |= log.LogError(array_required_vuid, error_obj.handle, array_loc, "is NULL.");
+    }
+
+    return skip;
+}
+
+bool Context::LogStructTypeMismatch(const Location &loc, VkStructureType sType, const char *stype_vuid) const {
+    return log.LogError(stype_vuid, error_obj.handle, loc.dot(Field::sType), "must be %s", string_VkStructureType(sType));
+}
+
+bool Context::ValidateStructTypeImpl(const Location &loc, const VkStructureType *value_stype, VkStructureType sType,
+                                     bool required, const char *struct_vuid, const char *stype_vuid) const {
+    bool skip = false;
+
+    if (value_stype == nullptr) {
+        if (required) {
+            skip |= log.LogError(struct_vuid, error_obj.handle, loc, "is NULL.");
+        }
+    } else if (*value_stype != sType) {
+        skip |= log.LogError(stype_vuid, error_obj.handle, loc.dot(Field::sType), "must be %s.", string_VkStructureType(sType));
+    }
+
+    return skip;
+}
+
+// Every Vulkan struct with an sType has it as the first member, so the array can be walked as sType values |stride| bytes apart
+bool Context::ValidateStructTypeArrayImpl(const Location &count_loc, const Location &array_loc, uint32_t count,
+                                          const VkStructureType *first_stype, size_t stride, VkStructureType sType,
+                                          bool count_required, bool array_required, const char *stype_vuid, const char *param_vuid,
+                                          const char *count_required_vuid) const {
+    bool skip = false;
+
+    if ((first_stype == nullptr) || (count == 0)) {
+        skip |= ValidateArrayImpl(count_loc, array_loc, count, first_stype == nullptr, count_required, array_required,
+                                  count_required_vuid, param_vuid);
+    } else {
+        // Verify that all structs in the array have the correct type
+        const auto *bytes = reinterpret_cast<const uint8_t *>(first_stype);
+        for (uint32_t i = 0; i < count; ++i) {
+            const auto *stype = reinterpret_cast<const VkStructureType *>(bytes + i * stride);
+            if (*stype != sType) {
+                skip |= LogStructTypeMismatch(array_loc.dot(i), sType, stype_vuid);
+            }
+        }
+    }
+
+    return skip;
+}
+
 bool Context::ValidateStringArray(const Location &count_loc, const Location &array_loc, uint32_t count, const char *const *array,
                                   bool count_required, bool array_required, const char *count_required_vuid,
                                   const char *array_required_vuid) const {
@@ -236,8 +297,8 @@ bool Context::ValidateStructPnext(const Location &loc, const void *next, size_t
     bool skip = false;
 
     if (next != nullptr) {
-        vvl::unordered_set<const void *> cycle_check;
-        vvl::unordered_set<VkStructureType, vvl::hash<int>> unique_stype_check;
+        // Chains are short, so a linear scan over an inline buffer beats hashing every sType into a heap allocated set
+        small_vector<VkStructureType, 32, uint32_t> unique_stype_check;
         const char *disclaimer =
             "This error is based on the Valid Usage documentation for version %" PRIu32
             " of the Vulkan header.  It is possible that "
@@ -253,23 +314,26 @@ bool Context::ValidateStructPnext(const Location &loc, const void *next, size_t
         } else {
             const VkStructureType *start = allowed_types;
             const VkStructureType *end = allowed_types + allowed_type_count;
+            const auto &custom_stype_info = GetCustomStypeInfo();
             const VkBaseOutStructure *current = reinterpret_cast<const VkBaseOutStructure *>(next);
 
             while (current != nullptr) {
                 if ((loc.function != Func::vkCreateInstance || (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
                     (loc.function != Func::vkCreateDevice || (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                    if (unique_stype_check.find(current->sType) != unique_stype_check.end() && !IsDuplicatePnext(current->sType)) {
+                    const bool seen = std::find(unique_stype_check.begin(), unique_stype_check.end(), current->sType) !=
+                                      unique_stype_check.end();
+                    if (seen && !IsDuplicatePnext(current->sType)) {
                         // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
                         skip |= log.LogError(stype_vuid, error_obj.handle, pNext_loc,
                                              "chain contains duplicate structure types: %s appears multiple times.\n%s",
                                              string_VkStructureName(current->sType), PrintPNextChain(loc.structure, next).c_str());
-                    } else {
-                        unique_stype_check.insert(current->sType);
+                    } else if (!seen) {
+                        unique_stype_check.emplace_back(current->sType);
                     }
 
                     // Search custom stype list -- if sType found, skip this entirely
                     bool custom = false;
-                    for (const auto &item : GetCustomStypeInfo()) {
+                    for (const auto &item : custom_stype_info) {
                         if (item.first == current->sType) {
                             custom = true;
                             break;
@@ -53,19 +53,8 @@ class Context {
     template <typename T1, typename T2>
     bool ValidateArray(const Location &count_loc, const Location &array_loc, T1 count, const T2 *array, bool count_required,
                        bool array_required, const char *count_required_vuid, const char *array_required_vuid) const {
-        bool skip = false;
-
-        // Count parameters not tagged as optional cannot be 0
-        if (count_required && (count == 0)) {
-            skip |= log.LogError(count_required_vuid, error_obj.handle, count_loc, "must be greater than 0.");
-        }
-
-        // Array parameters not tagged as optional cannot be NULL, unless the count is 0
-        if (array_required && (count != 0) && (*array == nullptr)) {
-            skip |= log.LogError(array_required_vuid, error_obj.handle, array_loc, "is NULL.");
-        }
-
-        return skip;
+        return ValidateArrayImpl(count_loc, array_loc, static_cast<uint64_t>(count), *array == nullptr, count_required,
+                                 array_required, count_required_vuid, array_required_vuid);
     }
 
     template <typename T1, typename T2>
@@ -90,39 +79,15 @@ class Context {
     template <typename T>
     bool ValidateStructType(const Location &loc, const T *value, VkStructureType sType, bool required, const char *struct_vuid,
                             const char *stype_vuid) const {
-        bool skip = false;
-
-        if (value == nullptr) {
-            if (required) {
-                skip |= log.LogError(struct_vuid, error_obj.handle, loc, "is NULL.");
-            }
-        } else if (value->sType != sType) {
-            skip |= log.LogError(stype_vuid, error_obj.handle, loc.dot(Field::sType), "must be %s.", string_VkStructureType(sType));
-        }
-
-        return skip;
+        return ValidateStructTypeImpl(loc, value ? &value->sType : nullptr, sType, required, struct_vuid, stype_vuid);
     }
 
     template <typename T>
     bool ValidateStructTypeArray(const Location &count_loc, const Location &array_loc, uint32_t count, const T *array,
                                  VkStructureType sType, bool count_required, bool array_required, const char *stype_vuid,
                                  const char *param_vuid, const char *count_required_vuid) const {
-        bool skip = false;
-
-        if ((array == nullptr) || (count == 0)) {
-            skip |=
-                ValidateArray(count_loc, array_loc, count, &array, count_required, array_required, count_required_vuid, param_vuid);
-        } else {
-            // Verify that all structs in the array have the correct type
-            for (uint32_t i = 0; i < count; ++i) {
-                if (array[i].sType != sType) {
-                    skip |= log.LogError(stype_vuid, error_obj.handle, array_loc.dot(i).dot(Field::sType), "must be %s",
-                                         string_VkStructureType(sType));
-                }
-            }
-        }
-
-        return skip;
+        return ValidateStructTypeArrayImpl(count_loc, array_loc, count, array ? &array->sType : nullptr, sizeof(T), sType,
+                                           count_required, array_required, stype_vuid, param_vuid, count_required_vuid);
     }
 
     template <typename T>
@@ -138,8 +103,7 @@ class Context {
             // Verify that all structs in the array have the correct type
             for (uint32_t i = 0; i < count; ++i) {
                 if (array[i]->sType != sType) {
-                    skip |= log.LogError(stype_vuid, error_obj.handle, array_loc.dot(i).dot(Field::sType), "must be %s",
-                                         string_VkStructureType(sType));
+                    skip |= LogStructTypeMismatch(array_loc.dot(i), sType, stype_vuid);
                 }
             }
         }
@@ -306,6 +270,19 @@ class Context {
     vvl::Extensions IsValidFlag64Value(vvl::FlagBitmask flag_bitmask, VkFlags64 value) const;
     std::string DescribeFlagBitmaskValue(vvl::FlagBitmask flag_bitmask, VkFlags value) const;
     std::string DescribeFlagBitmaskValue64(vvl::FlagBitmask flag_bitmask, VkFlags64 value) const;
+
+    // Non-template bodies behind the inline wrappers above, so the thousands of generated call sites share one copy of the
+    // checking and error reporting code instead of instantiating it per struct type.
+    bool ValidateArrayImpl(const Location &count_loc, const Location &array_loc, uint64_t count, bool array_is_null,
+                           bool count_required, bool array_required, const char *count_required_vuid,
+                           const char *array_required_vuid) const;
+    bool ValidateStructTypeImpl(const Location &loc, const VkStructureType *value_stype, VkStructureType sType, bool required,
+                                const char *struct_vuid, const char *stype_vuid) const;
+    bool ValidateStructTypeArrayImpl(const Location &count_loc, const Location &array_loc, uint32_t count,
+                                     const VkStructureType *first_stype, size_t stride, VkStructureType sType, bool count_required,
+                                     bool array_required, const char *stype_vuid, const char *param_vuid,
+                                     const char *count_required_vuid) const;
+    bool LogStructTypeMismatch(const Location &loc, VkStructureType sType, const char *stype_vuid) const;
 };
 
 class Instance : public vvl::base::Instance {
@@ -536,6 +513,10 @@ class Device : public vvl::base::Device {
                                                                VkSubresourceLayout2 *pLayout, const Context &context) const;
 
     bool ValidateViewport(const VkViewport &viewport, VkCommandBuffer object, const Location &loc) const;
+    // Branch free passes over a whole array, true when no element can fail the per element checks. These only run when it is
+    // false, to find and report the elements at fault.
+    bool AreViewportsValid(const VkViewport *viewports, uint32_t count) const;
+    static bool AreScissorsValid(const VkRect2D *scissors, uint32_t count);
 
     bool manual_PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                   const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
@@ -15,12 +15,14 @@
  * limitations under the License.
  */
 
+#include <atomic>
 #include <vulkan/utility/vk_format_utils.h>
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/video_session_state.h"
 #include "state_tracker/render_pass_state.h"
 #include "sync/sync_access_context.h"
 #include "sync/sync_image.h"
+#include "utils/hash_util.h"
 
 bool SimpleBinding(const vvl::Bindable &bindable) { return !bindable.sparse && bindable.Binding(); }
 VkDeviceSize ResourceBaseAddress(const vvl::Buffer &buffer) { return buffer.GetFakeBaseAddress(); }
@@ -73,19 +75,45 @@ class HazardDetectFirstUse {
     const ResourceUsageRange &tag_range_;
 };
 
+SubpassBarriers MakeSubpassBarriers(VkQueueFlags queue_flags, const SubpassDependencyGraphNode &dependency) {
+    auto make_barriers = [queue_flags](const std::vector<const VkSubpassDependency2 *> &subpass_dependencies) {
+        std::vector<SyncBarrier> barriers;
+        barriers.reserve(subpass_dependencies.size());
+        for (const VkSubpassDependency2 *subpass_dependency : subpass_dependencies) {
+            assert(subpass_dependency);
+            barriers.emplace_back(queue_flags, *subpass_dependency);
+        }
+        return barriers;
+    };
+    SubpassBarriers barriers;
+    barriers.prev.reserve(dependency.prev.size());
+    for (const auto &prev_dep : dependency.prev) {
+        assert(prev_dep.second.size());
+        barriers.prev.emplace_back(make_barriers(prev_dep.second));
+    }
+    barriers.from_external = make_barriers(dependency.barrier_from_external);
+    barriers.to_external = make_barriers(dependency.barrier_to_external);
+    return barriers;
+}
+
 AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
                              const std::vector<SubpassDependencyGraphNode> &dependencies,
-                             const std::vector<AccessContext> &contexts, const AccessContext *external_context) {
+                             const std::vector<AccessContext> &contexts, const AccessContext *external_context)
+    : AccessContext(subpass, dependencies, MakeSubpassBarriers(queue_flags, dependencies[subpass]), contexts, external_context) {}
+
+AccessContext::AccessContext(uint32_t subpass, const std::vector<SubpassDependencyGraphNode> &dependencies,
+                             const SubpassBarriers &barriers, const std::vector<AccessContext> &contexts,
+                             const AccessContext *external_context) {
     Reset();
     const auto &subpass_dep = dependencies[subpass];
-    const bool has_barrier_from_external = subpass_dep.barrier_from_external.size() > 0U;
+    assert(barriers.prev.size() == subpass_dep.prev.size());
+    const bool has_barrier_from_external = barriers.from_external.size() > 0U;
     prev_.reserve(subpass_dep.prev.size() + (has_barrier_from_external ? 1U : 0U));
     prev_by_subpass_.resize(subpass, nullptr);  // Can't be more prevs than the subpass we're on
+    size_t prev_index = 0;
     for (const auto &prev_dep : subpass_dep.prev) {
         const auto prev_pass = prev_dep.first->pass;
-        const auto &prev_barriers = prev_dep.second;
-        assert(prev_dep.second.size());
-        prev_.emplace_back(&contexts[prev_pass], queue_flags, prev_barriers);
+        prev_.emplace_back(&contexts[prev_pass], barriers.prev[prev_index++]);
         prev_by_subpass_[prev_pass] = &prev_.back();
     }
 
@@ -97,11 +125,11 @@ AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
 
     if (has_barrier_from_external) {
         // Store the barrier from external with the reat, but save pointer for "by subpass" lookups.
-        prev_.emplace_back(external_context, queue_flags, subpass_dep.barrier_from_external);
+        prev_.emplace_back(external_context, barriers.from_external);
         src_external_ = &prev_.back();
     }
-    if (subpass_dep.barrier_to_external.size()) {
-        dst_external_ = TrackBack(this, queue_flags, subpass_dep.barrier_to_external);
+    if (barriers.to_external.size()) {
+        dst_external_ = TrackBack(this, barriers.to_external);
     }
 }
 
@@ -542,20 +570,104 @@ void AccessContext::UpdateMemoryAccessStateFunctor::operator()(const ResourceAcc
 
 // This is called with the *recorded* command buffers access context, with the *active* access context pass in, againsts which
 // hazards will be detected
+void AccessContext::GatherFirstUseEntries(const ResourceUsageRange &tag_range, FirstUseEntries &entries) const {
+    for (auto it = access_state_map_.cbegin(); it != access_state_map_.cend(); ++it) {
+        if (it->second.FirstAccessInTagRange(tag_range)) {
+            entries.emplace_back(it);
+        }
+    }
+}
+
 HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
-                                                 const AccessContext &access_context) const {
-    for (const auto &recorded_access : access_state_map_) {
-        // Cull any entries not in the current tag range
-        if (!recorded_access.second.FirstAccessInTagRange(tag_range)) continue;
+                                                 const AccessContext &access_context, vvl::TaskPool *task_pool,
+                                                 const FirstUseEntries *first_use_entries) const {
+    auto detect_entry = [&](const ResourceAccessRangeMap::value_type &recorded_access) {
         HazardDetectFirstUse detector(recorded_access.second, queue_id, tag_range);
-        HazardResult hazard = access_context.DetectHazardRange(detector, recorded_access.first, DetectOptions::kDetectAll);
+        return access_context.DetectHazardRange(detector, recorded_access.first, DetectOptions::kDetectAll);
+    };
+
+    constexpr size_t kMinParallelEntries = 1024;
+    constexpr size_t kChunkEntries = 256;
+    if (!first_use_entries && (!task_pool || access_state_map_.size() < kMinParallelEntries)) {
+        for (const auto &recorded_access : access_state_map_) {
+            // Cull any entries not in the current tag range
+            if (!recorded_access.second.FirstAccessInTagRange(tag_range)) continue;
+            HazardResult hazard = detect_entry(recorded_access);
+            if (hazard.IsHazard()) {
+                return hazard;
+            }
+        }
+        return {};
+    }
+
+    FirstUseEntries gathered_entries;
+    if (!first_use_entries) {
+        GatherFirstUseEntries(tag_range, gathered_entries);
+        first_use_entries = &gathered_entries;
+    }
+    const FirstUseEntries &entries = *first_use_entries;
+
+    auto detect_entries = [&](size_t begin, size_t end, const std::atomic<size_t> *stop_chunk, size_t chunk) -> HazardResult {
+        for (size_t entry = begin; entry < end; ++entry) {
+            // A chunk that comes before found a hazard, which is the one reported
+            if (stop_chunk && stop_chunk->load(std::memory_order_relaxed) < chunk) break;
+            HazardResult hazard = detect_entry(*entries[entry]);
+            if (hazard.IsHazard()) {
+                return hazard;
+            }
+        }
+        return {};
+    };
+    if (!task_pool || entries.size() < kMinParallelEntries) {
+        return detect_entries(0, entries.size(), nullptr, 0);
+    }
+
+    // The detection only reads both contexts, so the entries can be split in chunks checked on the pool. The hazard of the first
+    // chunk that has one is the one the sequential loop finds.
+    const size_t chunk_count = (entries.size() + kChunkEntries - 1) / kChunkEntries;
+    std::vector<HazardResult> hazards(chunk_count);
+    std::atomic<size_t> hazard_chunk{chunk_count};
+    task_pool->ParallelFor(static_cast<uint32_t>(chunk_count), [&](uint32_t chunk) {
+        const size_t begin = chunk * kChunkEntries;
+        hazards[chunk] = detect_entries(begin, std::min(begin + kChunkEntries, entries.size()), &hazard_chunk, chunk);
+        if (hazards[chunk].IsHazard()) {
+            size_t current = hazard_chunk.load(std::memory_order_relaxed);
+            while (chunk < current && !hazard_chunk.compare_exchange_weak(current, chunk, std::memory_order_relaxed)) {
+            }
+        }
+    });
+    for (auto &hazard : hazards) {
         if (hazard.IsHazard()) {
-            return hazard;
+            return std::move(hazard);
         }
     }
     return {};
 }
 
+std::optional<size_t> AccessContext::FirstUseFingerprint(QueueId queue_id, const ResourceUsageRange &tag_range,
+                                                        const AccessContext &access_context) const {
+    if (!access_context.prev_.empty() || !access_context.async_.empty()) {
+        return {};
+    }
+    hash_util::HashCombiner hc;
+    hc << queue_id;
+    const ResourceAccessRangeMap &exec_map = access_context.access_state_map_;
+    auto pos = exec_map.begin();
+    for (const auto &recorded_access : access_state_map_) {
+        if (!recorded_access.second.FirstAccessInTagRange(tag_range)) continue;
+        const ResourceAccessRange &range = recorded_access.first;
+        if (pos != exec_map.end() && pos->first.strictly_less(range)) {
+            pos = exec_map.lower_bound(range);
+        }
+        // The gaps are not checked, so the intersections with the exec entries are what matters
+        for (auto it = pos; it != exec_map.end() && it->first.begin < range.end; ++it) {
+            const ResourceAccessRange overlap = it->first & range;
+            hc << overlap.begin << overlap.end << it->second.DetectionHash();
+        }
+    }
+    return hc.Value();
+}
+
 // For RenderPass time validation this is "start tag", for QueueSubmit, this is the earliest
 // unsynchronized tag for the Queue being tested against (max synchrononous + 1, perhaps)
 ResourceUsageTag AccessContext::AsyncReference::StartTag() const { return (tag_ == kInvalidTag) ? context_->StartTag() : tag_; }
@@ -17,8 +17,14 @@
 
 #pragma once
 
+#include "containers/scratch_arena.h"
 #include "sync/sync_common.h"
 #include "sync/sync_access_state.h"
+#include "sync/sync_stats.h"
+
+namespace vvl {
+class TaskPool;
+}  // namespace vvl
 
 struct SubpassDependencyGraphNode;
 
@@ -102,8 +108,8 @@ struct NoopBarrierAction {
 
 // This functor applies a collection of barriers, updating the "pending state" in each touched memory range, and optionally
 // resolves the pending state. Suitable for processing Global memory barriers, or Subpass Barriers when the "final" barrier
-// of a collection is known/present.
-template <typename BarrierOp, typename OpVector = std::vector<BarrierOp>>
+// of a collection is known/present. The ops only live for one barrier command, they come from the thread's scratch arena.
+template <typename BarrierOp, typename OpVector = vvl::ScratchVector<BarrierOp>>
 class ApplyBarrierOpsFunctor {
   public:
     using Iterator = ResourceAccessRangeMap::iterator;
@@ -118,6 +124,7 @@ class ApplyBarrierOpsFunctor {
     }
 
     void operator()(const Iterator &pos) const {
+        syncval_stats::CountBarrierRange();
         auto &access_state = pos->second;
         for (const auto &op : barrier_ops_) {
             op(&access_state);
@@ -209,20 +216,21 @@ struct SubpassBarrierTrackback {
     const SubpassNode *source_subpass = nullptr;
     SubpassBarrierTrackback() = default;
     SubpassBarrierTrackback(const SubpassBarrierTrackback &) = default;
-    SubpassBarrierTrackback(const SubpassNode *source_subpass_, VkQueueFlags queue_flags_,
-                            const std::vector<const VkSubpassDependency2 *> &subpass_dependencies_)
-        : barriers(), source_subpass(source_subpass_) {
-        barriers.reserve(subpass_dependencies_.size());
-        for (const VkSubpassDependency2 *dependency : subpass_dependencies_) {
-            assert(dependency);
-            barriers.emplace_back(queue_flags_, *dependency);
-        }
-    }
     SubpassBarrierTrackback(const SubpassNode *source_subpass_, const SyncBarrier &barrier_)
         : barriers(1, barrier_), source_subpass(source_subpass_) {}
+    SubpassBarrierTrackback(const SubpassNode *source_subpass_, const std::vector<SyncBarrier> &barriers_)
+        : barriers(barriers_), source_subpass(source_subpass_) {}
     SubpassBarrierTrackback &operator=(const SubpassBarrierTrackback &) = default;
 };
 
+// The barriers of the dependencies of one subpass, |prev| is in the order of SubpassDependencyGraphNode::prev
+struct SubpassBarriers {
+    std::vector<std::vector<SyncBarrier>> prev;
+    std::vector<SyncBarrier> from_external;
+    std::vector<SyncBarrier> to_external;
+};
+SubpassBarriers MakeSubpassBarriers(VkQueueFlags queue_flags, const SubpassDependencyGraphNode &dependency);
+
 class AttachmentViewGen {
   public:
     enum Gen { kViewSubresource = 0, kRenderArea = 1, kDepthOnlyRenderArea = 2, kStencilOnlyRenderArea = 3, kGenSize = 4 };
@@ -279,8 +287,19 @@ class AccessContext {
                                           DetectOptions options) const;
     HazardResult DetectSubpassTransitionHazard(const TrackBack &track_back, const AttachmentViewGen &attach_view) const;
 
-    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
-                                      const AccessContext &access_context) const;
+    // Entries of the access map that have first accesses in a tag range, in map order
+    using FirstUseEntries = std::vector<ResourceAccessRangeMap::const_iterator>;
+    void GatherFirstUseEntries(const ResourceUsageRange &tag_range, FirstUseEntries &entries) const;
+
+    // With a |task_pool|, large contexts are checked in parallel. The hazard is the same as the one found without it.
+    // |first_use_entries| are the entries gathered for |tag_range|, when the caller kept them from a previous check.
+    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range, const AccessContext &access_context,
+                                      vvl::TaskPool *task_pool = nullptr,
+                                      const FirstUseEntries *first_use_entries = nullptr) const;
+    // Hash of the |access_context| states that DetectFirstUseHazard reads for |tag_range|: two contexts with the same fingerprint
+    // give the same verdict. Empty when |access_context| refers to other contexts, which accesses are not part of the hash.
+    std::optional<size_t> FirstUseFingerprint(QueueId queue_id, const ResourceUsageRange &tag_range,
+                                              const AccessContext &access_context) const;
 
     const TrackBack &GetDstExternalTrackBack() const { return dst_external_; }
     void Reset() {
@@ -334,6 +353,8 @@ class AccessContext {
 
     AccessContext(uint32_t subpass, VkQueueFlags queue_flags, const std::vector<SubpassDependencyGraphNode> &dependencies,
                   const std::vector<AccessContext> &contexts, const AccessContext *external_context);
+    AccessContext(uint32_t subpass, const std::vector<SubpassDependencyGraphNode> &dependencies, const SubpassBarriers &barriers,
+                  const std::vector<AccessContext> &contexts, const AccessContext *external_context);
 
     AccessContext() { Reset(); }
     AccessContext(const AccessContext &copy_from) = default;
@@ -527,6 +548,7 @@ HazardResult AccessContext::DetectAsyncHazard(const Detector &detector, const Ra
     auto do_async_hazard_check = [&detector, async_tag, async_queue_id, &hazard](const RangeType &range, const ConstIterator &end,
                                                                                  ConstIterator &pos) {
         while (pos != end && pos->first.begin < range.end) {
+            syncval_stats::CountHazardCheck();
             hazard = detector.DetectAsync(pos, async_tag, async_queue_id);
             if (hazard.IsHazard()) return true;
             ++pos;
@@ -561,6 +583,7 @@ HazardResult AccessContext::DetectHazardOneRange(Detector &detector, bool detect
             gap.begin = pos->first.end;
         }
 
+        syncval_stats::CountHazardCheck();
         hazard = detector.Detect(pos);
         if (hazard.IsHazard()) return hazard;
         ++pos;
@@ -684,6 +707,7 @@ HazardResult AccessContext::DetectPreviousHazard(Detector &detector, const Resou
     ResolvePreviousAccess(range, &descent_map, nullptr);
 
     for (auto prev = descent_map.begin(); prev != descent_map.end(); ++prev) {
+        syncval_stats::CountHazardCheck();
         HazardResult hazard = detector.Detect(prev);
         if (hazard.IsHazard()) {
             return hazard;
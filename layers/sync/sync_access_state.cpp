@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 #include "sync/sync_access_state.h"
+#include "utils/hash_util.h"
 #include "utils/sync_utils.h"
 #include <vulkan/utility/vk_struct_helper.hpp>
 
@@ -535,6 +536,8 @@ void ResourceAccessState::ClearWrite() { last_write.reset(); }
 
 void ResourceAccessState::ClearRead() {
     last_reads.clear();
+    // Go back to the inline storage, the state is copied on every range split
+    last_reads.shrink_to_fit();
     last_read_stages = VK_PIPELINE_STAGE_2_NONE;
     read_execution_barriers = VK_PIPELINE_STAGE_2_NONE;
     input_attachment_read = false;  // Denotes no outstanding input attachment read after the last write.
@@ -542,6 +545,7 @@ void ResourceAccessState::ClearRead() {
 
 void ResourceAccessState::ClearFirstUse() {
     first_accesses_.clear();
+    first_accesses_.shrink_to_fit();
     first_read_stages_ = VK_PIPELINE_STAGE_2_NONE;
     first_write_layout_ordering_ = OrderingBarrier();
     first_access_closed_ = false;
@@ -637,6 +641,29 @@ bool ResourceAccessState::FirstAccessInTagRange(const ResourceUsageRange &tag_ra
     return tag_range.intersects(first_access_range);
 }
 
+size_t ResourceAccessState::DetectionHash() const {
+    using FlagsHash = std::hash<SyncAccessFlags>;
+    hash_util::HashCombiner hc;
+    if (last_write.has_value()) {
+        const WriteState &write = *last_write;
+        hc << write.access_->access_index;
+        hc.Combine<SyncAccessFlags, FlagsHash>(write.barriers_);
+        hc << write.queue_ << write.flags_ << write.dependency_chain_;
+        hc << write.pending_layout_ordering_.exec_scope << write.pending_dep_chain_;
+        hc.Combine<SyncAccessFlags, FlagsHash>(write.pending_layout_ordering_.access_scope);
+        hc.Combine<SyncAccessFlags, FlagsHash>(write.pending_barriers_);
+    } else {
+        hc << SYNC_ACCESS_INDEX_NONE;
+    }
+    hc << last_read_stages << read_execution_barriers << last_reads.size();
+    for (const ReadState &read_access : last_reads) {
+        hc << read_access.stage << read_access.access_index << read_access.barriers << read_access.sync_stages;
+        hc << read_access.queue << read_access.pending_dep_chain;
+    }
+    hc << input_attachment_read << pending_layout_transition;
+    return hc.Value();
+}
+
 void ResourceAccessState::OffsetTag(ResourceUsageTag offset) {
     if (last_write.has_value()) last_write->OffsetTag(offset);
     for (auto &read_access : last_reads) {
@@ -655,10 +682,10 @@ ResourceAccessState::ResourceAccessState()
       last_reads(),
       input_attachment_read(false),
       pending_layout_transition(false),
+      first_access_closed_(false),
       first_accesses_(),
       first_read_stages_(VK_PIPELINE_STAGE_2_NONE),
-      first_write_layout_ordering_(),
-      first_access_closed_(false) {}
+      first_write_layout_ordering_() {}
 
 VkPipelineStageFlags2 ResourceAccessState::GetReadBarriers(SyncAccessIndex access_index) const {
     for (const auto &read_access : last_reads) {
@@ -17,6 +17,7 @@
 
 #pragma once
 #include "sync/sync_common.h"
+#include "containers/segmented_map.h"
 
 class ResourceAccessState;
 class WriteState;
@@ -294,6 +295,7 @@ class WriteState {
     SyncAccessIndex Index() const { return access_->access_index; }
     bool IsIndex(SyncAccessIndex access_index) const { return Index() == access_index; }
     bool IsQueue(QueueId other_queue) const { return queue_ == other_queue; }
+    QueueId Queue() const { return queue_; }
     const SyncAccessInfo &Access() const { return *access_; }
     const SyncAccessFlags &Barriers() const { return barriers_; }
     ResourceUsageTag Tag() const { return tag_; }
@@ -337,7 +339,9 @@ class WriteState {
 class ResourceAccessState {
   protected:
     using OrderingBarriers = std::array<OrderingBarrier, static_cast<size_t>(SyncOrdering::kNumOrderings)>;
-    using FirstAccesses = small_vector<ResourceFirstAccess, 3>;
+    // Most states have at most one first access and one read, the inline storage is sized for that case so that the
+    // copies made by the range map splits stay small. More entries move to the heap.
+    using FirstAccesses = small_vector<ResourceFirstAccess, 1>;
 
   public:
     HazardResult DetectHazard(const SyncAccessInfo &usage_info) const;
@@ -394,9 +398,25 @@ class ResourceAccessState {
 
     template <typename Predicate>
     bool ApplyPredicatedWait(Predicate &predicate);
+    // Calls func(queue, tag) for the reads and the write that a tagged wait can clear (present engine accesses are never waited)
+    template <typename Func>
+    void ForEachTagWaitableAccess(Func &&func) const {
+        for (const ReadState &read_access : last_reads) {
+            if (read_access.stage != VK_PIPELINE_STAGE_2_PRESENT_ENGINE_BIT_SYNCVAL) {
+                func(read_access.queue, read_access.tag);
+            }
+        }
+        if (last_write.has_value() && !last_write->IsIndex(SYNC_PRESENT_ENGINE_SYNCVAL_PRESENT_PRESENTED_SYNCVAL)) {
+            func(last_write->Queue(), last_write->Tag());
+        }
+    }
 
     bool FirstAccessInTagRange(const ResourceUsageRange &tag_range) const;
 
+    // Hash of the state read when a recorded access is checked against this one. Tags and handles are left out, they only
+    // matter to report a hazard.
+    size_t DetectionHash() const;
+
     void OffsetTag(ResourceUsageTag offset);
     ResourceAccessState();
 
@@ -405,6 +425,7 @@ class ResourceAccessState {
     SyncAccessIndex LastWriteOp() const { return last_write.has_value() ? last_write->Index() : SYNC_ACCESS_INDEX_NONE; }
     bool IsLastWriteOp(SyncAccessIndex access_index) const { return LastWriteOp() == access_index; }
     ResourceUsageTag LastWriteTag() const { return last_write.has_value() ? last_write->Tag() : ResourceUsageTag(0); }
+    uint32_t LastReadCount() const { return last_reads.size(); }
     bool operator==(const ResourceAccessState &rhs) const {
         const bool write_same = (read_execution_barriers == rhs.read_execution_barriers) &&
                                 (input_attachment_read == rhs.input_attachment_read) && (last_write == rhs.last_write);
@@ -437,6 +458,10 @@ class ResourceAccessState {
         bool ReadInScope(const SyncBarrier &barrier, const ReadState &read_state) const {
             return read_state.ReadInScopeOrChain(barrier.src_exec_scope.exec_scope);
         }
+        // True when the stage of every read is in the source scope, so ReadInScope is true for all of them
+        bool AllReadsInScope(const SyncBarrier &barrier, const ResourceAccessState &access) const {
+            return (barrier.src_exec_scope.exec_scope & access.last_read_stages) == access.last_read_stages;
+        }
     };
 
     struct QueueScopeOps {
@@ -446,6 +471,7 @@ class ResourceAccessState {
         bool ReadInScope(const SyncBarrier &barrier, const ReadState &read_state) const {
             return read_state.ReadInQueueScopeOrChain(queue, barrier.src_exec_scope.exec_scope);
         }
+        bool AllReadsInScope(const SyncBarrier &, const ResourceAccessState &) const { return false; }
         QueueScopeOps(QueueId scope_queue) : queue(scope_queue) {}
         QueueId queue;
     };
@@ -457,6 +483,7 @@ class ResourceAccessState {
         bool ReadInScope(const SyncBarrier &barrier, const ReadState &read_state) const {
             return read_state.ReadInEventScope(barrier.src_exec_scope.exec_scope, scope_queue, scope_tag);
         }
+        bool AllReadsInScope(const SyncBarrier &, const ResourceAccessState &) const { return false; }
         EventScopeOps(QueueId qid, ResourceUsageTag event_tag) : scope_queue(qid), scope_tag(event_tag) {}
         QueueId scope_queue;
         ResourceUsageTag scope_tag;
@@ -506,9 +533,11 @@ class ResourceAccessState {
 
     VkPipelineStageFlags2 last_read_stages;
     VkPipelineStageFlags2 read_execution_barriers;
-    using ReadStates = small_vector<ReadState, 3, uint32_t>;
+    using ReadStates = small_vector<ReadState, 1, uint32_t>;
     ReadStates last_reads;
 
+    // The flags are grouped to avoid padding
+
     // TODO Input Attachment cleanup for multiple reads in a given stage
     // Tracks whether the fragment shader read is input attachment read
     bool input_attachment_read;
@@ -516,17 +545,23 @@ class ResourceAccessState {
     // Not part of the write state, logically.  Can exist when !last_write
     // Pending execution state to support independent parallel barriers
     bool pending_layout_transition;
+
+    bool first_access_closed_;
     uint32_t pending_layout_transition_handle_index = vvl::kNoIndex32;
 
     FirstAccesses first_accesses_;
     VkPipelineStageFlags2 first_read_stages_;
     OrderingBarrier first_write_layout_ordering_;
-    bool first_access_closed_;
 
     static OrderingBarriers kOrderingRules;
 };
 using ResourceAccessStateFunction = std::function<void(ResourceAccessState *)>;
+#if defined(VVL_SYNCVAL_SEGMENTED_MAP)
+using ResourceAccessRangeMap = sparse_container::range_map<ResourceAddress, ResourceAccessState, ResourceAccessRange,
+                                                           sparse_container::segmented_map<ResourceAccessRange, ResourceAccessState>>;
+#else
 using ResourceAccessRangeMap = sparse_container::range_map<ResourceAddress, ResourceAccessState>;
+#endif
 using ResourceRangeMergeIterator = sparse_container::parallel_iterator<ResourceAccessRangeMap, const ResourceAccessRangeMap>;
 
 // Apply the memory barrier without updating the existing barriers.  The execution barrier
@@ -558,6 +593,14 @@ void ResourceAccessState::ApplyBarrier(ScopeOps &&scope, const SyncBarrier &barr
         if (!pending_layout_transition) {
             // Once we're dealing with a layout transition (which is modelled as a *write*) then the last reads/chains
             // don't need to be tracked as we're just going to clear them.
+            if (scope.AllReadsInScope(barrier, *this)) {
+                // Common case of a barrier with all the read stages in its source scope (ex: ALL_COMMANDS), every read gets
+                // the barrier without the two passes below
+                for (auto &read_access : last_reads) {
+                    read_access.ApplyReadBarrier(barrier.dst_exec_scope.exec_scope);
+                }
+                return;
+            }
             VkPipelineStageFlags2 stages_in_scope = VK_PIPELINE_STAGE_2_NONE;
 
             for (auto &read_access : last_reads) {
@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <vulkan/utility/vk_format_utils.h>
 #include "sync/sync_commandbuffer.h"
 #include "error_message/error_location.h"
@@ -234,6 +235,7 @@ CommandBufferAccessContext::CommandBufferAccessContext(const CommandBufferAccess
     // Copy only the needed fields out of from for a temporary, proxy command buffer context
     cb_state_ = from.cb_state_;
     access_log_ = std::make_shared<AccessLog>(*from.access_log_);  // potentially large, but no choice given tagging lookup.
+    sync_state_.stats.AddAccessLogRecords(access_log_->size());
     command_number_ = from.command_number_;
     reset_count_ = from.reset_count_;
 
@@ -252,25 +254,59 @@ CommandBufferAccessContext::CommandBufferAccessContext(const CommandBufferAccess
 
     // We don't want to copy the full render_pass_context_ history just for the proxy.
     sync_state_.stats.AddCommandBufferContext();
+    UpdateAccessLogAccounting();
 }
 
 CommandBufferAccessContext::~CommandBufferAccessContext() {
     sync_state_.stats.RemoveCommandBufferContext();
     sync_state_.stats.RemoveHandleRecord((uint32_t)handles_.size());
+    sync_state_.stats.RemoveAccessLogRecords(access_log_->size());
+    sync_state_.memory_accounting.Sub(vvl::profiling::MemorySubsystem::SyncAccessLogs, accounted_log_bytes_);
+}
+
+// The log grows by a record per command, so it is accounted when recording ends instead of at each command. A log that is
+// still held by submitted batches after a reset stops being counted.
+void CommandBufferAccessContext::UpdateAccessLogAccounting() {
+    const uint64_t bytes = access_log_->capacity() * sizeof(ResourceUsageRecord) + handles_.capacity() * sizeof(HandleRecord);
+    auto &memory_accounting = sync_state_.memory_accounting;
+    if (bytes > accounted_log_bytes_) {
+        memory_accounting.Add(vvl::profiling::MemorySubsystem::SyncAccessLogs, bytes - accounted_log_bytes_);
+    } else {
+        memory_accounting.Sub(vvl::profiling::MemorySubsystem::SyncAccessLogs, accounted_log_bytes_ - bytes);
+    }
+    accounted_log_bytes_ = bytes;
 }
 
 void CommandBufferAccessContext::Reset() {
-    access_log_ = std::make_shared<AccessLog>();
-    cbs_referenced_ = std::make_shared<CommandBufferSet>();
+    // Submitted batches can still hold the previous log and references, the storage is only reused when they are gone
+    sync_state_.stats.RemoveAccessLogRecords(access_log_->size());
+    if (access_log_.use_count() == 1) {
+        access_log_->clear();
+    } else {
+        access_log_ = std::make_shared<AccessLog>();
+    }
+    if (cbs_referenced_.use_count() == 1) {
+        cbs_referenced_->clear();
+    } else {
+        cbs_referenced_ = std::make_shared<CommandBufferSet>();
+    }
     if (cb_state_) {
         cbs_referenced_->push_back(cb_state_->shared_from_this());
     }
     sync_ops_.clear();
+    {
+        std::lock_guard<std::mutex> guard(first_use_cache_lock_);
+        first_use_cache_.clear();
+        first_use_fingerprints_.clear();
+        next_first_use_fingerprint_ = 0;
+    }
     command_number_ = 0;
     reset_count_++;
 
     sync_state_.stats.RemoveHandleRecord((uint32_t)handles_.size());
     handles_.clear();
+    prev_command_first_handle_ = vvl::kNoIndex32;
+    prev_command_handle_count_ = 0;
 
     current_command_tag_ = vvl::kNoIndex32;
     cb_access_context_.Reset();
@@ -279,10 +315,13 @@ void CommandBufferAccessContext::Reset() {
     current_renderpass_context_ = nullptr;
     events_context_.Clear();
     dynamic_rendering_info_.reset();
+    last_dynamic_rendering_info_.reset();
+    UpdateAccessLogAccounting();
 }
 
 bool CommandBufferAccessContext::ValidateBeginRendering(const ErrorObject &error_obj,
                                                         syncval_state::BeginRenderingCmdState &cmd_state) const {
+    VVL_CheckStatsScope(sync_state_.dispatch_device_, "CommandBufferAccessContext::ValidateBeginRendering");
     bool skip = false;
     const syncval_state::DynamicRenderingInfo &info = cmd_state.GetRenderingInfo();
 
@@ -305,16 +344,16 @@ bool CommandBufferAccessContext::ValidateBeginRendering(const ErrorObject &error
         if (hazard.IsHazard()) {
             LogObjectList objlist(cb_state_->Handle(), attachment.view->Handle());
 
-            std::stringstream ss;
-            ss << vvl::String(vvl::Field::pRenderingInfo) << ".";
-            ss << attachment.GetLocation(error_obj.location, i).Fields();
-            ss << " (" << sync_state_.FormatHandle(attachment.view->Handle());
-            ss << ", loadOp " << string_VkAttachmentLoadOp(attachment.info.loadOp) << ")";
-            std::string resource_description = ss.str();
-
-            const std::string error = sync_state_.error_messages_.BeginRenderingError(hazard, *this, error_obj.location.function,
-                                                                                      resource_description, attachment.info.loadOp);
-            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, error_obj.location.function, error);
+            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, error_obj.location.function, [&]() {
+                std::stringstream ss;
+                ss << vvl::String(vvl::Field::pRenderingInfo) << ".";
+                ss << attachment.GetLocation(error_obj.location, i).Fields();
+                ss << " (" << sync_state_.FormatHandle(attachment.view->Handle());
+                ss << ", loadOp " << string_VkAttachmentLoadOp(attachment.info.loadOp) << ")";
+                const std::string resource_description = ss.str();
+                return sync_state_.error_messages_.BeginRenderingError(hazard, *this, error_obj.location.function,
+                                                                       resource_description, attachment.info.loadOp);
+            });
             if (skip) {
                 break;
             }
@@ -375,9 +414,10 @@ bool CommandBufferAccessContext::ValidateEndRendering(const ErrorObject &error_o
                 ss << ", resolveMode " << string_VkResolveModeFlagBits(attachment.info.resolveMode) << ")";
                 const std::string resource_description = ss.str();
 
-                const std::string error = sync_state_.error_messages_.EndRenderingResolveError(
-                    hazard, *this, error_obj.location.function, resource_description, attachment.info.resolveMode, false);
-                skip |= sync_state_.SyncError(hazard.Hazard(), objlist, error_obj.location.function, error);
+                skip |= sync_state_.SyncError(hazard.Hazard(), objlist, error_obj.location.function, [&]() {
+                    return sync_state_.error_messages_.EndRenderingResolveError(
+                        hazard, *this, error_obj.location.function, resource_description, attachment.info.resolveMode, false);
+                });
                 if (skip) {
                     break;
                 }
@@ -392,9 +432,10 @@ bool CommandBufferAccessContext::ValidateEndRendering(const ErrorObject &error_o
                 ss << ", resolveMode " << string_VkResolveModeFlagBits(attachment.info.resolveMode) << ")";
                 const std::string resource_description = ss.str();
 
-                const std::string error = sync_state_.error_messages_.EndRenderingResolveError(
-                    hazard, *this, error_obj.location.function, resource_description, attachment.info.resolveMode, true);
-                skip |= sync_state_.SyncError(hazard.Hazard(), objlist, error_obj.location.function, error);
+                skip |= sync_state_.SyncError(hazard.Hazard(), objlist, error_obj.location.function, [&]() {
+                    return sync_state_.error_messages_.EndRenderingResolveError(
+                        hazard, *this, error_obj.location.function, resource_description, attachment.info.resolveMode, true);
+                });
                 if (skip) {
                     break;
                 }
@@ -413,9 +454,10 @@ bool CommandBufferAccessContext::ValidateEndRendering(const ErrorObject &error_o
                 ss << ", storeOp " << string_VkAttachmentStoreOp(attachment.info.storeOp) << ")";
                 const std::string resource_description = ss.str();
 
-                const std::string error = sync_state_.error_messages_.EndRenderingStoreError(
-                    hazard, *this, error_obj.location.function, resource_description, attachment.info.storeOp);
-                skip |= sync_state_.SyncError(hazard.Hazard(), objlist, error_obj.location.function, error);
+                skip |= sync_state_.SyncError(hazard.Hazard(), objlist, error_obj.location.function, [&]() {
+                    return sync_state_.error_messages_.EndRenderingStoreError(hazard, *this, error_obj.location.function,
+                                                                              resource_description, attachment.info.storeOp);
+                });
                 if (skip) {
                     break;
                 }
@@ -448,11 +490,14 @@ void CommandBufferAccessContext::RecordEndRendering(const RecordObject &record_o
         }
     }
 
-    dynamic_rendering_info_.reset();
+    if (dynamic_rendering_info_) {
+        last_dynamic_rendering_info_ = std::move(dynamic_rendering_info_);
+    }
 }
 
 bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint,
                                                                    const Location &loc) const {
+    VVL_CheckStatsScope(sync_state_.dispatch_device_, "CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet");
     bool skip = false;
     if (!sync_state_.syncval_settings.shader_accesses_heuristic) {
         return skip;
@@ -532,11 +577,12 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
 
                         if (hazard.IsHazard() && !sync_state_.SuppressedBoundDescriptorWAW(hazard)) {
                             LogObjectList objlist(cb_state_->Handle(), img_view_state->Handle(), pipe->Handle());
-                            const auto error = error_messages_.ImageDescriptorError(
-                                hazard, *this, loc.function, sync_state_.FormatHandle(*img_view_state), *pipe,
-                                variable.decorations.set, *descriptor_set, descriptor_type, variable.decorations.binding, index,
-                                stage_state.GetStage(), image_layout);
-                            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
+                            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, [&]() {
+                                return error_messages_.ImageDescriptorError(
+                                    hazard, *this, loc.function, sync_state_.FormatHandle(*img_view_state), *pipe,
+                                    variable.decorations.set, *descriptor_set, descriptor_type, variable.decorations.binding, index,
+                                    stage_state.GetStage(), image_layout);
+                            });
                         }
                         break;
                     }
@@ -551,11 +597,12 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                         auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
                         if (hazard.IsHazard() && !sync_state_.SuppressedBoundDescriptorWAW(hazard)) {
                             LogObjectList objlist(cb_state_->Handle(), buf_view_state->Handle(), pipe->Handle());
-                            const auto error = error_messages_.BufferDescriptorError(
-                                hazard, *this, loc.function, sync_state_.FormatHandle(*buf_view_state), *pipe,
-                                variable.decorations.set, *descriptor_set, descriptor_type, variable.decorations.binding, index,
-                                stage_state.GetStage());
-                            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
+                            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, [&]() {
+                                return error_messages_.BufferDescriptorError(
+                                    hazard, *this, loc.function, sync_state_.FormatHandle(*buf_view_state), *pipe,
+                                    variable.decorations.set, *descriptor_set, descriptor_type, variable.decorations.binding, index,
+                                    stage_state.GetStage());
+                            });
                         }
                         break;
                     }
@@ -578,10 +625,12 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                         auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
                         if (hazard.IsHazard() && !sync_state_.SuppressedBoundDescriptorWAW(hazard)) {
                             LogObjectList objlist(cb_state_->Handle(), buf_state->Handle(), pipe->Handle());
-                            const auto error = error_messages_.BufferDescriptorError(
-                                hazard, *this, loc.function, sync_state_.FormatHandle(*buf_state), *pipe, variable.decorations.set,
-                                *descriptor_set, descriptor_type, variable.decorations.binding, index, stage_state.GetStage());
-                            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
+                            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, [&]() {
+                                return error_messages_.BufferDescriptorError(
+                                    hazard, *this, loc.function, sync_state_.FormatHandle(*buf_state), *pipe,
+                                    variable.decorations.set, *descriptor_set, descriptor_type, variable.decorations.binding, index,
+                                    stage_state.GetStage());
+                            });
                         }
                         break;
                     }
@@ -601,10 +650,11 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                         if (hazard.IsHazard() && !sync_state_.SuppressedBoundDescriptorWAW(hazard)) {
                             LogObjectList objlist(cb_state_->Handle(), accel->buffer_state->Handle(), pipe->Handle());
                             const std::string resource_description = sync_state_.FormatHandle(accel->Handle());
-                            const std::string error = error_messages_.AccelerationStructureDescriptorError(
-                                hazard, *this, loc.function, resource_description, *pipe, variable.decorations.set, *descriptor_set,
-                                descriptor_type, variable.decorations.binding, index, stage_state.GetStage());
-                            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
+                            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, [&]() {
+                                return error_messages_.AccelerationStructureDescriptorError(
+                                    hazard, *this, loc.function, resource_description, *pipe, variable.decorations.set,
+                                    *descriptor_set, descriptor_type, variable.decorations.binding, index, stage_state.GetStage());
+                            });
                         }
                         break;
                     }
@@ -747,12 +797,14 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
 
 bool CommandBufferAccessContext::ValidateDrawVertex(std::optional<uint32_t> vertexCount, uint32_t firstVertex,
                                                     const Location &loc) const {
+    VVL_CheckStatsScope(sync_state_.dispatch_device_, "CommandBufferAccessContext::ValidateDrawVertex");
     bool skip = false;
     const auto *pipe = cb_state_->GetLastBoundGraphics().pipeline_state;
     if (!pipe) {
         return skip;
     }
 
+    vvl::EpochReclaimer::Scope borrow_scope;
     const auto &binding_buffers = cb_state_->current_vertex_buffer_binding_info;
     const auto &vertex_bindings = pipe->IsDynamic(CB_DYNAMIC_STATE_VERTEX_INPUT_EXT)
                                       ? cb_state_->dynamic_state_value.vertex_bindings
@@ -765,7 +817,7 @@ bool CommandBufferAccessContext::ValidateDrawVertex(std::optional<uint32_t> vert
             continue;
         }
         if (const vvl::VertexBufferBinding *vertex_buffer = vvl::Find(binding_buffers, binding_desc.binding)) {
-            const auto buf_state = sync_state_.Get<vvl::Buffer>(vertex_buffer->buffer);
+            const auto buf_state = sync_state_.GetBorrowed<vvl::Buffer>(vertex_buffer->buffer);
             if (!buf_state) continue;  // also skips if using nullDescriptor
 
             ResourceAccessRange range;
@@ -779,8 +831,9 @@ bool CommandBufferAccessContext::ValidateDrawVertex(std::optional<uint32_t> vert
             if (hazard.IsHazard()) {
                 LogObjectList objlist(cb_state_->Handle(), buf_state->Handle(), pipe->Handle());
                 const std::string resource_description = "vertex " + sync_state_.FormatHandle(*buf_state);
-                const auto error = error_messages_.BufferError(hazard, *this, loc.function, resource_description, range);
-                skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
+                skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, [&]() {
+                    return error_messages_.BufferError(hazard, *this, loc.function, resource_description, range);
+                });
             }
         }
     }
@@ -793,6 +846,7 @@ void CommandBufferAccessContext::RecordDrawVertex(std::optional<uint32_t> vertex
     if (!pipe) {
         return;
     }
+    vvl::EpochReclaimer::Scope borrow_scope;
     const auto &binding_buffers = cb_state_->current_vertex_buffer_binding_info;
     const auto &vertex_bindings = pipe->IsDynamic(CB_DYNAMIC_STATE_VERTEX_INPUT_EXT)
                                       ? cb_state_->dynamic_state_value.vertex_bindings
@@ -805,7 +859,7 @@ void CommandBufferAccessContext::RecordDrawVertex(std::optional<uint32_t> vertex
             continue;
         }
         if (const auto *vertex_buffer = vvl::Find(binding_buffers, binding_desc.binding)) {
-            const auto buf_state = sync_state_.Get<vvl::Buffer>(vertex_buffer->buffer);
+            const auto buf_state = sync_state_.GetBorrowed<vvl::Buffer>(vertex_buffer->buffer);
             if (!buf_state) continue;  // also skips if using nullDescriptor
 
             ResourceAccessRange range;
@@ -823,9 +877,11 @@ void CommandBufferAccessContext::RecordDrawVertex(std::optional<uint32_t> vertex
 }
 
 bool CommandBufferAccessContext::ValidateDrawVertexIndex(uint32_t index_count, uint32_t firstIndex, const Location &loc) const {
+    VVL_CheckStatsScope(sync_state_.dispatch_device_, "CommandBufferAccessContext::ValidateDrawVertexIndex");
     bool skip = false;
+    vvl::EpochReclaimer::Scope borrow_scope;
     const auto &index_binding = cb_state_->index_buffer_binding;
-    const auto index_buf_state = sync_state_.Get<vvl::Buffer>(index_binding.buffer);
+    const auto index_buf_state = sync_state_.GetBorrowed<vvl::Buffer>(index_binding.buffer);
     if (!index_buf_state) return skip;
 
     const auto index_size = GetIndexAlignment(index_binding.index_type);
@@ -838,8 +894,9 @@ bool CommandBufferAccessContext::ValidateDrawVertexIndex(uint32_t index_count, u
             objlist.add(pipe->Handle());
         }
         const std::string resource_description = "index " + sync_state_.FormatHandle(*index_buf_state);
-        const auto error = error_messages_.BufferError(hazard, *this, loc.function, resource_description, range);
-        skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
+        skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, [&]() {
+            return error_messages_.BufferError(hazard, *this, loc.function, resource_description, range);
+        });
     }
 
     // TODO: Shader instrumentation support is needed to read index buffer content and determine more accurate range
@@ -850,8 +907,9 @@ bool CommandBufferAccessContext::ValidateDrawVertexIndex(uint32_t index_count, u
 }
 
 void CommandBufferAccessContext::RecordDrawVertexIndex(uint32_t indexCount, uint32_t firstIndex, const ResourceUsageTag tag) {
+    vvl::EpochReclaimer::Scope borrow_scope;
     const auto &index_binding = cb_state_->index_buffer_binding;
-    const auto index_buf_state = sync_state_.Get<vvl::Buffer>(index_binding.buffer);
+    const auto index_buf_state = sync_state_.GetBorrowed<vvl::Buffer>(index_binding.buffer);
     if (!index_buf_state) return;
 
     const auto index_size = GetIndexAlignment(index_binding.index_type);
@@ -866,6 +924,7 @@ void CommandBufferAccessContext::RecordDrawVertexIndex(uint32_t indexCount, uint
 }
 
 bool CommandBufferAccessContext::ValidateDrawAttachment(const Location &loc) const {
+    VVL_CheckStatsScope(sync_state_.dispatch_device_, "CommandBufferAccessContext::ValidateDrawAttachment");
     bool skip = false;
     if (current_renderpass_context_) {
         skip |= current_renderpass_context_->ValidateDrawSubpassAttachment(*this, loc.function);
@@ -897,9 +956,10 @@ bool CommandBufferAccessContext::ValidateDrawDynamicRenderingAttachment(const Lo
         if (hazard.IsHazard()) {
             LogObjectList obj_list(cb_state_->Handle(), attachment.view->Handle());
             Location loc = attachment.GetLocation(location, output_location);
-            const std::string error = error_messages_.Error(
-                hazard, *this, location.function, sync_state_.FormatHandle(*attachment.view), "DynamicRenderingAttachmentError");
-            skip |= sync_state_.SyncError(hazard.Hazard(), obj_list, loc.dot(vvl::Field::imageView), error);
+            skip |= sync_state_.SyncError(hazard.Hazard(), obj_list, loc.dot(vvl::Field::imageView), [&]() {
+                return error_messages_.Error(hazard, *this, location.function, sync_state_.FormatHandle(*attachment.view),
+                                             "DynamicRenderingAttachmentError");
+            });
         }
     }
 
@@ -921,10 +981,10 @@ bool CommandBufferAccessContext::ValidateDrawDynamicRenderingAttachment(const Lo
             if (hazard.IsHazard()) {
                 LogObjectList objlist(cb_state_->Handle(), attachment.view->Handle());
                 Location loc = attachment.GetLocation(location);
-                const std::string error =
-                    error_messages_.Error(hazard, *this, location.function, sync_state_.FormatHandle(*attachment.view),
-                                          "DynamicRenderingAttachmentError");
-                skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc.dot(vvl::Field::imageView), error);
+                skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc.dot(vvl::Field::imageView), [&]() {
+                    return error_messages_.Error(hazard, *this, location.function, sync_state_.FormatHandle(*attachment.view),
+                                                 "DynamicRenderingAttachmentError");
+                });
             }
         }
     }
@@ -1082,9 +1142,10 @@ bool CommandBufferAccessContext::ValidateClearAttachment(const Location &loc, co
             }
             const std::string resource_description = ss.str();
             const LogObjectList objlist(cb_state_->Handle(), info.attachment_view.Handle());
-            const auto error = error_messages_.ClearAttachmentError(hazard, *this, loc.function, resource_description, aspect,
-                                                                    clear_rect_index, clear_rect);
-            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
+            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, [&]() {
+                return error_messages_.ClearAttachmentError(hazard, *this, loc.function, resource_description, aspect,
+                                                            clear_rect_index, clear_rect);
+            });
         }
     }
 
@@ -1110,9 +1171,10 @@ bool CommandBufferAccessContext::ValidateClearAttachment(const Location &loc, co
                 }
                 const std::string resource_description = ss.str();
                 const LogObjectList objlist(cb_state_->Handle(), info.attachment_view.Handle());
-                const auto error = error_messages_.ClearAttachmentError(hazard, *this, loc.function, resource_description, aspect,
-                                                                        clear_rect_index, clear_rect);
-                skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
+                skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, [&]() {
+                    return error_messages_.ClearAttachmentError(hazard, *this, loc.function, resource_description, aspect,
+                                                                clear_rect_index, clear_rect);
+                });
             }
         }
     }
@@ -1156,8 +1218,9 @@ ResourceUsageTag CommandBufferAccessContext::RecordBeginRenderPass(vvl::Func com
     const auto barrier_tag = NextCommandTag(command, ResourceUsageRecord::SubcommandType::kSubpassTransition);
     AddCommandHandle(barrier_tag, rp_state.Handle());
     const auto load_tag = NextSubcommandTag(command, ResourceUsageRecord::SubcommandType::kLoadOp);
+    const auto subpass_barriers = sync_state_.subpass_barrier_cache_.Get(rp_state, GetQueueFlags());
     render_pass_contexts_.emplace_back(
-        std::make_unique<RenderPassAccessContext>(rp_state, render_area, GetQueueFlags(), attachment_views, &cb_access_context_));
+        std::make_unique<RenderPassAccessContext>(rp_state, render_area, *subpass_barriers, attachment_views, &cb_access_context_));
     current_renderpass_context_ = render_pass_contexts_.back().get();
     current_renderpass_context_->RecordBeginRenderPass(barrier_tag, load_tag);
     current_context_ = &current_renderpass_context_->CurrentContext();
@@ -1196,6 +1259,38 @@ ResourceUsageTag CommandBufferAccessContext::RecordEndRenderPass(vvl::Func comma
 
 void CommandBufferAccessContext::RecordDestroyEvent(vvl::Event *event_state) { GetCurrentEventsContext()->Destroy(event_state); }
 
+const AccessContext::FirstUseEntries &CommandBufferAccessContext::GetFirstUseEntries(const AccessContext &recorded_context,
+                                                                                    const ResourceUsageRange &tag_range) const {
+    std::lock_guard<std::mutex> guard(first_use_cache_lock_);
+    // The map nodes are stable, the returned entries stay valid while other ranges are added
+    FirstUseCacheEntry &cache_entry = first_use_cache_[std::make_pair(&recorded_context, tag_range.begin)];
+    if (cache_entry.tag_range != tag_range) {
+        cache_entry.tag_range = tag_range;
+        cache_entry.entries.clear();
+        recorded_context.GatherFirstUseEntries(tag_range, cache_entry.entries);
+    }
+    return cache_entry.entries;
+}
+
+bool CommandBufferAccessContext::IsFirstUseValidated(size_t fingerprint) const {
+    std::lock_guard<std::mutex> guard(first_use_cache_lock_);
+    return std::find(first_use_fingerprints_.begin(), first_use_fingerprints_.end(), fingerprint) != first_use_fingerprints_.end();
+}
+
+void CommandBufferAccessContext::AddFirstUseValidated(size_t fingerprint) const {
+    std::lock_guard<std::mutex> guard(first_use_cache_lock_);
+    if (std::find(first_use_fingerprints_.begin(), first_use_fingerprints_.end(), fingerprint) != first_use_fingerprints_.end()) {
+        return;
+    }
+    // Replace the oldest one, the states a command buffer is submitted against usually alternate between a few
+    if (first_use_fingerprints_.size() < kMaxFirstUseFingerprints) {
+        first_use_fingerprints_.emplace_back(fingerprint);
+    } else {
+        first_use_fingerprints_[next_first_use_fingerprint_] = fingerprint;
+        next_first_use_fingerprint_ = (next_first_use_fingerprint_ + 1) % kMaxFirstUseFingerprints;
+    }
+}
+
 void CommandBufferAccessContext::RecordExecutedCommandBuffer(const CommandBufferAccessContext &recorded_cb_context) {
     const AccessContext *recorded_context = recorded_cb_context.GetCurrentAccessContext();
     assert(recorded_context);
@@ -1220,6 +1315,7 @@ void CommandBufferAccessContext::ResolveExecutedCommandBuffer(const AccessContex
 void CommandBufferAccessContext::ImportRecordedAccessLog(const CommandBufferAccessContext &recorded_context) {
     cbs_referenced_->emplace_back(recorded_context.GetCBStateShared());
     access_log_->insert(access_log_->end(), recorded_context.access_log_->cbegin(), recorded_context.access_log_->cend());
+    sync_state_.stats.AddAccessLogRecords(recorded_context.access_log_->size());
 
     // Adjust command indices for the log records added from recorded_context.
     const auto &recorded_label_commands = recorded_context.cb_state_->GetLabelCommands();
@@ -1238,9 +1334,15 @@ void CommandBufferAccessContext::ImportRecordedAccessLog(const CommandBufferAcce
 
 ResourceUsageTag CommandBufferAccessContext::NextCommandTag(vvl::Func command, ResourceUsageRecord::SubcommandType subcommand) {
     command_number_++;
+    if (current_command_tag_ < access_log_->size()) {
+        const ResourceUsageRecord &prev_record = (*access_log_)[current_command_tag_];
+        prev_command_first_handle_ = prev_record.first_handle_index;
+        prev_command_handle_count_ = prev_record.handle_count;
+    }
     current_command_tag_ = access_log_->size();
 
     ResourceUsageRecord &record = access_log_->emplace_back(command, command_number_, subcommand, cb_state_, reset_count_);
+    sync_state_.stats.AddAccessLogRecords();
 
     if (!cb_state_->GetLabelCommands().empty()) {
         record.label_command_index = static_cast<uint32_t>(cb_state_->GetLabelCommands().size() - 1);
@@ -1252,6 +1354,7 @@ ResourceUsageTag CommandBufferAccessContext::NextCommandTag(vvl::Func command, R
 ResourceUsageTag CommandBufferAccessContext::NextSubcommandTag(vvl::Func command, ResourceUsageRecord::SubcommandType subcommand) {
     const ResourceUsageTag tag = access_log_->size();
     ResourceUsageRecord &record = access_log_->emplace_back(command, command_number_, subcommand, cb_state_, reset_count_);
+    sync_state_.stats.AddAccessLogRecords();
 
     // By default copy handle range from the main command, but can be overwritten with AddSubcommandHandle.
     const auto &main_command_record = (*access_log_)[current_command_tag_];
@@ -1278,19 +1381,46 @@ ResourceUsageTagEx CommandBufferAccessContext::AddCommandHandle(ResourceUsageTag
 ResourceUsageTagEx CommandBufferAccessContext::AddCommandHandleIndexed(ResourceUsageTag tag, const VulkanTypedHandle &typed_handle,
                                                                        uint32_t index) {
     assert(tag < access_log_->size());
-    const uint32_t handle_index = AddHandle(typed_handle, index);
     // TODO: the following range check is not needed. Test and remove.
-    if (tag < access_log_->size()) {
-        auto &record = (*access_log_)[tag];
-        if (record.first_handle_index == vvl::kNoIndex32) {
-            record.first_handle_index = handle_index;
+    if (tag >= access_log_->size()) {
+        return {tag, AddHandle(typed_handle, index)};
+    }
+    auto &record = (*access_log_)[tag];
+    const HandleRecord handle_record(typed_handle, index);
+    const bool can_share = (tag == current_command_tag_) && (prev_command_first_handle_ != vvl::kNoIndex32);
+
+    if (record.first_handle_index == vvl::kNoIndex32) {
+        if (can_share && prev_command_handle_count_ > 0 && handles_[prev_command_first_handle_] == handle_record) {
+            record.first_handle_index = prev_command_first_handle_;
             record.handle_count = 1;
-        } else {
-            // assert that command handles occupy continuous range
-            assert(handle_index - record.first_handle_index == record.handle_count);
+            return {tag, record.first_handle_index};
+        }
+        record.first_handle_index = AddHandle(typed_handle, index);
+        record.handle_count = 1;
+        return {tag, record.first_handle_index};
+    }
+
+    const uint32_t next_handle_index = record.first_handle_index + record.handle_count;
+    if (next_handle_index != handles_.size()) {
+        // Command handles occupy a continuous range, which is not at the end only when it is shared with the previous command
+        assert(can_share && record.first_handle_index == prev_command_first_handle_);
+        if (record.handle_count < prev_command_handle_count_ && handles_[next_handle_index] == handle_record) {
             record.handle_count++;
+            return {tag, next_handle_index};
+        }
+        // The handles differ from here, copy the shared ones. The indices returned so far point to the same handles in the
+        // shared range, so they stay valid.
+        const uint32_t new_first_handle_index = static_cast<uint32_t>(handles_.size());
+        handles_.reserve(handles_.size() + record.handle_count + 1);
+        for (uint32_t i = 0; i < record.handle_count; ++i) {
+            handles_.emplace_back(handles_[record.first_handle_index + i]);
         }
+        sync_state_.stats.AddHandleRecord(record.handle_count);
+        record.first_handle_index = new_first_handle_index;
     }
+    const uint32_t handle_index = AddHandle(typed_handle, index);
+    assert(handle_index - record.first_handle_index == record.handle_count);
+    record.handle_count++;
     return {tag, handle_index};
 }
 
@@ -1371,13 +1501,19 @@ void CommandBufferSubState::End() {
     // For threads that are dedicated to recording command buffers but do not submit themselves,
     // the end of recording is a logical point to update memory stats
     access_context.GetSyncState().stats.UpdateMemoryStats();
+    access_context.UpdateAccessLogAccounting();
 }
 
 void CommandBufferSubState::Destroy() {
+    // The async submit validation can still be reading the recorded accesses
+    access_context.GetSyncState().DrainSubmitValidation();
     access_context.Destroy();  // must be first to clean up self references correctly.
 }
 
-void CommandBufferSubState::Reset(const Location &loc) { access_context.Reset(); }
+void CommandBufferSubState::Reset(const Location &loc) {
+    access_context.GetSyncState().DrainSubmitValidation();
+    access_context.Reset();
+}
 
 void CommandBufferSubState::NotifyInvalidate(const vvl::StateObject::NodeList &invalid_nodes, bool unlink) {
     for (auto &obj : invalid_nodes) {
@@ -16,6 +16,9 @@
  */
 #pragma once
 
+#include <map>
+#include <mutex>
+
 #include "sync/sync_renderpass.h"
 #include "sync/sync_reporting.h"
 #include "state_tracker/cmd_buffer_state.h"
@@ -73,6 +76,9 @@ struct HandleRecord {
     explicit HandleRecord(const VulkanTypedHandle &typed_handle, uint32_t index = vvl::kNoIndex32)
         : handle(typed_handle.handle), type(typed_handle.type), index(index) {}
     bool IsIndexed() const { return index != vvl::kNoIndex32; }
+    bool operator==(const HandleRecord &other) const {
+        return handle == other.handle && type == other.type && index == other.index;
+    }
 
     VulkanTypedHandle TypedHandle() const {
         VulkanTypedHandle typed_handle;
@@ -202,6 +208,8 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     }
 
     void Reset();
+    // Accounts the bytes of the access log and handle records in MemorySubsystem::SyncAccessLogs
+    void UpdateAccessLogAccounting();
 
     ResourceUsageInfo GetResourceUsageInfo(ResourceUsageTagEx tag_ex) const override;
     AccessContext *GetCurrentAccessContext() override { return current_context_; }
@@ -215,6 +223,7 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     ResourceUsageTag RecordBeginRenderPass(vvl::Func command, const vvl::RenderPass &rp_state, const VkRect2D &render_area,
                                            const std::vector<const vvl::ImageView *> &attachment_views);
 
+    const syncval_state::DynamicRenderingInfo *GetLastDynamicRenderingInfo() const { return last_dynamic_rendering_info_.get(); }
     bool ValidateBeginRendering(const ErrorObject &error_obj, syncval_state::BeginRenderingCmdState &cmd_state) const;
     void RecordBeginRendering(syncval_state::BeginRenderingCmdState &cmd_state, const Location &loc);
     bool ValidateEndRendering(const ErrorObject &error_obj) const;
@@ -279,6 +288,16 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     void ImportRecordedAccessLog(const CommandBufferAccessContext &cb_context);
     const std::vector<SyncOpEntry> &GetSyncOps() const { return sync_ops_; };
 
+    // The first use entries of |recorded_context| (this command buffer's context or one of its subpass contexts) for a tag
+    // range between two sync ops. Every execution of the command buffer replays the same ranges, so they are only gathered once
+    // until the command buffer is reset.
+    const AccessContext::FirstUseEntries &GetFirstUseEntries(const AccessContext &recorded_context,
+                                                             const ResourceUsageRange &tag_range) const;
+    // Fingerprints (see AccessContext::FirstUseFingerprint) of the exec contexts this command buffer was executed against without
+    // a first use hazard. Only kept for a complete recording without sync ops, until the command buffer is reset.
+    bool IsFirstUseValidated(size_t fingerprint) const;
+    void AddFirstUseValidated(size_t fingerprint) const;
+
     // DebugNameProvider
     std::string GetDebugRegionName(const ResourceUsageRecord &record) const override;
 
@@ -308,12 +327,18 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     vvl::CommandBuffer *cb_state_;
 
     std::shared_ptr<AccessLog> access_log_;
+    // Bytes last added to MemorySubsystem::SyncAccessLogs
+    uint64_t accounted_log_bytes_ = 0;
     std::shared_ptr<CommandBufferSet> cbs_referenced_;
     uint32_t command_number_;
     uint32_t reset_count_;
 
     // Handles referenced by the tagged commands
     std::vector<HandleRecord> handles_;
+    // Handle range of the previous command. While a command references the same handles (like consecutive draws and dispatches
+    // with the same bindings), it shares this range instead of adding its own copy of the handles.
+    uint32_t prev_command_first_handle_ = vvl::kNoIndex32;
+    uint32_t prev_command_handle_count_ = 0;
 
     // Location of the current command in the access log (it's not always the last element, there might be
     // subcommands that follow). The subcommands by default reference the same handles as the main command.
@@ -328,9 +353,22 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     RenderPassAccessContext *current_renderpass_context_;
     std::vector<SyncOpEntry> sync_ops_;
 
+    // Filled by the executions of the recorded command buffer, which can be validated from several threads
+    struct FirstUseCacheEntry {
+        ResourceUsageRange tag_range;
+        AccessContext::FirstUseEntries entries;
+    };
+    mutable std::mutex first_use_cache_lock_;
+    mutable std::map<std::pair<const AccessContext *, ResourceUsageTag>, FirstUseCacheEntry> first_use_cache_;
+    static constexpr size_t kMaxFirstUseFingerprints = 8;
+    mutable std::vector<size_t> first_use_fingerprints_;
+    mutable size_t next_first_use_fingerprint_ = 0;
+
     // State during dynamic rendering (dynamic rendering rendering passes must be
     // contained within a single command buffer)
     std::unique_ptr<syncval_state::DynamicRenderingInfo> dynamic_rendering_info_;
+    // The last ended rendering, the next one reuses its range generators when it has the same attachments
+    std::unique_ptr<syncval_state::DynamicRenderingInfo> last_dynamic_rendering_info_;
 
     // Secondary buffer validation uses proxy context and does local update (imitates Record).
     // Because in this case PreRecord is not called, the label state is not updated. We make
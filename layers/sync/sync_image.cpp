@@ -15,9 +15,54 @@
  * limitations under the License.
  */
 #include "sync_image.h"
+#include <algorithm>
 #include "state_tracker/state_tracker.h"
+#include "containers/container_utils.h"
+#include "utils/hash_util.h"
 
-syncval_state::ImageSubState::ImageSubState(vvl::Image &image) : vvl::ImageSubState(image), fragment_encoder(image) {}
+syncval_state::ImageEncoderCache::Key::Key(const vvl::Image &image)
+    : format(image.create_info.format),
+      image_type(image.create_info.imageType),
+      extent(image.create_info.extent),
+      mip_levels(image.create_info.mipLevels),
+      array_layers(image.create_info.arrayLayers),
+      tiling(image.create_info.tiling),
+      flags(image.create_info.flags),
+      aspect_mask(image.full_range.aspectMask) {}
+
+bool syncval_state::ImageEncoderCache::Key::operator==(const Key &rhs) const {
+    return (format == rhs.format) && (image_type == rhs.image_type) && (extent.width == rhs.extent.width) &&
+           (extent.height == rhs.extent.height) && (extent.depth == rhs.extent.depth) && (mip_levels == rhs.mip_levels) &&
+           (array_layers == rhs.array_layers) && (tiling == rhs.tiling) && (flags == rhs.flags) &&
+           (aspect_mask == rhs.aspect_mask);
+}
+
+size_t syncval_state::ImageEncoderCache::Key::Hash::operator()(const Key &key) const {
+    hash_util::HashCombiner hc;
+    hc << key.format << key.image_type << key.extent.width << key.extent.height << key.extent.depth << key.mip_levels;
+    hc << key.array_layers << key.tiling << key.flags << key.aspect_mask;
+    return hc.Value();
+}
+
+std::shared_ptr<const subresource_adapter::ImageRangeEncoder> syncval_state::ImageEncoderCache::Get(const vvl::Image &image) {
+    const Key key(image);
+    std::lock_guard<std::mutex> guard(lock_);
+    auto &entry = encoders_[key];
+    auto encoder = entry.lock();
+    if (!encoder) {
+        encoder = std::make_shared<const subresource_adapter::ImageRangeEncoder>(image);
+        entry = encoder;
+
+        if (encoders_.size() >= prune_size_) {
+            vvl::EraseIf(encoders_, [](const auto &cached) { return cached.second.expired(); });
+            prune_size_ = std::max<size_t>(64, encoders_.size() * 2);
+        }
+    }
+    return encoder;
+}
+
+syncval_state::ImageSubState::ImageSubState(vvl::Image &image, ImageEncoderCache &encoder_cache)
+    : vvl::ImageSubState(image), fragment_encoder(encoder_cache.Get(image)) {}
 
 bool syncval_state::ImageSubState::IsSimplyBound() const {
     bool simple = SimpleBinding(base) || base.IsSwapchainImage() || base.bind_swapchain;
@@ -44,7 +89,7 @@ void syncval_state::ImageSubState::SetOpaqueBaseAddress(vvl::DeviceState &dev_da
         // The size of the opaque range is based on the SyncVal *internal* representation of the tiled resource, unrelated
         // to the acutal size of the the resource in device memory. If differing representations become possible, the allocated
         // size would need to be changed to those representation's size requirements.
-        opaque_base = dev_data.AllocFakeMemory(fragment_encoder.TotalSize());
+        opaque_base = dev_data.AllocFakeMemory(fragment_encoder->TotalSize());
     }
     opaque_base_address_ = opaque_base;
 }
@@ -63,7 +108,7 @@ ImageRangeGen syncval_state::ImageSubState::MakeImageRangeGen(const VkImageSubre
     }
 
     const auto base_address = GetResourceBaseAddress();
-    ImageRangeGen range_gen(fragment_encoder, subresource_range, base_address, is_depth_sliced);
+    ImageRangeGen range_gen(*fragment_encoder, subresource_range, base_address, is_depth_sliced);
     return range_gen;
 }
 
@@ -75,13 +120,33 @@ ImageRangeGen syncval_state::ImageSubState::MakeImageRangeGen(const VkImageSubre
     }
 
     const auto base_address = GetResourceBaseAddress();
-    subresource_adapter::ImageRangeGenerator range_gen(fragment_encoder, subresource_range, offset, extent, base_address,
+    subresource_adapter::ImageRangeGenerator range_gen(*fragment_encoder, subresource_range, offset, extent, base_address,
                                                        is_depth_sliced);
     return range_gen;
 }
 
+syncval_state::ImageViewSubState::ImageViewSubState(vvl::ImageView &view) : vvl::ImageViewSubState(view) {
+    const auto &image_sub_state = SubState(*view.image_state);
+    if (image_sub_state.IsSimplyBound()) {
+        base_address_ = image_sub_state.GetResourceBaseAddress();
+        view_range_gen_.emplace(image_sub_state.MakeImageRangeGen(view.normalized_subresource_range, view.is_depth_sliced));
+    }
+}
+
+const ImageRangeGen *syncval_state::ImageViewSubState::GetViewRangeGen(VkDeviceSize base_address) const {
+    if (!view_range_gen_ || base_address != base_address_) {
+        return nullptr;
+    }
+    return &*view_range_gen_;
+}
+
 ImageRangeGen syncval_state::MakeImageRangeGen(const vvl::ImageView &view) {
     const auto &sub_state = SubState(*view.image_state);
+    if (sub_state.IsSimplyBound()) {
+        if (const ImageRangeGen *view_range_gen = SubState(view).GetViewRangeGen(sub_state.GetResourceBaseAddress())) {
+            return *view_range_gen;
+        }
+    }
     return sub_state.MakeImageRangeGen(view.normalized_subresource_range, view.is_depth_sliced);
 }
 
@@ -16,17 +16,50 @@
  */
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <optional>
 #include "sync/sync_submit.h"
 #include "state_tracker/image_state.h"
 #include "state_tracker/wsi_state.h"
 
 namespace syncval_state {
 
+// The encoder only depends on the image create parameters, so images created with the same ones share it. Applications often
+// create many images of each shape (render targets per frame, texture arrays of the same size...).
+class ImageEncoderCache {
+  public:
+    std::shared_ptr<const subresource_adapter::ImageRangeEncoder> Get(const vvl::Image &image);
+
+  private:
+    struct Key {
+        VkFormat format;
+        VkImageType image_type;
+        VkExtent3D extent;
+        uint32_t mip_levels;
+        uint32_t array_layers;
+        VkImageTiling tiling;
+        VkImageCreateFlags flags;
+        VkImageAspectFlags aspect_mask;
+
+        explicit Key(const vvl::Image &image);
+        bool operator==(const Key &rhs) const;
+        struct Hash {
+            size_t operator()(const Key &key) const;
+        };
+    };
+
+    std::mutex lock_;
+    vvl::unordered_map<Key, std::weak_ptr<const subresource_adapter::ImageRangeEncoder>, Key::Hash> encoders_;
+    // The entries of destroyed images are removed when the map reaches this size
+    size_t prune_size_ = 64;
+};
+
 class ImageSubState : public vvl::ImageSubState {
   public:
-    ImageSubState(vvl::Image &image);
+    ImageSubState(vvl::Image &image, ImageEncoderCache &encoder_cache);
 
-    bool IsLinear() const { return fragment_encoder.IsLinearImage(); }
+    bool IsLinear() const { return fragment_encoder->IsLinearImage(); }
     bool IsTiled() const { return !IsLinear(); }
     bool IsSimplyBound() const;
 
@@ -41,7 +74,7 @@ class ImageSubState : public vvl::ImageSubState {
 
   protected:
     VkDeviceSize opaque_base_address_ = 0U;
-    const subresource_adapter::ImageRangeEncoder fragment_encoder;
+    const std::shared_ptr<const subresource_adapter::ImageRangeEncoder> fragment_encoder;
 };
 
 static inline ImageSubState &SubState(vvl::Image &img) {
@@ -52,6 +85,24 @@ static inline const ImageSubState &SubState(const vvl::Image &img) {
     return *static_cast<const ImageSubState *>(img.SubState(LayerObjectTypeSyncValidation));
 }
 
+// The range generator of the whole view is built when the view is created, instead of each time the view is used by a draw,
+// copy or barrier
+class ImageViewSubState : public vvl::ImageViewSubState {
+  public:
+    explicit ImageViewSubState(vvl::ImageView &view);
+
+    // Empty if the image was not bound when the view was created, or is bound to another address now
+    const ImageRangeGen *GetViewRangeGen(VkDeviceSize base_address) const;
+
+  private:
+    VkDeviceSize base_address_ = 0U;
+    std::optional<ImageRangeGen> view_range_gen_;
+};
+
+static inline const ImageViewSubState &SubState(const vvl::ImageView &view) {
+    return *static_cast<const ImageViewSubState *>(view.SubState(LayerObjectTypeSyncValidation));
+}
+
 ImageRangeGen MakeImageRangeGen(const vvl::ImageView &view);
 ImageRangeGen MakeImageRangeGen(const vvl::ImageView &view, const VkOffset3D &offset, const VkExtent3D &extent,
                                 VkImageAspectFlags override_depth_stencil_aspect_mask = 0);
@@ -64,8 +115,19 @@ class SwapchainSubState : public vvl::SwapchainSubState {
     PresentedImage MovePresentedImage(uint32_t image_index);
     void GetPresentBatches(std::vector<QueueBatchContext::Ptr> &batches) const;
 
+    // Range generator of the whole swapchain image, built on the first present or acquire of the image instead of every frame
+    ImageRangeGen GetImageRangeGen(const vvl::Image &image, uint32_t image_index);
+
   private:
     PresentedImages presented;  // Build this on demand
+
+    struct ImageRange {
+        const vvl::Image *image;
+        VkDeviceSize base_address;
+        ImageRangeGen range_gen;
+    };
+    std::mutex image_ranges_lock_;
+    std::vector<std::optional<ImageRange>> image_ranges_;
 };
 
 static inline SwapchainSubState &SubState(vvl::Swapchain &sc) {
@@ -410,9 +410,10 @@ bool SyncOpPipelineBarrier::Validate(const CommandBufferAccessContext &cb_contex
             const Location loc(command_);
             const SyncValidator &sync_state = cb_context.GetSyncState();
             const std::string resource_description = sync_state.FormatHandle(image_state.Handle());
-            const std::string error =
-                sync_state.error_messages_.ImageBarrierError(hazard, cb_context, command_, resource_description, image_barrier);
-            skip |= sync_state.SyncError(hazard.Hazard(), objlist, loc, error);
+            skip |= sync_state.SyncError(hazard.Hazard(), objlist, loc, [&]() {
+                return sync_state.error_messages_.ImageBarrierError(hazard, cb_context, command_, resource_description,
+                                                                    image_barrier);
+            });
         }
     }
     return skip;
@@ -439,6 +440,7 @@ void SyncOpPipelineBarrier::ReplayRecord(CommandExecutionContext &exec_context,
     SyncEventsContext *events_context = exec_context.GetCurrentEventsContext();
     AccessContext *access_context = exec_context.GetCurrentAccessContext();
     const auto queue_id = exec_context.GetQueueId();
+    syncval_stats::BarrierScope stats_scope(exec_context.GetSyncState().stats, barrier_set_.BarrierCount());
     PipelineBarrier::ApplyBarriers(barrier_set_.buffer_memory_barriers, queue_id, access_context);
     PipelineBarrier::ApplyBarriers(barrier_set_.image_memory_barriers, queue_id, access_context);
     PipelineBarrier::ApplyGlobalBarriers(barrier_set_.memory_barriers, queue_id, exec_tag, access_context);
@@ -473,7 +475,7 @@ SyncOpWaitEvents::SyncOpWaitEvents(vvl::Func command, const SyncValidator &sync_
     barrier_set.MakeBufferMemoryBarriers(sync_state, src_exec_scope, dst_exec_scope, bufferMemoryBarrierCount,
                                          pBufferMemoryBarriers);
     barrier_set.MakeImageMemoryBarriers(sync_state, src_exec_scope, dst_exec_scope, imageMemoryBarrierCount, pImageMemoryBarriers);
-    MakeEventsList(sync_state, eventCount, pEvents);
+    MakeWaitScopes(sync_state, eventCount, pEvents);
 }
 
 SyncOpWaitEvents::SyncOpWaitEvents(vvl::Func command, const SyncValidator &sync_state, VkQueueFlags queue_flags,
@@ -491,7 +493,7 @@ SyncOpWaitEvents::SyncOpWaitEvents(vvl::Func command, const SyncValidator &sync_
         barrier_set.MakeImageMemoryBarriers(sync_state, queue_flags, dep_info.imageMemoryBarrierCount,
                                             dep_info.pImageMemoryBarriers);
     }
-    MakeEventsList(sync_state, eventCount, pEvents);
+    MakeWaitScopes(sync_state, eventCount, pEvents);
 }
 
 const char *const SyncOpWaitEvents::kIgnored = "Wait operation is ignored for this event.";
@@ -544,18 +546,15 @@ bool SyncOpWaitEvents::DoValidate(const CommandExecutionContext &exec_context, c
     bool events_not_found = false;
     const auto *events_context = exec_context.GetCurrentEventsContext();
     assert(events_context);
-    size_t barrier_set_index = 0;
-    size_t barrier_set_incr = (barrier_sets_.size() == 1) ? 0 : 1;
     const Location loc(command_);
-    for (const auto &event : events_) {
-        const auto *sync_event = events_context->Get(event.get());
-        const auto &barrier_set = barrier_sets_[barrier_set_index];
+    for (const auto &wait_scope : wait_scopes_) {
+        const auto *sync_event = events_context->Get(wait_scope.event.get());
+        const auto &barrier_set = barrier_sets_[wait_scope.barrier_set_index];
         if (!sync_event) {
             // NOTE PHASE2: This is where we'll need queue submit time validation to come back and check the srcStageMask bits
             //              or solve this with replay creating the SyncEventState in the queue context... also this will be a
             //              new validation error... wait without previously submitted set event...
             events_not_found = true;  // Demote "extra_stage_bits" error to warning, to avoid false positives at *record time*
-            barrier_set_index += barrier_set_incr;
             continue;  // Core, Lifetimes, or Param check needs to catch invalid events.
         }
 
@@ -644,16 +643,16 @@ bool SyncOpWaitEvents::DoValidate(const CommandExecutionContext &exec_context, c
                 if (hazard.IsHazard()) {
                     LogObjectList objlist(exec_context.Handle(), image_state->Handle());
                     const std::string resource_description = sync_state.FormatHandle(image_state->Handle());
-                    const std::string error = sync_state.error_messages_.ImageBarrierError(
-                        hazard, exec_context, command_, resource_description, image_memory_barrier);
-                    skip |= sync_state.SyncError(hazard.Hazard(), image_state->Handle(), loc, error);
+                    skip |= sync_state.SyncError(hazard.Hazard(), image_state->Handle(), loc, [&]() {
+                        return sync_state.error_messages_.ImageBarrierError(hazard, exec_context, command_, resource_description,
+                                                                            image_memory_barrier);
+                    });
                     break;
                 }
             }
         }
         // TODO:  Add infrastructure for checking pDependencyInfo's vs. CmdSetEvent2 VUID - vkCmdWaitEvents2KHR - pEvents -
         // 03839
-        barrier_set_index += barrier_set_incr;
     }
 
     // Note that we can't check for HOST in pEvents as we don't track that set event type
@@ -687,20 +686,18 @@ void SyncOpWaitEvents::ReplayRecord(CommandExecutionContext &exec_context, Resou
     AccessContext *access_context = exec_context.GetCurrentAccessContext();
     SyncEventsContext *events_context = exec_context.GetCurrentEventsContext();
     const QueueId queue_id = exec_context.GetQueueId();
+    syncval_stats::BarrierScope stats_scope(exec_context.GetSyncState().stats, barrier_count_);
 
     access_context->ResolvePreviousAccesses();
 
-    size_t barrier_set_index = 0;
-    size_t barrier_set_incr = (barrier_sets_.size() == 1) ? 0 : 1;
-    assert(barrier_sets_.size() == 1 || (barrier_sets_.size() == events_.size()));
-    for (auto &event_shared : events_) {
-        if (!event_shared.get()) continue;
-        auto *sync_event = events_context->GetFromShared(event_shared);
+    for (const auto &wait_scope : wait_scopes_) {
+        if (!wait_scope.event) continue;
+        auto *sync_event = events_context->GetFromShared(wait_scope.event);
 
         sync_event->last_command = command_;
         sync_event->last_command_tag = exec_tag;
 
-        const auto &barrier_set = barrier_sets_[barrier_set_index];
+        const auto &barrier_set = barrier_sets_[wait_scope.barrier_set_index];
         const auto &dst = barrier_set.dst_exec_scope;
         if (!sync_event->IsIgnoredByWait(command_, barrier_set.src_exec_scope.mask_param)) {
             // These apply barriers one at a time as the are restricted to the resource ranges specified per each barrier,
@@ -718,7 +715,6 @@ void SyncOpWaitEvents::ReplayRecord(CommandExecutionContext &exec_context, Resou
             // We ignored this wait, so we don't have any effective synchronization barriers for it.
             sync_event->barriers = 0U;
         }
-        barrier_set_index += barrier_set_incr;
     }
 
     // Apply the pending barriers
@@ -730,10 +726,16 @@ bool SyncOpWaitEvents::ReplayValidate(ReplayState &replay, ResourceUsageTag reco
     return DoValidate(replay.GetExecutionContext(), replay.GetBaseTag() + recorded_tag);
 }
 
-void SyncOpWaitEvents::MakeEventsList(const SyncValidator &sync_state, uint32_t event_count, const VkEvent *events) {
-    events_.reserve(event_count);
+void SyncOpWaitEvents::MakeWaitScopes(const SyncValidator &sync_state, uint32_t event_count, const VkEvent *events) {
+    // vkCmdWaitEvents has a single barrier set for all events, vkCmdWaitEvents2 has one per event
+    assert(barrier_sets_.size() == 1 || barrier_sets_.size() == event_count);
+    const bool single_barrier_set = barrier_sets_.size() == 1;
+    wait_scopes_.reserve(event_count);
     for (uint32_t event_index = 0; event_index < event_count; event_index++) {
-        events_.emplace_back(sync_state.Get<vvl::Event>(events[event_index]));
+        wait_scopes_.push_back({sync_state.Get<vvl::Event>(events[event_index]), single_barrier_set ? 0 : event_index});
+    }
+    for (const auto &barrier_set : barrier_sets_) {
+        barrier_count_ += barrier_set.BarrierCount();
     }
 }
 
@@ -1151,7 +1153,9 @@ ReplayState::ReplayState(CommandExecutionContext &exec_context, const CommandBuf
 
 AccessContext *ReplayState::ReplayStateRenderPassBegin(VkQueueFlags queue_flags, const SyncOpBeginRenderPass &begin_op,
                                                        const AccessContext &external_context) {
-    return rp_replay_.Begin(queue_flags, begin_op, external_context);
+    const auto subpass_barriers = exec_context_.GetSyncState().subpass_barrier_cache_.Get(
+        *begin_op.GetRenderPassAccessContext()->GetRenderPassState(), queue_flags);
+    return rp_replay_.Begin(*subpass_barriers, begin_op, external_context);
 }
 
 AccessContext *ReplayState::ReplayStateRenderPassNext() { return rp_replay_.Next(); }
@@ -1172,21 +1176,49 @@ bool ReplayState::DetectFirstUseHazard(const ResourceUsageRange &first_use_range
         // we need to fetch the current access context each time
         const AccessContext *access_context = GetRecordedAccessContext();
 
+        // Without sync ops the range covers the whole context, and gathering its entries would cost as much as the check.
+        // The entries are only kept for a complete recording, which context does not change anymore.
+        const AccessContext::FirstUseEntries *first_use_entries = nullptr;
+        const CbState cb_state = recorded_context_.GetCBState().state;
+        if (!recorded_context_.GetSyncOps().empty() && (cb_state == CbState::Recorded || cb_state == CbState::InvalidComplete)) {
+            first_use_entries = &recorded_context_.GetFirstUseEntries(*access_context, first_use_range);
+        }
+
+        const SyncValidator &sync_state = exec_context_.GetSyncState();
         const HazardResult hazard = access_context->DetectFirstUseHazard(exec_context_.GetQueueId(), first_use_range,
-                                                                         *exec_context_.GetCurrentAccessContext());
+                                                                         *exec_context_.GetCurrentAccessContext(),
+                                                                         &sync_state.first_use_pool_, first_use_entries);
         if (hazard.IsHazard()) {
-            const SyncValidator &sync_state = exec_context_.GetSyncState();
+            hazard_found_ = true;
             LogObjectList objlist(exec_context_.Handle(), recorded_context_.Handle());
-            const std::string error = sync_state.error_messages_.FirstUseError(hazard, exec_context_, recorded_context_, index_);
-            skip |= sync_state.SyncError(hazard.Hazard(), objlist, error_obj_.location, error);
+            skip |= sync_state.SyncError(hazard.Hazard(), objlist, error_obj_.location, [&]() {
+                return sync_state.error_messages_.FirstUseError(hazard, exec_context_, recorded_context_, index_);
+            });
         }
     }
     return skip;
 }
 
+std::optional<size_t> ReplayState::GetFirstUseFingerprint() const {
+    // Replayed sync ops change the exec context between the checks, and an incomplete recording can still change
+    const CbState cb_state = recorded_context_.GetCBState().state;
+    if (!recorded_context_.GetSyncOps().empty() || (cb_state != CbState::Recorded && cb_state != CbState::InvalidComplete)) {
+        return {};
+    }
+    const ResourceUsageRange first_use_range = {0, ResourceUsageRecord::kMaxIndex};
+    return GetRecordedAccessContext()->FirstUseFingerprint(exec_context_.GetQueueId(), first_use_range,
+                                                           *exec_context_.GetCurrentAccessContext());
+}
+
 bool ReplayState::ValidateFirstUse() {
     if (!exec_context_.ValidForSyncOps()) return false;
 
+    // A command buffer submitted again against the same state has no hazard if it had none the last time
+    const std::optional<size_t> fingerprint = GetFirstUseFingerprint();
+    if (fingerprint && recorded_context_.IsFirstUseValidated(*fingerprint)) {
+        return false;
+    }
+
     bool skip = false;
     ResourceUsageRange first_use_range = {0, 0};
 
@@ -1207,9 +1239,13 @@ bool ReplayState::ValidateFirstUse() {
     first_use_range.end = ResourceUsageRecord::kMaxIndex;
     skip |= DetectFirstUseHazard(first_use_range);
 
+    if (fingerprint && !hazard_found_) {
+        recorded_context_.AddFirstUseValidated(*fingerprint);
+    }
     return skip;
 }
-AccessContext *ReplayState::RenderPassReplayState::Begin(VkQueueFlags queue_flags, const SyncOpBeginRenderPass &begin_op_,
+AccessContext *ReplayState::RenderPassReplayState::Begin(const std::vector<SubpassBarriers> &subpass_barriers,
+                                                         const SyncOpBeginRenderPass &begin_op_,
                                                          const AccessContext &external_context) {
     Reset();
 
@@ -1220,7 +1256,7 @@ AccessContext *ReplayState::RenderPassReplayState::Begin(VkQueueFlags queue_flag
     assert(rp_context);
     replay_context = &rp_context->GetContexts()[0];
 
-    InitSubpassContexts(queue_flags, *rp_context->GetRenderPassState(), &external_context, subpass_contexts);
+    InitSubpassContexts(*rp_context->GetRenderPassState(), subpass_barriers, &external_context, subpass_contexts);
 
     // Replace the Async contexts with the the async context of the "external" context
     // For replay we don't care about async subpasses, just async queue batches
@@ -147,6 +147,7 @@ struct BarrierSet {
     std::vector<SyncBufferMemoryBarrier> buffer_memory_barriers;
     std::vector<SyncImageMemoryBarrier> image_memory_barriers;
     bool single_exec_scope;
+    size_t BarrierCount() const { return memory_barriers.size() + buffer_memory_barriers.size() + image_memory_barriers.size(); }
     void MakeMemoryBarriers(const SyncExecScope &src, const SyncExecScope &dst, uint32_t memoryBarrierCount,
                             const VkMemoryBarrier *pMemoryBarriers);
     void MakeBufferMemoryBarriers(const SyncValidator &sync_state, const SyncExecScope &src, const SyncExecScope &dst,
@@ -218,13 +219,21 @@ class SyncOpWaitEvents : public SyncOpBase {
     static const char *const kIgnored;
     bool DoValidate(const CommandExecutionContext &ex_context, const ResourceUsageTag base_tag) const;
     void DoRecord(CommandExecutionContext &ex_context, const ResourceUsageTag base_tag) const;
-    void MakeEventsList(const SyncValidator &sync_state, uint32_t event_count, const VkEvent *events);
-
-    // TODO PHASE2 This is the wrong thing to use for "replay".. as the event state will have moved on since the record
-    // TODO PHASE2 May need to capture by value w.r.t. "first use" or build up in calling/enqueue context through replay.
-    std::vector<std::shared_ptr<const vvl::Event>> events_;
+    void MakeWaitScopes(const SyncValidator &sync_state, uint32_t event_count, const VkEvent *events);
 
     std::vector<BarrierSet> barrier_sets_;
+
+    // Each waited event paired with its barrier set, resolved once at record time so that the validation and replay of every
+    // submission only walk this list
+    struct WaitScope {
+        // TODO PHASE2 This is the wrong thing to use for "replay".. as the event state will have moved on since the record
+        // TODO PHASE2 May need to capture by value w.r.t. "first use" or build up in calling/enqueue context through replay.
+        std::shared_ptr<const vvl::Event> event;  // null for an invalid event handle
+        uint32_t barrier_set_index;
+    };
+    std::vector<WaitScope> wait_scopes_;
+    // Sum of the barriers of all barrier sets
+    size_t barrier_count_ = 0;
 };
 
 class SyncOpResetEvent : public SyncOpBase {
@@ -387,7 +396,7 @@ class ReplayState {
         // A minimal subset of the functionality present in the RenderPassAccessContext. Since the accesses are recorded in the
         // first_use information of the recorded access contexts, s.t. all we need to support is the barrier/resolve operations
         RenderPassReplayState() { Reset(); }
-        AccessContext *Begin(VkQueueFlags queue_flags, const SyncOpBeginRenderPass &begin_op_,
+        AccessContext *Begin(const std::vector<SubpassBarriers> &subpass_barriers, const SyncOpBeginRenderPass &begin_op_,
                              const AccessContext &external_context);
         AccessContext *Next();
         void End(AccessContext &external_context);
@@ -421,6 +430,7 @@ class ReplayState {
 
   protected:
     const AccessContext *GetRecordedAccessContext() const;
+    std::optional<size_t> GetFirstUseFingerprint() const;
 
     CommandExecutionContext &exec_context_;
     const CommandBufferAccessContext &recorded_context_;
@@ -428,4 +438,6 @@ class ReplayState {
     const uint32_t index_;
     const ResourceUsageTag base_tag_;
     RenderPassReplayState rp_replay_;
+    // Set when DetectFirstUseHazard finds a hazard, reported or not
+    mutable bool hazard_found_ = false;
 };
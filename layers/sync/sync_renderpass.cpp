@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <vulkan/utility/vk_format_utils.h>
 #include "sync/sync_renderpass.h"
 #include "sync/sync_validation.h"
@@ -22,6 +23,7 @@
 #include "sync/sync_image.h"
 #include "state_tracker/render_pass_state.h"
 #include "state_tracker/pipeline_state.h"
+#include "containers/container_utils.h"
 
 // Action for validating resolve operations
 class ValidateResolveAction {
@@ -42,16 +44,17 @@ class ValidateResolveAction {
         if (hazard.IsHazard()) {
             const Location loc(command_);
 
-            std::stringstream ss;
-            ss << view_gen.GetViewState()->Handle();
-            ss << " (" << aspect_name << " " << resolve_action_name;
-            ss << ", attachment " << src_at;
-            ss << ", resolve attachment " << dst_at;
-            ss << ", subpass " << subpass_ << ")";
-            const std::string resource_description = ss.str();
-            const auto error = cb_context_.GetSyncState().error_messages_.RenderPassResolveError(hazard, cb_context_, command_,
-                                                                                                 resource_description);
-            skip_ |= cb_context_.GetSyncState().SyncError(hazard.Hazard(), render_pass_, loc, error);
+            skip_ |= cb_context_.GetSyncState().SyncError(hazard.Hazard(), render_pass_, loc, [&]() {
+                std::stringstream ss;
+                ss << view_gen.GetViewState()->Handle();
+                ss << " (" << aspect_name << " " << resolve_action_name;
+                ss << ", attachment " << src_at;
+                ss << ", resolve attachment " << dst_at;
+                ss << ", subpass " << subpass_ << ")";
+                const std::string resource_description = ss.str();
+                return cb_context_.GetSyncState().error_messages_.RenderPassResolveError(hazard, cb_context_, command_,
+                                                                                         resource_description);
+            });
         }
     }
     // Providing a mechanism for the constructing caller to get the result of the validation
@@ -81,15 +84,46 @@ class UpdateStateResolveAction {
     const ResourceUsageTag tag_;
 };
 
-void InitSubpassContexts(VkQueueFlags queue_flags, const vvl::RenderPass &rp_state, const AccessContext *external_context,
-                         std::vector<AccessContext> &subpass_contexts) {
+void InitSubpassContexts(const vvl::RenderPass &rp_state, const std::vector<SubpassBarriers> &subpass_barriers,
+                         const AccessContext *external_context, std::vector<AccessContext> &subpass_contexts) {
     const auto &create_info = rp_state.create_info;
+    assert(subpass_barriers.size() == create_info.subpassCount);
     // Add this for all subpasses here so that they exsist during next subpass validation
     subpass_contexts.clear();
     subpass_contexts.reserve(create_info.subpassCount);
     for (uint32_t pass = 0; pass < create_info.subpassCount; pass++) {
-        subpass_contexts.emplace_back(pass, queue_flags, rp_state.subpass_dependencies, subpass_contexts, external_context);
+        subpass_contexts.emplace_back(pass, rp_state.subpass_dependencies, subpass_barriers[pass], subpass_contexts,
+                                      external_context);
+    }
+}
+
+std::shared_ptr<const SubpassBarrierCache::Barriers> SubpassBarrierCache::Get(const vvl::RenderPass &rp_state,
+                                                                              VkQueueFlags queue_flags) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    Entry &entry = entries_[&rp_state];
+    const auto cached_rp_state = entry.rp_state.lock();
+    if (cached_rp_state.get() != &rp_state) {
+        entry.rp_state = rp_state.shared_from_this();
+        entry.barriers.clear();
+    }
+    for (const auto &[cached_queue_flags, barriers] : entry.barriers) {
+        if (cached_queue_flags == queue_flags) {
+            return barriers;
+        }
+    }
+
+    auto barriers = std::make_shared<Barriers>();
+    barriers->reserve(rp_state.subpass_dependencies.size());
+    for (const SubpassDependencyGraphNode &dependency : rp_state.subpass_dependencies) {
+        barriers->emplace_back(MakeSubpassBarriers(queue_flags, dependency));
+    }
+    entry.barriers.emplace_back(queue_flags, barriers);
+
+    if (entries_.size() >= prune_size_) {
+        vvl::EraseIf(entries_, [](const auto &cached) { return cached.second.rp_state.expired(); });
+        prune_size_ = std::max<size_t>(64, entries_.size() * 2);
     }
+    return barriers;
 }
 
 static SyncAccessIndex GetLoadOpUsageIndex(VkAttachmentLoadOp load_op, syncval_state::AttachmentType type) {
@@ -180,14 +214,16 @@ bool RenderPassAccessContext::ValidateLayoutTransitions(const CommandBufferAcces
             const std::string resource_description = ss.str();
 
             if (hazard.Tag() == kInvalidTag) {
-                const auto error = sync_state.error_messages_.RenderPassLayoutTransitionVsStoreOrResolveError(
-                    hazard, cb_context, command, resource_description, transition.old_layout, transition.new_layout,
-                    transition.prev_pass);
-                skip |= sync_state.SyncError(hazard.Hazard(), rp_state.Handle(), loc, error);
+                skip |= sync_state.SyncError(hazard.Hazard(), rp_state.Handle(), loc, [&]() {
+                    return sync_state.error_messages_.RenderPassLayoutTransitionVsStoreOrResolveError(
+                        hazard, cb_context, command, resource_description, transition.old_layout, transition.new_layout,
+                        transition.prev_pass);
+                });
             } else {
-                const auto error = sync_state.error_messages_.RenderPassLayoutTransitionError(
-                    hazard, cb_context, command, resource_description, transition.old_layout, transition.new_layout);
-                skip |= sync_state.SyncError(hazard.Hazard(), rp_state.Handle(), loc, error);
+                skip |= sync_state.SyncError(hazard.Hazard(), rp_state.Handle(), loc, [&]() {
+                    return sync_state.error_messages_.RenderPassLayoutTransitionError(
+                        hazard, cb_context, command, resource_description, transition.old_layout, transition.new_layout);
+                });
             }
         }
     }
@@ -254,13 +290,15 @@ bool RenderPassAccessContext::ValidateLoadOperation(const CommandBufferAccessCon
                 const std::string resource_description = ss.str();
 
                 if (hazard.Tag() == kInvalidTag) {  // Hazard vs. ILT
-                    const auto error = sync_state.error_messages_.RenderPassLoadOpVsLayoutTransitionError(
-                        hazard, cb_context, command, resource_description, load_op, is_color);
-                    skip |= sync_state.SyncError(hazard.Hazard(), rp_state.Handle(), loc, error);
+                    skip |= sync_state.SyncError(hazard.Hazard(), rp_state.Handle(), loc, [&]() {
+                        return sync_state.error_messages_.RenderPassLoadOpVsLayoutTransitionError(
+                            hazard, cb_context, command, resource_description, load_op, is_color);
+                    });
                 } else {
-                    const std::string error = sync_state.error_messages_.RenderPassLoadOpError(
-                        hazard, cb_context, command, resource_description, subpass, i, load_op, is_color);
-                    skip |= sync_state.SyncError(hazard.Hazard(), rp_state.Handle(), loc, error);
+                    skip |= sync_state.SyncError(hazard.Hazard(), rp_state.Handle(), loc, [&]() {
+                        return sync_state.error_messages_.RenderPassLoadOpError(hazard, cb_context, command, resource_description,
+                                                                                subpass, i, load_op, is_color);
+                    });
                 }
             }
         }
@@ -322,17 +360,17 @@ bool RenderPassAccessContext::ValidateStoreOperation(const CommandBufferAccessCo
                 const VkAttachmentStoreOp store_op = checked_stencil ? ci.stencilStoreOp : ci.storeOp;
                 const Location loc(command);
 
-                std::stringstream ss;
-                ss << sync_state.FormatHandle(view_gen.GetViewState()->Handle());
-                ss << " (subpass " << current_subpass_;
-                ss << ", attachment " << i;
-                ss << ", aspect " << aspect << " during store with " << op_type_string;
-                ss << " " << string_VkAttachmentStoreOp(store_op) << ")";
-                const std::string resource_description = ss.str();
-
-                const std::string error =
-                    sync_state.error_messages_.RenderPassStoreOpError(hazard, cb_context, command, resource_description, store_op);
-                skip |= sync_state.SyncError(hazard.Hazard(), rp_state_->Handle(), loc, error);
+                skip |= sync_state.SyncError(hazard.Hazard(), rp_state_->Handle(), loc, [&]() {
+                    std::stringstream ss;
+                    ss << sync_state.FormatHandle(view_gen.GetViewState()->Handle());
+                    ss << " (subpass " << current_subpass_;
+                    ss << ", attachment " << i;
+                    ss << ", aspect " << aspect << " during store with " << op_type_string;
+                    ss << " " << string_VkAttachmentStoreOp(store_op) << ")";
+                    const std::string resource_description = ss.str();
+                    return sync_state.error_messages_.RenderPassStoreOpError(hazard, cb_context, command, resource_description,
+                                                                             store_op);
+                });
             }
         }
     }
@@ -536,15 +574,14 @@ bool RenderPassAccessContext::ValidateDrawSubpassAttachment(const CommandBufferA
         LogObjectList objlist(cb_context.GetCBState().Handle(), attachment_view.Handle(), attachment_image.Handle());
         const Location loc(command);
 
-        std::stringstream ss;
-        ss << attachment_description;
-        ss << " (" << sync_state.FormatHandle(attachment_view.Handle());
-        ss << ", " << sync_state.FormatHandle(attachment_image.Handle()) << ")";
-        const std::string resource_description = ss.str();
-
-        const std::string error =
-            sync_state.error_messages_.RenderPassAttachmentError(hazard, cb_context, command, resource_description);
-        return sync_state.SyncError(hazard.Hazard(), objlist, loc, error);
+        return sync_state.SyncError(hazard.Hazard(), objlist, loc, [&]() {
+            std::stringstream ss;
+            ss << attachment_description;
+            ss << " (" << sync_state.FormatHandle(attachment_view.Handle());
+            ss << ", " << sync_state.FormatHandle(attachment_image.Handle()) << ")";
+            const std::string resource_description = ss.str();
+            return sync_state.error_messages_.RenderPassAttachmentError(hazard, cb_context, command, resource_description);
+        });
     };
 
     // Subpass's inputAttachment has been done in ValidateDispatchDrawDescriptorSet
@@ -768,14 +805,16 @@ bool RenderPassAccessContext::ValidateFinalSubpassLayoutTransitions(const Comman
             const std::string resource_description = ss.str();
 
             if (hazard.Tag() == kInvalidTag) {  // Hazard vs. store/resolve
-                const std::string error = sync_state.error_messages_.RenderPassFinalLayoutTransitionVsStoreOrResolveError(
-                    hazard, cb_context, command, resource_description, transition.old_layout, transition.new_layout,
-                    transition.prev_pass);
-                skip |= sync_state.SyncError(hazard.Hazard(), rp_state_->Handle(), loc, error);
+                skip |= sync_state.SyncError(hazard.Hazard(), rp_state_->Handle(), loc, [&]() {
+                    return sync_state.error_messages_.RenderPassFinalLayoutTransitionVsStoreOrResolveError(
+                        hazard, cb_context, command, resource_description, transition.old_layout, transition.new_layout,
+                        transition.prev_pass);
+                });
             } else {
-                const std::string error = sync_state.error_messages_.RenderPassFinalLayoutTransitionError(
-                    hazard, cb_context, command, resource_description, transition.old_layout, transition.new_layout);
-                skip |= sync_state.SyncError(hazard.Hazard(), rp_state_->Handle(), loc, error);
+                skip |= sync_state.SyncError(hazard.Hazard(), rp_state_->Handle(), loc, [&]() {
+                    return sync_state.error_messages_.RenderPassFinalLayoutTransitionError(
+                        hazard, cb_context, command, resource_description, transition.old_layout, transition.new_layout);
+                });
             }
         }
     }
@@ -838,12 +877,12 @@ AttachmentViewGenVector RenderPassAccessContext::CreateAttachmentViewGen(
     return view_gens;
 }
 RenderPassAccessContext::RenderPassAccessContext(const vvl::RenderPass &rp_state, const VkRect2D &render_area,
-                                                 VkQueueFlags queue_flags,
+                                                 const std::vector<SubpassBarriers> &subpass_barriers,
                                                  const std::vector<const vvl::ImageView *> &attachment_views,
                                                  const AccessContext *external_context)
     : rp_state_(&rp_state), render_area_(render_area), current_subpass_(0U), attachment_views_() {
     // Add this for all subpasses here so that they exist during next subpass validation
-    InitSubpassContexts(queue_flags, rp_state, external_context, subpass_contexts_);
+    InitSubpassContexts(rp_state, subpass_barriers, external_context, subpass_contexts_);
     attachment_views_ = CreateAttachmentViewGen(render_area, attachment_views);
 }
 void RenderPassAccessContext::RecordBeginRenderPass(const ResourceUsageTag barrier_tag, const ResourceUsageTag load_tag) {
@@ -901,32 +940,52 @@ void RenderPassAccessContext::RecordEndRenderPass(AccessContext *external_contex
     }
 }
 
-void syncval_state::BeginRenderingCmdState::AddRenderingInfo(const SyncValidator &state, const VkRenderingInfo &rendering_info) {
-    info = std::make_unique<DynamicRenderingInfo>(state, rendering_info);
+void syncval_state::BeginRenderingCmdState::AddRenderingInfo(const SyncValidator &state, const VkRenderingInfo &rendering_info,
+                                                             const DynamicRenderingInfo *previous) {
+    info = std::make_unique<DynamicRenderingInfo>(state, rendering_info, previous);
 }
 
 const syncval_state::DynamicRenderingInfo &syncval_state::BeginRenderingCmdState::GetRenderingInfo() const {
     assert(info);
     return *info;
 }
-syncval_state::DynamicRenderingInfo::DynamicRenderingInfo(const SyncValidator &state, const VkRenderingInfo &rendering_info)
+syncval_state::DynamicRenderingInfo::DynamicRenderingInfo(const SyncValidator &state, const VkRenderingInfo &rendering_info,
+                                                          const DynamicRenderingInfo *previous)
     : info(&rendering_info) {
     uint32_t attachment_count = info.colorAttachmentCount + (info.pDepthAttachment ? 1 : 0) + (info.pStencilAttachment ? 1 : 0);
 
     const VkOffset3D offset = CastTo3D(info.renderArea.offset);
     const VkExtent3D extent = CastTo3D(info.renderArea.extent);
 
+    // The range generators depend on the render area, they can be reused only if it did not change
+    if (previous && (previous->info.renderArea.offset.x != info.renderArea.offset.x ||
+                     previous->info.renderArea.offset.y != info.renderArea.offset.y ||
+                     previous->info.renderArea.extent.width != info.renderArea.extent.width ||
+                     previous->info.renderArea.extent.height != info.renderArea.extent.height)) {
+        previous = nullptr;
+    }
+    // Attachment of the previous rendering at the same position, if it has the same type
+    auto previous_attachment = [previous](uint32_t index, AttachmentType type) -> const Attachment * {
+        if (previous && index < previous->attachments.size() && previous->attachments[index].type == type) {
+            return &previous->attachments[index];
+        }
+        return nullptr;
+    };
+
     attachments.reserve(attachment_count);
     for (uint32_t i = 0; i < info.colorAttachmentCount; i++) {
-        attachments.emplace_back(state, info.pColorAttachments[i], syncval_state::AttachmentType::kColor, offset, extent);
+        attachments.emplace_back(state, info.pColorAttachments[i], syncval_state::AttachmentType::kColor, offset, extent,
+                                 previous_attachment(i, AttachmentType::kColor));
     }
 
     if (info.pDepthAttachment) {
-        attachments.emplace_back(state, *info.pDepthAttachment, syncval_state::AttachmentType::kDepth, offset, extent);
+        attachments.emplace_back(state, *info.pDepthAttachment, syncval_state::AttachmentType::kDepth, offset, extent,
+                                 previous_attachment(uint32_t(attachments.size()), AttachmentType::kDepth));
     }
 
     if (info.pStencilAttachment) {
-        attachments.emplace_back(state, *info.pStencilAttachment, syncval_state::AttachmentType::kStencil, offset, extent);
+        attachments.emplace_back(state, *info.pStencilAttachment, syncval_state::AttachmentType::kStencil, offset, extent,
+                                 previous_attachment(uint32_t(attachments.size()), AttachmentType::kStencil));
     }
 }
 
@@ -948,10 +1007,12 @@ const vvl::ImageView *syncval_state::DynamicRenderingInfo::GetClearAttachmentVie
 syncval_state::DynamicRenderingInfo::Attachment::Attachment(const SyncValidator &state,
                                                             const vku::safe_VkRenderingAttachmentInfo &attachment_info,
                                                             AttachmentType type_, const VkOffset3D &offset,
-                                                            const VkExtent3D &extent)
+                                                            const VkExtent3D &extent, const Attachment *previous)
     : info(attachment_info), view(state.Get<vvl::ImageView>(attachment_info.imageView)), view_gen(), type(type_) {
     if (view) {
-        if (type == AttachmentType::kColor) {
+        if (previous && previous->view == view) {
+            view_gen = previous->view_gen;
+        } else if (type == AttachmentType::kColor) {
             view_gen = syncval_state::MakeImageRangeGen(*view, offset, extent);
         } else if (type == AttachmentType::kDepth) {
             view_gen = syncval_state::MakeImageRangeGen(*view, offset, extent, VK_IMAGE_ASPECT_DEPTH_BIT);
@@ -962,7 +1023,9 @@ syncval_state::DynamicRenderingInfo::Attachment::Attachment(const SyncValidator
         if (info.resolveImageView != VK_NULL_HANDLE && (info.resolveMode != VK_RESOLVE_MODE_NONE)) {
             resolve_view = state.Get<vvl::ImageView>(info.resolveImageView);
             if (resolve_view) {
-                if (type == AttachmentType::kColor) {
+                if (previous && previous->resolve_view == resolve_view && previous->resolve_gen) {
+                    resolve_gen = previous->resolve_gen;
+                } else if (type == AttachmentType::kColor) {
                     resolve_gen.emplace(syncval_state::MakeImageRangeGen(*resolve_view, offset, extent));
                 } else if (type == AttachmentType::kDepth) {
                     // Only the depth aspect
@@ -17,8 +17,12 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <vulkan/vulkan.h>
 
+#include "containers/custom_containers.h"
+#include "containers/small_vector.h"
 #include "sync/sync_common.h"
 #include "sync/sync_access_context.h"
 #include "sync/sync_op.h"
@@ -27,6 +31,7 @@ struct LastBound;
 
 namespace vvl {
 class CommandBuffer;
+class StateObject;
 }
 namespace syncval_state {
 enum class AttachmentType { kColor, kDepth, kStencil };
@@ -40,8 +45,9 @@ struct DynamicRenderingInfo {
         std::optional<ImageRangeGen> resolve_gen;
         AttachmentType type;
 
+        // The range generators of |previous| are reused when it has the same views and was used with the same render area
         Attachment(const SyncValidator &state, const vku::safe_VkRenderingAttachmentInfo &info, const AttachmentType type_,
-                   const VkOffset3D &offset, const VkExtent3D &extent);
+                   const VkOffset3D &offset, const VkExtent3D &extent, const Attachment *previous);
 
         SyncAccessIndex GetLoadUsage() const;
         SyncAccessIndex GetStoreUsage() const;
@@ -57,7 +63,9 @@ struct DynamicRenderingInfo {
     DynamicRenderingInfo &operator=(const DynamicRenderingInfo &) = delete;
     DynamicRenderingInfo &operator=(DynamicRenderingInfo &&) = delete;
 
-    DynamicRenderingInfo(const SyncValidator &state, const VkRenderingInfo &rendering_info);
+    // |previous| is the last rendering of the command buffer, if any. Passes that begin rendering again with the same
+    // attachments and render area share its range generators instead of building them again.
+    DynamicRenderingInfo(const SyncValidator &state, const VkRenderingInfo &rendering_info, const DynamicRenderingInfo *previous);
 
     const vvl::ImageView *GetClearAttachmentView(const VkClearAttachment &clear_attachment) const;
 
@@ -67,22 +75,43 @@ struct DynamicRenderingInfo {
 
 struct BeginRenderingCmdState {
     BeginRenderingCmdState(std::shared_ptr<const vvl::CommandBuffer> &&cb_state_) : cb_state(std::move(cb_state_)) {}
-    void AddRenderingInfo(const SyncValidator &state, const VkRenderingInfo &rendering_info);
+    void AddRenderingInfo(const SyncValidator &state, const VkRenderingInfo &rendering_info,
+                          const DynamicRenderingInfo *previous = nullptr);
     const DynamicRenderingInfo &GetRenderingInfo() const;
     std::shared_ptr<const vvl::CommandBuffer> cb_state;
     std::unique_ptr<DynamicRenderingInfo> info;
 };
 }  // namespace syncval_state
 
-void InitSubpassContexts(VkQueueFlags queue_flags, const vvl::RenderPass &rp_state, const AccessContext *external_context,
-                         std::vector<AccessContext> &subpass_contexts);
+void InitSubpassContexts(const vvl::RenderPass &rp_state, const std::vector<SubpassBarriers> &subpass_barriers,
+                         const AccessContext *external_context, std::vector<AccessContext> &subpass_contexts);
+
+// The subpass dependency barriers only depend on the render pass and the queue type. They are built the first time a render
+// pass is used on a queue type, instead of at every render pass instance and at every replay of it at submit time.
+class SubpassBarrierCache {
+  public:
+    using Barriers = std::vector<SubpassBarriers>;
+    std::shared_ptr<const Barriers> Get(const vvl::RenderPass &rp_state, VkQueueFlags queue_flags) const;
+
+  private:
+    struct Entry {
+        // Tells apart a destroyed render pass from a new one created at the same address
+        std::weak_ptr<const vvl::StateObject> rp_state;
+        small_vector<std::pair<VkQueueFlags, std::shared_ptr<const Barriers>>, 2> barriers;
+    };
+    mutable std::mutex lock_;
+    mutable vvl::unordered_map<const vvl::RenderPass *, Entry> entries_;
+    // The entries of destroyed render passes are removed when the map reaches this size
+    mutable size_t prune_size_ = 64;
+};
 
 class RenderPassAccessContext {
   public:
     static AttachmentViewGenVector CreateAttachmentViewGen(const VkRect2D &render_area,
                                                            const std::vector<const vvl::ImageView *> &attachment_views);
     RenderPassAccessContext() : rp_state_(nullptr), render_area_(VkRect2D()), current_subpass_(0) {}
-    RenderPassAccessContext(const vvl::RenderPass &rp_state, const VkRect2D &render_area, VkQueueFlags queue_flags,
+    RenderPassAccessContext(const vvl::RenderPass &rp_state, const VkRect2D &render_area,
+                            const std::vector<SubpassBarriers> &subpass_barriers,
                             const std::vector<const vvl::ImageView *> &attachment_views, const AccessContext *external_context);
 
     static bool ValidateLayoutTransitions(const CommandBufferAccessContext &cb_context, const AccessContext &access_context,
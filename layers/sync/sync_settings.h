@@ -21,4 +21,9 @@ struct SyncValSettings {
     bool submit_time_validation = true;
     bool shader_accesses_heuristic = false;
     bool message_extra_properties = false;
+    // Memory in MB that the access logs referenced by the queue history can keep alive before the oldest ones are dropped.
+    // 0 is no limit.
+    uint32_t queue_history_memory_limit = 256;
+    // Submit time validation runs on a worker thread, the hazards are reported after the submit call returned
+    bool async_submit_validation = false;
 };
@@ -19,6 +19,8 @@
 
 #if VVL_ENABLE_SYNCVAL_STATS != 0
 #include "sync_commandbuffer.h"
+#include "sync_submit.h"
+#include "profiling/profiling.h"
 
 #include <iostream>
 
@@ -37,6 +39,8 @@ inline T atomic_fetch_max(std::atomic<T> &current_max, const T &value) noexcept
 
 namespace syncval_stats {
 
+thread_local ThreadCounters thread_counters;
+
 // NOTE: fetch_add/fetch_sub return value before increment/decrement.
 // Our Add/Sub functions return new counter values, so they need to
 // adjust result of the atomic function by adding/subtracting one.
@@ -91,6 +95,71 @@ void Stats::RemoveUnresolvedBatch() { unresolved_batch_counter.Sub(1); }
 void Stats::AddHandleRecord(uint32_t count) { handle_record_counter.Add(count); }
 void Stats::RemoveHandleRecord(uint32_t count) { handle_record_counter.Sub(count); }
 
+void Stats::AddAccessLogRecords(uint64_t count) { access_log_record_counter.Add(count); }
+void Stats::RemoveAccessLogRecords(uint64_t count) { access_log_record_counter.Sub(count); }
+
+void Stats::AddBarriers(uint64_t barrier_count, uint64_t ranges_visited) {
+    barrier_counter.Add(barrier_count);
+    barrier_range_counter.Add(ranges_visited);
+}
+
+void Stats::AddDraw(uint64_t hazard_checks) {
+    draw_counter.Add(1);
+    draw_hazard_check_counter.Add(hazard_checks);
+}
+
+void Stats::OnFrameBoundary(const QueueBatchContext *last_batch) {
+    // The queue history of the presenting queue, which is externally synchronized here
+    uint64_t access_map_entries = 0;
+    uint64_t read_states = 0;
+    uint32_t max_reads = 0;
+    uint64_t batch_log_memory = 0;
+    if (last_batch) {
+        const auto &access_map = last_batch->GetCurrentAccessContext()->GetAccessStateMap();
+        access_map_entries = access_map.size();
+        for (const auto &entry : access_map) {
+            const uint32_t read_count = entry.second.LastReadCount();
+            read_states += read_count;
+            max_reads = std::max(max_reads, read_count);
+        }
+        batch_log_memory = last_batch->GetBatchLogMemoryUsage();
+    }
+
+    const uint64_t access_log_memory = access_log_record_counter.value.u64 * sizeof(ResourceUsageRecord);
+    const uint64_t barriers = barrier_counter.u64.exchange(0);
+    const uint64_t barrier_ranges = barrier_range_counter.u64.exchange(0);
+    const uint64_t draws = draw_counter.u64.exchange(0);
+    const uint64_t draw_hazard_checks = draw_hazard_check_counter.u64.exchange(0);
+    const uint64_t ranges_per_barrier = barriers ? barrier_ranges / barriers : 0;
+    const uint64_t checks_per_draw = draws ? draw_hazard_checks / draws : 0;
+
+    VVL_TracyPlot("syncval command buffer access log KB", access_log_memory / 1024);
+    VVL_TracyPlot("syncval queue batch log KB", batch_log_memory / 1024);
+    VVL_TracyPlot("syncval queue access map entries", access_map_entries);
+    VVL_TracyPlot("syncval queue read states", read_states);
+    VVL_TracyPlot("syncval QueueBatchContext count", queue_batch_context_counter.value.u32.load());
+    VVL_TracyPlot("syncval ranges per barrier", ranges_per_barrier);
+    VVL_TracyPlot("syncval hazard checks per draw", checks_per_draw);
+
+    std::ostringstream str;
+    str << "Frame " << frame_index++ << ":\n";
+    str << "\tcommand buffer access logs = " << access_log_memory << " bytes\n";
+    str << "\tqueue batch logs = " << batch_log_memory << " bytes\n";
+    str << "\tqueue access map entries = " << access_map_entries << '\n';
+    str << "\tqueue read states = " << read_states << " (max per entry = " << max_reads << ")\n";
+    str << "\tQueueBatchContext count = " << queue_batch_context_counter.value.u32 << '\n';
+    str << "\tbarriers = " << barriers << ", ranges visited = " << barrier_ranges << '\n';
+    str << "\tdraws = " << draws << ", hazard checks = " << draw_hazard_checks << '\n';
+
+    std::lock_guard<std::mutex> guard(frame_report_mutex);
+    frame_report = str.str();
+}
+
+std::string Stats::GetFrameReport() const {
+    std::lock_guard<std::mutex> guard(frame_report_mutex);
+    return frame_report;
+}
+
 void Stats::UpdateMemoryStats() {
 #if defined(USE_MIMALLOC_STATS)
     mi_stats_merge();
@@ -144,6 +213,16 @@ std::string Stats::CreateReport() {
         str << "\tmax_count = " << handle_record_max << '\n';
         str << "\tmax_memory = " << handle_record_max_memory << " bytes\n";
     }
+    {
+        uint64_t access_log_record = access_log_record_counter.value.u64;
+        uint64_t access_log_record_max = access_log_record_counter.max_value.u64;
+        str << "AccessLog (command buffers):\n";
+        str << "\tcount = " << access_log_record << '\n';
+        str << "\tmemory = " << access_log_record * sizeof(ResourceUsageRecord) << " bytes\n";
+        str << "\tmax_count = " << access_log_record_max << '\n';
+        str << "\tmax_memory = " << access_log_record_max * sizeof(ResourceUsageRecord) << " bytes\n";
+    }
+    str << GetFrameReport();
 
 #if defined(USE_MIMALLOC_STATS)
     mi_stats_print_out([](const char* msg, void* arg) { *static_cast<std::ostringstream*>(arg) << msg; }, &str);
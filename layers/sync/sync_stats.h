@@ -26,6 +26,7 @@
 
 #if VVL_ENABLE_SYNCVAL_STATS != 0
 #include <atomic>
+#include <mutex>
 
 // NOTE: mimalloc should be built with MI_STAT=1 to enable stats module
 #if defined(USE_MIMALLOC)
@@ -39,9 +40,21 @@
 
 #endif  // VVL_ENABLE_SYNCVAL_STATS != 0
 
+class QueueBatchContext;
+
 namespace syncval_stats {
 #if VVL_ENABLE_SYNCVAL_STATS != 0
 
+// Work counted by the thread that does it, so that the hot loops do not update atomics.
+// The scopes below move it to the device Stats at the end of each operation.
+struct ThreadCounters {
+    uint64_t hazard_checks = 0;
+    uint64_t barrier_ranges = 0;
+};
+extern thread_local ThreadCounters thread_counters;
+inline void CountHazardCheck() { ++thread_counters.hazard_checks; }
+inline void CountBarrierRange() { ++thread_counters.barrier_ranges; }
+
 struct Value32 {
     std::atomic_uint32_t u32;
     void Update(uint32_t new_value);
@@ -101,11 +114,55 @@ struct Stats {
     void AddHandleRecord(uint32_t count = 1);
     void RemoveHandleRecord(uint32_t count = 1);
 
+    // Records of the access logs owned by command buffers
+    ValueMax64 access_log_record_counter;
+    void AddAccessLogRecords(uint64_t count = 1);
+    void RemoveAccessLogRecords(uint64_t count);
+
+    // Work of the current frame, restarted at each frame boundary
+    Value64 barrier_counter;
+    Value64 barrier_range_counter;
+    void AddBarriers(uint64_t barrier_count, uint64_t ranges_visited);
+    Value64 draw_counter;
+    Value64 draw_hazard_check_counter;
+    void AddDraw(uint64_t hazard_checks);
+
+    // Samples the presenting queue history, plots the values and keeps the report of the frame that ends
+    void OnFrameBoundary(const QueueBatchContext *last_batch);
+    std::string GetFrameReport() const;
+    mutable std::mutex frame_report_mutex;
+    std::string frame_report;
+    uint64_t frame_index = 0;
+
     void UpdateMemoryStats();
     void ReportOnDestruction();
     std::string CreateReport();
 };
 
+// Counts the ranges visited by the barriers of one operation
+class BarrierScope {
+  public:
+    BarrierScope(Stats &stats, uint64_t barrier_count)
+        : stats_(stats), barrier_count_(barrier_count), start_(thread_counters.barrier_ranges) {}
+    ~BarrierScope() { stats_.AddBarriers(barrier_count_, thread_counters.barrier_ranges - start_); }
+
+  private:
+    Stats &stats_;
+    const uint64_t barrier_count_;
+    const uint64_t start_;
+};
+
+// Counts the hazard checks made by the validation of one draw
+class DrawScope {
+  public:
+    explicit DrawScope(Stats &stats) : stats_(stats), start_(thread_counters.hazard_checks) {}
+    ~DrawScope() { stats_.AddDraw(thread_counters.hazard_checks - start_); }
+
+  private:
+    Stats &stats_;
+    const uint64_t start_;
+};
+
 #else
 struct Stats {
     void AddHandleRecord(uint32_t count = 1) {}
@@ -118,10 +175,29 @@ struct Stats {
     void RemoveTimelineSignals(uint32_t count) {}
     void AddUnresolvedBatch() {}
     void RemoveUnresolvedBatch() {}
+    void AddAccessLogRecords(uint64_t count = 1) {}
+    void RemoveAccessLogRecords(uint64_t count) {}
+    void AddBarriers(uint64_t barrier_count, uint64_t ranges_visited) {}
+    void AddDraw(uint64_t hazard_checks) {}
 
+    void OnFrameBoundary(const QueueBatchContext *last_batch) {}
+    std::string GetFrameReport() const { return {}; }
     void UpdateMemoryStats() {}
     void ReportOnDestruction() {}
     std::string CreateReport() { return "SyncVal stats are disabled in the current build configuration\n"; }
 };
+
+inline void CountHazardCheck() {}
+inline void CountBarrierRange() {}
+
+class BarrierScope {
+  public:
+    BarrierScope(Stats &, uint64_t) {}
+};
+
+class DrawScope {
+  public:
+    explicit DrawScope(Stats &) {}
+};
 #endif  // VVL_ENABLE_SYNCVAL_STATS != 0
 }  // namespace syncval_stats
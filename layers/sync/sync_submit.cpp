@@ -20,6 +20,8 @@
 #include "sync/sync_image.h"
 #include "sync/sync_reporting.h"
 
+#include <algorithm>
+
 AcquiredImage::AcquiredImage(const PresentedImage& presented, ResourceUsageTag acq_tag)
     : image(presented.image), generator(presented.range_gen), present_tag(presented.tag), acquire_tag(acq_tag) {}
 
@@ -87,6 +89,32 @@ bool SignalsUpdate::OnTimelineSignal(const vvl::Semaphore& semaphore_state, cons
     return true;
 }
 
+void InsertTimelineSignal(std::vector<SignalInfo>& signals, SignalInfo&& signal) {
+    if (signals.empty() || signals.back().timeline_value < signal.timeline_value) {
+        signals.emplace_back(std::move(signal));
+        return;
+    }
+    auto greater_value = [](uint64_t value, const SignalInfo& other) { return value < other.timeline_value; };
+    auto pos = std::upper_bound(signals.begin(), signals.end(), signal.timeline_value, greater_value);
+    signals.insert(pos, std::move(signal));
+}
+
+const SignalInfo* FindTimelineSignal(const std::vector<SignalInfo>& signals, uint64_t wait_value) {
+    auto less_value = [](const SignalInfo& signal, uint64_t value) { return signal.timeline_value < value; };
+    auto it = std::lower_bound(signals.begin(), signals.end(), wait_value, less_value);
+    return it != signals.end() ? &*it : nullptr;
+}
+
+uint32_t EraseTimelineSignals(std::vector<SignalInfo>& signals, QueueId queue, uint64_t threshold_value) {
+    auto less_value = [](const SignalInfo& signal, uint64_t value) { return signal.timeline_value < value; };
+    auto last = std::lower_bound(signals.begin(), signals.end(), threshold_value, less_value);
+    auto new_last =
+        std::remove_if(signals.begin(), last, [queue](const SignalInfo& signal) { return signal.first_scope.queue == queue; });
+    const auto removed_count = static_cast<uint32_t>(last - new_last);
+    signals.erase(new_last, last);
+    return removed_count;
+}
+
 bool SignalsUpdate::RegisterSignals(const BatchContextPtr& batch, const vvl::span<const VkSemaphoreSubmitInfo>& submit_signals) {
     bool registered_timeline_signal = false;
     for (const auto& submit_signal : submit_signals) {
@@ -130,21 +158,15 @@ std::optional<SignalInfo> SignalsUpdate::OnTimelineWait(VkSemaphore semaphore, u
     // Search for the smallest signal value that resolves the wait.
     // At first check registered signals (they have smaller values)
     if (const std::vector<SignalInfo>* signals = vvl::Find(sync_validator_.timeline_signals_, semaphore)) {
-        for (auto& signal : *signals) {
-            if (wait_value <= signal.timeline_value) {
-                resolving_signal.emplace(signal);
-                break;
-            }
+        if (const SignalInfo* signal = FindTimelineSignal(*signals, wait_value)) {
+            resolving_signal.emplace(*signal);
         }
     }
     // then check the pending signals
     if (!resolving_signal.has_value()) {
         if (const std::vector<SignalInfo>* pending_signals = vvl::Find(timeline_signals, semaphore)) {
-            for (auto& signal : *pending_signals) {
-                if (wait_value <= signal.timeline_value) {
-                    resolving_signal.emplace(signal);
-                    break;
-                }
+            if (const SignalInfo* signal = FindTimelineSignal(*pending_signals, wait_value)) {
+                resolving_signal.emplace(*signal);
             }
         }
     }
@@ -180,6 +202,24 @@ PresentedImage syncval_state::SwapchainSubState::MovePresentedImage(uint32_t ima
     return ret_val;
 }
 
+ImageRangeGen syncval_state::SwapchainSubState::GetImageRangeGen(const vvl::Image& image, uint32_t image_index) {
+    const auto& image_sub_state = SubState(image);
+    if (!image_sub_state.IsSimplyBound()) {
+        return ImageRangeGen();
+    }
+    const VkDeviceSize base_address = image_sub_state.GetResourceBaseAddress();
+
+    std::lock_guard<std::mutex> guard(image_ranges_lock_);
+    if (image_index >= image_ranges_.size()) {
+        image_ranges_.resize(image_index + 1);
+    }
+    auto& image_range = image_ranges_[image_index];
+    if (!image_range || image_range->image != &image || image_range->base_address != base_address) {
+        image_range.emplace(ImageRange{&image, base_address, image_sub_state.MakeImageRangeGen(image.full_range, false)});
+    }
+    return image_range->range_gen;
+}
+
 void syncval_state::SwapchainSubState::GetPresentBatches(std::vector<QueueBatchContext::Ptr>& batches) const {
     for (const auto& presented_image : presented) {
         if (presented_image.batch) {
@@ -274,6 +314,18 @@ void QueueBatchContext::Trim() {
 
     // Only conserve AccessLog references that are referenced by used_tags
     batch_log_.Trim(used_tags);
+
+    const uint32_t memory_limit_mb = sync_state_.syncval_settings.queue_history_memory_limit;
+    if (memory_limit_mb != 0 && batch_log_.Collapse(size_t(memory_limit_mb) * 1024 * 1024, tag_range_.begin)) {
+        if (!sync_state_.queue_history_collapse_reported_.exchange(true)) {
+            const LogObjectList objlist = queue_state_ ? LogObjectList(Handle()) : LogObjectList();
+            sync_state_.LogInfo("SYNCVAL_QUEUE_HISTORY_MEMORY_LIMIT", objlist, Location(vvl::Func::Empty),
+                                "The command logs of the submissions not retired by a host synchronization use more than %" PRIu32
+                                " MB (syncval_queue_history_memory_limit). The oldest logs are dropped: the hazards with their "
+                                "accesses are still reported, but without the prior command details.",
+                                memory_limit_mb);
+        }
+    }
 }
 
 void QueueBatchContext::ResolveSubmittedCommandBuffer(const AccessContext& recorded_context, ResourceUsageTag offset) {
@@ -290,24 +342,65 @@ void QueueBatchContext::ApplyPredicatedWait(Predicate& predicate) {
     });
 }
 
-void QueueBatchContext::ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag) {
+void QueueBatchContext::WaitableTags::Add(QueueId queue, ResourceUsageTag tag) {
+    any = std::min(any, tag);
+    for (auto& [waitable_queue, waitable_tag] : by_queue) {
+        if (waitable_queue == queue) {
+            waitable_tag = std::min(waitable_tag, tag);
+            return;
+        }
+    }
+    by_queue.emplace_back(queue, tag);
+}
+
+ResourceUsageTag QueueBatchContext::WaitableTags::Get(QueueId queue) const {
+    for (const auto& [waitable_queue, waitable_tag] : by_queue) {
+        if (waitable_queue == queue) {
+            return waitable_tag;
+        }
+    }
+    return kInvalidTag;
+}
+
+bool QueueBatchContext::ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag) {
     const bool any_queue = (queue_id == kQueueAny);
 
+    // SwapChain acquire QBC's have no queue, but also, events are always empty.
+    if (queue_state_ && (queue_id == GetQueueId() || any_queue)) {
+        events_context_.ApplyTaggedWait(queue_state_->GetQueueFlags(), tag);
+    }
+
+    // A wait only clears accesses tagged up to the waited tag. Old batches kept alive by signals or presents, waited again at
+    // every frame, skip the walk of their accesses once those are older than any tag a wait can still clear.
+    if (waitable_tags_ && tag < (any_queue ? waitable_tags_->any : waitable_tags_->Get(queue_id))) {
+        return false;
+    }
+
+    // The lowest tags of the accesses left are gathered during the walk that applies the wait
+    WaitableTags waitable_tags;
+    auto apply_wait = [this, &waitable_tags](auto& predicate) {
+        access_context_.EraseIf([&predicate, &waitable_tags](ResourceAccessRangeMap::value_type& access) {
+            // Apply..Wait returns true if the waited access is empty...
+            if (access.second.ApplyPredicatedWait(predicate)) {
+                return true;
+            }
+            access.second.ForEachTagWaitableAccess(
+                [&waitable_tags](QueueId queue, ResourceUsageTag access_tag) { waitable_tags.Add(queue, access_tag); });
+            return false;
+        });
+    };
     if (any_queue) {
         // This isn't just avoid an unneeded test, but to allow *all* queues to to be waited in a single pass
         // (and it does avoid doing the same test for every access, as well as avoiding the need for the predicate
         // to grok Queue/Device/Wait differences.
         ResourceAccessState::WaitTagPredicate predicate{tag};
-        ApplyPredicatedWait(predicate);
+        apply_wait(predicate);
     } else {
         ResourceAccessState::WaitQueueTagPredicate predicate{queue_id, tag};
-        ApplyPredicatedWait(predicate);
-    }
-
-    // SwapChain acquire QBC's have no queue, but also, events are always empty.
-    if (queue_state_ && (queue_id == GetQueueId() || any_queue)) {
-        events_context_.ApplyTaggedWait(queue_state_->GetQueueFlags(), tag);
+        apply_wait(predicate);
     }
+    waitable_tags_ = std::move(waitable_tags);
+    return true;
 }
 
 void QueueBatchContext::ApplyAcquireWait(const AcquiredImage& acquired) {
@@ -452,15 +545,15 @@ bool QueueBatchContext::DoQueuePresentValidate(const Location& loc, const Presen
 
             LogObjectList objlist(queue_state_->Handle(), swapchain_handle, image_handle);
 
-            std::stringstream ss;
-            ss << "swapchain image " << presented.image_index << " (";
-            ss << sync_state_.FormatHandle(image_handle);
-            ss << " from " << sync_state_.FormatHandle(swapchain_handle) << ")";
-            const std::string resource_description = ss.str();
-
-            const std::string error = sync_state_.error_messages_.PresentError(hazard, *this, vvl::Func::vkQueuePresentKHR,
-                                                                               resource_description, presented.present_index);
-            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
+            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, [&]() {
+                std::stringstream ss;
+                ss << "swapchain image " << presented.image_index << " (";
+                ss << sync_state_.FormatHandle(image_handle);
+                ss << " from " << sync_state_.FormatHandle(swapchain_handle) << ")";
+                const std::string resource_description = ss.str();
+                return sync_state_.error_messages_.PresentError(hazard, *this, vvl::Func::vkQueuePresentKHR, resource_description,
+                                                                presented.present_index);
+            });
             if (skip) {
                 break;
             }
@@ -487,7 +580,7 @@ void QueueBatchContext::LogPresentOperations(const PresentedImages& presented_im
         access_log->reserve(tag_range_.size());
         assert(tag_range_.size() == presented_images.size());
         for (const auto& presented : presented_images) {
-            access_log->emplace_back(PresentResourceRecord(static_cast<const PresentedImageRecord>(presented)));
+            access_log->emplace_back(PresentResourceRecord(presented));
         }
     }
 }
@@ -617,7 +710,7 @@ std::vector<BatchContextConstPtr> QueueBatchContext::ResolveSubmitWaits(vvl::spa
 }
 
 bool QueueBatchContext::ValidateSubmit(const std::vector<CommandBufferConstPtr>& command_buffers, uint64_t submit_index,
-                                       uint32_t batch_index, std::vector<std::string>& current_label_stack,
+                                       uint32_t batch_index, vvl::LabelStack& current_label_stack,
                                        const ErrorObject& error_obj) {
     bool skip = false;
 
@@ -744,7 +837,7 @@ void QueueSyncState::ClearPending() const {
 }
 
 void BatchAccessLog::Import(const BatchRecord& batch, const CommandBufferAccessContext& cb_access,
-                            const std::vector<std::string>& initial_label_stack) {
+                            const vvl::LabelStack& initial_label_stack) {
     ResourceUsageRange import_range = {batch.base_tag, batch.base_tag + cb_access.GetTagCount()};
     log_map_.insert(std::make_pair(import_range, CBSubmitLog(batch, cb_access, initial_label_stack)));
 }
@@ -753,6 +846,7 @@ void BatchAccessLog::Import(const BatchAccessLog& other) {
     for (const auto& entry : other.log_map_) {
         log_map_.insert(entry);
     }
+    collapsed_end_tag_ = std::max(collapsed_end_tag_, other.collapsed_end_tag_);
 }
 
 void BatchAccessLog::Insert(const BatchRecord& batch, const ResourceUsageRange& range,
@@ -815,13 +909,57 @@ void BatchAccessLog::Trim(const ResourceUsageTagSet& used_tags) {
     }
 }
 
+size_t BatchAccessLog::MemoryUsage() const {
+    // The same log is referenced by each submission of a command buffer
+    vvl::unordered_set<const CommandExecutionContext::AccessLog*> logs;
+    size_t memory = 0;
+    for (const auto& entry : log_map_) {
+        const CommandExecutionContext::AccessLog* log = entry.second.GetLog();
+        if (log && logs.insert(log).second) {
+            memory += log->size() * sizeof(ResourceUsageRecord);
+        }
+    }
+    return memory;
+}
+
+// Collapse: Bound the memory the access logs of old submissions keep alive
+//
+// The batch logs are trimmed to the tags referenced by the access states, but the applications that rarely wait on the host
+// keep old accesses, and the logs of the command buffers that made them, alive. The access states are kept as they are, so the
+// hazards are still detected, but the logs of the lowest (oldest) tags are dropped, and the hazards with their accesses are
+// reported without the command details.
+bool BatchAccessLog::Collapse(size_t memory_limit, ResourceUsageTag keep_tag) {
+    size_t memory = MemoryUsage();
+    if (memory <= memory_limit) {
+        return false;
+    }
+
+    vvl::unordered_map<const CommandExecutionContext::AccessLog*, uint32_t> log_references;
+    for (const auto& entry : log_map_) {
+        ++log_references[entry.second.GetLog()];
+    }
+
+    bool collapsed = false;
+    auto it = log_map_.begin();
+    while (memory > memory_limit && it != log_map_.end() && it->first.end <= keep_tag) {
+        const CommandExecutionContext::AccessLog* log = it->second.GetLog();
+        if (log && --log_references[log] == 0) {
+            memory -= log->size() * sizeof(ResourceUsageRecord);
+        }
+        collapsed_end_tag_ = std::max(collapsed_end_tag_, it->first.end);
+        it = log_map_.erase(it);
+        collapsed = true;
+    }
+    return collapsed;
+}
+
 BatchAccessLog::AccessRecord BatchAccessLog::GetAccessRecord(ResourceUsageTag tag) const {
     auto found_log = log_map_.find(tag);
     if (found_log != log_map_.cend()) {
         return found_log->second.GetAccessRecord(tag);
     }
-    // tag not found
-    assert(false);
+    // tag not found, which is only expected for the tags of the dropped logs
+    assert(tag < collapsed_end_tag_);
     return AccessRecord();
 }
 
@@ -846,7 +984,7 @@ BatchAccessLog::CBSubmitLog::CBSubmitLog(const BatchRecord& batch,
     : batch_(batch), cbs_(cbs), log_(log) {}
 
 BatchAccessLog::CBSubmitLog::CBSubmitLog(const BatchRecord& batch, const CommandBufferAccessContext& cb,
-                                         const std::vector<std::string>& initial_label_stack)
+                                         const vvl::LabelStack& initial_label_stack)
     : batch_(batch), cbs_(cb.GetCBReferencesShared()), log_(cb.GetAccessLogShared()), initial_label_stack_(initial_label_stack) {}
 
 PresentedImage::PresentedImage(SyncValidator& sync_state, QueueBatchContext::Ptr batch_, VkSwapchainKHR swapchain,
@@ -884,8 +1022,7 @@ void PresentedImage::SetImage(uint32_t at_index) {
         range_gen = ImageRangeGen();
     } else {
         // For valid images create the type/range_gen to used to scope the semaphore operations
-        const auto& sub_state = syncval_state::SubState(*image);
-        range_gen = sub_state.MakeImageRangeGen(image->full_range, false);
+        range_gen = syncval_state::SubState(*swap_lock).GetImageRangeGen(*image, image_index);
     }
 }
 
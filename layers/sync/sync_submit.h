@@ -16,8 +16,10 @@
  */
 
 #pragma once
+#include <optional>
 #include "sync/sync_commandbuffer.h"
 #include "state_tracker/queue_state.h"
+#include "containers/small_vector.h"
 
 struct PresentedImage;
 class QueueBatchContext;
@@ -83,6 +85,14 @@ struct SignalInfo {
     std::shared_ptr<AcquiredImage> acquired_image;
 };
 
+// The timeline signals of a semaphore are kept sorted by value, so that the lookups and the removals of the older
+// signals do not scan the whole list. Valid signals are submitted in increasing order and are appended.
+void InsertTimelineSignal(std::vector<SignalInfo> &signals, SignalInfo &&signal);
+// Returns the signal with the smallest value that resolves the wait, null if it is a wait-before-signal
+const SignalInfo *FindTimelineSignal(const std::vector<SignalInfo> &signals, uint64_t wait_value);
+// Removes the signals of the queue with a value less than the threshold. Returns the number of removed signals.
+uint32_t EraseTimelineSignals(std::vector<SignalInfo> &signals, QueueId queue, uint64_t threshold_value);
+
 // When the timeline wait is resolved, the previous signals can be removed
 struct RemoveTimelineSignalsRequest {
     VkSemaphore semaphore = VK_NULL_HANDLE;
@@ -195,8 +205,9 @@ class BatchAccessLog {
         CBSubmitLog(const BatchRecord &batch, std::shared_ptr<const CommandExecutionContext::CommandBufferSet> cbs,
                     std::shared_ptr<const CommandExecutionContext::AccessLog> log);
         CBSubmitLog(const BatchRecord &batch, const CommandBufferAccessContext &cb,
-                    const std::vector<std::string> &initial_label_stack);
+                    const vvl::LabelStack &initial_label_stack);
         size_t Size() const { return log_->size(); }
+        const CommandExecutionContext::AccessLog *GetLog() const { return log_.get(); }
         AccessRecord GetAccessRecord(ResourceUsageTag tag) const;
 
         // DebugNameProvider
@@ -207,23 +218,31 @@ class BatchAccessLog {
         std::shared_ptr<const CommandExecutionContext::CommandBufferSet> cbs_;
         std::shared_ptr<const CommandExecutionContext::AccessLog> log_;
         // label stack at the point when command buffer is submitted to the queue
-        std::vector<std::string> initial_label_stack_;
+        vvl::LabelStack initial_label_stack_;
     };
 
     void Import(const BatchRecord &batch, const CommandBufferAccessContext &cb_access,
-                const std::vector<std::string> &initial_label_stack);
+                const vvl::LabelStack &initial_label_stack);
     void Import(const BatchAccessLog &other);
     void Insert(const BatchRecord &batch, const ResourceUsageRange &range,
                 std::shared_ptr<const CommandExecutionContext::AccessLog> log);
 
     void Trim(const ResourceUsageTagSet &used);
+    // Drops the oldest logs that are before |keep_tag| until the ones left use at most |memory_limit| bytes.
+    // Returns true if any log was dropped.
+    bool Collapse(size_t memory_limit, ResourceUsageTag keep_tag);
     // AccessRecord lookup is based on global tags
     AccessRecord GetAccessRecord(ResourceUsageTag tag) const;
+    // Bytes of the referenced access logs
+    size_t MemoryUsage() const;
     BatchAccessLog() {}
 
   private:
+
     using CBSubmitLogRangeMap = sparse_container::range_map<ResourceUsageTag, CBSubmitLog>;
     CBSubmitLogRangeMap log_map_;
+    // Tags before this one may be from a dropped log, and have no access record
+    ResourceUsageTag collapsed_end_tag_ = 0;
 };
 
 // Batch that has wait-before-signal dependencies.
@@ -247,7 +266,7 @@ struct UnresolvedBatch {
     std::vector<VkSemaphoreSubmitInfo> signals;
 
     // Queue's label stack at the beginning of this batch
-    std::vector<std::string> label_stack;
+    vvl::LabelStack label_stack;
 };
 
 // Helper struct to resolve wait-before-signal
@@ -303,6 +322,7 @@ class QueueBatchContext : public CommandExecutionContext, public std::enable_sha
     const QueueSyncState *GetQueueSyncState() { return queue_state_; }
     QueueId GetQueueId() const override;
     ResourceUsageRange GetTagRange() const { return tag_range_; }
+    size_t GetBatchLogMemoryUsage() const { return batch_log_.MemoryUsage(); }
 
     ResourceUsageTag SetupBatchTags(uint32_t tag_count);
     void ResetEventsContext() { events_context_.Clear(); }
@@ -313,7 +333,7 @@ class QueueBatchContext : public CommandExecutionContext, public std::enable_sha
                                                          SignalsUpdate &signals_update);
 
     bool ValidateSubmit(const std::vector<CommandBufferConstPtr> &command_buffers, uint64_t submit_index, uint32_t batch_index,
-                        std::vector<std::string> &current_label_stack, const ErrorObject &error_obj);
+                        vvl::LabelStack &current_label_stack, const ErrorObject &error_obj);
     void ResolveSubmittedCommandBuffer(const AccessContext &recorded_context, ResourceUsageTag offset);
 
     // For Present
@@ -332,7 +352,8 @@ class QueueBatchContext : public CommandExecutionContext, public std::enable_sha
 
     template <typename Predicate>
     void ApplyPredicatedWait(Predicate &predicate);
-    void ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag);
+    // Returns false when the wait was skipped because no access of the batch can be in its scope
+    bool ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag);
     void ApplyAcquireWait(const AcquiredImage &acquired);
     void OnResourceDestroyed(const ResourceAccessRange &resource_range);
 
@@ -358,6 +379,16 @@ class QueueBatchContext : public CommandExecutionContext, public std::enable_sha
     SyncEventsContext events_context_;
     BatchAccessLog batch_log_;
     std::vector<ResourceUsageTag> queue_sync_tag_;
+
+    // Lowest tag of the accesses a tagged wait can clear, for any queue and per queue. Built by the first tagged wait of the
+    // batch. A submitted batch only loses accesses after that, so these stay lower bounds and a wait below them is a no-op.
+    struct WaitableTags {
+        ResourceUsageTag any = kInvalidTag;
+        small_vector<std::pair<QueueId, ResourceUsageTag>, 4> by_queue;
+        void Add(QueueId queue, ResourceUsageTag tag);
+        ResourceUsageTag Get(QueueId queue) const;
+    };
+    std::optional<WaitableTags> waitable_tags_;
 };
 
 class QueueSyncState {
@@ -390,6 +421,9 @@ class QueueSyncState {
     void ApplyPendingUnresolvedBatches();
     const std::vector<UnresolvedBatch> &PendingUnresolvedBatches() const { return pending_unresolved_batches_; }
 
+    // Bytes of the last batch access map in MemorySubsystem::SyncAccessMaps, updated at each present on this queue
+    uint64_t accounted_access_map_bytes = 0;
+
     // Called by the Validate methods to ensure no pending state is left.
     // Pending state is automatically cleared in PostRecord calls,
     // the only exception is when validation error happens.
@@ -60,11 +60,6 @@ void SyncValidator::DebugCapture() {
     }
 }
 
-bool SyncValidator::SyncError(SyncHazard hazard, const LogObjectList &objlist, const Location &loc,
-                              const std::string &error_message) const {
-    return LogError(string_SyncHazardVUID(hazard), objlist, loc, "%s", error_message.c_str());
-}
-
 ResourceUsageRange SyncValidator::ReserveGlobalTagRange(size_t tag_count) const {
     ResourceUsageRange reserve;
     reserve.begin = tag_limit_.fetch_add(tag_count);
@@ -74,29 +69,36 @@ ResourceUsageRange SyncValidator::ReserveGlobalTagRange(size_t tag_count) const
 
 void SyncValidator::EnsureTimelineSignalsLimit(uint32_t signals_per_queue_limit, QueueId queue) {
     for (auto &[_, signals] : timeline_signals_) {
-        const size_t initial_signal_count = signals.size();
-        vvl::unordered_map<QueueId, uint32_t> signals_per_queue;
-        for (const SignalInfo &signal : signals) {
-            ++signals_per_queue[signal.first_scope.queue];
-        }
-        const bool filter_queue = queue != kQueueIdInvalid;
-        for (auto it = signals.begin(); it != signals.end();) {
-            if (filter_queue && it->first_scope.queue != queue) {
-                ++it;
-                continue;
-            }
-            auto &counter = signals_per_queue[it->first_scope.queue];
-            if (counter > signals_per_queue_limit) {
-                it = signals.erase(it);
-                --counter;
-            } else {
-                ++it;
-            }
-        }
-        stats.RemoveTimelineSignals(uint32_t(initial_signal_count - signals.size()));
+        EnsureTimelineSignalsLimit(signals, signals_per_queue_limit, queue);
     }
 }
 
+void SyncValidator::EnsureTimelineSignalsLimit(std::vector<SignalInfo> &signals, uint32_t signals_per_queue_limit, QueueId queue) {
+    // No queue can be over the limit
+    if (signals.size() <= signals_per_queue_limit) {
+        return;
+    }
+    const size_t initial_signal_count = signals.size();
+    vvl::unordered_map<QueueId, uint32_t> signals_per_queue;
+    for (const SignalInfo &signal : signals) {
+        ++signals_per_queue[signal.first_scope.queue];
+    }
+    const bool filter_queue = queue != kQueueIdInvalid;
+    // The signals are sorted by value, the ones with the smallest values are removed
+    vvl::erase_if(signals, [&](const SignalInfo &signal) {
+        if (filter_queue && signal.first_scope.queue != queue) {
+            return false;
+        }
+        auto &counter = signals_per_queue[signal.first_scope.queue];
+        if (counter > signals_per_queue_limit) {
+            --counter;
+            return true;
+        }
+        return false;
+    });
+    stats.RemoveTimelineSignals(uint32_t(initial_signal_count - signals.size()));
+}
+
 void SyncValidator::ApplySignalsUpdate(SignalsUpdate &update, const QueueBatchContext::Ptr &last_batch) {
     // NOTE: All conserved QueueBatchContexts need to have their access logs reset to use the global
     // logger and the only conserved QBCs are those referenced by unwaited signals and the last batch.
@@ -120,7 +122,9 @@ void SyncValidator::ApplySignalsUpdate(SignalsUpdate &update, const QueueBatchCo
     }
     for (auto &[semaphore, new_signals] : update.timeline_signals) {
         std::vector<SignalInfo> &signals = timeline_signals_[semaphore];
-        vvl::Append(signals, new_signals);
+        for (const SignalInfo &new_signal : new_signals) {
+            InsertTimelineSignal(signals, SignalInfo(new_signal));
+        }
         stats.AddTimelineSignals((uint32_t)new_signals.size());
 
         // Update host sync points
@@ -148,29 +152,26 @@ void SyncValidator::ApplySignalsUpdate(SignalsUpdate &update, const QueueBatchCo
         }
     }
     for (const auto &remove_signals_request : update.remove_timeline_signals_requests) {
-        auto &signals = timeline_signals_[remove_signals_request.semaphore];
-        for (auto it = signals.begin(); it != signals.end();) {
-            const SignalInfo &signal = *it;
-            if (signal.first_scope.queue == remove_signals_request.queue &&
-                signal.timeline_value < remove_signals_request.signal_threshold_value) {
-                it = signals.erase(it);
-                stats.RemoveTimelineSignals(1);
-                continue;
-            }
-            ++it;
+        if (auto *signals = vvl::Find(timeline_signals_, remove_signals_request.semaphore)) {
+            stats.RemoveTimelineSignals(
+                EraseTimelineSignals(*signals, remove_signals_request.queue, remove_signals_request.signal_threshold_value));
         }
     }
 
     // Enforce max signals limit in case timeline is signaled multiple times and never/rarely is waited on.
-    // This does not introduce errors/false-positives (check EnsureTimelineSignalsLimit documentation)
+    // This does not introduce errors/false-positives (check EnsureTimelineSignalsLimit documentation).
+    // Only the signaled semaphores can go over the limit.
     const uint32_t kMaxTimelineSignalsPerQueue = 100;
-    EnsureTimelineSignalsLimit(kMaxTimelineSignalsPerQueue);
+    for (const auto &[semaphore, _] : update.timeline_signals) {
+        EnsureTimelineSignalsLimit(timeline_signals_[semaphore], kMaxTimelineSignalsPerQueue, kQueueIdInvalid);
+    }
 }
 
 void SyncValidator::ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag) {
     auto tagged_wait_op = [queue_id, tag](const QueueBatchContext::Ptr &batch) {
-        batch->ApplyTaggedWait(queue_id, tag);
-        batch->Trim();
+        if (batch->ApplyTaggedWait(queue_id, tag)) {
+            batch->Trim();
+        }
 
         // If there is a *pending* last batch then apply tagged wait for its accesses too.
         // A pending last batch might exist if this wait was initiated between QueueSubmit's
@@ -178,8 +179,7 @@ void SyncValidator::ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag) {
         // contain *imported* accesses that are in the scope of this wait.
         auto batch_queue_state = batch->GetQueueSyncState();
         auto pending_batch = batch_queue_state ? batch_queue_state->PendingLastBatch() : nullptr;
-        if (pending_batch) {
-            pending_batch->ApplyTaggedWait(queue_id, tag);
+        if (pending_batch && pending_batch->ApplyTaggedWait(queue_id, tag)) {
             pending_batch->Trim();
         }
     };
@@ -268,11 +268,7 @@ void SyncValidator::WaitForSemaphore(VkSemaphore semaphore, uint64_t value) {
 
     // Remove signals before the resolving one (keep the resolving signal).
     std::vector<SignalInfo> &signals = timeline_signals_[semaphore];
-    const size_t initial_signal_count = signals.size();
-    vvl::erase_if(signals, [&sync_point](SignalInfo &signal) {
-        return signal.first_scope.queue == sync_point.queue_id && signal.timeline_value < sync_point.timeline_value;
-    });
-    stats.RemoveTimelineSignals(uint32_t(initial_signal_count - signals.size()));
+    stats.RemoveTimelineSignals(EraseTimelineSignals(signals, sync_point.queue_id, sync_point.timeline_value));
 
     // We can remove all sync points that are in the scope of current wait.
     // Subsequent attempts to synchronize on the host with already synchronized
@@ -313,11 +309,16 @@ void SyncValidator::Created(vvl::Swapchain &swapchain_state) {
 }
 
 void SyncValidator::Created(vvl::Image &image_state) {
-    image_state.SetSubState(container_type, std::make_unique<syncval_state::ImageSubState>(image_state));
+    image_state.SetSubState(container_type, std::make_unique<syncval_state::ImageSubState>(image_state, image_encoder_cache_));
+}
+
+void SyncValidator::Created(vvl::ImageView &view_state) {
+    view_state.SetSubState(container_type, std::make_unique<syncval_state::ImageViewSubState>(view_state));
 }
 
 void SyncValidator::PreCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator,
                                                const RecordObject &record_obj) {
+    DrainSubmitValidation();
     if (const auto buffer_state = Get<vvl::Buffer>(buffer)) {
         const VkDeviceSize base_address = ResourceBaseAddress(*buffer_state);
         const ResourceAccessRange buffer_range(base_address, base_address + buffer_state->create_info.size);
@@ -331,6 +332,7 @@ void SyncValidator::PreCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer,
 
 void SyncValidator::PreCallRecordDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator,
                                               const RecordObject &record_obj) {
+    DrainSubmitValidation();
     if (const auto image_state = Get<vvl::Image>(image)) {
         auto batch_op = [&image_state](const QueueBatchContext::Ptr &batch) {
             const auto &sub_state = syncval_state::SubState(*image_state);
@@ -368,9 +370,10 @@ bool SyncValidator::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer,
             auto hazard = context->DetectHazard(*src_buffer, SYNC_COPY_TRANSFER_READ, src_range);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, srcBuffer);
-                const std::string error = error_messages_.BufferCopyError(hazard, *cb_context, error_obj.location.function,
-                                                                          FormatHandle(srcBuffer), region_index, src_range);
-                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, [&, region_index = region_index]() {
+                    return error_messages_.BufferCopyError(hazard, *cb_context, error_obj.location.function,
+                                                           FormatHandle(srcBuffer), region_index, src_range);
+                });
             }
         }
         if (dst_buffer && !skip) {
@@ -378,9 +381,10 @@ bool SyncValidator::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer,
             auto hazard = context->DetectHazard(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, dst_range);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, dstBuffer);
-                const std::string error = error_messages_.BufferCopyError(hazard, *cb_context, error_obj.location.function,
-                                                                          FormatHandle(dstBuffer), region_index, dst_range);
-                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, [&, region_index = region_index]() {
+                    return error_messages_.BufferCopyError(hazard, *cb_context, error_obj.location.function,
+                                                           FormatHandle(dstBuffer), region_index, dst_range);
+                });
             }
         }
         if (skip) break;
@@ -409,10 +413,10 @@ bool SyncValidator::PreCallValidateCmdCopyBuffer2(VkCommandBuffer commandBuffer,
                 // TODO -- add tag information to log msg when useful.
                 // TODO: there are no tests for this error
                 const LogObjectList objlist(commandBuffer, pCopyBufferInfo->srcBuffer);
-                const std::string error =
-                    error_messages_.BufferCopyError(hazard, *cb_context, error_obj.location.function,
-                                                    FormatHandle(pCopyBufferInfo->srcBuffer), region_index, src_range);
-                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, [&, region_index = region_index]() {
+                    return error_messages_.BufferCopyError(hazard, *cb_context, error_obj.location.function,
+                                                           FormatHandle(pCopyBufferInfo->srcBuffer), region_index, src_range);
+                });
             }
         }
         if (dst_buffer && !skip) {
@@ -421,10 +425,10 @@ bool SyncValidator::PreCallValidateCmdCopyBuffer2(VkCommandBuffer commandBuffer,
             if (hazard.IsHazard()) {
                 // TODO: there are no tests for this error
                 const LogObjectList objlist(commandBuffer, pCopyBufferInfo->dstBuffer);
-                const std::string error =
-                    error_messages_.BufferCopyError(hazard, *cb_context, error_obj.location.function,
-                                                    FormatHandle(pCopyBufferInfo->dstBuffer), region_index, dst_range);
-                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, [&, region_index = region_index]() {
+                    return error_messages_.BufferCopyError(hazard, *cb_context, error_obj.location.function,
+                                                           FormatHandle(pCopyBufferInfo->dstBuffer), region_index, dst_range);
+                });
             }
         }
         if (skip) break;
@@ -458,10 +462,12 @@ bool SyncValidator::PreCallValidateCmdCopyImage(VkCommandBuffer commandBuffer, V
                                                 copy_region.extent, false, SYNC_COPY_TRANSFER_READ);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, srcImage);
-                const std::string error = error_messages_.ImageCopyResolveBlitError(
-                    hazard, *cb_access_context, error_obj.location.function, FormatHandle(srcImage), region_index,
-                    copy_region.srcOffset, copy_region.extent, copy_region.srcSubresource);
-                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+                const auto make_error = [&, region_index = region_index, &copy_region = copy_region]() {
+                    return error_messages_.ImageCopyResolveBlitError(hazard, *cb_access_context, error_obj.location.function,
+                                                                     FormatHandle(srcImage), region_index, copy_region.srcOffset,
+                                                                     copy_region.extent, copy_region.srcSubresource);
+                };
+                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, make_error);
             }
         }
 
@@ -470,10 +476,12 @@ bool SyncValidator::PreCallValidateCmdCopyImage(VkCommandBuffer commandBuffer, V
                                                 copy_region.extent, false, SYNC_COPY_TRANSFER_WRITE);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, dstImage);
-                const std::string error = error_messages_.ImageCopyResolveBlitError(
-                    hazard, *cb_access_context, error_obj.location.function, FormatHandle(dstImage), region_index,
-                    copy_region.dstOffset, copy_region.extent, copy_region.dstSubresource);
-                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+                const auto make_error = [&, region_index = region_index, &copy_region = copy_region]() {
+                    return error_messages_.ImageCopyResolveBlitError(hazard, *cb_access_context, error_obj.location.function,
+                                                                     FormatHandle(dstImage), region_index, copy_region.dstOffset,
+                                                                     copy_region.extent, copy_region.dstSubresource);
+                };
+                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, make_error);
             }
             if (skip) break;
         }
@@ -503,11 +511,13 @@ bool SyncValidator::PreCallValidateCmdCopyImage2(VkCommandBuffer commandBuffer,
                                                 copy_region.extent, false, SYNC_COPY_TRANSFER_READ);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, pCopyImageInfo->srcImage);
-                const std::string error = error_messages_.ImageCopyResolveBlitError(
-                    hazard, *cb_access_context, error_obj.location.function, FormatHandle(pCopyImageInfo->srcImage), region_index,
-                    copy_region.srcOffset, copy_region.extent, copy_region.srcSubresource);
                 // TODO: this error not covered by the test
-                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+                const auto make_error = [&, region_index = region_index, &copy_region = copy_region]() {
+                    return error_messages_.ImageCopyResolveBlitError(
+                        hazard, *cb_access_context, error_obj.location.function, FormatHandle(pCopyImageInfo->srcImage),
+                        region_index, copy_region.srcOffset, copy_region.extent, copy_region.srcSubresource);
+                };
+                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, make_error);
             }
         }
 
@@ -516,10 +526,12 @@ bool SyncValidator::PreCallValidateCmdCopyImage2(VkCommandBuffer commandBuffer,
                                                 copy_region.extent, false, SYNC_COPY_TRANSFER_WRITE);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, pCopyImageInfo->dstImage);
-                const std::string error = error_messages_.ImageCopyResolveBlitError(
-                    hazard, *cb_access_context, error_obj.location.function, FormatHandle(pCopyImageInfo->dstImage), region_index,
-                    copy_region.dstOffset, copy_region.extent, copy_region.dstSubresource);
-                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+                const auto make_error = [&, region_index = region_index, &copy_region = copy_region]() {
+                    return error_messages_.ImageCopyResolveBlitError(
+                        hazard, *cb_access_context, error_obj.location.function, FormatHandle(pCopyImageInfo->dstImage),
+                        region_index, copy_region.dstOffset, copy_region.extent, copy_region.dstSubresource);
+                };
+                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, make_error);
             }
             if (skip) break;
         }
@@ -636,6 +648,7 @@ void SyncValidator::FinishDeviceSetup(const VkDeviceCreateInfo *pCreateInfo, con
 
 void SyncValidator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
                                                const RecordObject &record_obj) {
+    DrainSubmitValidation();
     queue_sync_states_.clear();
     binary_signals_.clear();
     timeline_signals_.clear();
@@ -654,6 +667,7 @@ void SyncValidator::PostCallRecordCreateSemaphore(VkDevice device, const VkSemap
 
 void SyncValidator::PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator,
                                                   const RecordObject &record_obj) {
+    DrainSubmitValidation();
     if (auto sem_state = Get<vvl::Semaphore>(semaphore); sem_state && (sem_state->type == VK_SEMAPHORE_TYPE_TIMELINE)) {
         if (auto it = timeline_signals_.find(semaphore); it != timeline_signals_.end()) {
             stats.RemoveTimelineSignals((uint32_t)it->second.size());
@@ -664,6 +678,7 @@ void SyncValidator::PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore s
 
 bool SyncValidator::ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                             const VkSubpassBeginInfo *pSubpassBeginInfo, const ErrorObject &error_obj) const {
+    VVL_CheckStatsScope(dispatch_device_, "SyncValidator::ValidateBeginRenderPass");
     bool skip = false;
     const auto cb_state = Get<vvl::CommandBuffer>(commandBuffer);
     if (cb_state) {
@@ -774,10 +789,11 @@ bool SyncValidator::PreCallValidateCmdBeginRendering(VkCommandBuffer commandBuff
     if (!cb_state || !pRenderingInfo) return skip;
 
     vvl::TlsGuard<syncval_state::BeginRenderingCmdState> cmd_state(&skip, std::move(cb_state));
-    cmd_state->AddRenderingInfo(*this, *pRenderingInfo);
+    const CommandBufferAccessContext &cb_access_context = *syncval_state::AccessContext(*cmd_state->cb_state);
+    cmd_state->AddRenderingInfo(*this, *pRenderingInfo, cb_access_context.GetLastDynamicRenderingInfo());
 
     // We need to set skip, because the TlsGuard destructor is looking at the skip value for RAII cleanup.
-    skip |= syncval_state::AccessContext(*cmd_state->cb_state)->ValidateBeginRendering(error_obj, *cmd_state);
+    skip |= cb_access_context.ValidateBeginRendering(error_obj, *cmd_state);
     return skip;
 }
 
@@ -849,9 +865,10 @@ bool SyncValidator::ValidateCmdCopyBufferToImage(VkCommandBuffer commandBuffer,
                 if (hazard.IsHazard()) {
                     // PHASE1 TODO -- add tag information to log msg when useful.
                     const LogObjectList objlist(commandBuffer, srcBuffer);
-                    const std::string error = error_messages_.BufferCopyError(hazard, *cb_access_context, loc.function,
-                                                                              FormatHandle(srcBuffer), region_index, src_range);
-                    skip |= SyncError(hazard.Hazard(), objlist, loc, error);
+                    skip |= SyncError(hazard.Hazard(), objlist, loc, [&, region_index = region_index]() {
+                        return error_messages_.BufferCopyError(hazard, *cb_access_context, loc.function, FormatHandle(srcBuffer),
+                                                               region_index, src_range);
+                    });
                 }
             }
 
@@ -859,10 +876,11 @@ bool SyncValidator::ValidateCmdCopyBufferToImage(VkCommandBuffer commandBuffer,
                                            copy_region.imageExtent, false, SYNC_COPY_TRANSFER_WRITE);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, dstImage);
-                const std::string error = error_messages_.ImageCopyResolveBlitError(
-                    hazard, *cb_access_context, loc.function, FormatHandle(dstImage), region_index, copy_region.imageOffset,
-                    copy_region.imageExtent, copy_region.imageSubresource);
-                skip |= SyncError(hazard.Hazard(), objlist, loc, error);
+                skip |= SyncError(hazard.Hazard(), objlist, loc, [&, region_index = region_index, &copy_region = copy_region]() {
+                    return error_messages_.ImageCopyResolveBlitError(hazard, *cb_access_context, loc.function,
+                                                                     FormatHandle(dstImage), region_index, copy_region.imageOffset,
+                                                                     copy_region.imageExtent, copy_region.imageSubresource);
+                });
             }
             if (skip) break;
         }
@@ -915,10 +933,11 @@ bool SyncValidator::ValidateCmdCopyImageToBuffer(VkCommandBuffer commandBuffer,
                                                 copy_region.imageExtent, false, SYNC_COPY_TRANSFER_READ);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, srcImage);
-                const std::string error = error_messages_.ImageCopyResolveBlitError(
-                    hazard, *cb_access_context, loc.function, FormatHandle(srcImage), region_index, copy_region.imageOffset,
-                    copy_region.imageExtent, copy_region.imageSubresource);
-                skip |= SyncError(hazard.Hazard(), objlist, loc, error);
+                skip |= SyncError(hazard.Hazard(), objlist, loc, [&, region_index = region_index, &copy_region = copy_region]() {
+                    return error_messages_.ImageCopyResolveBlitError(hazard, *cb_access_context, loc.function,
+                                                                     FormatHandle(srcImage), region_index, copy_region.imageOffset,
+                                                                     copy_region.imageExtent, copy_region.imageSubresource);
+                });
             }
             if (dst_memory != VK_NULL_HANDLE) {
                 ResourceAccessRange dst_range =
@@ -926,9 +945,10 @@ bool SyncValidator::ValidateCmdCopyImageToBuffer(VkCommandBuffer commandBuffer,
                 hazard = context->DetectHazard(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, dst_range);
                 if (hazard.IsHazard()) {
                     const LogObjectList objlist(commandBuffer, dstBuffer);
-                    const std::string error = error_messages_.BufferCopyError(hazard, *cb_access_context, loc.function,
-                                                                              FormatHandle(dstBuffer), region_index, dst_range);
-                    skip |= SyncError(hazard.Hazard(), objlist, loc, error);
+                    skip |= SyncError(hazard.Hazard(), objlist, loc, [&, region_index = region_index]() {
+                        return error_messages_.BufferCopyError(hazard, *cb_access_context, loc.function, FormatHandle(dstBuffer),
+                                                               region_index, dst_range);
+                    });
                 }
             }
         }
@@ -987,10 +1007,11 @@ bool SyncValidator::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage
                                                 SYNC_BLIT_TRANSFER_READ);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, srcImage);
-                const std::string error =
-                    error_messages_.ImageCopyResolveBlitError(hazard, *cb_access_context, loc.function, FormatHandle(srcImage),
-                                                              region_index, offset, extent, blit_region.srcSubresource);
-                skip |= SyncError(hazard.Hazard(), objlist, loc, error);
+                skip |= SyncError(hazard.Hazard(), objlist, loc, [&, region_index = region_index, &blit_region = blit_region]() {
+                    return error_messages_.ImageCopyResolveBlitError(hazard, *cb_access_context, loc.function,
+                                                                     FormatHandle(srcImage), region_index, offset, extent,
+                                                                     blit_region.srcSubresource);
+                });
             }
         }
 
@@ -1005,10 +1026,11 @@ bool SyncValidator::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage
                                                 SYNC_BLIT_TRANSFER_WRITE);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, dstImage);
-                const std::string error =
-                    error_messages_.ImageCopyResolveBlitError(hazard, *cb_access_context, loc.function, FormatHandle(dstImage),
-                                                              region_index, offset, extent, blit_region.dstSubresource);
-                skip |= SyncError(hazard.Hazard(), objlist, loc, error);
+                skip |= SyncError(hazard.Hazard(), objlist, loc, [&, region_index = region_index, &blit_region = blit_region]() {
+                    return error_messages_.ImageCopyResolveBlitError(hazard, *cb_access_context, loc.function,
+                                                                     FormatHandle(dstImage), region_index, offset, extent,
+                                                                     blit_region.dstSubresource);
+                });
             }
             if (skip) break;
         }
@@ -1039,6 +1061,7 @@ bool SyncValidator::PreCallValidateCmdBlitImage2(VkCommandBuffer commandBuffer,
 bool SyncValidator::ValidateIndirectBuffer(const CommandBufferAccessContext &cb_context, const AccessContext &context,
                                            const VkDeviceSize struct_size, const VkBuffer buffer, const VkDeviceSize offset,
                                            const uint32_t drawCount, const uint32_t stride, const Location &loc) const {
+    VVL_CheckStatsScope(dispatch_device_, "SyncValidator::ValidateIndirectBuffer");
     bool skip = false;
     if (drawCount == 0) return skip;
 
@@ -1051,8 +1074,9 @@ bool SyncValidator::ValidateIndirectBuffer(const CommandBufferAccessContext &cb_
         if (hazard.IsHazard()) {
             const LogObjectList objlist(cb_context.GetCBState().Handle(), buf_state->Handle());
             const std::string resource_description = "indirect " + FormatHandle(buffer);
-            const auto error = error_messages_.BufferError(hazard, cb_context, loc.function, resource_description, range);
-            skip |= SyncError(hazard.Hazard(), objlist, loc, error);
+            skip |= SyncError(hazard.Hazard(), objlist, loc, [&]() {
+                return error_messages_.BufferError(hazard, cb_context, loc.function, resource_description, range);
+            });
         }
     } else {
         for (uint32_t i = 0; i < drawCount; ++i) {
@@ -1061,8 +1085,9 @@ bool SyncValidator::ValidateIndirectBuffer(const CommandBufferAccessContext &cb_
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(cb_context.GetCBState().Handle(), buf_state->Handle());
                 const std::string resource_description = "indirect " + FormatHandle(buffer);
-                const auto error = error_messages_.BufferError(hazard, cb_context, loc.function, resource_description, range);
-                skip |= SyncError(hazard.Hazard(), objlist, loc, error);
+                skip |= SyncError(hazard.Hazard(), objlist, loc, [&]() {
+                    return error_messages_.BufferError(hazard, cb_context, loc.function, resource_description, range);
+                });
                 break;
             }
         }
@@ -1102,8 +1127,9 @@ bool SyncValidator::ValidateCountBuffer(const CommandBufferAccessContext &cb_con
     if (hazard.IsHazard()) {
         const LogObjectList objlist(cb_context.GetCBState().Handle(), count_buf_state->Handle());
         const std::string resource_description = "draw count " + FormatHandle(buffer);
-        const auto error = error_messages_.BufferError(hazard, cb_context, loc.function, resource_description, range);
-        skip |= SyncError(hazard.Hazard(), objlist, loc, error);
+        skip |= SyncError(hazard.Hazard(), objlist, loc, [&]() {
+            return error_messages_.BufferError(hazard, cb_context, loc.function, resource_description, range);
+        });
     }
     return skip;
 }
@@ -1211,6 +1237,7 @@ bool SyncValidator::PreCallValidateCmdDraw(VkCommandBuffer commandBuffer, uint32
     if (!cb_state) return skip;
     const auto *cb_access_context = syncval_state::AccessContext(*cb_state);
 
+    syncval_stats::DrawScope stats_scope(stats);
     skip |= cb_access_context->ValidateDispatchDrawDescriptorSet(VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
     skip |= cb_access_context->ValidateDrawVertex(vertexCount, firstVertex, error_obj.location);
     skip |= cb_access_context->ValidateDrawAttachment(error_obj.location);
@@ -1238,6 +1265,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndexed(VkCommandBuffer commandBuffer,
     if (!cb_state) return skip;
     const auto *cb_access_context = syncval_state::AccessContext(*cb_state);
 
+    syncval_stats::DrawScope stats_scope(stats);
     skip |= cb_access_context->ValidateDispatchDrawDescriptorSet(VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
     skip |= cb_access_context->ValidateDrawVertexIndex(indexCount, firstIndex, error_obj.location);
     skip |= cb_access_context->ValidateDrawAttachment(error_obj.location);
@@ -1271,6 +1299,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndirect(VkCommandBuffer commandBuffer
     assert(context);
     if (!context) return skip;
 
+    syncval_stats::DrawScope stats_scope(stats);
     skip |= cb_access_context->ValidateDispatchDrawDescriptorSet(VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
     skip |= cb_access_context->ValidateDrawAttachment(error_obj.location);
     skip |= ValidateIndirectBuffer(*cb_access_context, *context, sizeof(VkDrawIndirectCommand), buffer, offset, drawCount, stride,
@@ -1309,6 +1338,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndexedIndirect(VkCommandBuffer comman
     assert(context);
     if (!context) return skip;
 
+    syncval_stats::DrawScope stats_scope(stats);
     skip |= cb_access_context->ValidateDispatchDrawDescriptorSet(VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
     skip |= cb_access_context->ValidateDrawAttachment(error_obj.location);
     skip |= ValidateIndirectBuffer(*cb_access_context, *context, sizeof(VkDrawIndexedIndirectCommand), buffer, offset, drawCount,
@@ -1348,6 +1378,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndirectCount(VkCommandBuffer commandB
     assert(context);
     if (!context) return skip;
 
+    syncval_stats::DrawScope stats_scope(stats);
     skip |= cb_access_context->ValidateDispatchDrawDescriptorSet(VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
     skip |= cb_access_context->ValidateDrawAttachment(error_obj.location);
     skip |= ValidateIndirectBuffer(*cb_access_context, *context, sizeof(VkDrawIndirectCommand), buffer, offset, maxDrawCount,
@@ -1427,6 +1458,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndexedIndirectCount(VkCommandBuffer c
     assert(context);
     if (!context) return skip;
 
+    syncval_stats::DrawScope stats_scope(stats);
     skip |= cb_access_context->ValidateDispatchDrawDescriptorSet(VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
     skip |= cb_access_context->ValidateDrawAttachment(error_obj.location);
     skip |= ValidateIndirectBuffer(*cb_access_context, *context, sizeof(VkDrawIndexedIndirectCommand), buffer, offset, maxDrawCount,
@@ -1514,9 +1546,10 @@ bool SyncValidator::PreCallValidateCmdClearColorImage(VkCommandBuffer commandBuf
             auto hazard = context->DetectHazard(*image_state, SYNC_CLEAR_TRANSFER_WRITE, range, false);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, image);
-                const auto error = error_messages_.ImageClearError(hazard, *cb_access_context, error_obj.location.function,
-                                                                   FormatHandle(image), range_index, range);
-                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, [&, range_index = range_index, &range = range]() {
+                    return error_messages_.ImageClearError(hazard, *cb_access_context, error_obj.location.function,
+                                                           FormatHandle(image), range_index, range);
+                });
             }
         }
     }
@@ -1543,9 +1576,10 @@ bool SyncValidator::PreCallValidateCmdClearDepthStencilImage(VkCommandBuffer com
             auto hazard = context->DetectHazard(*image_state, SYNC_CLEAR_TRANSFER_WRITE, range, false);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, image);
-                const auto error = error_messages_.ImageClearError(hazard, *cb_access_context, error_obj.location.function,
-                                                                   FormatHandle(image), range_index, range);
-                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, [&, range_index = range_index, &range = range]() {
+                    return error_messages_.ImageClearError(hazard, *cb_access_context, error_obj.location.function,
+                                                           FormatHandle(image), range_index, range);
+                });
             }
         }
     }
@@ -1592,9 +1626,10 @@ bool SyncValidator::PreCallValidateCmdCopyQueryPoolResults(VkCommandBuffer comma
         if (hazard.IsHazard()) {
             const LogObjectList objlist(commandBuffer, queryPool, dstBuffer);
             const std::string resource_description = "dstBuffer " + FormatHandle(dstBuffer);
-            const auto error =
-                error_messages_.BufferError(hazard, *cb_access_context, error_obj.location.function, resource_description, range);
-            skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+            skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, [&]() {
+                return error_messages_.BufferError(hazard, *cb_access_context, error_obj.location.function, resource_description,
+                                                   range);
+            });
         }
     }
 
@@ -1622,9 +1657,10 @@ bool SyncValidator::PreCallValidateCmdFillBuffer(VkCommandBuffer commandBuffer,
         if (hazard.IsHazard()) {
             const LogObjectList objlist(commandBuffer, dstBuffer);
             const std::string resource_description = "dstBuffer " + FormatHandle(dstBuffer);
-            const auto error =
-                error_messages_.BufferError(hazard, *cb_access_context, error_obj.location.function, resource_description, range);
-            skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+            skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, [&]() {
+                return error_messages_.BufferError(hazard, *cb_access_context, error_obj.location.function, resource_description,
+                                                   range);
+            });
         }
     }
     return skip;
@@ -1652,10 +1688,12 @@ bool SyncValidator::PreCallValidateCmdResolveImage(VkCommandBuffer commandBuffer
                                                 resolve_region.srcOffset, resolve_region.extent, false, SYNC_RESOLVE_TRANSFER_READ);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, srcImage);
-                const std::string error = error_messages_.ImageCopyResolveBlitError(
-                    hazard, *cb_access_context, error_obj.location.function, FormatHandle(srcImage), region_index,
-                    resolve_region.srcOffset, resolve_region.extent, resolve_region.srcSubresource);
-                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+                const auto make_error = [&, region_index = region_index, &resolve_region = resolve_region]() {
+                    return error_messages_.ImageCopyResolveBlitError(hazard, *cb_access_context, error_obj.location.function,
+                                                                     FormatHandle(srcImage), region_index, resolve_region.srcOffset,
+                                                                     resolve_region.extent, resolve_region.srcSubresource);
+                };
+                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, make_error);
             }
         }
 
@@ -1665,10 +1703,12 @@ bool SyncValidator::PreCallValidateCmdResolveImage(VkCommandBuffer commandBuffer
                                       resolve_region.extent, false, SYNC_RESOLVE_TRANSFER_WRITE);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, dstImage);
-                const std::string error = error_messages_.ImageCopyResolveBlitError(
-                    hazard, *cb_access_context, error_obj.location.function, FormatHandle(dstImage), region_index,
-                    resolve_region.dstOffset, resolve_region.extent, resolve_region.dstSubresource);
-                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+                const auto make_error = [&, region_index = region_index, &resolve_region = resolve_region]() {
+                    return error_messages_.ImageCopyResolveBlitError(hazard, *cb_access_context, error_obj.location.function,
+                                                                     FormatHandle(dstImage), region_index, resolve_region.dstOffset,
+                                                                     resolve_region.extent, resolve_region.dstSubresource);
+                };
+                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, make_error);
             }
             if (skip) break;
         }
@@ -1700,11 +1740,13 @@ bool SyncValidator::PreCallValidateCmdResolveImage2(VkCommandBuffer commandBuffe
                                                 resolve_region.srcOffset, resolve_region.extent, false, SYNC_RESOLVE_TRANSFER_READ);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, pResolveImageInfo->srcImage);
-                const std::string error = error_messages_.ImageCopyResolveBlitError(
-                    hazard, *cb_access_context, error_obj.location.function, FormatHandle(pResolveImageInfo->srcImage),
-                    region_index, resolve_region.srcOffset, resolve_region.extent, resolve_region.srcSubresource);
                 // TODO: this error is not covered by the test
-                skip |= SyncError(hazard.Hazard(), objlist, region_loc, error);
+                const auto make_error = [&, region_index = region_index, &resolve_region = resolve_region]() {
+                    return error_messages_.ImageCopyResolveBlitError(
+                        hazard, *cb_access_context, error_obj.location.function, FormatHandle(pResolveImageInfo->srcImage),
+                        region_index, resolve_region.srcOffset, resolve_region.extent, resolve_region.srcSubresource);
+                };
+                skip |= SyncError(hazard.Hazard(), objlist, region_loc, make_error);
             }
         }
 
@@ -1714,11 +1756,13 @@ bool SyncValidator::PreCallValidateCmdResolveImage2(VkCommandBuffer commandBuffe
                                       resolve_region.extent, false, SYNC_RESOLVE_TRANSFER_WRITE);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, pResolveImageInfo->dstImage);
-                const std::string error = error_messages_.ImageCopyResolveBlitError(
-                    hazard, *cb_access_context, error_obj.location.function, FormatHandle(pResolveImageInfo->dstImage),
-                    region_index, resolve_region.dstOffset, resolve_region.extent, resolve_region.dstSubresource);
                 // TODO: this error is not covered by the test
-                skip |= SyncError(hazard.Hazard(), objlist, region_loc, error);
+                const auto make_error = [&, region_index = region_index, &resolve_region = resolve_region]() {
+                    return error_messages_.ImageCopyResolveBlitError(
+                        hazard, *cb_access_context, error_obj.location.function, FormatHandle(pResolveImageInfo->dstImage),
+                        region_index, resolve_region.dstOffset, resolve_region.extent, resolve_region.dstSubresource);
+                };
+                skip |= SyncError(hazard.Hazard(), objlist, region_loc, make_error);
             }
             if (skip) break;
         }
@@ -1754,9 +1798,10 @@ bool SyncValidator::PreCallValidateCmdUpdateBuffer(VkCommandBuffer commandBuffer
         if (hazard.IsHazard()) {
             const LogObjectList objlist(commandBuffer, dstBuffer);
             const std::string resource_description = "dstBuffer " + FormatHandle(dstBuffer);
-            const auto error =
-                error_messages_.BufferError(hazard, *cb_access_context, error_obj.location.function, resource_description, range);
-            skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+            skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, [&]() {
+                return error_messages_.BufferError(hazard, *cb_access_context, error_obj.location.function, resource_description,
+                                                   range);
+            });
         }
     }
     return skip;
@@ -1782,9 +1827,10 @@ bool SyncValidator::PreCallValidateCmdWriteBufferMarkerAMD(VkCommandBuffer comma
         auto hazard = context->DetectHazard(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, range);
         if (hazard.IsHazard()) {
             const std::string resource_description = "dstBuffer " + FormatHandle(dstBuffer);
-            const auto error =
-                error_messages_.BufferError(hazard, *cb_access_context, error_obj.location.function, resource_description, range);
-            skip |= SyncError(hazard.Hazard(), dstBuffer, error_obj.location, error);
+            skip |= SyncError(hazard.Hazard(), dstBuffer, error_obj.location, [&]() {
+                return error_messages_.BufferError(hazard, *cb_access_context, error_obj.location.function, resource_description,
+                                                   range);
+            });
         }
     }
     return skip;
@@ -1832,9 +1878,10 @@ bool SyncValidator::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer commandBuff
         if (hazard.IsHazard()) {
             const std::string resource_description = "bitstream buffer " + FormatHandle(pDecodeInfo->srcBuffer);
             // TODO: there are no tests for this error
-            const auto error = error_messages_.BufferError(hazard, *cb_access_context, error_obj.location.function,
-                                                           resource_description, src_range);
-            skip |= SyncError(hazard.Hazard(), src_buffer->Handle(), error_obj.location, error);
+            skip |= SyncError(hazard.Hazard(), src_buffer->Handle(), error_obj.location, [&]() {
+                return error_messages_.BufferError(hazard, *cb_access_context, error_obj.location.function, resource_description,
+                                                   src_range);
+            });
         }
     }
 
@@ -1848,9 +1895,9 @@ bool SyncValidator::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer commandBuff
             ss << " ";
             FormatVideoPictureResouce(*this, pDecodeInfo->dstPictureResource, ss);
             const std::string resouce_description = ss.str();
-            const std::string error =
-                error_messages_.VideoError(hazard, *cb_access_context, error_obj.location.function, resouce_description);
-            skip |= SyncError(hazard.Hazard(), dst_resource.image_view_state->Handle(), error_obj.location, error);
+            skip |= SyncError(hazard.Hazard(), dst_resource.image_view_state->Handle(), error_obj.location, [&]() {
+                return error_messages_.VideoError(hazard, *cb_access_context, error_obj.location.function, resouce_description);
+            });
         }
     }
 
@@ -1869,9 +1916,9 @@ bool SyncValidator::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer commandBuff
                 ss << " ";
                 FormatVideoPictureResouce(*this, video_picture, ss);
                 const std::string resouce_description = ss.str();
-                const std::string error =
-                    error_messages_.VideoError(hazard, *cb_access_context, error_obj.location.function, resouce_description);
-                skip |= SyncError(hazard.Hazard(), setup_resource.image_view_state->Handle(), error_obj.location, error);
+                skip |= SyncError(hazard.Hazard(), setup_resource.image_view_state->Handle(), error_obj.location, [&]() {
+                    return error_messages_.VideoError(hazard, *cb_access_context, error_obj.location.function, resouce_description);
+                });
             }
         }
     }
@@ -1892,9 +1939,10 @@ bool SyncValidator::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer commandBuff
                     ss << " ";
                     FormatVideoPictureResouce(*this, video_picture, ss);
                     const std::string resouce_description = ss.str();
-                    const std::string error =
-                        error_messages_.VideoError(hazard, *cb_access_context, error_obj.location.function, resouce_description);
-                    skip |= SyncError(hazard.Hazard(), reference_resource.image_view_state->Handle(), error_obj.location, error);
+                    skip |= SyncError(hazard.Hazard(), reference_resource.image_view_state->Handle(), error_obj.location, [&]() {
+                        return error_messages_.VideoError(hazard, *cb_access_context, error_obj.location.function,
+                                                          resouce_description);
+                    });
                 }
             }
         }
@@ -1924,9 +1972,10 @@ bool SyncValidator::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer commandBuff
         auto hazard = context->DetectHazard(*dst_buffer, SYNC_VIDEO_ENCODE_VIDEO_ENCODE_WRITE, dst_range);
         if (hazard.IsHazard()) {
             const std::string resource_description = "bitstream buffer " + FormatHandle(pEncodeInfo->dstBuffer);
-            const auto error = error_messages_.BufferError(hazard, *cb_access_context, error_obj.location.function,
-                                                           resource_description, dst_range);
-            skip |= SyncError(hazard.Hazard(), dst_buffer->Handle(), error_obj.location, error);
+            skip |= SyncError(hazard.Hazard(), dst_buffer->Handle(), error_obj.location, [&]() {
+                return error_messages_.BufferError(hazard, *cb_access_context, error_obj.location.function, resource_description,
+                                                   dst_range);
+            });
         }
     }
 
@@ -1940,9 +1989,9 @@ bool SyncValidator::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer commandBuff
             FormatVideoPictureResouce(*this, pEncodeInfo->srcPictureResource, ss);
             const std::string resouce_description = ss.str();
             // TODO: there are no tests for this error
-            const std::string error =
-                error_messages_.VideoError(hazard, *cb_access_context, error_obj.location.function, resouce_description);
-            skip |= SyncError(hazard.Hazard(), src_resource.image_view_state->Handle(), error_obj.location, error);
+            skip |= SyncError(hazard.Hazard(), src_resource.image_view_state->Handle(), error_obj.location, [&]() {
+                return error_messages_.VideoError(hazard, *cb_access_context, error_obj.location.function, resouce_description);
+            });
         }
     }
 
@@ -1961,9 +2010,9 @@ bool SyncValidator::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer commandBuff
                 ss << " ";
                 FormatVideoPictureResouce(*this, video_picture, ss);
                 const std::string resouce_description = ss.str();
-                const std::string error =
-                    error_messages_.VideoError(hazard, *cb_access_context, error_obj.location.function, resouce_description);
-                skip |= SyncError(hazard.Hazard(), setup_resource.image_view_state->Handle(), error_obj.location, error);
+                skip |= SyncError(hazard.Hazard(), setup_resource.image_view_state->Handle(), error_obj.location, [&]() {
+                    return error_messages_.VideoError(hazard, *cb_access_context, error_obj.location.function, resouce_description);
+                });
             }
         }
     }
@@ -1984,9 +2033,10 @@ bool SyncValidator::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer commandBuff
                     ss << " ";
                     FormatVideoPictureResouce(*this, video_picture, ss);
                     const std::string resource_description = ss.str();
-                    const std::string error =
-                        error_messages_.VideoError(hazard, *cb_access_context, error_obj.location.function, resource_description);
-                    skip |= SyncError(hazard.Hazard(), reference_resource.image_view_state->Handle(), error_obj.location, error);
+                    skip |= SyncError(hazard.Hazard(), reference_resource.image_view_state->Handle(), error_obj.location, [&]() {
+                        return error_messages_.VideoError(hazard, *cb_access_context, error_obj.location.function,
+                                                          resource_description);
+                    });
                 }
             }
         }
@@ -2009,9 +2059,10 @@ bool SyncValidator::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer commandBuff
                     ss << " ";
                     FormatVideoQuantizationMap(*this, *quantization_map_info, ss);
                     const std::string resource_description = ss.str();
-                    const std::string error =
-                        error_messages_.VideoError(hazard, *cb_access_context, error_obj.location.function, resource_description);
-                    skip |= SyncError(hazard.Hazard(), image_view_state->Handle(), error_obj.location, error);
+                    skip |= SyncError(hazard.Hazard(), image_view_state->Handle(), error_obj.location, [&]() {
+                        return error_messages_.VideoError(hazard, *cb_access_context, error_obj.location.function,
+                                                          resource_description);
+                    });
                 }
             }
         }
@@ -2234,9 +2285,10 @@ bool SyncValidator::PreCallValidateCmdWriteBufferMarker2AMD(VkCommandBuffer comm
         if (hazard.IsHazard()) {
             const std::string resource_description = "dstBuffer " + FormatHandle(dstBuffer);
             // TODO: there are no tests for this error
-            const auto error =
-                error_messages_.BufferError(hazard, *cb_access_context, error_obj.location.function, resource_description, range);
-            skip |= SyncError(hazard.Hazard(), dstBuffer, error_obj.location, error);
+            skip |= SyncError(hazard.Hazard(), dstBuffer, error_obj.location, [&]() {
+                return error_messages_.BufferError(hazard, *cb_access_context, error_obj.location.function, resource_description,
+                                                   range);
+            });
         }
     }
     return skip;
@@ -2329,6 +2381,7 @@ void SyncValidator::PostCallRecordBindImageMemory2KHR(VkDevice device, uint32_t
 }
 
 void SyncValidator::PostCallRecordQueueWaitIdle(VkQueue queue, const RecordObject &record_obj) {
+    DrainSubmitValidation();
     if (record_obj.result != VK_SUCCESS || !syncval_settings.submit_time_validation || queue == VK_NULL_HANDLE) {
         return;
     }
@@ -2349,6 +2402,7 @@ void SyncValidator::PostCallRecordQueueWaitIdle(VkQueue queue, const RecordObjec
 }
 
 void SyncValidator::PostCallRecordDeviceWaitIdle(VkDevice device, const RecordObject &record_obj) {
+    DrainSubmitValidation();
     // We need to treat this a fence waits for all queues... noting that present engine ops will be preserved.
     ForAllQueueBatchContexts(
         [](const QueueBatchContext::Ptr &batch) { batch->ApplyTaggedWait(kQueueAny, ResourceUsageRecord::kMaxIndex); });
@@ -2371,6 +2425,7 @@ struct QueuePresentCmdState {
 
 bool SyncValidator::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo,
                                                    const ErrorObject &error_obj) const {
+    DrainSubmitValidation();
     bool skip = false;
 
     // Since this early return is above the TlsGuard, the Record phase must also be.
@@ -2467,6 +2522,18 @@ void SyncValidator::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresent
         presented.ExportToSwapchain(*this);
     }
     queue_state->ApplyPendingLastBatch();
+    stats.OnFrameBoundary(queue_state->LastBatch().get());
+    UpdateAccessMapAccounting(*queue_state);
+}
+
+void SyncValidator::UpdateAccessMapAccounting(QueueSyncState &queue_state) {
+    // A map entry and its tree node links, the read states that did not fit inline are not counted
+    constexpr uint64_t kEntryBytes = sizeof(ResourceAccessRangeMap::value_type) + 4 * sizeof(void *);
+    const auto last_batch = queue_state.LastBatch();
+    const uint64_t bytes = last_batch ? last_batch->GetCurrentAccessContext()->GetAccessStateMap().size() * kEntryBytes : 0;
+    memory_accounting.Add(vvl::profiling::MemorySubsystem::SyncAccessMaps, bytes);
+    memory_accounting.Sub(vvl::profiling::MemorySubsystem::SyncAccessMaps, queue_state.accounted_access_map_bytes);
+    queue_state.accounted_access_map_bytes = bytes;
 }
 
 void SyncValidator::PostCallRecordAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout,
@@ -2485,6 +2552,7 @@ void SyncValidator::PostCallRecordAcquireNextImage2KHR(VkDevice device, const Vk
 
 void SyncValidator::RecordAcquireNextImageState(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore,
                                                 VkFence fence, uint32_t *pImageIndex, const RecordObject &record_obj) {
+    DrainSubmitValidation();
     if ((VK_SUCCESS != record_obj.result) && (VK_SUBOPTIMAL_KHR != record_obj.result)) return;
 
     // Get the image out of the presented list and create apppropriate fences/semaphores.
@@ -2550,12 +2618,53 @@ static std::vector<CommandBufferConstPtr> GetCommandBuffers(const vvl::DeviceSta
 
 bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
                                         const ErrorObject &error_obj) const {
-    bool skip = false;
-
+    VVL_CheckStatsScope(dispatch_device_, "SyncValidator::ValidateQueueSubmit");
     // Since this early return is above the TlsGuard, the Record phase must also be.
-    if (!syncval_settings.submit_time_validation) return skip;
+    if (!syncval_settings.submit_time_validation) return false;
+
+    const auto queue_sync_state = GetQueueSyncStateShared(queue);
+    if (!queue_sync_state) return false;  // Invalid Queue
+
+    // The labels of the submit time, the queue label stack can change before an async validation runs
+    vvl::LabelStack label_stack = queue_sync_state->GetQueueState()->cmdbuf_label_stack;
+
+    if (!syncval_settings.async_submit_validation) {
+        return ValidateAndRecordQueueSubmit(queue, submitCount, pSubmits, fence, std::move(label_stack), error_obj);
+    }
+
+    // The submit info is copied, the command buffers, semaphores and fence are looked up when the job runs.
+    // The host synchronization points and the destruction of these objects drain the queue first.
+    auto submits = std::make_shared<std::vector<vku::safe_VkSubmitInfo2>>();
+    submits->reserve(submitCount);
+    for (uint32_t i = 0; i < submitCount; i++) {
+        submits->emplace_back(&pSubmits[i]);
+    }
+    const vvl::Func command = error_obj.location.function;
+    const VulkanTypedHandle handle = error_obj.handle;
+    submit_validation_queue_.Post([this, queue, fence, submits, label_stack = std::move(label_stack), command, handle]() mutable {
+        const ErrorObject async_error_obj(command, handle);
+        ValidateAndRecordQueueSubmit(queue, static_cast<uint32_t>(submits->size()),
+                                     reinterpret_cast<const VkSubmitInfo2 *>(submits->data()), fence, std::move(label_stack),
+                                     async_error_obj);
+    });
+    // Errors are reported by the job, the submit is not skipped
+    return false;
+}
+
+void SyncValidator::DrainSubmitValidation() const {
+    if (syncval_settings.async_submit_validation) {
+        submit_validation_queue_.WaitIdle();
+    }
+}
+
+bool SyncValidator::ValidateAndRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits,
+                                                 VkFence fence, vvl::LabelStack &&label_stack,
+                                                 const ErrorObject &error_obj) const {
+    bool skip = false;
 
-    std::lock_guard lock_guard(queue_submit_mutex_);
+    // Pending queue state only lives inside one locked section: every time the lock is taken the pending state left by a
+    // skipped submit on another queue is cleared.
+    std::unique_lock lock(queue_submit_mutex_);
 
     ClearPending();
 
@@ -2572,7 +2681,7 @@ bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, con
     uint64_t submit_id = queue_sync_state->ReserveSubmitId();
 
     // Update label stack as we progress through batches and command buffers
-    auto current_label_stack = queue_sync_state->GetQueueState()->cmdbuf_label_stack;
+    auto current_label_stack = std::move(label_stack);
 
     BatchContextConstPtr last_batch = queue_sync_state->LastBatch();
     bool has_unresolved_batches = !queue_sync_state->UnresolvedBatches().empty();
@@ -2622,7 +2731,15 @@ bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, con
         const auto async_batches = batch->RegisterAsyncContexts(resolved_batches);
 
         const auto command_buffers = GetCommandBuffers(*device_state, submit);
+
+        // The batch owns copies of the last batch of this queue and of the waited batches, and keeps alive the async batches
+        // of the other queues, which submits to those queues replace but do not modify. This queue has no unresolved batches,
+        // so other submits can't change its state either: the command buffers, usually the expensive part of the submit,
+        // are validated without blocking the submits to other queues.
+        lock.unlock();
         skip |= batch->ValidateSubmit(command_buffers, submit_id, batch_idx, current_label_stack, error_obj);
+        lock.lock();
+        ClearPending();
 
         const auto submit_signals = vvl::make_span(submit.pSignalSemaphoreInfos, submit.signalSemaphoreInfoCount);
         new_timeline_signals |= signals_update.RegisterSignals(batch, submit_signals);
@@ -2696,18 +2813,22 @@ bool SyncValidator::PropagateTimelineSignalsIteration(std::vector<UnresolvedQueu
             queue.queue_state->PendingLastBatch() ? queue.queue_state->PendingLastBatch() : queue.queue_state->LastBatch();
         const BatchContextPtr initial_last_batch = last_batch;
 
-        while (!queue.unresolved_batches.empty()) {
-            auto &unresolved_batch = queue.unresolved_batches.front();
-
+        // The batches are processed in submission order, up to the first one that still waits for a signal
+        size_t processed_count = 0;
+        for (UnresolvedBatch &unresolved_batch : queue.unresolved_batches) {
             has_new_timeline_signals |= ProcessUnresolvedBatch(unresolved_batch, signals_update, last_batch, skip, error_obj);
-
-            // Remove processed batch from the (local) unresolved list
-            queue.unresolved_batches.erase(queue.unresolved_batches.begin());
+            if (!unresolved_batch.unresolved_waits.empty()) {
+                break;
+            }
+            ++processed_count;
+            stats.RemoveUnresolvedBatch();
+        }
+        if (processed_count != 0) {
+            // Remove processed batches from the (local) unresolved list, at once rather than one by one from the front
+            queue.unresolved_batches.erase(queue.unresolved_batches.begin(), queue.unresolved_batches.begin() + processed_count);
 
             // Propagate change into the queue's (global) unresolved state
             queue.update_unresolved = true;
-
-            stats.RemoveUnresolvedBatch();
         }
         if (last_batch != initial_last_batch) {
             queue.queue_state->SetPendingLastBatch(std::move(last_batch));
@@ -2797,6 +2918,7 @@ bool SyncValidator::PreCallValidateQueueSubmit2(VkQueue queue, uint32_t submitCo
 }
 
 void SyncValidator::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, const RecordObject &record_obj) {
+    DrainSubmitValidation();
     if (!syncval_settings.submit_time_validation) return;
     if (record_obj.result == VK_SUCCESS) {
         // fence is signalled, mark it as waited for
@@ -2806,6 +2928,7 @@ void SyncValidator::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence,
 
 void SyncValidator::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
                                                 uint64_t timeout, const RecordObject &record_obj) {
+    DrainSubmitValidation();
     if (!syncval_settings.submit_time_validation) return;
     if ((record_obj.result == VK_SUCCESS) && ((VK_TRUE == waitAll) || (1 == fenceCount))) {
         // We can only know the pFences have signal if we waited for all of them, or there was only one of them
@@ -2817,6 +2940,7 @@ void SyncValidator::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceC
 
 bool SyncValidator::PreCallValidateSignalSemaphore(VkDevice device, const VkSemaphoreSignalInfo *pSignalInfo,
                                                    const ErrorObject &error_obj) const {
+    DrainSubmitValidation();
     bool skip = false;
     if (!syncval_settings.submit_time_validation) {
         return skip;
@@ -2874,6 +2998,7 @@ void SyncValidator::PostCallRecordSignalSemaphoreKHR(VkDevice device, const VkSe
 
 void SyncValidator::PostCallRecordWaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo, uint64_t timeout,
                                                  const RecordObject &record_obj) {
+    DrainSubmitValidation();
     if (!syncval_settings.submit_time_validation) {
         return;
     }
@@ -2892,6 +3017,7 @@ void SyncValidator::PostCallRecordWaitSemaphoresKHR(VkDevice device, const VkSem
 
 void SyncValidator::PostCallRecordGetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore, uint64_t *pValue,
                                                            const RecordObject &record_obj) {
+    DrainSubmitValidation();
     if (!syncval_settings.submit_time_validation) {
         return;
     }
@@ -2927,7 +3053,7 @@ void SyncValidator::PostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapc
 // Otherwise returns a valid buffer (device address is associated with a single buffer).
 // When syncval adds memory aliasing support the need of this function can be revisited.
 static const vvl::Buffer *GetSingleBufferFromDeviceAddress(const vvl::DeviceState &device, VkDeviceAddress device_address) {
-    vvl::span<vvl::Buffer *const> buffers = device.GetBuffersByAddress(device_address);
+    const auto buffers = device.GetBuffersByAddress(device_address);
     if (buffers.empty()) {
         return nullptr;
     }
@@ -3054,9 +3180,10 @@ bool SyncValidator::PreCallValidateCmdBuildAccelerationStructuresKHR(
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, scratch_buffer.Handle());
                 const std::string resource_description = "scratch buffer " + FormatHandle(scratch_buffer.VkHandle());
-                const auto error =
-                    error_messages_.BufferError(hazard, cb_context, error_obj.location.function, resource_description, range);
-                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, [&]() {
+                    return error_messages_.BufferError(hazard, cb_context, error_obj.location.function, resource_description,
+                                                       range);
+                });
             }
         }
         // Validate access to source acceleration structure
@@ -3067,10 +3194,11 @@ bool SyncValidator::PreCallValidateCmdBuildAccelerationStructuresKHR(
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, src_accel->buffer_state->Handle(), src_accel->Handle());
                 const std::string resource_description = FormatHandle(src_accel->buffer_state->VkHandle());
-                const std::string error = error_messages_.AccelerationStructureError(
-                    hazard, cb_context, error_obj.location.function, resource_description, range, info.srcAccelerationStructure,
-                    info_loc.dot(Field::srcAccelerationStructure));
-                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, [&, &info = info]() {
+                    return error_messages_.AccelerationStructureError(hazard, cb_context, error_obj.location.function,
+                                                                      resource_description, range, info.srcAccelerationStructure,
+                                                                      info_loc.dot(Field::srcAccelerationStructure));
+                });
             }
         }
         // Validate access to the acceleration structure being built
@@ -3081,10 +3209,11 @@ bool SyncValidator::PreCallValidateCmdBuildAccelerationStructuresKHR(
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, dst_accel->buffer_state->Handle(), dst_accel->Handle());
                 const std::string resource_description = FormatHandle(dst_accel->buffer_state->VkHandle());
-                const std::string error = error_messages_.AccelerationStructureError(
-                    hazard, cb_context, error_obj.location.function, resource_description, dst_range, info.dstAccelerationStructure,
-                    info_loc.dot(Field::dstAccelerationStructure));
-                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+                skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, [&, &info = info]() {
+                    return error_messages_.AccelerationStructureError(
+                        hazard, cb_context, error_obj.location.function, resource_description, dst_range,
+                        info.dstAccelerationStructure, info_loc.dot(Field::dstAccelerationStructure));
+                });
             }
         }
         // Validate geometry buffers
@@ -3107,13 +3236,14 @@ bool SyncValidator::PreCallValidateCmdBuildAccelerationStructuresKHR(
                 auto hazard = context.DetectHazard(geometry_data, SYNC_ACCELERATION_STRUCTURE_BUILD_SHADER_READ, geometry_range);
                 if (hazard.IsHazard()) {
                     const LogObjectList objlist(commandBuffer, geometry_data.Handle());
-                    std::stringstream ss;
-                    ss << data_description << " ";
-                    ss << FormatHandle(geometry_data.Handle());
-                    const std::string resource_description = ss.str();
-                    const std::string error = error_messages_.BufferError(hazard, cb_context, error_obj.location.function,
-                                                                          resource_description, geometry_range);
-                    return SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+                    return SyncError(hazard.Hazard(), objlist, error_obj.location, [&]() {
+                        std::stringstream ss;
+                        ss << data_description << " ";
+                        ss << FormatHandle(geometry_data.Handle());
+                        const std::string resource_description = ss.str();
+                        return error_messages_.BufferError(hazard, cb_context, error_obj.location.function, resource_description,
+                                                           geometry_range);
+                    });
                 }
                 return false;
             };
@@ -3242,9 +3372,11 @@ bool SyncValidator::PreCallValidateCmdCopyAccelerationStructureKHR(VkCommandBuff
         if (hazard.IsHazard()) {
             const LogObjectList objlist(cb_state->Handle(), src_accel->buffer_state->Handle(), src_accel->Handle());
             const std::string resource_description = FormatHandle(src_accel->buffer_state->VkHandle());
-            const std::string error = error_messages_.AccelerationStructureError(
-                hazard, cb_context, error_obj.location.function, resource_description, range, pInfo->src, info_loc.dot(Field::src));
-            skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+            skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, [&]() {
+                return error_messages_.AccelerationStructureError(hazard, cb_context, error_obj.location.function,
+                                                                  resource_description, range, pInfo->src,
+                                                                  info_loc.dot(Field::src));
+            });
         }
     }
     if (const auto dst_accel = Get<vvl::AccelerationStructureKHR>(pInfo->dst)) {
@@ -3254,9 +3386,11 @@ bool SyncValidator::PreCallValidateCmdCopyAccelerationStructureKHR(VkCommandBuff
         if (hazard.IsHazard()) {
             const LogObjectList objlist(cb_state->Handle(), dst_accel->buffer_state->Handle(), dst_accel->Handle());
             const std::string resource_description = FormatHandle(dst_accel->buffer_state->VkHandle());
-            const std::string error = error_messages_.AccelerationStructureError(
-                hazard, cb_context, error_obj.location.function, resource_description, range, pInfo->dst, info_loc.dot(Field::dst));
-            skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+            skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, [&]() {
+                return error_messages_.AccelerationStructureError(hazard, cb_context, error_obj.location.function,
+                                                                  resource_description, range, pInfo->dst,
+                                                                  info_loc.dot(Field::dst));
+            });
         }
     }
     return skip;
@@ -3304,9 +3438,11 @@ bool SyncValidator::PreCallValidateCmdCopyAccelerationStructureToMemoryKHR(VkCom
         if (hazard.IsHazard()) {
             const LogObjectList objlist(cb_state->Handle(), src_accel->buffer_state->Handle(), src_accel->Handle());
             const std::string resource_description = FormatHandle(src_accel->buffer_state->VkHandle());
-            const std::string error = error_messages_.AccelerationStructureError(
-                hazard, cb_context, error_obj.location.function, resource_description, range, pInfo->src, info_loc.dot(Field::src));
-            skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+            skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, [&]() {
+                return error_messages_.AccelerationStructureError(hazard, cb_context, error_obj.location.function,
+                                                                  resource_description, range, pInfo->src,
+                                                                  info_loc.dot(Field::src));
+            });
         }
     }
 
@@ -3354,9 +3490,11 @@ bool SyncValidator::PreCallValidateCmdCopyMemoryToAccelerationStructureKHR(VkCom
         if (hazard.IsHazard()) {
             const LogObjectList objlist(cb_state->Handle(), dst_accel->buffer_state->Handle(), dst_accel->Handle());
             const std::string resource_description = FormatHandle(dst_accel->buffer_state->VkHandle());
-            const std::string error = error_messages_.AccelerationStructureError(
-                hazard, cb_context, error_obj.location.function, resource_description, range, pInfo->dst, info_loc.dot(Field::dst));
-            skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+            skip |= SyncError(hazard.Hazard(), objlist, error_obj.location, [&]() {
+                return error_messages_.AccelerationStructureError(hazard, cb_context, error_obj.location.function,
+                                                                  resource_description, range, pInfo->dst,
+                                                                  info_loc.dot(Field::dst));
+            });
         }
     }
 
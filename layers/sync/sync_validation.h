@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <vulkan/vulkan.h>
 
@@ -25,6 +26,7 @@
 #include "sync/sync_access_context.h"
 #include "sync/sync_commandbuffer.h"
 #include "sync/sync_error_messages.h"
+#include "sync/sync_image.h"
 #include "sync/sync_stats.h"
 #include "sync/sync_submit.h"
 #include "containers/limits.h"
@@ -37,7 +39,7 @@ class Instance : public vvl::InstanceProxy {
 };
 }  // namespace syncval
 
-class SyncValidator : public vvl::DeviceProxy {
+class SyncValidator final : public vvl::DeviceProxy {
     using BaseClass = vvl::DeviceProxy;
 
   public:
@@ -64,7 +66,14 @@ class SyncValidator : public vvl::DeviceProxy {
     std::vector<std::shared_ptr<QueueSyncState>> queue_sync_states_;
     QueueId queue_id_limit_ = 0;
 
+    // Guards the queue states during a submit, released while the command buffers of a batch are validated
     mutable std::mutex queue_submit_mutex_;
+    // Checks the first use hazards of large command buffers at submit time
+    mutable vvl::TaskPool first_use_pool_;
+    // The queue history memory limit is reported the first time it drops logs
+    mutable std::atomic<bool> queue_history_collapse_reported_{false};
+    syncval_state::ImageEncoderCache image_encoder_cache_;
+    SubpassBarrierCache subpass_barrier_cache_;
 
     // Semaphore signal registry
     vvl::unordered_map<VkSemaphore, SignalInfo> binary_signals_;
@@ -78,7 +87,15 @@ class SyncValidator : public vvl::DeviceProxy {
     uint32_t debug_reset_count = 1;
     std::string debug_cmdbuf_pattern;
 
-    bool SyncError(SyncHazard hazard, const LogObjectList &objlist, const Location &loc, const std::string &error_message) const;
+    // Runs the submit time validation in submit order when async_submit_validation is set.
+    // Declared last so that it is destroyed, and its jobs run, before the state they use.
+    mutable vvl::JobQueue submit_validation_queue_{1};
+
+    // The message is only built when it is going to be reported, hazards that are filtered out cost no formatting
+    template <typename MessageFunc>
+    bool SyncError(SyncHazard hazard, const LogObjectList &objlist, const Location &loc, MessageFunc &&make_message) const {
+        return LogErrorDeferred(string_SyncHazardVUID(hazard), objlist, loc, std::forward<MessageFunc>(make_message));
+    }
 
     // Ensures that the number of signals per timeline per queue does not exceed the specified limit.
     // If `queue` parameter is specified, then only that queue is checked (used by vkQueueWaitIdle).
@@ -90,6 +107,7 @@ class SyncValidator : public vvl::DeviceProxy {
     // unspecified. In the current implementation we keep multiple signals per timeline to have additional
     // options of validation, but, for example, keeping only the last signal is sufficient.
     void EnsureTimelineSignalsLimit(uint32_t signals_per_queue_limit, QueueId queue = kQueueIdInvalid);
+    void EnsureTimelineSignalsLimit(std::vector<SignalInfo> &signals, uint32_t signals_per_queue_limit, QueueId queue);
 
     // Applies information from update object to binary_signals_/timeline_signals_.
     // The update object is mutable to be able to std::move SignalInfo from it.
@@ -110,6 +128,9 @@ class SyncValidator : public vvl::DeviceProxy {
     template <typename BatchOp>
     void ForAllQueueBatchContexts(BatchOp &&op);
 
+    // Accounts the access map of the last batch of the presenting queue, which is externally synchronized at that point
+    void UpdateAccessMapAccounting(QueueSyncState &queue_state);
+
     void UpdateFenceHostSyncPoint(VkFence fence, FenceHostSyncPoint &&sync_point);
 
     void WaitForFence(VkFence fence);
@@ -128,6 +149,7 @@ class SyncValidator : public vvl::DeviceProxy {
     void Created(vvl::CommandBuffer &cb_state) override;
     void Created(vvl::Swapchain &swapchain_state) override;
     void Created(vvl::Image &image_state) override;
+    void Created(vvl::ImageView &view_state) override;
 
     void DebugCapture() final;
 
@@ -493,6 +515,10 @@ class SyncValidator : public vvl::DeviceProxy {
                                      VkFence fence, uint32_t *pImageIndex, const RecordObject &record_obj);
     bool ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
                              const ErrorObject &error_obj) const;
+    bool ValidateAndRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
+                                      vvl::LabelStack &&label_stack, const ErrorObject &error_obj) const;
+    // Waits for the submits validated asynchronously, before host synchronization and object destruction
+    void DrainSubmitValidation() const;
     bool PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
                                     const ErrorObject &error_obj) const override;
     void RecordQueueSubmit(VkQueue queue, VkFence fence, QueueSubmitCmdState *cmd_state);
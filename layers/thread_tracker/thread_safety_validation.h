@@ -18,11 +18,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <shared_mutex>
 #include <string>
 #include <thread>
+#include <vector>
 #include "chassis/validation_object.h"
 
 namespace threadsafety {
@@ -102,12 +104,16 @@ class Counter {
   public:
     VulkanObjectType object_type{};
     Logger *logger{};
+    // Each thread checks one out of this many uses of the objects of this type (thread_safety_sampling)
+    uint32_t sampling = 1;
 
     vvl::concurrent_unordered_map<T, std::shared_ptr<ObjectUseData>, 6> object_table;
 
-    void Init(VulkanObjectType type, Logger *val_obj) {
+    template <typename ValidationObject>
+    void Init(VulkanObjectType type, ValidationObject *val_obj) {
         object_type = type;
         logger = val_obj;
+        sampling = std::max(val_obj->global_settings.thread_safety_sampling, 1u);
     }
 
     void CreateObject(T object) { object_table.insert(object, std::make_shared<ObjectUseData>()); }
@@ -136,10 +142,14 @@ class Counter {
         if (object == VK_NULL_HANDLE) {
             return;
         }
+        if (SkipUse(object)) {
+            return;
+        }
         auto use_data = FindObject(object, loc);
         if (!use_data) {
             return;
         }
+        PushInFlightUse(object, use_data);
 
         const std::thread::id tid = std::this_thread::get_id();
         const ObjectUseData::WriteReadCount prev_count = use_data->AddWriter();
@@ -174,7 +184,11 @@ class Counter {
         if (object == VK_NULL_HANDLE) {
             return;
         }
-        auto use_data = FindObject(object, loc);
+        std::shared_ptr<ObjectUseData> use_data;
+        if (!PopInFlightUse(object, use_data)) {
+            use_data = FindObject(object, loc);
+        }
+        // Also the case of a use left out by sampling
         if (!use_data) {
             return;
         }
@@ -185,10 +199,14 @@ class Counter {
         if (object == VK_NULL_HANDLE) {
             return;
         }
+        if (SkipUse(object)) {
+            return;
+        }
         auto use_data = FindObject(object, loc);
         if (!use_data) {
             return;
         }
+        PushInFlightUse(object, use_data);
 
         const std::thread::id tid = std::this_thread::get_id();
         const ObjectUseData::WriteReadCount prev_count = use_data->AddReader();
@@ -209,7 +227,11 @@ class Counter {
         if (object == VK_NULL_HANDLE) {
             return;
         }
-        auto use_data = FindObject(object, loc);
+        std::shared_ptr<ObjectUseData> use_data;
+        if (!PopInFlightUse(object, use_data)) {
+            use_data = FindObject(object, loc);
+        }
+        // Also the case of a use left out by sampling
         if (!use_data) {
             return;
         }
@@ -217,6 +239,56 @@ class Counter {
     }
 
   private:
+    // Objects this thread started using and did not finish using yet. Start and Finish of an object are paired in the same
+    // call on the same thread, so Finish gets the use data back from here instead of looking up object_table a second time.
+    // A null use data is a use left out by sampling, its Finish must not touch the counts either.
+    struct InFlightUse {
+        const Counter *counter;
+        T object;
+        std::shared_ptr<ObjectUseData> use_data;
+    };
+    static inline thread_local std::vector<InFlightUse> in_flight_uses_;
+    static inline thread_local uint32_t thread_use_count_ = 0;
+    static constexpr size_t kMaxInFlightUses = 64;
+
+    // Sampling is counted per thread so that it adds no shared atomic of its own
+    bool SkipUse(T object) {
+        if (sampling == 1 || ++thread_use_count_ % sampling == 0) {
+            return false;
+        }
+        // A skipped use that cannot be remembered is checked instead, its Finish would not know to skip
+        if (in_flight_uses_.size() == kMaxInFlightUses) {
+            return false;
+        }
+        in_flight_uses_.emplace_back(InFlightUse{this, object, nullptr});
+        return true;
+    }
+
+    void PushInFlightUse(T object, const std::shared_ptr<ObjectUseData> &use_data) {
+        // Bounds the list if a Finish ever goes missing. Only checked uses are evicted, their Finish falls back to the
+        // object_table lookup.
+        if (in_flight_uses_.size() == kMaxInFlightUses) {
+            auto evicted_it = std::find_if(in_flight_uses_.begin(), in_flight_uses_.end(),
+                                           [](const InFlightUse &in_flight_use) { return in_flight_use.use_data != nullptr; });
+            if (evicted_it == in_flight_uses_.end()) {
+                return;
+            }
+            in_flight_uses_.erase(evicted_it);
+        }
+        in_flight_uses_.emplace_back(InFlightUse{this, object, use_data});
+    }
+
+    bool PopInFlightUse(T object, std::shared_ptr<ObjectUseData> &out_use_data) {
+        for (auto it = in_flight_uses_.rbegin(); it != in_flight_uses_.rend(); ++it) {
+            if (it->counter == this && it->object == object) {
+                out_use_data = std::move(it->use_data);
+                in_flight_uses_.erase(std::next(it).base());
+                return true;
+            }
+        }
+        return false;
+    }
+
     std::string GetErrorMessage(std::thread::id tid, std::thread::id other_tid) const {
         std::stringstream err_str;
         err_str << "THREADING ERROR : object of type " << string_VulkanObjectType(object_type)
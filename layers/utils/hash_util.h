@@ -21,11 +21,14 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
-#include <mutex>
+#include <shared_mutex>
 #include <string_view>
 #include <type_traits>
 #include <vector>
 #include "containers/custom_containers.h"
+#include "containers/sharded_map.h"
+#include "containers/small_vector.h"
+#include "utils/lock_utils.h"
 
 // Hash and equality utilities for supporting hashing containers (e.g. unordered_set, unordered_map)
 namespace hash_util {
@@ -121,41 +124,74 @@ struct IsOrderedContainer {
 //       execution.
 //
 // The entries of the dictionary are shared_pointers (the contents of
-// which are invariant with resize/insert), with the hash and equality
-// template arguments wrapped in a shared pointer dereferencing
-// function object
+// which are invariant with resize/insert). The entries are spread over
+// shards by the hash of their value, each shard behind a reader/writer
+// lock: looking up a value that is already in the dictionary only takes
+// the reader lock, a new value is added under the writer lock of its shard.
 template <typename T, typename Hasher = vvl::hash<T>, typename KeyEqual = std::equal_to<T>>
 class Dictionary {
   public:
     using Def = T;
     using Id = std::shared_ptr<const Def>;
 
+    Dictionary() : shift_bits_(64), shards_(std::make_unique<Shard[]>(vvl::DefaultShardCount())) {
+        for (uint32_t count = 1; count < vvl::DefaultShardCount(); count *= 2) {
+            --shift_bits_;
+        }
+    }
+    Dictionary(const Dictionary &) = delete;
+    Dictionary &operator=(const Dictionary &) = delete;
+
     // Find the unique entry match the provided value, adding if needed
-    // TODO: segregate lookup from insert, using reader/write locks to reduce contention -- if needed
     template <typename U = T>
     Id LookUp(U &&value) {
-        // We create an Id from the value, which will either be retained by dict (if new) or deleted on return (if extant)
-        Id from_input = std::make_shared<T>(std::forward<U>(value));
-
-        // Insert takes care of the "unique" id part by rejecting the insert if a key matching by_value exists, but returning us
-        // the Id of the extant shared_pointer(id->def) instead.
-        // return the value of the Iterator from the <Iterator, bool> pair returned by insert
-        Guard g(lock);  // Dict isn't thread safe, and use is presumed to be multi-threaded
-        return *dict.insert(from_input).first;
+        const T &def = value;
+        const size_t hash = Hasher()(def);
+        Shard &shard = shards_[ShardIndex(hash)];
+        {
+            ReadLockGuard guard(shard.lock);
+            if (Id found = Find(shard, hash, def)) {
+                return found;
+            }
+        }
+
+        // Created without the lock, another thread can add the same value in the meantime
+        Id from_input = std::make_shared<const T>(std::forward<U>(value));
+        WriteLockGuard guard(shard.lock);
+        if (Id found = Find(shard, hash, *from_input)) {
+            return found;
+        }
+        shard.entries[hash].emplace_back(from_input);
+        return from_input;
     }
 
   private:
-    struct HashKeyValue {
-        size_t operator()(const Id &value) const { return Hasher()(*value); }
-    };
-    struct KeyValueEqual {
-        bool operator()(const Id &lhs, const Id &rhs) const { return KeyEqual()(*lhs, *rhs); }
+    // Values with the same hash share an entry
+    using Entries = vvl::unordered_map<size_t, small_vector<Id, 1>>;
+
+    struct alignas(64) Shard {
+        std::shared_mutex lock;
+        Entries entries;
     };
-    using Dict = vvl::unordered_set<Id, HashKeyValue, KeyValueEqual>;
-    using Lock = std::mutex;
-    using Guard = std::lock_guard<Lock>;
-    Lock lock;
-    Dict dict;
+
+    static Id Find(const Shard &shard, size_t hash, const T &def) {
+        auto it = shard.entries.find(hash);
+        if (it != shard.entries.end()) {
+            for (const Id &id : it->second) {
+                if (KeyEqual()(*id, def)) {
+                    return id;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    uint32_t ShardIndex(size_t hash) const {
+        return shift_bits_ == 64 ? 0 : static_cast<uint32_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> shift_bits_);
+    }
+
+    uint32_t shift_bits_;
+    std::unique_ptr<Shard[]> shards_;
 };
 
 uint32_t VuidHash(std::string_view vuid);
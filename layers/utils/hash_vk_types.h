@@ -116,3 +116,51 @@ struct hash<VkShaderModuleIdentifierEXT> {
     }
 };
 }  // namespace std
+
+// Pipeline sub-states shared between pipelines, see the Compare functions of vk_struct_compare.h for the equality. pNext chains
+// are not hashed, the structs with one are never shared.
+namespace std {
+template <>
+struct hash<vku::safe_VkPipelineColorBlendStateCreateInfo> {
+    size_t operator()(const vku::safe_VkPipelineColorBlendStateCreateInfo &value) const {
+        hash_util::HashCombiner hc;
+        hc << value.flags << value.logicOpEnable << value.logicOp << value.attachmentCount;
+        if (value.pAttachments) {
+            for (uint32_t i = 0; i < value.attachmentCount; i++) {
+                const VkPipelineColorBlendAttachmentState &attachment = value.pAttachments[i];
+                hc << attachment.blendEnable << attachment.srcColorBlendFactor << attachment.dstColorBlendFactor
+                   << attachment.colorBlendOp << attachment.srcAlphaBlendFactor << attachment.dstAlphaBlendFactor
+                   << attachment.alphaBlendOp << attachment.colorWriteMask;
+            }
+        }
+        return hc.Value();
+    }
+};
+
+template <>
+struct hash<vku::safe_VkPipelineMultisampleStateCreateInfo> {
+    size_t operator()(const vku::safe_VkPipelineMultisampleStateCreateInfo &value) const {
+        hash_util::HashCombiner hc;
+        hc << value.flags << value.rasterizationSamples << value.sampleShadingEnable << value.alphaToCoverageEnable
+           << value.alphaToOneEnable;
+        // Only the first word, the mask is as long as the sample count
+        if (value.pSampleMask) {
+            hc << value.pSampleMask[0];
+        }
+        return hc.Value();
+    }
+};
+
+template <>
+struct hash<vku::safe_VkPipelineDepthStencilStateCreateInfo> {
+    size_t operator()(const vku::safe_VkPipelineDepthStencilStateCreateInfo &value) const {
+        hash_util::HashCombiner hc;
+        hc << value.flags << value.depthTestEnable << value.depthWriteEnable << value.depthCompareOp
+           << value.depthBoundsTestEnable << value.stencilTestEnable;
+        for (const VkStencilOpState *op : {&value.front, &value.back}) {
+            hc << op->failOp << op->passOp << op->depthFailOp << op->compareOp << op->compareMask << op->writeMask << op->reference;
+        }
+        return hc.Value();
+    }
+};
+}  // namespace std
@@ -26,6 +26,7 @@
 
 #include "generated/spirv_tools_commit_id.h"
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 
@@ -52,56 +53,86 @@ void ValidationCache::GetUUID(uint8_t *uuid) {
         uuid[i] = static_cast<uint8_t>(std::strtoul(byte_str, nullptr, 16));
     }
 
-    // Replace the last 4 bytes (likely padded with zero anyway)
+    // Replace the last 8 bytes with the layout of the data that follows the header, and the options
+    std::memcpy(uuid + (VK_UUID_SIZE - 2 * sizeof(uint32_t)), &kDataVersion, sizeof(uint32_t));
     std::memcpy(uuid + (VK_UUID_SIZE - sizeof(uint32_t)), &spirv_val_option_hash_, sizeof(uint32_t));
 }
 
+uint64_t ValidationCache::GetModuleCheckKey(const uint32_t *code, size_t word_count, uint64_t device_hash) {
+    const uint64_t key[2] = {hash_util::Hash64(code, word_count * sizeof(uint32_t)), device_hash};
+    return hash_util::Hash64(key, sizeof(key));
+}
+
 void ValidationCache::Load(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
-    const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
-    auto size = headerSize;
-    if (!pCreateInfo->pInitialData || pCreateInfo->initialDataSize < size) return;
+    const size_t header_size = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
+    if (!pCreateInfo->pInitialData || pCreateInfo->initialDataSize < header_size + sizeof(uint32_t)) return;
 
-    uint32_t const *data = (uint32_t const *)pCreateInfo->pInitialData;
-    if (data[0] != size) return;
+    auto const *bytes = reinterpret_cast<uint8_t const *>(pCreateInfo->pInitialData);
+    uint32_t const *data = (uint32_t const *)bytes;
+    if (data[0] != header_size) return;
     if (data[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
     uint8_t expected_uuid[VK_UUID_SIZE];
     GetUUID(expected_uuid);
     if (memcmp(&data[2], expected_uuid, VK_UUID_SIZE) != 0) return;  // different version
 
-    data = (uint32_t const *)(reinterpret_cast<uint8_t const *>(data) + headerSize);
+    // {good_shader_hashes_ count, good_shader_hashes_, checked_module_keys_ until the end}
+    size_t offset = header_size;
+    uint32_t hash_count = 0;
+    std::memcpy(&hash_count, bytes + offset, sizeof(uint32_t));
+    offset += sizeof(uint32_t);
+    if (hash_count > (pCreateInfo->initialDataSize - offset) / sizeof(uint32_t)) return;
 
     auto guard = WriteLock();
-    for (; size < pCreateInfo->initialDataSize; data++, size += sizeof(uint32_t)) {
-        good_shader_hashes_.insert(*data);
+    for (uint32_t i = 0; i < hash_count; ++i, offset += sizeof(uint32_t)) {
+        uint32_t hash = 0;
+        std::memcpy(&hash, bytes + offset, sizeof(uint32_t));
+        good_shader_hashes_.insert(hash);
+    }
+    for (; offset + sizeof(uint64_t) <= pCreateInfo->initialDataSize; offset += sizeof(uint64_t)) {
+        uint64_t key = 0;
+        std::memcpy(&key, bytes + offset, sizeof(uint64_t));
+        checked_module_keys_.insert(key);
     }
 }
 
 void ValidationCache::Write(size_t *pDataSize, void *pData) {
     const auto header_size = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // 4 bytes for header size + 4 bytes for version number + UUID
     if (!pData) {
-        *pDataSize = header_size + good_shader_hashes_.size() * sizeof(uint32_t);
+        auto guard = ReadLock();
+        *pDataSize = header_size + sizeof(uint32_t) + good_shader_hashes_.size() * sizeof(uint32_t) +
+                     checked_module_keys_.size() * sizeof(uint64_t);
         return;
     }
 
-    if (*pDataSize < header_size) {
+    if (*pDataSize < header_size + sizeof(uint32_t)) {
         *pDataSize = 0;
         return;  // Too small for even the header!
     }
 
+    auto *bytes = static_cast<uint8_t *>(pData);
     uint32_t *out = (uint32_t *)pData;
-    size_t actual_size = header_size;
 
     // Write the header
     *out++ = header_size;
     *out++ = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
     GetUUID(reinterpret_cast<uint8_t *>(out));
-    out = (uint32_t *)(reinterpret_cast<uint8_t *>(out) + VK_UUID_SIZE);
+    size_t actual_size = header_size;
 
     {
         auto guard = ReadLock();
-        for (auto it = good_shader_hashes_.begin(); it != good_shader_hashes_.end() && actual_size < *pDataSize;
-             it++, out++, actual_size += sizeof(uint32_t)) {
-            *out = *it;
+        // Only as many as fit
+        const uint32_t hash_count = static_cast<uint32_t>(
+            std::min(good_shader_hashes_.size(), (*pDataSize - actual_size - sizeof(uint32_t)) / sizeof(uint32_t)));
+        std::memcpy(bytes + actual_size, &hash_count, sizeof(uint32_t));
+        actual_size += sizeof(uint32_t);
+
+        auto hash_it = good_shader_hashes_.begin();
+        for (uint32_t i = 0; i < hash_count; ++i, ++hash_it, actual_size += sizeof(uint32_t)) {
+            std::memcpy(bytes + actual_size, &*hash_it, sizeof(uint32_t));
+        }
+        for (auto it = checked_module_keys_.begin();
+             it != checked_module_keys_.end() && actual_size + sizeof(uint64_t) <= *pDataSize; ++it, actual_size += sizeof(uint64_t)) {
+            std::memcpy(bytes + actual_size, &*it, sizeof(uint64_t));
         }
     }
 
@@ -117,6 +148,8 @@ void ValidationCache::Merge(ValidationCache const *other) {
     auto guard = WriteLock();
     good_shader_hashes_.reserve(good_shader_hashes_.size() + other->good_shader_hashes_.size());
     for (auto h : other->good_shader_hashes_) good_shader_hashes_.insert(h);
+    checked_module_keys_.reserve(checked_module_keys_.size() + other->checked_module_keys_.size());
+    for (auto key : other->checked_module_keys_) checked_module_keys_.insert(key);
 }
 
 spv_target_env PickSpirvEnv(const APIVersion &api_version, bool spirv_1_4) {
@@ -91,6 +91,21 @@ class ValidationCache {
         good_shader_hashes_.insert(hash);
     }
 
+    // Modules that passed the stateless SPIR-V checks without a message, keyed by GetModuleCheckKey()
+    bool ContainsCheckedModule(uint64_t key) {
+        auto guard = ReadLock();
+        return checked_module_keys_.count(key) != 0;
+    }
+
+    void InsertCheckedModule(uint64_t key) {
+        auto guard = WriteLock();
+        checked_module_keys_.insert(key);
+    }
+
+    // The stateless SPIR-V checks depend on the module and on the device (features, extensions, limits), |device_hash|
+    // identifies the latter
+    static uint64_t GetModuleCheckKey(const uint32_t *code, size_t word_count, uint64_t device_hash);
+
   private:
     ValidationCache(uint32_t spirv_val_option_hash) : spirv_val_option_hash_(spirv_val_option_hash) {}
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
@@ -98,6 +113,9 @@ class ValidationCache {
 
     void GetUUID(uint8_t *uuid);
 
+    // Bumped when the layout of the data after the header changes, as the UUID alone would not reject older data
+    static constexpr uint32_t kDataVersion = 2;
+
     // Can hit cases where error appear/disappear if spirv-val settings are adjusted
     // see https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/8031
     uint32_t spirv_val_option_hash_;
@@ -107,6 +125,8 @@ class ValidationCache {
     // wrong with them; also, we expect they will get fixed, so we're less
     // likely to see them again.
     vvl::unordered_set<uint32_t> good_shader_hashes_;
+    // Same, for the stateless SPIR-V checks. 64 bit keys as they also include the device
+    vvl::unordered_set<uint64_t> checked_module_keys_;
     mutable std::shared_mutex lock_;
 };
 
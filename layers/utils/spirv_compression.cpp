@@ -0,0 +1,157 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utils/spirv_compression.h"
+
+#include <cstddef>
+
+namespace spirv {
+
+namespace {
+
+// First byte of the compressed data
+enum class Encoding : uint8_t {
+    Words = 0,         // every word is a varint
+    Instructions = 1,  // header words, then per instruction: opcode, length and the remaining words as varints
+};
+
+constexpr size_t kHeaderWordCount = 5;
+
+void WriteVarint(std::vector<uint8_t> &out, uint32_t value) {
+    while (value >= 0x80) {
+        out.emplace_back(uint8_t(value | 0x80));
+        value >>= 7;
+    }
+    out.emplace_back(uint8_t(value));
+}
+
+bool ReadVarint(const std::vector<uint8_t> &in, size_t &pos, uint32_t &value) {
+    value = 0;
+    for (uint32_t shift = 0; shift < 35; shift += 7) {
+        if (pos >= in.size()) {
+            return false;
+        }
+        const uint8_t byte = in[pos++];
+        value |= uint32_t(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Every instruction has a non zero length and ends within the binary
+bool ParsesIntoInstructions(const std::vector<uint32_t> &words) {
+    if (words.size() < kHeaderWordCount) {
+        return false;
+    }
+    size_t offset = kHeaderWordCount;
+    while (offset < words.size()) {
+        const uint32_t length = words[offset] >> 16;
+        if (length == 0 || length > words.size() - offset) {
+            return false;
+        }
+        offset += length;
+    }
+    return true;
+}
+
+}  // namespace
+
+std::vector<uint8_t> CompressWords(const std::vector<uint32_t> &words) {
+    std::vector<uint8_t> out;
+    // Most words take 1 or 2 bytes
+    out.reserve(words.size() * 2 + 8);
+    const bool instructions = ParsesIntoInstructions(words);
+    out.emplace_back(uint8_t(instructions ? Encoding::Instructions : Encoding::Words));
+    WriteVarint(out, uint32_t(words.size()));
+
+    size_t offset = 0;
+    if (instructions) {
+        for (; offset < kHeaderWordCount; ++offset) {
+            WriteVarint(out, words[offset]);
+        }
+        while (offset < words.size()) {
+            const uint32_t length = words[offset] >> 16;
+            WriteVarint(out, words[offset] & 0xffff);
+            WriteVarint(out, length);
+            for (uint32_t i = 1; i < length; ++i) {
+                WriteVarint(out, words[offset + i]);
+            }
+            offset += length;
+        }
+    } else {
+        for (; offset < words.size(); ++offset) {
+            WriteVarint(out, words[offset]);
+        }
+    }
+    out.shrink_to_fit();
+    return out;
+}
+
+bool DecompressWords(const std::vector<uint8_t> &compressed, std::vector<uint32_t> &out_words) {
+    out_words.clear();
+    if (compressed.empty()) {
+        return false;
+    }
+    const auto encoding = Encoding(compressed[0]);
+    if (encoding != Encoding::Words && encoding != Encoding::Instructions) {
+        return false;
+    }
+    size_t pos = 1;
+    uint32_t word_count = 0;
+    // Each word takes at least a byte, which bounds a bogus count
+    if (!ReadVarint(compressed, pos, word_count) || word_count > compressed.size()) {
+        return false;
+    }
+    out_words.reserve(word_count);
+
+    uint32_t value = 0;
+    if (encoding == Encoding::Instructions) {
+        for (size_t i = 0; i < kHeaderWordCount; ++i) {
+            if (!ReadVarint(compressed, pos, value)) {
+                return false;
+            }
+            out_words.emplace_back(value);
+        }
+        while (out_words.size() < word_count) {
+            uint32_t opcode = 0;
+            uint32_t length = 0;
+            if (!ReadVarint(compressed, pos, opcode) || !ReadVarint(compressed, pos, length) || length == 0 || length > 0xffff ||
+                opcode > 0xffff) {
+                return false;
+            }
+            out_words.emplace_back((length << 16) | opcode);
+            for (uint32_t i = 1; i < length; ++i) {
+                if (!ReadVarint(compressed, pos, value)) {
+                    return false;
+                }
+                out_words.emplace_back(value);
+            }
+        }
+    } else {
+        while (out_words.size() < word_count) {
+            if (!ReadVarint(compressed, pos, value)) {
+                return false;
+            }
+            out_words.emplace_back(value);
+        }
+    }
+    return out_words.size() == word_count && pos == compressed.size();
+}
+
+}  // namespace spirv
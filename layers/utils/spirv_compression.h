@@ -0,0 +1,34 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace spirv {
+
+// Lossless compression of SPIR-V that is kept around only for the rare cases that need it again (error messages pointing into
+// the shader source). Almost every word of a SPIR-V binary is a small number: ids are below the id bound and literals are mostly
+// small constants. Each word is stored as a LEB128 varint, and the first word of each instruction is split into its opcode and
+// length so it does not take 3 bytes. A binary that does not parse into instructions is still compressed word by word.
+std::vector<uint8_t> CompressWords(const std::vector<uint32_t> &words);
+
+// Returns false if |compressed| is not the output of CompressWords()
+bool DecompressWords(const std::vector<uint8_t> &compressed, std::vector<uint32_t> &out_words);
+
+}  // namespace spirv
@@ -0,0 +1,175 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/task_pool.h"
+
+#include <algorithm>
+
+#include "utils/thread_utils.h"
+
+namespace vvl {
+
+TaskPool::TaskPool(uint32_t max_threads)
+    : max_threads_(max_threads ? max_threads : DefaultPoolThreadCount()) {}
+
+TaskPool::~TaskPool() {
+    std::vector<std::thread> workers;
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        exit_ = true;
+        workers = std::move(workers_);
+    }
+    start_cond_.notify_all();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+uint32_t TaskPool::WorkerCount() const {
+    std::unique_lock<std::mutex> guard(lock_);
+    return static_cast<uint32_t>(workers_.size());
+}
+
+void TaskPool::RunIterations(const std::function<void(uint32_t)> &func, uint32_t count) {
+    for (uint32_t i = next_index_.fetch_add(1, std::memory_order_relaxed); i < count;
+         i = next_index_.fetch_add(1, std::memory_order_relaxed)) {
+        func(i);
+    }
+}
+
+void TaskPool::ParallelFor(uint32_t count, const std::function<void(uint32_t)> &func) {
+    std::unique_lock<std::mutex> loop_guard(loop_lock_, std::try_to_lock);
+    if (count < 2 || max_threads_ < 2 || !loop_guard.owns_lock()) {
+        for (uint32_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        const uint32_t wanted_workers = std::min(count, max_threads_) - 1;
+        while (workers_.size() < wanted_workers) {
+            workers_.emplace_back(&TaskPool::WorkerFunc, this);
+        }
+        next_index_.store(0, std::memory_order_relaxed);
+        func_ = &func;
+        count_ = count;
+        ++loop_id_;
+    }
+    start_cond_.notify_all();
+
+    RunIterations(func, count);
+
+    // Every index was taken, wait for the workers still running the last ones
+    std::unique_lock<std::mutex> guard(lock_);
+    done_cond_.wait(guard, [this]() { return busy_workers_ == 0; });
+    // A worker that wakes up late must not pick up a loop that is over
+    func_ = nullptr;
+}
+
+void TaskPool::WorkerFunc() {
+    ConfigureCurrentThread("TaskPoolWorker");
+    uint64_t last_loop_id = 0;
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        start_cond_.wait(guard, [this, last_loop_id]() { return exit_ || loop_id_ != last_loop_id; });
+        if (exit_) {
+            break;
+        }
+        last_loop_id = loop_id_;
+        if (!func_) {
+            continue;
+        }
+        const std::function<void(uint32_t)> &func = *func_;
+        const uint32_t count = count_;
+        ++busy_workers_;
+        guard.unlock();
+
+        RunIterations(func, count);
+
+        guard.lock();
+        if (--busy_workers_ == 0) {
+            done_cond_.notify_all();
+        }
+    }
+}
+
+JobQueue::JobQueue(uint32_t max_threads)
+    : max_threads_(max_threads ? max_threads : DefaultPoolThreadCount()) {}
+
+JobQueue::~JobQueue() {
+    std::vector<std::thread> workers;
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        exit_ = true;
+        workers = std::move(workers_);
+    }
+    job_cond_.notify_all();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+void JobQueue::Post(std::function<void()> &&job) {
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        jobs_.emplace_back(std::move(job));
+        if (idle_workers_ < jobs_.size() && workers_.size() < max_threads_) {
+            workers_.emplace_back(&JobQueue::WorkerFunc, this);
+            // Counted as idle until it picks up a job, so that the next Post() does not start another one for nothing
+            ++idle_workers_;
+        }
+    }
+    job_cond_.notify_one();
+}
+
+void JobQueue::WaitIdle() {
+    std::unique_lock<std::mutex> guard(lock_);
+    idle_cond_.wait(guard, [this]() { return jobs_.empty() && busy_workers_ == 0; });
+}
+
+uint32_t JobQueue::WorkerCount() const {
+    std::unique_lock<std::mutex> guard(lock_);
+    return static_cast<uint32_t>(workers_.size());
+}
+
+void JobQueue::WorkerFunc() {
+    ConfigureCurrentThread("JobQueueWorker");
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        job_cond_.wait(guard, [this]() { return exit_ || !jobs_.empty(); });
+        // The queued jobs are still run at exit
+        if (jobs_.empty()) {
+            break;
+        }
+        std::function<void()> job = std::move(jobs_.front());
+        jobs_.pop_front();
+        --idle_workers_;
+        ++busy_workers_;
+        guard.unlock();
+
+        job();
+
+        guard.lock();
+        ++idle_workers_;
+        if (--busy_workers_ == 0 && jobs_.empty()) {
+            idle_cond_.notify_all();
+        }
+    }
+}
+
+}  // namespace vvl
@@ -0,0 +1,104 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vvl {
+
+// Runs the iterations of a loop on a pool of worker threads, the calling thread included.
+//
+// The workers are started the first time they are needed, so a pool that only sees small loops costs no thread. One loop runs
+// at a time: a ParallelFor() called while another thread's loop is running runs on the calling thread alone.
+class TaskPool {
+  public:
+    // |max_threads| counts the calling thread, 0 picks DefaultPoolThreadCount()
+    explicit TaskPool(uint32_t max_threads = 0);
+    ~TaskPool();
+    TaskPool(const TaskPool &) = delete;
+    TaskPool &operator=(const TaskPool &) = delete;
+
+    // Calls func(i) for every i in [0, count) and returns once all the calls returned. The order of the calls is unspecified,
+    // results should be written to the i-th element of a pre-sized container. |func| must not call ParallelFor() itself.
+    void ParallelFor(uint32_t count, const std::function<void(uint32_t)> &func);
+
+    uint32_t WorkerCount() const;
+
+  private:
+    void WorkerFunc();
+    void RunIterations(const std::function<void(uint32_t)> &func, uint32_t count);
+
+    const uint32_t max_threads_;
+
+    // Held by the thread which loop is running
+    std::mutex loop_lock_;
+
+    mutable std::mutex lock_;
+    std::condition_variable start_cond_;
+    std::condition_variable done_cond_;
+    std::vector<std::thread> workers_;
+    // Incremented for every loop, so that a worker does not run the same loop twice
+    uint64_t loop_id_ = 0;
+    const std::function<void(uint32_t)> *func_ = nullptr;
+    uint32_t count_ = 0;
+    // Workers that are running iterations of the current loop
+    uint32_t busy_workers_ = 0;
+    bool exit_ = false;
+
+    std::atomic<uint32_t> next_index_{0};
+};
+
+// Runs jobs posted from any thread on background worker threads, started the first time they are needed.
+class JobQueue {
+  public:
+    // 0 picks DefaultPoolThreadCount()
+    explicit JobQueue(uint32_t max_threads = 0);
+    // Runs the jobs still queued before returning
+    ~JobQueue();
+    JobQueue(const JobQueue &) = delete;
+    JobQueue &operator=(const JobQueue &) = delete;
+
+    void Post(std::function<void()> &&job);
+    // Returns once every job posted before was run
+    void WaitIdle();
+
+    uint32_t WorkerCount() const;
+
+  private:
+    void WorkerFunc();
+
+    const uint32_t max_threads_;
+
+    mutable std::mutex lock_;
+    std::condition_variable job_cond_;
+    std::condition_variable idle_cond_;
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> jobs_;
+    uint32_t idle_workers_ = 0;
+    // Workers that are running a job
+    uint32_t busy_workers_ = 0;
+    bool exit_ = false;
+};
+
+}  // namespace vvl
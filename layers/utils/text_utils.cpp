@@ -29,7 +29,11 @@ std::string VFormat(const char *format, va_list argptr) {
     // Use vector as the output buffer for c-style formatting routines.
     // Do not write directly to std::string internal storage because its
     // structure and null terminator convention is not standardized.
-    std::vector<char> buffer(initial_max_symbol_count + 1 /*null terminator*/);
+    // The buffer is kept per thread so that only the returned string is allocated when many messages are formatted.
+    thread_local std::vector<char> buffer;
+    if (buffer.size() < initial_max_symbol_count + 1 /*null terminator*/) {
+        buffer.resize(initial_max_symbol_count + 1);
+    }
 
     // The va_list will be modified by the call to vsnprintf. Use a copy in case we need to try again.
     va_list argptr2;
@@ -41,12 +45,11 @@ std::string VFormat(const char *format, va_list argptr) {
         assert(false && "unexpected vsnprintf error");
         return {};
     }
-    if (symbol_count > initial_max_symbol_count) {
+    if (static_cast<size_t>(symbol_count) >= buffer.size()) {
         buffer.resize(symbol_count + 1 /*null terminator*/);
         vsnprintf(buffer.data(), buffer.size(), format, argptr);
     }
-    std::string str(buffer.data());
-    return str;
+    return std::string(buffer.data(), symbol_count);
 }
 
 std::string Format(const char *format, ...) {
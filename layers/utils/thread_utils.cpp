@@ -0,0 +1,136 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/thread_utils.h"
+
+#include <algorithm>
+#include <mutex>
+#if defined(__linux__) || defined(__ANDROID__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#elif defined(VK_USE_PLATFORM_WIN32_KHR)
+#include <windows.h>
+#endif
+
+#include "profiling/profiling.h"
+
+namespace vvl {
+
+namespace {
+
+std::mutex &GetThreadSettingsLock() {
+    static std::mutex lock;
+    return lock;
+}
+
+ThreadSettings &GetThreadSettingsStorage() {
+    static ThreadSettings settings;
+    return settings;
+}
+
+#if defined(__linux__) || defined(__ANDROID__)
+// Niceness of ThreadPriority::Low, the application threads usually run at 0
+constexpr int kLowPriorityNiceness = 10;
+#endif
+
+void SetCurrentThreadAffinity(uint64_t cpu_affinity_mask) {
+    if (cpu_affinity_mask == 0) {
+        return;
+    }
+#if defined(__linux__) || defined(__ANDROID__)
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (uint32_t cpu = 0; cpu < 64; ++cpu) {
+        if (cpu_affinity_mask & (1ull << cpu)) {
+            CPU_SET(cpu, &cpu_set);
+        }
+    }
+    sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+#elif defined(VK_USE_PLATFORM_WIN32_KHR)
+    SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(cpu_affinity_mask));
+#endif
+}
+
+void SetCurrentThreadPriority(ThreadPriority priority) {
+#if defined(__linux__) || defined(__ANDROID__)
+    switch (priority) {
+        case ThreadPriority::Default:
+            break;
+        case ThreadPriority::Low:
+            // The niceness of a Linux thread is its own, unlike POSIX where it would apply to the process
+            setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), kLowPriorityNiceness);
+            break;
+        case ThreadPriority::Idle: {
+            sched_param param{};
+            pthread_setschedparam(pthread_self(), SCHED_IDLE, &param);
+            break;
+        }
+    }
+#elif defined(VK_USE_PLATFORM_WIN32_KHR)
+    switch (priority) {
+        case ThreadPriority::Default:
+            break;
+        case ThreadPriority::Low:
+            SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+            break;
+        case ThreadPriority::Idle:
+            SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_IDLE);
+            break;
+    }
+#else
+    (void)priority;
+#endif
+}
+
+void SetCurrentThreadName(const char *name) {
+    VVL_TracySetThreadName(name);
+#if defined(__linux__) || defined(__ANDROID__)
+    // Shown by top, perf and debuggers, which only keep 15 characters
+    char short_name[16] = {};
+    strncpy(short_name, name, sizeof(short_name) - 1);
+    pthread_setname_np(pthread_self(), short_name);
+#endif
+}
+
+}  // namespace
+
+void SetThreadSettings(const ThreadSettings &settings) {
+    std::unique_lock<std::mutex> guard(GetThreadSettingsLock());
+    GetThreadSettingsStorage() = settings;
+}
+
+ThreadSettings GetThreadSettings() {
+    std::unique_lock<std::mutex> guard(GetThreadSettingsLock());
+    return GetThreadSettingsStorage();
+}
+
+uint32_t DefaultPoolThreadCount() {
+    const uint32_t pool_size = GetThreadSettings().pool_size;
+    return pool_size ? pool_size : std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+void ConfigureCurrentThread(const char *name, uint64_t cpu_affinity_mask) {
+    const ThreadSettings settings = GetThreadSettings();
+    SetCurrentThreadName(name);
+    SetCurrentThreadAffinity(cpu_affinity_mask ? cpu_affinity_mask : settings.cpu_affinity_mask);
+    SetCurrentThreadPriority(settings.priority);
+}
+
+}  // namespace vvl
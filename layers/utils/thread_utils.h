@@ -0,0 +1,60 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+namespace vvl {
+
+enum class ThreadPriority {
+    Default,  // same as the thread that started it
+    Low,
+    Idle,  // only runs when a CPU has nothing else to do
+};
+
+// How the threads started by the layer run, so they can be kept away from the application threads
+struct ThreadSettings {
+    // Bit N lets the threads run on CPU N, 0 is no affinity
+    uint64_t cpu_affinity_mask = 0;
+    ThreadPriority priority = ThreadPriority::Default;
+    // Most worker threads of a TaskPool or JobQueue created without a limit, 0 is the hardware thread count
+    uint32_t pool_size = 0;
+};
+
+// Applies to the threads started from now on
+void SetThreadSettings(const ThreadSettings &settings);
+ThreadSettings GetThreadSettings();
+
+// Thread count of the pools created without a limit
+uint32_t DefaultPoolThreadCount();
+
+// Every thread of the layer calls this first. Names the calling thread and applies the affinity and priority of the settings.
+// A non zero |cpu_affinity_mask| replaces the affinity of the settings for this thread.
+void ConfigureCurrentThread(const char *name, uint64_t cpu_affinity_mask = 0);
+
+// std::thread running ConfigureCurrentThread(name) before |func|. |name| must outlive the thread start, ex: a string literal
+template <typename Func>
+std::thread StartThread(const char *name, Func &&func) {
+    return std::thread([name, func = std::forward<Func>(func)]() mutable {
+        ConfigureCurrentThread(name);
+        func();
+    });
+}
+
+}  // namespace vvl
@@ -77,6 +77,47 @@ bool ComparePipelineColorBlendAttachmentState(const VkPipelineColorBlendAttachme
            (a.alphaBlendOp == b.alphaBlendOp) && (a.colorWriteMask == b.colorWriteMask);
 }
 
+bool ComparePipelineColorBlendStateCreateInfo(const VkPipelineColorBlendStateCreateInfo &a,
+                                              const VkPipelineColorBlendStateCreateInfo &b) {
+    if (a.pNext || b.pNext) {
+        return false;
+    }
+    if ((a.flags != b.flags) || (a.logicOpEnable != b.logicOpEnable) || (a.logicOp != b.logicOp) ||
+        (a.attachmentCount != b.attachmentCount) || ((a.pAttachments == nullptr) != (b.pAttachments == nullptr))) {
+        return false;
+    }
+    for (uint32_t i = 0; i < 4; i++) {
+        if (a.blendConstants[i] != b.blendConstants[i]) {
+            return false;
+        }
+    }
+    if (a.pAttachments) {
+        for (uint32_t i = 0; i < a.attachmentCount; i++) {
+            if (!ComparePipelineColorBlendAttachmentState(a.pAttachments[i], b.pAttachments[i])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static inline bool CompareStencilOpState(const VkStencilOpState &a, const VkStencilOpState &b) {
+    return (a.failOp == b.failOp) && (a.passOp == b.passOp) && (a.depthFailOp == b.depthFailOp) && (a.compareOp == b.compareOp) &&
+           (a.compareMask == b.compareMask) && (a.writeMask == b.writeMask) && (a.reference == b.reference);
+}
+
+bool ComparePipelineDepthStencilStateCreateInfo(const VkPipelineDepthStencilStateCreateInfo &a,
+                                                const VkPipelineDepthStencilStateCreateInfo &b) {
+    if (a.pNext || b.pNext) {
+        return false;
+    }
+    return (a.flags == b.flags) && (a.depthTestEnable == b.depthTestEnable) && (a.depthWriteEnable == b.depthWriteEnable) &&
+           (a.depthCompareOp == b.depthCompareOp) && (a.depthBoundsTestEnable == b.depthBoundsTestEnable) &&
+           (a.stencilTestEnable == b.stencilTestEnable) && CompareStencilOpState(a.front, b.front) &&
+           CompareStencilOpState(a.back, b.back) && (a.minDepthBounds == b.minDepthBounds) &&
+           (a.maxDepthBounds == b.maxDepthBounds);
+}
+
 bool ComparePipelineFragmentShadingRateStateCreateInfo(const VkPipelineFragmentShadingRateStateCreateInfoKHR &a,
                                                        const VkPipelineFragmentShadingRateStateCreateInfoKHR &b) {
     // Since this is chained in a pnext, we don't want to check the pNext/sType
@@ -33,6 +33,12 @@ bool CompareDescriptorSetLayoutBinding(const VkDescriptorSetLayoutBinding &a, co
 bool ComparePipelineColorBlendAttachmentState(const VkPipelineColorBlendAttachmentState &a,
                                               const VkPipelineColorBlendAttachmentState &b);
 
+// pNext chains are not compared, structs with one are never equal (pipeline sub-states are only shared without a chain)
+bool ComparePipelineColorBlendStateCreateInfo(const VkPipelineColorBlendStateCreateInfo &a,
+                                              const VkPipelineColorBlendStateCreateInfo &b);
+bool ComparePipelineDepthStencilStateCreateInfo(const VkPipelineDepthStencilStateCreateInfo &a,
+                                                const VkPipelineDepthStencilStateCreateInfo &b);
+
 bool ComparePipelineFragmentShadingRateStateCreateInfo(const VkPipelineFragmentShadingRateStateCreateInfoKHR &a,
                                                        const VkPipelineFragmentShadingRateStateCreateInfoKHR &b);
 
@@ -27,6 +27,18 @@
 
 enum CMD_SCOPE_TYPE { CMD_SCOPE_INSIDE, CMD_SCOPE_OUTSIDE, CMD_SCOPE_BOTH };
 
+// The parts of the command buffer state the implicit VUs of vkCmd* commands depend on
+enum CommandBufferStateBits : uint32_t {
+    kCbRecording = 1 << 0,
+    kCbActiveRenderPass = 1 << 1,
+    // Inside a render pass, or a secondary command buffer continuing one
+    kCbRenderPassScope = 1 << 2,
+    kCbVideoCoding = 1 << 3,
+    kCbSecondary = 1 << 4,
+    // Primary command buffer in a subpass whose contents are VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+    kCbSecondaryContentsSubpass = 1 << 5,
+};
+
 struct CommandValidationInfo {
     const char* recording_vuid;
     const char* buffer_level_vuid;
@@ -39,6 +51,11 @@ struct CommandValidationInfo {
 
     CMD_SCOPE_TYPE video_coding;
     const char* video_coding_vuid;
+
+    // CommandBufferStateBits that must be set and must not be set when recording the command, all the above but the queue
+    // flags summed up, so the common case where every VU is met is a single compare
+    uint32_t required_state;
+    uint32_t forbidden_state;
 };
 
 using Func = vvl::Func;
@@ -51,6 +68,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_DATA_GRAPH_BIT_ARM, "VUID-vkCmdBindPipeline-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindPipeline-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetViewport, {
     "VUID-vkCmdSetViewport-commandBuffer-recording",
@@ -58,6 +76,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetViewport-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetViewport-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetScissor, {
     "VUID-vkCmdSetScissor-commandBuffer-recording",
@@ -65,6 +84,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetScissor-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetScissor-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetLineWidth, {
     "VUID-vkCmdSetLineWidth-commandBuffer-recording",
@@ -72,6 +92,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetLineWidth-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetLineWidth-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthBias, {
     "VUID-vkCmdSetDepthBias-commandBuffer-recording",
@@ -79,6 +100,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthBias-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthBias-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetBlendConstants, {
     "VUID-vkCmdSetBlendConstants-commandBuffer-recording",
@@ -86,6 +108,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetBlendConstants-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetBlendConstants-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthBounds, {
     "VUID-vkCmdSetDepthBounds-commandBuffer-recording",
@@ -93,6 +116,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthBounds-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthBounds-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetStencilCompareMask, {
     "VUID-vkCmdSetStencilCompareMask-commandBuffer-recording",
@@ -100,6 +124,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetStencilCompareMask-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetStencilCompareMask-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetStencilWriteMask, {
     "VUID-vkCmdSetStencilWriteMask-commandBuffer-recording",
@@ -107,6 +132,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetStencilWriteMask-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetStencilWriteMask-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetStencilReference, {
     "VUID-vkCmdSetStencilReference-commandBuffer-recording",
@@ -114,6 +140,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetStencilReference-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetStencilReference-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindDescriptorSets, {
     "VUID-vkCmdBindDescriptorSets-commandBuffer-recording",
@@ -121,6 +148,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_DATA_GRAPH_BIT_ARM, "VUID-vkCmdBindDescriptorSets-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindDescriptorSets-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindIndexBuffer, {
     "VUID-vkCmdBindIndexBuffer-commandBuffer-recording",
@@ -128,6 +156,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBindIndexBuffer-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindIndexBuffer-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindVertexBuffers, {
     "VUID-vkCmdBindVertexBuffers-commandBuffer-recording",
@@ -135,6 +164,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBindVertexBuffers-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindVertexBuffers-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDraw, {
     "VUID-vkCmdDraw-commandBuffer-recording",
@@ -142,6 +172,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDraw-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDraw-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDraw-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawIndexed, {
     "VUID-vkCmdDrawIndexed-commandBuffer-recording",
@@ -149,6 +180,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawIndexed-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawIndexed-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawIndexed-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawIndirect, {
     "VUID-vkCmdDrawIndirect-commandBuffer-recording",
@@ -156,6 +188,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawIndirect-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawIndirect-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawIndirect-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawIndexedIndirect, {
     "VUID-vkCmdDrawIndexedIndirect-commandBuffer-recording",
@@ -163,6 +196,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawIndexedIndirect-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawIndexedIndirect-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawIndexedIndirect-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDispatch, {
     "VUID-vkCmdDispatch-commandBuffer-recording",
@@ -170,6 +204,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdDispatch-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDispatch-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDispatchIndirect, {
     "VUID-vkCmdDispatchIndirect-commandBuffer-recording",
@@ -177,6 +212,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdDispatchIndirect-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDispatchIndirect-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyBuffer, {
     "VUID-vkCmdCopyBuffer-commandBuffer-recording",
@@ -184,6 +220,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdCopyBuffer-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyBuffer-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyBuffer-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyImage, {
     "VUID-vkCmdCopyImage-commandBuffer-recording",
@@ -191,6 +228,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdCopyImage-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyImage-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyImage-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBlitImage, {
     "VUID-vkCmdBlitImage-commandBuffer-recording",
@@ -198,6 +236,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBlitImage-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBlitImage-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBlitImage-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyBufferToImage, {
     "VUID-vkCmdCopyBufferToImage-commandBuffer-recording",
@@ -205,6 +244,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdCopyBufferToImage-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyBufferToImage-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyBufferToImage-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyImageToBuffer, {
     "VUID-vkCmdCopyImageToBuffer-commandBuffer-recording",
@@ -212,6 +252,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdCopyImageToBuffer-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyImageToBuffer-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyImageToBuffer-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdUpdateBuffer, {
     "VUID-vkCmdUpdateBuffer-commandBuffer-recording",
@@ -219,6 +260,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdUpdateBuffer-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdUpdateBuffer-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdUpdateBuffer-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdFillBuffer, {
     "VUID-vkCmdFillBuffer-commandBuffer-recording",
@@ -226,6 +268,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdFillBuffer-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdFillBuffer-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdFillBuffer-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdClearColorImage, {
     "VUID-vkCmdClearColorImage-commandBuffer-recording",
@@ -233,6 +276,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdClearColorImage-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdClearColorImage-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdClearColorImage-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdClearDepthStencilImage, {
     "VUID-vkCmdClearDepthStencilImage-commandBuffer-recording",
@@ -240,6 +284,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdClearDepthStencilImage-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdClearDepthStencilImage-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdClearDepthStencilImage-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdClearAttachments, {
     "VUID-vkCmdClearAttachments-commandBuffer-recording",
@@ -247,6 +292,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdClearAttachments-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdClearAttachments-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdClearAttachments-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdResolveImage, {
     "VUID-vkCmdResolveImage-commandBuffer-recording",
@@ -254,6 +300,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdResolveImage-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdResolveImage-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdResolveImage-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetEvent, {
     "VUID-vkCmdSetEvent-commandBuffer-recording",
@@ -261,6 +308,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdSetEvent-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetEvent-renderpass",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbActiveRenderPass | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdResetEvent, {
     "VUID-vkCmdResetEvent-commandBuffer-recording",
@@ -268,6 +316,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdResetEvent-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdResetEvent-renderpass",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbActiveRenderPass | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdWaitEvents, {
     "VUID-vkCmdWaitEvents-commandBuffer-recording",
@@ -275,6 +324,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdWaitEvents-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdPipelineBarrier, {
     "VUID-vkCmdPipelineBarrier-commandBuffer-recording",
@@ -282,6 +332,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdPipelineBarrier-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBeginQuery, {
     "VUID-vkCmdBeginQuery-commandBuffer-recording",
@@ -289,6 +340,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdBeginQuery-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdEndQuery, {
     "VUID-vkCmdEndQuery-commandBuffer-recording",
@@ -296,6 +348,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdEndQuery-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdResetQueryPool, {
     "VUID-vkCmdResetQueryPool-commandBuffer-recording",
@@ -303,6 +356,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR | VK_QUEUE_OPTICAL_FLOW_BIT_NV, "VUID-vkCmdResetQueryPool-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdResetQueryPool-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdResetQueryPool-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdWriteTimestamp, {
     "VUID-vkCmdWriteTimestamp-commandBuffer-recording",
@@ -310,6 +364,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR | VK_QUEUE_OPTICAL_FLOW_BIT_NV, "VUID-vkCmdWriteTimestamp-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyQueryPoolResults, {
     "VUID-vkCmdCopyQueryPoolResults-commandBuffer-recording",
@@ -317,6 +372,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdCopyQueryPoolResults-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyQueryPoolResults-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyQueryPoolResults-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdPushConstants, {
     "VUID-vkCmdPushConstants-commandBuffer-recording",
@@ -324,6 +380,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdPushConstants-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdPushConstants-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBeginRenderPass, {
     "VUID-vkCmdBeginRenderPass-commandBuffer-recording",
@@ -331,6 +388,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBeginRenderPass-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBeginRenderPass-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBeginRenderPass-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondary | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdNextSubpass, {
     "VUID-vkCmdNextSubpass-commandBuffer-recording",
@@ -338,6 +396,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdNextSubpass-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdNextSubpass-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdNextSubpass-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondary,
 }},
 {Func::vkCmdEndRenderPass, {
     "VUID-vkCmdEndRenderPass-commandBuffer-recording",
@@ -345,6 +404,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdEndRenderPass-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdEndRenderPass-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdEndRenderPass-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondary,
 }},
 {Func::vkCmdExecuteCommands, {
     "VUID-vkCmdExecuteCommands-commandBuffer-recording",
@@ -352,6 +412,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdExecuteCommands-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdExecuteCommands-videocoding",
+    kCbRecording, kCbVideoCoding,
 }},
 {Func::vkCmdSetDeviceMask, {
     "VUID-vkCmdSetDeviceMask-commandBuffer-recording",
@@ -359,6 +420,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdSetDeviceMask-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDispatchBase, {
     "VUID-vkCmdDispatchBase-commandBuffer-recording",
@@ -366,6 +428,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdDispatchBase-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDispatchBase-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawIndirectCount, {
     "VUID-vkCmdDrawIndirectCount-commandBuffer-recording",
@@ -373,6 +436,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawIndirectCount-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawIndirectCount-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawIndirectCount-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawIndexedIndirectCount, {
     "VUID-vkCmdDrawIndexedIndirectCount-commandBuffer-recording",
@@ -380,6 +444,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawIndexedIndirectCount-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawIndexedIndirectCount-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawIndexedIndirectCount-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBeginRenderPass2, {
     "VUID-vkCmdBeginRenderPass2-commandBuffer-recording",
@@ -387,6 +452,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBeginRenderPass2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBeginRenderPass2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBeginRenderPass2-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondary | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdNextSubpass2, {
     "VUID-vkCmdNextSubpass2-commandBuffer-recording",
@@ -394,6 +460,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdNextSubpass2-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdNextSubpass2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdNextSubpass2-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondary,
 }},
 {Func::vkCmdEndRenderPass2, {
     "VUID-vkCmdEndRenderPass2-commandBuffer-recording",
@@ -401,6 +468,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdEndRenderPass2-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdEndRenderPass2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdEndRenderPass2-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondary,
 }},
 {Func::vkCmdSetEvent2, {
     "VUID-vkCmdSetEvent2-commandBuffer-recording",
@@ -408,6 +476,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdSetEvent2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetEvent2-renderpass",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbActiveRenderPass | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdResetEvent2, {
     "VUID-vkCmdResetEvent2-commandBuffer-recording",
@@ -415,6 +484,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdResetEvent2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdResetEvent2-renderpass",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbActiveRenderPass | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdWaitEvents2, {
     "VUID-vkCmdWaitEvents2-commandBuffer-recording",
@@ -422,6 +492,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdWaitEvents2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdPipelineBarrier2, {
     "VUID-vkCmdPipelineBarrier2-commandBuffer-recording",
@@ -429,6 +500,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdPipelineBarrier2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdWriteTimestamp2, {
     "VUID-vkCmdWriteTimestamp2-commandBuffer-recording",
@@ -436,6 +508,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdWriteTimestamp2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyBuffer2, {
     "VUID-vkCmdCopyBuffer2-commandBuffer-recording",
@@ -443,6 +516,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdCopyBuffer2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyBuffer2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyBuffer2-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyImage2, {
     "VUID-vkCmdCopyImage2-commandBuffer-recording",
@@ -450,6 +524,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdCopyImage2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyImage2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyImage2-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyBufferToImage2, {
     "VUID-vkCmdCopyBufferToImage2-commandBuffer-recording",
@@ -457,6 +532,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdCopyBufferToImage2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyBufferToImage2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyBufferToImage2-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyImageToBuffer2, {
     "VUID-vkCmdCopyImageToBuffer2-commandBuffer-recording",
@@ -464,6 +540,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdCopyImageToBuffer2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyImageToBuffer2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyImageToBuffer2-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBlitImage2, {
     "VUID-vkCmdBlitImage2-commandBuffer-recording",
@@ -471,6 +548,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBlitImage2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBlitImage2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBlitImage2-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdResolveImage2, {
     "VUID-vkCmdResolveImage2-commandBuffer-recording",
@@ -478,6 +556,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdResolveImage2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdResolveImage2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdResolveImage2-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBeginRendering, {
     "VUID-vkCmdBeginRendering-commandBuffer-recording",
@@ -485,6 +564,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBeginRendering-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBeginRendering-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBeginRendering-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdEndRendering, {
     "VUID-vkCmdEndRendering-commandBuffer-recording",
@@ -492,6 +572,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdEndRendering-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdEndRendering-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdEndRendering-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetCullMode, {
     "VUID-vkCmdSetCullMode-commandBuffer-recording",
@@ -499,6 +580,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetCullMode-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetCullMode-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetFrontFace, {
     "VUID-vkCmdSetFrontFace-commandBuffer-recording",
@@ -506,6 +588,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetFrontFace-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetFrontFace-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetPrimitiveTopology, {
     "VUID-vkCmdSetPrimitiveTopology-commandBuffer-recording",
@@ -513,6 +596,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetPrimitiveTopology-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetPrimitiveTopology-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetViewportWithCount, {
     "VUID-vkCmdSetViewportWithCount-commandBuffer-recording",
@@ -520,6 +604,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetViewportWithCount-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetViewportWithCount-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetScissorWithCount, {
     "VUID-vkCmdSetScissorWithCount-commandBuffer-recording",
@@ -527,6 +612,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetScissorWithCount-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetScissorWithCount-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindVertexBuffers2, {
     "VUID-vkCmdBindVertexBuffers2-commandBuffer-recording",
@@ -534,6 +620,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBindVertexBuffers2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindVertexBuffers2-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthTestEnable, {
     "VUID-vkCmdSetDepthTestEnable-commandBuffer-recording",
@@ -541,6 +628,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthTestEnable-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthTestEnable-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthWriteEnable, {
     "VUID-vkCmdSetDepthWriteEnable-commandBuffer-recording",
@@ -548,6 +636,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthWriteEnable-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthWriteEnable-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthCompareOp, {
     "VUID-vkCmdSetDepthCompareOp-commandBuffer-recording",
@@ -555,6 +644,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthCompareOp-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthCompareOp-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthBoundsTestEnable, {
     "VUID-vkCmdSetDepthBoundsTestEnable-commandBuffer-recording",
@@ -562,6 +652,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthBoundsTestEnable-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthBoundsTestEnable-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetStencilTestEnable, {
     "VUID-vkCmdSetStencilTestEnable-commandBuffer-recording",
@@ -569,6 +660,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetStencilTestEnable-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetStencilTestEnable-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetStencilOp, {
     "VUID-vkCmdSetStencilOp-commandBuffer-recording",
@@ -576,6 +668,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetStencilOp-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetStencilOp-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetRasterizerDiscardEnable, {
     "VUID-vkCmdSetRasterizerDiscardEnable-commandBuffer-recording",
@@ -583,6 +676,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetRasterizerDiscardEnable-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetRasterizerDiscardEnable-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthBiasEnable, {
     "VUID-vkCmdSetDepthBiasEnable-commandBuffer-recording",
@@ -590,6 +684,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthBiasEnable-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthBiasEnable-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetPrimitiveRestartEnable, {
     "VUID-vkCmdSetPrimitiveRestartEnable-commandBuffer-recording",
@@ -597,6 +692,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetPrimitiveRestartEnable-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetPrimitiveRestartEnable-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetLineStipple, {
     "VUID-vkCmdSetLineStipple-commandBuffer-recording",
@@ -604,6 +700,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetLineStipple-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetLineStipple-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindIndexBuffer2, {
     "VUID-vkCmdBindIndexBuffer2-commandBuffer-recording",
@@ -611,6 +708,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBindIndexBuffer2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindIndexBuffer2-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdPushDescriptorSet, {
     "VUID-vkCmdPushDescriptorSet-commandBuffer-recording",
@@ -618,6 +716,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdPushDescriptorSet-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdPushDescriptorSet-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdPushDescriptorSetWithTemplate, {
     "VUID-vkCmdPushDescriptorSetWithTemplate-commandBuffer-recording",
@@ -625,6 +724,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdPushDescriptorSetWithTemplate-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdPushDescriptorSetWithTemplate-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetRenderingAttachmentLocations, {
     "VUID-vkCmdSetRenderingAttachmentLocations-commandBuffer-recording",
@@ -632,6 +732,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetRenderingAttachmentLocations-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdSetRenderingAttachmentLocations-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetRenderingAttachmentLocations-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetRenderingInputAttachmentIndices, {
     "VUID-vkCmdSetRenderingInputAttachmentIndices-commandBuffer-recording",
@@ -639,6 +740,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetRenderingInputAttachmentIndices-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdSetRenderingInputAttachmentIndices-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetRenderingInputAttachmentIndices-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindDescriptorSets2, {
     "VUID-vkCmdBindDescriptorSets2-commandBuffer-recording",
@@ -646,6 +748,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdBindDescriptorSets2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindDescriptorSets2-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdPushConstants2, {
     "VUID-vkCmdPushConstants2-commandBuffer-recording",
@@ -653,6 +756,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdPushConstants2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdPushConstants2-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdPushDescriptorSet2, {
     "VUID-vkCmdPushDescriptorSet2-commandBuffer-recording",
@@ -660,6 +764,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdPushDescriptorSet2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdPushDescriptorSet2-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdPushDescriptorSetWithTemplate2, {
     "VUID-vkCmdPushDescriptorSetWithTemplate2-commandBuffer-recording",
@@ -667,6 +772,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdPushDescriptorSetWithTemplate2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdPushDescriptorSetWithTemplate2-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBeginVideoCodingKHR, {
     "VUID-vkCmdBeginVideoCodingKHR-commandBuffer-recording",
@@ -674,6 +780,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdBeginVideoCodingKHR-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBeginVideoCodingKHR-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBeginVideoCodingKHR-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondary | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdEndVideoCodingKHR, {
     "VUID-vkCmdEndVideoCodingKHR-commandBuffer-recording",
@@ -681,6 +788,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdEndVideoCodingKHR-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdEndVideoCodingKHR-renderpass",
     CMD_SCOPE_INSIDE, "VUID-vkCmdEndVideoCodingKHR-videocoding",
+    kCbRecording | kCbVideoCoding, kCbActiveRenderPass | kCbSecondary | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdControlVideoCodingKHR, {
     "VUID-vkCmdControlVideoCodingKHR-commandBuffer-recording",
@@ -688,6 +796,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdControlVideoCodingKHR-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdControlVideoCodingKHR-renderpass",
     CMD_SCOPE_INSIDE, "VUID-vkCmdControlVideoCodingKHR-videocoding",
+    kCbRecording | kCbVideoCoding, kCbActiveRenderPass | kCbSecondary | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDecodeVideoKHR, {
     "VUID-vkCmdDecodeVideoKHR-commandBuffer-recording",
@@ -695,6 +804,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_VIDEO_DECODE_BIT_KHR, "VUID-vkCmdDecodeVideoKHR-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDecodeVideoKHR-renderpass",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDecodeVideoKHR-videocoding",
+    kCbRecording | kCbVideoCoding, kCbActiveRenderPass | kCbSecondary | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBeginRenderingKHR, {
     "VUID-vkCmdBeginRendering-commandBuffer-recording",
@@ -702,6 +812,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBeginRendering-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBeginRendering-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBeginRendering-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdEndRenderingKHR, {
     "VUID-vkCmdEndRendering-commandBuffer-recording",
@@ -709,6 +820,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdEndRendering-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdEndRendering-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdEndRendering-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDeviceMaskKHR, {
     "VUID-vkCmdSetDeviceMask-commandBuffer-recording",
@@ -716,6 +828,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdSetDeviceMask-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDispatchBaseKHR, {
     "VUID-vkCmdDispatchBase-commandBuffer-recording",
@@ -723,6 +836,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdDispatchBase-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDispatchBase-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdPushDescriptorSetKHR, {
     "VUID-vkCmdPushDescriptorSet-commandBuffer-recording",
@@ -730,6 +844,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdPushDescriptorSet-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdPushDescriptorSet-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdPushDescriptorSetWithTemplateKHR, {
     "VUID-vkCmdPushDescriptorSetWithTemplate-commandBuffer-recording",
@@ -737,6 +852,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdPushDescriptorSetWithTemplate-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdPushDescriptorSetWithTemplate-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBeginRenderPass2KHR, {
     "VUID-vkCmdBeginRenderPass2-commandBuffer-recording",
@@ -744,6 +860,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBeginRenderPass2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBeginRenderPass2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBeginRenderPass2-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondary | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdNextSubpass2KHR, {
     "VUID-vkCmdNextSubpass2-commandBuffer-recording",
@@ -751,6 +868,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdNextSubpass2-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdNextSubpass2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdNextSubpass2-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondary,
 }},
 {Func::vkCmdEndRenderPass2KHR, {
     "VUID-vkCmdEndRenderPass2-commandBuffer-recording",
@@ -758,6 +876,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdEndRenderPass2-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdEndRenderPass2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdEndRenderPass2-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondary,
 }},
 {Func::vkCmdDrawIndirectCountKHR, {
     "VUID-vkCmdDrawIndirectCount-commandBuffer-recording",
@@ -765,6 +884,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawIndirectCount-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawIndirectCount-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawIndirectCount-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawIndexedIndirectCountKHR, {
     "VUID-vkCmdDrawIndexedIndirectCount-commandBuffer-recording",
@@ -772,6 +892,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawIndexedIndirectCount-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawIndexedIndirectCount-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawIndexedIndirectCount-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetFragmentShadingRateKHR, {
     "VUID-vkCmdSetFragmentShadingRateKHR-commandBuffer-recording",
@@ -779,6 +900,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetFragmentShadingRateKHR-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetFragmentShadingRateKHR-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetRenderingAttachmentLocationsKHR, {
     "VUID-vkCmdSetRenderingAttachmentLocations-commandBuffer-recording",
@@ -786,6 +908,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetRenderingAttachmentLocations-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdSetRenderingAttachmentLocations-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetRenderingAttachmentLocations-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetRenderingInputAttachmentIndicesKHR, {
     "VUID-vkCmdSetRenderingInputAttachmentIndices-commandBuffer-recording",
@@ -793,6 +916,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetRenderingInputAttachmentIndices-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdSetRenderingInputAttachmentIndices-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetRenderingInputAttachmentIndices-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdEncodeVideoKHR, {
     "VUID-vkCmdEncodeVideoKHR-commandBuffer-recording",
@@ -800,6 +924,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdEncodeVideoKHR-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdEncodeVideoKHR-renderpass",
     CMD_SCOPE_INSIDE, "VUID-vkCmdEncodeVideoKHR-videocoding",
+    kCbRecording | kCbVideoCoding, kCbActiveRenderPass | kCbSecondary | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetEvent2KHR, {
     "VUID-vkCmdSetEvent2-commandBuffer-recording",
@@ -807,6 +932,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdSetEvent2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetEvent2-renderpass",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbActiveRenderPass | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdResetEvent2KHR, {
     "VUID-vkCmdResetEvent2-commandBuffer-recording",
@@ -814,6 +940,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdResetEvent2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdResetEvent2-renderpass",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbActiveRenderPass | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdWaitEvents2KHR, {
     "VUID-vkCmdWaitEvents2-commandBuffer-recording",
@@ -821,6 +948,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdWaitEvents2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdPipelineBarrier2KHR, {
     "VUID-vkCmdPipelineBarrier2-commandBuffer-recording",
@@ -828,6 +956,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdPipelineBarrier2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdWriteTimestamp2KHR, {
     "VUID-vkCmdWriteTimestamp2-commandBuffer-recording",
@@ -835,6 +964,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdWriteTimestamp2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyBuffer2KHR, {
     "VUID-vkCmdCopyBuffer2-commandBuffer-recording",
@@ -842,6 +972,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdCopyBuffer2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyBuffer2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyBuffer2-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyImage2KHR, {
     "VUID-vkCmdCopyImage2-commandBuffer-recording",
@@ -849,6 +980,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdCopyImage2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyImage2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyImage2-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyBufferToImage2KHR, {
     "VUID-vkCmdCopyBufferToImage2-commandBuffer-recording",
@@ -856,6 +988,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdCopyBufferToImage2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyBufferToImage2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyBufferToImage2-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyImageToBuffer2KHR, {
     "VUID-vkCmdCopyImageToBuffer2-commandBuffer-recording",
@@ -863,6 +996,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdCopyImageToBuffer2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyImageToBuffer2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyImageToBuffer2-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBlitImage2KHR, {
     "VUID-vkCmdBlitImage2-commandBuffer-recording",
@@ -870,6 +1004,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBlitImage2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBlitImage2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBlitImage2-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdResolveImage2KHR, {
     "VUID-vkCmdResolveImage2-commandBuffer-recording",
@@ -877,6 +1012,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdResolveImage2-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdResolveImage2-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdResolveImage2-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdTraceRaysIndirect2KHR, {
     "VUID-vkCmdTraceRaysIndirect2KHR-commandBuffer-recording",
@@ -884,6 +1020,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdTraceRaysIndirect2KHR-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdTraceRaysIndirect2KHR-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdTraceRaysIndirect2KHR-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindIndexBuffer2KHR, {
     "VUID-vkCmdBindIndexBuffer2-commandBuffer-recording",
@@ -891,6 +1028,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBindIndexBuffer2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindIndexBuffer2-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetLineStippleKHR, {
     "VUID-vkCmdSetLineStipple-commandBuffer-recording",
@@ -898,6 +1036,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetLineStipple-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetLineStipple-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindDescriptorSets2KHR, {
     "VUID-vkCmdBindDescriptorSets2-commandBuffer-recording",
@@ -905,6 +1044,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdBindDescriptorSets2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindDescriptorSets2-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdPushConstants2KHR, {
     "VUID-vkCmdPushConstants2-commandBuffer-recording",
@@ -912,6 +1052,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdPushConstants2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdPushConstants2-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdPushDescriptorSet2KHR, {
     "VUID-vkCmdPushDescriptorSet2-commandBuffer-recording",
@@ -919,6 +1060,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdPushDescriptorSet2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdPushDescriptorSet2-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdPushDescriptorSetWithTemplate2KHR, {
     "VUID-vkCmdPushDescriptorSetWithTemplate2-commandBuffer-recording",
@@ -926,6 +1068,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdPushDescriptorSetWithTemplate2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdPushDescriptorSetWithTemplate2-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDescriptorBufferOffsets2EXT, {
     "VUID-vkCmdSetDescriptorBufferOffsets2EXT-commandBuffer-recording",
@@ -933,6 +1076,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_DATA_GRAPH_BIT_ARM, "VUID-vkCmdSetDescriptorBufferOffsets2EXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDescriptorBufferOffsets2EXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindDescriptorBufferEmbeddedSamplers2EXT, {
     "VUID-vkCmdBindDescriptorBufferEmbeddedSamplers2EXT-commandBuffer-recording",
@@ -940,6 +1084,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdBindDescriptorBufferEmbeddedSamplers2EXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindDescriptorBufferEmbeddedSamplers2EXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDebugMarkerBeginEXT, {
     "VUID-vkCmdDebugMarkerBeginEXT-commandBuffer-recording",
@@ -947,6 +1092,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR | VK_QUEUE_OPTICAL_FLOW_BIT_NV, "VUID-vkCmdDebugMarkerBeginEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDebugMarkerEndEXT, {
     "VUID-vkCmdDebugMarkerEndEXT-commandBuffer-recording",
@@ -954,6 +1100,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR | VK_QUEUE_OPTICAL_FLOW_BIT_NV, "VUID-vkCmdDebugMarkerEndEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDebugMarkerInsertEXT, {
     "VUID-vkCmdDebugMarkerInsertEXT-commandBuffer-recording",
@@ -961,6 +1108,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR | VK_QUEUE_OPTICAL_FLOW_BIT_NV, "VUID-vkCmdDebugMarkerInsertEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindTransformFeedbackBuffersEXT, {
     "VUID-vkCmdBindTransformFeedbackBuffersEXT-commandBuffer-recording",
@@ -968,6 +1116,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBindTransformFeedbackBuffersEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindTransformFeedbackBuffersEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBeginTransformFeedbackEXT, {
     "VUID-vkCmdBeginTransformFeedbackEXT-commandBuffer-recording",
@@ -975,6 +1124,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBeginTransformFeedbackEXT-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdBeginTransformFeedbackEXT-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBeginTransformFeedbackEXT-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdEndTransformFeedbackEXT, {
     "VUID-vkCmdEndTransformFeedbackEXT-commandBuffer-recording",
@@ -982,6 +1132,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdEndTransformFeedbackEXT-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdEndTransformFeedbackEXT-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdEndTransformFeedbackEXT-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBeginQueryIndexedEXT, {
     "VUID-vkCmdBeginQueryIndexedEXT-commandBuffer-recording",
@@ -989,6 +1140,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdBeginQueryIndexedEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBeginQueryIndexedEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdEndQueryIndexedEXT, {
     "VUID-vkCmdEndQueryIndexedEXT-commandBuffer-recording",
@@ -996,6 +1148,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR, "VUID-vkCmdEndQueryIndexedEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdEndQueryIndexedEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawIndirectByteCountEXT, {
     "VUID-vkCmdDrawIndirectByteCountEXT-commandBuffer-recording",
@@ -1003,6 +1156,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawIndirectByteCountEXT-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawIndirectByteCountEXT-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawIndirectByteCountEXT-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCuLaunchKernelNVX, {
     "VUID-vkCmdCuLaunchKernelNVX-commandBuffer-recording",
@@ -1010,6 +1164,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdCuLaunchKernelNVX-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCuLaunchKernelNVX-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawIndirectCountAMD, {
     "VUID-vkCmdDrawIndirectCount-commandBuffer-recording",
@@ -1017,6 +1172,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawIndirectCount-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawIndirectCount-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawIndirectCount-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawIndexedIndirectCountAMD, {
     "VUID-vkCmdDrawIndexedIndirectCount-commandBuffer-recording",
@@ -1024,6 +1180,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawIndexedIndirectCount-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawIndexedIndirectCount-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawIndexedIndirectCount-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBeginConditionalRenderingEXT, {
     "VUID-vkCmdBeginConditionalRenderingEXT-commandBuffer-recording",
@@ -1031,6 +1188,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdBeginConditionalRenderingEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBeginConditionalRenderingEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdEndConditionalRenderingEXT, {
     "VUID-vkCmdEndConditionalRenderingEXT-commandBuffer-recording",
@@ -1038,6 +1196,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdEndConditionalRenderingEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdEndConditionalRenderingEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetViewportWScalingNV, {
     "VUID-vkCmdSetViewportWScalingNV-commandBuffer-recording",
@@ -1045,6 +1204,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetViewportWScalingNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetViewportWScalingNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDiscardRectangleEXT, {
     "VUID-vkCmdSetDiscardRectangleEXT-commandBuffer-recording",
@@ -1052,6 +1212,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDiscardRectangleEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDiscardRectangleEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDiscardRectangleEnableEXT, {
     "VUID-vkCmdSetDiscardRectangleEnableEXT-commandBuffer-recording",
@@ -1059,6 +1220,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDiscardRectangleEnableEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDiscardRectangleEnableEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDiscardRectangleModeEXT, {
     "VUID-vkCmdSetDiscardRectangleModeEXT-commandBuffer-recording",
@@ -1066,6 +1228,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDiscardRectangleModeEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDiscardRectangleModeEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBeginDebugUtilsLabelEXT, {
     "VUID-vkCmdBeginDebugUtilsLabelEXT-commandBuffer-recording",
@@ -1073,6 +1236,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR | VK_QUEUE_OPTICAL_FLOW_BIT_NV, "VUID-vkCmdBeginDebugUtilsLabelEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdEndDebugUtilsLabelEXT, {
     "VUID-vkCmdEndDebugUtilsLabelEXT-commandBuffer-recording",
@@ -1080,6 +1244,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR | VK_QUEUE_OPTICAL_FLOW_BIT_NV, "VUID-vkCmdEndDebugUtilsLabelEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdInsertDebugUtilsLabelEXT, {
     "VUID-vkCmdInsertDebugUtilsLabelEXT-commandBuffer-recording",
@@ -1087,6 +1252,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR | VK_QUEUE_OPTICAL_FLOW_BIT_NV, "VUID-vkCmdInsertDebugUtilsLabelEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
+    kCbRecording, kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdInitializeGraphScratchMemoryAMDX, {
     "VUID-vkCmdInitializeGraphScratchMemoryAMDX-commandBuffer-recording",
@@ -1094,6 +1260,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdInitializeGraphScratchMemoryAMDX-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdInitializeGraphScratchMemoryAMDX-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondary | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDispatchGraphAMDX, {
     "VUID-vkCmdDispatchGraphAMDX-commandBuffer-recording",
@@ -1101,6 +1268,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdDispatchGraphAMDX-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDispatchGraphAMDX-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondary | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDispatchGraphIndirectAMDX, {
     "VUID-vkCmdDispatchGraphIndirectAMDX-commandBuffer-recording",
@@ -1108,6 +1276,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdDispatchGraphIndirectAMDX-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDispatchGraphIndirectAMDX-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondary | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDispatchGraphIndirectCountAMDX, {
     "VUID-vkCmdDispatchGraphIndirectCountAMDX-commandBuffer-recording",
@@ -1115,6 +1284,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdDispatchGraphIndirectCountAMDX-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDispatchGraphIndirectCountAMDX-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondary | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetSampleLocationsEXT, {
     "VUID-vkCmdSetSampleLocationsEXT-commandBuffer-recording",
@@ -1122,6 +1292,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetSampleLocationsEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetSampleLocationsEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindShadingRateImageNV, {
     "VUID-vkCmdBindShadingRateImageNV-commandBuffer-recording",
@@ -1129,6 +1300,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBindShadingRateImageNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindShadingRateImageNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetViewportShadingRatePaletteNV, {
     "VUID-vkCmdSetViewportShadingRatePaletteNV-commandBuffer-recording",
@@ -1136,6 +1308,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetViewportShadingRatePaletteNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetViewportShadingRatePaletteNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetCoarseSampleOrderNV, {
     "VUID-vkCmdSetCoarseSampleOrderNV-commandBuffer-recording",
@@ -1143,6 +1316,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetCoarseSampleOrderNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetCoarseSampleOrderNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBuildAccelerationStructureNV, {
     "VUID-vkCmdBuildAccelerationStructureNV-commandBuffer-recording",
@@ -1150,6 +1324,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdBuildAccelerationStructureNV-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBuildAccelerationStructureNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBuildAccelerationStructureNV-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyAccelerationStructureNV, {
     "VUID-vkCmdCopyAccelerationStructureNV-commandBuffer-recording",
@@ -1157,6 +1332,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdCopyAccelerationStructureNV-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyAccelerationStructureNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyAccelerationStructureNV-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdTraceRaysNV, {
     "VUID-vkCmdTraceRaysNV-commandBuffer-recording",
@@ -1164,6 +1340,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdTraceRaysNV-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdTraceRaysNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdTraceRaysNV-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdWriteAccelerationStructuresPropertiesNV, {
     "VUID-vkCmdWriteAccelerationStructuresPropertiesNV-commandBuffer-recording",
@@ -1171,6 +1348,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdWriteAccelerationStructuresPropertiesNV-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdWriteAccelerationStructuresPropertiesNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdWriteAccelerationStructuresPropertiesNV-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdWriteBufferMarkerAMD, {
     "VUID-vkCmdWriteBufferMarkerAMD-commandBuffer-recording",
@@ -1178,6 +1356,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdWriteBufferMarkerAMD-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdWriteBufferMarkerAMD-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdWriteBufferMarker2AMD, {
     "VUID-vkCmdWriteBufferMarker2AMD-commandBuffer-recording",
@@ -1185,6 +1364,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdWriteBufferMarker2AMD-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdWriteBufferMarker2AMD-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawMeshTasksNV, {
     "VUID-vkCmdDrawMeshTasksNV-commandBuffer-recording",
@@ -1192,6 +1372,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawMeshTasksNV-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawMeshTasksNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawMeshTasksNV-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawMeshTasksIndirectNV, {
     "VUID-vkCmdDrawMeshTasksIndirectNV-commandBuffer-recording",
@@ -1199,6 +1380,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawMeshTasksIndirectNV-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawMeshTasksIndirectNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawMeshTasksIndirectNV-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawMeshTasksIndirectCountNV, {
     "VUID-vkCmdDrawMeshTasksIndirectCountNV-commandBuffer-recording",
@@ -1206,6 +1388,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawMeshTasksIndirectCountNV-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawMeshTasksIndirectCountNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawMeshTasksIndirectCountNV-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetExclusiveScissorEnableNV, {
     "VUID-vkCmdSetExclusiveScissorEnableNV-commandBuffer-recording",
@@ -1213,6 +1396,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetExclusiveScissorEnableNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetExclusiveScissorEnableNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetExclusiveScissorNV, {
     "VUID-vkCmdSetExclusiveScissorNV-commandBuffer-recording",
@@ -1220,6 +1404,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetExclusiveScissorNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetExclusiveScissorNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetCheckpointNV, {
     "VUID-vkCmdSetCheckpointNV-commandBuffer-recording",
@@ -1227,6 +1412,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdSetCheckpointNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetCheckpointNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetPerformanceMarkerINTEL, {
     "VUID-vkCmdSetPerformanceMarkerINTEL-commandBuffer-recording",
@@ -1234,6 +1420,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdSetPerformanceMarkerINTEL-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetPerformanceMarkerINTEL-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetPerformanceStreamMarkerINTEL, {
     "VUID-vkCmdSetPerformanceStreamMarkerINTEL-commandBuffer-recording",
@@ -1241,6 +1428,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdSetPerformanceStreamMarkerINTEL-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetPerformanceStreamMarkerINTEL-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetPerformanceOverrideINTEL, {
     "VUID-vkCmdSetPerformanceOverrideINTEL-commandBuffer-recording",
@@ -1248,6 +1436,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdSetPerformanceOverrideINTEL-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetPerformanceOverrideINTEL-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetLineStippleEXT, {
     "VUID-vkCmdSetLineStipple-commandBuffer-recording",
@@ -1255,6 +1444,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetLineStipple-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetLineStipple-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetCullModeEXT, {
     "VUID-vkCmdSetCullMode-commandBuffer-recording",
@@ -1262,6 +1452,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetCullMode-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetCullMode-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetFrontFaceEXT, {
     "VUID-vkCmdSetFrontFace-commandBuffer-recording",
@@ -1269,6 +1460,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetFrontFace-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetFrontFace-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetPrimitiveTopologyEXT, {
     "VUID-vkCmdSetPrimitiveTopology-commandBuffer-recording",
@@ -1276,6 +1468,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetPrimitiveTopology-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetPrimitiveTopology-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetViewportWithCountEXT, {
     "VUID-vkCmdSetViewportWithCount-commandBuffer-recording",
@@ -1283,6 +1476,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetViewportWithCount-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetViewportWithCount-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetScissorWithCountEXT, {
     "VUID-vkCmdSetScissorWithCount-commandBuffer-recording",
@@ -1290,6 +1484,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetScissorWithCount-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetScissorWithCount-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindVertexBuffers2EXT, {
     "VUID-vkCmdBindVertexBuffers2-commandBuffer-recording",
@@ -1297,6 +1492,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdBindVertexBuffers2-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindVertexBuffers2-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthTestEnableEXT, {
     "VUID-vkCmdSetDepthTestEnable-commandBuffer-recording",
@@ -1304,6 +1500,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthTestEnable-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthTestEnable-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthWriteEnableEXT, {
     "VUID-vkCmdSetDepthWriteEnable-commandBuffer-recording",
@@ -1311,6 +1508,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthWriteEnable-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthWriteEnable-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthCompareOpEXT, {
     "VUID-vkCmdSetDepthCompareOp-commandBuffer-recording",
@@ -1318,6 +1516,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthCompareOp-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthCompareOp-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthBoundsTestEnableEXT, {
     "VUID-vkCmdSetDepthBoundsTestEnable-commandBuffer-recording",
@@ -1325,6 +1524,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthBoundsTestEnable-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthBoundsTestEnable-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetStencilTestEnableEXT, {
     "VUID-vkCmdSetStencilTestEnable-commandBuffer-recording",
@@ -1332,6 +1532,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetStencilTestEnable-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetStencilTestEnable-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetStencilOpEXT, {
     "VUID-vkCmdSetStencilOp-commandBuffer-recording",
@@ -1339,6 +1540,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetStencilOp-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetStencilOp-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdPreprocessGeneratedCommandsNV, {
     "VUID-vkCmdPreprocessGeneratedCommandsNV-commandBuffer-recording",
@@ -1346,6 +1548,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdPreprocessGeneratedCommandsNV-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdPreprocessGeneratedCommandsNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdPreprocessGeneratedCommandsNV-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdExecuteGeneratedCommandsNV, {
     "VUID-vkCmdExecuteGeneratedCommandsNV-commandBuffer-recording",
@@ -1353,6 +1556,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdExecuteGeneratedCommandsNV-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdExecuteGeneratedCommandsNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdExecuteGeneratedCommandsNV-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindPipelineShaderGroupNV, {
     "VUID-vkCmdBindPipelineShaderGroupNV-commandBuffer-recording",
@@ -1360,6 +1564,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdBindPipelineShaderGroupNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindPipelineShaderGroupNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthBias2EXT, {
     "VUID-vkCmdSetDepthBias2EXT-commandBuffer-recording",
@@ -1367,6 +1572,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthBias2EXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthBias2EXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCudaLaunchKernelNV, {
     "VUID-vkCmdCudaLaunchKernelNV-commandBuffer-recording",
@@ -1374,6 +1580,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdCudaLaunchKernelNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCudaLaunchKernelNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDispatchTileQCOM, {
     "VUID-vkCmdDispatchTileQCOM-commandBuffer-recording",
@@ -1381,6 +1588,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdDispatchTileQCOM-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDispatchTileQCOM-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDispatchTileQCOM-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBeginPerTileExecutionQCOM, {
     "VUID-vkCmdBeginPerTileExecutionQCOM-commandBuffer-recording",
@@ -1388,6 +1596,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdBeginPerTileExecutionQCOM-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdBeginPerTileExecutionQCOM-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBeginPerTileExecutionQCOM-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdEndPerTileExecutionQCOM, {
     "VUID-vkCmdEndPerTileExecutionQCOM-commandBuffer-recording",
@@ -1395,6 +1604,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdEndPerTileExecutionQCOM-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdEndPerTileExecutionQCOM-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdEndPerTileExecutionQCOM-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindDescriptorBuffersEXT, {
     "VUID-vkCmdBindDescriptorBuffersEXT-commandBuffer-recording",
@@ -1402,6 +1612,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_DATA_GRAPH_BIT_ARM, "VUID-vkCmdBindDescriptorBuffersEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindDescriptorBuffersEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDescriptorBufferOffsetsEXT, {
     "VUID-vkCmdSetDescriptorBufferOffsetsEXT-commandBuffer-recording",
@@ -1409,6 +1620,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_DATA_GRAPH_BIT_ARM, "VUID-vkCmdSetDescriptorBufferOffsetsEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDescriptorBufferOffsetsEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindDescriptorBufferEmbeddedSamplersEXT, {
     "VUID-vkCmdBindDescriptorBufferEmbeddedSamplersEXT-commandBuffer-recording",
@@ -1416,6 +1628,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdBindDescriptorBufferEmbeddedSamplersEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindDescriptorBufferEmbeddedSamplersEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetFragmentShadingRateEnumNV, {
     "VUID-vkCmdSetFragmentShadingRateEnumNV-commandBuffer-recording",
@@ -1423,6 +1636,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetFragmentShadingRateEnumNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetFragmentShadingRateEnumNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetVertexInputEXT, {
     "VUID-vkCmdSetVertexInputEXT-commandBuffer-recording",
@@ -1430,6 +1644,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetVertexInputEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetVertexInputEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSubpassShadingHUAWEI, {
     "VUID-vkCmdSubpassShadingHUAWEI-commandBuffer-recording",
@@ -1437,6 +1652,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSubpassShadingHUAWEI-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdSubpassShadingHUAWEI-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSubpassShadingHUAWEI-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindInvocationMaskHUAWEI, {
     "VUID-vkCmdBindInvocationMaskHUAWEI-commandBuffer-recording",
@@ -1444,6 +1660,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdBindInvocationMaskHUAWEI-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindInvocationMaskHUAWEI-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindInvocationMaskHUAWEI-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetPatchControlPointsEXT, {
     "VUID-vkCmdSetPatchControlPointsEXT-commandBuffer-recording",
@@ -1451,6 +1668,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetPatchControlPointsEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetPatchControlPointsEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetRasterizerDiscardEnableEXT, {
     "VUID-vkCmdSetRasterizerDiscardEnable-commandBuffer-recording",
@@ -1458,6 +1676,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetRasterizerDiscardEnable-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetRasterizerDiscardEnable-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthBiasEnableEXT, {
     "VUID-vkCmdSetDepthBiasEnable-commandBuffer-recording",
@@ -1465,6 +1684,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthBiasEnable-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthBiasEnable-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetLogicOpEXT, {
     "VUID-vkCmdSetLogicOpEXT-commandBuffer-recording",
@@ -1472,6 +1692,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetLogicOpEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetLogicOpEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetPrimitiveRestartEnableEXT, {
     "VUID-vkCmdSetPrimitiveRestartEnable-commandBuffer-recording",
@@ -1479,6 +1700,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetPrimitiveRestartEnable-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetPrimitiveRestartEnable-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetColorWriteEnableEXT, {
     "VUID-vkCmdSetColorWriteEnableEXT-commandBuffer-recording",
@@ -1486,6 +1708,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetColorWriteEnableEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetColorWriteEnableEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawMultiEXT, {
     "VUID-vkCmdDrawMultiEXT-commandBuffer-recording",
@@ -1493,6 +1716,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawMultiEXT-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawMultiEXT-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawMultiEXT-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawMultiIndexedEXT, {
     "VUID-vkCmdDrawMultiIndexedEXT-commandBuffer-recording",
@@ -1500,6 +1724,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawMultiIndexedEXT-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawMultiIndexedEXT-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawMultiIndexedEXT-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBuildMicromapsEXT, {
     "VUID-vkCmdBuildMicromapsEXT-commandBuffer-recording",
@@ -1507,6 +1732,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdBuildMicromapsEXT-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBuildMicromapsEXT-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBuildMicromapsEXT-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyMicromapEXT, {
     "VUID-vkCmdCopyMicromapEXT-commandBuffer-recording",
@@ -1514,6 +1740,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdCopyMicromapEXT-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyMicromapEXT-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyMicromapEXT-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyMicromapToMemoryEXT, {
     "VUID-vkCmdCopyMicromapToMemoryEXT-commandBuffer-recording",
@@ -1521,6 +1748,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdCopyMicromapToMemoryEXT-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyMicromapToMemoryEXT-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyMicromapToMemoryEXT-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyMemoryToMicromapEXT, {
     "VUID-vkCmdCopyMemoryToMicromapEXT-commandBuffer-recording",
@@ -1528,6 +1756,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdCopyMemoryToMicromapEXT-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyMemoryToMicromapEXT-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyMemoryToMicromapEXT-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdWriteMicromapsPropertiesEXT, {
     "VUID-vkCmdWriteMicromapsPropertiesEXT-commandBuffer-recording",
@@ -1535,6 +1764,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdWriteMicromapsPropertiesEXT-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdWriteMicromapsPropertiesEXT-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdWriteMicromapsPropertiesEXT-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawClusterHUAWEI, {
     "VUID-vkCmdDrawClusterHUAWEI-commandBuffer-recording",
@@ -1542,6 +1772,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawClusterHUAWEI-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawClusterHUAWEI-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawClusterHUAWEI-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawClusterIndirectHUAWEI, {
     "VUID-vkCmdDrawClusterIndirectHUAWEI-commandBuffer-recording",
@@ -1549,6 +1780,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawClusterIndirectHUAWEI-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawClusterIndirectHUAWEI-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawClusterIndirectHUAWEI-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyMemoryIndirectNV, {
     "VUID-vkCmdCopyMemoryIndirectNV-commandBuffer-recording",
@@ -1556,6 +1788,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdCopyMemoryIndirectNV-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyMemoryIndirectNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyMemoryIndirectNV-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyMemoryToImageIndirectNV, {
     "VUID-vkCmdCopyMemoryToImageIndirectNV-commandBuffer-recording",
@@ -1563,6 +1796,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdCopyMemoryToImageIndirectNV-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyMemoryToImageIndirectNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyMemoryToImageIndirectNV-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDecompressMemoryNV, {
     "VUID-vkCmdDecompressMemoryNV-commandBuffer-recording",
@@ -1570,6 +1804,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdDecompressMemoryNV-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDecompressMemoryNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDecompressMemoryNV-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDecompressMemoryIndirectCountNV, {
     "VUID-vkCmdDecompressMemoryIndirectCountNV-commandBuffer-recording",
@@ -1577,6 +1812,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdDecompressMemoryIndirectCountNV-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDecompressMemoryIndirectCountNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDecompressMemoryIndirectCountNV-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdUpdatePipelineIndirectBufferNV, {
     "VUID-vkCmdUpdatePipelineIndirectBufferNV-commandBuffer-recording",
@@ -1584,6 +1820,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdUpdatePipelineIndirectBufferNV-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdUpdatePipelineIndirectBufferNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdUpdatePipelineIndirectBufferNV-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthClampEnableEXT, {
     "VUID-vkCmdSetDepthClampEnableEXT-commandBuffer-recording",
@@ -1591,6 +1828,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthClampEnableEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthClampEnableEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetPolygonModeEXT, {
     "VUID-vkCmdSetPolygonModeEXT-commandBuffer-recording",
@@ -1598,6 +1836,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetPolygonModeEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetPolygonModeEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetRasterizationSamplesEXT, {
     "VUID-vkCmdSetRasterizationSamplesEXT-commandBuffer-recording",
@@ -1605,6 +1844,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetRasterizationSamplesEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetRasterizationSamplesEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetSampleMaskEXT, {
     "VUID-vkCmdSetSampleMaskEXT-commandBuffer-recording",
@@ -1612,6 +1852,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetSampleMaskEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetSampleMaskEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetAlphaToCoverageEnableEXT, {
     "VUID-vkCmdSetAlphaToCoverageEnableEXT-commandBuffer-recording",
@@ -1619,6 +1860,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetAlphaToCoverageEnableEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetAlphaToCoverageEnableEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetAlphaToOneEnableEXT, {
     "VUID-vkCmdSetAlphaToOneEnableEXT-commandBuffer-recording",
@@ -1626,6 +1868,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetAlphaToOneEnableEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetAlphaToOneEnableEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetLogicOpEnableEXT, {
     "VUID-vkCmdSetLogicOpEnableEXT-commandBuffer-recording",
@@ -1633,6 +1876,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetLogicOpEnableEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetLogicOpEnableEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetColorBlendEnableEXT, {
     "VUID-vkCmdSetColorBlendEnableEXT-commandBuffer-recording",
@@ -1640,6 +1884,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetColorBlendEnableEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetColorBlendEnableEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetColorBlendEquationEXT, {
     "VUID-vkCmdSetColorBlendEquationEXT-commandBuffer-recording",
@@ -1647,6 +1892,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetColorBlendEquationEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetColorBlendEquationEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetColorWriteMaskEXT, {
     "VUID-vkCmdSetColorWriteMaskEXT-commandBuffer-recording",
@@ -1654,6 +1900,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetColorWriteMaskEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetColorWriteMaskEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetTessellationDomainOriginEXT, {
     "VUID-vkCmdSetTessellationDomainOriginEXT-commandBuffer-recording",
@@ -1661,6 +1908,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetTessellationDomainOriginEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetTessellationDomainOriginEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetRasterizationStreamEXT, {
     "VUID-vkCmdSetRasterizationStreamEXT-commandBuffer-recording",
@@ -1668,6 +1916,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetRasterizationStreamEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetRasterizationStreamEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetConservativeRasterizationModeEXT, {
     "VUID-vkCmdSetConservativeRasterizationModeEXT-commandBuffer-recording",
@@ -1675,6 +1924,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetConservativeRasterizationModeEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetConservativeRasterizationModeEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetExtraPrimitiveOverestimationSizeEXT, {
     "VUID-vkCmdSetExtraPrimitiveOverestimationSizeEXT-commandBuffer-recording",
@@ -1682,6 +1932,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetExtraPrimitiveOverestimationSizeEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetExtraPrimitiveOverestimationSizeEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthClipEnableEXT, {
     "VUID-vkCmdSetDepthClipEnableEXT-commandBuffer-recording",
@@ -1689,6 +1940,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthClipEnableEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthClipEnableEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetSampleLocationsEnableEXT, {
     "VUID-vkCmdSetSampleLocationsEnableEXT-commandBuffer-recording",
@@ -1696,6 +1948,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetSampleLocationsEnableEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetSampleLocationsEnableEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetColorBlendAdvancedEXT, {
     "VUID-vkCmdSetColorBlendAdvancedEXT-commandBuffer-recording",
@@ -1703,6 +1956,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetColorBlendAdvancedEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetColorBlendAdvancedEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetProvokingVertexModeEXT, {
     "VUID-vkCmdSetProvokingVertexModeEXT-commandBuffer-recording",
@@ -1710,6 +1964,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetProvokingVertexModeEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetProvokingVertexModeEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetLineRasterizationModeEXT, {
     "VUID-vkCmdSetLineRasterizationModeEXT-commandBuffer-recording",
@@ -1717,6 +1972,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetLineRasterizationModeEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetLineRasterizationModeEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetLineStippleEnableEXT, {
     "VUID-vkCmdSetLineStippleEnableEXT-commandBuffer-recording",
@@ -1724,6 +1980,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetLineStippleEnableEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetLineStippleEnableEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthClipNegativeOneToOneEXT, {
     "VUID-vkCmdSetDepthClipNegativeOneToOneEXT-commandBuffer-recording",
@@ -1731,6 +1988,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthClipNegativeOneToOneEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthClipNegativeOneToOneEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetViewportWScalingEnableNV, {
     "VUID-vkCmdSetViewportWScalingEnableNV-commandBuffer-recording",
@@ -1738,6 +1996,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetViewportWScalingEnableNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetViewportWScalingEnableNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetViewportSwizzleNV, {
     "VUID-vkCmdSetViewportSwizzleNV-commandBuffer-recording",
@@ -1745,6 +2004,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetViewportSwizzleNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetViewportSwizzleNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetCoverageToColorEnableNV, {
     "VUID-vkCmdSetCoverageToColorEnableNV-commandBuffer-recording",
@@ -1752,6 +2012,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetCoverageToColorEnableNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetCoverageToColorEnableNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetCoverageToColorLocationNV, {
     "VUID-vkCmdSetCoverageToColorLocationNV-commandBuffer-recording",
@@ -1759,6 +2020,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetCoverageToColorLocationNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetCoverageToColorLocationNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetCoverageModulationModeNV, {
     "VUID-vkCmdSetCoverageModulationModeNV-commandBuffer-recording",
@@ -1766,6 +2028,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetCoverageModulationModeNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetCoverageModulationModeNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetCoverageModulationTableEnableNV, {
     "VUID-vkCmdSetCoverageModulationTableEnableNV-commandBuffer-recording",
@@ -1773,6 +2036,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetCoverageModulationTableEnableNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetCoverageModulationTableEnableNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetCoverageModulationTableNV, {
     "VUID-vkCmdSetCoverageModulationTableNV-commandBuffer-recording",
@@ -1780,6 +2044,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetCoverageModulationTableNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetCoverageModulationTableNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetShadingRateImageEnableNV, {
     "VUID-vkCmdSetShadingRateImageEnableNV-commandBuffer-recording",
@@ -1787,6 +2052,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetShadingRateImageEnableNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetShadingRateImageEnableNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetRepresentativeFragmentTestEnableNV, {
     "VUID-vkCmdSetRepresentativeFragmentTestEnableNV-commandBuffer-recording",
@@ -1794,6 +2060,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetRepresentativeFragmentTestEnableNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetRepresentativeFragmentTestEnableNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetCoverageReductionModeNV, {
     "VUID-vkCmdSetCoverageReductionModeNV-commandBuffer-recording",
@@ -1801,6 +2068,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetCoverageReductionModeNV-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetCoverageReductionModeNV-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyTensorARM, {
     "VUID-vkCmdCopyTensorARM-commandBuffer-recording",
@@ -1808,6 +2076,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, "VUID-vkCmdCopyTensorARM-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyTensorARM-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyTensorARM-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdOpticalFlowExecuteNV, {
     "VUID-vkCmdOpticalFlowExecuteNV-commandBuffer-recording",
@@ -1815,6 +2084,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_OPTICAL_FLOW_BIT_NV, "VUID-vkCmdOpticalFlowExecuteNV-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdOpticalFlowExecuteNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdOpticalFlowExecuteNV-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindShadersEXT, {
     "VUID-vkCmdBindShadersEXT-commandBuffer-recording",
@@ -1822,6 +2092,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdBindShadersEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindShadersEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetDepthClampRangeEXT, {
     "VUID-vkCmdSetDepthClampRangeEXT-commandBuffer-recording",
@@ -1829,6 +2100,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetDepthClampRangeEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetDepthClampRangeEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdConvertCooperativeVectorMatrixNV, {
     "VUID-vkCmdConvertCooperativeVectorMatrixNV-commandBuffer-recording",
@@ -1836,6 +2108,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdConvertCooperativeVectorMatrixNV-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdConvertCooperativeVectorMatrixNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdConvertCooperativeVectorMatrixNV-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDispatchDataGraphARM, {
     "VUID-vkCmdDispatchDataGraphARM-commandBuffer-recording",
@@ -1843,6 +2116,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_DATA_GRAPH_BIT_ARM, "VUID-vkCmdDispatchDataGraphARM-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDispatchDataGraphARM-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDispatchDataGraphARM-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetAttachmentFeedbackLoopEnableEXT, {
     "VUID-vkCmdSetAttachmentFeedbackLoopEnableEXT-commandBuffer-recording",
@@ -1850,6 +2124,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdSetAttachmentFeedbackLoopEnableEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetAttachmentFeedbackLoopEnableEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBindTileMemoryQCOM, {
     "VUID-vkCmdBindTileMemoryQCOM-commandBuffer-recording",
@@ -1857,6 +2132,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdBindTileMemoryQCOM-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindTileMemoryQCOM-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBindTileMemoryQCOM-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBuildClusterAccelerationStructureIndirectNV, {
     "VUID-vkCmdBuildClusterAccelerationStructureIndirectNV-commandBuffer-recording",
@@ -1864,6 +2140,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdBuildClusterAccelerationStructureIndirectNV-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBuildClusterAccelerationStructureIndirectNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBuildClusterAccelerationStructureIndirectNV-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBuildPartitionedAccelerationStructuresNV, {
     "VUID-vkCmdBuildPartitionedAccelerationStructuresNV-commandBuffer-recording",
@@ -1871,6 +2148,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdBuildPartitionedAccelerationStructuresNV-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBuildPartitionedAccelerationStructuresNV-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBuildPartitionedAccelerationStructuresNV-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdPreprocessGeneratedCommandsEXT, {
     "VUID-vkCmdPreprocessGeneratedCommandsEXT-commandBuffer-recording",
@@ -1878,6 +2156,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdPreprocessGeneratedCommandsEXT-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdPreprocessGeneratedCommandsEXT-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdPreprocessGeneratedCommandsEXT-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondary | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdExecuteGeneratedCommandsEXT, {
     "VUID-vkCmdExecuteGeneratedCommandsEXT-commandBuffer-recording",
@@ -1885,6 +2164,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdExecuteGeneratedCommandsEXT-commandBuffer-cmdpool",
     CMD_SCOPE_BOTH, "kVUIDUndefined",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdExecuteGeneratedCommandsEXT-videocoding",
+    kCbRecording, kCbVideoCoding | kCbSecondary | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdEndRendering2EXT, {
     "VUID-vkCmdEndRendering2EXT-commandBuffer-recording",
@@ -1892,6 +2172,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdEndRendering2EXT-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdEndRendering2EXT-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdEndRendering2EXT-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBuildAccelerationStructuresKHR, {
     "VUID-vkCmdBuildAccelerationStructuresKHR-commandBuffer-recording",
@@ -1899,6 +2180,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdBuildAccelerationStructuresKHR-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBuildAccelerationStructuresKHR-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBuildAccelerationStructuresKHR-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdBuildAccelerationStructuresIndirectKHR, {
     "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-commandBuffer-recording",
@@ -1906,6 +2188,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyAccelerationStructureKHR, {
     "VUID-vkCmdCopyAccelerationStructureKHR-commandBuffer-recording",
@@ -1913,6 +2196,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdCopyAccelerationStructureKHR-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyAccelerationStructureKHR-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyAccelerationStructureKHR-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyAccelerationStructureToMemoryKHR, {
     "VUID-vkCmdCopyAccelerationStructureToMemoryKHR-commandBuffer-recording",
@@ -1920,6 +2204,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdCopyAccelerationStructureToMemoryKHR-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyAccelerationStructureToMemoryKHR-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyAccelerationStructureToMemoryKHR-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdCopyMemoryToAccelerationStructureKHR, {
     "VUID-vkCmdCopyMemoryToAccelerationStructureKHR-commandBuffer-recording",
@@ -1927,6 +2212,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdCopyMemoryToAccelerationStructureKHR-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyMemoryToAccelerationStructureKHR-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdCopyMemoryToAccelerationStructureKHR-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdWriteAccelerationStructuresPropertiesKHR, {
     "VUID-vkCmdWriteAccelerationStructuresPropertiesKHR-commandBuffer-recording",
@@ -1934,6 +2220,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdWriteAccelerationStructuresPropertiesKHR-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdWriteAccelerationStructuresPropertiesKHR-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdWriteAccelerationStructuresPropertiesKHR-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdTraceRaysKHR, {
     "VUID-vkCmdTraceRaysKHR-commandBuffer-recording",
@@ -1941,6 +2228,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdTraceRaysKHR-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdTraceRaysKHR-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdTraceRaysKHR-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdTraceRaysIndirectKHR, {
     "VUID-vkCmdTraceRaysIndirectKHR-commandBuffer-recording",
@@ -1948,6 +2236,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdTraceRaysIndirectKHR-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdTraceRaysIndirectKHR-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdTraceRaysIndirectKHR-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdSetRayTracingPipelineStackSizeKHR, {
     "VUID-vkCmdSetRayTracingPipelineStackSizeKHR-commandBuffer-recording",
@@ -1955,6 +2244,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_COMPUTE_BIT, "VUID-vkCmdSetRayTracingPipelineStackSizeKHR-commandBuffer-cmdpool",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetRayTracingPipelineStackSizeKHR-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdSetRayTracingPipelineStackSizeKHR-videocoding",
+    kCbRecording, kCbActiveRenderPass | kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawMeshTasksEXT, {
     "VUID-vkCmdDrawMeshTasksEXT-commandBuffer-recording",
@@ -1962,6 +2252,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawMeshTasksEXT-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawMeshTasksEXT-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawMeshTasksEXT-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawMeshTasksIndirectEXT, {
     "VUID-vkCmdDrawMeshTasksIndirectEXT-commandBuffer-recording",
@@ -1969,6 +2260,7 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawMeshTasksIndirectEXT-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawMeshTasksIndirectEXT-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawMeshTasksIndirectEXT-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 {Func::vkCmdDrawMeshTasksIndirectCountEXT, {
     "VUID-vkCmdDrawMeshTasksIndirectCountEXT-commandBuffer-recording",
@@ -1976,12 +2268,37 @@ static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationT
     VK_QUEUE_GRAPHICS_BIT, "VUID-vkCmdDrawMeshTasksIndirectCountEXT-commandBuffer-cmdpool",
     CMD_SCOPE_INSIDE, "VUID-vkCmdDrawMeshTasksIndirectCountEXT-renderpass",
     CMD_SCOPE_OUTSIDE, "VUID-vkCmdDrawMeshTasksIndirectCountEXT-videocoding",
+    kCbRecording | kCbRenderPassScope, kCbVideoCoding | kCbSecondaryContentsSubpass,
 }},
 };
 return kCommandValidationTable;
 }
 // clang-format on
 
+static uint32_t GetCommandBufferStateBits(const vvl::CommandBuffer& cb_state) {
+    uint32_t state_bits = 0;
+    if (cb_state.state == CbState::Recording) {
+        state_bits |= kCbRecording;
+    }
+    if (cb_state.active_render_pass) {
+        state_bits |= kCbActiveRenderPass | kCbRenderPassScope;
+        if (cb_state.IsPrimary() && !cb_state.active_render_pass->UsesDynamicRendering() &&
+            cb_state.active_subpass_contents == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS) {
+            state_bits |= kCbSecondaryContentsSubpass;
+        }
+    }
+    if (cb_state.IsSecondary()) {
+        state_bits |= kCbSecondary;
+        if (cb_state.begin_info_flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT) {
+            state_bits |= kCbRenderPassScope;
+        }
+    }
+    if (cb_state.bound_video_session) {
+        state_bits |= kCbVideoCoding;
+    }
+    return state_bits;
+}
+
 // Ran on all vkCmd* commands
 // Because it validate the implicit VUs that stateless can't, if this fails, it is likely
 // the input is very bad and other checks will crash dereferencing null pointers
@@ -1994,6 +2311,13 @@ bool CoreChecks::ValidateCmd(const vvl::CommandBuffer& cb_state, const Location&
     }
     const auto& info = info_it->second;
 
+    const uint32_t state_bits = GetCommandBufferStateBits(cb_state);
+    const VkQueueFlags pool_queue_flags = cb_state.command_pool ? cb_state.command_pool->queue_flags : info.queue_flags;
+    if ((state_bits & (info.required_state | info.forbidden_state)) == info.required_state &&
+        (pool_queue_flags & info.queue_flags) != 0) {
+        return skip;
+    }
+
     // Validate the given command being added to the specified cmd buffer,
     // flagging errors if CB is not in the recording state or if there's an issue with the Cmd ordering
     switch (cb_state.state) {
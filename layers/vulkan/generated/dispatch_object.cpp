@@ -27,6 +27,7 @@
 #include <vulkan/utility/vk_safe_struct.hpp>
 #include "state_tracker/pipeline_state.h"
 #include "containers/custom_containers.h"
+#include "containers/scratch_arena.h"
 
 #include "thread_tracker/thread_safety_validation.h"
 #include "stateless/stateless_validation.h"
@@ -38,8 +39,6 @@
 #include "gpuav/core/gpuav.h"
 #include "sync/sync_validation.h"
 
-#define DISPATCH_MAX_STACK_ALLOCATIONS 32
-
 namespace vvl {
 namespace dispatch {
 
@@ -118,11 +117,100 @@ void Device::InitValidationObjects() {
     }
 }
 
+// sType of every extension struct UnwrapPnextChainHandles() has to look into
+static constexpr VkStructureType kPnextStructsWithHandles[] = {
+    VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+    VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+    VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_KHR,
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    VK_STRUCTURE_TYPE_EXECUTION_GRAPH_PIPELINE_CREATE_INFO_AMDX,
+#endif  // VK_ENABLE_BETA_EXTENSIONS
+    VK_STRUCTURE_TYPE_FRAME_BOUNDARY_EXT,
+    VK_STRUCTURE_TYPE_FRAME_BOUNDARY_TENSORS_ARM,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR,
+    VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV,
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+    VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV,
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    VK_STRUCTURE_TYPE_IMPORT_MEMORY_BUFFER_COLLECTION_FUCHSIA,
+#endif  // VK_USE_PLATFORM_FUCHSIA
+    VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO,
+    VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO_TENSOR_ARM,
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    VK_STRUCTURE_TYPE_BUFFER_COLLECTION_BUFFER_CREATE_INFO_FUCHSIA,
+    VK_STRUCTURE_TYPE_BUFFER_COLLECTION_IMAGE_CREATE_INFO_FUCHSIA,
+#endif  // VK_USE_PLATFORM_FUCHSIA
+    VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR,
+    VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO,
+    VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT,
+    VK_STRUCTURE_TYPE_PIPELINE_BINARY_INFO_KHR,
+    VK_STRUCTURE_TYPE_SUBPASS_SHADING_PIPELINE_CREATE_INFO_HUAWEI,
+    VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_SHADER_GROUPS_CREATE_INFO_NV,
+    VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+    VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR,
+    VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV,
+    VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_TENSOR_ARM,
+    VK_STRUCTURE_TYPE_TILE_MEMORY_BIND_INFO_QCOM,
+    VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO,
+    VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR,
+    VK_STRUCTURE_TYPE_TENSOR_DEPENDENCY_INFO_ARM,
+    VK_STRUCTURE_TYPE_TENSOR_MEMORY_BARRIER_ARM,
+    VK_STRUCTURE_TYPE_RENDER_PASS_STRIPE_SUBMIT_INFO_ARM,
+    VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_DENSITY_MAP_ATTACHMENT_INFO_EXT,
+    VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR,
+    VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+    VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_FENCE_INFO_KHR,
+    VK_STRUCTURE_TYPE_VIDEO_INLINE_QUERY_INFO_KHR,
+    VK_STRUCTURE_TYPE_VIDEO_ENCODE_QUANTIZATION_MAP_INFO_KHR,
+#ifdef VK_USE_PLATFORM_METAL_EXT
+    VK_STRUCTURE_TYPE_EXPORT_METAL_BUFFER_INFO_EXT,
+    VK_STRUCTURE_TYPE_EXPORT_METAL_IO_SURFACE_INFO_EXT,
+    VK_STRUCTURE_TYPE_EXPORT_METAL_SHARED_EVENT_INFO_EXT,
+    VK_STRUCTURE_TYPE_EXPORT_METAL_TEXTURE_INFO_EXT,
+#endif  // VK_USE_PLATFORM_METAL_EXT
+    VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_PUSH_DESCRIPTOR_BUFFER_HANDLE_EXT,
+    VK_STRUCTURE_TYPE_DESCRIPTOR_GET_TENSOR_INFO_ARM,
+    VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_SHADER_MODULE_CREATE_INFO_ARM,
+    VK_STRUCTURE_TYPE_GENERATED_COMMANDS_PIPELINE_INFO_EXT,
+    VK_STRUCTURE_TYPE_GENERATED_COMMANDS_SHADER_INFO_EXT,
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_TRIANGLES_DISPLACEMENT_MICROMAP_NV,
+#endif  // VK_ENABLE_BETA_EXTENSIONS
+    VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_TRIANGLES_OPACITY_MICROMAP_EXT,
+};
+
+// Bit set indexed by a hash of the sType. A clear bit means no struct with handles has that sType, so the chain walk
+// can step over the common structs without handles (ex: VkTimelineSemaphoreSubmitInfo) with a single test instead of
+// going through the switch.
+class PnextHandleFilter {
+  public:
+    constexpr PnextHandleFilter() : words_() {
+        for (VkStructureType s_type : kPnextStructsWithHandles) {
+            words_[Index(s_type) / 64] |= uint64_t(1) << (Index(s_type) % 64);
+        }
+    }
+    constexpr bool MayHaveHandles(VkStructureType s_type) const { return (words_[Index(s_type) / 64] >> (Index(s_type) % 64)) & 1; }
+
+  private:
+    static constexpr uint32_t kBitsLog2 = 10;
+    // Fibonacci hashing, the raw values are too regular (extension sTypes are 1000 apart) to use their low bits
+    static constexpr uint32_t Index(VkStructureType s_type) {
+        return (static_cast<uint32_t>(s_type) * 2654435769u) >> (32 - kBitsLog2);
+    }
+    uint64_t words_[(1u << kBitsLog2) / 64];
+};
+static constexpr PnextHandleFilter kPnextHandleFilter;
+
 // Unique Objects pNext extension handling function
 void HandleWrapper::UnwrapPnextChainHandles(const void* pNext) {
     void* cur_pnext = const_cast<void*>(pNext);
     while (cur_pnext != nullptr) {
         VkBaseOutStructure* header = reinterpret_cast<VkBaseOutStructure*>(cur_pnext);
+        if (!kPnextHandleFilter.MayHaveHandles(header->sType)) {
+            cur_pnext = header->pNext;
+            continue;
+        }
 
         switch (header->sType) {
             case VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO: {
@@ -680,7 +768,7 @@ void Device::GetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t
 
 VkResult Device::QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) {
     if (!wrap_handles) return device_dispatch_table.QueueSubmit(queue, submitCount, pSubmits, fence);
-    small_vector<vku::safe_VkSubmitInfo, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pSubmits;
+    vvl::ScratchArray<vku::safe_VkSubmitInfo> var_local_pSubmits;
     vku::safe_VkSubmitInfo* local_pSubmits = nullptr;
     {
         if (pSubmits) {
@@ -763,7 +851,7 @@ void Device::UnmapMemory(VkDevice device, VkDeviceMemory memory) {
 
 VkResult Device::FlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) {
     if (!wrap_handles) return device_dispatch_table.FlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
-    small_vector<vku::safe_VkMappedMemoryRange, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pMemoryRanges;
+    vvl::ScratchArray<vku::safe_VkMappedMemoryRange> var_local_pMemoryRanges;
     vku::safe_VkMappedMemoryRange* local_pMemoryRanges = nullptr;
     {
         if (pMemoryRanges) {
@@ -787,7 +875,7 @@ VkResult Device::FlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCo
 VkResult Device::InvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
                                               const VkMappedMemoryRange* pMemoryRanges) {
     if (!wrap_handles) return device_dispatch_table.InvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
-    small_vector<vku::safe_VkMappedMemoryRange, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pMemoryRanges;
+    vvl::ScratchArray<vku::safe_VkMappedMemoryRange> var_local_pMemoryRanges;
     vku::safe_VkMappedMemoryRange* local_pMemoryRanges = nullptr;
     {
         if (pMemoryRanges) {
@@ -867,7 +955,7 @@ void Instance::GetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice phy
 
 VkResult Device::QueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence) {
     if (!wrap_handles) return device_dispatch_table.QueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
-    small_vector<vku::safe_VkBindSparseInfo, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pBindInfo;
+    vvl::ScratchArray<vku::safe_VkBindSparseInfo> var_local_pBindInfo;
     vku::safe_VkBindSparseInfo* local_pBindInfo = nullptr;
     {
         if (pBindInfo) {
@@ -963,7 +1051,7 @@ void Device::DestroyFence(VkDevice device, VkFence fence, const VkAllocationCall
 
 VkResult Device::ResetFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences) {
     if (!wrap_handles) return device_dispatch_table.ResetFences(device, fenceCount, pFences);
-    small_vector<VkFence, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pFences;
+    vvl::ScratchArray<VkFence> var_local_pFences;
     VkFence* local_pFences = nullptr;
     {
         if (pFences) {
@@ -989,7 +1077,7 @@ VkResult Device::GetFenceStatus(VkDevice device, VkFence fence) {
 
 VkResult Device::WaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout) {
     if (!wrap_handles) return device_dispatch_table.WaitForFences(device, fenceCount, pFences, waitAll, timeout);
-    small_vector<VkFence, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pFences;
+    vvl::ScratchArray<VkFence> var_local_pFences;
     VkFence* local_pFences = nullptr;
     {
         if (pFences) {
@@ -1261,7 +1349,7 @@ VkResult Device::GetPipelineCacheData(VkDevice device, VkPipelineCache pipelineC
 VkResult Device::MergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount,
                                      const VkPipelineCache* pSrcCaches) {
     if (!wrap_handles) return device_dispatch_table.MergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
-    small_vector<VkPipelineCache, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pSrcCaches;
+    vvl::ScratchArray<VkPipelineCache> var_local_pSrcCaches;
     VkPipelineCache* local_pSrcCaches = nullptr;
     {
         dstCache = Unwrap(dstCache);
@@ -1393,9 +1481,9 @@ void Device::UpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount
     if (!wrap_handles)
         return device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount,
                                                           pDescriptorCopies);
-    small_vector<vku::safe_VkWriteDescriptorSet, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pDescriptorWrites;
+    vvl::ScratchArray<vku::safe_VkWriteDescriptorSet> var_local_pDescriptorWrites;
     vku::safe_VkWriteDescriptorSet* local_pDescriptorWrites = nullptr;
-    small_vector<vku::safe_VkCopyDescriptorSet, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pDescriptorCopies;
+    vvl::ScratchArray<vku::safe_VkCopyDescriptorSet> var_local_pDescriptorCopies;
     vku::safe_VkCopyDescriptorSet* local_pDescriptorCopies = nullptr;
     {
         if (pDescriptorWrites) {
@@ -1576,7 +1664,7 @@ void Device::CmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBind
     if (!wrap_handles)
         return device_dispatch_table.CmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount,
                                                            pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
-    small_vector<VkDescriptorSet, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pDescriptorSets;
+    vvl::ScratchArray<VkDescriptorSet> var_local_pDescriptorSets;
     VkDescriptorSet* local_pDescriptorSets = nullptr;
     {
         layout = Unwrap(layout);
@@ -1602,7 +1690,7 @@ void Device::CmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstB
                                   const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) {
     if (!wrap_handles)
         return device_dispatch_table.CmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
-    small_vector<VkBuffer, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pBuffers;
+    vvl::ScratchArray<VkBuffer> var_local_pBuffers;
     VkBuffer* local_pBuffers = nullptr;
     {
         if (pBuffers) {
@@ -1780,11 +1868,11 @@ void Device::CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, c
         return device_dispatch_table.CmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask,
                                                    memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount,
                                                    pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
-    small_vector<VkEvent, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pEvents;
+    vvl::ScratchArray<VkEvent> var_local_pEvents;
     VkEvent* local_pEvents = nullptr;
-    small_vector<vku::safe_VkBufferMemoryBarrier, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pBufferMemoryBarriers;
+    vvl::ScratchArray<vku::safe_VkBufferMemoryBarrier> var_local_pBufferMemoryBarriers;
     vku::safe_VkBufferMemoryBarrier* local_pBufferMemoryBarriers = nullptr;
-    small_vector<vku::safe_VkImageMemoryBarrier, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pImageMemoryBarriers;
+    vvl::ScratchArray<vku::safe_VkImageMemoryBarrier> var_local_pImageMemoryBarriers;
     vku::safe_VkImageMemoryBarrier* local_pImageMemoryBarriers = nullptr;
     {
         if (pEvents) {
@@ -1832,9 +1920,9 @@ void Device::CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFl
         return device_dispatch_table.CmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags,
                                                         memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount,
                                                         pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
-    small_vector<vku::safe_VkBufferMemoryBarrier, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pBufferMemoryBarriers;
+    vvl::ScratchArray<vku::safe_VkBufferMemoryBarrier> var_local_pBufferMemoryBarriers;
     vku::safe_VkBufferMemoryBarrier* local_pBufferMemoryBarriers = nullptr;
-    small_vector<vku::safe_VkImageMemoryBarrier, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pImageMemoryBarriers;
+    vvl::ScratchArray<vku::safe_VkImageMemoryBarrier> var_local_pImageMemoryBarriers;
     vku::safe_VkImageMemoryBarrier* local_pImageMemoryBarriers = nullptr;
     {
         if (pBufferMemoryBarriers) {
@@ -2391,9 +2479,9 @@ void Device::CmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPipe
 void Device::CmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
                             const VkDependencyInfo* pDependencyInfos) {
     if (!wrap_handles) return device_dispatch_table.CmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
-    small_vector<VkEvent, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pEvents;
+    vvl::ScratchArray<VkEvent> var_local_pEvents;
     VkEvent* local_pEvents = nullptr;
-    small_vector<vku::safe_VkDependencyInfo, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pDependencyInfos;
+    vvl::ScratchArray<vku::safe_VkDependencyInfo> var_local_pDependencyInfos;
     vku::safe_VkDependencyInfo* local_pDependencyInfos = nullptr;
     {
         if (pEvents) {
@@ -2470,7 +2558,7 @@ void Device::CmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFl
 
 VkResult Device::QueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
     if (!wrap_handles) return device_dispatch_table.QueueSubmit2(queue, submitCount, pSubmits, fence);
-    small_vector<vku::safe_VkSubmitInfo2, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pSubmits;
+    vvl::ScratchArray<vku::safe_VkSubmitInfo2> var_local_pSubmits;
     vku::safe_VkSubmitInfo2* local_pSubmits = nullptr;
     {
         if (pSubmits) {
@@ -2701,7 +2789,7 @@ void Device::CmdBindVertexBuffers2(VkCommandBuffer commandBuffer, uint32_t first
     if (!wrap_handles)
         return device_dispatch_table.CmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes,
                                                            pStrides);
-    small_vector<VkBuffer, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pBuffers;
+    vvl::ScratchArray<VkBuffer> var_local_pBuffers;
     VkBuffer* local_pBuffers = nullptr;
     {
         if (pBuffers) {
@@ -2840,7 +2928,7 @@ void Device::CmdPushDescriptorSet(VkCommandBuffer commandBuffer, VkPipelineBindP
     if (!wrap_handles)
         return device_dispatch_table.CmdPushDescriptorSet(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount,
                                                           pDescriptorWrites);
-    small_vector<vku::safe_VkWriteDescriptorSet, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pDescriptorWrites;
+    vvl::ScratchArray<vku::safe_VkWriteDescriptorSet> var_local_pDescriptorWrites;
     vku::safe_VkWriteDescriptorSet* local_pDescriptorWrites = nullptr;
     {
         layout = Unwrap(layout);
@@ -3059,7 +3147,7 @@ VkResult Device::CopyImageToImage(VkDevice device, const VkCopyImageToImageInfo*
 VkResult Device::TransitionImageLayout(VkDevice device, uint32_t transitionCount,
                                        const VkHostImageLayoutTransitionInfo* pTransitions) {
     if (!wrap_handles) return device_dispatch_table.TransitionImageLayout(device, transitionCount, pTransitions);
-    small_vector<vku::safe_VkHostImageLayoutTransitionInfo, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pTransitions;
+    vvl::ScratchArray<vku::safe_VkHostImageLayoutTransitionInfo> var_local_pTransitions;
     vku::safe_VkHostImageLayoutTransitionInfo* local_pTransitions = nullptr;
     {
         if (pTransitions) {
@@ -3272,7 +3360,7 @@ VkResult Device::CreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCo
                                            const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains) {
     if (!wrap_handles)
         return device_dispatch_table.CreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
-    small_vector<vku::safe_VkSwapchainCreateInfoKHR, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pCreateInfos;
+    vvl::ScratchArray<vku::safe_VkSwapchainCreateInfoKHR> var_local_pCreateInfos;
     vku::safe_VkSwapchainCreateInfoKHR* local_pCreateInfos = nullptr;
     {
         if (pCreateInfos) {
@@ -3448,7 +3536,7 @@ VkResult Device::BindVideoSessionMemoryKHR(VkDevice device, VkVideoSessionKHR vi
     if (!wrap_handles)
         return device_dispatch_table.BindVideoSessionMemoryKHR(device, videoSession, bindSessionMemoryInfoCount,
                                                                pBindSessionMemoryInfos);
-    small_vector<vku::safe_VkBindVideoSessionMemoryInfoKHR, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pBindSessionMemoryInfos;
+    vvl::ScratchArray<vku::safe_VkBindVideoSessionMemoryInfoKHR> var_local_pBindSessionMemoryInfos;
     vku::safe_VkBindVideoSessionMemoryInfoKHR* local_pBindSessionMemoryInfos = nullptr;
     {
         videoSession = Unwrap(videoSession);
@@ -3867,7 +3955,7 @@ void Device::CmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBi
     if (!wrap_handles)
         return device_dispatch_table.CmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount,
                                                              pDescriptorWrites);
-    small_vector<vku::safe_VkWriteDescriptorSet, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pDescriptorWrites;
+    vvl::ScratchArray<vku::safe_VkWriteDescriptorSet> var_local_pDescriptorWrites;
     vku::safe_VkWriteDescriptorSet* local_pDescriptorWrites = nullptr;
     {
         layout = Unwrap(layout);
@@ -4648,9 +4736,9 @@ void Device::CmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, VkP
 void Device::CmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
                                const VkDependencyInfo* pDependencyInfos) {
     if (!wrap_handles) return device_dispatch_table.CmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
-    small_vector<VkEvent, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pEvents;
+    vvl::ScratchArray<VkEvent> var_local_pEvents;
     VkEvent* local_pEvents = nullptr;
-    small_vector<vku::safe_VkDependencyInfo, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pDependencyInfos;
+    vvl::ScratchArray<vku::safe_VkDependencyInfo> var_local_pDependencyInfos;
     vku::safe_VkDependencyInfo* local_pDependencyInfos = nullptr;
     {
         if (pEvents) {
@@ -4728,7 +4816,7 @@ void Device::CmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer, VkPipelineStag
 
 VkResult Device::QueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
     if (!wrap_handles) return device_dispatch_table.QueueSubmit2KHR(queue, submitCount, pSubmits, fence);
-    small_vector<vku::safe_VkSubmitInfo2, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pSubmits;
+    vvl::ScratchArray<vku::safe_VkSubmitInfo2> var_local_pSubmits;
     vku::safe_VkSubmitInfo2* local_pSubmits = nullptr;
     {
         if (pSubmits) {
@@ -5224,7 +5312,7 @@ void Device::CmdBindTransformFeedbackBuffersEXT(VkCommandBuffer commandBuffer, u
     if (!wrap_handles)
         return device_dispatch_table.CmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers,
                                                                         pOffsets, pSizes);
-    small_vector<VkBuffer, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pBuffers;
+    vvl::ScratchArray<VkBuffer> var_local_pBuffers;
     VkBuffer* local_pBuffers = nullptr;
     {
         if (pBuffers) {
@@ -5244,7 +5332,7 @@ void Device::CmdBeginTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_
     if (!wrap_handles)
         return device_dispatch_table.CmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount,
                                                                   pCounterBuffers, pCounterBufferOffsets);
-    small_vector<VkBuffer, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pCounterBuffers;
+    vvl::ScratchArray<VkBuffer> var_local_pCounterBuffers;
     VkBuffer* local_pCounterBuffers = nullptr;
     {
         if (pCounterBuffers) {
@@ -5264,7 +5352,7 @@ void Device::CmdEndTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t
     if (!wrap_handles)
         return device_dispatch_table.CmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount,
                                                                 pCounterBuffers, pCounterBufferOffsets);
-    small_vector<VkBuffer, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pCounterBuffers;
+    vvl::ScratchArray<VkBuffer> var_local_pCounterBuffers;
     VkBuffer* local_pCounterBuffers = nullptr;
     {
         if (pCounterBuffers) {
@@ -5646,7 +5734,7 @@ void Device::CmdSetDiscardRectangleModeEXT(VkCommandBuffer commandBuffer, VkDisc
 void Device::SetHdrMetadataEXT(VkDevice device, uint32_t swapchainCount, const VkSwapchainKHR* pSwapchains,
                                const VkHdrMetadataEXT* pMetadata) {
     if (!wrap_handles) return device_dispatch_table.SetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
-    small_vector<VkSwapchainKHR, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pSwapchains;
+    vvl::ScratchArray<VkSwapchainKHR> var_local_pSwapchains;
     VkSwapchainKHR* local_pSwapchains = nullptr;
     {
         if (pSwapchains) {
@@ -5769,7 +5857,7 @@ VkResult Device::CreateExecutionGraphPipelinesAMDX(VkDevice device, VkPipelineCa
     if (!wrap_handles)
         return device_dispatch_table.CreateExecutionGraphPipelinesAMDX(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                        pAllocator, pPipelines);
-    small_vector<vku::safe_VkExecutionGraphPipelineCreateInfoAMDX, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pCreateInfos;
+    vvl::ScratchArray<vku::safe_VkExecutionGraphPipelineCreateInfoAMDX> var_local_pCreateInfos;
     vku::safe_VkExecutionGraphPipelineCreateInfoAMDX* local_pCreateInfos = nullptr;
     {
         pipelineCache = Unwrap(pipelineCache);
@@ -5899,7 +5987,7 @@ void Device::DestroyValidationCacheEXT(VkDevice device, VkValidationCacheEXT val
 VkResult Device::MergeValidationCachesEXT(VkDevice device, VkValidationCacheEXT dstCache, uint32_t srcCacheCount,
                                           const VkValidationCacheEXT* pSrcCaches) {
     if (!wrap_handles) return device_dispatch_table.MergeValidationCachesEXT(device, dstCache, srcCacheCount, pSrcCaches);
-    small_vector<VkValidationCacheEXT, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pSrcCaches;
+    vvl::ScratchArray<VkValidationCacheEXT> var_local_pSrcCaches;
     VkValidationCacheEXT* local_pSrcCaches = nullptr;
     {
         dstCache = Unwrap(dstCache);
@@ -6013,7 +6101,7 @@ void Device::GetAccelerationStructureMemoryRequirementsNV(VkDevice device,
 VkResult Device::BindAccelerationStructureMemoryNV(VkDevice device, uint32_t bindInfoCount,
                                                    const VkBindAccelerationStructureMemoryInfoNV* pBindInfos) {
     if (!wrap_handles) return device_dispatch_table.BindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
-    small_vector<vku::safe_VkBindAccelerationStructureMemoryInfoNV, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pBindInfos;
+    vvl::ScratchArray<vku::safe_VkBindAccelerationStructureMemoryInfoNV> var_local_pBindInfos;
     vku::safe_VkBindAccelerationStructureMemoryInfoNV* local_pBindInfos = nullptr;
     {
         if (pBindInfos) {
@@ -6154,7 +6242,7 @@ void Device::CmdWriteAccelerationStructuresPropertiesNV(VkCommandBuffer commandB
     if (!wrap_handles)
         return device_dispatch_table.CmdWriteAccelerationStructuresPropertiesNV(
             commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
-    small_vector<VkAccelerationStructureNV, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pAccelerationStructures;
+    vvl::ScratchArray<VkAccelerationStructureNV> var_local_pAccelerationStructures;
     VkAccelerationStructureNV* local_pAccelerationStructures = nullptr;
     {
         if (pAccelerationStructures) {
@@ -6500,7 +6588,7 @@ void Device::CmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffer, uint32_t fi
     if (!wrap_handles)
         return device_dispatch_table.CmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes,
                                                               pStrides);
-    small_vector<VkBuffer, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pBuffers;
+    vvl::ScratchArray<VkBuffer> var_local_pBuffers;
     VkBuffer* local_pBuffers = nullptr;
     {
         if (pBuffers) {
@@ -6605,7 +6693,7 @@ VkResult Device::CopyImageToImageEXT(VkDevice device, const VkCopyImageToImageIn
 VkResult Device::TransitionImageLayoutEXT(VkDevice device, uint32_t transitionCount,
                                           const VkHostImageLayoutTransitionInfo* pTransitions) {
     if (!wrap_handles) return device_dispatch_table.TransitionImageLayoutEXT(device, transitionCount, pTransitions);
-    small_vector<vku::safe_VkHostImageLayoutTransitionInfo, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pTransitions;
+    vvl::ScratchArray<vku::safe_VkHostImageLayoutTransitionInfo> var_local_pTransitions;
     vku::safe_VkHostImageLayoutTransitionInfo* local_pTransitions = nullptr;
     {
         if (pTransitions) {
@@ -6967,7 +7055,7 @@ void Device::GetDescriptorSetLayoutBindingOffsetEXT(VkDevice device, VkDescripto
 void Device::CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBuffer, uint32_t bufferCount,
                                          const VkDescriptorBufferBindingInfoEXT* pBindingInfos) {
     if (!wrap_handles) return device_dispatch_table.CmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos);
-    small_vector<vku::safe_VkDescriptorBufferBindingInfoEXT, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pBindingInfos;
+    vvl::ScratchArray<vku::safe_VkDescriptorBufferBindingInfoEXT> var_local_pBindingInfos;
     vku::safe_VkDescriptorBufferBindingInfoEXT* local_pBindingInfos = nullptr;
     {
         if (pBindingInfos) {
@@ -7441,7 +7529,7 @@ void Device::DestroyMicromapEXT(VkDevice device, VkMicromapEXT micromap, const V
 
 void Device::CmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkMicromapBuildInfoEXT* pInfos) {
     if (!wrap_handles) return device_dispatch_table.CmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos);
-    small_vector<vku::safe_VkMicromapBuildInfoEXT, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pInfos;
+    vvl::ScratchArray<vku::safe_VkMicromapBuildInfoEXT> var_local_pInfos;
     vku::safe_VkMicromapBuildInfoEXT* local_pInfos = nullptr;
     {
         if (pInfos) {
@@ -7591,7 +7679,7 @@ VkResult Device::WriteMicromapsPropertiesEXT(VkDevice device, uint32_t micromapC
     if (!wrap_handles)
         return device_dispatch_table.WriteMicromapsPropertiesEXT(device, micromapCount, pMicromaps, queryType, dataSize, pData,
                                                                  stride);
-    small_vector<VkMicromapEXT, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pMicromaps;
+    vvl::ScratchArray<VkMicromapEXT> var_local_pMicromaps;
     VkMicromapEXT* local_pMicromaps = nullptr;
     {
         if (pMicromaps) {
@@ -7667,7 +7755,7 @@ void Device::CmdWriteMicromapsPropertiesEXT(VkCommandBuffer commandBuffer, uint3
     if (!wrap_handles)
         return device_dispatch_table.CmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType, queryPool,
                                                                     firstQuery);
-    small_vector<VkMicromapEXT, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pMicromaps;
+    vvl::ScratchArray<VkMicromapEXT> var_local_pMicromaps;
     VkMicromapEXT* local_pMicromaps = nullptr;
     {
         if (pMicromaps) {
@@ -8030,7 +8118,7 @@ void Device::GetTensorMemoryRequirementsARM(VkDevice device, const VkTensorMemor
 
 VkResult Device::BindTensorMemoryARM(VkDevice device, uint32_t bindInfoCount, const VkBindTensorMemoryInfoARM* pBindInfos) {
     if (!wrap_handles) return device_dispatch_table.BindTensorMemoryARM(device, bindInfoCount, pBindInfos);
-    small_vector<vku::safe_VkBindTensorMemoryInfoARM, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pBindInfos;
+    vvl::ScratchArray<vku::safe_VkBindTensorMemoryInfoARM> var_local_pBindInfos;
     vku::safe_VkBindTensorMemoryInfoARM* local_pBindInfos = nullptr;
     {
         if (pBindInfos) {
@@ -8218,7 +8306,7 @@ VkResult Device::GetShaderBinaryDataEXT(VkDevice device, VkShaderEXT shader, siz
 void Device::CmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCount, const VkShaderStageFlagBits* pStages,
                                const VkShaderEXT* pShaders) {
     if (!wrap_handles) return device_dispatch_table.CmdBindShadersEXT(commandBuffer, stageCount, pStages, pShaders);
-    small_vector<VkShaderEXT, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pShaders;
+    vvl::ScratchArray<VkShaderEXT> var_local_pShaders;
     VkShaderEXT* local_pShaders = nullptr;
     {
         if (pShaders) {
@@ -8476,7 +8564,7 @@ void Device::GetDataGraphPipelineSessionMemoryRequirementsARM(VkDevice device,
 VkResult Device::BindDataGraphPipelineSessionMemoryARM(VkDevice device, uint32_t bindInfoCount,
                                                        const VkBindDataGraphPipelineSessionMemoryInfoARM* pBindInfos) {
     if (!wrap_handles) return device_dispatch_table.BindDataGraphPipelineSessionMemoryARM(device, bindInfoCount, pBindInfos);
-    small_vector<vku::safe_VkBindDataGraphPipelineSessionMemoryInfoARM, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pBindInfos;
+    vvl::ScratchArray<vku::safe_VkBindDataGraphPipelineSessionMemoryInfoARM> var_local_pBindInfos;
     vku::safe_VkBindDataGraphPipelineSessionMemoryInfoARM* local_pBindInfos = nullptr;
     {
         if (pBindInfos) {
@@ -8764,7 +8852,7 @@ void Device::UpdateIndirectExecutionSetPipelineEXT(VkDevice device, VkIndirectEx
     if (!wrap_handles)
         return device_dispatch_table.UpdateIndirectExecutionSetPipelineEXT(device, indirectExecutionSet, executionSetWriteCount,
                                                                            pExecutionSetWrites);
-    small_vector<vku::safe_VkWriteIndirectExecutionSetPipelineEXT, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pExecutionSetWrites;
+    vvl::ScratchArray<vku::safe_VkWriteIndirectExecutionSetPipelineEXT> var_local_pExecutionSetWrites;
     vku::safe_VkWriteIndirectExecutionSetPipelineEXT* local_pExecutionSetWrites = nullptr;
     {
         indirectExecutionSet = Unwrap(indirectExecutionSet);
@@ -8791,7 +8879,7 @@ void Device::UpdateIndirectExecutionSetShaderEXT(VkDevice device, VkIndirectExec
     if (!wrap_handles)
         return device_dispatch_table.UpdateIndirectExecutionSetShaderEXT(device, indirectExecutionSet, executionSetWriteCount,
                                                                          pExecutionSetWrites);
-    small_vector<vku::safe_VkWriteIndirectExecutionSetShaderEXT, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pExecutionSetWrites;
+    vvl::ScratchArray<vku::safe_VkWriteIndirectExecutionSetShaderEXT> var_local_pExecutionSetWrites;
     vku::safe_VkWriteIndirectExecutionSetShaderEXT* local_pExecutionSetWrites = nullptr;
     {
         indirectExecutionSet = Unwrap(indirectExecutionSet);
@@ -8909,7 +8997,7 @@ void Device::CmdBuildAccelerationStructuresIndirectKHR(VkCommandBuffer commandBu
     if (!wrap_handles)
         return device_dispatch_table.CmdBuildAccelerationStructuresIndirectKHR(
             commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
-    small_vector<vku::safe_VkAccelerationStructureBuildGeometryInfoKHR, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pInfos;
+    vvl::ScratchArray<vku::safe_VkAccelerationStructureBuildGeometryInfoKHR> var_local_pInfos;
     vku::safe_VkAccelerationStructureBuildGeometryInfoKHR* local_pInfos = nullptr;
     {
         if (pInfos) {
@@ -9034,7 +9122,7 @@ VkResult Device::WriteAccelerationStructuresPropertiesKHR(VkDevice device, uint3
     if (!wrap_handles)
         return device_dispatch_table.WriteAccelerationStructuresPropertiesKHR(
             device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
-    small_vector<VkAccelerationStructureKHR, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pAccelerationStructures;
+    vvl::ScratchArray<VkAccelerationStructureKHR> var_local_pAccelerationStructures;
     VkAccelerationStructureKHR* local_pAccelerationStructures = nullptr;
     {
         if (pAccelerationStructures) {
@@ -9137,7 +9225,7 @@ void Device::CmdWriteAccelerationStructuresPropertiesKHR(VkCommandBuffer command
     if (!wrap_handles)
         return device_dispatch_table.CmdWriteAccelerationStructuresPropertiesKHR(
             commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
-    small_vector<VkAccelerationStructureKHR, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_pAccelerationStructures;
+    vvl::ScratchArray<VkAccelerationStructureKHR> var_local_pAccelerationStructures;
     VkAccelerationStructureKHR* local_pAccelerationStructures = nullptr;
     {
         if (pAccelerationStructures) {
@@ -9228,6 +9316,630 @@ void Device::CmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer commandBuffer, VkB
     device_dispatch_table.CmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
                                                            maxDrawCount, stride);
 }
+
+PassthroughMode GetPassthroughMode(vvl::Func command) {
+    switch (command) {
+        case vvl::Func::vkGetDeviceProcAddr:
+        case vvl::Func::vkGetDeviceQueue:
+        case vvl::Func::vkQueueWaitIdle:
+        case vvl::Func::vkDeviceWaitIdle:
+        case vvl::Func::vkEndCommandBuffer:
+        case vvl::Func::vkResetCommandBuffer:
+        case vvl::Func::vkCmdSetViewport:
+        case vvl::Func::vkCmdSetScissor:
+        case vvl::Func::vkCmdSetLineWidth:
+        case vvl::Func::vkCmdSetDepthBias:
+        case vvl::Func::vkCmdSetBlendConstants:
+        case vvl::Func::vkCmdSetDepthBounds:
+        case vvl::Func::vkCmdSetStencilCompareMask:
+        case vvl::Func::vkCmdSetStencilWriteMask:
+        case vvl::Func::vkCmdSetStencilReference:
+        case vvl::Func::vkCmdDraw:
+        case vvl::Func::vkCmdDrawIndexed:
+        case vvl::Func::vkCmdDispatch:
+        case vvl::Func::vkCmdClearAttachments:
+        case vvl::Func::vkCmdNextSubpass:
+        case vvl::Func::vkCmdEndRenderPass:
+        case vvl::Func::vkGetDeviceGroupPeerMemoryFeatures:
+        case vvl::Func::vkCmdSetDeviceMask:
+        case vvl::Func::vkCmdDispatchBase:
+        case vvl::Func::vkGetDeviceQueue2:
+        case vvl::Func::vkCmdNextSubpass2:
+        case vvl::Func::vkCmdEndRenderPass2:
+        case vvl::Func::vkCmdEndRendering:
+        case vvl::Func::vkCmdSetFrontFace:
+        case vvl::Func::vkCmdSetPrimitiveTopology:
+        case vvl::Func::vkCmdSetViewportWithCount:
+        case vvl::Func::vkCmdSetScissorWithCount:
+        case vvl::Func::vkCmdSetDepthTestEnable:
+        case vvl::Func::vkCmdSetDepthWriteEnable:
+        case vvl::Func::vkCmdSetDepthCompareOp:
+        case vvl::Func::vkCmdSetDepthBoundsTestEnable:
+        case vvl::Func::vkCmdSetStencilTestEnable:
+        case vvl::Func::vkCmdSetStencilOp:
+        case vvl::Func::vkCmdSetRasterizerDiscardEnable:
+        case vvl::Func::vkCmdSetDepthBiasEnable:
+        case vvl::Func::vkCmdSetPrimitiveRestartEnable:
+        case vvl::Func::vkGetDeviceBufferMemoryRequirements:
+        case vvl::Func::vkGetDeviceImageMemoryRequirements:
+        case vvl::Func::vkGetDeviceImageSparseMemoryRequirements:
+        case vvl::Func::vkCmdSetLineStipple:
+        case vvl::Func::vkGetRenderingAreaGranularity:
+        case vvl::Func::vkGetDeviceImageSubresourceLayout:
+        case vvl::Func::vkCmdSetRenderingAttachmentLocations:
+        case vvl::Func::vkCmdSetRenderingInputAttachmentIndices:
+        case vvl::Func::vkGetDeviceGroupPresentCapabilitiesKHR:
+        case vvl::Func::vkCmdEndVideoCodingKHR:
+        case vvl::Func::vkCmdControlVideoCodingKHR:
+        case vvl::Func::vkCmdEndRenderingKHR:
+        case vvl::Func::vkGetDeviceGroupPeerMemoryFeaturesKHR:
+        case vvl::Func::vkCmdSetDeviceMaskKHR:
+        case vvl::Func::vkCmdDispatchBaseKHR:
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case vvl::Func::vkGetMemoryWin32HandlePropertiesKHR:
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+        case vvl::Func::vkGetMemoryFdPropertiesKHR:
+        case vvl::Func::vkCmdNextSubpass2KHR:
+        case vvl::Func::vkCmdEndRenderPass2KHR:
+        case vvl::Func::vkAcquireProfilingLockKHR:
+        case vvl::Func::vkCmdSetFragmentShadingRateKHR:
+        case vvl::Func::vkCmdSetRenderingAttachmentLocationsKHR:
+        case vvl::Func::vkCmdSetRenderingInputAttachmentIndicesKHR:
+        case vvl::Func::vkCmdTraceRaysIndirect2KHR:
+        case vvl::Func::vkGetDeviceBufferMemoryRequirementsKHR:
+        case vvl::Func::vkGetDeviceImageMemoryRequirementsKHR:
+        case vvl::Func::vkGetDeviceImageSparseMemoryRequirementsKHR:
+        case vvl::Func::vkGetRenderingAreaGranularityKHR:
+        case vvl::Func::vkGetDeviceImageSubresourceLayoutKHR:
+        case vvl::Func::vkCmdSetLineStippleKHR:
+        case vvl::Func::vkGetCalibratedTimestampsKHR:
+        case vvl::Func::vkCmdDebugMarkerBeginEXT:
+        case vvl::Func::vkCmdDebugMarkerEndEXT:
+        case vvl::Func::vkCmdEndConditionalRenderingEXT:
+        case vvl::Func::vkCmdSetViewportWScalingNV:
+        case vvl::Func::vkCmdSetDiscardRectangleEXT:
+        case vvl::Func::vkCmdSetDiscardRectangleEnableEXT:
+        case vvl::Func::vkCmdSetDiscardRectangleModeEXT:
+        case vvl::Func::vkQueueBeginDebugUtilsLabelEXT:
+        case vvl::Func::vkQueueEndDebugUtilsLabelEXT:
+        case vvl::Func::vkCmdBeginDebugUtilsLabelEXT:
+        case vvl::Func::vkCmdEndDebugUtilsLabelEXT:
+        case vvl::Func::vkCmdInsertDebugUtilsLabelEXT:
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case vvl::Func::vkGetAndroidHardwareBufferPropertiesANDROID:
+#endif  // VK_USE_PLATFORM_ANDROID_KHR
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case vvl::Func::vkCmdDispatchGraphAMDX:
+        case vvl::Func::vkCmdDispatchGraphIndirectAMDX:
+        case vvl::Func::vkCmdDispatchGraphIndirectCountAMDX:
+#endif  // VK_ENABLE_BETA_EXTENSIONS
+        case vvl::Func::vkCmdSetSampleLocationsEXT:
+        case vvl::Func::vkCmdSetViewportShadingRatePaletteNV:
+        case vvl::Func::vkCmdSetCoarseSampleOrderNV:
+        case vvl::Func::vkGetMemoryHostPointerPropertiesEXT:
+        case vvl::Func::vkGetCalibratedTimestampsEXT:
+        case vvl::Func::vkCmdDrawMeshTasksNV:
+        case vvl::Func::vkCmdSetExclusiveScissorEnableNV:
+        case vvl::Func::vkCmdSetExclusiveScissorNV:
+        case vvl::Func::vkCmdSetCheckpointNV:
+        case vvl::Func::vkGetQueueCheckpointDataNV:
+        case vvl::Func::vkGetQueueCheckpointData2NV:
+        case vvl::Func::vkInitializePerformanceApiINTEL:
+        case vvl::Func::vkUninitializePerformanceApiINTEL:
+        case vvl::Func::vkCmdSetPerformanceStreamMarkerINTEL:
+        case vvl::Func::vkCmdSetPerformanceOverrideINTEL:
+        case vvl::Func::vkGetPerformanceParameterINTEL:
+        case vvl::Func::vkCmdSetLineStippleEXT:
+        case vvl::Func::vkCmdSetCullModeEXT:
+        case vvl::Func::vkCmdSetFrontFaceEXT:
+        case vvl::Func::vkCmdSetPrimitiveTopologyEXT:
+        case vvl::Func::vkCmdSetViewportWithCountEXT:
+        case vvl::Func::vkCmdSetScissorWithCountEXT:
+        case vvl::Func::vkCmdSetDepthTestEnableEXT:
+        case vvl::Func::vkCmdSetDepthWriteEnableEXT:
+        case vvl::Func::vkCmdSetDepthCompareOpEXT:
+        case vvl::Func::vkCmdSetDepthBoundsTestEnableEXT:
+        case vvl::Func::vkCmdSetStencilTestEnableEXT:
+        case vvl::Func::vkCmdSetStencilOpEXT:
+        case vvl::Func::vkCmdSetDepthBias2EXT:
+        case vvl::Func::vkCmdDispatchTileQCOM:
+        case vvl::Func::vkCmdBeginPerTileExecutionQCOM:
+        case vvl::Func::vkCmdEndPerTileExecutionQCOM:
+        case vvl::Func::vkCmdSetFragmentShadingRateEnumNV:
+        case vvl::Func::vkGetDeviceFaultInfoEXT:
+        case vvl::Func::vkCmdSetVertexInputEXT:
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case vvl::Func::vkGetMemoryZirconHandlePropertiesFUCHSIA:
+#endif  // VK_USE_PLATFORM_FUCHSIA
+        case vvl::Func::vkCmdSubpassShadingHUAWEI:
+        case vvl::Func::vkCmdSetPatchControlPointsEXT:
+        case vvl::Func::vkCmdSetRasterizerDiscardEnableEXT:
+        case vvl::Func::vkCmdSetDepthBiasEnableEXT:
+        case vvl::Func::vkCmdSetLogicOpEXT:
+        case vvl::Func::vkCmdSetPrimitiveRestartEnableEXT:
+        case vvl::Func::vkCmdSetColorWriteEnableEXT:
+        case vvl::Func::vkCmdDrawMultiEXT:
+        case vvl::Func::vkCmdDrawMultiIndexedEXT:
+        case vvl::Func::vkGetDeviceMicromapCompatibilityEXT:
+        case vvl::Func::vkCmdDrawClusterHUAWEI:
+        case vvl::Func::vkCmdCopyMemoryIndirectNV:
+        case vvl::Func::vkCmdDecompressMemoryNV:
+        case vvl::Func::vkCmdDecompressMemoryIndirectCountNV:
+        case vvl::Func::vkCmdSetDepthClampEnableEXT:
+        case vvl::Func::vkCmdSetPolygonModeEXT:
+        case vvl::Func::vkCmdSetRasterizationSamplesEXT:
+        case vvl::Func::vkCmdSetSampleMaskEXT:
+        case vvl::Func::vkCmdSetAlphaToCoverageEnableEXT:
+        case vvl::Func::vkCmdSetAlphaToOneEnableEXT:
+        case vvl::Func::vkCmdSetLogicOpEnableEXT:
+        case vvl::Func::vkCmdSetColorBlendEnableEXT:
+        case vvl::Func::vkCmdSetColorBlendEquationEXT:
+        case vvl::Func::vkCmdSetColorWriteMaskEXT:
+        case vvl::Func::vkCmdSetTessellationDomainOriginEXT:
+        case vvl::Func::vkCmdSetRasterizationStreamEXT:
+        case vvl::Func::vkCmdSetConservativeRasterizationModeEXT:
+        case vvl::Func::vkCmdSetExtraPrimitiveOverestimationSizeEXT:
+        case vvl::Func::vkCmdSetDepthClipEnableEXT:
+        case vvl::Func::vkCmdSetSampleLocationsEnableEXT:
+        case vvl::Func::vkCmdSetColorBlendAdvancedEXT:
+        case vvl::Func::vkCmdSetProvokingVertexModeEXT:
+        case vvl::Func::vkCmdSetLineRasterizationModeEXT:
+        case vvl::Func::vkCmdSetLineStippleEnableEXT:
+        case vvl::Func::vkCmdSetDepthClipNegativeOneToOneEXT:
+        case vvl::Func::vkCmdSetViewportWScalingEnableNV:
+        case vvl::Func::vkCmdSetViewportSwizzleNV:
+        case vvl::Func::vkCmdSetCoverageToColorEnableNV:
+        case vvl::Func::vkCmdSetCoverageToColorLocationNV:
+        case vvl::Func::vkCmdSetCoverageModulationModeNV:
+        case vvl::Func::vkCmdSetCoverageModulationTableEnableNV:
+        case vvl::Func::vkCmdSetCoverageModulationTableNV:
+        case vvl::Func::vkCmdSetShadingRateImageEnableNV:
+        case vvl::Func::vkCmdSetRepresentativeFragmentTestEnableNV:
+        case vvl::Func::vkCmdSetCoverageReductionModeNV:
+        case vvl::Func::vkGetDeviceTensorMemoryRequirementsARM:
+        case vvl::Func::vkAntiLagUpdateAMD:
+        case vvl::Func::vkCmdSetDepthClampRangeEXT:
+        case vvl::Func::vkConvertCooperativeVectorMatrixNV:
+        case vvl::Func::vkCmdConvertCooperativeVectorMatrixNV:
+        case vvl::Func::vkQueueNotifyOutOfBandNV:
+        case vvl::Func::vkCmdSetAttachmentFeedbackLoopEnableEXT:
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+        case vvl::Func::vkGetScreenBufferPropertiesQNX:
+#endif  // VK_USE_PLATFORM_SCREEN_QNX
+        case vvl::Func::vkCreateExternalComputeQueueNV:
+        case vvl::Func::vkDestroyExternalComputeQueueNV:
+        case vvl::Func::vkGetExternalComputeQueueDataNV:
+        case vvl::Func::vkGetClusterAccelerationStructureBuildSizesNV:
+        case vvl::Func::vkCmdBuildClusterAccelerationStructureIndirectNV:
+        case vvl::Func::vkCmdBuildPartitionedAccelerationStructuresNV:
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case vvl::Func::vkGetMemoryMetalHandlePropertiesEXT:
+#endif  // VK_USE_PLATFORM_METAL_EXT
+        case vvl::Func::vkCmdEndRendering2EXT:
+        case vvl::Func::vkGetDeviceAccelerationStructureCompatibilityKHR:
+        case vvl::Func::vkCmdTraceRaysKHR:
+        case vvl::Func::vkCmdTraceRaysIndirectKHR:
+        case vvl::Func::vkCmdSetRayTracingPipelineStackSizeKHR:
+        case vvl::Func::vkCmdDrawMeshTasksEXT:
+            return PassthroughMode::Direct;
+        case vvl::Func::vkQueueSubmit:
+        case vvl::Func::vkAllocateMemory:
+        case vvl::Func::vkFreeMemory:
+        case vvl::Func::vkMapMemory:
+        case vvl::Func::vkUnmapMemory:
+        case vvl::Func::vkFlushMappedMemoryRanges:
+        case vvl::Func::vkInvalidateMappedMemoryRanges:
+        case vvl::Func::vkGetDeviceMemoryCommitment:
+        case vvl::Func::vkBindBufferMemory:
+        case vvl::Func::vkBindImageMemory:
+        case vvl::Func::vkGetBufferMemoryRequirements:
+        case vvl::Func::vkGetImageMemoryRequirements:
+        case vvl::Func::vkGetImageSparseMemoryRequirements:
+        case vvl::Func::vkQueueBindSparse:
+        case vvl::Func::vkCreateFence:
+        case vvl::Func::vkDestroyFence:
+        case vvl::Func::vkResetFences:
+        case vvl::Func::vkGetFenceStatus:
+        case vvl::Func::vkWaitForFences:
+        case vvl::Func::vkCreateSemaphore:
+        case vvl::Func::vkDestroySemaphore:
+        case vvl::Func::vkCreateEvent:
+        case vvl::Func::vkDestroyEvent:
+        case vvl::Func::vkGetEventStatus:
+        case vvl::Func::vkSetEvent:
+        case vvl::Func::vkResetEvent:
+        case vvl::Func::vkCreateQueryPool:
+        case vvl::Func::vkDestroyQueryPool:
+        case vvl::Func::vkGetQueryPoolResults:
+        case vvl::Func::vkCreateBuffer:
+        case vvl::Func::vkDestroyBuffer:
+        case vvl::Func::vkCreateBufferView:
+        case vvl::Func::vkDestroyBufferView:
+        case vvl::Func::vkCreateImage:
+        case vvl::Func::vkDestroyImage:
+        case vvl::Func::vkGetImageSubresourceLayout:
+        case vvl::Func::vkCreateImageView:
+        case vvl::Func::vkDestroyImageView:
+        case vvl::Func::vkCreateShaderModule:
+        case vvl::Func::vkDestroyShaderModule:
+        case vvl::Func::vkCreatePipelineCache:
+        case vvl::Func::vkDestroyPipelineCache:
+        case vvl::Func::vkGetPipelineCacheData:
+        case vvl::Func::vkMergePipelineCaches:
+        case vvl::Func::vkDestroyPipeline:
+        case vvl::Func::vkCreatePipelineLayout:
+        case vvl::Func::vkDestroyPipelineLayout:
+        case vvl::Func::vkCreateSampler:
+        case vvl::Func::vkDestroySampler:
+        case vvl::Func::vkCreateDescriptorSetLayout:
+        case vvl::Func::vkDestroyDescriptorSetLayout:
+        case vvl::Func::vkCreateDescriptorPool:
+        case vvl::Func::vkUpdateDescriptorSets:
+        case vvl::Func::vkCreateFramebuffer:
+        case vvl::Func::vkDestroyFramebuffer:
+        case vvl::Func::vkGetRenderAreaGranularity:
+        case vvl::Func::vkCreateCommandPool:
+        case vvl::Func::vkResetCommandPool:
+        case vvl::Func::vkCmdBindPipeline:
+        case vvl::Func::vkCmdBindDescriptorSets:
+        case vvl::Func::vkCmdBindIndexBuffer:
+        case vvl::Func::vkCmdBindVertexBuffers:
+        case vvl::Func::vkCmdDrawIndirect:
+        case vvl::Func::vkCmdDrawIndexedIndirect:
+        case vvl::Func::vkCmdDispatchIndirect:
+        case vvl::Func::vkCmdCopyBuffer:
+        case vvl::Func::vkCmdCopyImage:
+        case vvl::Func::vkCmdBlitImage:
+        case vvl::Func::vkCmdCopyBufferToImage:
+        case vvl::Func::vkCmdCopyImageToBuffer:
+        case vvl::Func::vkCmdUpdateBuffer:
+        case vvl::Func::vkCmdFillBuffer:
+        case vvl::Func::vkCmdClearColorImage:
+        case vvl::Func::vkCmdClearDepthStencilImage:
+        case vvl::Func::vkCmdResolveImage:
+        case vvl::Func::vkCmdSetEvent:
+        case vvl::Func::vkCmdResetEvent:
+        case vvl::Func::vkCmdWaitEvents:
+        case vvl::Func::vkCmdPipelineBarrier:
+        case vvl::Func::vkCmdBeginQuery:
+        case vvl::Func::vkCmdEndQuery:
+        case vvl::Func::vkCmdResetQueryPool:
+        case vvl::Func::vkCmdWriteTimestamp:
+        case vvl::Func::vkCmdCopyQueryPoolResults:
+        case vvl::Func::vkCmdPushConstants:
+        case vvl::Func::vkCmdBeginRenderPass:
+        case vvl::Func::vkGetImageMemoryRequirements2:
+        case vvl::Func::vkGetBufferMemoryRequirements2:
+        case vvl::Func::vkGetImageSparseMemoryRequirements2:
+        case vvl::Func::vkTrimCommandPool:
+        case vvl::Func::vkCreateSamplerYcbcrConversion:
+        case vvl::Func::vkDestroySamplerYcbcrConversion:
+        case vvl::Func::vkGetDescriptorSetLayoutSupport:
+        case vvl::Func::vkCmdDrawIndirectCount:
+        case vvl::Func::vkCmdDrawIndexedIndirectCount:
+        case vvl::Func::vkCmdBeginRenderPass2:
+        case vvl::Func::vkResetQueryPool:
+        case vvl::Func::vkGetSemaphoreCounterValue:
+        case vvl::Func::vkWaitSemaphores:
+        case vvl::Func::vkSignalSemaphore:
+        case vvl::Func::vkGetBufferDeviceAddress:
+        case vvl::Func::vkGetBufferOpaqueCaptureAddress:
+        case vvl::Func::vkGetDeviceMemoryOpaqueCaptureAddress:
+        case vvl::Func::vkCreatePrivateDataSlot:
+        case vvl::Func::vkDestroyPrivateDataSlot:
+        case vvl::Func::vkSetPrivateData:
+        case vvl::Func::vkGetPrivateData:
+        case vvl::Func::vkCmdSetEvent2:
+        case vvl::Func::vkCmdResetEvent2:
+        case vvl::Func::vkCmdWaitEvents2:
+        case vvl::Func::vkCmdPipelineBarrier2:
+        case vvl::Func::vkCmdWriteTimestamp2:
+        case vvl::Func::vkQueueSubmit2:
+        case vvl::Func::vkCmdCopyBuffer2:
+        case vvl::Func::vkCmdCopyImage2:
+        case vvl::Func::vkCmdCopyBufferToImage2:
+        case vvl::Func::vkCmdCopyImageToBuffer2:
+        case vvl::Func::vkCmdBlitImage2:
+        case vvl::Func::vkCmdResolveImage2:
+        case vvl::Func::vkCmdBeginRendering:
+        case vvl::Func::vkCmdBindVertexBuffers2:
+        case vvl::Func::vkMapMemory2:
+        case vvl::Func::vkUnmapMemory2:
+        case vvl::Func::vkCmdBindIndexBuffer2:
+        case vvl::Func::vkGetImageSubresourceLayout2:
+        case vvl::Func::vkCmdPushDescriptorSet:
+        case vvl::Func::vkCmdBindDescriptorSets2:
+        case vvl::Func::vkCmdPushConstants2:
+        case vvl::Func::vkCmdPushDescriptorSet2:
+        case vvl::Func::vkCopyMemoryToImage:
+        case vvl::Func::vkCopyImageToMemory:
+        case vvl::Func::vkCopyImageToImage:
+        case vvl::Func::vkTransitionImageLayout:
+        case vvl::Func::vkCreateSwapchainKHR:
+        case vvl::Func::vkAcquireNextImageKHR:
+        case vvl::Func::vkGetDeviceGroupSurfacePresentModesKHR:
+        case vvl::Func::vkAcquireNextImage2KHR:
+        case vvl::Func::vkCreateSharedSwapchainsKHR:
+        case vvl::Func::vkCreateVideoSessionKHR:
+        case vvl::Func::vkDestroyVideoSessionKHR:
+        case vvl::Func::vkGetVideoSessionMemoryRequirementsKHR:
+        case vvl::Func::vkBindVideoSessionMemoryKHR:
+        case vvl::Func::vkCreateVideoSessionParametersKHR:
+        case vvl::Func::vkUpdateVideoSessionParametersKHR:
+        case vvl::Func::vkDestroyVideoSessionParametersKHR:
+        case vvl::Func::vkCmdBeginVideoCodingKHR:
+        case vvl::Func::vkCmdDecodeVideoKHR:
+        case vvl::Func::vkCmdBeginRenderingKHR:
+        case vvl::Func::vkTrimCommandPoolKHR:
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case vvl::Func::vkGetMemoryWin32HandleKHR:
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+        case vvl::Func::vkGetMemoryFdKHR:
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case vvl::Func::vkImportSemaphoreWin32HandleKHR:
+        case vvl::Func::vkGetSemaphoreWin32HandleKHR:
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+        case vvl::Func::vkImportSemaphoreFdKHR:
+        case vvl::Func::vkGetSemaphoreFdKHR:
+        case vvl::Func::vkCmdPushDescriptorSetKHR:
+        case vvl::Func::vkCmdBeginRenderPass2KHR:
+        case vvl::Func::vkGetSwapchainStatusKHR:
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case vvl::Func::vkImportFenceWin32HandleKHR:
+        case vvl::Func::vkGetFenceWin32HandleKHR:
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+        case vvl::Func::vkImportFenceFdKHR:
+        case vvl::Func::vkGetFenceFdKHR:
+        case vvl::Func::vkReleaseProfilingLockKHR:
+        case vvl::Func::vkGetImageMemoryRequirements2KHR:
+        case vvl::Func::vkGetBufferMemoryRequirements2KHR:
+        case vvl::Func::vkGetImageSparseMemoryRequirements2KHR:
+        case vvl::Func::vkCreateSamplerYcbcrConversionKHR:
+        case vvl::Func::vkDestroySamplerYcbcrConversionKHR:
+        case vvl::Func::vkGetDescriptorSetLayoutSupportKHR:
+        case vvl::Func::vkCmdDrawIndirectCountKHR:
+        case vvl::Func::vkCmdDrawIndexedIndirectCountKHR:
+        case vvl::Func::vkGetSemaphoreCounterValueKHR:
+        case vvl::Func::vkWaitSemaphoresKHR:
+        case vvl::Func::vkSignalSemaphoreKHR:
+        case vvl::Func::vkWaitForPresentKHR:
+        case vvl::Func::vkGetBufferDeviceAddressKHR:
+        case vvl::Func::vkGetBufferOpaqueCaptureAddressKHR:
+        case vvl::Func::vkGetDeviceMemoryOpaqueCaptureAddressKHR:
+        case vvl::Func::vkCreateDeferredOperationKHR:
+        case vvl::Func::vkDestroyDeferredOperationKHR:
+        case vvl::Func::vkGetDeferredOperationMaxConcurrencyKHR:
+        case vvl::Func::vkGetPipelineExecutablePropertiesKHR:
+        case vvl::Func::vkGetPipelineExecutableStatisticsKHR:
+        case vvl::Func::vkMapMemory2KHR:
+        case vvl::Func::vkUnmapMemory2KHR:
+        case vvl::Func::vkGetEncodedVideoSessionParametersKHR:
+        case vvl::Func::vkCmdEncodeVideoKHR:
+        case vvl::Func::vkCmdSetEvent2KHR:
+        case vvl::Func::vkCmdResetEvent2KHR:
+        case vvl::Func::vkCmdWaitEvents2KHR:
+        case vvl::Func::vkCmdPipelineBarrier2KHR:
+        case vvl::Func::vkCmdWriteTimestamp2KHR:
+        case vvl::Func::vkQueueSubmit2KHR:
+        case vvl::Func::vkCmdCopyBuffer2KHR:
+        case vvl::Func::vkCmdCopyImage2KHR:
+        case vvl::Func::vkCmdCopyBufferToImage2KHR:
+        case vvl::Func::vkCmdCopyImageToBuffer2KHR:
+        case vvl::Func::vkCmdBlitImage2KHR:
+        case vvl::Func::vkCmdResolveImage2KHR:
+        case vvl::Func::vkCmdBindIndexBuffer2KHR:
+        case vvl::Func::vkGetImageSubresourceLayout2KHR:
+        case vvl::Func::vkWaitForPresent2KHR:
+        case vvl::Func::vkDestroyPipelineBinaryKHR:
+        case vvl::Func::vkGetPipelineBinaryDataKHR:
+        case vvl::Func::vkReleaseCapturedPipelineDataKHR:
+        case vvl::Func::vkReleaseSwapchainImagesKHR:
+        case vvl::Func::vkCmdBindDescriptorSets2KHR:
+        case vvl::Func::vkCmdPushConstants2KHR:
+        case vvl::Func::vkCmdPushDescriptorSet2KHR:
+        case vvl::Func::vkCmdSetDescriptorBufferOffsets2EXT:
+        case vvl::Func::vkCmdBindDescriptorBufferEmbeddedSamplers2EXT:
+        case vvl::Func::vkCmdBindTransformFeedbackBuffersEXT:
+        case vvl::Func::vkCmdBeginTransformFeedbackEXT:
+        case vvl::Func::vkCmdEndTransformFeedbackEXT:
+        case vvl::Func::vkCmdBeginQueryIndexedEXT:
+        case vvl::Func::vkCmdEndQueryIndexedEXT:
+        case vvl::Func::vkCmdDrawIndirectByteCountEXT:
+        case vvl::Func::vkCreateCuModuleNVX:
+        case vvl::Func::vkCreateCuFunctionNVX:
+        case vvl::Func::vkDestroyCuModuleNVX:
+        case vvl::Func::vkDestroyCuFunctionNVX:
+        case vvl::Func::vkCmdCuLaunchKernelNVX:
+        case vvl::Func::vkGetImageViewHandleNVX:
+        case vvl::Func::vkGetImageViewHandle64NVX:
+        case vvl::Func::vkGetImageViewAddressNVX:
+        case vvl::Func::vkCmdDrawIndirectCountAMD:
+        case vvl::Func::vkCmdDrawIndexedIndirectCountAMD:
+        case vvl::Func::vkGetShaderInfoAMD:
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case vvl::Func::vkGetMemoryWin32HandleNV:
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+        case vvl::Func::vkCmdBeginConditionalRenderingEXT:
+        case vvl::Func::vkDisplayPowerControlEXT:
+        case vvl::Func::vkRegisterDeviceEventEXT:
+        case vvl::Func::vkRegisterDisplayEventEXT:
+        case vvl::Func::vkGetSwapchainCounterEXT:
+        case vvl::Func::vkGetRefreshCycleDurationGOOGLE:
+        case vvl::Func::vkGetPastPresentationTimingGOOGLE:
+        case vvl::Func::vkSetHdrMetadataEXT:
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case vvl::Func::vkGetMemoryAndroidHardwareBufferANDROID:
+#endif  // VK_USE_PLATFORM_ANDROID_KHR
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case vvl::Func::vkCreateExecutionGraphPipelinesAMDX:
+        case vvl::Func::vkGetExecutionGraphPipelineScratchSizeAMDX:
+        case vvl::Func::vkGetExecutionGraphPipelineNodeIndexAMDX:
+        case vvl::Func::vkCmdInitializeGraphScratchMemoryAMDX:
+#endif  // VK_ENABLE_BETA_EXTENSIONS
+        case vvl::Func::vkGetImageDrmFormatModifierPropertiesEXT:
+        case vvl::Func::vkCreateValidationCacheEXT:
+        case vvl::Func::vkDestroyValidationCacheEXT:
+        case vvl::Func::vkMergeValidationCachesEXT:
+        case vvl::Func::vkGetValidationCacheDataEXT:
+        case vvl::Func::vkCmdBindShadingRateImageNV:
+        case vvl::Func::vkCreateAccelerationStructureNV:
+        case vvl::Func::vkDestroyAccelerationStructureNV:
+        case vvl::Func::vkGetAccelerationStructureMemoryRequirementsNV:
+        case vvl::Func::vkBindAccelerationStructureMemoryNV:
+        case vvl::Func::vkCmdBuildAccelerationStructureNV:
+        case vvl::Func::vkCmdCopyAccelerationStructureNV:
+        case vvl::Func::vkCmdTraceRaysNV:
+        case vvl::Func::vkGetRayTracingShaderGroupHandlesKHR:
+        case vvl::Func::vkGetRayTracingShaderGroupHandlesNV:
+        case vvl::Func::vkGetAccelerationStructureHandleNV:
+        case vvl::Func::vkCmdWriteAccelerationStructuresPropertiesNV:
+        case vvl::Func::vkCompileDeferredNV:
+        case vvl::Func::vkCmdWriteBufferMarkerAMD:
+        case vvl::Func::vkCmdWriteBufferMarker2AMD:
+        case vvl::Func::vkCmdDrawMeshTasksIndirectNV:
+        case vvl::Func::vkCmdDrawMeshTasksIndirectCountNV:
+        case vvl::Func::vkAcquirePerformanceConfigurationINTEL:
+        case vvl::Func::vkQueueSetPerformanceConfigurationINTEL:
+        case vvl::Func::vkSetLocalDimmingAMD:
+        case vvl::Func::vkGetBufferDeviceAddressEXT:
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case vvl::Func::vkAcquireFullScreenExclusiveModeEXT:
+        case vvl::Func::vkReleaseFullScreenExclusiveModeEXT:
+        case vvl::Func::vkGetDeviceGroupSurfacePresentModes2EXT:
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+        case vvl::Func::vkResetQueryPoolEXT:
+        case vvl::Func::vkCmdBindVertexBuffers2EXT:
+        case vvl::Func::vkCopyMemoryToImageEXT:
+        case vvl::Func::vkCopyImageToMemoryEXT:
+        case vvl::Func::vkCopyImageToImageEXT:
+        case vvl::Func::vkTransitionImageLayoutEXT:
+        case vvl::Func::vkGetImageSubresourceLayout2EXT:
+        case vvl::Func::vkReleaseSwapchainImagesEXT:
+        case vvl::Func::vkGetGeneratedCommandsMemoryRequirementsNV:
+        case vvl::Func::vkCmdPreprocessGeneratedCommandsNV:
+        case vvl::Func::vkCmdExecuteGeneratedCommandsNV:
+        case vvl::Func::vkCmdBindPipelineShaderGroupNV:
+        case vvl::Func::vkCreateIndirectCommandsLayoutNV:
+        case vvl::Func::vkDestroyIndirectCommandsLayoutNV:
+        case vvl::Func::vkCreatePrivateDataSlotEXT:
+        case vvl::Func::vkDestroyPrivateDataSlotEXT:
+        case vvl::Func::vkSetPrivateDataEXT:
+        case vvl::Func::vkGetPrivateDataEXT:
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case vvl::Func::vkCreateCudaModuleNV:
+        case vvl::Func::vkGetCudaModuleCacheNV:
+        case vvl::Func::vkCreateCudaFunctionNV:
+        case vvl::Func::vkDestroyCudaModuleNV:
+        case vvl::Func::vkDestroyCudaFunctionNV:
+        case vvl::Func::vkCmdCudaLaunchKernelNV:
+#endif  // VK_ENABLE_BETA_EXTENSIONS
+        case vvl::Func::vkGetDescriptorSetLayoutSizeEXT:
+        case vvl::Func::vkGetDescriptorSetLayoutBindingOffsetEXT:
+        case vvl::Func::vkCmdBindDescriptorBuffersEXT:
+        case vvl::Func::vkCmdSetDescriptorBufferOffsetsEXT:
+        case vvl::Func::vkCmdBindDescriptorBufferEmbeddedSamplersEXT:
+        case vvl::Func::vkGetBufferOpaqueCaptureDescriptorDataEXT:
+        case vvl::Func::vkGetImageOpaqueCaptureDescriptorDataEXT:
+        case vvl::Func::vkGetImageViewOpaqueCaptureDescriptorDataEXT:
+        case vvl::Func::vkGetSamplerOpaqueCaptureDescriptorDataEXT:
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case vvl::Func::vkGetMemoryZirconHandleFUCHSIA:
+        case vvl::Func::vkImportSemaphoreZirconHandleFUCHSIA:
+        case vvl::Func::vkGetSemaphoreZirconHandleFUCHSIA:
+        case vvl::Func::vkCreateBufferCollectionFUCHSIA:
+        case vvl::Func::vkSetBufferCollectionImageConstraintsFUCHSIA:
+        case vvl::Func::vkSetBufferCollectionBufferConstraintsFUCHSIA:
+        case vvl::Func::vkDestroyBufferCollectionFUCHSIA:
+        case vvl::Func::vkGetBufferCollectionPropertiesFUCHSIA:
+#endif  // VK_USE_PLATFORM_FUCHSIA
+        case vvl::Func::vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI:
+        case vvl::Func::vkCmdBindInvocationMaskHUAWEI:
+        case vvl::Func::vkGetMemoryRemoteAddressNV:
+        case vvl::Func::vkGetPipelinePropertiesEXT:
+        case vvl::Func::vkCreateMicromapEXT:
+        case vvl::Func::vkDestroyMicromapEXT:
+        case vvl::Func::vkCmdBuildMicromapsEXT:
+        case vvl::Func::vkBuildMicromapsEXT:
+        case vvl::Func::vkCopyMicromapEXT:
+        case vvl::Func::vkCopyMicromapToMemoryEXT:
+        case vvl::Func::vkCopyMemoryToMicromapEXT:
+        case vvl::Func::vkWriteMicromapsPropertiesEXT:
+        case vvl::Func::vkCmdCopyMicromapEXT:
+        case vvl::Func::vkCmdCopyMicromapToMemoryEXT:
+        case vvl::Func::vkCmdCopyMemoryToMicromapEXT:
+        case vvl::Func::vkCmdWriteMicromapsPropertiesEXT:
+        case vvl::Func::vkGetMicromapBuildSizesEXT:
+        case vvl::Func::vkCmdDrawClusterIndirectHUAWEI:
+        case vvl::Func::vkSetDeviceMemoryPriorityEXT:
+        case vvl::Func::vkGetDescriptorSetLayoutHostMappingInfoVALVE:
+        case vvl::Func::vkGetDescriptorSetHostMappingVALVE:
+        case vvl::Func::vkCmdCopyMemoryToImageIndirectNV:
+        case vvl::Func::vkGetPipelineIndirectMemoryRequirementsNV:
+        case vvl::Func::vkCmdUpdatePipelineIndirectBufferNV:
+        case vvl::Func::vkGetPipelineIndirectDeviceAddressNV:
+        case vvl::Func::vkCreateTensorARM:
+        case vvl::Func::vkDestroyTensorARM:
+        case vvl::Func::vkCreateTensorViewARM:
+        case vvl::Func::vkDestroyTensorViewARM:
+        case vvl::Func::vkGetTensorMemoryRequirementsARM:
+        case vvl::Func::vkBindTensorMemoryARM:
+        case vvl::Func::vkCmdCopyTensorARM:
+        case vvl::Func::vkGetTensorOpaqueCaptureDescriptorDataARM:
+        case vvl::Func::vkGetTensorViewOpaqueCaptureDescriptorDataARM:
+        case vvl::Func::vkGetShaderModuleIdentifierEXT:
+        case vvl::Func::vkGetShaderModuleCreateInfoIdentifierEXT:
+        case vvl::Func::vkCreateOpticalFlowSessionNV:
+        case vvl::Func::vkDestroyOpticalFlowSessionNV:
+        case vvl::Func::vkBindOpticalFlowSessionImageNV:
+        case vvl::Func::vkCmdOpticalFlowExecuteNV:
+        case vvl::Func::vkDestroyShaderEXT:
+        case vvl::Func::vkGetShaderBinaryDataEXT:
+        case vvl::Func::vkCmdBindShadersEXT:
+        case vvl::Func::vkGetFramebufferTilePropertiesQCOM:
+        case vvl::Func::vkGetDynamicRenderingTilePropertiesQCOM:
+        case vvl::Func::vkSetLatencySleepModeNV:
+        case vvl::Func::vkLatencySleepNV:
+        case vvl::Func::vkSetLatencyMarkerNV:
+        case vvl::Func::vkGetLatencyTimingsNV:
+        case vvl::Func::vkCreateDataGraphPipelinesARM:
+        case vvl::Func::vkCreateDataGraphPipelineSessionARM:
+        case vvl::Func::vkBindDataGraphPipelineSessionMemoryARM:
+        case vvl::Func::vkDestroyDataGraphPipelineSessionARM:
+        case vvl::Func::vkCmdDispatchDataGraphARM:
+        case vvl::Func::vkGetDataGraphPipelineAvailablePropertiesARM:
+        case vvl::Func::vkGetDataGraphPipelinePropertiesARM:
+        case vvl::Func::vkCmdBindTileMemoryQCOM:
+        case vvl::Func::vkGetGeneratedCommandsMemoryRequirementsEXT:
+        case vvl::Func::vkCmdPreprocessGeneratedCommandsEXT:
+        case vvl::Func::vkCmdExecuteGeneratedCommandsEXT:
+        case vvl::Func::vkCreateIndirectCommandsLayoutEXT:
+        case vvl::Func::vkDestroyIndirectCommandsLayoutEXT:
+        case vvl::Func::vkDestroyIndirectExecutionSetEXT:
+        case vvl::Func::vkUpdateIndirectExecutionSetPipelineEXT:
+        case vvl::Func::vkUpdateIndirectExecutionSetShaderEXT:
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case vvl::Func::vkGetMemoryMetalHandleEXT:
+#endif  // VK_USE_PLATFORM_METAL_EXT
+        case vvl::Func::vkCreateAccelerationStructureKHR:
+        case vvl::Func::vkDestroyAccelerationStructureKHR:
+        case vvl::Func::vkCmdBuildAccelerationStructuresIndirectKHR:
+        case vvl::Func::vkCopyAccelerationStructureKHR:
+        case vvl::Func::vkCopyAccelerationStructureToMemoryKHR:
+        case vvl::Func::vkCopyMemoryToAccelerationStructureKHR:
+        case vvl::Func::vkWriteAccelerationStructuresPropertiesKHR:
+        case vvl::Func::vkCmdCopyAccelerationStructureKHR:
+        case vvl::Func::vkCmdCopyAccelerationStructureToMemoryKHR:
+        case vvl::Func::vkCmdCopyMemoryToAccelerationStructureKHR:
+        case vvl::Func::vkGetAccelerationStructureDeviceAddressKHR:
+        case vvl::Func::vkCmdWriteAccelerationStructuresPropertiesKHR:
+        case vvl::Func::vkGetRayTracingShaderGroupStackSizeKHR:
+        case vvl::Func::vkCmdDrawMeshTasksIndirectEXT:
+        case vvl::Func::vkCmdDrawMeshTasksIndirectCountEXT:
+            return PassthroughMode::Unwrap;
+        default:
+            return PassthroughMode::Trampoline;
+    }
+}
 }  // namespace dispatch
 }  // namespace vvl
 
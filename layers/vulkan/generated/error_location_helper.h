@@ -789,6 +789,7 @@ enum class Func {
     vkWriteAccelerationStructuresPropertiesKHR,
     vkWriteMicromapsPropertiesEXT,
 };
+constexpr size_t kFuncCount = static_cast<size_t>(Func::vkWriteMicromapsPropertiesEXT) + 1;
 
 enum class Struct {
     Empty = 0,
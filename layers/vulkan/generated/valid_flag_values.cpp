@@ -30,10 +30,21 @@
 //    - if zero is valid value or not
 //    - if the value is even found in the API
 // so the this file is only focused on checking for extensions being supported
+//
+// Most values only use bits that need no extension, so when a bitmask has several extension groups, all of their
+// bits are first tested together
 
 vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitmask, VkFlags value) const {
     switch (flag_bitmask) {
         case vvl::FlagBitmask::VkAccessFlagBits:
+            if ((value & (VK_ACCESS_NONE | VK_ACCESS_TRANSFORM_FEEDBACK_WRITE_BIT_EXT |
+                          VK_ACCESS_TRANSFORM_FEEDBACK_COUNTER_READ_BIT_EXT | VK_ACCESS_TRANSFORM_FEEDBACK_COUNTER_WRITE_BIT_EXT |
+                          VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT | VK_ACCESS_COLOR_ATTACHMENT_READ_NONCOHERENT_BIT_EXT |
+                          VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR | VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR |
+                          VK_ACCESS_FRAGMENT_DENSITY_MAP_READ_BIT_EXT | VK_ACCESS_FRAGMENT_SHADING_RATE_ATTACHMENT_READ_BIT_KHR |
+                          VK_ACCESS_COMMAND_PREPROCESS_READ_BIT_EXT | VK_ACCESS_COMMAND_PREPROCESS_WRITE_BIT_EXT)) == 0) {
+                return {};
+            }
             if (value & (VK_ACCESS_NONE)) {
                 if (!IsExtEnabled(extensions.vk_khr_synchronization2)) {
                     return {vvl::Extension::_VK_KHR_synchronization2};
@@ -78,6 +89,11 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkImageAspectFlagBits:
+            if ((value & (VK_IMAGE_ASPECT_PLANE_0_BIT | VK_IMAGE_ASPECT_PLANE_1_BIT | VK_IMAGE_ASPECT_PLANE_2_BIT |
+                          VK_IMAGE_ASPECT_NONE | VK_IMAGE_ASPECT_MEMORY_PLANE_0_BIT_EXT | VK_IMAGE_ASPECT_MEMORY_PLANE_1_BIT_EXT |
+                          VK_IMAGE_ASPECT_MEMORY_PLANE_2_BIT_EXT | VK_IMAGE_ASPECT_MEMORY_PLANE_3_BIT_EXT)) == 0) {
+                return {};
+            }
             if (value & (VK_IMAGE_ASPECT_PLANE_0_BIT | VK_IMAGE_ASPECT_PLANE_1_BIT | VK_IMAGE_ASPECT_PLANE_2_BIT)) {
                 if (!IsExtEnabled(extensions.vk_khr_sampler_ycbcr_conversion)) {
                     return {vvl::Extension::_VK_KHR_sampler_ycbcr_conversion};
@@ -96,6 +112,21 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkFormatFeatureFlagBits:
+            if ((value & (VK_FORMAT_FEATURE_TRANSFER_SRC_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT |
+                          VK_FORMAT_FEATURE_MIDPOINT_CHROMA_SAMPLES_BIT |
+                          VK_FORMAT_FEATURE_SAMPLED_IMAGE_YCBCR_CONVERSION_LINEAR_FILTER_BIT |
+                          VK_FORMAT_FEATURE_SAMPLED_IMAGE_YCBCR_CONVERSION_SEPARATE_RECONSTRUCTION_FILTER_BIT |
+                          VK_FORMAT_FEATURE_SAMPLED_IMAGE_YCBCR_CONVERSION_CHROMA_RECONSTRUCTION_EXPLICIT_BIT |
+                          VK_FORMAT_FEATURE_SAMPLED_IMAGE_YCBCR_CONVERSION_CHROMA_RECONSTRUCTION_EXPLICIT_FORCEABLE_BIT |
+                          VK_FORMAT_FEATURE_DISJOINT_BIT | VK_FORMAT_FEATURE_COSITED_CHROMA_SAMPLES_BIT |
+                          VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_MINMAX_BIT | VK_FORMAT_FEATURE_VIDEO_DECODE_OUTPUT_BIT_KHR |
+                          VK_FORMAT_FEATURE_VIDEO_DECODE_DPB_BIT_KHR |
+                          VK_FORMAT_FEATURE_ACCELERATION_STRUCTURE_VERTEX_BUFFER_BIT_KHR |
+                          VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_CUBIC_BIT_EXT | VK_FORMAT_FEATURE_FRAGMENT_DENSITY_MAP_BIT_EXT |
+                          VK_FORMAT_FEATURE_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR |
+                          VK_FORMAT_FEATURE_VIDEO_ENCODE_INPUT_BIT_KHR | VK_FORMAT_FEATURE_VIDEO_ENCODE_DPB_BIT_KHR)) == 0) {
+                return {};
+            }
             if (value & (VK_FORMAT_FEATURE_TRANSFER_SRC_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT)) {
                 if (!IsExtEnabled(extensions.vk_khr_maintenance1)) {
                     return {vvl::Extension::_VK_KHR_maintenance1};
@@ -148,6 +179,16 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkImageCreateFlagBits:
+            if ((value & (VK_IMAGE_CREATE_ALIAS_BIT | VK_IMAGE_CREATE_SPLIT_INSTANCE_BIND_REGIONS_BIT |
+                          VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT | VK_IMAGE_CREATE_BLOCK_TEXEL_VIEW_COMPATIBLE_BIT |
+                          VK_IMAGE_CREATE_EXTENDED_USAGE_BIT | VK_IMAGE_CREATE_DISJOINT_BIT |
+                          VK_IMAGE_CREATE_CORNER_SAMPLED_BIT_NV | VK_IMAGE_CREATE_SAMPLE_LOCATIONS_COMPATIBLE_DEPTH_BIT_EXT |
+                          VK_IMAGE_CREATE_SUBSAMPLED_BIT_EXT | VK_IMAGE_CREATE_DESCRIPTOR_BUFFER_CAPTURE_REPLAY_BIT_EXT |
+                          VK_IMAGE_CREATE_MULTISAMPLED_RENDER_TO_SINGLE_SAMPLED_BIT_EXT |
+                          VK_IMAGE_CREATE_2D_VIEW_COMPATIBLE_BIT_EXT | VK_IMAGE_CREATE_VIDEO_PROFILE_INDEPENDENT_BIT_KHR |
+                          VK_IMAGE_CREATE_FRAGMENT_DENSITY_MAP_OFFSET_BIT_EXT)) == 0) {
+                return {};
+            }
             if (value & (VK_IMAGE_CREATE_ALIAS_BIT)) {
                 if (!IsExtEnabled(extensions.vk_khr_bind_memory2)) {
                     return {vvl::Extension::_VK_KHR_bind_memory2};
@@ -217,6 +258,16 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkImageUsageFlagBits:
+            if ((value & (VK_IMAGE_USAGE_HOST_TRANSFER_BIT | VK_IMAGE_USAGE_VIDEO_DECODE_DST_BIT_KHR |
+                          VK_IMAGE_USAGE_VIDEO_DECODE_SRC_BIT_KHR | VK_IMAGE_USAGE_VIDEO_DECODE_DPB_BIT_KHR |
+                          VK_IMAGE_USAGE_FRAGMENT_DENSITY_MAP_BIT_EXT | VK_IMAGE_USAGE_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR |
+                          VK_IMAGE_USAGE_VIDEO_ENCODE_DST_BIT_KHR | VK_IMAGE_USAGE_VIDEO_ENCODE_SRC_BIT_KHR |
+                          VK_IMAGE_USAGE_VIDEO_ENCODE_DPB_BIT_KHR | VK_IMAGE_USAGE_ATTACHMENT_FEEDBACK_LOOP_BIT_EXT |
+                          VK_IMAGE_USAGE_INVOCATION_MASK_BIT_HUAWEI | VK_IMAGE_USAGE_SAMPLE_WEIGHT_BIT_QCOM |
+                          VK_IMAGE_USAGE_SAMPLE_BLOCK_MATCH_BIT_QCOM | VK_IMAGE_USAGE_TENSOR_ALIASING_BIT_ARM |
+                          VK_IMAGE_USAGE_TILE_MEMORY_BIT_QCOM)) == 0) {
+                return {};
+            }
             if (value & (VK_IMAGE_USAGE_HOST_TRANSFER_BIT)) {
                 if (!IsExtEnabled(extensions.vk_ext_host_image_copy)) {
                     return {vvl::Extension::_VK_EXT_host_image_copy};
@@ -277,6 +328,13 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkPipelineStageFlagBits:
+            if ((value & (VK_PIPELINE_STAGE_NONE | VK_PIPELINE_STAGE_TRANSFORM_FEEDBACK_BIT_EXT |
+                          VK_PIPELINE_STAGE_CONDITIONAL_RENDERING_BIT_EXT | VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR |
+                          VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR | VK_PIPELINE_STAGE_FRAGMENT_DENSITY_PROCESS_BIT_EXT |
+                          VK_PIPELINE_STAGE_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR | VK_PIPELINE_STAGE_TASK_SHADER_BIT_EXT |
+                          VK_PIPELINE_STAGE_MESH_SHADER_BIT_EXT | VK_PIPELINE_STAGE_COMMAND_PREPROCESS_BIT_EXT)) == 0) {
+                return {};
+            }
             if (value & (VK_PIPELINE_STAGE_NONE)) {
                 if (!IsExtEnabled(extensions.vk_khr_synchronization2)) {
                     return {vvl::Extension::_VK_KHR_synchronization2};
@@ -339,6 +397,11 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkQueryPipelineStatisticFlagBits:
+            if ((value & (VK_QUERY_PIPELINE_STATISTIC_TASK_SHADER_INVOCATIONS_BIT_EXT |
+                          VK_QUERY_PIPELINE_STATISTIC_MESH_SHADER_INVOCATIONS_BIT_EXT |
+                          VK_QUERY_PIPELINE_STATISTIC_CLUSTER_CULLING_SHADER_INVOCATIONS_BIT_HUAWEI)) == 0) {
+                return {};
+            }
             if (value & (VK_QUERY_PIPELINE_STATISTIC_TASK_SHADER_INVOCATIONS_BIT_EXT |
                          VK_QUERY_PIPELINE_STATISTIC_MESH_SHADER_INVOCATIONS_BIT_EXT)) {
                 if (!IsExtEnabled(extensions.vk_ext_mesh_shader)) {
@@ -366,6 +429,11 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkBufferCreateFlagBits:
+            if ((value & (VK_BUFFER_CREATE_DEVICE_ADDRESS_CAPTURE_REPLAY_BIT |
+                          VK_BUFFER_CREATE_DESCRIPTOR_BUFFER_CAPTURE_REPLAY_BIT_EXT |
+                          VK_BUFFER_CREATE_VIDEO_PROFILE_INDEPENDENT_BIT_KHR)) == 0) {
+                return {};
+            }
             if (value & (VK_BUFFER_CREATE_DEVICE_ADDRESS_CAPTURE_REPLAY_BIT)) {
                 if (!IsExtEnabled(extensions.vk_khr_buffer_device_address) &&
                     !IsExtEnabled(extensions.vk_ext_buffer_device_address)) {
@@ -384,6 +452,18 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkBufferUsageFlagBits:
+            if ((value & (VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_VIDEO_DECODE_SRC_BIT_KHR |
+                          VK_BUFFER_USAGE_VIDEO_DECODE_DST_BIT_KHR | VK_BUFFER_USAGE_CONDITIONAL_RENDERING_BIT_EXT |
+                          VK_BUFFER_USAGE_EXECUTION_GRAPH_SCRATCH_BIT_AMDX |
+                          VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR |
+                          VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_SHADER_BINDING_TABLE_BIT_KHR |
+                          VK_BUFFER_USAGE_VIDEO_ENCODE_DST_BIT_KHR | VK_BUFFER_USAGE_VIDEO_ENCODE_SRC_BIT_KHR |
+                          VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+                          VK_BUFFER_USAGE_PUSH_DESCRIPTORS_DESCRIPTOR_BUFFER_BIT_EXT |
+                          VK_BUFFER_USAGE_MICROMAP_BUILD_INPUT_READ_ONLY_BIT_EXT | VK_BUFFER_USAGE_MICROMAP_STORAGE_BIT_EXT |
+                          VK_BUFFER_USAGE_TILE_MEMORY_BIT_QCOM)) == 0) {
+                return {};
+            }
             if (value & (VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)) {
                 if (!IsExtEnabled(extensions.vk_khr_buffer_device_address) &&
                     !IsExtEnabled(extensions.vk_ext_buffer_device_address)) {
@@ -445,6 +525,11 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkImageViewCreateFlagBits:
+            if ((value & (VK_IMAGE_VIEW_CREATE_FRAGMENT_DENSITY_MAP_DYNAMIC_BIT_EXT |
+                          VK_IMAGE_VIEW_CREATE_DESCRIPTOR_BUFFER_CAPTURE_REPLAY_BIT_EXT |
+                          VK_IMAGE_VIEW_CREATE_FRAGMENT_DENSITY_MAP_DEFERRED_BIT_EXT)) == 0) {
+                return {};
+            }
             if (value & (VK_IMAGE_VIEW_CREATE_FRAGMENT_DENSITY_MAP_DYNAMIC_BIT_EXT)) {
                 if (!IsExtEnabled(extensions.vk_ext_fragment_density_map)) {
                     return {vvl::Extension::_VK_EXT_fragment_density_map};
@@ -462,6 +547,10 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkPipelineCacheCreateFlagBits:
+            if ((value & (VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT |
+                          VK_PIPELINE_CACHE_CREATE_INTERNALLY_SYNCHRONIZED_MERGE_BIT_KHR)) == 0) {
+                return {};
+            }
             if (value & (VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT)) {
                 if (!IsExtEnabled(extensions.vk_ext_pipeline_creation_cache_control)) {
                     return {vvl::Extension::_VK_EXT_pipeline_creation_cache_control};
@@ -474,6 +563,28 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkPipelineCreateFlagBits:
+            if ((value & (VK_PIPELINE_CREATE_VIEW_INDEX_FROM_DEVICE_INDEX_BIT | VK_PIPELINE_CREATE_DISPATCH_BASE_BIT |
+                          VK_PIPELINE_CREATE_NO_PROTECTED_ACCESS_BIT | VK_PIPELINE_CREATE_PROTECTED_ACCESS_ONLY_BIT |
+                          VK_PIPELINE_CREATE_RAY_TRACING_NO_NULL_ANY_HIT_SHADERS_BIT_KHR |
+                          VK_PIPELINE_CREATE_RAY_TRACING_NO_NULL_CLOSEST_HIT_SHADERS_BIT_KHR |
+                          VK_PIPELINE_CREATE_RAY_TRACING_NO_NULL_MISS_SHADERS_BIT_KHR |
+                          VK_PIPELINE_CREATE_RAY_TRACING_NO_NULL_INTERSECTION_SHADERS_BIT_KHR |
+                          VK_PIPELINE_CREATE_RAY_TRACING_SKIP_TRIANGLES_BIT_KHR |
+                          VK_PIPELINE_CREATE_RAY_TRACING_SKIP_AABBS_BIT_KHR |
+                          VK_PIPELINE_CREATE_RAY_TRACING_SHADER_GROUP_HANDLE_CAPTURE_REPLAY_BIT_KHR |
+                          VK_PIPELINE_CREATE_DEFER_COMPILE_BIT_NV |
+                          VK_PIPELINE_CREATE_RENDERING_FRAGMENT_DENSITY_MAP_ATTACHMENT_BIT_EXT |
+                          VK_PIPELINE_CREATE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR |
+                          VK_PIPELINE_CREATE_INDIRECT_BINDABLE_BIT_NV | VK_PIPELINE_CREATE_LIBRARY_BIT_KHR |
+                          VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT |
+                          VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT |
+                          VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT | VK_PIPELINE_CREATE_RAY_TRACING_ALLOW_MOTION_BIT_NV |
+                          VK_PIPELINE_CREATE_COLOR_ATTACHMENT_FEEDBACK_LOOP_BIT_EXT |
+                          VK_PIPELINE_CREATE_DEPTH_STENCIL_ATTACHMENT_FEEDBACK_LOOP_BIT_EXT |
+                          VK_PIPELINE_CREATE_RAY_TRACING_OPACITY_MICROMAP_BIT_EXT |
+                          VK_PIPELINE_CREATE_RAY_TRACING_DISPLACEMENT_MICROMAP_BIT_NV)) == 0) {
+                return {};
+            }
             if (value & (VK_PIPELINE_CREATE_VIEW_INDEX_FROM_DEVICE_INDEX_BIT | VK_PIPELINE_CREATE_DISPATCH_BASE_BIT)) {
                 if (!IsExtEnabled(extensions.vk_khr_device_group)) {
                     return {vvl::Extension::_VK_KHR_device_group};
@@ -579,6 +690,12 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             if (value == VK_SHADER_STAGE_ALL) {
                 return {};
             }
+            if ((value & (VK_SHADER_STAGE_RAYGEN_BIT_KHR | VK_SHADER_STAGE_ANY_HIT_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR |
+                          VK_SHADER_STAGE_MISS_BIT_KHR | VK_SHADER_STAGE_INTERSECTION_BIT_KHR | VK_SHADER_STAGE_CALLABLE_BIT_KHR |
+                          VK_SHADER_STAGE_TASK_BIT_EXT | VK_SHADER_STAGE_MESH_BIT_EXT | VK_SHADER_STAGE_SUBPASS_SHADING_BIT_HUAWEI |
+                          VK_SHADER_STAGE_CLUSTER_CULLING_BIT_HUAWEI)) == 0) {
+                return {};
+            }
             if (value & (VK_SHADER_STAGE_RAYGEN_BIT_KHR | VK_SHADER_STAGE_ANY_HIT_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR |
                          VK_SHADER_STAGE_MISS_BIT_KHR | VK_SHADER_STAGE_INTERSECTION_BIT_KHR | VK_SHADER_STAGE_CALLABLE_BIT_KHR)) {
                 if (!IsExtEnabled(extensions.vk_nv_ray_tracing) && !IsExtEnabled(extensions.vk_khr_ray_tracing_pipeline)) {
@@ -628,6 +745,11 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkSamplerCreateFlagBits:
+            if ((value & (VK_SAMPLER_CREATE_SUBSAMPLED_BIT_EXT | VK_SAMPLER_CREATE_SUBSAMPLED_COARSE_RECONSTRUCTION_BIT_EXT |
+                          VK_SAMPLER_CREATE_DESCRIPTOR_BUFFER_CAPTURE_REPLAY_BIT_EXT |
+                          VK_SAMPLER_CREATE_NON_SEAMLESS_CUBE_MAP_BIT_EXT | VK_SAMPLER_CREATE_IMAGE_PROCESSING_BIT_QCOM)) == 0) {
+                return {};
+            }
             if (value & (VK_SAMPLER_CREATE_SUBSAMPLED_BIT_EXT | VK_SAMPLER_CREATE_SUBSAMPLED_COARSE_RECONSTRUCTION_BIT_EXT)) {
                 if (!IsExtEnabled(extensions.vk_ext_fragment_density_map)) {
                     return {vvl::Extension::_VK_EXT_fragment_density_map};
@@ -650,6 +772,11 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkDescriptorPoolCreateFlagBits:
+            if ((value & (VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_POOL_CREATE_HOST_ONLY_BIT_EXT |
+                          VK_DESCRIPTOR_POOL_CREATE_ALLOW_OVERALLOCATION_SETS_BIT_NV |
+                          VK_DESCRIPTOR_POOL_CREATE_ALLOW_OVERALLOCATION_POOLS_BIT_NV)) == 0) {
+                return {};
+            }
             if (value & (VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT)) {
                 if (!IsExtEnabled(extensions.vk_ext_descriptor_indexing)) {
                     return {vvl::Extension::_VK_EXT_descriptor_indexing};
@@ -669,6 +796,15 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkDescriptorSetLayoutCreateFlagBits:
+            if ((value & (VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT |
+                          VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT |
+                          VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT |
+                          VK_DESCRIPTOR_SET_LAYOUT_CREATE_EMBEDDED_IMMUTABLE_SAMPLERS_BIT_EXT |
+                          VK_DESCRIPTOR_SET_LAYOUT_CREATE_INDIRECT_BINDABLE_BIT_NV |
+                          VK_DESCRIPTOR_SET_LAYOUT_CREATE_HOST_ONLY_POOL_BIT_EXT |
+                          VK_DESCRIPTOR_SET_LAYOUT_CREATE_PER_STAGE_BIT_NV)) == 0) {
+                return {};
+            }
             if (value & (VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT)) {
                 if (!IsExtEnabled(extensions.vk_ext_descriptor_indexing)) {
                     return {vvl::Extension::_VK_EXT_descriptor_indexing};
@@ -703,6 +839,11 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkDependencyFlagBits:
+            if ((value & (VK_DEPENDENCY_DEVICE_GROUP_BIT | VK_DEPENDENCY_VIEW_LOCAL_BIT | VK_DEPENDENCY_FEEDBACK_LOOP_BIT_EXT |
+                          VK_DEPENDENCY_QUEUE_FAMILY_OWNERSHIP_TRANSFER_USE_ALL_STAGES_BIT_KHR |
+                          VK_DEPENDENCY_ASYMMETRIC_EVENT_BIT_KHR)) == 0) {
+                return {};
+            }
             if (value & (VK_DEPENDENCY_DEVICE_GROUP_BIT)) {
                 if (!IsExtEnabled(extensions.vk_khr_device_group)) {
                     return {vvl::Extension::_VK_KHR_device_group};
@@ -737,6 +878,10 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkRenderPassCreateFlagBits:
+            if ((value & (VK_RENDER_PASS_CREATE_TRANSFORM_BIT_QCOM |
+                          VK_RENDER_PASS_CREATE_PER_LAYER_FRAGMENT_DENSITY_BIT_VALVE)) == 0) {
+                return {};
+            }
             if (value & (VK_RENDER_PASS_CREATE_TRANSFORM_BIT_QCOM)) {
                 if (!IsExtEnabled(extensions.vk_qcom_render_pass_transform)) {
                     return {vvl::Extension::_VK_QCOM_render_pass_transform};
@@ -749,6 +894,14 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkSubpassDescriptionFlagBits:
+            if ((value & (VK_SUBPASS_DESCRIPTION_FRAGMENT_REGION_BIT_QCOM | VK_SUBPASS_DESCRIPTION_SHADER_RESOLVE_BIT_QCOM |
+                          VK_SUBPASS_DESCRIPTION_TILE_SHADING_APRON_BIT_QCOM |
+                          VK_SUBPASS_DESCRIPTION_RASTERIZATION_ORDER_ATTACHMENT_COLOR_ACCESS_BIT_EXT |
+                          VK_SUBPASS_DESCRIPTION_RASTERIZATION_ORDER_ATTACHMENT_DEPTH_ACCESS_BIT_EXT |
+                          VK_SUBPASS_DESCRIPTION_RASTERIZATION_ORDER_ATTACHMENT_STENCIL_ACCESS_BIT_EXT |
+                          VK_SUBPASS_DESCRIPTION_ENABLE_LEGACY_DITHERING_BIT_EXT)) == 0) {
+                return {};
+            }
             if (value &
                 (VK_SUBPASS_DESCRIPTION_PER_VIEW_ATTRIBUTES_BIT_NVX | VK_SUBPASS_DESCRIPTION_PER_VIEW_POSITION_X_ONLY_BIT_NVX)) {
                 if (!IsExtEnabled(extensions.vk_nvx_multiview_per_view_attributes)) {
@@ -781,6 +934,10 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkMemoryAllocateFlagBits:
+            if ((value & (VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT | VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_CAPTURE_REPLAY_BIT |
+                          VK_MEMORY_ALLOCATE_ZERO_INITIALIZE_BIT_EXT)) == 0) {
+                return {};
+            }
             if (value & (VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT | VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_CAPTURE_REPLAY_BIT)) {
                 if (!IsExtEnabled(extensions.vk_khr_buffer_device_address)) {
                     return {vvl::Extension::_VK_KHR_buffer_device_address};
@@ -793,6 +950,17 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkExternalMemoryHandleTypeFlagBits:
+            if ((value & (VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT |
+                          VK_EXTERNAL_MEMORY_HANDLE_TYPE_ANDROID_HARDWARE_BUFFER_BIT_ANDROID |
+                          VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT |
+                          VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_MAPPED_FOREIGN_MEMORY_BIT_EXT |
+                          VK_EXTERNAL_MEMORY_HANDLE_TYPE_ZIRCON_VMO_BIT_FUCHSIA |
+                          VK_EXTERNAL_MEMORY_HANDLE_TYPE_RDMA_ADDRESS_BIT_NV |
+                          VK_EXTERNAL_MEMORY_HANDLE_TYPE_SCREEN_BUFFER_BIT_QNX | VK_EXTERNAL_MEMORY_HANDLE_TYPE_MTLBUFFER_BIT_EXT |
+                          VK_EXTERNAL_MEMORY_HANDLE_TYPE_MTLTEXTURE_BIT_EXT |
+                          VK_EXTERNAL_MEMORY_HANDLE_TYPE_MTLHEAP_BIT_EXT)) == 0) {
+                return {};
+            }
             if (value & (VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT)) {
                 if (!IsExtEnabled(extensions.vk_ext_external_memory_dma_buf)) {
                     return {vvl::Extension::_VK_EXT_external_memory_dma_buf};
@@ -846,6 +1014,10 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkRenderingFlagBits:
+            if ((value & (VK_RENDERING_ENABLE_LEGACY_DITHERING_BIT_EXT | VK_RENDERING_CONTENTS_INLINE_BIT_KHR |
+                          VK_RENDERING_PER_LAYER_FRAGMENT_DENSITY_BIT_VALVE)) == 0) {
+                return {};
+            }
             if (value & (VK_RENDERING_ENABLE_LEGACY_DITHERING_BIT_EXT)) {
                 if (!IsExtEnabled(extensions.vk_ext_legacy_dithering)) {
                     return {vvl::Extension::_VK_EXT_legacy_dithering};
@@ -870,6 +1042,11 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkSwapchainCreateFlagBitsKHR:
+            if ((value & (VK_SWAPCHAIN_CREATE_SPLIT_INSTANCE_BIND_REGIONS_BIT_KHR | VK_SWAPCHAIN_CREATE_MUTABLE_FORMAT_BIT_KHR |
+                          VK_SWAPCHAIN_CREATE_PRESENT_ID_2_BIT_KHR | VK_SWAPCHAIN_CREATE_PRESENT_WAIT_2_BIT_KHR |
+                          VK_SWAPCHAIN_CREATE_DEFERRED_MEMORY_ALLOCATION_BIT_KHR)) == 0) {
+                return {};
+            }
             if (value & (VK_SWAPCHAIN_CREATE_SPLIT_INSTANCE_BIND_REGIONS_BIT_KHR)) {
                 if (!IsExtEnabled(extensions.vk_khr_device_group)) {
                     return {vvl::Extension::_VK_KHR_device_group};
@@ -898,6 +1075,13 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkVideoSessionCreateFlagBitsKHR:
+            if ((value & (VK_VIDEO_SESSION_CREATE_ALLOW_ENCODE_PARAMETER_OPTIMIZATIONS_BIT_KHR |
+                          VK_VIDEO_SESSION_CREATE_INLINE_QUERIES_BIT_KHR |
+                          VK_VIDEO_SESSION_CREATE_ALLOW_ENCODE_QUANTIZATION_DELTA_MAP_BIT_KHR |
+                          VK_VIDEO_SESSION_CREATE_ALLOW_ENCODE_EMPHASIS_MAP_BIT_KHR |
+                          VK_VIDEO_SESSION_CREATE_INLINE_SESSION_PARAMETERS_BIT_KHR)) == 0) {
+                return {};
+            }
             if (value & (VK_VIDEO_SESSION_CREATE_ALLOW_ENCODE_PARAMETER_OPTIMIZATIONS_BIT_KHR)) {
                 if (!IsExtEnabled(extensions.vk_khr_video_encode_queue)) {
                     return {vvl::Extension::_VK_KHR_video_encode_queue};
@@ -936,6 +1120,10 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkVideoEncodeFlagBitsKHR:
+            if ((value & (VK_VIDEO_ENCODE_INTRA_REFRESH_BIT_KHR | VK_VIDEO_ENCODE_WITH_QUANTIZATION_DELTA_MAP_BIT_KHR |
+                          VK_VIDEO_ENCODE_WITH_EMPHASIS_MAP_BIT_KHR)) == 0) {
+                return {};
+            }
             if (value & (VK_VIDEO_ENCODE_INTRA_REFRESH_BIT_KHR)) {
                 if (!IsExtEnabled(extensions.vk_khr_video_encode_intra_refresh)) {
                     return {vvl::Extension::_VK_KHR_video_encode_intra_refresh};
@@ -963,6 +1151,15 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkBuildAccelerationStructureFlagBitsKHR:
+            if ((value & (VK_BUILD_ACCELERATION_STRUCTURE_MOTION_BIT_NV |
+                          VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_OPACITY_MICROMAP_UPDATE_BIT_EXT |
+                          VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_DISABLE_OPACITY_MICROMAPS_BIT_EXT |
+                          VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_OPACITY_MICROMAP_DATA_UPDATE_BIT_EXT |
+                          VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_DISPLACEMENT_MICROMAP_UPDATE_BIT_NV |
+                          VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_DATA_ACCESS_BIT_KHR |
+                          VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_CLUSTER_OPACITY_MICROMAPS_BIT_NV)) == 0) {
+                return {};
+            }
             if (value & (VK_BUILD_ACCELERATION_STRUCTURE_MOTION_BIT_NV)) {
                 if (!IsExtEnabled(extensions.vk_nv_ray_tracing_motion_blur)) {
                     return {vvl::Extension::_VK_NV_ray_tracing_motion_blur};
@@ -999,6 +1196,10 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
             }
             return {};
         case vvl::FlagBitmask::VkAccelerationStructureCreateFlagBitsKHR:
+            if ((value & (VK_ACCELERATION_STRUCTURE_CREATE_DESCRIPTOR_BUFFER_CAPTURE_REPLAY_BIT_EXT |
+                          VK_ACCELERATION_STRUCTURE_CREATE_MOTION_BIT_NV)) == 0) {
+                return {};
+            }
             if (value & (VK_ACCELERATION_STRUCTURE_CREATE_DESCRIPTOR_BUFFER_CAPTURE_REPLAY_BIT_EXT)) {
                 if (!IsExtEnabled(extensions.vk_ext_descriptor_buffer)) {
                     return {vvl::Extension::_VK_EXT_descriptor_buffer};
@@ -1018,6 +1219,14 @@ vvl::Extensions stateless::Context::IsValidFlagValue(vvl::FlagBitmask flag_bitma
 vvl::Extensions stateless::Context::IsValidFlag64Value(vvl::FlagBitmask flag_bitmask, VkFlags64 value) const {
     switch (flag_bitmask) {
         case vvl::FlagBitmask::VkPipelineStageFlagBits2:
+            if ((value & (VK_PIPELINE_STAGE_2_VIDEO_DECODE_BIT_KHR | VK_PIPELINE_STAGE_2_VIDEO_ENCODE_BIT_KHR |
+                          VK_PIPELINE_STAGE_2_SUBPASS_SHADER_BIT_HUAWEI | VK_PIPELINE_STAGE_2_INVOCATION_MASK_BIT_HUAWEI |
+                          VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_COPY_BIT_KHR | VK_PIPELINE_STAGE_2_MICROMAP_BUILD_BIT_EXT |
+                          VK_PIPELINE_STAGE_2_CLUSTER_CULLING_SHADER_BIT_HUAWEI | VK_PIPELINE_STAGE_2_OPTICAL_FLOW_BIT_NV |
+                          VK_PIPELINE_STAGE_2_CONVERT_COOPERATIVE_VECTOR_MATRIX_BIT_NV |
+                          VK_PIPELINE_STAGE_2_DATA_GRAPH_BIT_ARM)) == 0) {
+                return {};
+            }
             if (value & (VK_PIPELINE_STAGE_2_VIDEO_DECODE_BIT_KHR)) {
                 if (!IsExtEnabled(extensions.vk_khr_video_decode_queue)) {
                     return {vvl::Extension::_VK_KHR_video_decode_queue};
@@ -1070,6 +1279,16 @@ vvl::Extensions stateless::Context::IsValidFlag64Value(vvl::FlagBitmask flag_bit
             }
             return {};
         case vvl::FlagBitmask::VkAccessFlagBits2:
+            if ((value & (VK_ACCESS_2_VIDEO_DECODE_READ_BIT_KHR | VK_ACCESS_2_VIDEO_DECODE_WRITE_BIT_KHR |
+                          VK_ACCESS_2_VIDEO_ENCODE_READ_BIT_KHR | VK_ACCESS_2_VIDEO_ENCODE_WRITE_BIT_KHR |
+                          VK_ACCESS_2_SHADER_TILE_ATTACHMENT_READ_BIT_QCOM | VK_ACCESS_2_SHADER_TILE_ATTACHMENT_WRITE_BIT_QCOM |
+                          VK_ACCESS_2_DESCRIPTOR_BUFFER_READ_BIT_EXT | VK_ACCESS_2_INVOCATION_MASK_READ_BIT_HUAWEI |
+                          VK_ACCESS_2_SHADER_BINDING_TABLE_READ_BIT_KHR | VK_ACCESS_2_MICROMAP_READ_BIT_EXT |
+                          VK_ACCESS_2_MICROMAP_WRITE_BIT_EXT | VK_ACCESS_2_OPTICAL_FLOW_READ_BIT_NV |
+                          VK_ACCESS_2_OPTICAL_FLOW_WRITE_BIT_NV | VK_ACCESS_2_DATA_GRAPH_READ_BIT_ARM |
+                          VK_ACCESS_2_DATA_GRAPH_WRITE_BIT_ARM)) == 0) {
+                return {};
+            }
             if (value & (VK_ACCESS_2_VIDEO_DECODE_READ_BIT_KHR | VK_ACCESS_2_VIDEO_DECODE_WRITE_BIT_KHR)) {
                 if (!IsExtEnabled(extensions.vk_khr_video_decode_queue)) {
                     return {vvl::Extension::_VK_KHR_video_decode_queue};
@@ -1117,6 +1336,15 @@ vvl::Extensions stateless::Context::IsValidFlag64Value(vvl::FlagBitmask flag_bit
             }
             return {};
         case vvl::FlagBitmask::VkPipelineCreateFlagBits2:
+            if ((value & (VK_PIPELINE_CREATE_2_EXECUTION_GRAPH_BIT_AMDX |
+                          VK_PIPELINE_CREATE_2_RAY_TRACING_ALLOW_SPHERES_AND_LINEAR_SWEPT_SPHERES_BIT_NV |
+                          VK_PIPELINE_CREATE_2_ENABLE_LEGACY_DITHERING_BIT_EXT |
+                          VK_PIPELINE_CREATE_2_RAY_TRACING_SKIP_TRIANGLES_BIT_KHR |
+                          VK_PIPELINE_CREATE_2_DISALLOW_OPACITY_MICROMAP_BIT_ARM | VK_PIPELINE_CREATE_2_CAPTURE_DATA_BIT_KHR |
+                          VK_PIPELINE_CREATE_2_INDIRECT_BINDABLE_BIT_EXT |
+                          VK_PIPELINE_CREATE_2_PER_LAYER_FRAGMENT_DENSITY_BIT_VALVE)) == 0) {
+                return {};
+            }
             if (value & (VK_PIPELINE_CREATE_2_EXECUTION_GRAPH_BIT_AMDX)) {
                 if (!IsExtEnabled(extensions.vk_amdx_shader_enqueue)) {
                     return {vvl::Extension::_VK_AMDX_shader_enqueue};
@@ -1159,6 +1387,11 @@ vvl::Extensions stateless::Context::IsValidFlag64Value(vvl::FlagBitmask flag_bit
             }
             return {};
         case vvl::FlagBitmask::VkBufferUsageFlagBits2:
+            if ((value & (VK_BUFFER_USAGE_2_EXECUTION_GRAPH_SCRATCH_BIT_AMDX |
+                          VK_BUFFER_USAGE_2_DATA_GRAPH_FOREIGN_DESCRIPTOR_BIT_ARM | VK_BUFFER_USAGE_2_TILE_MEMORY_BIT_QCOM |
+                          VK_BUFFER_USAGE_2_PREPROCESS_BUFFER_BIT_EXT)) == 0) {
+                return {};
+            }
             if (value & (VK_BUFFER_USAGE_2_EXECUTION_GRAPH_SCRATCH_BIT_AMDX)) {
                 if (!IsExtEnabled(extensions.vk_amdx_shader_enqueue)) {
                     return {vvl::Extension::_VK_AMDX_shader_enqueue};
@@ -79,6 +79,14 @@ Times to NOT use it
 
 [[maybe_unused]] static bool IsExtEnabledByCreateinfo(ExtEnabled extension) { return (extension == kEnabledByCreateinfo); }
 
+// For extensions providing the same functionality (KHR/EXT pairs, an extension and the one it was folded into...)
+// Promoted extensions are already kEnabledByApiLevel for the versions that include them, so "extension or version"
+// checks only need the extension (or vk_feature_version_*), no version comparison.
+template <typename... Extensions>
+[[maybe_unused]] static constexpr bool IsAnyExtEnabled(ExtEnabled extension, Extensions... extensions) {
+    return ((extension != kNotEnabled) || ... || (extensions != kNotEnabled));
+}
+
 struct InstanceExtensions {
     APIVersion api_version{};
     ExtEnabled vk_feature_version_1_1{kNotEnabled};
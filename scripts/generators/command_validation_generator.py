@@ -67,6 +67,18 @@ class CommandValidationOutputGenerator(BaseGenerator):
 
             enum CMD_SCOPE_TYPE { CMD_SCOPE_INSIDE, CMD_SCOPE_OUTSIDE, CMD_SCOPE_BOTH };
 
+            // The parts of the command buffer state the implicit VUs of vkCmd* commands depend on
+            enum CommandBufferStateBits : uint32_t {
+                kCbRecording = 1 << 0,
+                kCbActiveRenderPass = 1 << 1,
+                // Inside a render pass, or a secondary command buffer continuing one
+                kCbRenderPassScope = 1 << 2,
+                kCbVideoCoding = 1 << 3,
+                kCbSecondary = 1 << 4,
+                // Primary command buffer in a subpass whose contents are VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+                kCbSecondaryContentsSubpass = 1 << 5,
+            };
+
             struct CommandValidationInfo {
                 const char* recording_vuid;
                 const char* buffer_level_vuid;
@@ -79,6 +91,11 @@ class CommandValidationOutputGenerator(BaseGenerator):
 
                 CMD_SCOPE_TYPE video_coding;
                 const char* video_coding_vuid;
+
+                // CommandBufferStateBits that must be set and must not be set when recording the command, all the above but the queue
+                // flags summed up, so the common case where every VU is met is a single compare
+                uint32_t required_state;
+                uint32_t forbidden_state;
             };
 
             using Func = vvl::Func;
@@ -157,6 +174,30 @@ class CommandValidationOutputGenerator(BaseGenerator):
         # The main function to validate all the commands
         # TODO - Remove C++ code from being a single python string
         out.append('''
+            static uint32_t GetCommandBufferStateBits(const vvl::CommandBuffer& cb_state) {
+                uint32_t state_bits = 0;
+                if (cb_state.state == CbState::Recording) {
+                    state_bits |= kCbRecording;
+                }
+                if (cb_state.active_render_pass) {
+                    state_bits |= kCbActiveRenderPass | kCbRenderPassScope;
+                    if (cb_state.IsPrimary() && !cb_state.active_render_pass->UsesDynamicRendering() &&
+                        cb_state.active_subpass_contents == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS) {
+                        state_bits |= kCbSecondaryContentsSubpass;
+                    }
+                }
+                if (cb_state.IsSecondary()) {
+                    state_bits |= kCbSecondary;
+                    if (cb_state.begin_info_flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT) {
+                        state_bits |= kCbRenderPassScope;
+                    }
+                }
+                if (cb_state.bound_video_session) {
+                    state_bits |= kCbVideoCoding;
+                }
+                return state_bits;
+            }
+
             // Ran on all vkCmd* commands
             // Because it validate the implicit VUs that stateless can't, if this fails, it is likely
             // the input is very bad and other checks will crash dereferencing null pointers
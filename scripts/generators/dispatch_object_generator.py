@@ -378,6 +378,7 @@ class DispatchObjectGenerator(BaseGenerator):
             #include <vulkan/utility/vk_safe_struct.hpp>
             #include "state_tracker/pipeline_state.h"
             #include "containers/custom_containers.h"
+            #include "containers/scratch_arena.h"
 
              ''')
         for layer in APISpecific.getValidationLayerList(self.targetApiName):
@@ -386,8 +387,6 @@ class DispatchObjectGenerator(BaseGenerator):
         out.append('\n')
 
         out.append('''
-            #define DISPATCH_MAX_STACK_ALLOCATIONS 32
-
             namespace vvl {
             namespace dispatch {
 
@@ -419,21 +418,61 @@ class DispatchObjectGenerator(BaseGenerator):
         out.append('\n')
         out.append('}\n')
 
+        guard_helper = PlatformGuardHelper()
+        handle_structs = []
+        for struct in [self.vk.structs[x] for x in self.ndo_extension_structs]:
+            (api_decls, api_pre, api_post) = self.uniquifyMembers(struct.members, 'safe_struct->', 0, False, False, False)
+            # Only process extension structs containing handles
+            if api_pre:
+                handle_structs.append((struct, api_pre))
+
         out.append('''
+            // sType of every extension struct UnwrapPnextChainHandles() has to look into
+            static constexpr VkStructureType kPnextStructsWithHandles[] = {
+            ''')
+        for struct, _ in handle_structs:
+            out.extend(guard_helper.add_guard(struct.protect))
+            out.append(f'{struct.sType},\n')
+        out.extend(guard_helper.add_guard(None))
+        out.append('''};
+
+            // Bit set indexed by a hash of the sType. A clear bit means no struct with handles has that sType, so the chain walk
+            // can step over the common structs without handles (ex: VkTimelineSemaphoreSubmitInfo) with a single test instead of
+            // going through the switch.
+            class PnextHandleFilter {
+              public:
+                constexpr PnextHandleFilter() : words_() {
+                    for (VkStructureType s_type : kPnextStructsWithHandles) {
+                        words_[Index(s_type) / 64] |= uint64_t(1) << (Index(s_type) % 64);
+                    }
+                }
+                constexpr bool MayHaveHandles(VkStructureType s_type) const {
+                    return (words_[Index(s_type) / 64] >> (Index(s_type) % 64)) & 1;
+                }
+
+              private:
+                static constexpr uint32_t kBitsLog2 = 10;
+                // Fibonacci hashing, the raw values are too regular (extension sTypes are 1000 apart) to use their low bits
+                static constexpr uint32_t Index(VkStructureType s_type) {
+                    return (static_cast<uint32_t>(s_type) * 2654435769u) >> (32 - kBitsLog2);
+                }
+                uint64_t words_[(1u << kBitsLog2) / 64];
+            };
+            static constexpr PnextHandleFilter kPnextHandleFilter;
+
             // Unique Objects pNext extension handling function
             void HandleWrapper::UnwrapPnextChainHandles(const void *pNext) {
                 void *cur_pnext = const_cast<void *>(pNext);
                 while (cur_pnext != nullptr) {
                     VkBaseOutStructure *header = reinterpret_cast<VkBaseOutStructure *>(cur_pnext);
+                    if (!kPnextHandleFilter.MayHaveHandles(header->sType)) {
+                        cur_pnext = header->pNext;
+                        continue;
+                    }
 
                     switch (header->sType) {
             ''')
-        guard_helper = PlatformGuardHelper()
-        for struct in [self.vk.structs[x] for x in self.ndo_extension_structs]:
-            (api_decls, api_pre, api_post) = self.uniquifyMembers(struct.members, 'safe_struct->', 0, False, False, False)
-            # Only process extension structs containing handles
-            if not api_pre:
-                continue
+        for struct, api_pre in handle_structs:
             safe_name = 'vku::safe_' + struct.name
             out.extend(guard_helper.add_guard(struct.protect))
             out.append(f'case {struct.sType}: {{\n')
@@ -464,6 +503,9 @@ class DispatchObjectGenerator(BaseGenerator):
             }
         ''')
 
+        # Device commands whose dispatch function does nothing more than (un)wrapping handles, see GetPassthroughMode()
+        direct_commands = []
+        unwrap_commands = []
         for command in [x for x in self.vk.commands.values() if x.name not in self.no_autogen_list]:
             out.extend(guard_helper.add_guard(command.protect))
 
@@ -521,6 +563,8 @@ class DispatchObjectGenerator(BaseGenerator):
             down_chain_call_only = False
             if not api_decls and not api_pre and not api_post:
                 down_chain_call_only = True
+            if not command.instance:
+                (direct_commands if down_chain_call_only else unwrap_commands).append(command)
 
             prototype = command.cPrototype[:-1]
             prototype = prototype.replace('VKAPI_ATTR ', '')
@@ -570,6 +614,23 @@ class DispatchObjectGenerator(BaseGenerator):
                 out.append('return result;\n')
             out.append('}\n')
         out.extend(guard_helper.add_guard(None))
+
+        out.append('''
+            PassthroughMode GetPassthroughMode(vvl::Func command) {
+                switch (command) {
+            ''')
+        for commands, mode in [(direct_commands, 'Direct'), (unwrap_commands, 'Unwrap')]:
+            for command in commands:
+                out.extend(guard_helper.add_guard(command.protect))
+                out.append(f'    case vvl::Func::{command.name}:\n')
+            out.extend(guard_helper.add_guard(None))
+            out.append(f'        return PassthroughMode::{mode};\n')
+        out.append('''
+                    default:
+                        return PassthroughMode::Trampoline;
+                }
+            }
+            ''')
         out.append('} // namespace dispatch\n')
         out.append('} // namespace vvl\n')
 
@@ -620,7 +681,7 @@ class DispatchObjectGenerator(BaseGenerator):
                 if (not topLevel) or (not isCreate) or (not member.pointer):
                     if count_name is not None:
                         if topLevel:
-                            decls += f'small_vector<{member.type}, DISPATCH_MAX_STACK_ALLOCATIONS> var_local_{prefix}{member.name};\n'
+                            decls += f'vvl::ScratchArray<{member.type}> var_local_{prefix}{member.name};\n'
                             decls += f'{member.type} *local_{prefix}{member.name} = nullptr;\n'
                         pre_code += f' if ({prefix}{member.name}) {{\n'
                         if topLevel:
@@ -663,7 +724,7 @@ class DispatchObjectGenerator(BaseGenerator):
                             new_prefix = f'local_{member.name}'
                             # Declare vku::safe_VkVarType for struct
                             if not deferred_name:
-                                decls += f'small_vector<{safe_type}, DISPATCH_MAX_STACK_ALLOCATIONS> var_{new_prefix};\n'
+                                decls += f'vvl::ScratchArray<{safe_type}> var_{new_prefix};\n'
                             decls += f'{safe_type} *{new_prefix} = nullptr;\n'
 
                         else:
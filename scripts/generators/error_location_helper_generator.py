@@ -98,6 +98,8 @@ class ErrorLocationHelperOutputGenerator(BaseGenerator):
         for command in sorted(self.vk.commands.values()):
             out.append(f'    {command.name},\n')
         out.append('};\n')
+        # Number of Func values, including Empty, for tables indexed by Func
+        out.append(f'constexpr size_t kFuncCount = static_cast<size_t>(Func::{sorted(self.vk.commands.values())[-1].name}) + 1;\n')
 
         out.append('\n')
         out.append('enum class Struct {\n')
@@ -190,6 +190,14 @@ class ExtensionHelperOutputGenerator(BaseGenerator):
             [[maybe_unused]] static bool IsExtEnabled(ExtEnabled extension) { return (extension != kNotEnabled); }
 
             [[maybe_unused]] static bool IsExtEnabledByCreateinfo(ExtEnabled extension) { return (extension == kEnabledByCreateinfo); }
+
+            // For extensions providing the same functionality (KHR/EXT pairs, an extension and the one it was folded into...)
+            // Promoted extensions are already kEnabledByApiLevel for the versions that include them, so "extension or version"
+            // checks only need the extension (or vk_feature_version_*), no version comparison.
+            template <typename... Extensions>
+            [[maybe_unused]] static constexpr bool IsAnyExtEnabled(ExtEnabled extension, Extensions... extensions) {
+                return ((extension != kNotEnabled) || ... || (extensions != kNotEnabled));
+            }
             ''')
 
         out.append('\nstruct InstanceExtensions {\n')
@@ -104,9 +104,79 @@ class LayerChassisOutputGenerator(BaseGenerator):
         'vkGetPhysicalDeviceToolPropertiesEXT',
     )
 
+    # Device commands the chassis does more for than calling the intercepts and the dispatch function, so it can never step
+    # out of the way for them (see GetDeviceProcAddr)
+    no_passthrough_functions = (
+        'vkDebugMarkerSetObjectNameEXT',
+        'vkSetDebugUtilsObjectNameEXT',
+        'vkQueueBeginDebugUtilsLabelEXT',
+        'vkQueueInsertDebugUtilsLabelEXT',
+        'vkQueueEndDebugUtilsLabelEXT',
+        # Tracy GPU collectors
+        'vkGetDeviceQueue',
+        'vkGetDeviceQueue2',
+    )
+
+    # Besides every vkCmd*, the device commands applications call per frame or per draw. They are grouped in the hot text
+    # section and call the devirtualized intercepts (see dispatch_intercepts.h), the other entry points are optimized for size.
+    hot_functions = (
+        'vkQueueSubmit',
+        'vkQueueSubmit2',
+        'vkQueueSubmit2KHR',
+        'vkEndCommandBuffer',
+        'vkResetCommandBuffer',
+        'vkResetCommandPool',
+        'vkAllocateCommandBuffers',
+        'vkFreeCommandBuffers',
+        'vkUpdateDescriptorSets',
+        'vkUpdateDescriptorSetWithTemplate',
+        'vkUpdateDescriptorSetWithTemplateKHR',
+        'vkFreeDescriptorSets',
+        'vkResetDescriptorPool',
+        'vkGetDescriptorEXT',
+        'vkAcquireNextImageKHR',
+        'vkAcquireNextImage2KHR',
+        'vkWaitForFences',
+        'vkResetFences',
+        'vkGetFenceStatus',
+        'vkWaitSemaphores',
+        'vkWaitSemaphoresKHR',
+        'vkSignalSemaphore',
+        'vkSignalSemaphoreKHR',
+        'vkGetSemaphoreCounterValue',
+        'vkGetSemaphoreCounterValueKHR',
+        'vkGetQueryPoolResults',
+        'vkMapMemory',
+        'vkMapMemory2',
+        'vkMapMemory2KHR',
+        'vkUnmapMemory',
+        'vkUnmapMemory2',
+        'vkUnmapMemory2KHR',
+        'vkFlushMappedMemoryRanges',
+        'vkInvalidateMappedMemoryRanges',
+        'vkGetBufferDeviceAddress',
+        'vkGetBufferDeviceAddressKHR',
+        'vkGetBufferDeviceAddressEXT',
+    )
+
+    # Generate the devirtualized intercept calls for the cold entry points too. It about triples their code for no
+    # measurable gain, only worth it to compare against the hot/cold split.
+    devirtualize_cold_functions = False
+
     def __init__(self):
         BaseGenerator.__init__(self)
 
+    def isHotCommand(self, command: Command) -> bool:
+        return not command.instance and (command.name.startswith('vkCmd') or command.name in self.hot_functions)
+
+    def canPassthrough(self, command: Command) -> bool:
+        if command.instance or command.name in self.ignore_functions or command.name in self.manual_functions:
+            return False
+        if command.name in self.no_passthrough_functions or 'QueueSubmit' in command.name:
+            return False
+        # The chassis marks every validation object as device lost, whether they intercept the command or not
+        return not (command.errorCodes and 'VK_ERROR_DEVICE_LOST' in command.errorCodes)
+
     def getApiFunctionType(self, command: Command) -> str:
             if command.name in [
                     'vkCreateInstance',
@@ -224,12 +294,14 @@ class LayerChassisOutputGenerator(BaseGenerator):
             #include <cstring>
 
             #include "chassis/dispatch_object.h"
+            #include "chassis/dispatch_intercepts.h"
             #include "chassis/validation_object.h"
             #include "generated/dispatch_vector.h"
             #include "utils/vk_layer_extension_utils.h"
             #include "layer_options.h"
 
             #include "profiling/profiling.h"
+            #include "profiling/call_stats.h"
 
             ''')
 
@@ -293,7 +365,10 @@ class LayerChassisOutputGenerator(BaseGenerator):
         for command in [x for x in self.vk.commands.values() if x.name not in self.ignore_functions and x.name not in self.manual_functions]:
             out.extend(guard_helper.add_guard(command.protect))
             prototype = command.cPrototype.replace('VKAPI_CALL vk', 'VKAPI_CALL ').replace(');', ') {\n')
-            out.append(prototype)
+            is_hot = self.isHotCommand(command)
+            out.append(f'{"VVL_HOT_ENTRY_POINT" if is_hot else "VVL_COLD_ENTRY_POINT"} {prototype}')
+            # Template arguments of ValidateIntercepts() and RecordIntercepts()
+            intercepts_args = '' if is_hot or self.devirtualize_cold_functions else '<false>'
 
             paramsList = ', '.join([param.name for param in command.params])
 
@@ -314,6 +389,10 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 'uint64_t': 'return 0;'
             }
 
+            # Per entry point timing, only for device commands since the stats are written at vkDestroyDevice
+            def call_stats_scope(phase):
+                return '' if command.instance else f'\nVVL_CallStatsScope({dispatch}, {command.name}, {phase});\n'
+
             # Set up skip and locking
             out.append('bool skip = false;\n')
 
@@ -321,13 +400,16 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
             # Generate pre-call validation source code
             out.append(f'{{\nVVL_ZoneScopedN("PreCallValidate_{command.name}");')
+            out.append(call_stats_scope('PreCallValidate'))
             if not command.instance:
+                # ValidateIntercepts() calls the lambda with the concrete validation object type when it can (see
+                # dispatch_intercepts.h), so it is written against "auto*" instead of vvl::base::Device*
                 out.append(f'''
-                           for (const auto& vo : {dispatch}->intercept_vectors[InterceptIdPreCallValidate{command.name[2:]}]) {{
-                                if (!vo) {{
-                                    continue;
-                                }}
+                           skip |= ValidateIntercepts{intercepts_args}(*{dispatch}, InterceptIdPreCallValidate{command.name[2:]}, [&](auto* vo) {{
                                 auto lock = vo->ReadLock();
+                                return vo->PreCallValidate{command.name[2:]}({paramsList}, error_obj);
+                            }});
+                            if (skip) {return_map[command.returnType]}
                             ''')
             else:
                 out.append(f'''
@@ -335,16 +417,16 @@ class LayerChassisOutputGenerator(BaseGenerator):
                                 if (!vo) {{
                                     continue;
                                 }}
+                                skip |= vo->PreCallValidate{command.name[2:]}({paramsList}, error_obj);
+                                if (skip) {return_map[command.returnType]}
+                            }}
                             ''')
-
-            out.append(f'skip |= vo->PreCallValidate{command.name[2:]}({paramsList}, error_obj);\n')
-            out.append(f'if (skip) {return_map[command.returnType]}\n')
-            out.append('   }\n')
             out.append('}\n')
 
             # Generate pre-call state recording source code
             out.append(f'RecordObject record_obj(vvl::Func::{command.name});\n')
             out.append(f'{{\nVVL_ZoneScopedN("PreCallRecord_{command.name}");')
+            out.append(call_stats_scope('PreCallRecord'))
             if "QueueSubmit" in command.name:
                 out.append(f'''
                     VVL_TracyVkNamedZoneStart(GetTracyVkCtx(), queue, "gpu_PreCallRecord{command.name}", pre_call_record_gpu_zone);
@@ -352,11 +434,10 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
             if not command.instance:
                 out.append(f'''
-                           for (auto& vo : {dispatch}->intercept_vectors[InterceptIdPreCallRecord{command.name[2:]}]) {{
-                                if (!vo) {{
-                                    continue;
-                                }}
+                           RecordIntercepts{intercepts_args}(*{dispatch}, InterceptIdPreCallRecord{command.name[2:]}, [&](auto* vo) {{
                                 auto lock = vo->WriteLock();
+                                vo->PreCallRecord{command.name[2:]}({paramsList}, record_obj);
+                            }});
                             ''')
             else:
                 out.append(f'''
@@ -364,10 +445,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
                                 if (!vo) {{
                                     continue;
                                 }}
+                                vo->PreCallRecord{command.name[2:]}({paramsList}, record_obj);
+                            }}
                             ''')
-
-            out.append(f'vo->PreCallRecord{command.name[2:]}({paramsList}, record_obj);\n')
-            out.append('   }\n')
             if "QueueSubmit" in command.name:
                 out.append('''
                     VVL_TracyVkNamedZoneEnd(pre_call_record_gpu_zone, queue);
@@ -391,6 +471,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
             # Tracy profiler
             out.append(f'{{\nVVL_ZoneScopedN("Dispatch_{command.name}");\n')
+            out.append(call_stats_scope('Dispatch'))
 
             if "QueueSubmit" in command.name:
                 out.append(f'''
@@ -425,6 +506,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
             # Generate post-call object processing source code
             out.append(f'{{\nVVL_ZoneScopedN("PostCallRecord_{command.name}");\n')
+            out.append(call_stats_scope('PostCallRecord'))
             if "QueueSubmit" in command.name:
                 out.append(f'''
                     VVL_TracyVkNamedZoneStart(GetTracyVkCtx(), queue, "gpu_PostCallRecord{command.name}", post_call_record_gpu_zone);
@@ -442,14 +524,14 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ''')
 
             if not command.instance:
-                out.append(f'for (auto& vo : {dispatch}->intercept_vectors[InterceptIdPostCallRecord{command.name[2:]}]) {{')
+                out.append(f'RecordIntercepts{intercepts_args}(*{dispatch}, InterceptIdPostCallRecord{command.name[2:]}, [&](auto* vo) {{')
             else:
                 out.append(f'for (auto& vo : {dispatch}->object_dispatch) {{')
-            out.append('''
-                       if (!vo) {
-                          continue;
-                       }
-                       ''')
+                out.append('''
+                           if (!vo) {
+                              continue;
+                           }
+                           ''')
 
 
             # These commands perform blocking operations during PostRecord phase. We might need to
@@ -472,12 +554,22 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     out.append('vvl::base::Device::BlockingOperationGuard lock(vo);\n')
 
             out.append(f'vo->PostCallRecord{command.name[2:]}({paramsList}, record_obj);\n')
-            out.append('    }\n')
+            out.append('    });\n' if not command.instance else '    }\n')
             if "QueueSubmit" in command.name:
                 out.append('''
                     VVL_TracyVkNamedZoneEnd(post_call_record_gpu_zone, queue);
                 ''')
             out.append('}\n')
+
+            # VkFrameBoundaryEXT ends the frames of validation_frame_stride, like vkQueuePresentKHR
+            frame_boundary_commands = {
+                'vkQueueSubmit' : 'submitCount, pSubmits',
+                'vkQueueSubmit2' : 'submitCount, pSubmits',
+                'vkQueueSubmit2KHR' : 'submitCount, pSubmits',
+                'vkQueueBindSparse' : 'bindInfoCount, pBindInfo',
+            }
+            if command.name in frame_boundary_commands:
+                out.append(f'{dispatch}->RecordFrameBoundaries({frame_boundary_commands[command.name]});\n')
             if "QueueSubmit" in command.name:
                 out.append('''#if defined(VVL_TRACY_GPU)
                     TracyVkCollector::TrySubmitCollectCb(queue);
@@ -505,6 +597,40 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
         out.extend(guard_helper.add_guard(None))
 
+        passthrough_commands = [x for x in self.vk.commands.values() if self.canPassthrough(x)]
+        out.append('''
+            // Handed out by GetDeviceProcAddr() instead of the functions above when no validation object intercepts the command,
+            // they only call the dispatch function (see vvl::dispatch::PassthroughMode for when the driver is called directly)
+            namespace passthrough {
+            ''')
+        for command in passthrough_commands:
+            out.extend(guard_helper.add_guard(command.protect))
+            prototype = command.cPrototype.replace('VKAPI_CALL vk', 'VKAPI_CALL ').replace(');', ') {\n')
+            out.append(prototype)
+            paramsList = ', '.join([param.name for param in command.params])
+            out.append(f'auto device_dispatch = vvl::dispatch::GetData({command.params[0].name});\n')
+            out.append(f'return device_dispatch->{command.name[2:]}({paramsList});\n')
+            out.append('}\n\n')
+        out.extend(guard_helper.add_guard(None))
+        out.append('} // namespace passthrough\n')
+
+        out.append('''
+            #ifdef _MSC_VER
+            #pragma warning( suppress: 6262 ) // VS analysis: this uses more than 16 kiB, which is fine here at global scope
+            #endif
+
+            const vvl::unordered_map<std::string, passthrough_data> &GetNameToPassthroughMap() {
+                static const vvl::unordered_map<std::string, passthrough_data> name_to_passthrough_map = {
+            ''')
+        for command in passthrough_commands:
+            out.extend(guard_helper.add_guard(command.protect))
+            name = command.name[2:]
+            out.append(f'    {{"{command.name}", {{vvl::Func::{command.name}, InterceptIdPreCallValidate{name}, InterceptIdPreCallRecord{name}, InterceptIdPostCallRecord{name}, (void*)passthrough::{name}}}}},\n')
+        out.extend(guard_helper.add_guard(None))
+        out.append('};\n')
+        out.append(' return name_to_passthrough_map;\n')
+        out.append('}\n')
+
         out.append('''
             // Map of intercepted ApiName to its associated function data
             #ifdef _MSC_VER
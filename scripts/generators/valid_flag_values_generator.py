@@ -74,6 +74,9 @@ class ValidFlagValuesOutputGenerator(BaseGenerator):
             //    - if zero is valid value or not
             //    - if the value is even found in the API
             // so the this file is only focused on checking for extensions being supported
+            //
+            // Most values only use bits that need no extension, so when a bitmask has several extension groups, all of their
+            // bits are first tested together
             ''')
 
         out.append('''
@@ -99,6 +102,10 @@ class ValidFlagValuesOutputGenerator(BaseGenerator):
             for flag in [x for x in bitmask.flags if x.multiBit]:
                 out.append(f'if (value == {flag.name}) {{ return {{}}; }}\n')
 
+            if len(expressionMap) > 1:
+                extensionFlags = [name for names in expressionMap.values() for name in names]
+                out.append(f'if ((value & ({" | ".join(extensionFlags)})) == 0) {{ return {{}}; }}\n')
+
             for expression, names in expressionMap.items():
                 extensions = expression.split(',')
                 checkExpression = []
@@ -147,6 +154,10 @@ class ValidFlagValuesOutputGenerator(BaseGenerator):
             for flag in [x for x in bitmask.flags if x.multiBit]:
                 out.append(f'if (value == {flag.name}) {{ return {{}}; }}\n')
 
+            if len(expressionMap) > 1:
+                extensionFlags = [name for names in expressionMap.values() for name in names]
+                out.append(f'if ((value & ({" | ".join(extensionFlags)})) == 0) {{ return {{}}; }}\n')
+
             for expression, names in expressionMap.items():
                 extensions = expression.split(',')
                 checkExpression = []
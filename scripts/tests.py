@@ -18,6 +18,8 @@ import subprocess
 import sys
 import os
 import argparse
+import platform
+import shutil
 import common_ci
 
 # Where all artifacts will ultimately be placed under
@@ -237,6 +239,65 @@ def Test(args):
 
     sys.exit(0)
 
+#
+# Run the benchmarks (tests/benchmarks) and fail if one is slower than the baseline stored for this platform
+def RunBenchmarks(args):
+    print("Run benchmarks using the Test ICD")
+
+    bench_env = dict(os.environ)
+    if not common_ci.IsWindows():
+        # The loader is only installed, the benchmarks find the layer and the Test ICD in the build directory
+        bench_env['LD_LIBRARY_PATH'] = os.path.join(CI_INSTALL_DIR, 'lib')
+        bench_env['DYLD_LIBRARY_PATH'] = os.path.join(CI_INSTALL_DIR, 'lib')
+
+    bench_dir = f'{CI_BUILD_DIR}/vvl/tests/benchmarks'
+    exe_suffix = '.exe' if common_ci.IsWindows() else ''
+    # Numbers are only comparable on the same kind of machine, each one keeps its own baselines
+    baseline_dir = os.path.join(os.path.abspath(args.benchmarkBaselines), f'{platform.system()}-{platform.machine()}'.lower())
+    compare = common_ci.RepoRelative('layers/profiling/compare.py')
+
+    # (results name, benchmark, arguments, environment)
+    runs = [
+        ('container', 'vk_container_benchmarks', '', {}),
+        ('layer', 'vk_layer_benchmarks', '', {}),
+        ('layer_syncval', 'vk_layer_benchmarks', '--layers-only --workload sync_buffer_copies --workload sync_image_barriers',
+         {'VK_LAYER_VALIDATE_SYNC': '1'}),
+        ('layer_gpuav', 'vk_layer_benchmarks', '--layers-only --workload gpuav_large_shader', {'VK_LAYER_GPUAV_ENABLE': '1'}),
+    ]
+    regressed = False
+    for name, benchmark, bench_args, extra_env in runs:
+        results = os.path.join(CI_BUILD_DIR, f'benchmarks_{name}.json')
+        bench_cmd = f'{os.path.join(bench_dir, benchmark + exe_suffix)} --scale {args.benchmarkScale} --json {results}'
+        if bench_args:
+            bench_cmd += f' {bench_args}'
+        common_ci.RunShellCmd(bench_cmd, env={**bench_env, **extra_env})
+
+        baseline = os.path.join(baseline_dir, f'benchmarks_{name}.json')
+        if not os.path.isfile(baseline):
+            print(f'No baseline at {baseline}, this run becomes the baseline')
+            os.makedirs(baseline_dir, exist_ok=True)
+            shutil.copyfile(results, baseline)
+            continue
+        compare_cmd = f'{sys.executable} {compare} {baseline} {results} --max-regression {args.benchmarkMaxRegression}'
+        try:
+            common_ci.RunShellCmd(compare_cmd)
+        except subprocess.CalledProcessError:
+            # Keep going, so every regressed benchmark shows up in the log
+            regressed = True
+    if regressed:
+        print('Benchmarks regressed, if the slowdown is expected replace the baselines with the results in ' + CI_BUILD_DIR)
+        sys.exit(1)
+
+def Benchmark(args):
+    try:
+        RunBenchmarks(args)
+
+    except subprocess.CalledProcessError as proc_error:
+        print('Command "%s" failed with return code %s' % (' '.join(proc_error.cmd), proc_error.returncode))
+        sys.exit(proc_error.returncode)
+
+    sys.exit(0)
+
 if __name__ == '__main__':
     configs = ['release', 'debug']
     default_config = configs[0]
@@ -268,9 +329,24 @@ if __name__ == '__main__':
         '--wsi', dest='wsi',
         action='store_true', help='Filter out tests for WSI (which uses xvfb and will slow down other tests)')
 
+    parser.add_argument(
+        '--benchmark', dest='benchmarkBaselines',
+        metavar='BASELINE_DIR', type=str, default=None,
+        help='Run the benchmarks and compare them against the baselines of this platform in BASELINE_DIR')
+    parser.add_argument(
+        '--benchmark-scale', dest='benchmarkScale',
+        metavar='FACTOR', type=float, default=0.25,
+        help='Fraction of the default benchmark iteration counts')
+    parser.add_argument(
+        '--benchmark-max-regression', dest='benchmarkMaxRegression',
+        metavar='PERCENT', type=float, default=15.0,
+        help='Slowdown of a median, in percent, above which a benchmark fails')
+
     args = parser.parse_args()
 
     if (args.build):
         Build(args)
     if (args.test):
         Test(args)
+    if (args.benchmarkBaselines):
+        Benchmark(args)
@@ -0,0 +1,714 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+// Microbenchmarks of the containers of layers/containers. Every benchmark runs a few repetitions of a batch of operations and
+// reports the time per operation. The range map benchmarks replay traces of range operations, either generated from the
+// access patterns of synchronization validation and image layout tracking, or read from files (--trace).
+// See README.md for how to use the JSON output with layers/profiling/compare.py
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "containers/range_map.h"
+#include "containers/segmented_map.h"
+#include "containers/small_vector.h"
+#include "containers/subresource_adapter.h"
+#include "utils/hash_util.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string json_path;
+    double scale = 1.0;
+    uint32_t repetitions = 5;
+    std::vector<std::string> filters;
+    std::vector<std::string> trace_paths;
+    std::string write_traces_dir;
+};
+
+uint32_t Scaled(uint32_t count, double scale) { return std::max(1u, uint32_t(double(count) * scale)); }
+
+// Results go through here so that the compiler cannot drop the work that produced them
+volatile uint64_t sink = 0;
+
+// splitmix64, the same numbers on every run and platform
+class Random {
+  public:
+    explicit Random(uint64_t seed) : state_(seed) {}
+    uint64_t Next() {
+        uint64_t z = (state_ += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+    uint64_t Below(uint64_t limit) { return Next() % limit; }
+
+  private:
+    uint64_t state_;
+};
+
+// Handed to every repetition of a benchmark, which does its setup and then times one batch with Measure
+class Batch {
+  public:
+    template <typename Body>
+    void Measure(uint64_t ops, Body&& body) {
+        const auto start = Clock::now();
+        body();
+        const auto elapsed = Clock::now() - start;
+        ops_ = ops;
+        ns_ = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    uint64_t Ops() const { return ops_; }
+    double NsPerOp() const { return ops_ ? double(ns_) / double(ops_) : 0.0; }
+
+  private:
+    uint64_t ops_ = 0;
+    uint64_t ns_ = 0;
+};
+
+class Runner {
+  public:
+    explicit Runner(const Options& options) : options_(options) {}
+
+    struct Key {
+        std::string workload;
+        std::string entry_point;
+        bool operator<(const Key& other) const {
+            return std::tie(workload, entry_point) < std::tie(other.workload, other.entry_point);
+        }
+    };
+
+    struct Stats {
+        uint64_t count = 0;  // repetitions
+        uint64_t ops = 0;    // per repetition
+        double avg_ns = 0.0;
+        double median_ns = 0.0;
+        double min_ns = 0.0;
+        double max_ns = 0.0;
+        double OpsPerSec() const { return avg_ns > 0.0 ? 1e9 / avg_ns : 0.0; }
+    };
+
+    // |run| is called once to warm up the caches and the pools of the containers, and then once per repetition
+    void Run(const std::string& workload, const std::string& entry_point, const std::function<void(Batch&)>& run) {
+        const std::string name = workload + "/" + entry_point;
+        if (!Selected(name)) {
+            return;
+        }
+        printf("Running %s\n", name.c_str());
+        fflush(stdout);
+
+        Batch warm_up;
+        run(warm_up);
+        std::vector<double> samples;
+        uint64_t ops = 0;
+        for (uint32_t i = 0; i < options_.repetitions; ++i) {
+            Batch batch;
+            run(batch);
+            samples.emplace_back(batch.NsPerOp());
+            ops = batch.Ops();
+        }
+        std::sort(samples.begin(), samples.end());
+
+        Stats& stats = results_[{workload, entry_point}];
+        stats.count = samples.size();
+        stats.ops = ops;
+        double total = 0.0;
+        for (double ns : samples) {
+            total += ns;
+        }
+        stats.avg_ns = total / double(samples.size());
+        stats.median_ns = samples[samples.size() / 2];
+        stats.min_ns = samples.front();
+        stats.max_ns = samples.back();
+    }
+
+    const std::map<Key, Stats>& Results() const { return results_; }
+
+  private:
+    bool Selected(const std::string& name) const {
+        if (options_.filters.empty()) {
+            return true;
+        }
+        return std::any_of(options_.filters.begin(), options_.filters.end(),
+                           [&name](const std::string& filter) { return name.find(filter) != std::string::npos; });
+    }
+
+    const Options& options_;
+    std::map<Key, Stats> results_;
+};
+
+void SmallVectorBenchmarks(Runner& runner, double scale) {
+    const uint32_t count = Scaled(100000, scale);
+
+    runner.Run("small_vector", "push_back_inline", [count](Batch& batch) {
+        batch.Measure(uint64_t(count) * 8, [count]() {
+            for (uint32_t i = 0; i < count; ++i) {
+                small_vector<uint32_t, 8> vector;
+                for (uint32_t j = 0; j < 8; ++j) {
+                    vector.emplace_back(i + j);
+                }
+                sink += vector.back();
+            }
+        });
+    });
+
+    runner.Run("small_vector", "push_back_grow", [count](Batch& batch) {
+        batch.Measure(uint64_t(count) * 64, [count]() {
+            for (uint32_t i = 0; i < count; ++i) {
+                small_vector<uint32_t, 8> vector;
+                for (uint32_t j = 0; j < 64; ++j) {
+                    vector.emplace_back(i + j);
+                }
+                sink += vector.back();
+            }
+        });
+    });
+
+    runner.Run("small_vector", "iterate", [count](Batch& batch) {
+        std::vector<small_vector<uint32_t, 8>> vectors(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            // Mostly inline, a few on the heap, like the handles of a command buffer
+            for (uint32_t j = 0; j < (i % 16 == 0 ? 12u : 4u); ++j) {
+                vectors[i].emplace_back(j);
+            }
+        }
+        batch.Measure(count, [&vectors]() {
+            uint64_t total = 0;
+            for (const auto& vector : vectors) {
+                for (uint32_t value : vector) {
+                    total += value;
+                }
+            }
+            sink += total;
+        });
+    });
+}
+
+void UnorderedMapBenchmarks(Runner& runner, double scale) {
+    const uint32_t count = Scaled(200000, scale);
+    // Handle values, as most of the maps of the layer are keyed by handles
+    std::vector<uint64_t> keys(count);
+    std::vector<uint64_t> missing_keys(count);
+    Random random(1);
+    for (uint32_t i = 0; i < count; ++i) {
+        keys[i] = random.Next();
+        missing_keys[i] = random.Next();
+    }
+    std::vector<uint64_t> shuffled = keys;
+    for (uint32_t i = count - 1; i > 0; --i) {
+        std::swap(shuffled[i], shuffled[random.Below(i + 1)]);
+    }
+    auto filled = [&keys]() {
+        vvl::unordered_map<uint64_t, uint64_t> map;
+        for (uint64_t key : keys) {
+            map.emplace(key, key);
+        }
+        return map;
+    };
+
+    runner.Run("unordered_map", "insert", [&keys](Batch& batch) {
+        vvl::unordered_map<uint64_t, uint64_t> map;
+        batch.Measure(keys.size(), [&]() {
+            for (uint64_t key : keys) {
+                map.emplace(key, key);
+            }
+        });
+        sink += map.size();
+    });
+
+    runner.Run("unordered_map", "find_hit", [&](Batch& batch) {
+        const auto map = filled();
+        batch.Measure(shuffled.size(), [&]() {
+            uint64_t total = 0;
+            for (uint64_t key : shuffled) {
+                total += map.find(key)->second;
+            }
+            sink += total;
+        });
+    });
+
+    runner.Run("unordered_map", "find_miss", [&](Batch& batch) {
+        const auto map = filled();
+        batch.Measure(missing_keys.size(), [&]() {
+            uint64_t found = 0;
+            for (uint64_t key : missing_keys) {
+                found += map.count(key);
+            }
+            sink += found;
+        });
+    });
+
+    runner.Run("unordered_map", "erase", [&](Batch& batch) {
+        auto map = filled();
+        batch.Measure(shuffled.size(), [&]() {
+            for (uint64_t key : shuffled) {
+                map.erase(key);
+            }
+        });
+        sink += map.size();
+    });
+
+    runner.Run("unordered_map", "iterate", [&](Batch& batch) {
+        const auto map = filled();
+        batch.Measure(map.size(), [&]() {
+            uint64_t total = 0;
+            for (const auto& [key, value] : map) {
+                total += value;
+            }
+            sink += total;
+        });
+    });
+}
+
+// Interning of layout definitions from parallel pipeline and layout creation: every thread looks up the same few hundred
+// definitions, so almost every lookup finds an existing entry
+void DictionaryBenchmarks(Runner& runner, double scale) {
+    using Def = std::vector<uint64_t>;
+    using Dict = hash_util::Dictionary<Def, hash_util::IsOrderedContainer<Def>>;
+    const uint32_t count = Scaled(200000, scale);
+    constexpr uint32_t kDefCount = 512;
+    std::vector<Def> defs(kDefCount);
+    Random random(2);
+    for (Def& def : defs) {
+        def.resize(1 + random.Below(8));
+        for (uint64_t& value : def) {
+            value = random.Next();
+        }
+    }
+
+    for (uint32_t thread_count : {1u, 2u, 4u, 8u, 16u}) {
+        runner.Run("dictionary", "lookup_" + std::to_string(thread_count) + "_threads", [&, thread_count](Batch& batch) {
+            Dict dict;
+            for (const Def& def : defs) {
+                dict.LookUp(def);
+            }
+            const uint32_t per_thread = count / thread_count;
+            batch.Measure(uint64_t(per_thread) * thread_count, [&]() {
+                std::vector<std::thread> threads;
+                for (uint32_t t = 0; t < thread_count; ++t) {
+                    threads.emplace_back([&, t]() {
+                        uint64_t total = 0;
+                        for (uint32_t i = 0; i < per_thread; ++i) {
+                            total += dict.LookUp(defs[(i * 7 + t) % kDefCount])->size();
+                        }
+                        sink += total;
+                    });
+                }
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+            });
+        });
+    }
+}
+
+using RangeMap = sparse_container::range_map<uint64_t, uint64_t>;
+using SegmentedRangeMap = sparse_container::range_map<uint64_t, uint64_t, vvl::range<uint64_t>,
+                                                      sparse_container::segmented_map<vvl::range<uint64_t>, uint64_t>>;
+
+void RangeMapBenchmarks(Runner& runner, double scale) {
+    const uint32_t count = Scaled(100000, scale);
+    constexpr uint64_t kStride = 256;
+    auto filled = [count](uint64_t size) {
+        RangeMap map;
+        for (uint64_t i = 0; i < count; ++i) {
+            map.insert(map.end(), std::make_pair(vvl::range<uint64_t>(i * kStride, i * kStride + size), i));
+        }
+        return map;
+    };
+
+    runner.Run("range_map", "insert_sequential", [count](Batch& batch) {
+        RangeMap map;
+        batch.Measure(count, [&]() {
+            for (uint64_t i = 0; i < count; ++i) {
+                map.insert(map.end(), std::make_pair(vvl::range<uint64_t>(i * kStride, i * kStride + 128), i));
+            }
+        });
+        sink += map.size();
+    });
+
+    runner.Run("range_map", "split", [&](Batch& batch) {
+        auto map = filled(kStride);
+        batch.Measure(count, [&]() {
+            for (auto it = map.begin(); it != map.end(); ++it) {
+                // Returns the lower half, skip over the upper one
+                it = map.split(it, it->first.begin + kStride / 2, sparse_container::split_op_keep_both());
+                ++it;
+            }
+        });
+        sink += map.size();
+    });
+
+    runner.Run("range_map", "lower_bound", [&](Batch& batch) {
+        auto map = filled(128);
+        std::vector<uint64_t> indices(count);
+        Random random(2);
+        for (uint64_t& index : indices) {
+            index = random.Below(count * kStride);
+        }
+        batch.Measure(count, [&]() {
+            uint64_t total = 0;
+            for (uint64_t index : indices) {
+                auto it = map.lower_bound(vvl::range<uint64_t>(index, index + 1));
+                total += (it != map.end()) ? it->second : 0;
+            }
+            sink += total;
+        });
+    });
+
+    runner.Run("range_map", "iterate", [&](Batch& batch) {
+        auto map = filled(128);
+        batch.Measure(map.size(), [&]() {
+            uint64_t total = 0;
+            for (const auto& [range, value] : map) {
+                total += value + range.begin;
+            }
+            sink += total;
+        });
+    });
+}
+
+// A recorded sequence of range map operations. In the trace files, one per line:
+//   a <begin> <end> <value>  access: infill_update_range, the gaps get value and existing entries add it (sync val accesses)
+//   b <begin> <end> <value>  barrier: infill_update_range that only updates existing entries (sync val barriers)
+//   u <begin> <end> <value>  update_range_value, overwriting what is there (image layout transitions)
+//   f <index>                find(index)
+//   c                        clear
+// Empty lines and lines starting with # are skipped
+struct TraceOp {
+    char type;
+    uint64_t begin;
+    uint64_t end;
+    uint64_t value;
+};
+
+struct Trace {
+    std::string name;
+    std::vector<TraceOp> ops;
+
+    void Add(char type, uint64_t begin, uint64_t end, uint64_t value) { ops.emplace_back(TraceOp{type, begin, end, value}); }
+
+    uint64_t Limit() const {
+        uint64_t limit = 0;
+        for (const TraceOp& op : ops) {
+            limit = std::max(limit, op.type == 'f' ? op.begin + 1 : op.end);
+        }
+        return limit;
+    }
+    // BothRangeMap has no split, so it only replays traces without a or b operations
+    bool UpdatesOnly() const {
+        return std::all_of(ops.begin(), ops.end(), [](const TraceOp& op) { return op.type != 'a' && op.type != 'b'; });
+    }
+};
+
+bool ReadTrace(const std::string& path, Trace& trace) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+    // The file name without directories and extension, prefixed to tell it apart from the generated traces
+    const size_t start = path.find_last_of("/\\") + 1;
+    const size_t dot = path.find_last_of('.');
+    trace.name = "trace:" + path.substr(start, (dot != std::string::npos && dot > start) ? dot - start : std::string::npos);
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream stream(line);
+        TraceOp op{};
+        stream >> op.type;
+        if (op.type == 'f') {
+            stream >> op.begin;
+        } else if (op.type != 'c') {
+            stream >> op.begin >> op.end >> op.value;
+        }
+        if (!stream || (op.type != 'a' && op.type != 'b' && op.type != 'u' && op.type != 'f' && op.type != 'c')) {
+            fprintf(stderr, "%s: cannot parse \"%s\"\n", path.c_str(), line.c_str());
+            return false;
+        }
+        trace.ops.emplace_back(op);
+    }
+    return true;
+}
+
+bool WriteTrace(const std::string& path, const Trace& trace) {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << "# " << trace.name << "\n";
+    for (const TraceOp& op : trace.ops) {
+        file << op.type;
+        if (op.type == 'f') {
+            file << ' ' << op.begin;
+        } else if (op.type != 'c') {
+            file << ' ' << op.begin << ' ' << op.end << ' ' << op.value;
+        }
+        file << '\n';
+    }
+    return bool(file);
+}
+
+// Like the ops of the sync val access updates: an access fills the gaps, a barrier (fill = false) leaves them alone
+struct TraceInfillOps {
+    uint64_t value;
+    bool fill;
+
+    template <typename Map, typename Iterator>
+    void infill(Map& map, const Iterator& pos, const typename Map::key_type& range) const {
+        if (fill) {
+            map.insert(pos, std::make_pair(range, value));
+        }
+    }
+    template <typename Iterator>
+    void update(const Iterator& pos) const {
+        pos->second += value;
+    }
+};
+
+template <typename Map>
+void Replay(const Trace& trace, Map& map) {
+    uint64_t found = 0;
+    for (const TraceOp& op : trace.ops) {
+        const vvl::range<uint64_t> range(op.begin, op.end);
+        switch (op.type) {
+            case 'a':
+            case 'b':
+                if constexpr (!std::is_same_v<Map, subresource_adapter::BothRangeMap<uint64_t, 16>>) {
+                    sparse_container::infill_update_range(map, range, TraceInfillOps{op.value, op.type == 'a'});
+                }
+                break;
+            case 'u':
+                sparse_container::update_range_value(map, range, op.value, sparse_container::value_precedence::prefer_source);
+                break;
+            case 'f': {
+                auto it = map.find(op.begin);
+                found += (it != map.end()) ? it->second : 0;
+                break;
+            }
+            case 'c':
+                map.clear();
+                break;
+        }
+    }
+    sink += found + map.size();
+}
+
+void TraceBenchmarks(Runner& runner, const Trace& trace) {
+    runner.Run(trace.name, "range_map", [&trace](Batch& batch) {
+        RangeMap map;
+        batch.Measure(trace.ops.size(), [&]() { Replay(trace, map); });
+    });
+    runner.Run(trace.name, "range_map_segmented", [&trace](Batch& batch) {
+        SegmentedRangeMap map;
+        batch.Measure(trace.ops.size(), [&]() { Replay(trace, map); });
+    });
+    if (trace.UpdatesOnly()) {
+        // Uses the small_range_map when the trace fits in it, as for the layout map of an image with few subresources
+        const uint64_t limit = trace.Limit();
+        runner.Run(trace.name, "both_range_map", [&trace, limit](Batch& batch) {
+            subresource_adapter::BothRangeMap<uint64_t, 16> map(limit);
+            batch.Measure(trace.ops.size(), [&]() { Replay(trace, map); });
+        });
+    }
+}
+
+// vkCmdCopyBuffer between scattered slices of two 32 MB buffers, with a barrier on both every 64 copies
+Trace SyncBufferCopiesTrace(double scale) {
+    Trace trace{"sync_buffer_copies", {}};
+    constexpr uint64_t kBufferSize = 32ull << 20;
+    constexpr uint64_t kSrcBase = 0;
+    constexpr uint64_t kDstBase = 64ull << 20;
+    Random random(3);
+    const uint32_t copies = Scaled(20000, scale);
+    for (uint32_t i = 0; i < copies; ++i) {
+        const uint64_t size = 256 * (1 + random.Below(256));
+        const uint64_t src = kSrcBase + 256 * random.Below((kBufferSize - size) / 256);
+        const uint64_t dst = kDstBase + 256 * random.Below((kBufferSize - size) / 256);
+        trace.Add('a', src, src + size, 1);
+        trace.Add('a', dst, dst + size, 2);
+        if (i % 64 == 63) {
+            trace.Add('b', kSrcBase, kSrcBase + kBufferSize, 4);
+            trace.Add('b', kDstBase, kDstBase + kBufferSize, 4);
+        }
+        if (i % 4096 == 4095) {
+            // A new command buffer
+            trace.Add('c', 0, 0, 0);
+        }
+    }
+    return trace;
+}
+
+// Layout transitions and clears of the subresources of an 8 mips, 32 layers image one at a time, as addresses of a linear
+// image: every subresource is a 64 KB range. A barrier on the whole image after each pass
+Trace SyncImageBarriersTrace(double scale) {
+    Trace trace{"sync_image_barriers", {}};
+    constexpr uint64_t kSubresources = 8 * 32;
+    constexpr uint64_t kSubresourceSize = 64 << 10;
+    const uint32_t passes = Scaled(40, scale);
+    for (uint32_t pass = 0; pass < passes; ++pass) {
+        for (uint64_t i = 0; i < kSubresources; ++i) {
+            trace.Add('b', i * kSubresourceSize, (i + 1) * kSubresourceSize, 1);
+            trace.Add('a', i * kSubresourceSize, (i + 1) * kSubresourceSize, 2);
+        }
+        trace.Add('b', 0, kSubresources * kSubresourceSize, 4);
+    }
+    return trace;
+}
+
+// Image layout map of an image with |mips| and |layers|, indexed as the subresource encoder does (mip major). Every pass
+// transitions the subresources one at a time, then looks up the layout of each, then transitions the whole image
+Trace ImageLayoutTrace(const char* name, uint64_t mips, uint64_t layers, double scale) {
+    Trace trace{name, {}};
+    const uint64_t subresources = mips * layers;
+    const uint32_t passes = Scaled(200, scale);
+    trace.Add('u', 0, subresources, 0);
+    for (uint32_t pass = 0; pass < passes; ++pass) {
+        const uint64_t layout = 1 + pass % 4;
+        for (uint64_t mip = 0; mip < mips; ++mip) {
+            // Layer ranges, as one barrier per mip level
+            trace.Add('u', mip * layers, (mip + 1) * layers, layout);
+        }
+        for (uint64_t i = 0; i < subresources; ++i) {
+            trace.Add('u', i, i + 1, layout + 4);
+            trace.Add('f', i, 0, 0);
+        }
+        trace.Add('u', 0, subresources, layout);
+        for (uint64_t i = 0; i < subresources; ++i) {
+            trace.Add('f', i, 0, 0);
+        }
+    }
+    return trace;
+}
+
+bool WriteJson(const std::string& path, const std::map<Runner::Key, Runner::Stats>& results) {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << "{\n  \"workloads\": [";
+    const char* separator = "\n";
+    for (const auto& [key, stats] : results) {
+        char values[256];
+        snprintf(values, sizeof(values),
+                 "\"count\": %llu, \"ops\": %llu, \"avg_ns\": %.2f, \"median_ns\": %.2f, \"min_ns\": %.2f, \"max_ns\": %.2f, "
+                 "\"ops_per_sec\": %.1f",
+                 static_cast<unsigned long long>(stats.count), static_cast<unsigned long long>(stats.ops), stats.avg_ns,
+                 stats.median_ns, stats.min_ns, stats.max_ns, stats.OpsPerSec());
+        // Benchmark names are plain identifiers, trace names are file names, nothing to escape in practice
+        file << separator << "    {\"workload\": \"" << key.workload << "\", \"entry_point\": \"" << key.entry_point << "\", "
+             << values << "}";
+        separator = ",\n";
+    }
+    file << "\n  ]\n}\n";
+    return bool(file);
+}
+
+void PrintResults(const std::map<Runner::Key, Runner::Stats>& results) {
+    printf("\n%-24s %-24s %10s %12s %12s %16s\n", "Workload", "Benchmark", "Ops", "Avg (ns/op)", "Median", "Ops/sec");
+    for (const auto& [key, stats] : results) {
+        printf("%-24s %-24s %10llu %12.2f %12.2f %16.1f\n", key.workload.c_str(), key.entry_point.c_str(),
+               static_cast<unsigned long long>(stats.ops), stats.avg_ns, stats.median_ns, stats.OpsPerSec());
+    }
+}
+
+void PrintUsage(const char* program) {
+    printf(
+        "Usage: %s [--json <file>] [--scale <factor>] [--repetitions <count>] [--filter <substring>]... [--trace <file>]...\n"
+        "          [--write-traces <directory>]\n",
+        program);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--json" && i + 1 < argc) {
+            options.json_path = argv[++i];
+        } else if (arg == "--scale" && i + 1 < argc) {
+            options.scale = atof(argv[++i]);
+        } else if (arg == "--repetitions" && i + 1 < argc) {
+            options.repetitions = uint32_t(atoi(argv[++i]));
+        } else if (arg == "--filter" && i + 1 < argc) {
+            options.filters.emplace_back(argv[++i]);
+        } else if (arg == "--trace" && i + 1 < argc) {
+            options.trace_paths.emplace_back(argv[++i]);
+        } else if (arg == "--write-traces" && i + 1 < argc) {
+            options.write_traces_dir = argv[++i];
+        } else {
+            PrintUsage(argv[0]);
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+    if (options.scale <= 0.0 || options.repetitions == 0) {
+        fprintf(stderr, "--scale and --repetitions must be positive\n");
+        return 1;
+    }
+
+    std::vector<Trace> traces;
+    traces.emplace_back(SyncBufferCopiesTrace(options.scale));
+    traces.emplace_back(SyncImageBarriersTrace(options.scale));
+    traces.emplace_back(ImageLayoutTrace("image_layout_8x32", 8, 32, options.scale));
+    traces.emplace_back(ImageLayoutTrace("image_layout_1x16", 1, 16, options.scale));
+    if (!options.write_traces_dir.empty()) {
+        for (const Trace& trace : traces) {
+            const std::string path = options.write_traces_dir + "/" + trace.name + ".trace";
+            if (!WriteTrace(path, trace)) {
+                fprintf(stderr, "Failed to write %s\n", path.c_str());
+                return 1;
+            }
+        }
+        return 0;
+    }
+    for (const std::string& path : options.trace_paths) {
+        Trace trace;
+        if (!ReadTrace(path, trace)) {
+            fprintf(stderr, "Failed to read %s\n", path.c_str());
+            return 1;
+        }
+        traces.emplace_back(std::move(trace));
+    }
+
+    Runner runner(options);
+    SmallVectorBenchmarks(runner, options.scale);
+    UnorderedMapBenchmarks(runner, options.scale);
+    DictionaryBenchmarks(runner, options.scale);
+    RangeMapBenchmarks(runner, options.scale);
+    for (const Trace& trace : traces) {
+        TraceBenchmarks(runner, trace);
+    }
+
+    PrintResults(runner.Results());
+    if (!options.json_path.empty() && !WriteJson(options.json_path, runner.Results())) {
+        fprintf(stderr, "Failed to write %s\n", options.json_path.c_str());
+        return 1;
+    }
+    return 0;
+}
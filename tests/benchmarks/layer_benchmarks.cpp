@@ -0,0 +1,1196 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+// Runs scripted workloads against the Test ICD, with and without the validation layer, and reports the cost of every
+// API call that was timed. Since the driver does (almost) nothing, the "with layers" numbers are the layer overhead.
+// See README.md for how to use the JSON output with layers/profiling/compare.py
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <initializer_list>
+#include <map>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "generated/vk_function_pointers.h"
+#include "vk_layer_config.h"
+
+namespace {
+
+constexpr const char* kValidationLayerName = "VK_LAYER_KHRONOS_validation";
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string json_path;
+    double scale = 1.0;
+    bool with_layers = true;
+    bool without_layers = true;
+};
+
+void Check(VkResult result, const char* what) {
+    if (result != VK_SUCCESS) {
+        fprintf(stderr, "%s failed with VkResult %d\n", what, int(result));
+        exit(1);
+    }
+}
+
+uint32_t Scaled(uint32_t count, double scale) { return std::max(1u, uint32_t(double(count) * scale)); }
+
+// Latency of every timed call, per workload and entry point
+class Recorder {
+  public:
+    using Samples = std::vector<uint64_t>;
+
+    void SetLayers(bool layers) { layers_ = layers; }
+    void SetWorkload(const char* workload) { workload_ = workload; }
+
+    // Look the samples up once before the hot loop, so the map lookup is not part of what is measured
+    Samples& Get(const char* entry_point) { return results_[{workload_, entry_point, layers_}]; }
+
+    template <typename Call>
+    static void Time(Samples& samples, Call&& call) {
+        const auto start = Clock::now();
+        call();
+        const auto elapsed = Clock::now() - start;
+        samples.emplace_back(uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+    struct Key {
+        std::string workload;
+        std::string entry_point;
+        bool layers;
+        bool operator<(const Key& other) const {
+            return std::tie(workload, entry_point, layers) < std::tie(other.workload, other.entry_point, other.layers);
+        }
+    };
+
+    struct Stats {
+        uint64_t count = 0;
+        double avg_ns = 0.0;
+        double median_ns = 0.0;
+        double min_ns = 0.0;
+        double max_ns = 0.0;
+        double CallsPerSec() const { return avg_ns > 0.0 ? 1e9 / avg_ns : 0.0; }
+    };
+
+    std::map<Key, Stats> Summarize() const {
+        std::map<Key, Stats> summary;
+        for (const auto& [key, samples] : results_) {
+            if (samples.empty()) {
+                continue;
+            }
+            Samples sorted = samples;
+            std::sort(sorted.begin(), sorted.end());
+            Stats& stats = summary[key];
+            stats.count = sorted.size();
+            double total = 0.0;
+            for (uint64_t ns : sorted) {
+                total += double(ns);
+            }
+            stats.avg_ns = total / double(sorted.size());
+            stats.median_ns = double(sorted[sorted.size() / 2]);
+            stats.min_ns = double(sorted.front());
+            stats.max_ns = double(sorted.back());
+        }
+        return summary;
+    }
+
+  private:
+    bool layers_ = false;
+    std::string workload_;
+    std::map<Key, Samples> results_;
+};
+
+VKAPI_ATTR VkBool32 VKAPI_CALL CountErrors(VkDebugUtilsMessageSeverityFlagBitsEXT severity, VkDebugUtilsMessageTypeFlagsEXT,
+                                           const VkDebugUtilsMessengerCallbackDataEXT* callback_data, void* user_data) {
+    if (severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) {
+        uint32_t& error_count = *static_cast<uint32_t*>(user_data);
+        // A workload that triggers errors measures the error reporting, not the validation, so make it visible
+        if (error_count++ == 0) {
+            fprintf(stderr, "Validation error: %s\n", callback_data->pMessage);
+        }
+    }
+    return VK_FALSE;
+}
+
+struct Context {
+    VkInstance instance = VK_NULL_HANDLE;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    VkPhysicalDevice gpu = VK_NULL_HANDLE;
+    VkPhysicalDeviceLimits limits = {};
+    VkPhysicalDeviceMemoryProperties memory_properties = {};
+    VkDevice device = VK_NULL_HANDLE;
+    // The second queue comes from another family when the device has more than one, otherwise it is the first queue
+    VkQueue queues[2] = {};
+    uint32_t graphics_family = 0;
+    bool timeline_semaphore = false;
+    bool update_after_bind = false;
+    uint32_t error_count = 0;
+
+    uint32_t MemoryType(uint32_t type_bits) const {
+        for (uint32_t i = 0; i < memory_properties.memoryTypeCount; ++i) {
+            if (type_bits & (1u << i)) {
+                return i;
+            }
+        }
+        fprintf(stderr, "No memory type for bits 0x%x\n", type_bits);
+        exit(1);
+    }
+};
+
+void CreateContext(bool layers, Context& ctx) {
+    VkApplicationInfo app_info = {VK_STRUCTURE_TYPE_APPLICATION_INFO};
+    app_info.pApplicationName = "vk_layer_benchmarks";
+    app_info.apiVersion = VK_API_VERSION_1_2;
+
+    const char* extension = VK_EXT_DEBUG_UTILS_EXTENSION_NAME;
+    VkInstanceCreateInfo instance_ci = {VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO};
+    instance_ci.pApplicationInfo = &app_info;
+    if (layers) {
+        instance_ci.enabledLayerCount = 1;
+        instance_ci.ppEnabledLayerNames = &kValidationLayerName;
+        instance_ci.enabledExtensionCount = 1;
+        instance_ci.ppEnabledExtensionNames = &extension;
+    }
+    Check(vk::CreateInstance(&instance_ci, nullptr, &ctx.instance), "vkCreateInstance");
+
+    if (layers) {
+        vk::InitInstanceExtension(ctx.instance, VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+        VkDebugUtilsMessengerCreateInfoEXT messenger_ci = {VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT};
+        messenger_ci.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+        messenger_ci.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+        messenger_ci.pfnUserCallback = CountErrors;
+        messenger_ci.pUserData = &ctx.error_count;
+        Check(vk::CreateDebugUtilsMessengerEXT(ctx.instance, &messenger_ci, nullptr, &ctx.messenger),
+              "vkCreateDebugUtilsMessengerEXT");
+    }
+
+    uint32_t gpu_count = 1;
+    const VkResult result = vk::EnumeratePhysicalDevices(ctx.instance, &gpu_count, &ctx.gpu);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || gpu_count == 0) {
+        fprintf(stderr, "No physical device found, is VK_DRIVER_FILES pointing at the Test ICD?\n");
+        exit(1);
+    }
+    VkPhysicalDeviceProperties properties;
+    vk::GetPhysicalDeviceProperties(ctx.gpu, &properties);
+    ctx.limits = properties.limits;
+    vk::GetPhysicalDeviceMemoryProperties(ctx.gpu, &ctx.memory_properties);
+
+    VkPhysicalDeviceDescriptorIndexingFeatures indexing_features = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES};
+    VkPhysicalDeviceTimelineSemaphoreFeatures timeline_features = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES,
+                                                                   &indexing_features};
+    VkPhysicalDeviceFeatures2 features2 = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2, &timeline_features};
+    vk::GetPhysicalDeviceFeatures2(ctx.gpu, &features2);
+    ctx.timeline_semaphore = timeline_features.timelineSemaphore;
+    ctx.update_after_bind =
+        indexing_features.descriptorBindingStorageBufferUpdateAfterBind && indexing_features.descriptorBindingPartiallyBound;
+
+    // Only turn on what the workloads use, so the layer does not do extra work for features nobody asked for
+    VkPhysicalDeviceDescriptorIndexingFeatures enabled_indexing = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES};
+    enabled_indexing.descriptorBindingStorageBufferUpdateAfterBind = ctx.update_after_bind;
+    enabled_indexing.descriptorBindingPartiallyBound = ctx.update_after_bind;
+    VkPhysicalDeviceTimelineSemaphoreFeatures enabled_timeline = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES,
+                                                                  &enabled_indexing};
+    enabled_timeline.timelineSemaphore = ctx.timeline_semaphore;
+
+    uint32_t family_count = 0;
+    vk::GetPhysicalDeviceQueueFamilyProperties(ctx.gpu, &family_count, nullptr);
+    std::vector<VkQueueFamilyProperties> families(family_count);
+    vk::GetPhysicalDeviceQueueFamilyProperties(ctx.gpu, &family_count, families.data());
+    uint32_t second_family = UINT32_MAX;
+    for (uint32_t i = 0; i < family_count; ++i) {
+        if (families[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) {
+            ctx.graphics_family = i;
+            break;
+        }
+    }
+    for (uint32_t i = 0; i < family_count; ++i) {
+        if (i != ctx.graphics_family && families[i].queueCount > 0) {
+            second_family = i;
+            break;
+        }
+    }
+
+    const float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_cis[2] = {};
+    for (VkDeviceQueueCreateInfo& queue_ci : queue_cis) {
+        queue_ci.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queue_ci.queueCount = 1;
+        queue_ci.pQueuePriorities = &priority;
+    }
+    queue_cis[0].queueFamilyIndex = ctx.graphics_family;
+    queue_cis[1].queueFamilyIndex = second_family;
+
+    VkDeviceCreateInfo device_ci = {VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO, &enabled_timeline};
+    device_ci.queueCreateInfoCount = second_family == UINT32_MAX ? 1 : 2;
+    device_ci.pQueueCreateInfos = queue_cis;
+    Check(vk::CreateDevice(ctx.gpu, &device_ci, nullptr, &ctx.device), "vkCreateDevice");
+
+    vk::GetDeviceQueue(ctx.device, ctx.graphics_family, 0, &ctx.queues[0]);
+    ctx.queues[1] = ctx.queues[0];
+    if (second_family != UINT32_MAX) {
+        vk::GetDeviceQueue(ctx.device, second_family, 0, &ctx.queues[1]);
+    }
+}
+
+void DestroyContext(Context& ctx) {
+    vk::DeviceWaitIdle(ctx.device);
+    vk::DestroyDevice(ctx.device, nullptr);
+    if (ctx.messenger != VK_NULL_HANDLE) {
+        vk::DestroyDebugUtilsMessengerEXT(ctx.instance, ctx.messenger, nullptr);
+    }
+    vk::DestroyInstance(ctx.instance, nullptr);
+    ctx = Context();
+}
+
+struct Buffer {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+
+    void Create(const Context& ctx, VkDeviceSize size, VkBufferUsageFlags usage) {
+        VkBufferCreateInfo buffer_ci = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+        buffer_ci.size = size;
+        buffer_ci.usage = usage;
+        Check(vk::CreateBuffer(ctx.device, &buffer_ci, nullptr, &buffer), "vkCreateBuffer");
+        VkMemoryRequirements requirements;
+        vk::GetBufferMemoryRequirements(ctx.device, buffer, &requirements);
+        VkMemoryAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+        alloc_info.allocationSize = requirements.size;
+        alloc_info.memoryTypeIndex = ctx.MemoryType(requirements.memoryTypeBits);
+        Check(vk::AllocateMemory(ctx.device, &alloc_info, nullptr, &memory), "vkAllocateMemory");
+        Check(vk::BindBufferMemory(ctx.device, buffer, memory, 0), "vkBindBufferMemory");
+    }
+    void Destroy(const Context& ctx) {
+        vk::DestroyBuffer(ctx.device, buffer, nullptr);
+        vk::FreeMemory(ctx.device, memory, nullptr);
+    }
+};
+
+// #version 460
+// void main() { gl_Position = vec4(1); }
+const uint32_t kVertexSpirV[166] = {
+    0x07230203, 0x00010000, 0x0008000a, 0x00000014, 0x00000000, 0x00020011, 0x00000001, 0x0006000b, 0x00000001, 0x4c534c47,
+    0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001, 0x0006000f, 0x00000000, 0x00000004, 0x6e69616d,
+    0x00000000, 0x0000000d, 0x00030003, 0x00000002, 0x000001cc, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00060005,
+    0x0000000b, 0x505f6c67, 0x65567265, 0x78657472, 0x00000000, 0x00060006, 0x0000000b, 0x00000000, 0x505f6c67, 0x7469736f,
+    0x006e6f69, 0x00070006, 0x0000000b, 0x00000001, 0x505f6c67, 0x746e696f, 0x657a6953, 0x00000000, 0x00070006, 0x0000000b,
+    0x00000002, 0x435f6c67, 0x4470696c, 0x61747369, 0x0065636e, 0x00070006, 0x0000000b, 0x00000003, 0x435f6c67, 0x446c6c75,
+    0x61747369, 0x0065636e, 0x00030005, 0x0000000d, 0x00000000, 0x00050048, 0x0000000b, 0x00000000, 0x0000000b, 0x00000000,
+    0x00050048, 0x0000000b, 0x00000001, 0x0000000b, 0x00000001, 0x00050048, 0x0000000b, 0x00000002, 0x0000000b, 0x00000003,
+    0x00050048, 0x0000000b, 0x00000003, 0x0000000b, 0x00000004, 0x00030047, 0x0000000b, 0x00000002, 0x00020013, 0x00000002,
+    0x00030021, 0x00000003, 0x00000002, 0x00030016, 0x00000006, 0x00000020, 0x00040017, 0x00000007, 0x00000006, 0x00000004,
+    0x00040015, 0x00000008, 0x00000020, 0x00000000, 0x0004002b, 0x00000008, 0x00000009, 0x00000001, 0x0004001c, 0x0000000a,
+    0x00000006, 0x00000009, 0x0006001e, 0x0000000b, 0x00000007, 0x00000006, 0x0000000a, 0x0000000a, 0x00040020, 0x0000000c,
+    0x00000003, 0x0000000b, 0x0004003b, 0x0000000c, 0x0000000d, 0x00000003, 0x00040015, 0x0000000e, 0x00000020, 0x00000001,
+    0x0004002b, 0x0000000e, 0x0000000f, 0x00000000, 0x0004002b, 0x00000006, 0x00000010, 0x3f800000, 0x0007002c, 0x00000007,
+    0x00000011, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00040020, 0x00000012, 0x00000003, 0x00000007, 0x00050036,
+    0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x00050041, 0x00000012, 0x00000013, 0x0000000d,
+    0x0000000f, 0x0003003e, 0x00000013, 0x00000011, 0x000100fd, 0x00010038};
+
+// #version 460
+// layout(location = 0) out vec4 color;
+// void main() { color = vec4(1); }
+const uint32_t kFragmentSpirV[83] = {
+    0x07230203, 0x00010000, 0x0008000a, 0x0000000c, 0x00000000, 0x00020011, 0x00000001, 0x0006000b, 0x00000001, 0x4c534c47,
+    0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001, 0x0006000f, 0x00000004, 0x00000004, 0x6e69616d,
+    0x00000000, 0x00000009, 0x00030010, 0x00000004, 0x00000007, 0x00030003, 0x00000002, 0x000001cc, 0x00040005, 0x00000004,
+    0x6e69616d, 0x00000000, 0x00040005, 0x00000009, 0x6f6c6f63, 0x00000072, 0x00040047, 0x00000009, 0x0000001e, 0x00000000,
+    0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002, 0x00030016, 0x00000006, 0x00000020, 0x00040017, 0x00000007,
+    0x00000006, 0x00000004, 0x00040020, 0x00000008, 0x00000003, 0x00000007, 0x0004003b, 0x00000008, 0x00000009, 0x00000003,
+    0x0004002b, 0x00000006, 0x0000000a, 0x3f800000, 0x0007002c, 0x00000007, 0x0000000b, 0x0000000a, 0x0000000a, 0x0000000a,
+    0x0000000a, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0003003e, 0x00000009,
+    0x0000000b, 0x000100fd, 0x00010038};
+
+constexpr uint32_t kRenderSize = 64;
+
+// Render pass, pipeline layout (one set with a uniform buffer) and the fixed function state shared by the graphics workloads
+struct GraphicsSetup {
+    VkRenderPass render_pass = VK_NULL_HANDLE;
+    VkDescriptorSetLayout set_layout = VK_NULL_HANDLE;
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+
+    VkPipelineShaderStageCreateInfo stages[2] = {};
+    VkPipelineVertexInputStateCreateInfo vertex_input = {VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO};
+    VkPipelineInputAssemblyStateCreateInfo input_assembly = {VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO};
+    VkViewport viewport = {0.0f, 0.0f, float(kRenderSize), float(kRenderSize), 0.0f, 1.0f};
+    VkRect2D scissor = {{0, 0}, {kRenderSize, kRenderSize}};
+    VkPipelineViewportStateCreateInfo viewport_state = {VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO};
+    VkPipelineRasterizationStateCreateInfo rasterization = {VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO};
+    VkPipelineMultisampleStateCreateInfo multisample = {VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO};
+    VkPipelineColorBlendAttachmentState blend_attachment = {};
+    VkPipelineColorBlendStateCreateInfo color_blend = {VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO};
+
+    void Create(const Context& ctx) {
+        VkAttachmentDescription attachment = {};
+        attachment.format = VK_FORMAT_R8G8B8A8_UNORM;
+        attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+        attachment.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        attachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        VkAttachmentReference color_ref = {0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+        VkSubpassDescription subpass = {};
+        subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        subpass.colorAttachmentCount = 1;
+        subpass.pColorAttachments = &color_ref;
+        VkRenderPassCreateInfo render_pass_ci = {VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO};
+        render_pass_ci.attachmentCount = 1;
+        render_pass_ci.pAttachments = &attachment;
+        render_pass_ci.subpassCount = 1;
+        render_pass_ci.pSubpasses = &subpass;
+        Check(vk::CreateRenderPass(ctx.device, &render_pass_ci, nullptr, &render_pass), "vkCreateRenderPass");
+
+        VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr};
+        VkDescriptorSetLayoutCreateInfo set_layout_ci = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
+        set_layout_ci.bindingCount = 1;
+        set_layout_ci.pBindings = &binding;
+        Check(vk::CreateDescriptorSetLayout(ctx.device, &set_layout_ci, nullptr, &set_layout), "vkCreateDescriptorSetLayout");
+        VkPipelineLayoutCreateInfo pipeline_layout_ci = {VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO};
+        pipeline_layout_ci.setLayoutCount = 1;
+        pipeline_layout_ci.pSetLayouts = &set_layout;
+        Check(vk::CreatePipelineLayout(ctx.device, &pipeline_layout_ci, nullptr, &pipeline_layout), "vkCreatePipelineLayout");
+
+        for (VkPipelineShaderStageCreateInfo& stage : stages) {
+            stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+            stage.pName = "main";
+        }
+        stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+        stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+        input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        viewport_state.viewportCount = 1;
+        viewport_state.pViewports = &viewport;
+        viewport_state.scissorCount = 1;
+        viewport_state.pScissors = &scissor;
+        rasterization.polygonMode = VK_POLYGON_MODE_FILL;
+        rasterization.cullMode = VK_CULL_MODE_NONE;
+        rasterization.lineWidth = 1.0f;
+        multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+        blend_attachment.colorWriteMask =
+            VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+        color_blend.attachmentCount = 1;
+        color_blend.pAttachments = &blend_attachment;
+    }
+
+    static VkShaderModuleCreateInfo ShaderModuleCreateInfo(bool vertex) {
+        VkShaderModuleCreateInfo module_ci = {VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
+        module_ci.codeSize = vertex ? sizeof(kVertexSpirV) : sizeof(kFragmentSpirV);
+        module_ci.pCode = vertex ? kVertexSpirV : kFragmentSpirV;
+        return module_ci;
+    }
+
+    // The returned create info points into this object
+    VkGraphicsPipelineCreateInfo PipelineCreateInfo(VkShaderModule vertex, VkShaderModule fragment) {
+        stages[0].module = vertex;
+        stages[1].module = fragment;
+        VkGraphicsPipelineCreateInfo pipeline_ci = {VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+        pipeline_ci.stageCount = 2;
+        pipeline_ci.pStages = stages;
+        pipeline_ci.pVertexInputState = &vertex_input;
+        pipeline_ci.pInputAssemblyState = &input_assembly;
+        pipeline_ci.pViewportState = &viewport_state;
+        pipeline_ci.pRasterizationState = &rasterization;
+        pipeline_ci.pMultisampleState = &multisample;
+        pipeline_ci.pColorBlendState = &color_blend;
+        pipeline_ci.layout = pipeline_layout;
+        pipeline_ci.renderPass = render_pass;
+        return pipeline_ci;
+    }
+
+    void Destroy(const Context& ctx) {
+        vk::DestroyPipelineLayout(ctx.device, pipeline_layout, nullptr);
+        vk::DestroyDescriptorSetLayout(ctx.device, set_layout, nullptr);
+        vk::DestroyRenderPass(ctx.device, render_pass, nullptr);
+    }
+};
+
+// Records draws that alternate between two descriptor sets, then submits them
+void DrawRebind(Context& ctx, Recorder& recorder, double scale) {
+    constexpr uint32_t kFrames = 4;
+    const uint32_t draws_per_frame = (Scaled(100000, scale) + kFrames - 1) / kFrames;
+
+    GraphicsSetup setup;
+    setup.Create(ctx);
+    VkShaderModule modules[2];
+    for (uint32_t i = 0; i < 2; ++i) {
+        const VkShaderModuleCreateInfo module_ci = GraphicsSetup::ShaderModuleCreateInfo(i == 0);
+        Check(vk::CreateShaderModule(ctx.device, &module_ci, nullptr, &modules[i]), "vkCreateShaderModule");
+    }
+    const VkGraphicsPipelineCreateInfo pipeline_ci = setup.PipelineCreateInfo(modules[0], modules[1]);
+    VkPipeline pipeline;
+    Check(vk::CreateGraphicsPipelines(ctx.device, VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &pipeline),
+          "vkCreateGraphicsPipelines");
+
+    VkImageCreateInfo image_ci = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+    image_ci.imageType = VK_IMAGE_TYPE_2D;
+    image_ci.format = VK_FORMAT_R8G8B8A8_UNORM;
+    image_ci.extent = {kRenderSize, kRenderSize, 1};
+    image_ci.mipLevels = 1;
+    image_ci.arrayLayers = 1;
+    image_ci.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_ci.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_ci.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    VkImage image;
+    Check(vk::CreateImage(ctx.device, &image_ci, nullptr, &image), "vkCreateImage");
+    VkMemoryRequirements requirements;
+    vk::GetImageMemoryRequirements(ctx.device, image, &requirements);
+    VkMemoryAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+    alloc_info.allocationSize = requirements.size;
+    alloc_info.memoryTypeIndex = ctx.MemoryType(requirements.memoryTypeBits);
+    VkDeviceMemory image_memory;
+    Check(vk::AllocateMemory(ctx.device, &alloc_info, nullptr, &image_memory), "vkAllocateMemory");
+    Check(vk::BindImageMemory(ctx.device, image, image_memory, 0), "vkBindImageMemory");
+    VkImageViewCreateInfo view_ci = {VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO};
+    view_ci.image = image;
+    view_ci.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    view_ci.format = VK_FORMAT_R8G8B8A8_UNORM;
+    view_ci.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    VkImageView view;
+    Check(vk::CreateImageView(ctx.device, &view_ci, nullptr, &view), "vkCreateImageView");
+    VkFramebufferCreateInfo framebuffer_ci = {VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO};
+    framebuffer_ci.renderPass = setup.render_pass;
+    framebuffer_ci.attachmentCount = 1;
+    framebuffer_ci.pAttachments = &view;
+    framebuffer_ci.width = kRenderSize;
+    framebuffer_ci.height = kRenderSize;
+    framebuffer_ci.layers = 1;
+    VkFramebuffer framebuffer;
+    Check(vk::CreateFramebuffer(ctx.device, &framebuffer_ci, nullptr, &framebuffer), "vkCreateFramebuffer");
+
+    const VkDeviceSize uniform_stride = std::max<VkDeviceSize>(256, ctx.limits.minUniformBufferOffsetAlignment);
+    Buffer uniforms;
+    uniforms.Create(ctx, 2 * uniform_stride, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    VkDescriptorPoolSize pool_size = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2};
+    VkDescriptorPoolCreateInfo pool_ci = {VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO};
+    pool_ci.maxSets = 2;
+    pool_ci.poolSizeCount = 1;
+    pool_ci.pPoolSizes = &pool_size;
+    VkDescriptorPool pool;
+    Check(vk::CreateDescriptorPool(ctx.device, &pool_ci, nullptr, &pool), "vkCreateDescriptorPool");
+    const VkDescriptorSetLayout set_layouts[2] = {setup.set_layout, setup.set_layout};
+    VkDescriptorSetAllocateInfo set_ai = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
+    set_ai.descriptorPool = pool;
+    set_ai.descriptorSetCount = 2;
+    set_ai.pSetLayouts = set_layouts;
+    VkDescriptorSet sets[2];
+    Check(vk::AllocateDescriptorSets(ctx.device, &set_ai, sets), "vkAllocateDescriptorSets");
+    VkDescriptorBufferInfo buffer_infos[2];
+    VkWriteDescriptorSet writes[2];
+    for (uint32_t i = 0; i < 2; ++i) {
+        buffer_infos[i] = {uniforms.buffer, i * uniform_stride, uniform_stride};
+        writes[i] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+        writes[i].dstSet = sets[i];
+        writes[i].descriptorCount = 1;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        writes[i].pBufferInfo = &buffer_infos[i];
+    }
+    vk::UpdateDescriptorSets(ctx.device, 2, writes, 0, nullptr);
+
+    VkCommandPoolCreateInfo command_pool_ci = {VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO};
+    command_pool_ci.queueFamilyIndex = ctx.graphics_family;
+    VkCommandPool command_pool;
+    Check(vk::CreateCommandPool(ctx.device, &command_pool_ci, nullptr, &command_pool), "vkCreateCommandPool");
+    VkCommandBufferAllocateInfo command_buffer_ai = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO};
+    command_buffer_ai.commandPool = command_pool;
+    command_buffer_ai.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    command_buffer_ai.commandBufferCount = 1;
+    VkCommandBuffer cb;
+    Check(vk::AllocateCommandBuffers(ctx.device, &command_buffer_ai, &cb), "vkAllocateCommandBuffers");
+
+    auto& begin_samples = recorder.Get("vkBeginCommandBuffer");
+    auto& begin_rp_samples = recorder.Get("vkCmdBeginRenderPass");
+    auto& bind_pipeline_samples = recorder.Get("vkCmdBindPipeline");
+    auto& bind_sets_samples = recorder.Get("vkCmdBindDescriptorSets");
+    auto& draw_samples = recorder.Get("vkCmdDraw");
+    auto& end_rp_samples = recorder.Get("vkCmdEndRenderPass");
+    auto& end_samples = recorder.Get("vkEndCommandBuffer");
+    auto& submit_samples = recorder.Get("vkQueueSubmit");
+    auto& wait_samples = recorder.Get("vkQueueWaitIdle");
+    auto& reset_samples = recorder.Get("vkResetCommandPool");
+    draw_samples.reserve(size_t(draws_per_frame) * kFrames);
+    bind_sets_samples.reserve(size_t(draws_per_frame) * kFrames);
+
+    VkResult result = VK_SUCCESS;
+    for (uint32_t frame = 0; frame < kFrames; ++frame) {
+        const VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO, nullptr,
+                                                     VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, nullptr};
+        Recorder::Time(begin_samples, [&]() { result = vk::BeginCommandBuffer(cb, &begin_info); });
+        Check(result, "vkBeginCommandBuffer");
+        VkRenderPassBeginInfo rp_begin = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO};
+        rp_begin.renderPass = setup.render_pass;
+        rp_begin.framebuffer = framebuffer;
+        rp_begin.renderArea = setup.scissor;
+        Recorder::Time(begin_rp_samples, [&]() { vk::CmdBeginRenderPass(cb, &rp_begin, VK_SUBPASS_CONTENTS_INLINE); });
+        Recorder::Time(bind_pipeline_samples, [&]() { vk::CmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline); });
+        for (uint32_t draw = 0; draw < draws_per_frame; ++draw) {
+            Recorder::Time(bind_sets_samples, [&]() {
+                vk::CmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, setup.pipeline_layout, 0, 1, &sets[draw % 2], 0,
+                                          nullptr);
+            });
+            Recorder::Time(draw_samples, [&]() { vk::CmdDraw(cb, 3, 1, 0, 0); });
+        }
+        Recorder::Time(end_rp_samples, [&]() { vk::CmdEndRenderPass(cb); });
+        Recorder::Time(end_samples, [&]() { result = vk::EndCommandBuffer(cb); });
+        Check(result, "vkEndCommandBuffer");
+
+        VkSubmitInfo submit = {VK_STRUCTURE_TYPE_SUBMIT_INFO};
+        submit.commandBufferCount = 1;
+        submit.pCommandBuffers = &cb;
+        Recorder::Time(submit_samples, [&]() { result = vk::QueueSubmit(ctx.queues[0], 1, &submit, VK_NULL_HANDLE); });
+        Check(result, "vkQueueSubmit");
+        Recorder::Time(wait_samples, [&]() { result = vk::QueueWaitIdle(ctx.queues[0]); });
+        Check(result, "vkQueueWaitIdle");
+        Recorder::Time(reset_samples, [&]() { result = vk::ResetCommandPool(ctx.device, command_pool, 0); });
+        Check(result, "vkResetCommandPool");
+    }
+
+    vk::DestroyCommandPool(ctx.device, command_pool, nullptr);
+    vk::DestroyDescriptorPool(ctx.device, pool, nullptr);
+    uniforms.Destroy(ctx);
+    vk::DestroyFramebuffer(ctx.device, framebuffer, nullptr);
+    vk::DestroyImageView(ctx.device, view, nullptr);
+    vk::DestroyImage(ctx.device, image, nullptr);
+    vk::FreeMemory(ctx.device, image_memory, nullptr);
+    vk::DestroyPipeline(ctx.device, pipeline, nullptr);
+    for (VkShaderModule module : modules) {
+        vk::DestroyShaderModule(ctx.device, module, nullptr);
+    }
+    setup.Destroy(ctx);
+}
+
+// Rewrites slices of a large storage buffer array, update-after-bind when the device supports it
+void BindlessUpdate(Context& ctx, Recorder& recorder, double scale) {
+    constexpr uint32_t kArraySize = 1024;
+    constexpr uint32_t kWritesPerUpdate = 64;
+    const uint32_t updates = Scaled(20000, scale);
+
+    const VkDescriptorBindingFlags binding_flags =
+        VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT;
+    VkDescriptorSetLayoutBindingFlagsCreateInfo binding_flags_ci = {
+        VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO};
+    binding_flags_ci.bindingCount = 1;
+    binding_flags_ci.pBindingFlags = &binding_flags;
+    VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, kArraySize, VK_SHADER_STAGE_ALL, nullptr};
+    VkDescriptorSetLayoutCreateInfo set_layout_ci = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
+    set_layout_ci.bindingCount = 1;
+    set_layout_ci.pBindings = &binding;
+    if (ctx.update_after_bind) {
+        set_layout_ci.pNext = &binding_flags_ci;
+        set_layout_ci.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+    }
+    VkDescriptorSetLayout set_layout;
+    Check(vk::CreateDescriptorSetLayout(ctx.device, &set_layout_ci, nullptr, &set_layout), "vkCreateDescriptorSetLayout");
+
+    VkDescriptorPoolSize pool_size = {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, kArraySize};
+    VkDescriptorPoolCreateInfo pool_ci = {VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO};
+    pool_ci.flags = ctx.update_after_bind ? VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT : 0;
+    pool_ci.maxSets = 1;
+    pool_ci.poolSizeCount = 1;
+    pool_ci.pPoolSizes = &pool_size;
+    VkDescriptorPool pool;
+    Check(vk::CreateDescriptorPool(ctx.device, &pool_ci, nullptr, &pool), "vkCreateDescriptorPool");
+    VkDescriptorSetAllocateInfo set_ai = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
+    set_ai.descriptorPool = pool;
+    set_ai.descriptorSetCount = 1;
+    set_ai.pSetLayouts = &set_layout;
+    VkDescriptorSet set;
+    Check(vk::AllocateDescriptorSets(ctx.device, &set_ai, &set), "vkAllocateDescriptorSets");
+
+    const VkDeviceSize stride = std::max<VkDeviceSize>(64, ctx.limits.minStorageBufferOffsetAlignment);
+    Buffer storage;
+    storage.Create(ctx, kArraySize * stride, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    std::vector<VkDescriptorBufferInfo> buffer_infos(kArraySize);
+    for (uint32_t i = 0; i < kArraySize; ++i) {
+        buffer_infos[i] = {storage.buffer, i * stride, stride};
+    }
+
+    auto& update_samples = recorder.Get("vkUpdateDescriptorSets");
+    update_samples.reserve(updates);
+    for (uint32_t i = 0; i < updates; ++i) {
+        const uint32_t first = (i * kWritesPerUpdate) % kArraySize;
+        VkWriteDescriptorSet write = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+        write.dstSet = set;
+        write.dstArrayElement = first;
+        write.descriptorCount = kWritesPerUpdate;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        // Rotate which buffer range goes in which element, so every update actually changes the descriptors
+        const uint32_t source = (first + (i / (kArraySize / kWritesPerUpdate)) * kWritesPerUpdate) % kArraySize;
+        write.pBufferInfo = &buffer_infos[source];
+        Recorder::Time(update_samples, [&]() { vk::UpdateDescriptorSets(ctx.device, 1, &write, 0, nullptr); });
+    }
+
+    vk::DestroyDescriptorPool(ctx.device, pool, nullptr);
+    vk::DestroyDescriptorSetLayout(ctx.device, set_layout, nullptr);
+    storage.Destroy(ctx);
+}
+
+// Ping-pongs submits between two queues, each one waiting on the timeline value signaled by the previous one
+void TimelineSubmit(Context& ctx, Recorder& recorder, double scale) {
+    if (!ctx.timeline_semaphore) {
+        printf("Skipping timeline_submit, timelineSemaphore is not supported\n");
+        return;
+    }
+    constexpr uint32_t kWaitInterval = 64;
+    const uint32_t submits = Scaled(20000, scale);
+
+    VkSemaphoreTypeCreateInfo type_ci = {VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO};
+    type_ci.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    VkSemaphoreCreateInfo semaphore_ci = {VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO, &type_ci};
+    VkSemaphore semaphore;
+    Check(vk::CreateSemaphore(ctx.device, &semaphore_ci, nullptr, &semaphore), "vkCreateSemaphore");
+
+    auto& submit_samples = recorder.Get("vkQueueSubmit");
+    auto& wait_samples = recorder.Get("vkWaitSemaphores");
+    submit_samples.reserve(submits);
+
+    VkResult result = VK_SUCCESS;
+    for (uint32_t i = 0; i < submits; ++i) {
+        const uint64_t wait_value = i;
+        const uint64_t signal_value = i + 1;
+        const VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        VkTimelineSemaphoreSubmitInfo timeline_info = {VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO};
+        timeline_info.waitSemaphoreValueCount = i > 0 ? 1 : 0;
+        timeline_info.pWaitSemaphoreValues = &wait_value;
+        timeline_info.signalSemaphoreValueCount = 1;
+        timeline_info.pSignalSemaphoreValues = &signal_value;
+        VkSubmitInfo submit = {VK_STRUCTURE_TYPE_SUBMIT_INFO, &timeline_info};
+        submit.waitSemaphoreCount = timeline_info.waitSemaphoreValueCount;
+        submit.pWaitSemaphores = &semaphore;
+        submit.pWaitDstStageMask = &wait_stage;
+        submit.signalSemaphoreCount = 1;
+        submit.pSignalSemaphores = &semaphore;
+        Recorder::Time(submit_samples, [&]() { result = vk::QueueSubmit(ctx.queues[i % 2], 1, &submit, VK_NULL_HANDLE); });
+        Check(result, "vkQueueSubmit");
+
+        if ((i + 1) % kWaitInterval == 0) {
+            VkSemaphoreWaitInfo wait_info = {VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO};
+            wait_info.semaphoreCount = 1;
+            wait_info.pSemaphores = &semaphore;
+            wait_info.pValues = &signal_value;
+            Recorder::Time(wait_samples, [&]() { result = vk::WaitSemaphores(ctx.device, &wait_info, UINT64_MAX); });
+            Check(result, "vkWaitSemaphores");
+        }
+    }
+
+    for (VkQueue queue : ctx.queues) {
+        Check(vk::QueueWaitIdle(queue), "vkQueueWaitIdle");
+    }
+    vk::DestroySemaphore(ctx.device, semaphore, nullptr);
+}
+
+// Bursts of shader module and pipeline creation, as seen while loading a level
+void PipelineBurst(Context& ctx, Recorder& recorder, double scale) {
+    constexpr uint32_t kPipelinesPerCall = 32;
+    const uint32_t bursts = Scaled(200, scale);
+
+    GraphicsSetup setup;
+    setup.Create(ctx);
+    auto& module_samples = recorder.Get("vkCreateShaderModule");
+    auto& create_samples = recorder.Get("vkCreateGraphicsPipelines");
+    auto& destroy_samples = recorder.Get("vkDestroyPipeline");
+    auto& destroy_module_samples = recorder.Get("vkDestroyShaderModule");
+
+    VkResult result = VK_SUCCESS;
+    std::vector<VkGraphicsPipelineCreateInfo> pipeline_cis(kPipelinesPerCall);
+    std::vector<VkPipeline> pipelines(kPipelinesPerCall);
+    for (uint32_t burst = 0; burst < bursts; ++burst) {
+        VkShaderModule modules[2];
+        for (uint32_t i = 0; i < 2; ++i) {
+            const VkShaderModuleCreateInfo module_ci = GraphicsSetup::ShaderModuleCreateInfo(i == 0);
+            Recorder::Time(module_samples,
+                           [&]() { result = vk::CreateShaderModule(ctx.device, &module_ci, nullptr, &modules[i]); });
+            Check(result, "vkCreateShaderModule");
+        }
+        std::fill(pipeline_cis.begin(), pipeline_cis.end(), setup.PipelineCreateInfo(modules[0], modules[1]));
+        Recorder::Time(create_samples, [&]() {
+            result = vk::CreateGraphicsPipelines(ctx.device, VK_NULL_HANDLE, kPipelinesPerCall, pipeline_cis.data(), nullptr,
+                                                 pipelines.data());
+        });
+        Check(result, "vkCreateGraphicsPipelines");
+        for (VkPipeline pipeline : pipelines) {
+            Recorder::Time(destroy_samples, [&]() { vk::DestroyPipeline(ctx.device, pipeline, nullptr); });
+        }
+        for (VkShaderModule module : modules) {
+            Recorder::Time(destroy_module_samples, [&]() { vk::DestroyShaderModule(ctx.device, module, nullptr); });
+        }
+    }
+    setup.Destroy(ctx);
+}
+
+// Command buffer that is recorded, submitted and waited on once per frame
+struct FrameCommands {
+    VkCommandPool pool = VK_NULL_HANDLE;
+    VkCommandBuffer cb = VK_NULL_HANDLE;
+
+    void Create(const Context& ctx) {
+        VkCommandPoolCreateInfo command_pool_ci = {VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO};
+        command_pool_ci.queueFamilyIndex = ctx.graphics_family;
+        Check(vk::CreateCommandPool(ctx.device, &command_pool_ci, nullptr, &pool), "vkCreateCommandPool");
+        VkCommandBufferAllocateInfo command_buffer_ai = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO};
+        command_buffer_ai.commandPool = pool;
+        command_buffer_ai.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        command_buffer_ai.commandBufferCount = 1;
+        Check(vk::AllocateCommandBuffers(ctx.device, &command_buffer_ai, &cb), "vkAllocateCommandBuffers");
+    }
+    void Begin() const {
+        const VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO, nullptr,
+                                                     VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, nullptr};
+        Check(vk::BeginCommandBuffer(cb, &begin_info), "vkBeginCommandBuffer");
+    }
+    void EndAndSubmit(const Context& ctx, Recorder::Samples& submit_samples) const {
+        Check(vk::EndCommandBuffer(cb), "vkEndCommandBuffer");
+        VkSubmitInfo submit = {VK_STRUCTURE_TYPE_SUBMIT_INFO};
+        submit.commandBufferCount = 1;
+        submit.pCommandBuffers = &cb;
+        VkResult result = VK_SUCCESS;
+        Recorder::Time(submit_samples, [&]() { result = vk::QueueSubmit(ctx.queues[0], 1, &submit, VK_NULL_HANDLE); });
+        Check(result, "vkQueueSubmit");
+        Check(vk::QueueWaitIdle(ctx.queues[0]), "vkQueueWaitIdle");
+        Check(vk::ResetCommandPool(ctx.device, pool, 0), "vkResetCommandPool");
+    }
+    void Destroy(const Context& ctx) { vk::DestroyCommandPool(ctx.device, pool, nullptr); }
+};
+
+// Copies between scattered slices of two large buffers, which gives the synchronization validation many separate ranges to
+// track (run with VK_LAYER_VALIDATE_SYNC=1)
+void SyncBufferCopies(Context& ctx, Recorder& recorder, double scale) {
+    constexpr uint32_t kFrames = 8;
+    constexpr uint32_t kBarrierInterval = 64;
+    constexpr VkDeviceSize kSliceSize = 4096;
+    constexpr uint32_t kSliceCount = 8192;
+    const uint32_t copies_per_frame = (Scaled(100000, scale) + kFrames - 1) / kFrames;
+
+    Buffer src;
+    Buffer dst;
+    src.Create(ctx, kSliceSize * kSliceCount, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    dst.Create(ctx, kSliceSize * kSliceCount, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    FrameCommands commands;
+    commands.Create(ctx);
+
+    auto& copy_samples = recorder.Get("vkCmdCopyBuffer");
+    auto& barrier_samples = recorder.Get("vkCmdPipelineBarrier");
+    auto& submit_samples = recorder.Get("vkQueueSubmit");
+    copy_samples.reserve(size_t(copies_per_frame) * kFrames);
+
+    for (uint32_t frame = 0; frame < kFrames; ++frame) {
+        commands.Begin();
+        for (uint32_t copy = 0; copy < copies_per_frame; ++copy) {
+            // Odd multiplier, so that consecutive copies land far apart and every slice is used before one is reused
+            const VkDeviceSize slice = (VkDeviceSize(copy + frame) * 4099) % kSliceCount;
+            const VkBufferCopy region = {slice * kSliceSize, ((slice * 7) % kSliceCount) * kSliceSize, kSliceSize / 2};
+            Recorder::Time(copy_samples, [&]() { vk::CmdCopyBuffer(commands.cb, src.buffer, dst.buffer, 1, &region); });
+            if ((copy + 1) % kBarrierInterval == 0) {
+                VkBufferMemoryBarrier barrier = {VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER};
+                barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                barrier.buffer = dst.buffer;
+                barrier.size = VK_WHOLE_SIZE;
+                Recorder::Time(barrier_samples, [&]() {
+                    vk::CmdPipelineBarrier(commands.cb, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                                           nullptr, 1, &barrier, 0, nullptr);
+                });
+            }
+        }
+        commands.EndAndSubmit(ctx, submit_samples);
+    }
+
+    commands.Destroy(ctx);
+    dst.Destroy(ctx);
+    src.Destroy(ctx);
+}
+
+// Transitions and clears the subresources of a mipmapped array image one at a time, which splits the image in many ranges
+// for the synchronization validation (run with VK_LAYER_VALIDATE_SYNC=1)
+void SyncImageBarriers(Context& ctx, Recorder& recorder, double scale) {
+    constexpr uint32_t kMips = 8;
+    constexpr uint32_t kLayers = 32;
+    const uint32_t frames = Scaled(40, scale);
+
+    VkImageCreateInfo image_ci = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+    image_ci.imageType = VK_IMAGE_TYPE_2D;
+    image_ci.format = VK_FORMAT_R8G8B8A8_UNORM;
+    image_ci.extent = {1u << (kMips - 1), 1u << (kMips - 1), 1};
+    image_ci.mipLevels = kMips;
+    image_ci.arrayLayers = kLayers;
+    image_ci.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_ci.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_ci.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    VkImage image;
+    Check(vk::CreateImage(ctx.device, &image_ci, nullptr, &image), "vkCreateImage");
+    VkMemoryRequirements requirements;
+    vk::GetImageMemoryRequirements(ctx.device, image, &requirements);
+    VkMemoryAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+    alloc_info.allocationSize = requirements.size;
+    alloc_info.memoryTypeIndex = ctx.MemoryType(requirements.memoryTypeBits);
+    VkDeviceMemory image_memory;
+    Check(vk::AllocateMemory(ctx.device, &alloc_info, nullptr, &image_memory), "vkAllocateMemory");
+    Check(vk::BindImageMemory(ctx.device, image, image_memory, 0), "vkBindImageMemory");
+    FrameCommands commands;
+    commands.Create(ctx);
+
+    auto& barrier_samples = recorder.Get("vkCmdPipelineBarrier");
+    auto& clear_samples = recorder.Get("vkCmdClearColorImage");
+    auto& submit_samples = recorder.Get("vkQueueSubmit");
+    clear_samples.reserve(size_t(frames) * kMips * kLayers);
+
+    auto transition = [&](const VkImageSubresourceRange& range, VkImageLayout old_layout, VkImageLayout new_layout,
+                          VkAccessFlags src_access, VkAccessFlags dst_access) {
+        VkImageMemoryBarrier barrier = {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER};
+        barrier.srcAccessMask = src_access;
+        barrier.dstAccessMask = dst_access;
+        barrier.oldLayout = old_layout;
+        barrier.newLayout = new_layout;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image;
+        barrier.subresourceRange = range;
+        Recorder::Time(barrier_samples, [&]() {
+            vk::CmdPipelineBarrier(commands.cb, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0,
+                                   nullptr, 0, nullptr, 1, &barrier);
+        });
+    };
+
+    const VkClearColorValue color = {};
+    for (uint32_t frame = 0; frame < frames; ++frame) {
+        commands.Begin();
+        for (uint32_t layer = 0; layer < kLayers; ++layer) {
+            for (uint32_t mip = 0; mip < kMips; ++mip) {
+                const VkImageSubresourceRange range = {VK_IMAGE_ASPECT_COLOR_BIT, mip, 1, layer, 1};
+                transition(range, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0,
+                           VK_ACCESS_TRANSFER_WRITE_BIT);
+                Recorder::Time(clear_samples, [&]() {
+                    vk::CmdClearColorImage(commands.cb, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &color, 1, &range);
+                });
+                transition(range, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                           VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT);
+            }
+        }
+        commands.EndAndSubmit(ctx, submit_samples);
+    }
+
+    commands.Destroy(ctx);
+    vk::DestroyImage(ctx.device, image, nullptr);
+    vk::FreeMemory(ctx.device, image_memory, nullptr);
+}
+
+// Many threads making the same invalid call, so after the duplicate message limit is reached every call only pays for deciding
+// to drop the error. This is what an application with one bug in its frame loop looks like.
+void DuplicateErrors(Context& ctx, Recorder& recorder, double scale) {
+    constexpr uint32_t kThreads = 32;
+    const uint32_t calls_per_thread = Scaled(20000, scale);
+
+    // Samples are kept per thread, Recorder is not thread safe
+    std::vector<Recorder::Samples> thread_samples(kThreads);
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&ctx, &samples = thread_samples[t], calls_per_thread]() {
+            samples.reserve(calls_per_thread);
+            // size 0 is invalid (VUID-VkBufferCreateInfo-size-00912), the layer reports it and does not call down
+            VkBufferCreateInfo buffer_ci = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+            buffer_ci.size = 0;
+            buffer_ci.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+            for (uint32_t i = 0; i < calls_per_thread; ++i) {
+                VkBuffer buffer = VK_NULL_HANDLE;
+                Recorder::Time(samples, [&]() { vk::CreateBuffer(ctx.device, &buffer_ci, nullptr, &buffer); });
+                if (buffer != VK_NULL_HANDLE) {
+                    vk::DestroyBuffer(ctx.device, buffer, nullptr);
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    auto& create_samples = recorder.Get("vkCreateBuffer");
+    for (const Recorder::Samples& samples : thread_samples) {
+        create_samples.insert(create_samples.end(), samples.begin(), samples.end());
+    }
+}
+
+// Compute shader doing |accesses| read-modify-writes of a storage buffer, each of them instrumented by GPU-AV:
+//   layout(set = 0, binding = 0) buffer SSBO { uint data[]; };
+//   void main() { data[0] += increment; data[1] += increment; ... }
+// It is generated so every pipeline can use another |increment|, and no shader validation or instrumentation cache is hit
+std::vector<uint32_t> LargeComputeSpirV(uint32_t accesses, uint32_t increment) {
+    enum : uint32_t {
+        kVoid = 1,
+        kFunctionType,
+        kUint,
+        kRuntimeArray,
+        kBlock,
+        kBlockPointer,
+        kBuffer,
+        kUintPointer,
+        kZero,
+        kIncrement,
+        kMain,
+        kLabel,
+        kFirstIndex,
+    };
+    constexpr uint32_t kUniform = 2;
+    std::vector<uint32_t> spirv = {0x07230203, 0x00010000, 0, 0 /* bound */, 0};
+    auto op = [&spirv](uint32_t opcode, std::initializer_list<uint32_t> operands) {
+        spirv.emplace_back(uint32_t(operands.size() + 1) << 16 | opcode);
+        spirv.insert(spirv.end(), operands);
+    };
+    op(17, {1});                                 // OpCapability Shader
+    op(14, {0, 1});                              // OpMemoryModel Logical GLSL450
+    op(15, {5, kMain, 0x6e69616d, 0});           // OpEntryPoint GLCompute %main "main"
+    op(16, {kMain, 17, 1, 1, 1});                // OpExecutionMode %main LocalSize 1 1 1
+    op(71, {kRuntimeArray, 6, 4});               // OpDecorate %runtime_array ArrayStride 4
+    op(72, {kBlock, 0, 35, 0});                  // OpMemberDecorate %block 0 Offset 0
+    op(71, {kBlock, 3});                         // OpDecorate %block BufferBlock
+    op(71, {kBuffer, 34, 0});                    // OpDecorate %buffer DescriptorSet 0
+    op(71, {kBuffer, 33, 0});                    // OpDecorate %buffer Binding 0
+    op(19, {kVoid});                             // OpTypeVoid
+    op(33, {kFunctionType, kVoid});              // OpTypeFunction %void
+    op(21, {kUint, 32, 0});                      // OpTypeInt 32 0
+    op(29, {kRuntimeArray, kUint});              // OpTypeRuntimeArray %uint
+    op(30, {kBlock, kRuntimeArray});             // OpTypeStruct %runtime_array
+    op(32, {kBlockPointer, kUniform, kBlock});   // OpTypePointer Uniform %block
+    op(59, {kBlockPointer, kBuffer, kUniform});  // OpVariable %block_pointer Uniform
+    op(32, {kUintPointer, kUniform, kUint});     // OpTypePointer Uniform %uint
+    op(43, {kUint, kZero, 0});                   // OpConstant %uint 0
+    op(43, {kUint, kIncrement, increment});      // OpConstant %uint increment
+    for (uint32_t i = 0; i < accesses; ++i) {
+        op(43, {kUint, kFirstIndex + i, i});  // OpConstant %uint i
+    }
+    op(54, {kVoid, kMain, 0, kFunctionType});  // OpFunction %void None %function_type
+    op(248, {kLabel});                         // OpLabel
+    uint32_t next_id = kFirstIndex + accesses;
+    for (uint32_t i = 0; i < accesses; ++i) {
+        const uint32_t pointer = next_id++;
+        const uint32_t value = next_id++;
+        const uint32_t sum = next_id++;
+        op(65, {kUintPointer, pointer, kBuffer, kZero, kFirstIndex + i});  // OpAccessChain %uint_pointer %buffer 0 i
+        op(61, {kUint, value, pointer});                                   // OpLoad %uint
+        op(128, {kUint, sum, value, kIncrement});                          // OpIAdd %uint
+        op(62, {pointer, sum});                                            // OpStore
+    }
+    op(253, {});  // OpReturn
+    op(56, {});   // OpFunctionEnd
+    spirv[3] = next_id;
+    return spirv;
+}
+
+// Creates compute pipelines from large shaders, for the cost of validating them and, with GPU-AV (VK_LAYER_GPUAV_ENABLE=1), of
+// instrumenting them
+void GpuavLargeShader(Context& ctx, Recorder& recorder, double scale) {
+    constexpr uint32_t kAccesses = 4096;
+    const uint32_t pipeline_count = Scaled(50, scale);
+
+    VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+    VkDescriptorSetLayoutCreateInfo set_layout_ci = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
+    set_layout_ci.bindingCount = 1;
+    set_layout_ci.pBindings = &binding;
+    VkDescriptorSetLayout set_layout;
+    Check(vk::CreateDescriptorSetLayout(ctx.device, &set_layout_ci, nullptr, &set_layout), "vkCreateDescriptorSetLayout");
+    VkPipelineLayoutCreateInfo pipeline_layout_ci = {VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO};
+    pipeline_layout_ci.setLayoutCount = 1;
+    pipeline_layout_ci.pSetLayouts = &set_layout;
+    VkPipelineLayout pipeline_layout;
+    Check(vk::CreatePipelineLayout(ctx.device, &pipeline_layout_ci, nullptr, &pipeline_layout), "vkCreatePipelineLayout");
+
+    auto& module_samples = recorder.Get("vkCreateShaderModule");
+    auto& create_samples = recorder.Get("vkCreateComputePipelines");
+    auto& destroy_samples = recorder.Get("vkDestroyPipeline");
+    auto& destroy_module_samples = recorder.Get("vkDestroyShaderModule");
+
+    VkResult result = VK_SUCCESS;
+    for (uint32_t i = 0; i < pipeline_count; ++i) {
+        const std::vector<uint32_t> spirv = LargeComputeSpirV(kAccesses, i + 1);
+        VkShaderModuleCreateInfo module_ci = {VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
+        module_ci.codeSize = spirv.size() * sizeof(uint32_t);
+        module_ci.pCode = spirv.data();
+        VkShaderModule module;
+        Recorder::Time(module_samples, [&]() { result = vk::CreateShaderModule(ctx.device, &module_ci, nullptr, &module); });
+        Check(result, "vkCreateShaderModule");
+
+        VkComputePipelineCreateInfo pipeline_ci = {VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO};
+        pipeline_ci.stage = {VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO};
+        pipeline_ci.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipeline_ci.stage.module = module;
+        pipeline_ci.stage.pName = "main";
+        pipeline_ci.layout = pipeline_layout;
+        VkPipeline pipeline;
+        Recorder::Time(create_samples, [&]() {
+            result = vk::CreateComputePipelines(ctx.device, VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &pipeline);
+        });
+        Check(result, "vkCreateComputePipelines");
+
+        Recorder::Time(destroy_samples, [&]() { vk::DestroyPipeline(ctx.device, pipeline, nullptr); });
+        Recorder::Time(destroy_module_samples, [&]() { vk::DestroyShaderModule(ctx.device, module, nullptr); });
+    }
+
+    vk::DestroyPipelineLayout(ctx.device, pipeline_layout, nullptr);
+    vk::DestroyDescriptorSetLayout(ctx.device, set_layout, nullptr);
+}
+
+struct Workload {
+    const char* name;
+    void (*run)(Context& ctx, Recorder& recorder, double scale);
+};
+
+constexpr Workload kWorkloads[] = {
+    {"draw_rebind", DrawRebind},
+    {"bindless_update", BindlessUpdate},
+    {"timeline_submit", TimelineSubmit},
+    {"pipeline_burst", PipelineBurst},
+    {"sync_buffer_copies", SyncBufferCopies},
+    {"sync_image_barriers", SyncImageBarriers},
+    {"duplicate_errors", DuplicateErrors},
+    {"gpuav_large_shader", GpuavLargeShader},
+};
+
+void PrintResults(const std::map<Recorder::Key, Recorder::Stats>& summary) {
+    printf("\n%-18s %-28s %-10s %10s %14s %14s %16s\n", "Workload", "Entry point", "Layers", "Count", "Avg (ns)", "Median (ns)",
+           "Calls/sec");
+    for (const auto& [key, stats] : summary) {
+        printf("%-18s %-28s %-10s %10llu %14.1f %14.1f %16.1f\n", key.workload.c_str(), key.entry_point.c_str(),
+               key.layers ? "on" : "off", static_cast<unsigned long long>(stats.count), stats.avg_ns, stats.median_ns,
+               stats.CallsPerSec());
+    }
+
+    bool header = false;
+    for (const auto& [key, stats] : summary) {
+        if (!key.layers) {
+            continue;
+        }
+        const auto no_layers = summary.find({key.workload, key.entry_point, false});
+        if (no_layers == summary.end() || no_layers->second.avg_ns <= 0.0) {
+            continue;
+        }
+        if (!header) {
+            printf("\n%-18s %-28s %16s %10s\n", "Workload", "Entry point", "Overhead (ns)", "Ratio");
+            header = true;
+        }
+        printf("%-18s %-28s %16.1f %9.2fx\n", key.workload.c_str(), key.entry_point.c_str(),
+               stats.avg_ns - no_layers->second.avg_ns, stats.avg_ns / no_layers->second.avg_ns);
+    }
+}
+
+bool WriteJson(const std::string& path, const std::map<Recorder::Key, Recorder::Stats>& summary) {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << "{\n  \"workloads\": [";
+    const char* separator = "\n";
+    for (const auto& [key, stats] : summary) {
+        char values[256];
+        snprintf(values, sizeof(values),
+                 "\"count\": %llu, \"avg_ns\": %.1f, \"median_ns\": %.1f, \"min_ns\": %.1f, \"max_ns\": %.1f, "
+                 "\"calls_per_sec\": %.1f",
+                 static_cast<unsigned long long>(stats.count), stats.avg_ns, stats.median_ns, stats.min_ns, stats.max_ns,
+                 stats.CallsPerSec());
+        // Workload and entry point names are plain identifiers, nothing to escape
+        file << separator << "    {\"workload\": \"" << key.workload << "\", \"entry_point\": \"" << key.entry_point
+             << "\", \"layers\": " << (key.layers ? "true" : "false") << ", " << values << "}";
+        separator = ",\n";
+    }
+    file << "\n  ]\n}\n";
+    return bool(file);
+}
+
+void PrintUsage(const char* program) {
+    printf("Usage: %s [--json <file>] [--scale <factor>] [--layers-only | --no-layers-only] [--workload <name>]...\n", program);
+    printf("Workloads:");
+    for (const Workload& workload : kWorkloads) {
+        printf(" %s", workload.name);
+    }
+    printf("\n");
+}
+
+// Only set the variables the user did not, so the benchmarks can also be pointed at another driver or layer build
+void SetDefaultEnvironment(const char* variable, const char* value) {
+    if (!getenv(variable)) {
+        SetEnvironment(variable, value);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    std::vector<std::string> selected;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--json" && i + 1 < argc) {
+            options.json_path = argv[++i];
+        } else if (arg == "--scale" && i + 1 < argc) {
+            options.scale = atof(argv[++i]);
+        } else if (arg == "--workload" && i + 1 < argc) {
+            selected.emplace_back(argv[++i]);
+        } else if (arg == "--layers-only") {
+            options.without_layers = false;
+        } else if (arg == "--no-layers-only") {
+            options.with_layers = false;
+        } else {
+            PrintUsage(argv[0]);
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+    if (options.scale <= 0.0) {
+        fprintf(stderr, "--scale must be positive\n");
+        return 1;
+    }
+
+    SetDefaultEnvironment("VK_DRIVER_FILES", TEST_ICD_JSON);
+    SetDefaultEnvironment("VK_LAYER_PATH", VALIDATION_LAYERS_BUILD_PATH);
+    // Implicit layers installed on the machine would be measured in both runs and hide the difference
+    SetDefaultEnvironment("VK_LOADER_LAYERS_DISABLE", "~implicit~");
+    vk::InitCore("vulkan");
+
+    Recorder recorder;
+    uint32_t error_count = 0;
+    for (const bool layers : {false, true}) {
+        if ((layers && !options.with_layers) || (!layers && !options.without_layers)) {
+            continue;
+        }
+        recorder.SetLayers(layers);
+        Context ctx;
+        CreateContext(layers, ctx);
+        for (const Workload& workload : kWorkloads) {
+            if (!selected.empty() && std::find(selected.begin(), selected.end(), workload.name) == selected.end()) {
+                continue;
+            }
+            printf("Running %s with layers %s\n", workload.name, layers ? "on" : "off");
+            fflush(stdout);
+            recorder.SetWorkload(workload.name);
+            workload.run(ctx, recorder, options.scale);
+        }
+        error_count += ctx.error_count;
+        DestroyContext(ctx);
+    }
+
+    const auto summary = recorder.Summarize();
+    PrintResults(summary);
+    if (error_count > 0) {
+        fprintf(stderr, "\nWarning: %u validation errors were reported, the results include the cost of reporting them\n",
+                error_count);
+    }
+    if (!options.json_path.empty() && !WriteJson(options.json_path, summary)) {
+        fprintf(stderr, "Failed to write %s\n", options.json_path.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -1118,10 +1118,18 @@ static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures2(VkPhysicalDevice ph
     if (vk_1_1_features) {
         vk_1_1_features->protectedMemory = VK_TRUE;
     }
+    auto vk_1_2_features = vku::FindStructInPNextChain<VkPhysicalDeviceVulkan12Features>(pFeatures->pNext);
+    if (vk_1_2_features) {
+        vk_1_2_features->timelineSemaphore = VK_TRUE;
+    }
     auto vk_1_3_features = vku::FindStructInPNextChain<VkPhysicalDeviceVulkan13Features>(pFeatures->pNext);
     if (vk_1_3_features) {
         vk_1_3_features->synchronization2 = VK_TRUE;
     }
+    auto timeline_semaphore_features = vku::FindStructInPNextChain<VkPhysicalDeviceTimelineSemaphoreFeatures>(pFeatures->pNext);
+    if (timeline_semaphore_features) {
+        timeline_semaphore_features->timelineSemaphore = VK_TRUE;
+    }
     auto prot_features = vku::FindStructInPNextChain<VkPhysicalDeviceProtectedMemoryFeatures>(pFeatures->pNext);
     if (prot_features) {
         prot_features->protectedMemory = VK_TRUE;
@@ -1184,6 +1192,7 @@ static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties2(VkPhysicalDevice
     if (props_12) {
         props_12->denormBehaviorIndependence = VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL;
         props_12->roundingModeIndependence = VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL;
+        props_12->maxTimelineSemaphoreValueDifference = UINT32_MAX;
     }
 
     auto* props_13 = vku::FindStructInPNextChain<VkPhysicalDeviceVulkan13Properties>(pProperties->pNext);
@@ -1194,6 +1203,11 @@ static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties2(VkPhysicalDevice
         props_13->uniformTexelBufferOffsetAlignmentBytes = 16;
     }
 
+    auto* timeline_semaphore_props = vku::FindStructInPNextChain<VkPhysicalDeviceTimelineSemaphoreProperties>(pProperties->pNext);
+    if (timeline_semaphore_props) {
+        timeline_semaphore_props->maxTimelineSemaphoreValueDifference = UINT32_MAX;
+    }
+
     auto* protected_memory_props = vku::FindStructInPNextChain<VkPhysicalDeviceProtectedMemoryProperties>(pProperties->pNext);
     if (protected_memory_props) {
         protected_memory_props->protectedNoFault = VK_FALSE;
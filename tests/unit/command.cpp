@@ -4005,3 +4005,26 @@ TEST_F(NegativeCommand, CommandBufferRecording) {
         m_errorMonitor->VerifyFound();
     }
 }
+
+TEST_F(NegativeCommand, ResetSecondaryCommandPool) {
+    TEST_DESCRIPTION("Resetting the pool of a secondary command buffer invalidates the primary that executed it");
+    RETURN_IF_SKIP(Init());
+
+    vkt::CommandPool secondary_pool(*m_device, m_device->graphics_queue_node_index_);
+    vkt::CommandBuffer secondary_cb(*m_device, secondary_pool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    secondary_cb.Begin();
+    vk::CmdFillBuffer(secondary_cb, buffer, 0, 16, 0x11111111);
+    secondary_cb.End();
+
+    m_command_buffer.Begin();
+    vk::CmdExecuteCommands(m_command_buffer, 1, &secondary_cb.handle());
+    m_command_buffer.End();
+
+    vk::ResetCommandPool(device(), secondary_pool, 0);
+
+    m_errorMonitor->SetDesiredError("VUID-vkQueueSubmit-pCommandBuffers-00070");
+    m_default_queue->Submit(m_command_buffer);
+    m_errorMonitor->VerifyFound();
+}
@@ -212,6 +212,29 @@ TEST_F(PositiveCommand, FramebufferBindingDestroyCommandPool) {
     vk::DestroyCommandPool(device(), command_pool, NULL);
 }
 
+TEST_F(PositiveCommand, DestroyBufferBoundBeforeReset) {
+    TEST_DESCRIPTION("Destroy a buffer that was only bound before the command buffer was reset, then submit the command buffer");
+    RETURN_IF_SKIP(Init());
+
+    vkt::Buffer old_buffer(*m_device, 1024, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+    vkt::Buffer new_buffer(*m_device, 1024, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+    const VkDeviceSize offset = 0;
+
+    m_command_buffer.Begin();
+    vk::CmdBindVertexBuffers(m_command_buffer, 0, 1, &old_buffer.handle(), &offset);
+    vk::CmdBindVertexBuffers(m_command_buffer, 0, 1, &new_buffer.handle(), &offset);
+    m_command_buffer.End();
+    m_command_buffer.Reset();
+
+    // Only the bindings made since the reset keep the command buffer alive
+    m_command_buffer.Begin();
+    vk::CmdBindVertexBuffers(m_command_buffer, 0, 1, &new_buffer.handle(), &offset);
+    m_command_buffer.End();
+    old_buffer.Destroy();
+
+    m_default_queue->SubmitAndWait(m_command_buffer);
+}
+
 TEST_F(PositiveCommand, ClearRectWith2DArray) {
     TEST_DESCRIPTION("Test using VkClearRect with an image that is of a 2D array type.");
 
@@ -749,4 +772,28 @@ TEST_F(PositiveCommand, ResolveImageImageTypeRemainingLayerCount) {
 
     vk::CmdResolveImage(m_command_buffer, src_image_2D, VK_IMAGE_LAYOUT_GENERAL, dst_image_3D, VK_IMAGE_LAYOUT_GENERAL, 1, &region);
     m_command_buffer.End();
-}
\ No newline at end of file
+}
+TEST_F(PositiveCommand, ResetCommandPoolThenDestroyResources) {
+    TEST_DESCRIPTION("Objects recorded before a pool reset can be destroyed without affecting the reset command buffers");
+    RETURN_IF_SKIP(Init());
+
+    vkt::CommandBuffer other_cb(*m_device, m_command_pool);
+    {
+        vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+        m_command_buffer.Begin();
+        vk::CmdFillBuffer(m_command_buffer, buffer, 0, 16, 0x11111111);
+        m_command_buffer.End();
+        other_cb.Begin();
+        vk::CmdFillBuffer(other_cb, buffer, 16, 16, 0x22222222);
+        other_cb.End();
+
+        vk::ResetCommandPool(device(), m_command_pool, 0);
+    }
+
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    m_command_buffer.Begin();
+    vk::CmdFillBuffer(m_command_buffer, buffer, 0, 16, 0x33333333);
+    m_command_buffer.End();
+    m_default_queue->Submit(m_command_buffer);
+    m_default_queue->Wait();
+}
@@ -3071,6 +3071,30 @@ TEST_F(NegativeCopyBufferImage, Extents) {
     m_command_buffer.End();
 }
 
+TEST_F(NegativeCopyBufferImage, DeferredCommandValidation) {
+    TEST_DESCRIPTION("With deferred_command_validation, the copy regions are validated at vkEndCommandBuffer");
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "deferred_command_validation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                       &kVkTrue};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer buffer_one(*m_device, 2048, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_two(*m_device, 2048, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    m_command_buffer.Begin();
+    VkBufferCopy copy_info = {4096, 256, 256};
+    vk::CmdCopyBuffer(m_command_buffer, buffer_one, buffer_two, 1, &copy_info);
+    copy_info = {256, 4096, 256};
+    vk::CmdCopyBuffer(m_command_buffer, buffer_one, buffer_two, 1, &copy_info);
+
+    m_errorMonitor->SetDesiredError("VUID-vkCmdCopyBuffer-srcOffset-00113");
+    m_errorMonitor->SetDesiredError("VUID-vkCmdCopyBuffer-dstOffset-00114");
+    m_command_buffer.End();
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeCopyBufferImage, CompletelyOverlappingBuffer) {
     TEST_DESCRIPTION("Test copying between buffers with completely overlapping source and destination regions.");
     RETURN_IF_SKIP(Init());
@@ -1369,6 +1369,54 @@ TEST_F(NegativeDescriptors, ImageDescriptorLayoutMismatch) {
     }
 }
 
+TEST_F(NegativeDescriptors, ImageDescriptorArraySameViewLayoutMismatch) {
+    TEST_DESCRIPTION("An array holding the same view several times, only the last descriptor has a mismatching layout");
+    RETURN_IF_SKIP(Init());
+
+    OneOffDescriptorSet descriptor_set(m_device,
+                                       {{0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 4, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                                        {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}});
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+
+    vkt::Buffer buffer(*m_device, 16, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    vkt::Sampler sampler(*m_device, SafeSaneSamplerCreateInfo());
+    vkt::Image image(*m_device, 32, 32, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_SAMPLED_BIT);
+    vkt::ImageView image_view = image.CreateView();
+    descriptor_set.WriteDescriptorBufferInfo(1, buffer, 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    for (uint32_t i = 0; i < 3; ++i) {
+        descriptor_set.WriteDescriptorImageInfo(0, image_view, sampler, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                                VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, i);
+    }
+    descriptor_set.WriteDescriptorImageInfo(0, image_view, sampler, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                            VK_IMAGE_LAYOUT_GENERAL, 3);
+    descriptor_set.UpdateDescriptorSets();
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(set=0, binding=0) uniform sampler2D tex[4];
+        layout(set=0, binding=1) buffer SSBO { vec4 x; };
+        void main() {
+            x = textureLod(tex[0], vec2(0.0), 0.0);
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = VkShaderObj(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.cp_ci_.layout = pipeline_layout;
+    pipe.CreateComputePipeline();
+
+    m_command_buffer.Begin();
+    image.SetLayout(m_command_buffer, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe);
+    vk::CmdBindDescriptorSets(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, 0, 1, &descriptor_set.set_, 0,
+                              nullptr);
+    m_errorMonitor->SetDesiredError("VUID-VkDescriptorImageInfo-imageLayout-00344");
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDispatch-None-08114");
+    vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+    m_errorMonitor->VerifyFound();
+    m_command_buffer.End();
+}
+
 TEST_F(NegativeDescriptors, DescriptorPoolInUseResetSignaled) {
     TEST_DESCRIPTION("Reset a DescriptorPool with a DescriptorSet that is in use.");
     RETURN_IF_SKIP(Init());
@@ -1936,6 +1984,119 @@ TEST_F(NegativeDescriptors, BindInvalidPipelineLayout) {
     m_command_buffer.End();
 }
 
+TEST_F(NegativeDescriptors, NotUpdatedAfterPipelineSwitch) {
+    TEST_DESCRIPTION("The same set is still validated against the requirements of every pipeline it is drawn with");
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    vkt::Buffer buffer(*m_device, 32, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr},
+                                                  {1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}});
+    // binding 1 is never updated
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer, 0, VK_WHOLE_SIZE);
+    descriptor_set.UpdateDescriptorSets();
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+
+    char const *fs_binding_0 = R"glsl(
+        #version 450
+        layout(location=0) out vec4 x;
+        layout(set=0, binding=0) uniform foo0 { vec4 y; };
+        void main(){
+           x = y;
+        }
+    )glsl";
+    char const *fs_binding_1 = R"glsl(
+        #version 450
+        layout(location=0) out vec4 x;
+        layout(set=0, binding=1) uniform foo1 { vec4 y; };
+        void main(){
+           x = y;
+        }
+    )glsl";
+    VkShaderObj vs(this, kVertexMinimalGlsl, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs_0(this, fs_binding_0, VK_SHADER_STAGE_FRAGMENT_BIT);
+    VkShaderObj fs_1(this, fs_binding_1, VK_SHADER_STAGE_FRAGMENT_BIT);
+
+    CreatePipelineHelper pipe_0(*this);
+    pipe_0.shader_stages_ = {vs.GetStageCreateInfo(), fs_0.GetStageCreateInfo()};
+    pipe_0.gp_ci_.layout = pipeline_layout;
+    pipe_0.CreateGraphicsPipeline();
+
+    CreatePipelineHelper pipe_1(*this);
+    pipe_1.shader_stages_ = {vs.GetStageCreateInfo(), fs_1.GetStageCreateInfo()};
+    pipe_1.gp_ci_.layout = pipeline_layout;
+    pipe_1.CreateGraphicsPipeline();
+
+    m_command_buffer.Begin();
+    m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindDescriptorSets(m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0, 1, &descriptor_set.set_, 0,
+                              nullptr);
+    for (uint32_t i = 0; i < 2; ++i) {
+        vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipe_0);
+        vk::CmdDraw(m_command_buffer, 1, 0, 0, 0);
+
+        vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipe_1);
+        m_errorMonitor->SetDesiredError("VUID-vkCmdDraw-None-08114");
+        vk::CmdDraw(m_command_buffer, 1, 0, 0, 0);
+        m_errorMonitor->VerifyFound();
+    }
+    m_command_buffer.EndRenderPass();
+    m_command_buffer.End();
+}
+TEST_F(NegativeDescriptors, NotUpdatedInHugeArray) {
+    TEST_DESCRIPTION("Large arrays are validated in chunks, a descriptor missing near the end must still be found");
+    RETURN_IF_SKIP(Init());
+
+    constexpr uint32_t descriptor_count = 5000;
+    const VkPhysicalDeviceLimits &limits = m_device->Physical().limits_;
+    if (limits.maxPerStageDescriptorSamplers < descriptor_count || limits.maxPerStageDescriptorSampledImages < descriptor_count ||
+        limits.maxDescriptorSetSamplers < descriptor_count || limits.maxDescriptorSetSampledImages < descriptor_count) {
+        GTEST_SKIP() << "Sampler and sampled image limits are too low";
+    }
+
+    OneOffDescriptorSet descriptor_set(
+        m_device, {{0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, descriptor_count, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                   {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}});
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+
+    vkt::Buffer buffer(*m_device, 16, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    descriptor_set.WriteDescriptorBufferInfo(1, buffer, 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    vkt::Sampler sampler(*m_device, SafeSaneSamplerCreateInfo());
+    vkt::Image image(*m_device, 32, 32, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_SAMPLED_BIT);
+    vkt::ImageView image_view = image.CreateView();
+    // Leave the second to last descriptor, in the last chunk, not updated
+    for (uint32_t i = 0; i < descriptor_count; ++i) {
+        if (i != descriptor_count - 2) {
+            descriptor_set.WriteDescriptorImageInfo(0, image_view, sampler, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                                    VK_IMAGE_LAYOUT_GENERAL, i);
+        }
+    }
+    descriptor_set.UpdateDescriptorSets();
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(set=0, binding=0) uniform sampler2D tex[5000];
+        layout(set=0, binding=1) buffer SSBO { vec4 x; };
+        void main() {
+            x = textureLod(tex[0], vec2(0.0), 0.0);
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = VkShaderObj(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.cp_ci_.layout = pipeline_layout;
+    pipe.CreateComputePipeline();
+
+    m_command_buffer.Begin();
+    vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe);
+    vk::CmdBindDescriptorSets(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, 0, 1, &descriptor_set.set_, 0,
+                              nullptr);
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDispatch-None-08114");
+    vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+    m_errorMonitor->VerifyFound();
+    m_command_buffer.End();
+}
+
 TEST_F(NegativeDescriptors, ConstantArrayElementNotBound) {
     AddRequiredFeature(vkt::Feature::vertexPipelineStoresAndAtomics);
     RETURN_IF_SKIP(Init());
@@ -685,6 +685,42 @@ TEST_F(PositiveDescriptors, AccelerationStructureTemplates) {
     }
 }
 
+TEST_F(PositiveDescriptors, TemplateUpdateRollsOverBindings) {
+    TEST_DESCRIPTION("Reuse a template whose entry rolls over into the next binding");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    RETURN_IF_SKIP(Init());
+
+    OneOffDescriptorSet descriptor_set(m_device, {
+                                                     {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2, VK_SHADER_STAGE_ALL, nullptr},
+                                                     {1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2, VK_SHADER_STAGE_ALL, nullptr},
+                                                 });
+    vkt::Buffer buffer(*m_device, 1024, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+
+    // Starts at the last element of binding 0 and ends in binding 1
+    VkDescriptorUpdateTemplateEntry update_template_entry = {};
+    update_template_entry.dstBinding = 0;
+    update_template_entry.dstArrayElement = 1;
+    update_template_entry.descriptorCount = 3;
+    update_template_entry.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    update_template_entry.offset = 0;
+    update_template_entry.stride = sizeof(VkDescriptorBufferInfo);
+
+    VkDescriptorUpdateTemplateCreateInfo update_template_ci = vku::InitStructHelper();
+    update_template_ci.descriptorUpdateEntryCount = 1;
+    update_template_ci.pDescriptorUpdateEntries = &update_template_entry;
+    update_template_ci.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    update_template_ci.descriptorSetLayout = descriptor_set.layout_;
+    vkt::DescriptorUpdateTemplate update_template(*m_device, update_template_ci);
+
+    VkDescriptorBufferInfo buffer_infos[3];
+    for (uint32_t frame = 0; frame < 2; ++frame) {
+        for (uint32_t i = 0; i < 3; ++i) {
+            buffer_infos[i] = {buffer, 256 * ((frame + i) % 4), 256};
+        }
+        vk::UpdateDescriptorSetWithTemplate(device(), descriptor_set.set_, update_template, buffer_infos);
+    }
+}
+
 TEST_F(PositiveDescriptors, ImageViewAsDescriptorReadAndInputAttachment) {
     TEST_DESCRIPTION("Test reading from a descriptor that uses same image view as framebuffer input attachment");
 
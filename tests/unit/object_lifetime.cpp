@@ -1385,3 +1385,43 @@ TEST_F(NegativeObjectLifetime, DestroySemaphoreInUseErrorMessage) {
     m_errorMonitor->VerifyFound();
     m_default_queue->Wait();
 }
+
+TEST_F(NegativeObjectLifetime, BulkTeardownLeakedObjects) {
+    TEST_DESCRIPTION("With bulk_teardown, the objects left to vkDestroyDevice are reported with one message per object type");
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "bulk_teardown", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &kVkTrue};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    const float q_priority[] = {1.0f};
+    VkDeviceQueueCreateInfo queue_ci = vku::InitStructHelper();
+    queue_ci.queueFamilyIndex = 0;
+    queue_ci.queueCount = 1;
+    queue_ci.pQueuePriorities = q_priority;
+
+    VkDeviceCreateInfo device_ci = vku::InitStructHelper();
+    device_ci.queueCreateInfoCount = 1;
+    device_ci.pQueueCreateInfos = &queue_ci;
+
+    VkDevice leaky_device;
+    ASSERT_EQ(VK_SUCCESS, vk::CreateDevice(Gpu(), &device_ci, nullptr, &leaky_device));
+
+    VkBufferCreateInfo buffer_ci = vku::InitStructHelper();
+    buffer_ci.size = 256;
+    buffer_ci.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    for (uint32_t i = 0; i < 64; ++i) {
+        VkBuffer buffer;
+        vk::CreateBuffer(leaky_device, &buffer_ci, nullptr, &buffer);
+    }
+    VkSemaphoreCreateInfo semaphore_ci = vku::InitStructHelper();
+    for (uint32_t i = 0; i < 16; ++i) {
+        VkSemaphore semaphore;
+        vk::CreateSemaphore(leaky_device, &semaphore_ci, nullptr, &semaphore);
+    }
+
+    m_errorMonitor->SetDesiredErrorRegex("VUID-vkDestroyDevice-device-05137", "64 VkBuffer objects");
+    m_errorMonitor->SetDesiredErrorRegex("VUID-vkDestroyDevice-device-05137", "16 VkSemaphore objects");
+    vk::DestroyDevice(leaky_device, nullptr);
+    m_errorMonitor->VerifyFound();
+}
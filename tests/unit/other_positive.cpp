@@ -700,3 +700,30 @@ TEST_F(VkPositiveLayerTest, PhysicalDeviceLayeredApiVulkanProperties) {
     VkPhysicalDeviceProperties2 phys_dev_props_2 = vku::InitStructHelper(&api_prop_lists);
     vk::GetPhysicalDeviceProperties2(Gpu(), &phys_dev_props_2);
 }
+
+TEST_F(VkPositiveLayerTest, GetValidationMemoryUsage) {
+    TEST_DESCRIPTION("Query the memory of each validation subsystem with the layer entry point");
+    RETURN_IF_SKIP(Init());
+    using PFN_GetValidationMemoryUsage = VkResult(VKAPI_PTR *)(VkDevice, uint32_t *, const char **, uint64_t *);
+    auto vkGetValidationMemoryUsageVVL =
+        reinterpret_cast<PFN_GetValidationMemoryUsage>(vk::GetDeviceProcAddr(device(), "vkGetValidationMemoryUsageVVL"));
+    if (!vkGetValidationMemoryUsageVVL) {
+        GTEST_SKIP() << "Validation layer is not enabled";
+    }
+
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+    uint32_t count = 0;
+    ASSERT_EQ(VK_SUCCESS, vkGetValidationMemoryUsageVVL(device(), &count, nullptr, nullptr));
+    ASSERT_GT(count, 1u);
+
+    std::vector<const char *> names(count);
+    std::vector<uint64_t> bytes(count);
+    ASSERT_EQ(VK_SUCCESS, vkGetValidationMemoryUsageVVL(device(), &count, names.data(), bytes.data()));
+    ASSERT_STREQ(names[0], "StateTracker");
+    ASSERT_GT(bytes[0], 0u);
+
+    uint32_t truncated_count = 1;
+    ASSERT_EQ(VK_INCOMPLETE, vkGetValidationMemoryUsageVVL(device(), &truncated_count, names.data(), bytes.data()));
+    ASSERT_EQ(truncated_count, 1u);
+}
@@ -48,6 +48,22 @@ TEST_F(PositivePipeline, BasicUsage) {
     pipe.CreateGraphicsPipeline();
 }
 
+TEST_F(PositivePipeline, GetPipelineCacheDataSavesValidationCache) {
+    TEST_DESCRIPTION("Read the pipeline cache data, which also saves the shader validation cache of the layer");
+    RETURN_IF_SKIP(Init());
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.CreateComputePipeline();
+
+    size_t data_size = 0;
+    vk::GetPipelineCacheData(device(), pipe.pipeline_cache_, &data_size, nullptr);
+    std::vector<uint8_t> data(data_size);
+    vk::GetPipelineCacheData(device(), pipe.pipeline_cache_, &data_size, data.data());
+
+    // Nothing new was validated, so the second read has nothing to save
+    vk::GetPipelineCacheData(device(), pipe.pipeline_cache_, &data_size, data.data());
+}
+
 TEST_F(PositivePipeline, MissingDescriptorUnused) {
     TEST_DESCRIPTION(
         "Test that pipeline validation accepts a compute pipeline which declares a descriptor-backed resource which is not "
@@ -2053,3 +2069,22 @@ TEST_F(PositivePipeline, SampleLocations) {
     vk::CmdEndRenderPass(m_command_buffer);
     m_command_buffer.End();
 }
+
+TEST_F(PositivePipeline, SharedFixedFunctionState) {
+    TEST_DESCRIPTION("Pipelines with identical blend and multisample states, destroy one and draw with the other");
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    CreatePipelineHelper pipe_a(*this);
+    pipe_a.CreateGraphicsPipeline();
+    CreatePipelineHelper pipe_b(*this);
+    pipe_b.CreateGraphicsPipeline();
+    pipe_a.Destroy();
+
+    m_command_buffer.Begin();
+    m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipe_b);
+    vk::CmdDraw(m_command_buffer, 3u, 1u, 0u, 0u);
+    m_command_buffer.EndRenderPass();
+    m_command_buffer.End();
+}
@@ -232,6 +232,48 @@ TEST_F(NegativeShaderCompute, WorkGroupSizeSpecConstant) {
     }
 }
 
+TEST_F(NegativeShaderCompute, WorkGroupSizeSpecConstantReused) {
+    TEST_DESCRIPTION("Pipelines using the same specialization of a module are all checked, with the values they use");
+
+    RETURN_IF_SKIP(Init());
+    const VkPhysicalDeviceLimits limits = m_device->Physical().limits_;
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(local_size_x_id = 3) in;
+        void main(){}
+    )glsl";
+
+    VkSpecializationMapEntry entries[2];
+    entries[0].constantID = 3;
+    entries[0].offset = 0;
+    entries[0].size = sizeof(uint32_t);
+    // Not used by the shader
+    entries[1].constantID = 7;
+    entries[1].offset = sizeof(uint32_t);
+    entries[1].size = sizeof(uint32_t);
+
+    uint32_t data[2] = {limits.maxComputeWorkGroupSize[0] + 1, 0};  // Invalid
+
+    VkSpecializationInfo specialization_info = {};
+    specialization_info.mapEntryCount = 2;
+    specialization_info.pMapEntries = entries;
+    specialization_info.dataSize = sizeof(uint32_t) * 2;
+    specialization_info.pData = data;
+
+    VkShaderObj cs(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0, SPV_SOURCE_GLSL, &specialization_info);
+    const auto set_info = [&](CreateComputePipelineHelper &helper) { helper.cp_ci_.stage = cs.GetStageCreateInfo(); };
+    for (uint32_t i = 0; i < 3; ++i) {
+        // The unused constant does not change the specialization
+        data[1] = i;
+        m_errorMonitor->SetUnexpectedError("VUID-RuntimeSpirv-x-06432");
+        CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit, "VUID-RuntimeSpirv-x-06429");
+    }
+
+    data[0] = 1;
+    CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit);
+}
+
 TEST_F(NegativeShaderCompute, WorkGroupSizeConstantDefault) {
     TEST_DESCRIPTION("Make sure constant are applied for maxComputeWorkGroupSize using WorkgroupSize");
 
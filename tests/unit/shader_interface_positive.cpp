@@ -120,6 +120,41 @@ TEST_F(PositiveShaderInterface, InputAndOutputComponents) {
     CreatePipelineHelper::OneshotTest(*this, set_info, kErrorBit);
 }
 
+TEST_F(PositiveShaderInterface, SameShaderPairManyPipelines) {
+    TEST_DESCRIPTION("Create several pipelines with the same vertex/fragment pair, the interface check result is reused");
+
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    char const *vsSource = R"glsl(
+        #version 450
+        layout(location=0) out vec4 x;
+        void main(){
+           x = vec4(0);
+           gl_Position = vec4(1);
+        }
+    )glsl";
+    char const *fsSource = R"glsl(
+        #version 450
+        layout(location=0) in vec4 x;
+        layout(location=0) out vec4 color;
+        void main(){
+           color = x;
+        }
+    )glsl";
+
+    VkShaderObj vs(this, vsSource, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs(this, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT);
+    // Same code in other modules
+    VkShaderObj vs2(this, vsSource, VK_SHADER_STAGE_VERTEX_BIT);
+
+    for (const VkShaderObj *vertex : {&vs, &vs, &vs2}) {
+        CreatePipelineHelper pipe(*this);
+        pipe.shader_stages_ = {vertex->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+        pipe.CreateGraphicsPipeline();
+    }
+}
+
 TEST_F(PositiveShaderInterface, InputAndOutputStructComponents) {
     TEST_DESCRIPTION("Test shader interface with structs.");
 
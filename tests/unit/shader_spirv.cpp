@@ -1134,6 +1134,36 @@ TEST_F(NegativeShaderSpirv, ReadShaderClock) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeShaderSpirv, ReadShaderClockCachedOnOtherDevice) {
+    TEST_DESCRIPTION("The stateless SPIR-V checks a module passed on a device are not skipped on a device with other features");
+
+    AddRequiredExtensions(VK_KHR_SHADER_CLOCK_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::shaderDeviceClock);
+    RETURN_IF_SKIP(Init());
+
+    char const *vs_source = R"glsl(
+        #version 450
+        #extension GL_EXT_shader_realtime_clock: enable
+        void main(){
+           uvec2 a = clockRealtime2x32EXT();
+           gl_Position = vec4(float(a.x) * 0.0);
+        }
+    )glsl";
+
+    {
+        VkPhysicalDeviceShaderClockFeaturesKHR clock_features = vku::InitStructHelper();
+        clock_features.shaderDeviceClock = VK_TRUE;
+        vkt::Device clock_device(gpu_, m_device_extension_names, nullptr, &clock_features);
+        VkShaderObj vs(clock_device, vs_source, VK_SHADER_STAGE_VERTEX_BIT);
+        // The validation cache is saved when the device is destroyed
+    }
+
+    vkt::Device no_clock_device(gpu_, m_device_extension_names);
+    m_errorMonitor->SetDesiredError("VUID-RuntimeSpirv-shaderDeviceClock-06268");
+    VkShaderObj vs(no_clock_device, vs_source, VK_SHADER_STAGE_VERTEX_BIT);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeShaderSpirv, SpecializationApplied) {
     TEST_DESCRIPTION(
         "Make sure specialization constants get applied during shader validation by using a value that breaks compilation.");
@@ -2775,4 +2805,34 @@ TEST_F(NegativeShaderSpirv, Bitwise32bitMaintenance9) {
     m_errorMonitor->SetDesiredError("VUID-RuntimeSpirv-None-10824");
     VkShaderObj cs(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
     m_errorMonitor->VerifyFound();
-}
\ No newline at end of file
+}
+TEST_F(NegativeShaderSpirv, AsyncSpirvValidation) {
+    TEST_DESCRIPTION("With spirv-val on background threads, the error is known before the module is used in a pipeline");
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "async_spirv_validation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &kVkTrue};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    // OpIAdd of types instead of values
+    const char *spv_source = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+       %uint = OpTypeInt 32 0
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+          %6 = OpIAdd %uint %uint %uint
+               OpReturn
+               OpFunctionEnd
+        )";
+
+    m_errorMonitor->SetDesiredError("VUID-VkShaderModuleCreateInfo-pCode-08737");
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = VkShaderObj::CreateFromASM(this, spv_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.CreateComputePipeline();
+    m_errorMonitor->VerifyFound();
+}
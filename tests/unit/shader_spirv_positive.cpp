@@ -2414,4 +2414,25 @@ TEST_F(PositiveShaderSpirv, Bitwise32bitMaintenance9) {
         }
     )glsl";
     VkShaderObj cs(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
-}
\ No newline at end of file
+}
+TEST_F(PositiveShaderSpirv, ModulesWithSameCode) {
+    TEST_DESCRIPTION("The parsing of identical SPIR-V is shared, make sure it outlives the first module");
+    RETURN_IF_SKIP(Init());
+
+    char const *cs_source = R"glsl(
+        #version 450
+        layout(local_size_x = 4) in;
+        layout(set = 0, binding = 0) buffer SSBO { uint x[]; };
+        void main() {
+            x[gl_LocalInvocationIndex] = gl_LocalInvocationIndex;
+        }
+    )glsl";
+    VkShaderObj first_cs(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    VkShaderObj second_cs(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    first_cs.Destroy();
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    pipe.cs_ = std::move(second_cs);
+    pipe.CreateComputePipeline();
+}
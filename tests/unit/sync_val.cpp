@@ -16,6 +16,7 @@
 #include "../framework/render_pass_helper.h"
 #include "../framework/descriptor_helper.h"
 #include "../framework/queue_submit_context.h"
+#include "../layers/sync/sync_settings.h"
 
 class NegativeSyncVal : public VkSyncValTest {};
 
@@ -175,6 +176,66 @@ TEST_F(NegativeSyncVal, BufferCopySecondary) {
     m_command_buffer.End();
 }
 
+TEST_F(NegativeSyncVal, SecondaryWithBarrierExecutedTwice) {
+    TEST_DESCRIPTION("The first use hazards of a secondary with a barrier are reported by each execution and after re-recording");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    const VkBufferUsageFlags usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer_a(*m_device, 256, usage);
+    vkt::Buffer buffer_b(*m_device, 256, usage);
+    vkt::Buffer buffer_c(*m_device, 256, usage);
+
+    VkBufferMemoryBarrier barrier_c = vku::InitStructHelper();
+    barrier_c.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier_c.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    barrier_c.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier_c.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier_c.buffer = buffer_c;
+    barrier_c.size = VK_WHOLE_SIZE;
+
+    // The barrier only covers buffer_c, the write to buffer_a after it is not synchronized with the primary
+    vkt::CommandBuffer secondary(*m_device, m_command_pool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    secondary.Begin();
+    secondary.Copy(buffer_b, buffer_c);
+    vk::CmdPipelineBarrier(secondary, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1, &barrier_c, 0,
+                           nullptr);
+    secondary.Copy(buffer_c, buffer_a);
+    secondary.End();
+
+    for (int i = 0; i < 2; ++i) {
+        m_command_buffer.Begin();
+        m_command_buffer.Copy(buffer_b, buffer_a);
+        m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+        vk::CmdExecuteCommands(m_command_buffer, 1, &secondary.handle());
+        m_errorMonitor->VerifyFound();
+        m_command_buffer.End();
+
+        m_command_buffer.Begin();
+        m_command_buffer.Copy(buffer_a, buffer_b);
+        m_errorMonitor->SetDesiredError("SYNC-HAZARD-READ-AFTER-WRITE");
+        vk::CmdExecuteCommands(m_command_buffer, 1, &secondary.handle());
+        m_errorMonitor->VerifyFound();
+        m_command_buffer.End();
+
+        m_command_buffer.Begin();
+        vk::CmdExecuteCommands(m_command_buffer, 1, &secondary.handle());
+        m_command_buffer.End();
+    }
+
+    // Re-recorded without the write to buffer_a
+    secondary.Begin();
+    secondary.Copy(buffer_b, buffer_c);
+    vk::CmdPipelineBarrier(secondary, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1, &barrier_c, 0,
+                           nullptr);
+    secondary.Copy(buffer_c, buffer_b);
+    secondary.End();
+
+    m_command_buffer.Begin();
+    m_command_buffer.Copy(buffer_b, buffer_a);
+    vk::CmdExecuteCommands(m_command_buffer, 1, &secondary.handle());
+    m_command_buffer.End();
+}
+
 TEST_F(NegativeSyncVal, BufferCopyHazardsSync2) {
     SetTargetApiVersion(VK_API_VERSION_1_2);
     AddRequiredExtensions(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
@@ -4274,6 +4335,59 @@ TEST_F(NegativeSyncVal, QSBufferCopyHazards) {
     test.DeviceWait();
 }
 
+TEST_F(NegativeSyncVal, QSResubmitAfterStateChange) {
+    TEST_DESCRIPTION("A command buffer that was submitted without hazard is validated again when the queue state changed");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    QSTestContext test(m_device, m_device->QueuesWithGraphicsCapability()[0]);
+    if (!test.Valid()) {
+        GTEST_SKIP() << "Test requires a valid queue object.";
+    }
+
+    test.RecordCopy(test.cba, test.buffer_a, test.buffer_b);
+    test.RecordCopy(test.cbb, test.buffer_c, test.buffer_a);
+
+    for (int i = 0; i < 3; ++i) {
+        test.Submit0(test.cba);
+        test.DeviceWait();
+    }
+
+    test.Submit0(test.cbb);
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-READ-AFTER-WRITE");
+    test.Submit0(test.cba);
+    m_errorMonitor->VerifyFound();
+
+    test.DeviceWait();
+    test.Submit0(test.cba);
+    test.DeviceWait();
+}
+
+TEST_F(NegativeSyncVal, QSAsyncSubmitValidation) {
+    TEST_DESCRIPTION("The hazard of an asynchronously validated submit is reported once the queue is waited on");
+    SyncValSettings settings;
+    settings.submit_time_validation = true;
+    settings.async_submit_validation = true;
+    RETURN_IF_SKIP(InitSyncValFramework(&settings));
+    RETURN_IF_SKIP(InitState());
+
+    QSTestContext test(m_device, m_device->QueuesWithGraphicsCapability()[0]);
+    if (!test.Valid()) {
+        GTEST_SKIP() << "Test requires a valid queue object.";
+    }
+
+    test.RecordCopy(test.cba, test.buffer_a, test.buffer_b);
+    test.RecordCopy(test.cbb, test.buffer_c, test.buffer_a);
+
+    test.Submit0(test.cba);
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-READ");
+    test.Submit0(test.cbb);
+    test.QueueWait0();
+    m_errorMonitor->VerifyFound();
+
+    test.DeviceWait();
+}
+
 TEST_F(NegativeSyncVal, QSSubmit2) {
     SetTargetApiVersion(VK_API_VERSION_1_3);
     AddRequiredFeature(vkt::Feature::synchronization2);
@@ -52,6 +52,10 @@ void VkSyncValTest::InitSyncValFramework(const SyncValSettings *p_sync_settings)
     settings.emplace_back(VkLayerSettingEXT{OBJECT_LAYER_NAME, "syncval_shader_accesses_heuristic",
                                             VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &shader_accesses_heuristic});
 
+    const auto async_submit_validation = static_cast<VkBool32>(sync_settings.async_submit_validation);
+    settings.emplace_back(VkLayerSettingEXT{OBJECT_LAYER_NAME, "syncval_async_submit_validation", VK_LAYER_SETTING_TYPE_BOOL32_EXT,
+                                            1, &async_submit_validation});
+
     VkLayerSettingsCreateInfoEXT settings_create_info = vku::InitStructHelper();
     settings_create_info.settingCount = size32(settings);
     settings_create_info.pSettings = settings.data();
@@ -922,6 +926,32 @@ TEST_F(PositiveSyncVal, SeparateAvailabilityAndVisibilityForBuffer) {
     m_command_buffer.End();
 }
 
+TEST_F(PositiveSyncVal, AllCommandsBarrierAfterReads) {
+    TEST_DESCRIPTION("A barrier with ALL_COMMANDS source stage protects every prior read in range.");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    constexpr VkDeviceSize size = 1024;
+    const vkt::Buffer buffer(*m_device, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    const vkt::Buffer dst_a(*m_device, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    const vkt::Buffer dst_b(*m_device, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    const vkt::Buffer src(*m_device, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+    VkBufferCopy region = {};
+    region.size = size;
+
+    m_command_buffer.Begin();
+    // Two reads of the buffer, then a barrier that has all of them in its source scope
+    vk::CmdCopyBuffer(m_command_buffer, buffer, dst_a, 1, &region);
+    vk::CmdCopyBuffer(m_command_buffer, buffer, dst_b, 1, &region);
+    VkMemoryBarrier barrier = vku::InitStructHelper();
+    vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier,
+                           0, nullptr, 0, nullptr);
+    // No WAR
+    vk::CmdCopyBuffer(m_command_buffer, src, buffer, 1, &region);
+    m_command_buffer.End();
+}
+
 TEST_F(PositiveSyncVal, LayoutTransitionWithAlreadyAvailableImage) {
     TEST_DESCRIPTION(
         "Image barrier makes image available but not visible. A subsequent layout transition barrier should not generate hazards. "
@@ -646,6 +646,39 @@ TEST_F(NegativeSyncValReporting, ReportBufferResource_SubmitTime) {
     m_default_queue->Wait();
 }
 
+TEST_F(NegativeSyncValReporting, ReportBufferResource_SharedCommandHandles) {
+    TEST_DESCRIPTION("Test that the hazardous buffer is reported when commands reference some of the same handles");
+    AddRequiredExtensions(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    RETURN_IF_SKIP(InitSyncVal());
+
+    vkt::Buffer buffer_a(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    buffer_a.SetName("BufferA");
+    vkt::Buffer buffer_b(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    buffer_b.SetName("BufferB");
+    vkt::Buffer buffer_c(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    buffer_c.SetName("BufferC");
+    vkt::Buffer buffer_d(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    buffer_d.SetName("BufferD");
+    VkBufferCopy region = {0, 0, 256};
+
+    m_command_buffer.Begin();
+    vk::CmdCopyBuffer(m_command_buffer, buffer_a, buffer_b, 1, &region);
+    // Same source as the previous command, different destination
+    vk::CmdCopyBuffer(m_command_buffer, buffer_a, buffer_c, 1, &region);
+
+    // WAW for BufferC
+    const char *contains_c_but_not_b = "(?=.*BufferC)(?!.*BufferB)";
+    m_errorMonitor->SetDesiredErrorRegex("SYNC-HAZARD-WRITE-AFTER-WRITE", contains_c_but_not_b);
+    vk::CmdCopyBuffer(m_command_buffer, buffer_a, buffer_c, 1, &region);
+    m_errorMonitor->VerifyFound();
+
+    // WAR for BufferA, read by the three previous copies that all name it first
+    m_errorMonitor->SetDesiredErrorRegex("SYNC-HAZARD-WRITE-AFTER-READ", "BufferA");
+    vk::CmdCopyBuffer(m_command_buffer, buffer_d, buffer_a, 1, &region);
+    m_errorMonitor->VerifyFound();
+    m_command_buffer.End();
+}
+
 TEST_F(NegativeSyncValReporting, ReportImageResource_SubmitTime) {
     TEST_DESCRIPTION("Test that hazardous image is reported");
     AddRequiredExtensions(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
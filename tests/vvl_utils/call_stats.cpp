@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "profiling/call_stats.h"
+
+static std::vector<std::string> CsvLines(const vvl::profiling::CallStats& stats) {
+    std::ostringstream out;
+    stats.WriteCsv(out);
+    std::vector<std::string> lines;
+    std::istringstream in(out.str());
+    for (std::string line; std::getline(in, line);) {
+        lines.emplace_back(line);
+    }
+    return lines;
+}
+
+TEST(CallStats, OnlyCalledEntryPoints) {
+    vvl::profiling::CallStats stats;
+    auto lines = CsvLines(stats);
+    ASSERT_EQ(lines.size(), 1u);
+    ASSERT_EQ(lines[0], "Zone Name,Count,Avg (ms),Median (ms),Min (ms),Max (ms)");
+
+    stats.Add(vvl::Func::vkQueueSubmit, vvl::profiling::CallPhase::PreCallValidate, 1000);
+    stats.Add(vvl::Func::vkQueueSubmit, vvl::profiling::CallPhase::PreCallValidate, 3000);
+    stats.Add(vvl::Func::vkCmdDraw, vvl::profiling::CallPhase::Dispatch, 2000000);
+    lines = CsvLines(stats);
+    // Header, then overall + top 25% + top 10% for each of the two (entry point, phase) pairs
+    ASSERT_EQ(lines.size(), 7u);
+    ASSERT_EQ(lines[1], "Dispatch_vkCmdDraw,1,2.000000,2.000000,2.000000,2.000000");
+    ASSERT_EQ(lines[4].rfind("PreCallValidate_vkQueueSubmit,2,0.002000,", 0), 0u);
+    ASSERT_EQ(lines[4].substr(lines[4].size() - 18), ",0.001000,0.003000");
+    ASSERT_EQ(lines[5].rfind("PreCallValidate_vkQueueSubmit (top 25%),1,", 0), 0u);
+    ASSERT_EQ(lines[6].rfind("PreCallValidate_vkQueueSubmit (top 10%),1,", 0), 0u);
+}
+
+TEST(CallStats, ScopedTimer) {
+    vvl::profiling::CallStats stats;
+    {
+        vvl::profiling::ScopedCallTimer timer(&stats, nullptr, vvl::Func::vkCreateBuffer,
+                                              vvl::profiling::CallPhase::PostCallRecord);
+    }
+    {
+        // Disabled, must not touch anything
+        vvl::profiling::ScopedCallTimer timer(nullptr, nullptr, vvl::Func::vkCreateBuffer,
+                                              vvl::profiling::CallPhase::PreCallRecord);
+    }
+    const auto lines = CsvLines(stats);
+    ASSERT_EQ(lines.size(), 4u);
+    ASSERT_EQ(lines[1].rfind("PostCallRecord_vkCreateBuffer,1,", 0), 0u);
+}
+
+TEST(CallStats, StartupSteps) {
+    vvl::profiling::CallStats stats;
+    stats.AddStartup("vkCreateInstance_Settings", 1500000);
+    const auto lines = CsvLines(stats);
+    ASSERT_EQ(lines.size(), 2u);
+    ASSERT_EQ(lines[1], "Startup_vkCreateInstance_Settings,1,1.500000,1.500000,1.500000,1.500000");
+}
+
+TEST(CallStats, ChecksSortedBySelfTime) {
+    vvl::profiling::CallStats stats;
+    const uint32_t outer = vvl::profiling::RegisterCheck("ChecksSortedBySelfTime_Outer");
+    const uint32_t inner = vvl::profiling::RegisterCheck("ChecksSortedBySelfTime_Inner");
+    const uint32_t unused = vvl::profiling::RegisterCheck("ChecksSortedBySelfTime_Unused");
+    ASSERT_NE(outer, vvl::profiling::kInvalidCheck);
+    ASSERT_NE(inner, vvl::profiling::kInvalidCheck);
+    ASSERT_NE(unused, vvl::profiling::kInvalidCheck);
+
+    stats.AddCheck(outer, 5000000, 1000000);
+    stats.AddCheck(inner, 4000000, 4000000);
+
+    std::ostringstream out;
+    stats.WriteChecksCsv(out);
+    std::vector<std::string> lines;
+    std::istringstream in(out.str());
+    for (std::string line; std::getline(in, line);) {
+        lines.emplace_back(line);
+    }
+    ASSERT_EQ(lines.size(), 3u);
+    ASSERT_EQ(lines[0], "Check,Count,Self (ms),Total (ms),Avg (ms),Max (ms)");
+    ASSERT_EQ(lines[1], "ChecksSortedBySelfTime_Inner,1,4.000000,4.000000,4.000000,4.000000");
+    ASSERT_EQ(lines[2], "ChecksSortedBySelfTime_Outer,1,1.000000,5.000000,5.000000,5.000000");
+}
+
+TEST(CallStats, NestedCheckTimers) {
+    vvl::profiling::CallStats stats;
+    const uint32_t outer = vvl::profiling::RegisterCheck("NestedCheckTimers_Outer");
+    const uint32_t inner = vvl::profiling::RegisterCheck("NestedCheckTimers_Inner");
+    {
+        vvl::profiling::ScopedCheckTimer outer_timer(&stats, outer);
+        vvl::profiling::ScopedCheckTimer inner_timer(&stats, inner);
+    }
+    {
+        // Disabled, must not touch anything
+        vvl::profiling::ScopedCheckTimer timer(nullptr, outer);
+    }
+
+    std::ostringstream out;
+    stats.WriteChecksCsv(out);
+    const std::string csv = out.str();
+    ASSERT_NE(csv.find("NestedCheckTimers_Outer,1,"), std::string::npos);
+    ASSERT_NE(csv.find("NestedCheckTimers_Inner,1,"), std::string::npos);
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <thread>
+#include <vector>
+
+#include "utils/hash_util.h"
+
+namespace {
+// Only a few hash values, so that different values share an entry
+struct CollidingHash {
+    size_t operator()(const std::vector<uint32_t> &value) const { return value.size() % 2; }
+};
+}  // namespace
+
+TEST(Dictionary, LookUp) {
+    hash_util::Dictionary<std::vector<uint32_t>, CollidingHash> dict;
+    const std::vector<uint32_t> a = {1, 2};
+    const std::vector<uint32_t> b = {3, 4};
+
+    auto a_id = dict.LookUp(a);
+    auto b_id = dict.LookUp(std::vector<uint32_t>(b));
+    ASSERT_NE(a_id, b_id);
+    ASSERT_EQ(*a_id, a);
+    ASSERT_EQ(*b_id, b);
+    ASSERT_EQ(dict.LookUp(a), a_id);
+    ASSERT_EQ(dict.LookUp(std::vector<uint32_t>{3, 4}), b_id);
+    ASSERT_NE(dict.LookUp(std::vector<uint32_t>{}), a_id);
+}
+
+TEST(Dictionary, ConcurrentLookUp) {
+    using Dict = hash_util::Dictionary<std::vector<uint32_t>, hash_util::IsOrderedContainer<std::vector<uint32_t>>>;
+    Dict dict;
+    constexpr uint32_t kThreadCount = 8;
+    constexpr uint32_t kValueCount = 256;
+    std::vector<std::vector<Dict::Id>> ids(kThreadCount);
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreadCount; ++t) {
+        threads.emplace_back([&dict, &ids, t]() {
+            for (uint32_t i = 0; i < kValueCount; ++i) {
+                // Every thread goes through the values in a different order
+                const uint32_t value = (i * (2 * t + 1)) % kValueCount;
+                ids[t].emplace_back(dict.LookUp(std::vector<uint32_t>{value, value + 1}));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (uint32_t t = 0; t < kThreadCount; ++t) {
+        for (uint32_t i = 0; i < kValueCount; ++i) {
+            const uint32_t value = (i * (2 * t + 1)) % kValueCount;
+            ASSERT_EQ(ids[t][i], dict.LookUp(std::vector<uint32_t>{value, value + 1}));
+        }
+    }
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "containers/handle_slab.h"
+
+TEST(CustomContainer, HandleSlabInsertFind) {
+    vvl::HandleSlab slab;
+    std::vector<uint64_t> ids;
+    // Enough entries to spill over several segments
+    const uint64_t count = 4 * vvl::HandleSlab::kFirstSegmentSize;
+    for (uint64_t i = 1; i <= count; ++i) {
+        ids.emplace_back(slab.Insert(i * 3));
+    }
+    for (uint64_t i = 1; i <= count; ++i) {
+        ASSERT_NE(ids[i - 1], 0u);
+        ASSERT_EQ(slab.Find(ids[i - 1]), i * 3);
+    }
+    ASSERT_EQ(slab.Find(0), 0u);
+    // Index that was never handed out
+    ASSERT_EQ(slab.Find((uint64_t(1) << vvl::HandleSlab::kIndexBits) | (count + 1)), 0u);
+}
+
+TEST(CustomContainer, HandleSlabStaleId) {
+    vvl::HandleSlab slab;
+    const uint64_t id = slab.Insert(42);
+    ASSERT_EQ(slab.Erase(id), 42u);
+    ASSERT_EQ(slab.Find(id), 0u);
+    ASSERT_EQ(slab.Erase(id), 0u);
+
+    // The slot is reused, but the old id must not alias the new entry
+    const uint64_t reused_id = slab.Insert(43);
+    ASSERT_EQ(reused_id & vvl::HandleSlab::kIndexMask, id & vvl::HandleSlab::kIndexMask);
+    ASSERT_NE(reused_id, id);
+    ASSERT_EQ(slab.Find(reused_id), 43u);
+    ASSERT_EQ(slab.Find(id), 0u);
+}
+
+TEST(CustomContainer, HandleSlabMultithreaded) {
+    vvl::HandleSlab slab;
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&slab, t]() {
+            for (uint64_t i = 1; i <= 10000; ++i) {
+                const uint64_t value = (uint64_t(t) << 32) | i;
+                const uint64_t id = slab.Insert(value);
+                ASSERT_EQ(slab.Find(id), value);
+                if (i % 2) {
+                    ASSERT_EQ(slab.Erase(id), value);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+TEST(CustomContainer, HandleSlabTags) {
+    vvl::HandleSlab device_a(1);
+    vvl::HandleSlab device_b(2);
+    const uint64_t id_a = device_a.Insert(10);
+    const uint64_t id_b = device_b.Insert(20);
+    // Same slot in both tables, but different ids
+    ASSERT_EQ(id_a & vvl::HandleSlab::kIndexMask, id_b & vvl::HandleSlab::kIndexMask);
+    ASSERT_NE(id_a, id_b);
+    ASSERT_EQ(device_a.Find(id_b), 0u);
+    ASSERT_EQ(device_b.Find(id_a), 0u);
+    ASSERT_EQ(device_b.Erase(id_a), 0u);
+    ASSERT_EQ(device_a.Find(id_a), 10u);
+
+    // Reusing the slot keeps the tag
+    ASSERT_EQ(device_a.Erase(id_a), 10u);
+    const uint64_t reused_id = device_a.Insert(11);
+    ASSERT_EQ(reused_id >> (vvl::HandleSlab::kIndexBits + vvl::HandleSlab::kGenerationBits), 1u);
+    ASSERT_EQ(device_b.Find(reused_id), 0u);
+}
+
+TEST(CustomContainer, HandleSlabManyTablesOnOneThread) {
+    // More tables than a thread caches blocks for, as with the devices of a multi GPU application
+    std::vector<std::unique_ptr<vvl::HandleSlab>> slabs;
+    for (uint32_t i = 0; i < vvl::HandleSlab::kThreadBlocks + 2; ++i) {
+        slabs.emplace_back(std::make_unique<vvl::HandleSlab>(i + 1));
+    }
+    uint64_t highest_index = 0;
+    for (uint32_t round = 0; round < 1000; ++round) {
+        for (auto &slab : slabs) {
+            const uint64_t id = slab->Insert(round + 1);
+            highest_index = std::max(highest_index, id & vvl::HandleSlab::kIndexMask);
+            ASSERT_EQ(slab->Erase(id), round + 1);
+        }
+    }
+    // The indices cached for a table are given back to it instead of being dropped, so the tables do not grow
+    ASSERT_LT(highest_index, 4 * vvl::HandleSlab::kThreadBlockSize);
+
+    // A table destroyed while a thread still caches its indices
+    slabs.front().reset();
+    for (auto &slab : slabs) {
+        if (slab) {
+            ASSERT_NE(slab->Insert(1), 0u);
+        }
+    }
+}
+
+// Not a correctness test, prints how Insert throughput scales with the number of threads creating handles
+TEST(CustomContainer, HandleSlabInsertThroughput) {
+    constexpr uint32_t inserts_per_thread = 200000;
+    for (uint32_t thread_count = 1; thread_count <= 8; thread_count *= 2) {
+        vvl::HandleSlab slab;
+        std::vector<std::thread> threads;
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t t = 0; t < thread_count; ++t) {
+            threads.emplace_back([&slab]() {
+                for (uint64_t i = 1; i <= inserts_per_thread; ++i) {
+                    slab.Erase(slab.Insert(i));
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        const double inserts_per_second = double(thread_count) * inserts_per_thread / elapsed.count();
+        printf("HandleSlab: %u thread(s), %.1f M insert+erase/s\n", thread_count, inserts_per_second / 1e6);
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include <cstdlib>
+#include <map>
+
+#include "containers/custom_containers.h"
+#include "containers/internal_allocator.h"
+#include "containers/range_map.h"
+#include "containers/small_vector.h"
+
+namespace {
+struct CountingCallbacks {
+    std::map<void*, size_t> live;
+    size_t allocations = 0;
+
+    static void* VKAPI_PTR Allocate(void* user_data, size_t size, size_t alignment, VkSystemAllocationScope) {
+        auto* self = static_cast<CountingCallbacks*>(user_data);
+        void* ptr = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+        self->live[ptr] = size;
+        self->allocations++;
+        return ptr;
+    }
+    static void VKAPI_PTR Free(void* user_data, void* ptr) {
+        auto* self = static_cast<CountingCallbacks*>(user_data);
+        if (ptr) {
+            ASSERT_EQ(self->live.erase(ptr), 1u);
+            std::free(ptr);
+        }
+    }
+
+    VkAllocationCallbacks Get() {
+        VkAllocationCallbacks callbacks = {};
+        callbacks.pUserData = this;
+        callbacks.pfnAllocation = Allocate;
+        callbacks.pfnFree = Free;
+        return callbacks;
+    }
+};
+
+// Restores the default resource even when a test fails
+struct ScopedCallbacks {
+    explicit ScopedCallbacks(const VkAllocationCallbacks& callbacks) { vvl::SetInternalAllocationCallbacks(&callbacks); }
+    ~ScopedCallbacks() { vvl::SetInternalAllocationCallbacks(nullptr); }
+};
+}  // namespace
+
+TEST(InternalAllocator, DefaultResource) {
+    vvl::unordered_map<uint32_t, uint64_t> map;
+    small_vector<uint64_t, 2> vector;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        map[i] = i;
+        vector.emplace_back(i);
+    }
+    for (uint32_t i = 0; i < 1000; ++i) {
+        ASSERT_EQ(map[i], i);
+        ASSERT_EQ(vector[i], i);
+    }
+
+    // Blocks of every size and alignment go back where they came from
+    std::vector<void*> blocks;
+    for (size_t size = 1; size < 1024; size += 7) {
+        blocks.emplace_back(vvl::AllocateInternal(size, size % 2 ? 8 : 64));
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(blocks.back()) % (size % 2 ? 8 : 64), 0u);
+    }
+    for (void* block : blocks) {
+        vvl::FreeInternal(block);
+    }
+}
+
+TEST(InternalAllocator, ForwardToCallbacks) {
+    CountingCallbacks counting;
+    const VkAllocationCallbacks callbacks = counting.Get();
+
+    vvl::unordered_map<uint32_t, uint32_t> created_before;
+    {
+        ScopedCallbacks scoped(callbacks);
+        vvl::unordered_map<uint32_t, uint32_t> map;
+        small_vector<uint32_t, 1> vector;
+        sparse_container::range_map<uint64_t, uint32_t> ranges;
+        for (uint32_t i = 0; i < 100; ++i) {
+            map[i] = i;
+            created_before[i] = i;
+            vector.emplace_back(i);
+            ranges.insert(std::make_pair(vvl::range<uint64_t>(i * 2, i * 2 + 1), i));
+        }
+        ASSERT_GT(counting.allocations, 0u);
+        ASSERT_FALSE(counting.live.empty());
+
+        // A container created before the switch keeps the default resource, even when moved to one created after it
+        const size_t live_before_move = counting.live.size();
+        map = std::move(created_before);
+        ASSERT_EQ(map.size(), 100u);
+        ASSERT_LE(counting.live.size(), live_before_move);
+    }
+    ASSERT_TRUE(counting.live.empty());
+
+    // Back to the default resource
+    const size_t allocations = counting.allocations;
+    vvl::unordered_map<uint32_t, uint32_t> map;
+    map[1] = 1;
+    ASSERT_EQ(counting.allocations, allocations);
+}
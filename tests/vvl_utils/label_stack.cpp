@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include "state_tracker/label_stack.h"
+
+TEST(LabelStack, PushPop) {
+    vvl::LabelStack stack;
+    ASSERT_TRUE(stack.empty());
+    ASSERT_EQ(stack.GetRegionName(), "");
+
+    stack.push_back("frame");
+    stack.push_back("shadows");
+    ASSERT_EQ(stack.size(), 2u);
+    ASSERT_EQ(stack.back(), "shadows");
+    ASSERT_EQ(stack.GetRegionName(), "frame::shadows");
+
+    stack.pop_back();
+    ASSERT_EQ(stack.back(), "frame");
+    stack.pop_back();
+    ASSERT_TRUE(stack.empty());
+    ASSERT_EQ(stack.size(), 0u);
+}
+
+TEST(LabelStack, CopiesAreIndependent) {
+    vvl::LabelStack queue_stack;
+    queue_stack.push_back("frame");
+    queue_stack.push_back("gbuffer");
+
+    // Captured at submit time, then the queue stack keeps changing
+    const vvl::LabelStack captured = queue_stack;
+    queue_stack.pop_back();
+    queue_stack.push_back("lighting");
+    queue_stack.push_back("sun");
+
+    ASSERT_EQ(captured.size(), 2u);
+    ASSERT_EQ(captured.GetRegionName(), "frame::gbuffer");
+    ASSERT_EQ(queue_stack.GetRegionName(), "frame::lighting::sun");
+
+    vvl::LabelStack replayed = captured;
+    replayed.pop_back();
+    replayed.pop_back();
+    ASSERT_TRUE(replayed.empty());
+    ASSERT_EQ(captured.GetRegionName(), "frame::gbuffer");
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include "profiling/memory_accounting.h"
+
+using vvl::profiling::MemoryAccounting;
+using vvl::profiling::MemorySubsystem;
+
+TEST(MemoryAccounting, AddSubSet) {
+    MemoryAccounting accounting;
+    for (uint32_t i = 0; i < MemoryAccounting::kSubsystemCount; ++i) {
+        ASSERT_EQ(accounting.Get(MemorySubsystem(i)), 0u);
+    }
+
+    accounting.Add(MemorySubsystem::SyncAccessLogs, 1000);
+    accounting.Add(MemorySubsystem::SyncAccessLogs, 500);
+    accounting.Sub(MemorySubsystem::SyncAccessLogs, 1200);
+    ASSERT_EQ(accounting.Get(MemorySubsystem::SyncAccessLogs), 300u);
+
+    accounting.Set(MemorySubsystem::StateTracker, 4096);
+    accounting.Set(MemorySubsystem::StateTracker, 2048);
+    ASSERT_EQ(accounting.Get(MemorySubsystem::StateTracker), 2048u);
+
+    // Subsystems are independent
+    ASSERT_EQ(accounting.Get(MemorySubsystem::Descriptors), 0u);
+    ASSERT_EQ(accounting.Get(MemorySubsystem::GpuavVma), 0u);
+}
+
+TEST(MemoryAccounting, SubsystemNames) {
+    for (uint32_t i = 0; i < MemoryAccounting::kSubsystemCount; ++i) {
+        const char* name = vvl::profiling::MemorySubsystemName(MemorySubsystem(i));
+        ASSERT_STRNE(name, "Unknown");
+        for (uint32_t j = 0; j < i; ++j) {
+            ASSERT_STRNE(name, vvl::profiling::MemorySubsystemName(MemorySubsystem(j)));
+        }
+    }
+}
+
+TEST(MemoryAccounting, Peaks) {
+    MemoryAccounting accounting;
+    accounting.Set(MemorySubsystem::StateTracker, 1000);
+    accounting.Set(MemorySubsystem::GpuavVma, 4000);
+    // Part of GpuavVma, not counted twice
+    accounting.Set(MemorySubsystem::GpuavVmaPools, 3000);
+    ASSERT_EQ(accounting.Total(), 5000u);
+    ASSERT_EQ(accounting.PeakTotal(), 0u);
+
+    accounting.UpdatePeaks();
+    ASSERT_EQ(accounting.PeakTotal(), 5000u);
+
+    accounting.Set(MemorySubsystem::GpuavVma, 0);
+    accounting.Set(MemorySubsystem::Descriptors, 2000);
+    accounting.UpdatePeaks();
+    ASSERT_EQ(accounting.Total(), 3000u);
+    ASSERT_EQ(accounting.PeakTotal(), 5000u);
+    ASSERT_EQ(accounting.Peak(MemorySubsystem::GpuavVma), 4000u);
+    ASSERT_EQ(accounting.Peak(MemorySubsystem::Descriptors), 2000u);
+    ASSERT_EQ(accounting.Peak(MemorySubsystem::ObjectTracker), 0u);
+}
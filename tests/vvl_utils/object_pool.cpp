@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "containers/object_pool.h"
+
+TEST(ObjectPool, BlocksAreDistinctAndAligned) {
+    struct alignas(64) Aligned {
+        char data[80];
+    };
+    // Pools must outlive the thread caches that point to them
+    static vvl::BlockPool pool("test::Aligned", sizeof(Aligned), alignof(Aligned));
+    std::set<void*> blocks;
+    // Enough to need more than one slab
+    const size_t count = 2 * vvl::BlockPool::kSlabSize / sizeof(Aligned);
+    for (size_t i = 0; i < count; ++i) {
+        void* block = pool.Allocate();
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % alignof(Aligned), 0u);
+        ASSERT_TRUE(blocks.insert(block).second);
+    }
+    auto stats = pool.GetStats();
+    ASSERT_EQ(stats.block_size, 128u);
+    ASSERT_EQ(stats.in_use, count);
+    ASSERT_GE(stats.capacity, count);
+
+    for (void* block : blocks) {
+        pool.Free(block);
+    }
+    stats = pool.GetStats();
+    ASSERT_EQ(stats.in_use, 0u);
+
+    // Freed blocks are reused before the pool grows
+    const size_t capacity = stats.capacity;
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_TRUE(blocks.count(pool.Allocate()) == 1);
+    }
+    ASSERT_EQ(pool.GetStats().capacity, capacity);
+}
+
+TEST(ObjectPool, ThreadsFreeEachOthersBlocks) {
+    static vvl::BlockPool pool("test::Threads", 48, 8);
+    constexpr size_t kPerThread = 4096;
+    constexpr size_t kThreads = 4;
+    std::vector<std::vector<void*>> allocated(kThreads);
+    {
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&allocated, t]() {
+                for (size_t i = 0; i < kPerThread; ++i) {
+                    allocated[t].emplace_back(pool.Allocate());
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    ASSERT_EQ(pool.GetStats().in_use, kThreads * kPerThread);
+    {
+        // Every thread frees the blocks of another one, and gives back its cache when it exits
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&allocated, t]() {
+                for (void* block : allocated[(t + 1) % kThreads]) {
+                    pool.Free(block);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    const auto stats = pool.GetStats();
+    ASSERT_EQ(stats.in_use, 0u);
+    ASSERT_GE(stats.capacity, kThreads * kPerThread);
+}
+
+TEST(ObjectPool, MakePooled) {
+    struct Object {
+        Object(int value_, int& destroyed_) : value(value_), destroyed(destroyed_) {}
+        ~Object() { ++destroyed; }
+        int value;
+        int& destroyed;
+    };
+    int destroyed = 0;
+    {
+        std::vector<std::shared_ptr<Object>> objects;
+        for (int i = 0; i < 100; ++i) {
+            objects.emplace_back(vvl::MakePooled<Object>("test::Object", i, destroyed));
+        }
+        for (int i = 0; i < 100; ++i) {
+            ASSERT_EQ(objects[i]->value, i);
+        }
+        std::weak_ptr<Object> weak = objects[0];
+        objects.clear();
+        ASSERT_EQ(destroyed, 100);
+        ASSERT_TRUE(weak.expired());
+    }
+#if !defined(VVL_OBJECT_POOLS_USE_HEAP)
+    bool found = false;
+    for (const auto& stats : vvl::GetBlockPoolStats()) {
+        if (std::string(stats.name) == "test::Object") {
+            found = true;
+            ASSERT_EQ(stats.in_use, 0u);
+        }
+    }
+    ASSERT_TRUE(found);
+#endif
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <thread>
+#include <vector>
+
+#include "containers/paged_array.h"
+
+namespace {
+struct Element {
+    int value = -1;
+};
+}  // namespace
+
+TEST(PagedArray, Dense) {
+    vvl::PagedArray<Element> array(100, false);
+    ASSERT_FALSE(array.IsPaged());
+    ASSERT_EQ(array.size(), 100u);
+    ASSERT_EQ(array.CreatedCount(), 100u);
+    array[42].value = 42;
+    const auto& const_array = array;
+    ASSERT_EQ(const_array[42].value, 42);
+    ASSERT_EQ(const_array[41].value, -1);
+}
+
+TEST(PagedArray, PagesAreCreatedOnWrite) {
+    constexpr uint32_t kSize = 500000;
+    vvl::PagedArray<Element, 64> array(kSize, true);
+    ASSERT_TRUE(array.IsPaged());
+    ASSERT_EQ(array.CreatedCount(), 0u);
+
+    // Reads do not create anything
+    const auto& const_array = array;
+    for (uint32_t i = 0; i < kSize; i += 1000) {
+        ASSERT_EQ(const_array[i].value, -1);
+    }
+    ASSERT_EQ(array.CreatedCount(), 0u);
+
+    array[0].value = 0;
+    array[63].value = 63;
+    array[kSize - 1].value = 1;
+    ASSERT_EQ(array.CreatedCount(), 128u);
+    ASSERT_EQ(const_array[0].value, 0);
+    ASSERT_EQ(const_array[63].value, 63);
+    ASSERT_EQ(const_array[62].value, -1);
+    ASSERT_EQ(const_array[64].value, -1);
+    ASSERT_EQ(const_array[kSize - 1].value, 1);
+}
+
+TEST(PagedArray, ThreadsCreateTheSamePages) {
+    constexpr uint32_t kSize = 64 * 256;
+    vvl::PagedArray<Element, 64> array(kSize, true);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        // Each thread writes its own elements of every page
+        threads.emplace_back([&array, t]() {
+            for (uint32_t i = t; i < kSize; i += 4) {
+                array[i].value = static_cast<int>(i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(array.CreatedCount(), kSize);
+    const auto& const_array = array;
+    for (uint32_t i = 0; i < kSize; ++i) {
+        ASSERT_EQ(const_array[i].value, static_cast<int>(i));
+    }
+}
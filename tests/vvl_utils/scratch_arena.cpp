@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <string>
+
+#include "containers/scratch_arena.h"
+
+static bool SameMarker(const vvl::ScratchArena::Marker& a, const vvl::ScratchArena::Marker& b) {
+    return a.chunk == b.chunk && a.offset == b.offset;
+}
+
+TEST(CustomContainer, ScratchArrayReleasesOnScopeExit) {
+    vvl::ScratchArena& arena = vvl::ScratchArena::Get();
+    const auto start = arena.GetMarker();
+    {
+        vvl::ScratchArray<uint64_t> a;
+        a.resize(16);
+        for (size_t i = 0; i < a.size(); ++i) {
+            ASSERT_EQ(a[i], 0u);
+            a[i] = i;
+        }
+        {
+            // Bigger than a chunk, forces the arena to grow
+            vvl::ScratchArray<uint32_t> b;
+            b.resize(vvl::ScratchArena::kMinChunkSize);
+            b[b.size() - 1] = 1;
+        }
+        ASSERT_EQ(a[15], 15u);
+    }
+    ASSERT_TRUE(SameMarker(start, arena.GetMarker()));
+
+    // The chunks are reused, so the same allocation comes back at the same address
+    const void* first = nullptr;
+    {
+        vvl::ScratchArray<uint32_t> b;
+        b.resize(vvl::ScratchArena::kMinChunkSize);
+        first = b.data();
+    }
+    {
+        vvl::ScratchArray<uint32_t> b;
+        b.resize(vvl::ScratchArena::kMinChunkSize);
+        ASSERT_EQ(first, b.data());
+    }
+}
+
+TEST(CustomContainer, ScratchArrayNonTrivial) {
+    vvl::ScratchArena& arena = vvl::ScratchArena::Get();
+    const auto start = arena.GetMarker();
+    {
+        // Declared in the opposite order they allocate in, like some of the dispatch code
+        vvl::ScratchArray<std::string> a;
+        vvl::ScratchArray<std::string> b;
+        b.resize(4);
+        a.resize(4);
+        a[0] = "a string long enough to not fit in the small string buffer";
+        b[3] = a[0];
+        ASSERT_EQ(a[0], b[3]);
+        ASSERT_TRUE(a[1].empty());
+    }
+    ASSERT_TRUE(SameMarker(start, arena.GetMarker()));
+}
+
+TEST(CustomContainer, ScratchVectorReleasesOnScopeExit) {
+    vvl::ScratchArena& arena = vvl::ScratchArena::Get();
+    const auto start = arena.GetMarker();
+    {
+        vvl::ScratchVector<uint32_t> a;
+        // Grows past a chunk, every buffer left behind stays in the arena until the vector is gone
+        for (uint32_t i = 0; i < vvl::ScratchArena::kMinChunkSize; ++i) {
+            a.push_back(i);
+        }
+        {
+            vvl::ScratchVector<std::string> b;
+            b.resize(4);
+            b[3] = "a string long enough to not fit in the small string buffer";
+            ASSERT_TRUE(b[0].empty());
+        }
+        ASSERT_EQ(a.size(), vvl::ScratchArena::kMinChunkSize);
+        ASSERT_EQ(a.back(), vvl::ScratchArena::kMinChunkSize - 1);
+    }
+    ASSERT_TRUE(SameMarker(start, arena.GetMarker()));
+
+    {
+        vvl::ScratchScope scope;
+        std::vector<uint64_t, vvl::ScratchAllocator<uint64_t>> c(64, 1);
+        std::vector<uint64_t, vvl::ScratchAllocator<uint64_t>> d(c.begin(), c.end());
+        ASSERT_EQ(c, d);
+    }
+    ASSERT_TRUE(SameMarker(start, arena.GetMarker()));
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <map>
+#include <random>
+#include <vector>
+
+#include "containers/range_map.h"
+#include "containers/segmented_map.h"
+
+namespace {
+using Range = vvl::range<uint64_t>;
+// Small segments, so that the tests split and merge them a lot
+using SegmentedMap = sparse_container::segmented_map<Range, int, 4>;
+using SegmentedRangeMap = sparse_container::range_map<uint64_t, int, Range, SegmentedMap>;
+using StdRangeMap = sparse_container::range_map<uint64_t, int>;
+
+template <typename MapA, typename MapB>
+void ExpectSameContent(const MapA &a, const MapB &b) {
+    ASSERT_EQ(a.size(), b.size());
+    auto it_b = b.begin();
+    for (auto it_a = a.begin(); it_a != a.end(); ++it_a, ++it_b) {
+        ASSERT_EQ(it_a->first, it_b->first);
+        ASSERT_EQ(it_a->second, it_b->second);
+    }
+    ASSERT_TRUE(it_b == b.end());
+}
+
+// Adds value to the existing ranges, inserts it in the gaps
+struct AddOps {
+    int value;
+    template <typename Map, typename Iterator>
+    void infill(Map &map, const Iterator &pos, const Range &range) const {
+        map.insert(pos, std::make_pair(range, value));
+    }
+    template <typename Iterator>
+    void update(const Iterator &pos) const {
+        pos->second += value;
+    }
+};
+}  // namespace
+
+TEST(SegmentedMap, OrderedLikeStdMap) {
+    SegmentedMap map;
+    std::map<Range, int> reference;
+    std::mt19937 rng(1);
+    for (int i = 0; i < 2000; ++i) {
+        const uint64_t begin = rng() % 500;
+        const Range key(begin * 2, begin * 2 + 1);
+        if (rng() % 3 == 0) {
+            auto it = map.find(key);
+            auto ref_it = reference.find(key);
+            ASSERT_EQ(it == map.end(), ref_it == reference.end());
+            if (ref_it != reference.end()) {
+                auto next = map.erase(it);
+                auto ref_next = reference.erase(ref_it);
+                ASSERT_EQ(next == map.end(), ref_next == reference.end());
+                if (ref_next != reference.end()) {
+                    ASSERT_EQ(next->first, ref_next->first);
+                }
+            }
+        } else {
+            // A hint that is right half of the time
+            auto hint_key = (rng() % 2) ? key : Range(rng() % 1000, rng() % 1000 + 1);
+            auto it = map.emplace_hint(map.lower_bound(hint_key), std::make_pair(key, i));
+            auto ref_it = reference.emplace_hint(reference.lower_bound(hint_key), std::make_pair(key, i));
+            ASSERT_EQ(it->first, ref_it->first);
+            ASSERT_EQ(it->second, ref_it->second);
+        }
+        ExpectSameContent(map, reference);
+    }
+
+    for (uint64_t index = 0; index < 1002; ++index) {
+        const Range key(index, index);
+        auto lower = map.lower_bound(key);
+        auto ref_lower = reference.lower_bound(key);
+        ASSERT_EQ(lower == map.end(), ref_lower == reference.end());
+        if (ref_lower != reference.end()) {
+            ASSERT_EQ(lower->first, ref_lower->first);
+        }
+        auto upper = map.upper_bound(key);
+        auto ref_upper = reference.upper_bound(key);
+        ASSERT_EQ(upper == map.end(), ref_upper == reference.end());
+        if (ref_upper != reference.end()) {
+            ASSERT_EQ(upper->first, ref_upper->first);
+        }
+    }
+
+    // Walk backward from the end
+    auto it = map.end();
+    for (auto ref_it = reference.rbegin(); ref_it != reference.rend(); ++ref_it) {
+        --it;
+        ASSERT_EQ(it->first, ref_it->first);
+    }
+    ASSERT_TRUE(it == map.begin());
+}
+
+TEST(SegmentedMap, IteratorsSurviveChanges) {
+    SegmentedMap map;
+    std::vector<SegmentedMap::iterator> iterators;
+    for (uint64_t i = 0; i < 100; ++i) {
+        iterators.emplace_back(map.emplace_hint(map.end(), std::make_pair(Range(i * 4, i * 4 + 1), static_cast<int>(i))));
+    }
+    const int *value = &iterators[50]->second;
+
+    // Fill the gaps in reverse order and erase every other original element, which moves most keys between segments
+    for (uint64_t i = 100; i-- > 0;) {
+        map.emplace_hint(map.begin(), std::make_pair(Range(i * 4 + 2, i * 4 + 3), -1));
+        if (i % 2) {
+            map.erase(iterators[i]);
+        }
+    }
+    ASSERT_EQ(map.size(), 150u);
+    ASSERT_EQ(value, &iterators[50]->second);
+
+    for (uint64_t i = 0; i < 100; i += 2) {
+        auto it = iterators[i];
+        ASSERT_EQ(it->first, Range(i * 4, i * 4 + 1));
+        ++it;
+        ASSERT_EQ(it->first, Range(i * 4 + 2, i * 4 + 3));
+        if (i > 0) {
+            auto prev = iterators[i];
+            --prev;
+            ASSERT_EQ(prev->first, Range(i * 4 - 2, i * 4 - 1));
+        }
+    }
+}
+
+TEST(SegmentedMap, CopyAndMove) {
+    SegmentedMap map;
+    for (uint64_t i = 0; i < 50; ++i) {
+        map.emplace_hint(map.end(), std::make_pair(Range(i, i + 1), static_cast<int>(i)));
+    }
+    SegmentedMap copy(map);
+    ExpectSameContent(copy, map);
+    copy.emplace_hint(copy.end(), std::make_pair(Range(100, 101), 100));
+    ASSERT_EQ(map.size(), 50u);
+
+    SegmentedMap moved(std::move(copy));
+    ASSERT_EQ(moved.size(), 51u);
+    ASSERT_TRUE(copy.empty());
+    moved = map;
+    ExpectSameContent(moved, map);
+    moved.clear();
+    ASSERT_TRUE(moved.begin() == moved.end());
+}
+
+TEST(SegmentedMap, RangeMapLikeStdMap) {
+    SegmentedRangeMap map;
+    StdRangeMap reference;
+    std::mt19937 rng(2);
+    for (int i = 0; i < 3000; ++i) {
+        const uint64_t begin = rng() % 1000;
+        const Range range(begin, begin + 1 + rng() % 40);
+        const int value = static_cast<int>(rng() % 4);
+        switch (rng() % 5) {
+            case 0:
+                map.overwrite_range(std::make_pair(range, value));
+                reference.overwrite_range(std::make_pair(range, value));
+                break;
+            case 1:
+                map.erase_range(range);
+                reference.erase_range(range);
+                break;
+            case 2: {
+                auto merge = [](int &current, const int &new_value) { current += new_value; };
+                map.split_and_merge_insert(std::make_pair(range, value), merge);
+                reference.split_and_merge_insert(std::make_pair(range, value), merge);
+                break;
+            }
+            case 3:
+                sparse_container::infill_update_range(map, range, AddOps{value});
+                sparse_container::infill_update_range(reference, range, AddOps{value});
+                break;
+            default:
+                sparse_container::consolidate(map);
+                sparse_container::consolidate(reference);
+                break;
+        }
+        ExpectSameContent(map, reference);
+    }
+    SegmentedRangeMap spliced;
+    sparse_container::splice(spliced, map, sparse_container::update_prefer_source<int>());
+    ExpectSameContent(spliced, reference);
+}
+
+TEST(SegmentedMap, OverwriteRanges) {
+    SegmentedRangeMap map;
+    StdRangeMap std_map;
+    StdRangeMap reference;
+    std::mt19937 rng(3);
+    for (int i = 0; i < 200; ++i) {
+        // Sorted ranges that do not overlap, touching each other or with gaps of various sizes
+        std::vector<std::pair<Range, int>> batch;
+        uint64_t begin = rng() % 64;
+        for (int j = 0; j < 1 + static_cast<int>(rng() % 40); ++j) {
+            const Range range(begin, begin + 1 + rng() % 8);
+            batch.emplace_back(range, static_cast<int>(rng() % 4));
+            begin = range.end + (rng() % 2 ? 0 : rng() % 64);
+        }
+        uint64_t overwritten_size = 0;
+        map.overwrite_ranges(batch.begin(), batch.end());
+        std_map.overwrite_ranges(batch.begin(), batch.end(), [&overwritten_size](const auto &entry, const Range &overwritten) {
+            ASSERT_TRUE(entry.first.includes(overwritten.begin));
+            overwritten_size += overwritten.distance();
+        });
+        uint64_t reference_overwritten_size = 0;
+        for (const auto &value : batch) {
+            const auto bounds = reference.bounds(value.first);
+            for (auto it = bounds.begin; it != bounds.end; ++it) {
+                reference_overwritten_size += (it->first & value.first).distance();
+            }
+            reference.overwrite_range(value);
+        }
+        ASSERT_EQ(overwritten_size, reference_overwritten_size);
+        ExpectSameContent(map, reference);
+        ExpectSameContent(std_map, reference);
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "containers/sharded_map.h"
+
+TEST(CustomContainer, ShardedMap) {
+    vvl::ShardedMap<uint64_t, std::shared_ptr<int>> map(5);
+    ASSERT_EQ(map.ShardCount(), 8u);
+    ASSERT_TRUE(map.empty());
+
+    for (int i = 0; i < 1000; ++i) {
+        map.insert_or_assign(uint64_t(i), std::make_shared<int>(i));
+    }
+    ASSERT_EQ(map.size(), 1000u);
+    // Replacing keeps a single entry
+    map.insert_or_assign(0, std::make_shared<int>(-1));
+    ASSERT_FALSE(map.insert(1, std::make_shared<int>(-1)));
+    ASSERT_EQ(map.size(), 1000u);
+    ASSERT_EQ(*map.find(0)->second, -1);
+    ASSERT_EQ(*map.find(1)->second, 1);
+    ASSERT_EQ(map.find(1000), map.end());
+    ASSERT_EQ(map.snapshot().size(), 1000u);
+
+    auto popped = map.pop(2);
+    ASSERT_NE(popped, map.end());
+    ASSERT_EQ(*popped->second, 2);
+    ASSERT_EQ(map.pop(2), map.end());
+    map.erase(3);
+    ASSERT_FALSE(map.contains(3));
+    ASSERT_EQ(map.size(), 998u);
+
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.find(0), map.end());
+}
+
+TEST(CustomContainer, ShardedMapEraseIf) {
+    vvl::ShardedMap<int, uint64_t> map(4);
+    for (int i = 0; i < 100; ++i) {
+        map.insert(i, uint64_t(i % 10));
+    }
+    ASSERT_EQ(map.erase_if([](int, uint64_t value) { return value == 3; }), 10u);
+    ASSERT_EQ(map.size(), 90u);
+    ASSERT_FALSE(map.contains(13));
+    ASSERT_TRUE(map.contains(14));
+    ASSERT_EQ(map.erase_if([](int key, uint64_t) { return key >= 1000; }), 0u);
+    ASSERT_EQ(map.erase_if([](int, uint64_t) { return true; }), 90u);
+    ASSERT_TRUE(map.empty());
+}
+
+TEST(CustomContainer, ShardedMapDefaultShardCount) {
+    vvl::ShardedMap<uint64_t, int> map;
+    ASSERT_EQ(map.ShardCount(), vvl::DefaultShardCount());
+    ASSERT_GE(map.ShardCount(), std::min(4 * std::thread::hardware_concurrency(), 256u));
+}
+
+namespace {
+// Readers look up objects while one writer creates and destroys others, like Get<T>() during asset streaming
+template <typename Map>
+double LookupsPerMicrosecond(Map &map, uint32_t reader_count) {
+    constexpr uint64_t kObjectCount = 4096;
+    constexpr uint32_t kLookupsPerReader = 200000;
+    for (uint64_t i = 0; i < kObjectCount; ++i) {
+        map.insert_or_assign(i, std::make_shared<int>(int(i)));
+    }
+    std::atomic<bool> done{false};
+    std::thread writer([&map, &done]() {
+        for (uint64_t i = kObjectCount; !done.load(std::memory_order_relaxed); ++i) {
+            map.insert_or_assign(i, std::make_shared<int>(int(i)));
+            map.pop(i);
+        }
+    });
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> readers;
+    for (uint32_t t = 0; t < reader_count; ++t) {
+        readers.emplace_back([&map, t]() {
+            uint64_t key = t;
+            for (uint32_t i = 0; i < kLookupsPerReader; ++i) {
+                key = (key * 2862933555777941757ull + 3037000493ull);
+                auto found = map.find(key % kObjectCount);
+                ASSERT_NE(found, map.end());
+            }
+        });
+    }
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    const auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    done = true;
+    writer.join();
+    return double(kLookupsPerReader) * reader_count / elapsed;
+}
+}  // namespace
+
+// Not a pass/fail test, prints the lookup throughput of the state tracker map against the 4 shard default
+TEST(CustomContainer, ShardedMapContention) {
+    const uint32_t reader_count = std::max(2u, std::thread::hardware_concurrency());
+    vvl::concurrent_unordered_map<uint64_t, std::shared_ptr<int>> fixed_map;
+    vvl::ShardedMap<uint64_t, std::shared_ptr<int>> sharded_map;
+    const double fixed = LookupsPerMicrosecond(fixed_map, reader_count);
+    const double sharded = LookupsPerMicrosecond(sharded_map, reader_count);
+    printf("%u readers: concurrent_unordered_map (4 shards) %.1f lookups/us, ShardedMap (%u shards) %.1f lookups/us\n",
+           reader_count, fixed, sharded_map.ShardCount(), sharded);
+}
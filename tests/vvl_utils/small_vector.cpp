@@ -426,6 +426,67 @@ TEST(CustomContainer, SmallVectorAssign) {
     ASSERT_TRUE(HaveSameElements(ref_xxl, v_dst));
 }
 
+TEST(CustomContainer, SmallVectorAppendAndInsert) {
+    // Trivially copyable, copied with memcpy
+    small_vector<uint32_t, 2> words = {1, 2};
+    const std::vector<uint32_t> more = {3, 4, 5};
+    words.append(more.data(), more.data() + more.size());
+    words.PushBackFrom(more);
+    ASSERT_TRUE(HaveSameElements(words, std::vector<uint32_t>{1, 2, 3, 4, 5, 3, 4, 5}));
+    const uint32_t middle[] = {8, 9};
+    auto inserted = words.insert(words.begin() + 1, std::begin(middle), std::end(middle));
+    ASSERT_EQ(*inserted, 8u);
+    words.insert(words.end(), more.begin(), more.begin() + 1);
+    ASSERT_TRUE(HaveSameElements(words, std::vector<uint32_t>{1, 8, 9, 2, 3, 4, 5, 3, 4, 5, 3}));
+
+    // Not trivially copyable
+    small_vector<std::string, 2, size_t> strings = {"one"};
+    const std::vector<std::string> names = {"two", "three", "four"};
+    strings.append(names.begin(), names.end());
+    strings.insert(strings.begin(), names.begin() + 2, names.end());
+    strings.insert(strings.begin() + 2, names.begin(), names.begin() + 1);
+    ASSERT_TRUE(HaveSameElements(strings, std::vector<std::string>{"four", "one", "two", "two", "three", "four"}));
+
+    // An lvalue is copied, only an rvalue is moved from
+    std::vector<std::string> source = {"five"};
+    strings.PushBackFrom(source);
+    ASSERT_EQ(source[0], "five");
+    strings.PushBackFrom(std::move(source));
+    ASSERT_EQ(strings.back(), "five");
+    ASSERT_EQ(strings.size(), 8u);
+}
+
+TEST(CustomContainer, SmallVectorGrowth) {
+    small_vector<uint32_t, 2> v;
+    for (uint32_t i = 0; i < 100; ++i) {
+        v.emplace_back(i);
+    }
+    // Grows by doubling, not one element at a time
+    ASSERT_EQ(v.capacity(), 128u);
+    for (uint32_t i = 0; i < 100; ++i) {
+        ASSERT_EQ(v[i], i);
+    }
+
+    // reserve is exact
+    small_vector<std::string, 2> strings;
+    strings.reserve(5);
+    ASSERT_EQ(strings.capacity(), 5u);
+    for (int i = 0; i < 6; ++i) {
+        strings.emplace_back(std::to_string(i));
+    }
+    ASSERT_EQ(strings.capacity(), 10u);
+    strings.shrink_to_fit();
+    ASSERT_EQ(strings.capacity(), 6u);
+    ASSERT_EQ(strings[5], "5");
+
+    small_vector<uint32_t, 4> words;
+    words.resize_uninitialized(6);
+    std::memcpy(words.data(), v.data(), 6 * sizeof(uint32_t));
+    ASSERT_TRUE(HaveSameElements(words, std::vector<uint32_t>{0, 1, 2, 3, 4, 5}));
+    words.resize_uninitialized(2);
+    ASSERT_EQ(words.size(), 2u);
+}
+
 TEST(CustomContainer, Enumerate) {
     small_vector<int, 2, size_t> sv = {1, 2, 3, 4};
     std::array ref_elements = {1, 2, 3, 4};
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <vector>
+
+#include "utils/spirv_compression.h"
+
+namespace {
+uint32_t InstructionWord(uint32_t length, uint32_t opcode) { return (length << 16) | opcode; }
+}  // namespace
+
+TEST(SpirvCompression, Instructions) {
+    // Header, OpCapability Shader, OpMemoryModel, OpTypeVoid, OpConstant with a large literal
+    const std::vector<uint32_t> words = {0x07230203, 0x00010600, 0, 64, 0,                                         //
+                                         InstructionWord(2, 17), 1,                                                //
+                                         InstructionWord(3, 14), 0, 1,                                             //
+                                         InstructionWord(2, 19), 2,                                                //
+                                         InstructionWord(4, 43), 3, 4, 0xdeadbeef};
+    const std::vector<uint8_t> compressed = spirv::CompressWords(words);
+    ASSERT_LT(compressed.size(), words.size() * sizeof(uint32_t));
+
+    std::vector<uint32_t> decompressed;
+    ASSERT_TRUE(spirv::DecompressWords(compressed, decompressed));
+    ASSERT_EQ(decompressed, words);
+}
+
+TEST(SpirvCompression, NotInstructions) {
+    // A zero length instruction and a length past the end, still round trips word by word
+    for (const std::vector<uint32_t> &words : {std::vector<uint32_t>{0x07230203, 0x00010600, 0, 64, 0, 0, 7},
+                                               std::vector<uint32_t>{0x07230203, 0x00010600, 0, 64, 0, InstructionWord(9, 17)},
+                                               std::vector<uint32_t>{1, 2}, std::vector<uint32_t>{}}) {
+        std::vector<uint32_t> decompressed;
+        ASSERT_TRUE(spirv::DecompressWords(spirv::CompressWords(words), decompressed));
+        ASSERT_EQ(decompressed, words);
+    }
+}
+
+TEST(SpirvCompression, Corrupted) {
+    const std::vector<uint32_t> words = {0x07230203, 0x00010600, 0, 64, 0, InstructionWord(2, 17), 1};
+    std::vector<uint8_t> compressed = spirv::CompressWords(words);
+    std::vector<uint32_t> decompressed;
+
+    ASSERT_FALSE(spirv::DecompressWords({}, decompressed));
+    compressed.pop_back();
+    ASSERT_FALSE(spirv::DecompressWords(compressed, decompressed));
+    compressed[0] = 7;
+    ASSERT_FALSE(spirv::DecompressWords(compressed, decompressed));
+}
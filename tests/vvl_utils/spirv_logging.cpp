@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <vector>
+
+#include "error_message/spirv_logging.h"
+
+namespace {
+uint32_t InstructionWord(uint32_t length, uint32_t opcode) { return (length << 16) | opcode; }
+}  // namespace
+
+TEST(SpirvLogging, DebugLineIndex) {
+    // Positions count the instructions after the header
+    const std::vector<uint32_t> words = {0x07230203, 0x00010600, 0, 64, 0,              //
+                                         InstructionWord(4, 5), 10, 0x6e69616d, 0,      // 0: OpName %10 "main"
+                                         InstructionWord(5, 54), 1, 10, 0, 2,           // 1: OpFunction %10
+                                         InstructionWord(2, 248), 11,                   // 2: OpLabel
+                                         InstructionWord(4, 8), 3, 7, 2,                // 3: OpLine (offset 16)
+                                         InstructionWord(1, 253),                       // 4: OpReturn
+                                         InstructionWord(1, 56),                        // 5: OpFunctionEnd
+                                         InstructionWord(5, 54), 1, 20, 0, 2,           // 6: OpFunction %20, no name
+                                         InstructionWord(2, 248), 21,                   // 7: OpLabel
+                                         InstructionWord(1, 253),                       // 8: OpReturn
+                                         InstructionWord(1, 56)};                       // 9: OpFunctionEnd
+    const spirv::DebugLineIndex index(words);
+
+    ASSERT_EQ(index.GetDebugLineOffset(2), 0u);
+    ASSERT_EQ(index.GetDebugLineOffset(3), 16u);
+    ASSERT_EQ(index.GetDebugLineOffset(4), 16u);
+    // Debug lines do not cross function boundaries
+    ASSERT_EQ(index.GetDebugLineOffset(5), 0u);
+    ASSERT_EQ(index.GetDebugLineOffset(8), 0u);
+    ASSERT_EQ(index.GetDebugLineOffset(100), 0u);
+
+    ASSERT_EQ(index.GetFunctionName(0), nullptr);
+    ASSERT_STREQ(index.GetFunctionName(1), "main");
+    ASSERT_STREQ(index.GetFunctionName(4), "main");
+    ASSERT_STREQ(index.GetFunctionName(5), "main");
+    ASSERT_EQ(index.GetFunctionName(7), nullptr);
+    ASSERT_EQ(index.GetFunctionName(100), nullptr);
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "containers/epoch_reclaimer.h"
+#include "containers/state_object_map.h"
+
+using DenseMap = vvl::StateObjectMap<VkBuffer, std::shared_ptr<int>>;
+
+TEST(CustomContainer, StateObjectMapDense) {
+    vvl::HandleSlab slab;
+    DenseMap map(&slab);
+    std::vector<VkBuffer> handles;
+    // Enough entries to spill over several segments
+    for (int i = 0; i < 4 * int(DenseMap::kFirstSegmentSize); ++i) {
+        const VkBuffer handle = CastFromUint64<VkBuffer>(slab.Insert(uint64_t(i) + 1));
+        map.insert_or_assign(handle, std::make_shared<int>(i));
+        handles.emplace_back(handle);
+    }
+    ASSERT_EQ(map.size(), handles.size());
+    for (size_t i = 0; i < handles.size(); ++i) {
+        const auto found = map.find(handles[i]);
+        ASSERT_NE(found, map.end());
+        ASSERT_EQ(*found->second, int(i));
+    }
+
+    // Replacing keeps a single entry
+    map.insert_or_assign(handles[0], std::make_shared<int>(-1));
+    ASSERT_EQ(*map.find(handles[0])->second, -1);
+    ASSERT_EQ(map.size(), handles.size());
+
+    const auto popped = map.pop(handles[1]);
+    ASSERT_NE(popped, map.end());
+    ASSERT_EQ(*popped->second, 1);
+    ASSERT_EQ(map.find(handles[1]), map.end());
+    ASSERT_EQ(map.pop(handles[1]), map.end());
+    ASSERT_EQ(map.snapshot().size(), handles.size() - 1);
+
+    // The popped entry is reused by the next handle, the old handle must not find it
+    slab.Erase(CastToUint64(handles[1]));
+    const VkBuffer reused = CastFromUint64<VkBuffer>(slab.Insert(1000));
+    map.insert_or_assign(reused, std::make_shared<int>(1000));
+    ASSERT_EQ(*map.find(reused)->second, 1000);
+    ASSERT_EQ(map.find(handles[1]), map.end());
+
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.find(handles[0]), map.end());
+    ASSERT_EQ(slab.FindAux(CastToUint64(handles[0])), 0u);
+}
+
+TEST(CustomContainer, StateObjectMapNotWrapped) {
+    vvl::HandleSlab slab;
+    DenseMap dense(&slab);
+    DenseMap regular;
+    // Not an id of the slab, both maps must fall back to hashing
+    const VkBuffer handle = CastFromUint64<VkBuffer>(0x1234567800000010ull);
+    for (DenseMap* map : {&dense, &regular}) {
+        map->insert_or_assign(handle, std::make_shared<int>(7));
+        ASSERT_EQ(*map->find(handle)->second, 7);
+        ASSERT_EQ(map->size(), 1u);
+        ASSERT_EQ(map->snapshot().size(), 1u);
+        ASSERT_NE(map->pop(handle), map->end());
+        ASSERT_TRUE(map->empty());
+    }
+}
+
+TEST(CustomContainer, StateObjectMapMultithreaded) {
+    vvl::HandleSlab slab;
+    DenseMap map(&slab);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&slab, &map, t]() {
+            for (int i = 0; i < 5000; ++i) {
+                const VkBuffer handle = CastFromUint64<VkBuffer>(slab.Insert(uint64_t(i) + 1));
+                map.insert_or_assign(handle, std::make_shared<int>(t));
+                ASSERT_EQ(*map.find(handle)->second, t);
+                if (i % 2) {
+                    ASSERT_NE(map.pop(handle), map.end());
+                    slab.Erase(CastToUint64(handle));
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(map.size(), 4u * 2500u);
+    ASSERT_EQ(map.snapshot().size(), 4u * 2500u);
+}
+
+TEST(CustomContainer, StateObjectMapThreadCache) {
+    vvl::HandleSlab slab;
+    DenseMap dense(&slab);
+    DenseMap regular;
+    const VkBuffer dense_handle = CastFromUint64<VkBuffer>(slab.Insert(1));
+    const VkBuffer regular_handle = CastFromUint64<VkBuffer>(0x1234567800000010ull);
+    for (auto [map, handle] : {std::make_pair(&dense, dense_handle), std::make_pair(&regular, regular_handle)}) {
+        map->insert_or_assign(handle, std::make_shared<int>(1));
+        // The second lookup comes from the cache
+        ASSERT_EQ(*map->find(handle)->second, 1);
+        ASSERT_EQ(*map->find(handle)->second, 1);
+
+        // A replaced value is not served from the cache
+        map->insert_or_assign(handle, std::make_shared<int>(2));
+        ASSERT_EQ(*map->find(handle)->second, 2);
+
+        // Nor a popped one
+        ASSERT_NE(map->pop(handle), map->end());
+        ASSERT_EQ(map->find(handle), map->end());
+    }
+
+    // Clearing the map releases the values cached by every thread, while the threads are still alive
+    std::weak_ptr<int> weak;
+    {
+        auto value = std::make_shared<int>(3);
+        weak = value;
+        dense.insert_or_assign(dense_handle, std::move(value));
+    }
+    std::atomic<bool> looked_up{false};
+    std::atomic<bool> cleared{false};
+    std::thread thread([&]() {
+        ASSERT_EQ(*dense.find(dense_handle)->second, 3);
+        looked_up = true;
+        while (!cleared) {
+            std::this_thread::yield();
+        }
+    });
+    while (!looked_up) {
+        std::this_thread::yield();
+    }
+    ASSERT_EQ(*dense.find(dense_handle)->second, 3);
+    dense.clear();
+    ASSERT_TRUE(weak.expired());
+    cleared = true;
+    thread.join();
+}
+
+TEST(CustomContainer, StateObjectMapBorrowed) {
+    vvl::HandleSlab slab;
+    DenseMap map(&slab);
+    vvl::EpochReclaimer reclaimer;
+    const VkBuffer handle = CastFromUint64<VkBuffer>(slab.Insert(1));
+    std::weak_ptr<int> weak;
+    {
+        auto value = std::make_shared<int>(5);
+        weak = value;
+        map.insert_or_assign(handle, std::move(value));
+    }
+
+    std::atomic<bool> borrowed{false};
+    std::atomic<bool> retired{false};
+    std::thread thread([&]() {
+        vvl::EpochReclaimer::Scope scope;
+        const int* value = map.find_borrowed(handle);
+        ASSERT_NE(value, nullptr);
+        borrowed = true;
+        while (!retired) {
+            std::this_thread::yield();
+        }
+        // Still alive while the scope that borrowed it is open
+        ASSERT_EQ(*value, 5);
+        // Popped values are not found anymore, even through the thread cache
+        ASSERT_EQ(map.find_borrowed(handle), nullptr);
+    });
+    while (!borrowed) {
+        std::this_thread::yield();
+    }
+    auto popped = map.pop(handle);
+    ASSERT_NE(popped, map.end());
+    reclaimer.Retire(std::move(popped->second));
+    ASSERT_FALSE(weak.expired());
+    retired = true;
+    thread.join();
+
+    // No scope is open anymore, the next retirement releases both
+    reclaimer.Retire(std::make_shared<int>(6));
+    ASSERT_TRUE(weak.expired());
+    ASSERT_EQ(reclaimer.RetiredCount(), 0u);
+
+    // Objects retired while a scope of this thread is open wait for it, nested scopes included
+    {
+        vvl::EpochReclaimer::Scope scope;
+        {
+            vvl::EpochReclaimer::Scope nested;
+            ASSERT_TRUE(vvl::EpochReclaimer::InScope());
+        }
+        auto value = std::make_shared<int>(7);
+        weak = value;
+        reclaimer.Retire(std::move(value));
+        ASSERT_FALSE(weak.expired());
+    }
+    ASSERT_FALSE(vvl::EpochReclaimer::InScope());
+    reclaimer.Flush();
+    ASSERT_TRUE(weak.expired());
+}
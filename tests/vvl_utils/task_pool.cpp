@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "utils/task_pool.h"
+
+TEST(TaskPool, RunsEveryIterationOnce) {
+    vvl::TaskPool pool(4);
+    ASSERT_EQ(pool.WorkerCount(), 0u);
+
+    for (uint32_t count : {0u, 1u, 2u, 3u, 100u, 1000u}) {
+        std::vector<std::atomic<uint32_t>> calls(count);
+        pool.ParallelFor(count, [&calls](uint32_t i) { calls[i].fetch_add(1, std::memory_order_relaxed); });
+        for (uint32_t i = 0; i < count; ++i) {
+            ASSERT_EQ(calls[i].load(), 1u);
+        }
+    }
+    // The calling thread is one of the 4
+    ASSERT_EQ(pool.WorkerCount(), 3u);
+}
+
+TEST(TaskPool, SmallLoopsStartNoWorker) {
+    vvl::TaskPool pool(4);
+    uint32_t sum = 0;
+    pool.ParallelFor(1, [&sum](uint32_t i) { sum += i + 1; });
+    ASSERT_EQ(sum, 1u);
+    ASSERT_EQ(pool.WorkerCount(), 0u);
+
+    vvl::TaskPool single_thread_pool(1);
+    single_thread_pool.ParallelFor(10, [&sum](uint32_t i) { sum += i; });
+    ASSERT_EQ(sum, 46u);
+    ASSERT_EQ(single_thread_pool.WorkerCount(), 0u);
+}
+
+TEST(TaskPool, ConcurrentLoops) {
+    vvl::TaskPool pool(4);
+    constexpr uint32_t kThreads = 4;
+    constexpr uint32_t kCount = 200;
+    std::vector<std::vector<uint32_t>> results(kThreads, std::vector<uint32_t>(kCount, 0));
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&pool, &results, t]() {
+            for (uint32_t loop = 0; loop < 50; ++loop) {
+                // Only one of the threads gets the workers at a time, the others run their loop alone
+                pool.ParallelFor(kCount, [&results, t](uint32_t i) { results[t][i] += i; });
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        for (uint32_t i = 0; i < kCount; ++i) {
+            ASSERT_EQ(results[t][i], 50 * i);
+        }
+    }
+}
+
+TEST(JobQueue, RunsEveryJobOnce) {
+    vvl::JobQueue queue(4);
+    ASSERT_EQ(queue.WorkerCount(), 0u);
+
+    constexpr uint32_t kCount = 1000;
+    std::vector<std::atomic<uint32_t>> calls(kCount);
+    for (uint32_t i = 0; i < kCount; ++i) {
+        queue.Post([&calls, i]() { calls[i].fetch_add(1, std::memory_order_relaxed); });
+    }
+    queue.WaitIdle();
+    for (uint32_t i = 0; i < kCount; ++i) {
+        ASSERT_EQ(calls[i].load(), 1u);
+    }
+    ASSERT_LE(queue.WorkerCount(), 4u);
+}
+
+TEST(JobQueue, DestructorRunsQueuedJobs) {
+    std::atomic<uint32_t> sum{0};
+    {
+        vvl::JobQueue queue(1);
+        for (uint32_t i = 1; i <= 100; ++i) {
+            queue.Post([&sum, i]() { sum.fetch_add(i, std::memory_order_relaxed); });
+        }
+    }
+    ASSERT_EQ(sum.load(), 5050u);
+}
+
+TEST(JobQueue, PostFromManyThreads) {
+    vvl::JobQueue queue(2);
+    constexpr uint32_t kThreads = 4;
+    constexpr uint32_t kJobs = 200;
+    std::atomic<uint32_t> count{0};
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&queue, &count]() {
+            for (uint32_t i = 0; i < kJobs; ++i) {
+                queue.Post([&count]() { count.fetch_add(1, std::memory_order_relaxed); });
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    queue.WaitIdle();
+    ASSERT_EQ(count.load(), kThreads * kJobs);
+}
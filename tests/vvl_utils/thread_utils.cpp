@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <thread>
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "utils/task_pool.h"
+#include "utils/thread_utils.h"
+
+TEST(ThreadUtils, PoolSize) {
+    const vvl::ThreadSettings saved = vvl::GetThreadSettings();
+    vvl::ThreadSettings settings = saved;
+    settings.pool_size = 3;
+    vvl::SetThreadSettings(settings);
+    ASSERT_EQ(vvl::DefaultPoolThreadCount(), 3u);
+
+    {
+        // The calling thread counts as one of the 3
+        vvl::TaskPool pool;
+        pool.ParallelFor(100, [](uint32_t) {});
+        ASSERT_EQ(pool.WorkerCount(), 2u);
+
+        vvl::TaskPool explicit_pool(5);
+        explicit_pool.ParallelFor(100, [](uint32_t) {});
+        ASSERT_EQ(explicit_pool.WorkerCount(), 4u);
+    }
+
+    settings.pool_size = 0;
+    vvl::SetThreadSettings(settings);
+    ASSERT_GE(vvl::DefaultPoolThreadCount(), 1u);
+    vvl::SetThreadSettings(saved);
+}
+
+#if defined(__linux__)
+TEST(ThreadUtils, Affinity) {
+    cpu_set_t allowed;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+    uint32_t first_cpu = 0;
+    while (first_cpu < 64 && !CPU_ISSET(first_cpu, &allowed)) {
+        ++first_cpu;
+    }
+    if (first_cpu == 64) {
+        GTEST_SKIP() << "No CPU below 64";
+    }
+
+    const vvl::ThreadSettings saved = vvl::GetThreadSettings();
+    vvl::ThreadSettings settings = saved;
+    settings.cpu_affinity_mask = 1ull << first_cpu;
+    vvl::SetThreadSettings(settings);
+
+    int cpu_count = 0;
+    bool on_first_cpu = false;
+    std::thread thread = vvl::StartThread("AffinityTest", [&]() {
+        cpu_set_t cpu_set;
+        if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0) {
+            cpu_count = CPU_COUNT(&cpu_set);
+            on_first_cpu = CPU_ISSET(first_cpu, &cpu_set);
+        }
+    });
+    thread.join();
+    vvl::SetThreadSettings(saved);
+
+    ASSERT_EQ(cpu_count, 1);
+    ASSERT_TRUE(on_first_cpu);
+}
+#endif
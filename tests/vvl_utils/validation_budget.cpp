@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include "profiling/validation_budget.h"
+
+using vvl::profiling::ValidationBudget;
+
+static constexpr uint32_t kAllObjects = (1u << LayerObjectTypeBestPractices) | (1u << LayerObjectTypeSyncValidation);
+
+// Runs frames that take frame_ns until one sheds or brings back a validation object, returns how many frames it took
+static uint32_t FramesUntilChange(ValidationBudget& budget, uint64_t frame_ns, ValidationBudget::Change& change) {
+    for (uint32_t frame = 1; frame <= 100000; ++frame) {
+        budget.AddLayerTime(frame_ns);
+        if (auto result = budget.EndFrame()) {
+            change = *result;
+            return frame;
+        }
+    }
+    return 0;
+}
+
+TEST(ValidationBudget, ShedInOrderAndBringBackInReverse) {
+    ValidationBudget budget(1000, kAllObjects);
+    ValidationBudget::Change change{};
+
+    ASSERT_EQ(FramesUntilChange(budget, 2000, change), ValidationBudget::kFramesOverBudget);
+    ASSERT_EQ(change.object_type, LayerObjectTypeBestPractices);
+    ASSERT_TRUE(change.shed);
+    ASSERT_EQ(change.frame_ns, 2000u);
+    ASSERT_EQ(budget.ShedMask(), 1u << LayerObjectTypeBestPractices);
+
+    ASSERT_EQ(FramesUntilChange(budget, 2000, change), ValidationBudget::kFramesOverBudget);
+    ASSERT_EQ(change.object_type, LayerObjectTypeSyncValidation);
+    ASSERT_EQ(budget.ShedMask(), kAllObjects);
+
+    // Nothing left to shed
+    for (uint32_t frame = 0; frame < 10; ++frame) {
+        budget.AddLayerTime(2000);
+        ASSERT_FALSE(budget.EndFrame());
+    }
+
+    // Over half the budget is not enough headroom
+    for (uint32_t frame = 0; frame < 2 * ValidationBudget::kFramesUnderBudget; ++frame) {
+        budget.AddLayerTime(800);
+        ASSERT_FALSE(budget.EndFrame());
+    }
+
+    ASSERT_EQ(FramesUntilChange(budget, 100, change), ValidationBudget::kFramesUnderBudget);
+    ASSERT_EQ(change.object_type, LayerObjectTypeSyncValidation);
+    ASSERT_FALSE(change.shed);
+    ASSERT_EQ(budget.ShedMask(), 1u << LayerObjectTypeBestPractices);
+
+    ASSERT_EQ(FramesUntilChange(budget, 100, change), ValidationBudget::kFramesUnderBudget);
+    ASSERT_EQ(change.object_type, LayerObjectTypeBestPractices);
+    ASSERT_EQ(budget.ShedMask(), 0u);
+}
+
+TEST(ValidationBudget, OnlyObjectsOfTheDevice) {
+    ValidationBudget budget(1000, 1u << LayerObjectTypeSyncValidation);
+    ValidationBudget::Change change{};
+    ASSERT_EQ(FramesUntilChange(budget, 2000, change), ValidationBudget::kFramesOverBudget);
+    ASSERT_EQ(change.object_type, LayerObjectTypeSyncValidation);
+    ASSERT_EQ(budget.ShedMask(), 1u << LayerObjectTypeSyncValidation);
+
+    ValidationBudget nothing_to_shed(1000, 1u << LayerObjectTypeCoreValidation);
+    for (uint32_t frame = 0; frame < 10; ++frame) {
+        nothing_to_shed.AddLayerTime(2000);
+        ASSERT_FALSE(nothing_to_shed.EndFrame());
+    }
+    ASSERT_EQ(nothing_to_shed.ShedMask(), 0u);
+}
+
+TEST(ValidationBudget, BackOffWhenShedAgainSoon) {
+    ValidationBudget budget(1000, 1u << LayerObjectTypeBestPractices);
+    ValidationBudget::Change change{};
+    ASSERT_EQ(FramesUntilChange(budget, 2000, change), ValidationBudget::kFramesOverBudget);
+    ASSERT_EQ(FramesUntilChange(budget, 100, change), ValidationBudget::kFramesUnderBudget);
+
+    // Going over the budget right after it was brought back makes the next wait twice as long
+    ASSERT_EQ(FramesUntilChange(budget, 2000, change), ValidationBudget::kFramesOverBudget);
+    ASSERT_TRUE(change.shed);
+    ASSERT_EQ(FramesUntilChange(budget, 100, change), 2 * ValidationBudget::kFramesUnderBudget);
+    ASSERT_FALSE(change.shed);
+}
+
+TEST(ValidationBudget, LayerTimeIsPerFrame) {
+    ValidationBudget budget(1000, 1u << LayerObjectTypeBestPractices);
+    // Several calls of one frame add up, and frames do not carry over
+    for (uint32_t frame = 0; frame < 10; ++frame) {
+        budget.AddLayerTime(400);
+        budget.AddLayerTime(400);
+        ASSERT_FALSE(budget.EndFrame());
+    }
+    for (uint32_t frame = 1; frame < ValidationBudget::kFramesOverBudget; ++frame) {
+        budget.AddLayerTime(600);
+        budget.AddLayerTime(600);
+        ASSERT_FALSE(budget.EndFrame());
+    }
+    budget.AddLayerTime(1200);
+    ASSERT_TRUE(budget.EndFrame());
+}